@@ -0,0 +1,80 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "endstone/detail/base64.h"
+
+namespace {
+
+std::string randomBytes(std::size_t size)
+{
+    std::mt19937 rng{42};
+    std::uniform_int_distribution<int> dist{0, 255};
+    std::string data(size, '\0');
+    for (auto &c : data) {
+        c = static_cast<char>(dist(rng));
+    }
+    return data;
+}
+
+}  // namespace
+
+void BM_Base64Encode(benchmark::State &state)
+{
+    auto data = randomBytes(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(endstone::detail::base64_encode(data));
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+// 64x64 and 128x128 RGBA skins, and a large NBT export
+BENCHMARK(BM_Base64Encode)->Arg(64 * 64 * 4)->Arg(128 * 128 * 4)->Arg(1 << 20);
+
+void BM_Base64EncodeIntoBuffer(benchmark::State &state)
+{
+    auto data = randomBytes(state.range(0));
+    std::string buffer(endstone::detail::base64_encoded_size(data.size()), '\0');
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(endstone::detail::base64_encode(data, buffer.data()));
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_Base64EncodeIntoBuffer)->Arg(64 * 64 * 4)->Arg(128 * 128 * 4)->Arg(1 << 20);
+
+void BM_Base64Decode(benchmark::State &state)
+{
+    auto encoded = endstone::detail::base64_encode(randomBytes(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(endstone::detail::base64_decode(encoded));
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_Base64Decode)->Arg(64 * 64 * 4)->Arg(128 * 128 * 4)->Arg(1 << 20);
+
+void BM_Base64DecodeIntoBuffer(benchmark::State &state)
+{
+    auto encoded = endstone::detail::base64_encode(randomBytes(state.range(0)));
+    std::string buffer(state.range(0), '\0');
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(endstone::detail::base64_decode(encoded, buffer.data(), buffer.size()));
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_Base64DecodeIntoBuffer)->Arg(64 * 64 * 4)->Arg(128 * 128 * 4)->Arg(1 << 20);
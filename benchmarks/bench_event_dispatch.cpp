@@ -0,0 +1,282 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <gmock/gmock.h>
+
+#include "endstone/boss/boss_bar.h"
+#include "endstone/detail/logger_factory.h"
+#include "endstone/detail/plugin/plugin_manager.h"
+
+class MockServer : public endstone::Server {
+public:
+    MOCK_METHOD(std::string, getName, (), (const, override));
+    MOCK_METHOD(std::string, getVersion, (), (const, override));
+    MOCK_METHOD(std::string, getMinecraftVersion, (), (const, override));
+    MOCK_METHOD(endstone::Logger &, getLogger, (), (const, override));
+    MOCK_METHOD(endstone::PluginManager &, getPluginManager, (), (const, override));
+    MOCK_METHOD(endstone::PluginCommand *, getPluginCommand, (std::string), (const, override));
+    MOCK_METHOD(endstone::ConsoleCommandSender &, getCommandSender, (), (const, override));
+    MOCK_METHOD(bool, dispatchCommand, (endstone::CommandSender &, std::string), (const, override));
+    MOCK_METHOD(endstone::Scheduler &, getScheduler, (), (const, override));
+    MOCK_METHOD(endstone::Level *, getLevel, (), (const, override));
+    MOCK_METHOD(int, getBlockTypeId, (std::string_view type), (const, override));
+    MOCK_METHOD(const std::vector<endstone::Player *> &, getOnlinePlayers, (), (const, override));
+    MOCK_METHOD(int, getMaxPlayers, (), (const, override));
+    MOCK_METHOD(void, setMaxPlayers, (int), (override));
+    MOCK_METHOD(endstone::Player *, getPlayer, (endstone::UUID), (const, override));
+    MOCK_METHOD(endstone::Player *, getPlayer, (std::string), (const, override));
+    MOCK_METHOD(void, shutdown, (), (override));
+    MOCK_METHOD(void, reload, (), (override));
+    MOCK_METHOD(void, reloadData, (), (override));
+    MOCK_METHOD(void, broadcast, (const std::string &, const std::string &), (const, override));
+    MOCK_METHOD(void, broadcastMessage, (const std::string &), (const, override));
+    MOCK_METHOD(void, broadcastPacket, (endstone::Packet &, const std::vector<endstone::Player *> &),
+                (const, override));
+    MOCK_METHOD(void, broadcastPacket, (endstone::Packet &, const std::function<bool(const endstone::Player &)> &),
+                (const, override));
+    MOCK_METHOD(bool, isPrimaryThread, (), (const, override));
+    MOCK_METHOD(endstone::Scoreboard *, getScoreboard, (), (const, override));
+    MOCK_METHOD(std::shared_ptr<endstone::Scoreboard>, getNewScoreboard, (), (override));
+    MOCK_METHOD(float, getCurrentMillisecondsPerTick, (), (override));
+    MOCK_METHOD(float, getAverageMillisecondsPerTick, (), (override));
+    MOCK_METHOD(float, getCurrentTicksPerSecond, (), (override));
+    MOCK_METHOD(float, getAverageTicksPerSecond, (), (override));
+    MOCK_METHOD(float, getCurrentTickUsage, (), (override));
+    MOCK_METHOD(float, getAverageTickUsage, (), (override));
+    MOCK_METHOD(endstone::TickStatistics, getTickStatistics, (endstone::TickWindow), (const, override));
+    MOCK_METHOD(std::uint64_t, getWallClockTick, (), (const, override));
+    MOCK_METHOD(std::chrono::system_clock::time_point, getStartTime, (), (override));
+    MOCK_METHOD(void, setTickConsistentActorReads, (bool), (override));
+    MOCK_METHOD(bool, isTickConsistentActorReads, (), (const, override));
+    MOCK_METHOD(void, setPlayerMoveThresholds, (float, float), (override));
+    MOCK_METHOD(float, getPlayerMoveDistanceThreshold, (), (const, override));
+    MOCK_METHOD(float, getPlayerMoveRotationThreshold, (), (const, override));
+    MOCK_METHOD(endstone::PlayerDataStore &, getPlayerDataStore, (), (const, override));
+    MOCK_METHOD(endstone::Messenger &, getMessenger, (), (const, override));
+    MOCK_METHOD(endstone::PacketInterceptor &, getPacketInterceptor, (), (const, override));
+    MOCK_METHOD(endstone::PacketPriority, getPacketPriority, (int), (const, override));
+    MOCK_METHOD(void, setPacketPriority, (int, endstone::PacketPriority), (override));
+    MOCK_METHOD(endstone::Player *, getPlayerByXuid, (const std::string &), (const, override));
+    MOCK_METHOD(endstone::Player *, getPlayerByRuntimeId, (std::uint64_t), (const, override));
+    MOCK_METHOD(std::vector<endstone::Player *>, getMovementAnomalies, (float, float), (const, override));
+    MOCK_METHOD(std::string, translate, (const endstone::Translatable &, const std::string &), (const, override));
+    MOCK_METHOD(void, sendTranslated, (const endstone::Translatable &, const std::vector<endstone::Player *> &),
+                (const, override));
+    MOCK_METHOD(std::unique_ptr<endstone::BossBar>, createBossBar,
+                (std::string, endstone::BarColor, endstone::BarStyle), (const, override));
+    MOCK_METHOD(std::unique_ptr<endstone::BossBar>, createBossBar,
+                (std::string, endstone::BarColor, endstone::BarStyle, std::vector<endstone::BarFlag>),
+                (const, override));
+    MockServer()
+    {
+        ON_CALL(*this, getLogger())
+            .WillByDefault(testing::ReturnRef(endstone::detail::LoggerFactory::getLogger("Test")));
+        ON_CALL(*this, isPrimaryThread()).WillByDefault(testing::Return(true));
+    }
+};
+
+// Answers the thread check of every callEvent without going through gmock
+class BenchmarkServer : public testing::NiceMock<MockServer> {
+public:
+    [[nodiscard]] bool isPrimaryThread() const override
+    {
+        return true;
+    }
+};
+
+class MockPlugin : public endstone::Plugin {
+public:
+    MOCK_METHOD(const endstone::PluginDescription &, getDescription, (), (const, override));
+    MockPlugin()
+    {
+        setEnabled(true);
+    }
+};
+
+class BenchmarkEvent : public endstone::Event {
+public:
+    ENDSTONE_EVENT(BenchmarkEvent);
+
+    [[nodiscard]] bool isCancellable() const override
+    {
+        return true;
+    }
+
+    void onHandle()
+    {
+        benchmark::DoNotOptimize(++count_);
+    }
+
+private:
+    int count_ = 0;
+};
+
+class Listener {
+public:
+    void onBenchmarkEvent(BenchmarkEvent &event)
+    {
+        event.onHandle();
+    }
+};
+
+class NoopScope : public endstone::EventDispatchScope {
+public:
+    void enter(endstone::Event &event) override
+    {
+        benchmark::DoNotOptimize(&event);
+    }
+
+    void exit(endstone::Event &event) noexcept override
+    {
+        benchmark::DoNotOptimize(&event);
+    }
+};
+
+class DispatchFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State & /*state*/) override
+    {
+        server_ = std::make_unique<BenchmarkServer>();
+        plugin_ = std::make_unique<testing::NiceMock<MockPlugin>>();
+        ON_CALL(*plugin_, getDescription()).WillByDefault(testing::ReturnRef(description_));
+        plugin_manager_ = std::make_unique<endstone::detail::EndstonePluginManager>(*server_);
+    }
+
+    void TearDown(const benchmark::State & /*state*/) override
+    {
+        plugin_manager_.reset();
+        plugin_.reset();
+        server_.reset();
+    }
+
+    void registerHandler(endstone::EventExecutor executor,
+                         endstone::EventPriority priority = endstone::EventPriority::Normal,
+                         bool ignore_cancelled = false)
+    {
+        plugin_manager_->registerEvent(BenchmarkEvent::NAME, std::move(executor), priority, *plugin_,
+                                       ignore_cancelled);
+    }
+
+    void registerLambdas(std::int64_t count, bool mixed_priorities = false)
+    {
+        for (std::int64_t i = 0; i < count; ++i) {
+            auto priority = mixed_priorities ? static_cast<endstone::EventPriority>(i % 6)
+                                             : endstone::EventPriority::Normal;
+            registerHandler(endstone::EventExecutor::create<BenchmarkEvent>([](BenchmarkEvent &e) { e.onHandle(); }),
+                            priority);
+        }
+    }
+
+    void run(benchmark::State &state)
+    {
+        for (auto _ : state) {
+            BenchmarkEvent event;
+            plugin_manager_->callEvent(event);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+protected:
+    std::unique_ptr<BenchmarkServer> server_;
+    std::unique_ptr<testing::NiceMock<MockPlugin>> plugin_;
+    std::unique_ptr<endstone::detail::EndstonePluginManager> plugin_manager_;
+    endstone::PluginDescription description_{"benchmark_plugin", "1.0.0"};
+    Listener listener_;
+};
+
+// Handlers taking the base event through a std::function, as registered by older plugins
+BENCHMARK_DEFINE_F(DispatchFixture, CallEventFunction)(benchmark::State &state)
+{
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+        registerHandler(std::function<void(endstone::Event &)>(
+            [](endstone::Event &e) { static_cast<BenchmarkEvent &>(e).onHandle(); }));
+    }
+    run(state);
+}
+BENCHMARK_REGISTER_F(DispatchFixture, CallEventFunction)->Arg(0)->Arg(1)->Arg(10)->Arg(100);
+
+// Handlers stored inline in a typed executor
+BENCHMARK_DEFINE_F(DispatchFixture, CallEventLambda)(benchmark::State &state)
+{
+    registerLambdas(state.range(0));
+    run(state);
+}
+BENCHMARK_REGISTER_F(DispatchFixture, CallEventLambda)->Arg(0)->Arg(1)->Arg(10)->Arg(100);
+
+// Member function handlers, as registered through Plugin::registerEvent
+BENCHMARK_DEFINE_F(DispatchFixture, CallEventMemberFunction)(benchmark::State &state)
+{
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+        registerHandler(endstone::EventExecutor::create(&Listener::onBenchmarkEvent, listener_));
+    }
+    run(state);
+}
+BENCHMARK_REGISTER_F(DispatchFixture, CallEventMemberFunction)->Arg(0)->Arg(1)->Arg(10)->Arg(100);
+
+BENCHMARK_DEFINE_F(DispatchFixture, CallEventMixedPriorities)(benchmark::State &state)
+{
+    registerLambdas(state.range(0), true);
+    run(state);
+}
+BENCHMARK_REGISTER_F(DispatchFixture, CallEventMixedPriorities)->Arg(10)->Arg(100);
+
+// The first handler cancels the event, then half of the remaining handlers ignore cancelled events
+BENCHMARK_DEFINE_F(DispatchFixture, CallEventCancelled)(benchmark::State &state)
+{
+    registerHandler([](endstone::Event &e) { e.setCancelled(true); }, endstone::EventPriority::Lowest);
+    for (std::int64_t i = 1; i < state.range(0); ++i) {
+        registerHandler(endstone::EventExecutor::create<BenchmarkEvent>([](BenchmarkEvent &e) { e.onHandle(); }),
+                        endstone::EventPriority::Normal, i % 2 == 0);
+    }
+    run(state);
+}
+BENCHMARK_REGISTER_F(DispatchFixture, CallEventCancelled)->Arg(10)->Arg(100);
+
+// Handlers sharing a dispatch scope, the way Python handlers share the GIL
+BENCHMARK_DEFINE_F(DispatchFixture, CallEventScoped)(benchmark::State &state)
+{
+    auto scope = std::make_shared<NoopScope>();
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+        auto executor = endstone::EventExecutor::create<BenchmarkEvent>([](BenchmarkEvent &e) { e.onHandle(); });
+        executor.setScope(scope);
+        registerHandler(std::move(executor));
+    }
+    run(state);
+}
+BENCHMARK_REGISTER_F(DispatchFixture, CallEventScoped)->Arg(1)->Arg(10)->Arg(100);
+
+BENCHMARK_DEFINE_F(DispatchFixture, CallEventWithTimings)(benchmark::State &state)
+{
+    registerLambdas(state.range(0));
+    plugin_manager_->setTimingsEnabled(true);
+    run(state);
+}
+BENCHMARK_REGISTER_F(DispatchFixture, CallEventWithTimings)->Arg(1)->Arg(10)->Arg(100);
+
+BENCHMARK_DEFINE_F(DispatchFixture, HasListeners)(benchmark::State &state)
+{
+    registerLambdas(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(plugin_manager_->hasListeners<BenchmarkEvent>());
+    }
+}
+BENCHMARK_REGISTER_F(DispatchFixture, HasListeners)->Arg(0)->Arg(1);
@@ -0,0 +1,346 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <gmock/gmock.h>
+
+#include "endstone/boss/boss_bar.h"
+#include "endstone/detail/logger_factory.h"
+#include "endstone/detail/permissions/permissible_base.h"
+#include "endstone/detail/plugin/plugin_manager.h"
+#include "endstone/permissions/permission.h"
+
+namespace {
+
+class PermissionBenchmarkServer : public endstone::Server {
+public:
+    MOCK_METHOD(std::string, getName, (), (const, override));
+    MOCK_METHOD(std::string, getVersion, (), (const, override));
+    MOCK_METHOD(std::string, getMinecraftVersion, (), (const, override));
+    MOCK_METHOD(endstone::Logger &, getLogger, (), (const, override));
+    MOCK_METHOD(endstone::PluginManager &, getPluginManager, (), (const, override));
+    MOCK_METHOD(endstone::PluginCommand *, getPluginCommand, (std::string), (const, override));
+    MOCK_METHOD(endstone::ConsoleCommandSender &, getCommandSender, (), (const, override));
+    MOCK_METHOD(bool, dispatchCommand, (endstone::CommandSender &, std::string), (const, override));
+    MOCK_METHOD(endstone::Scheduler &, getScheduler, (), (const, override));
+    MOCK_METHOD(endstone::Level *, getLevel, (), (const, override));
+    MOCK_METHOD(int, getBlockTypeId, (std::string_view type), (const, override));
+    MOCK_METHOD(const std::vector<endstone::Player *> &, getOnlinePlayers, (), (const, override));
+    MOCK_METHOD(int, getMaxPlayers, (), (const, override));
+    MOCK_METHOD(void, setMaxPlayers, (int), (override));
+    MOCK_METHOD(endstone::Player *, getPlayer, (endstone::UUID), (const, override));
+    MOCK_METHOD(endstone::Player *, getPlayer, (std::string), (const, override));
+    MOCK_METHOD(void, shutdown, (), (override));
+    MOCK_METHOD(void, reload, (), (override));
+    MOCK_METHOD(void, reloadData, (), (override));
+    MOCK_METHOD(void, broadcast, (const std::string &, const std::string &), (const, override));
+    MOCK_METHOD(void, broadcastMessage, (const std::string &), (const, override));
+    MOCK_METHOD(void, broadcastPacket, (endstone::Packet &, const std::vector<endstone::Player *> &),
+                (const, override));
+    MOCK_METHOD(void, broadcastPacket, (endstone::Packet &, const std::function<bool(const endstone::Player &)> &),
+                (const, override));
+    MOCK_METHOD(bool, isPrimaryThread, (), (const, override));
+    MOCK_METHOD(endstone::Scoreboard *, getScoreboard, (), (const, override));
+    MOCK_METHOD(std::shared_ptr<endstone::Scoreboard>, getNewScoreboard, (), (override));
+    MOCK_METHOD(float, getCurrentMillisecondsPerTick, (), (override));
+    MOCK_METHOD(float, getAverageMillisecondsPerTick, (), (override));
+    MOCK_METHOD(float, getCurrentTicksPerSecond, (), (override));
+    MOCK_METHOD(float, getAverageTicksPerSecond, (), (override));
+    MOCK_METHOD(float, getCurrentTickUsage, (), (override));
+    MOCK_METHOD(float, getAverageTickUsage, (), (override));
+    MOCK_METHOD(endstone::TickStatistics, getTickStatistics, (endstone::TickWindow), (const, override));
+    MOCK_METHOD(std::uint64_t, getWallClockTick, (), (const, override));
+    MOCK_METHOD(std::chrono::system_clock::time_point, getStartTime, (), (override));
+    MOCK_METHOD(void, setTickConsistentActorReads, (bool), (override));
+    MOCK_METHOD(bool, isTickConsistentActorReads, (), (const, override));
+    MOCK_METHOD(void, setPlayerMoveThresholds, (float, float), (override));
+    MOCK_METHOD(float, getPlayerMoveDistanceThreshold, (), (const, override));
+    MOCK_METHOD(float, getPlayerMoveRotationThreshold, (), (const, override));
+    MOCK_METHOD(endstone::PlayerDataStore &, getPlayerDataStore, (), (const, override));
+    MOCK_METHOD(endstone::Messenger &, getMessenger, (), (const, override));
+    MOCK_METHOD(endstone::PacketInterceptor &, getPacketInterceptor, (), (const, override));
+    MOCK_METHOD(endstone::PacketPriority, getPacketPriority, (int), (const, override));
+    MOCK_METHOD(void, setPacketPriority, (int, endstone::PacketPriority), (override));
+    MOCK_METHOD(endstone::Player *, getPlayerByXuid, (const std::string &), (const, override));
+    MOCK_METHOD(endstone::Player *, getPlayerByRuntimeId, (std::uint64_t), (const, override));
+    MOCK_METHOD(std::vector<endstone::Player *>, getMovementAnomalies, (float, float), (const, override));
+    MOCK_METHOD(std::string, translate, (const endstone::Translatable &, const std::string &), (const, override));
+    MOCK_METHOD(void, sendTranslated, (const endstone::Translatable &, const std::vector<endstone::Player *> &),
+                (const, override));
+    MOCK_METHOD(std::unique_ptr<endstone::BossBar>, createBossBar,
+                (std::string, endstone::BarColor, endstone::BarStyle), (const, override));
+    MOCK_METHOD(std::unique_ptr<endstone::BossBar>, createBossBar,
+                (std::string, endstone::BarColor, endstone::BarStyle, std::vector<endstone::BarFlag>),
+                (const, override));
+    PermissionBenchmarkServer()
+    {
+        ON_CALL(*this, getLogger())
+            .WillByDefault(testing::ReturnRef(endstone::detail::LoggerFactory::getLogger("Test")));
+        ON_CALL(*this, isPrimaryThread()).WillByDefault(testing::Return(true));
+    }
+};
+
+class PermissionBenchmarkPlugin : public endstone::Plugin {
+public:
+    MOCK_METHOD(const endstone::PluginDescription &, getDescription, (), (const, override));
+    PermissionBenchmarkPlugin()
+    {
+        setEnabled(true);
+    }
+};
+
+// Forwards to a PermissibleBase, the way players and command senders do
+class BenchmarkPermissible : public endstone::Permissible {
+public:
+    BenchmarkPermissible(endstone::detail::EndstonePluginManager &plugin_manager, bool op)
+        : op_(op), perm_(this, &plugin_manager)
+    {
+    }
+
+    [[nodiscard]] bool isOp() const override
+    {
+        return op_;
+    }
+
+    void setOp(bool value) override
+    {
+        op_ = value;
+    }
+
+    [[nodiscard]] bool isPermissionSet(std::string name) const override
+    {
+        return perm_.isPermissionSet(name);
+    }
+
+    [[nodiscard]] bool isPermissionSet(const endstone::Permission &perm) const override
+    {
+        return perm_.isPermissionSet(perm);
+    }
+
+    [[nodiscard]] bool hasPermission(std::string name) const override
+    {
+        return perm_.hasPermission(name);
+    }
+
+    [[nodiscard]] bool hasPermission(const endstone::Permission &perm) const override
+    {
+        return perm_.hasPermission(perm);
+    }
+
+    endstone::PermissionAttachment *addAttachment(endstone::Plugin &plugin, const std::string &name,
+                                                  bool value) override
+    {
+        return perm_.addAttachment(plugin, name, value);
+    }
+
+    endstone::PermissionAttachment *addAttachment(endstone::Plugin &plugin) override
+    {
+        return perm_.addAttachment(plugin);
+    }
+
+    bool removeAttachment(endstone::PermissionAttachment &attachment) override
+    {
+        return perm_.removeAttachment(attachment);
+    }
+
+    void recalculatePermissions() override
+    {
+        perm_.recalculatePermissions();
+    }
+
+    void recalculatePermission(endstone::PermissionAttachment &attachment, const std::string &name,
+                               bool value) override
+    {
+        perm_.recalculatePermission(attachment, name, value);
+    }
+
+    [[nodiscard]] std::unordered_set<endstone::PermissionAttachmentInfo *> getEffectivePermissions() const override
+    {
+        return perm_.getEffectivePermissions();
+    }
+
+    [[nodiscard]] endstone::CommandSender *asCommandSender() const override
+    {
+        return nullptr;
+    }
+
+private:
+    bool op_;
+    endstone::detail::PermissibleBase perm_;
+};
+
+constexpr int NumPlugins = 40;
+constexpr int NodesPerPlugin = 75;
+const std::vector<std::string> Groups = {"group.default", "group.vip", "group.mod", "group.admin"};
+const std::string BroadcastChannel = "endstone.broadcast.user";
+
+/**
+ * Registers the permissions of 40 plugins with 75 nodes and a wildcard each, plus four inheriting groups in the style
+ * of permission group plugins, then attaches a group and a few overrides to each of range(0) permissibles.
+ */
+class PermissionFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State &state) override
+    {
+        using endstone::Permission;
+        using endstone::PermissionDefault;
+        server_ = std::make_unique<testing::NiceMock<PermissionBenchmarkServer>>();
+        plugin_ = std::make_unique<testing::NiceMock<PermissionBenchmarkPlugin>>();
+        ON_CALL(*plugin_, getDescription()).WillByDefault(testing::ReturnRef(description_));
+        plugin_manager_ = std::make_unique<endstone::detail::EndstonePluginManager>(*server_);
+
+        std::mt19937 random(42);
+        plugin_manager_->addPermission(std::make_unique<Permission>(BroadcastChannel, "", PermissionDefault::True));
+        for (int p = 0; p < NumPlugins; ++p) {
+            auto prefix = "plugin" + std::to_string(p);
+            std::unordered_map<std::string, bool> wildcard;
+            for (int n = 0; n < NodesPerPlugin; ++n) {
+                auto name = prefix + ".command." + std::to_string(n);
+                auto default_value = n % 5 == 0 ? PermissionDefault::True : PermissionDefault::Operator;
+                names_.push_back(name);
+                permissions_.push_back(
+                    plugin_manager_->addPermission(std::make_unique<Permission>(name, "", default_value)));
+                wildcard.emplace(name, true);
+            }
+            plugin_manager_->addPermission(
+                std::make_unique<Permission>(prefix + ".*", "", PermissionDefault::Operator, wildcard));
+        }
+
+        // Each group inherits the previous one, grants 100 more nodes and negates a few of the inherited ones
+        std::unordered_map<std::string, bool> children;
+        for (std::size_t g = 0; g < Groups.size(); ++g) {
+            if (g > 0) {
+                children = {{Groups[g - 1], true}};
+            }
+            for (int n = 0; n < 100; ++n) {
+                children.emplace(names_[random() % names_.size()], n % 10 != 0);
+            }
+            if (g == Groups.size() - 1) {
+                for (int p = 0; p < NumPlugins; ++p) {
+                    children.emplace("plugin" + std::to_string(p) + ".*", true);
+                }
+            }
+            plugin_manager_->addPermission(
+                std::make_unique<Permission>(Groups[g], "", PermissionDefault::False, children));
+        }
+
+        const auto count = static_cast<std::size_t>(state.range(0));
+        for (std::size_t i = 0; i < count; ++i) {
+            auto &permissible = permissibles_.emplace_back(
+                std::make_unique<BenchmarkPermissible>(*plugin_manager_, i % 20 == 0));
+            permissible->recalculatePermissions();
+            // 60% default, 20% vip, 10% mod and 10% admin
+            auto group = i % 10 < 6 ? 0 : i % 10 < 8 ? 1 : i % 10 < 9 ? 2 : 3;
+            auto *attachment = permissible->addAttachment(*plugin_, Groups[group], true);
+            for (int n = 0; n < 3; ++n) {
+                attachment->setPermission(names_[random() % names_.size()], random() % 2 == 0);
+            }
+        }
+        plugin_manager_->recalculateDirtyPermissibles();
+    }
+
+    void TearDown(const benchmark::State & /*state*/) override
+    {
+        permissibles_.clear();
+        names_.clear();
+        permissions_.clear();
+        plugin_manager_.reset();
+        plugin_.reset();
+        server_.reset();
+    }
+
+protected:
+    std::unique_ptr<testing::NiceMock<PermissionBenchmarkServer>> server_;
+    std::unique_ptr<testing::NiceMock<PermissionBenchmarkPlugin>> plugin_;
+    std::unique_ptr<endstone::detail::EndstonePluginManager> plugin_manager_;
+    endstone::PluginDescription description_{"benchmark_plugin", "1.0.0"};
+    std::vector<std::unique_ptr<BenchmarkPermissible>> permissibles_;
+    std::vector<std::string> names_;
+    std::vector<endstone::Permission *> permissions_;
+};
+
+}  // namespace
+
+// Recalculates the permissions of one permissible per iteration, as on join or a group change
+BENCHMARK_DEFINE_F(PermissionFixture, RecalculatePermissions)(benchmark::State &state)
+{
+    std::size_t i = 0;
+    for (auto _ : state) {
+        permissibles_[i++ % permissibles_.size()]->recalculatePermissions();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_REGISTER_F(PermissionFixture, RecalculatePermissions)->Arg(100)->Arg(500);
+
+// Checks a permission by name, as command completion does for every command of every player
+BENCHMARK_DEFINE_F(PermissionFixture, HasPermissionByName)(benchmark::State &state)
+{
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const auto &permissible = permissibles_[i % permissibles_.size()];
+        benchmark::DoNotOptimize(permissible->hasPermission(names_[i % names_.size()]));
+        ++i;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_REGISTER_F(PermissionFixture, HasPermissionByName)->Arg(100)->Arg(500);
+
+BENCHMARK_DEFINE_F(PermissionFixture, HasPermissionByReference)(benchmark::State &state)
+{
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const auto &permissible = permissibles_[i % permissibles_.size()];
+        benchmark::DoNotOptimize(permissible->hasPermission(*permissions_[i % permissions_.size()]));
+        ++i;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_REGISTER_F(PermissionFixture, HasPermissionByReference)->Arg(100)->Arg(500);
+
+// Resolves the recipients of a broadcast the way EndstoneServer::broadcast does, minus the command sender lookup
+BENCHMARK_DEFINE_F(PermissionFixture, BroadcastSubscribers)(benchmark::State &state)
+{
+    for (auto _ : state) {
+        auto id = plugin_manager_->findPermissionId(BroadcastChannel);
+        const auto *perm = plugin_manager_->getPermissionById(id);
+        std::unordered_set<const endstone::Permissible *> recipients;
+        for (const auto *permissible : plugin_manager_->getPermissionSubscribers(id)) {
+            if (permissible->hasPermission(*perm)) {
+                recipients.insert(permissible);
+            }
+        }
+        benchmark::DoNotOptimize(recipients);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_REGISTER_F(PermissionFixture, BroadcastSubscribers)->Arg(100)->Arg(500);
+
+// The public API, which copies the subscribers into a new set
+BENCHMARK_DEFINE_F(PermissionFixture, GetPermissionSubscriptions)(benchmark::State &state)
+{
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(plugin_manager_->getPermissionSubscriptions(BroadcastChannel));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_REGISTER_F(PermissionFixture, GetPermissionSubscriptions)->Arg(100)->Arg(500);
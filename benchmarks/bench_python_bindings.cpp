@@ -0,0 +1,299 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <gmock/gmock.h>
+#include <pybind11/embed.h>
+#include <pybind11/functional.h>
+#include <pybind11/stl.h>
+
+#include "endstone/boss/boss_bar.h"
+#include "endstone/detail/logger_factory.h"
+#include "endstone/detail/scheduler/scheduler.h"
+#include "endstone/event/server/broadcast_message_event.h"
+#include "endstone/level/location.h"
+
+namespace py = pybind11;
+
+namespace {
+
+class BindingMockServer : public endstone::Server {
+public:
+    MOCK_METHOD(std::string, getName, (), (const, override));
+    MOCK_METHOD(std::string, getVersion, (), (const, override));
+    MOCK_METHOD(std::string, getMinecraftVersion, (), (const, override));
+    MOCK_METHOD(endstone::Logger &, getLogger, (), (const, override));
+    MOCK_METHOD(endstone::PluginManager &, getPluginManager, (), (const, override));
+    MOCK_METHOD(endstone::PluginCommand *, getPluginCommand, (std::string), (const, override));
+    MOCK_METHOD(endstone::ConsoleCommandSender &, getCommandSender, (), (const, override));
+    MOCK_METHOD(bool, dispatchCommand, (endstone::CommandSender &, std::string), (const, override));
+    MOCK_METHOD(endstone::Scheduler &, getScheduler, (), (const, override));
+    MOCK_METHOD(endstone::Level *, getLevel, (), (const, override));
+    MOCK_METHOD(int, getBlockTypeId, (std::string_view type), (const, override));
+    MOCK_METHOD(const std::vector<endstone::Player *> &, getOnlinePlayers, (), (const, override));
+    MOCK_METHOD(int, getMaxPlayers, (), (const, override));
+    MOCK_METHOD(void, setMaxPlayers, (int), (override));
+    MOCK_METHOD(endstone::Player *, getPlayer, (endstone::UUID), (const, override));
+    MOCK_METHOD(endstone::Player *, getPlayer, (std::string), (const, override));
+    MOCK_METHOD(void, shutdown, (), (override));
+    MOCK_METHOD(void, reload, (), (override));
+    MOCK_METHOD(void, reloadData, (), (override));
+    MOCK_METHOD(void, broadcast, (const std::string &, const std::string &), (const, override));
+    MOCK_METHOD(void, broadcastMessage, (const std::string &), (const, override));
+    MOCK_METHOD(void, broadcastPacket, (endstone::Packet &, const std::vector<endstone::Player *> &),
+                (const, override));
+    MOCK_METHOD(void, broadcastPacket, (endstone::Packet &, const std::function<bool(const endstone::Player &)> &),
+                (const, override));
+    MOCK_METHOD(bool, isPrimaryThread, (), (const, override));
+    MOCK_METHOD(endstone::Scoreboard *, getScoreboard, (), (const, override));
+    MOCK_METHOD(std::shared_ptr<endstone::Scoreboard>, getNewScoreboard, (), (override));
+    MOCK_METHOD(float, getCurrentMillisecondsPerTick, (), (override));
+    MOCK_METHOD(float, getAverageMillisecondsPerTick, (), (override));
+    MOCK_METHOD(float, getCurrentTicksPerSecond, (), (override));
+    MOCK_METHOD(float, getAverageTicksPerSecond, (), (override));
+    MOCK_METHOD(float, getCurrentTickUsage, (), (override));
+    MOCK_METHOD(float, getAverageTickUsage, (), (override));
+    MOCK_METHOD(endstone::TickStatistics, getTickStatistics, (endstone::TickWindow), (const, override));
+    MOCK_METHOD(std::uint64_t, getWallClockTick, (), (const, override));
+    MOCK_METHOD(std::chrono::system_clock::time_point, getStartTime, (), (override));
+    MOCK_METHOD(void, setTickConsistentActorReads, (bool), (override));
+    MOCK_METHOD(bool, isTickConsistentActorReads, (), (const, override));
+    MOCK_METHOD(void, setPlayerMoveThresholds, (float, float), (override));
+    MOCK_METHOD(float, getPlayerMoveDistanceThreshold, (), (const, override));
+    MOCK_METHOD(float, getPlayerMoveRotationThreshold, (), (const, override));
+    MOCK_METHOD(endstone::PlayerDataStore &, getPlayerDataStore, (), (const, override));
+    MOCK_METHOD(endstone::Messenger &, getMessenger, (), (const, override));
+    MOCK_METHOD(endstone::PacketInterceptor &, getPacketInterceptor, (), (const, override));
+    MOCK_METHOD(endstone::PacketPriority, getPacketPriority, (int), (const, override));
+    MOCK_METHOD(void, setPacketPriority, (int, endstone::PacketPriority), (override));
+    MOCK_METHOD(endstone::Player *, getPlayerByXuid, (const std::string &), (const, override));
+    MOCK_METHOD(endstone::Player *, getPlayerByRuntimeId, (std::uint64_t), (const, override));
+    MOCK_METHOD(std::vector<endstone::Player *>, getMovementAnomalies, (float, float), (const, override));
+    MOCK_METHOD(std::string, translate, (const endstone::Translatable &, const std::string &), (const, override));
+    MOCK_METHOD(void, sendTranslated, (const endstone::Translatable &, const std::vector<endstone::Player *> &),
+                (const, override));
+    MOCK_METHOD(std::unique_ptr<endstone::BossBar>, createBossBar,
+                (std::string, endstone::BarColor, endstone::BarStyle), (const, override));
+    MOCK_METHOD(std::unique_ptr<endstone::BossBar>, createBossBar,
+                (std::string, endstone::BarColor, endstone::BarStyle, std::vector<endstone::BarFlag>),
+                (const, override));
+    BindingMockServer()
+    {
+        ON_CALL(*this, getLogger())
+            .WillByDefault(testing::ReturnRef(endstone::detail::LoggerFactory::getLogger("Test")));
+    }
+};
+
+// Answers the calls under measurement without going through gmock, so only the crossing itself is timed
+class BindingBenchmarkServer : public testing::NiceMock<BindingMockServer> {
+public:
+    [[nodiscard]] const std::vector<endstone::Player *> &getOnlinePlayers() const override
+    {
+        return players_;
+    }
+
+    [[nodiscard]] endstone::Scheduler &getScheduler() const override
+    {
+        return *scheduler_;
+    }
+
+    [[nodiscard]] bool isPrimaryThread() const override
+    {
+        return true;
+    }
+
+    std::vector<endstone::Player *> players_;
+    endstone::Scheduler *scheduler_ = nullptr;
+};
+
+class BindingMockPlugin : public endstone::Plugin {
+public:
+    MOCK_METHOD(const endstone::PluginDescription &, getDescription, (), (const, override));
+    BindingMockPlugin()
+    {
+        setEnabled(true);
+    }
+};
+
+/**
+ * Imports the endstone_python module built next to the benchmarks into an embedded interpreter, once per process.
+ *
+ * The interpreter is never finalized, the module and every object cast from it stay valid until the process exits.
+ */
+py::module_ *bindings()
+{
+    static py::module_ *module = []() -> py::module_ * {
+        py::initialize_interpreter();
+        try {
+            py::module_::import("sys").attr("path").attr("insert")(0, ENDSTONE_PYTHON_MODULE_DIR);
+            return new py::module_(py::module_::import("endstone_python"));
+        }
+        catch (py::error_already_set &e) {
+            endstone::detail::LoggerFactory::getLogger("Test").error("Unable to import endstone_python: {}", e.what());
+            return nullptr;
+        }
+    }();
+    return module;
+}
+
+/**
+ * Exposes a mocked server, a plugin and a real scheduler to Python, the same way the runtime hands them to plugins.
+ */
+class BindingFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State & /*state*/) override
+    {
+        server_ = std::make_unique<BindingBenchmarkServer>();
+        plugin_ = std::make_unique<testing::NiceMock<BindingMockPlugin>>();
+        ON_CALL(*plugin_, getDescription()).WillByDefault(testing::ReturnRef(description_));
+        scheduler_ = std::make_unique<endstone::detail::EndstoneScheduler>(*server_);
+        server_->scheduler_ = scheduler_.get();
+        if (bindings() != nullptr) {
+            py_server_ = py::cast(static_cast<endstone::Server *>(server_.get()), py::return_value_policy::reference);
+            py_plugin_ = py::cast(static_cast<endstone::Plugin *>(plugin_.get()), py::return_value_policy::reference);
+        }
+    }
+
+    void TearDown(const benchmark::State & /*state*/) override
+    {
+        py_plugin_ = py::object();
+        py_server_ = py::object();
+        scheduler_.reset();
+        plugin_.reset();
+        server_.reset();
+    }
+
+protected:
+    static bool skipWithoutBindings(benchmark::State &state)
+    {
+        if (bindings() == nullptr) {
+            state.SkipWithError("endstone_python could not be imported");
+            return true;
+        }
+        return false;
+    }
+
+    std::unique_ptr<BindingBenchmarkServer> server_;
+    std::unique_ptr<testing::NiceMock<BindingMockPlugin>> plugin_;
+    std::unique_ptr<endstone::detail::EndstoneScheduler> scheduler_;
+    endstone::PluginDescription description_{"benchmark_plugin", "1.0.0"};
+    py::object py_server_;
+    py::object py_plugin_;
+};
+
+}  // namespace
+
+// server.online_players with nobody online, the fixed cost of the getter and of building the list
+BENCHMARK_DEFINE_F(BindingFixture, ServerOnlinePlayers)(benchmark::State &state)
+{
+    if (skipWithoutBindings(state)) {
+        return;
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(py_server_.attr("online_players"));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_REGISTER_F(BindingFixture, ServerOnlinePlayers);
+
+// A Location returned by value, as by player.location, then its coordinates read back
+BENCHMARK_DEFINE_F(BindingFixture, LocationToPython)(benchmark::State &state)
+{
+    if (skipWithoutBindings(state)) {
+        return;
+    }
+    const endstone::Location location{nullptr, 1.0F, 64.0F, -1.0F};
+    for (auto _ : state) {
+        auto py_location = py::cast(location);
+        benchmark::DoNotOptimize(py_location.attr("x"));
+        benchmark::DoNotOptimize(py_location.attr("y"));
+        benchmark::DoNotOptimize(py_location.attr("z"));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_REGISTER_F(BindingFixture, LocationToPython);
+
+// range(0) locations converted to a list of wrappers, the per-element cost a bulk accessor would avoid
+BENCHMARK_DEFINE_F(BindingFixture, LocationListToPython)(benchmark::State &state)
+{
+    if (skipWithoutBindings(state)) {
+        return;
+    }
+    const std::vector<endstone::Location> locations(state.range(0), endstone::Location{nullptr, 1.0F, 64.0F, -1.0F});
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(py::cast(locations));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_REGISTER_F(BindingFixture, LocationListToPython)->Arg(1)->Arg(100)->Arg(1000);
+
+// scheduler.run_task(plugin, task) called with a Python callable
+BENCHMARK_DEFINE_F(BindingFixture, SchedulerRunTask)(benchmark::State &state)
+{
+    if (skipWithoutBindings(state)) {
+        return;
+    }
+    auto run_task = py_server_.attr("scheduler").attr("run_task");
+    auto task = py::eval("lambda: None");
+    std::int64_t scheduled = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(run_task(py_plugin_, task));
+        if (++scheduled % 4096 == 0) {
+            state.PauseTiming();
+            scheduler_->cancelTasks(*plugin_);
+            scheduler_->mainThreadHeartbeat(scheduled);
+            state.ResumeTiming();
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_REGISTER_F(BindingFixture, SchedulerRunTask);
+
+// A Python task run by the scheduler, called back from C++ through std::function
+BENCHMARK_DEFINE_F(BindingFixture, RunPythonTask)(benchmark::State &state)
+{
+    if (skipWithoutBindings(state)) {
+        return;
+    }
+    auto task = py::eval("lambda: None").cast<std::function<void()>>();
+    for (auto _ : state) {
+        task();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_REGISTER_F(BindingFixture, RunPythonTask);
+
+// Reads and writes of event properties, as done by a Python event handler
+BENCHMARK_DEFINE_F(BindingFixture, EventProperties)(benchmark::State &state)
+{
+    if (skipWithoutBindings(state)) {
+        return;
+    }
+    endstone::BroadcastMessageEvent event{false, "Hello, world!", {}};
+    auto py_event = py::cast(&event, py::return_value_policy::reference);
+    const py::str message{"Hello, Python!"};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(py_event.attr("message"));
+        benchmark::DoNotOptimize(py_event.attr("cancelled"));
+        py_event.attr("message") = message;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_REGISTER_F(BindingFixture, EventProperties);
@@ -0,0 +1,249 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <gmock/gmock.h>
+
+#include "endstone/boss/boss_bar.h"
+#include "endstone/detail/logger_factory.h"
+#include "endstone/detail/scheduler/scheduler.h"
+
+namespace {
+
+// Counts the bytes allocated while enabled, to estimate the footprint of the scheduled tasks
+std::atomic<bool> count_allocations{false};
+std::atomic<std::size_t> allocated_bytes{0};
+
+class SchedulerBenchmarkServer : public endstone::Server {
+public:
+    MOCK_METHOD(std::string, getName, (), (const, override));
+    MOCK_METHOD(std::string, getVersion, (), (const, override));
+    MOCK_METHOD(std::string, getMinecraftVersion, (), (const, override));
+    MOCK_METHOD(endstone::Logger &, getLogger, (), (const, override));
+    MOCK_METHOD(endstone::PluginManager &, getPluginManager, (), (const, override));
+    MOCK_METHOD(endstone::PluginCommand *, getPluginCommand, (std::string), (const, override));
+    MOCK_METHOD(endstone::ConsoleCommandSender &, getCommandSender, (), (const, override));
+    MOCK_METHOD(bool, dispatchCommand, (endstone::CommandSender &, std::string), (const, override));
+    MOCK_METHOD(endstone::Scheduler &, getScheduler, (), (const, override));
+    MOCK_METHOD(endstone::Level *, getLevel, (), (const, override));
+    MOCK_METHOD(int, getBlockTypeId, (std::string_view type), (const, override));
+    MOCK_METHOD(const std::vector<endstone::Player *> &, getOnlinePlayers, (), (const, override));
+    MOCK_METHOD(int, getMaxPlayers, (), (const, override));
+    MOCK_METHOD(void, setMaxPlayers, (int), (override));
+    MOCK_METHOD(endstone::Player *, getPlayer, (endstone::UUID), (const, override));
+    MOCK_METHOD(endstone::Player *, getPlayer, (std::string), (const, override));
+    MOCK_METHOD(void, shutdown, (), (override));
+    MOCK_METHOD(void, reload, (), (override));
+    MOCK_METHOD(void, reloadData, (), (override));
+    MOCK_METHOD(void, broadcast, (const std::string &, const std::string &), (const, override));
+    MOCK_METHOD(void, broadcastMessage, (const std::string &), (const, override));
+    MOCK_METHOD(void, broadcastPacket, (endstone::Packet &, const std::vector<endstone::Player *> &),
+                (const, override));
+    MOCK_METHOD(void, broadcastPacket, (endstone::Packet &, const std::function<bool(const endstone::Player &)> &),
+                (const, override));
+    MOCK_METHOD(bool, isPrimaryThread, (), (const, override));
+    MOCK_METHOD(endstone::Scoreboard *, getScoreboard, (), (const, override));
+    MOCK_METHOD(std::shared_ptr<endstone::Scoreboard>, getNewScoreboard, (), (override));
+    MOCK_METHOD(float, getCurrentMillisecondsPerTick, (), (override));
+    MOCK_METHOD(float, getAverageMillisecondsPerTick, (), (override));
+    MOCK_METHOD(float, getCurrentTicksPerSecond, (), (override));
+    MOCK_METHOD(float, getAverageTicksPerSecond, (), (override));
+    MOCK_METHOD(float, getCurrentTickUsage, (), (override));
+    MOCK_METHOD(float, getAverageTickUsage, (), (override));
+    MOCK_METHOD(endstone::TickStatistics, getTickStatistics, (endstone::TickWindow), (const, override));
+    MOCK_METHOD(std::uint64_t, getWallClockTick, (), (const, override));
+    MOCK_METHOD(std::chrono::system_clock::time_point, getStartTime, (), (override));
+    MOCK_METHOD(void, setTickConsistentActorReads, (bool), (override));
+    MOCK_METHOD(bool, isTickConsistentActorReads, (), (const, override));
+    MOCK_METHOD(void, setPlayerMoveThresholds, (float, float), (override));
+    MOCK_METHOD(float, getPlayerMoveDistanceThreshold, (), (const, override));
+    MOCK_METHOD(float, getPlayerMoveRotationThreshold, (), (const, override));
+    MOCK_METHOD(endstone::PlayerDataStore &, getPlayerDataStore, (), (const, override));
+    MOCK_METHOD(endstone::Messenger &, getMessenger, (), (const, override));
+    MOCK_METHOD(endstone::PacketInterceptor &, getPacketInterceptor, (), (const, override));
+    MOCK_METHOD(endstone::PacketPriority, getPacketPriority, (int), (const, override));
+    MOCK_METHOD(void, setPacketPriority, (int, endstone::PacketPriority), (override));
+    MOCK_METHOD(endstone::Player *, getPlayerByXuid, (const std::string &), (const, override));
+    MOCK_METHOD(endstone::Player *, getPlayerByRuntimeId, (std::uint64_t), (const, override));
+    MOCK_METHOD(std::vector<endstone::Player *>, getMovementAnomalies, (float, float), (const, override));
+    MOCK_METHOD(std::string, translate, (const endstone::Translatable &, const std::string &), (const, override));
+    MOCK_METHOD(void, sendTranslated, (const endstone::Translatable &, const std::vector<endstone::Player *> &),
+                (const, override));
+    MOCK_METHOD(std::unique_ptr<endstone::BossBar>, createBossBar,
+                (std::string, endstone::BarColor, endstone::BarStyle), (const, override));
+    MOCK_METHOD(std::unique_ptr<endstone::BossBar>, createBossBar,
+                (std::string, endstone::BarColor, endstone::BarStyle, std::vector<endstone::BarFlag>),
+                (const, override));
+    SchedulerBenchmarkServer()
+    {
+        ON_CALL(*this, getLogger())
+            .WillByDefault(testing::ReturnRef(endstone::detail::LoggerFactory::getLogger("Test")));
+    }
+};
+
+class SchedulerBenchmarkPlugin : public endstone::Plugin {
+public:
+    MOCK_METHOD(const endstone::PluginDescription &, getDescription, (), (const, override));
+    SchedulerBenchmarkPlugin()
+    {
+        setEnabled(true);
+    }
+};
+
+/**
+ * Schedules range(0) no-op tasks, half of them delayed by up to a minute and half repeating every 1 to 100 ticks,
+ * then cancels every other one.
+ */
+class SchedulerFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State &state) override
+    {
+        server_ = std::make_unique<testing::NiceMock<SchedulerBenchmarkServer>>();
+        plugin_ = std::make_unique<testing::NiceMock<SchedulerBenchmarkPlugin>>();
+        scheduler_ = std::make_unique<endstone::detail::EndstoneScheduler>(*server_);
+        scheduler_->setTickBudget(std::chrono::nanoseconds::zero());
+        tick_ = 0;
+
+        const auto count = static_cast<std::size_t>(state.range(0));
+        std::mt19937 random(42);
+        allocated_bytes = 0;
+        count_allocations = true;
+        std::vector<std::shared_ptr<endstone::Task>> tasks;
+        tasks.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            auto task = [this]() { benchmark::DoNotOptimize(++runs_); };
+            if (i % 2 == 0) {
+                tasks.push_back(scheduler_->runTaskLater(*plugin_, task, 1 + random() % 1200));
+            }
+            else {
+                tasks.push_back(scheduler_->runTaskTimer(*plugin_, task, 1 + random() % 100, 1 + random() % 100));
+            }
+        }
+        scheduler_->mainThreadHeartbeat(++tick_);
+        count_allocations = false;
+        footprint_ = allocated_bytes.load() - tasks.capacity() * sizeof(std::shared_ptr<endstone::Task>);
+
+        for (std::size_t i = 0; i < count; i += 2) {
+            tasks[i]->cancel();
+        }
+    }
+
+    void TearDown(const benchmark::State & /*state*/) override
+    {
+        scheduler_.reset();
+        plugin_.reset();
+        server_.reset();
+    }
+
+protected:
+    std::unique_ptr<testing::NiceMock<SchedulerBenchmarkServer>> server_;
+    std::unique_ptr<testing::NiceMock<SchedulerBenchmarkPlugin>> plugin_;
+    std::unique_ptr<endstone::detail::EndstoneScheduler> scheduler_;
+    std::uint64_t tick_{0};
+    std::uint64_t runs_{0};
+    std::size_t footprint_{0};
+};
+
+}  // namespace
+
+void *operator new(std::size_t size)
+{
+    if (count_allocations.load(std::memory_order_relaxed)) {
+        allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+    }
+    if (auto *ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t /*size*/) noexcept
+{
+    std::free(ptr);
+}
+
+BENCHMARK_DEFINE_F(SchedulerFixture, Heartbeat)(benchmark::State &state)
+{
+    const auto runs = runs_;
+    for (auto _ : state) {
+        scheduler_->mainThreadHeartbeat(++tick_);
+    }
+    state.counters["tasks_run_per_tick"] =
+        benchmark::Counter(static_cast<double>(runs_ - runs) / static_cast<double>(state.iterations()));
+    state.counters["bytes_per_task"] =
+        benchmark::Counter(static_cast<double>(footprint_) / static_cast<double>(state.range(0)));
+}
+BENCHMARK_REGISTER_F(SchedulerFixture, Heartbeat)->RangeMultiplier(10)->Range(1000, 100000);
+
+BENCHMARK_DEFINE_F(SchedulerFixture, ScheduleAndCancel)(benchmark::State &state)
+{
+    std::uint64_t submitted = 0;
+    for (auto _ : state) {
+        auto task = scheduler_->runTaskLater(*plugin_, []() {}, 600);
+        task->cancel();
+        if (++submitted % 1024 == 0) {
+            scheduler_->mainThreadHeartbeat(++tick_);
+        }
+    }
+}
+BENCHMARK_REGISTER_F(SchedulerFixture, ScheduleAndCancel)->Arg(100000);
+
+// Submits and cancels tasks from every benchmark thread while the first one also ticks the scheduler. Fixtures are
+// shared between benchmark threads, so the scheduler is set up by the first thread before the start barrier instead.
+void BM_ConcurrentSubmission(benchmark::State &state)
+{
+    static std::unique_ptr<testing::NiceMock<SchedulerBenchmarkServer>> server;
+    static std::unique_ptr<testing::NiceMock<SchedulerBenchmarkPlugin>> plugin;
+    static std::unique_ptr<endstone::detail::EndstoneScheduler> scheduler;
+    static std::uint64_t tick = 0;
+    if (state.thread_index() == 0) {
+        server = std::make_unique<testing::NiceMock<SchedulerBenchmarkServer>>();
+        plugin = std::make_unique<testing::NiceMock<SchedulerBenchmarkPlugin>>();
+        scheduler = std::make_unique<endstone::detail::EndstoneScheduler>(*server);
+    }
+
+    std::uint64_t submitted = 0;
+    for (auto _ : state) {
+        auto task = scheduler->runTaskLater(*plugin, []() {}, 1);
+        if (++submitted % 2 == 0) {
+            task->cancel();
+        }
+        if (state.thread_index() == 0 && submitted % 256 == 0) {
+            scheduler->mainThreadHeartbeat(++tick);
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+
+    if (state.thread_index() == 0) {
+        scheduler.reset();
+        plugin.reset();
+        server.reset();
+    }
+}
+BENCHMARK(BM_ConcurrentSubmission)->ThreadRange(1, 8)->UseRealTime();
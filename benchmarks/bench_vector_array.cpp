@@ -0,0 +1,70 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "endstone/util/vector_array.h"
+
+namespace {
+
+std::vector<endstone::Vector<float>> randomPositions(std::size_t count)
+{
+    std::mt19937 rng{42};
+    std::uniform_real_distribution<float> dist{-256.0F, 256.0F};
+    std::vector<endstone::Vector<float>> positions;
+    positions.reserve(count);
+    for (std::size_t i = 0; i < count; i++) {
+        positions.emplace_back(dist(rng), dist(rng), dist(rng));
+    }
+    return positions;
+}
+
+constexpr endstone::Vector<float> Point{10.0F, 64.0F, -30.0F};
+constexpr float Radius = 64.0F;
+
+}  // namespace
+
+void BM_WithinRadiusScalar(benchmark::State &state)
+{
+    auto positions = randomPositions(state.range(0));
+    std::vector<std::uint8_t> mask(positions.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < positions.size(); i++) {
+            mask[i] = positions[i].distanceSquared(Point) <= Radius * Radius;
+        }
+        benchmark::DoNotOptimize(mask.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+// Actors loaded around a few players, and a crowded server
+BENCHMARK(BM_WithinRadiusScalar)->Arg(1000)->Arg(10000);
+
+void BM_WithinRadiusBatch(benchmark::State &state)
+{
+    endstone::VectorArray<float> positions;
+    for (const auto &position : randomPositions(state.range(0))) {
+        positions.push_back(position);
+    }
+    std::vector<std::uint8_t> mask;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(positions.withinRadius(Point, Radius, mask));
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_WithinRadiusBatch)->Arg(1000)->Arg(10000);
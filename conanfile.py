@@ -39,7 +39,7 @@ class EndstoneRecipe(ConanFile):
         "capstone/*:evm": False,
     }
 
-    exports_sources = "CMakeLists.txt", "src/*", "include/*", "tests/*"
+    exports_sources = "CMakeLists.txt", "src/*", "include/*", "tests/*", "benchmarks/*"
 
     def set_version(self):
         if self.version:
@@ -126,6 +126,7 @@ class EndstoneRecipe(ConanFile):
         self.requires("pybind11/2.13.1")
         self.requires("spdlog/1.14.1")
         self.requires("tomlplusplus/3.3.0")
+        self.requires("zlib/[>=1.2.11 <2]")
 
         if self.settings.os == "Linux":
             self.requires("libelf/0.8.13")
@@ -137,6 +138,7 @@ class EndstoneRecipe(ConanFile):
             self.requires("zstr/1.0.7")
 
         self.test_requires("gtest/1.14.0")
+        self.test_requires("benchmark/1.8.4")
 
     def config_options(self):
         if self.settings.os == "Windows":
@@ -188,6 +190,7 @@ class EndstoneRecipe(ConanFile):
             "pybind11::pybind11",
             "spdlog::spdlog",
             "tomlplusplus::tomlplusplus",
+            "zlib::zlib",
         ]
         if self.settings.os == "Linux":
             self.cpp_info.components["core"].system_libs.extend(["dl", "stdc++fs"])
@@ -44,6 +44,18 @@ public:
         }
     }
 
+    const T *tryGet() const noexcept
+    {
+        switch (index_) {
+        case 0:
+            return &storage_.value;
+        case 1:
+            return storage_.ref;
+        default:
+            return nullptr;
+        }
+    }
+
 private:
     union Storage {
         T value;
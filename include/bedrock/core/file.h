@@ -20,7 +20,16 @@ namespace Core {
 class FilePathManager;
 
 template <typename T>
-class PathBuffer;
+class PathBuffer {
+public:
+    [[nodiscard]] const T &getContainer() const
+    {
+        return container_;
+    }
+
+private:
+    T container_;
+};
 
 class StorageAreaStateListener : public std::enable_shared_from_this<StorageAreaStateListener> {
 public:
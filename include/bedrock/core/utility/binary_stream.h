@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include "bedrock/core/math/vec3.h"
 #include "bedrock/core/result.h"
 
 class ReadOnlyBinaryStream {
@@ -21,6 +22,21 @@ public:
     virtual ~ReadOnlyBinaryStream();
     virtual Bedrock::Result<void> read(void *, std::uint64_t);
 
+    [[nodiscard]] std::string_view getView() const
+    {
+        return *buffer_;
+    }
+
+    [[nodiscard]] char *getMutableData()
+    {
+        return buffer_->data();
+    }
+
+    [[nodiscard]] std::size_t getReadPointer() const
+    {
+        return read_pointer_;
+    }
+
 private:
     std::size_t read_pointer_;  // +8
     bool has_overflowed_;       // +16
@@ -30,6 +46,8 @@ private:
 
 class BinaryStream : public ReadOnlyBinaryStream {
 public:
+    void reserve(std::size_t size);
+    [[nodiscard]] char *extend(std::size_t size);
     void write(const void *data, std::size_t size);
     void writeUnsignedChar(std::uint8_t value);
     void writeByte(std::uint8_t value);
@@ -40,6 +58,8 @@ public:
     void writeUnsignedVarInt64(std::uint64_t value);
     void writeString(std::string_view value);
     void writeFloat(float value);
+    void writeFloats(const float *values, std::size_t count);
+    void writeVec3(const Vec3 &value);
 
 private:
     std::string owned_buffer_;  // +64
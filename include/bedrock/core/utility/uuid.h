@@ -26,31 +26,27 @@ public:
     std::int64_t data_0;  // most significant bits
     std::int64_t data_1;  // least significant bits
 
-    static mce::UUID fromEndstone(const endstone::UUID &in)
+    // The octets of endstone::UUID are the two halves in big-endian order, which compilers turn into byte swaps
+    static constexpr mce::UUID fromEndstone(const endstone::UUID &in) noexcept
     {
-        mce::UUID out;
-        auto *ms = reinterpret_cast<uint8_t *>(&out.data_0);
-        auto *ls = reinterpret_cast<uint8_t *>(&out.data_1);
-        std::reverse_copy(in.data + 0, in.data + 4, ms + 4);
-        std::reverse_copy(in.data + 4, in.data + 6, ms + 2);
-        std::reverse_copy(in.data + 6, in.data + 8, ms + 0);
-        std::reverse_copy(in.data + 8, in.data + 10, ls + 6);
-        std::reverse_copy(in.data + 10, in.data + 14, ls + 2);
-        std::reverse_copy(in.data + 14, in.data + 16, ls + 0);
-        return out;
+        std::uint64_t ms = 0;
+        std::uint64_t ls = 0;
+        for (std::size_t i = 0; i < 8; ++i) {
+            ms = (ms << 8) | in.data[i];
+            ls = (ls << 8) | in.data[i + 8];
+        }
+        return {static_cast<std::int64_t>(ms), static_cast<std::int64_t>(ls)};
     }
 
-    [[nodiscard]] endstone::UUID toEndstone() const
+    [[nodiscard]] constexpr endstone::UUID toEndstone() const noexcept
     {
-        auto out = endstone::UUID{};
-        const auto *ms = reinterpret_cast<const uint8_t *>(&data_0);
-        const auto *ls = reinterpret_cast<const uint8_t *>(&data_1);
-        std::reverse_copy(ms + 4, ms + 8, out.data + 0);
-        std::reverse_copy(ms + 2, ms + 4, out.data + 4);
-        std::reverse_copy(ms + 0, ms + 2, out.data + 6);
-        std::reverse_copy(ls + 6, ls + 8, out.data + 8);
-        std::reverse_copy(ls + 2, ls + 6, out.data + 10);
-        std::reverse_copy(ls + 0, ls + 2, out.data + 14);
+        endstone::UUID out{};
+        const auto ms = static_cast<std::uint64_t>(data_0);
+        const auto ls = static_cast<std::uint64_t>(data_1);
+        for (std::size_t i = 0; i < 8; ++i) {
+            out.data[i] = static_cast<std::uint8_t>(ms >> (56 - 8 * i));
+            out.data[i + 8] = static_cast<std::uint8_t>(ls >> (56 - 8 * i));
+        }
         return out;
     }
 };
@@ -16,6 +16,7 @@
 
 #include <map>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace Json {
@@ -36,12 +37,16 @@ class Value {
 
     class CZString {
     public:
+        struct Borrow {};
+
         CZString(const char *cstr);  // NOLINT(*-explicit-constructor)
+        CZString(const char *cstr, Borrow);  // Endstone: refers to cstr without copying it, see release
         CZString(const CZString &other);
         ~CZString();
         bool operator<(const CZString &other) const;
         bool operator==(const CZString &other) const;
         [[nodiscard]] const char *c_str() const;
+        void release();  // Endstone: forgets the string without freeing it
 
     private:
         const char *cstr_;
@@ -61,6 +66,7 @@ public:
     [[nodiscard]] ValueType type() const;
     [[nodiscard]] const char *asCString() const;
     [[nodiscard]] std::string asString() const;
+    [[nodiscard]] std::string_view asStringView() const;  // Endstone
     [[nodiscard]] int asInt() const;
     [[nodiscard]] std::int64_t asInt64() const;
     [[nodiscard]] std::uint64_t asUInt64() const;
@@ -68,6 +74,18 @@ public:
     [[nodiscard]] bool asBool() const;
 
     [[nodiscard]] std::vector<std::string> getMemberNames() const;
+
+    /// Endstone: calls f with the name and value of each member of an object, in order, without copying the names.
+    template <typename F>
+    void forEachMember(F &&f) const
+    {
+        if (type_ != objectValue) {
+            return;
+        }
+        for (const auto &[key, value] : *value_.map_) {
+            f(std::string_view(key.c_str()), value);
+        }
+    }
     [[nodiscard]] std::size_t size() const;
 
     /// Access an array element (zero based index)
@@ -26,7 +26,7 @@ class Packet;
 struct PublicKey;
 class RakNetSocket2;
 class ShadowBanList;
-class RakNetStatistics;
+struct RakNetStatistics;
 class SocketDescriptor;
 class PluginInterface2;
 enum class ConnectionAttemptResult;
@@ -0,0 +1,52 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "bedrock/deps/raknet/raknet_types.h"
+
+namespace RakNet {
+
+enum RNSPerSecondMetrics {
+    USER_MESSAGE_BYTES_PUSHED,
+    USER_MESSAGE_BYTES_SENT,
+    USER_MESSAGE_BYTES_RESENT,
+    USER_MESSAGE_BYTES_RECEIVED_PROCESSED,
+    USER_MESSAGE_BYTES_RECEIVED_IGNORED,
+    ACTUAL_BYTES_SENT,
+    ACTUAL_BYTES_RECEIVED,
+    RNS_PER_SECOND_METRICS_COUNT
+};
+
+// NOLINTBEGIN
+struct RakNetStatistics {
+    std::uint64_t valueOverLastSecond[RNS_PER_SECOND_METRICS_COUNT];
+    std::uint64_t runningTotal[RNS_PER_SECOND_METRICS_COUNT];
+    RakNet::TimeUS connectionStartTime;
+    bool isLimitedByCongestionControl;
+    std::uint64_t BPSLimitByCongestionControl;
+    bool isLimitedByOutgoingBandwidthLimit;
+    std::uint64_t BPSLimitByOutgoingBandwidthLimit;
+    unsigned int messageInSendBuffer[4];  // One per PacketPriority
+    double bytesInSendBuffer[4];
+    unsigned int messagesInResendBuffer;
+    std::uint64_t bytesInResendBuffer;
+    float packetlossLastSecond;
+    float packetlossTotal;
+};
+// NOLINTEND
+
+}  // namespace RakNet
@@ -57,6 +57,11 @@ public:
         return WeakRef{weak_from_this()};
     }
 
+    entt::basic_registry<EntityId> &getRegistry()
+    {
+        return registry_;
+    }
+
 private:
     friend class EntityContext;
 
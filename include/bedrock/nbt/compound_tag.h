@@ -104,6 +104,7 @@ class CompoundTagVariant {
 public:
     [[nodiscard]] const Tag *get() const;
     Tag &emplace(Tag &&tag);
+    Tag *emplace(Tag::Type type);
 
 private:
     Variant tag_storage_;
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <cstdint>
+#include <system_error>
 #include <vector>
 
 #include "bedrock/bedrock.h"
@@ -38,6 +39,11 @@ public:
         }
 
         auto size = result.value();
+        if (size < 0 || static_cast<std::uint64_t>(size) > input.numBytesLeft() / sizeof(std::int32_t)) {
+            return nonstd::make_unexpected(
+                Bedrock::ErrorInfo<std::error_code>{std::make_error_code(std::errc::bad_message)});
+        }
+
         data.clear();
         data.reserve(size);
         for (int i = 0; i < size; ++i) {
@@ -14,11 +14,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <vector>
 
-#include <boost/container_hash/detail/hash_range.hpp>
 #include <fmt/format.h>
 
 #include "bedrock/bedrock.h"
@@ -56,15 +56,23 @@ public:
         }
 
         auto size = result2.value();
+        if (size < 0 || static_cast<std::uint64_t>(size) > input.numBytesLeft()) {
+            return nonstd::make_unexpected(
+                Bedrock::ErrorInfo<std::error_code>{std::make_error_code(std::errc::bad_message)});
+        }
+
         data_.clear();
-        data_.reserve(size);
+        // every element but TAG_End takes at least one byte, the size is bounded by what is left to read
+        data_.reserve(type_ == Type::End ? 0 : size);
         for (int i = 0; i < size; ++i) {
             auto result3 = Tag::newTag(type_);
             if (!result3) {
                 return nonstd::make_unexpected(result3.error());
             }
             auto tag = std::move(result3.value());
-            tag->load(input);
+            if (auto result4 = tag->load(input); !result4) {
+                return nonstd::make_unexpected(result4.error());
+            }
             data_.push_back(std::move(tag));
         }
         return {};
@@ -79,8 +87,13 @@ public:
     }
     [[nodiscard]] bool equals(const Tag &other) const override
     {
-        return Tag::equals(other) && data_ == static_cast<const ListTag &>(other).data_ &&
-               type_ == static_cast<const ListTag &>(other).type_;
+        if (!Tag::equals(other)) {
+            return false;
+        }
+        const auto &other_list = static_cast<const ListTag &>(other);
+        return type_ == other_list.type_ &&
+               std::equal(data_.begin(), data_.end(), other_list.data_.begin(), other_list.data_.end(),
+                          [](const auto &lhs, const auto &rhs) { return lhs->equals(*rhs); });
     }
     [[nodiscard]] std::unique_ptr<Tag> copy() const override
     {
@@ -88,7 +101,12 @@ public:
     }
     [[nodiscard]] std::uint64_t hash() const override
     {
-        return boost::hash_range(data_.begin(), data_.end());
+        // Hash the elements rather than their pointers, equal lists must hash the same
+        std::size_t seed = 0;
+        for (const auto &data : data_) {
+            seed ^= data->hash() + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        }
+        return seed;
     }
     void print(const std::string &string, PrintStream &stream) const override
     {
@@ -110,6 +128,10 @@ public:
     {
         return data_[index].get();
     }
+    [[nodiscard]] Tag::Type getElementType() const
+    {
+        return type_;
+    }
     void add(std::unique_ptr<Tag> tag)
     {
         type_ = tag->getId();
@@ -127,6 +149,6 @@ public:
 
 private:
     std::vector<std::unique_ptr<Tag>> data_;  // +8
-    Tag::Type type_;                          // +32
+    Tag::Type type_ = Tag::Type::End;         // +32
 };
 BEDROCK_STATIC_ASSERT_SIZE(ListTag, 40, 40);
@@ -14,11 +14,31 @@
 
 #pragma once
 
+#include <cstddef>
 #include <string>
+#include <string_view>
 
 #include "bedrock/common/util/data_io.h"
+#include "bedrock/core/utility/binary_stream.h"
 #include "bedrock/nbt/tag.h"
 
 namespace NbtIo {
+enum class Encoding {
+    LittleEndian,  // StringByteOutput, level storage and item user data
+    BigEndian,     // BigEndianStringByteOutput
+    Network,       // varint lengths and integers, as used by packets
+};
+
 void writeNamedTag(const std::string &name, const Tag &tag, class IDataOutput &output);
-}
+
+/**
+ * @brief Returns the exact number of bytes writeNamedTag produces for a tag in the given encoding.
+ */
+std::size_t getNamedTagSize(std::string_view name, const Tag &tag, Encoding encoding);
+
+/**
+ * @brief Appends a named tag to a buffer, growing it once to the exact size and writing the bytes in place.
+ */
+void writeNamedTag(std::string_view name, const Tag &tag, std::string &buffer, Encoding encoding);
+void writeNamedTag(std::string_view name, const Tag &tag, BinaryStream &stream, Encoding encoding = Encoding::Network);
+}  // namespace NbtIo
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <memory>
+
 #include "bedrock/core/result.h"
 #include "bedrock/deps/raknet/packet_priority.h"
 #include "bedrock/forward.h"
@@ -22,6 +24,10 @@
 #include "bedrock/network/network_peer.h"
 #include "bedrock/network/sub_client_id.h"
 
+class IPacketHandlerDispatcher;
+class NetEventCallback;
+class NetworkIdentifier;
+
 class Packet {
 public:
     virtual ~Packet() = default;
@@ -33,6 +39,23 @@ public:
     // [[nodiscard]] virtual bool disallowBatching() const = 0;
     // [[nodiscard]] virtual bool isValid() const = 0;
 
+    Bedrock::Result<void> readNoHeader(ReadOnlyBinaryStream &stream, const SubClientId &sub_id);
+
+    [[nodiscard]] SubClientId getClientSubId() const
+    {
+        return sub_client_id_;
+    }
+
+    void setClientSubId(SubClientId sub_id)
+    {
+        sub_client_id_ = sub_id;
+    }
+
+    void setCompressibility(Compressibility compressibility)  // Endstone
+    {
+        compressibility_ = compressibility;
+    }
+
 private:
     // [[nodiscard]] virtual Bedrock::Result<void> _read(ReadOnlyBinaryStream &) = 0;
 
@@ -41,7 +64,13 @@ private:
     SubClientId sub_client_id_{SubClientId::PrimaryClient};                            // + 16
     bool is_handled_{false};                                                           // + 17
     NetworkPeer::PacketRecvTimepoint recv_timepoint_;                                  // + 24
-    void *handler_{nullptr};                                                           // + 32
+    const IPacketHandlerDispatcher *handler_{nullptr};                                 // + 32
     Compressibility compressibility_{Compressibility::Compressible};                   // + 40
 };
 BEDROCK_STATIC_ASSERT_SIZE(Packet, 48, 48);
+
+class IPacketHandlerDispatcher {
+public:
+    virtual ~IPacketHandlerDispatcher() = default;
+    virtual void handle(const NetworkIdentifier &, NetEventCallback &, std::shared_ptr<Packet> &) const = 0;
+};
@@ -27,7 +27,7 @@ public:
     {
     }
 
-    [[nodiscard]] std::string getCommand() const
+    [[nodiscard]] const std::string &getCommand() const
     {
         return command_;
     }
@@ -253,6 +253,7 @@ public:
     [[nodiscard]] bool getStatusFlag(ActorFlags flags) const;
     [[nodiscard]] bool isType(ActorType type) const;
     [[nodiscard]] bool hasType(ActorType type) const;
+    [[nodiscard]] ActorType getEntityTypeId() const;
     [[nodiscard]] bool isPlayer() const;
     [[nodiscard]] bool isRemoved() const;
     [[nodiscard]] bool isOnGround() const;
@@ -271,6 +272,11 @@ public:
     [[nodiscard]] Actor *getVehicle() const;
     [[nodiscard]] bool isRiding() const;
     [[nodiscard]] bool hasCategory(ActorCategory) const;
+    [[nodiscard]] ActorCategory getCategories() const;  // Endstone
+    [[nodiscard]] ActorInitializationMethod getInitializationMethod() const  // Endstone
+    {
+        return init_method_;
+    }
     [[nodiscard]] bool isJumping() const;
 
     [[nodiscard]] const AttributeInstance &getAttribute(const HashedString &name) const;  // Endstone
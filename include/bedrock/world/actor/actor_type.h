@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <string>
+
 #include <entt/entt.hpp>
 
 enum class ActorType {
@@ -170,3 +172,10 @@ enum class ActorType {
     OminousItemSpawner = 145,
     _entt_enum_as_bitmask
 };
+
+enum class ActorTypeNamespaceRules {
+    ReturnWithoutNamespace = 0,
+    ReturnWithNamespace = 1,
+};
+
+std::string EntityTypeToString(ActorType type, ActorTypeNamespaceRules namespace_rules);  // Endstone
@@ -0,0 +1,40 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "bedrock/forward.h"
+#include "bedrock/world/level/chunk/level_chunk.h"
+#include "bedrock/world/level/chunk_pos.h"
+
+class ChunkSource {
+public:
+    enum class LoadMode : int {
+        None = 0,
+        Deferred = 1,
+    };
+
+    // Only the leading entries of the vtable that Endstone calls into are declared
+    virtual ~ChunkSource() = 0;
+    virtual void shutdown() = 0;
+    virtual bool isShutdownDone() = 0;
+    virtual std::shared_ptr<LevelChunk> getExistingChunk(ChunkPos const &) = 0;
+    virtual std::shared_ptr<LevelChunk> getRandomChunk(Random &) = 0;
+    virtual bool isChunkKnown(ChunkPos const &) = 0;
+    virtual bool isChunkSaved(ChunkPos const &) = 0;
+    virtual std::shared_ptr<LevelChunk> createNewChunk(ChunkPos const &, LoadMode, bool) = 0;
+    virtual std::shared_ptr<LevelChunk> getOrLoadChunk(ChunkPos const &, LoadMode, bool) = 0;
+};
@@ -16,6 +16,8 @@
 
 #include "bedrock/core/spin_lock.h"
 #include "bedrock/core/threading.h"
+#include "bedrock/world/level/block_pos.h"
+#include "bedrock/world/level/chunk/chunk_state.h"
 #include "bedrock/world/level/chunk_pos.h"
 #include "bedrock/world/level/tick.h"
 
@@ -29,6 +31,21 @@ public:
         return last_tick_;
     }
 
+    [[nodiscard]] Dimension &getDimension() const
+    {
+        return *dimension_;
+    }
+
+    [[nodiscard]] const ChunkPos &getPosition() const
+    {
+        return position_;
+    }
+
+    [[nodiscard]] ChunkState getState() const
+    {
+        return load_state_.load();
+    }
+
 private:
     Bedrock::Threading::Mutex block_entity_access_lock_;     // +0
     Level *level_;                                           // +80
@@ -126,6 +126,13 @@ public:
      * @return True if it is dead.
      */
     [[nodiscard]] virtual bool isDead() const = 0;
+
+    /**
+     * @brief Gets the type of this actor.
+     *
+     * @return The namespaced identifier of the actor type, e.g. "minecraft:zombie".
+     */
+    [[nodiscard]] virtual std::string getType() const = 0;
 };
 
 }  // namespace endstone
@@ -0,0 +1,47 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+namespace endstone {
+
+/**
+ * @brief Represents the recent movement of a player, tracked by the server every tick.
+ *
+ * Speeds are in blocks per second and accelerations in blocks per second squared. Teleports and dimension changes
+ * start the history over, so they never show as movement.
+ */
+struct MovementStats {
+    /**
+     * @brief Horizontal speed during the last tick.
+     */
+    float horizontal_speed{0};
+
+    /**
+     * @brief Vertical speed during the last tick, negative when falling.
+     */
+    float vertical_speed{0};
+
+    /**
+     * @brief Highest horizontal speed during the last second.
+     */
+    float peak_horizontal_speed{0};
+
+    /**
+     * @brief Largest change of the horizontal speed from one tick to the next during the last second.
+     */
+    float peak_horizontal_acceleration{0};
+};
+
+}  // namespace endstone
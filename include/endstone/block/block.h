@@ -16,6 +16,7 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 
 #include "endstone/block/block_face.h"
 #include "endstone/level/location.h"
@@ -43,6 +44,22 @@ public:
      */
     [[nodiscard]] virtual std::string getType() const = 0;
 
+    /**
+     * @brief Get the numeric id of the type of the block.
+     *
+     * Comparing ids is cheaper than comparing types, the id of a type is given by Server::getBlockTypeId.
+     *
+     * @return The id of the type of the block.
+     */
+    [[nodiscard]] virtual int getTypeId() const = 0;
+
+    /**
+     * @brief Get the type of the block without copying it.
+     *
+     * @return The type of the block, valid until the server stops.
+     */
+    [[nodiscard]] virtual std::string_view getTypeName() const = 0;
+
     /**
      * @brief Gets the block at the given offsets
      *
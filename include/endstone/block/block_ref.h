@@ -0,0 +1,146 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <string_view>
+
+#include "endstone/block/block.h"
+#include "endstone/block/block_face.h"
+#include "endstone/level/dimension.h"
+
+namespace endstone {
+
+/**
+ * @brief A lightweight reference to the block at a position in a dimension.
+ *
+ * Unlike Block, it is a value that is cheap to copy, and moving to a relative block is only arithmetic. It is meant
+ * for walking many blocks, such as in a flood fill, the type of a block is only read when asked for.
+ */
+class BlockRef {
+public:
+    BlockRef(Dimension &dimension, int x, int y, int z) : dimension_(&dimension), x_(x), y_(y), z_(z) {}
+    explicit BlockRef(const Block &block) : BlockRef(block.getDimension(), block.getX(), block.getY(), block.getZ())
+    {
+    }
+
+    /**
+     * @brief Gets the reference to the block at the given offsets
+     *
+     * @param offset_x X-coordinate offset
+     * @param offset_y Y-coordinate offset
+     * @param offset_z Z-coordinate offset
+     * @return Reference to the block at the given offsets
+     */
+    [[nodiscard]] BlockRef getRelative(int offset_x, int offset_y, int offset_z) const
+    {
+        return {*dimension_, x_ + offset_x, y_ + offset_y, z_ + offset_z};
+    }
+
+    /**
+     * @brief Gets the reference to the block at the given distance of the given face
+     *
+     * @param face Face of this block to return
+     * @param distance Distance to get the block at
+     * @return Reference to the block at the given face
+     */
+    [[nodiscard]] BlockRef getRelative(BlockFace face, int distance = 1) const
+    {
+        switch (face) {
+        case BlockFace::Down:
+            return getRelative(0, -distance, 0);
+        case BlockFace::Up:
+            return getRelative(0, distance, 0);
+        case BlockFace::North:
+            return getRelative(0, 0, -distance);
+        case BlockFace::South:
+            return getRelative(0, 0, distance);
+        case BlockFace::West:
+            return getRelative(-distance, 0, 0);
+        case BlockFace::East:
+            return getRelative(distance, 0, 0);
+        default:
+            return *this;
+        }
+    }
+
+    /**
+     * @brief Get the type of the block, for example, minecraft:acacia_stairs.
+     *
+     * @return The type of the block, or an empty string if the position is outside of the world boundaries.
+     */
+    [[nodiscard]] std::string_view getType() const
+    {
+        return dimension_->getBlockTypeAt(x_, y_, z_);
+    }
+
+    /**
+     * @brief Get the numeric id of the type of the block, as given by Server::getBlockTypeId.
+     *
+     * @return The id of the type of the block, or -1 if the position is outside of the world boundaries.
+     */
+    [[nodiscard]] int getTypeId() const
+    {
+        return dimension_->getBlockTypeIdAt(x_, y_, z_);
+    }
+
+    /**
+     * @brief Gets the Block this refers to
+     *
+     * @return Block at the position
+     */
+    [[nodiscard]] std::unique_ptr<Block> getBlock() const
+    {
+        return dimension_->getBlockAt(x_, y_, z_);
+    }
+
+    [[nodiscard]] Dimension &getDimension() const
+    {
+        return *dimension_;
+    }
+
+    [[nodiscard]] int getX() const
+    {
+        return x_;
+    }
+
+    [[nodiscard]] int getY() const
+    {
+        return y_;
+    }
+
+    [[nodiscard]] int getZ() const
+    {
+        return z_;
+    }
+
+    bool operator==(const BlockRef &other) const
+    {
+        return dimension_ == other.dimension_ && x_ == other.x_ && y_ == other.y_ && z_ == other.z_;
+    }
+
+    bool operator!=(const BlockRef &other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+    Dimension *dimension_;
+    int x_;
+    int y_;
+    int z_;
+};
+
+}  // namespace endstone
@@ -0,0 +1,208 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <functional>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "endstone/command/command_sender.h"
+#include "endstone/command/console_command_sender.h"
+#include "endstone/permissions/permission.h"
+#include "endstone/plugin/plugin.h"
+#include "endstone/scheduler/scheduler.h"
+#include "endstone/server.h"
+
+namespace endstone {
+
+/**
+ * @brief Represents the sender of a command whose executor runs off the server thread.
+ *
+ * Messages are queued to the server thread and delivered to the original sender there, as long as it is still
+ * online. Permission checks are answered from a snapshot taken on the server thread when the command was dispatched.
+ * The original sender must be a player or the console, the only senders that can be found again later.
+ */
+class AsyncCommandSender : public CommandSender {
+public:
+    AsyncCommandSender(const CommandSender &sender, Plugin &plugin)
+        : server_(sender.getServer()), plugin_(plugin), name_(sender.getName()), op_(sender.isOp())
+    {
+        if (auto *player = sender.asPlayer(); player) {
+            player_id_ = player->getUniqueId();
+        }
+        for (auto *info : sender.getEffectivePermissions()) {
+            permissions_.emplace(info->getPermission(), info->getValue());
+        }
+    }
+
+    // CommandSender
+    void sendMessage(const std::string &message) const override
+    {
+        post([message](CommandSender &sender) { sender.sendMessage(message); });
+    }
+
+    void sendMessage(const Translatable &message) const override
+    {
+        post([message](CommandSender &sender) { sender.sendMessage(message); });
+    }
+
+    void sendErrorMessage(const std::string &message) const override
+    {
+        post([message](CommandSender &sender) { sender.sendErrorMessage(message); });
+    }
+
+    void sendErrorMessage(const Translatable &message) const override
+    {
+        post([message](CommandSender &sender) { sender.sendErrorMessage(message); });
+    }
+
+    [[nodiscard]] Server &getServer() const override
+    {
+        return server_;
+    }
+
+    [[nodiscard]] std::string getName() const override
+    {
+        return name_;
+    }
+
+    // Permissible
+    [[nodiscard]] bool isOp() const override
+    {
+        return op_;
+    }
+
+    void setOp(bool value) override
+    {
+        op_ = value;
+        post([value](CommandSender &sender) { sender.setOp(value); });
+    }
+
+    [[nodiscard]] bool isPermissionSet(std::string name) const override
+    {
+        return permissions_.find(toLower(std::move(name))) != permissions_.end();
+    }
+
+    [[nodiscard]] bool isPermissionSet(const Permission &perm) const override
+    {
+        return isPermissionSet(perm.getName());
+    }
+
+    [[nodiscard]] bool hasPermission(std::string name) const override
+    {
+        if (auto it = permissions_.find(toLower(std::move(name))); it != permissions_.end()) {
+            return it->second;
+        }
+        return hasDefault(Permission::DefaultPermission);
+    }
+
+    [[nodiscard]] bool hasPermission(const Permission &perm) const override
+    {
+        if (auto it = permissions_.find(toLower(perm.getName())); it != permissions_.end()) {
+            return it->second;
+        }
+        return hasDefault(perm.getDefault());
+    }
+
+    /**
+     * @brief Attachments cannot be handed out off the server thread, schedule a task to add one instead.
+     *
+     * @return nullptr
+     */
+    PermissionAttachment *addAttachment(Plugin &plugin, const std::string &name, bool value) override
+    {
+        plugin.getLogger().error("Cannot add a permission attachment to {} from an asynchronous command.", name_);
+        return nullptr;
+    }
+
+    /**
+     * @brief Attachments cannot be handed out off the server thread, schedule a task to add one instead.
+     *
+     * @return nullptr
+     */
+    PermissionAttachment *addAttachment(Plugin &plugin) override
+    {
+        plugin.getLogger().error("Cannot add a permission attachment to {} from an asynchronous command.", name_);
+        return nullptr;
+    }
+
+    bool removeAttachment(PermissionAttachment &attachment) override
+    {
+        return false;
+    }
+
+    void recalculatePermissions() override
+    {
+        post([](CommandSender &sender) { sender.recalculatePermissions(); });
+    }
+
+    /**
+     * @brief The effective permissions belong to the server thread, use hasPermission instead.
+     *
+     * @return An empty set
+     */
+    [[nodiscard]] std::unordered_set<PermissionAttachmentInfo *> getEffectivePermissions() const override
+    {
+        return {};
+    }
+
+private:
+    static std::string toLower(std::string name)
+    {
+        std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
+        return name;
+    }
+
+    [[nodiscard]] bool hasDefault(PermissionDefault value) const
+    {
+        switch (value) {
+        case PermissionDefault::True:
+            return true;
+        case PermissionDefault::Operator:
+            return op_;
+        case PermissionDefault::NotOperator:
+            return !op_;
+        default:
+            return false;
+        }
+    }
+
+    void post(std::function<void(CommandSender &)> action) const
+    {
+        server_.getScheduler().runTask(plugin_, [&server = server_, id = player_id_, action = std::move(action)]() {
+            if (!id.has_value()) {
+                action(server.getCommandSender());
+                return;
+            }
+            if (auto *player = server.getPlayer(*id); player) {
+                action(*player);
+            }
+        });
+    }
+
+    Server &server_;
+    Plugin &plugin_;
+    std::string name_;
+    bool op_;
+    std::optional<UUID> player_id_;
+    std::unordered_map<std::string, bool> permissions_;
+};
+
+}  // namespace endstone
@@ -14,6 +14,11 @@
 
 #pragma once
 
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "endstone/command/async_command_sender.h"
 #include "endstone/command/command.h"
 #include "endstone/command/command_executor.h"
 #include "endstone/plugin/plugin.h"
@@ -39,6 +44,10 @@ public:
             return true;
         }
 
+        if (async_) {
+            return executeAsync(sender, args);
+        }
+
         try {
             return getExecutor().onCommand(sender, *this, args);
         }
@@ -73,6 +82,30 @@ public:
         return owner_;
     }
 
+    /**
+     * Sets whether the executor of this command runs on the I/O workers of the scheduler
+     *
+     * An asynchronous executor is given an AsyncCommandSender in place of the real sender, and its return value is
+     * ignored, the command is always reported as successful. Only players and the console can run an asynchronous
+     * command, other senders such as command blocks do not outlive the dispatch and are refused with an error.
+     *
+     * @param async true to run the executor off the server thread
+     */
+    virtual void setAsync(bool async)
+    {
+        async_ = async;
+    }
+
+    /**
+     * Checks whether the executor of this command runs on the I/O workers of the scheduler
+     *
+     * @return true if the executor runs off the server thread
+     */
+    [[nodiscard]] virtual bool isAsync() const
+    {
+        return async_;
+    }
+
     /**
      * Gets the owner of this PluginCommand
      *
@@ -89,7 +122,36 @@ public:
     }
 
 private:
+    bool executeAsync(CommandSender &sender, const std::vector<std::string> &args) const
+    {
+        // The proxy finds the sender again on the server thread, which only players and the console allow
+        if (!sender.asPlayer() && !sender.asConsole()) {
+            sender.sendErrorMessage("Command '{}' can only be run by a player or the console.", getName());
+            return false;
+        }
+
+        // Both are copied on the server thread, the command may be unregistered before the executor runs
+        auto proxy = std::make_shared<AsyncCommandSender>(sender, owner_);
+        auto command = std::make_shared<PluginCommand>(*this);
+        auto task = owner_.getServer().getScheduler().runTaskAsync(
+            owner_,
+            [command, proxy, args]() {
+                try {
+                    command->getExecutor().onCommand(*proxy, *command, args);
+                }
+                catch (std::exception &e) {
+                    command->getPlugin().getLogger().error(
+                        "Unhandled exception executing command '{}' in plugin {}", command->getName(),
+                        command->getPlugin().getDescription().getFullName());
+                    command->getPlugin().getLogger().error(e.what());
+                }
+            },
+            AsyncExecutor::Io);
+        return task != nullptr;
+    }
+
     Plugin &owner_;
     std::shared_ptr<CommandExecutor> executor_;
+    bool async_ = false;
 };
 }  // namespace endstone
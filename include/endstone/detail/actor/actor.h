@@ -14,6 +14,9 @@
 
 #pragma once
 
+#include <cstdint>
+#include <optional>
+
 #include "endstone/actor/actor.h"
 #include "endstone/detail/permissions/permissible_base.h"
 
@@ -46,6 +49,7 @@ public:
     PermissionAttachment *addAttachment(Plugin &plugin) override;
     bool removeAttachment(PermissionAttachment &attachment) override;
     void recalculatePermissions() override;
+    void recalculatePermission(PermissionAttachment &attachment, const std::string &name, bool value) override;
     [[nodiscard]] std::unordered_set<PermissionAttachmentInfo *> getEffectivePermissions() const override;
     [[nodiscard]] bool isOp() const override;
     void setOp(bool value) override;
@@ -64,6 +68,7 @@ public:
     void teleport(Actor &target) override;
     [[nodiscard]] std::int64_t getId() const override;
     [[nodiscard]] bool isDead() const override;
+    [[nodiscard]] std::string getType() const override;
 
     // Internal use only
     [[nodiscard]] ::Actor &getActor() const;
@@ -72,7 +77,24 @@ protected:
     EndstoneServer &server_;
 
 private:
+    /**
+     * @brief State of the actor captured on its first read in a tick, see Server::setTickConsistentActorReads.
+     */
+    struct TickState {
+        std::uint64_t tick;
+        Location location;
+        Vector<float> velocity;
+        bool on_ground;
+        bool in_water;
+    };
+
+    [[nodiscard]] const TickState *getTickState() const;
+    [[nodiscard]] Location readLocation() const;
+    [[nodiscard]] Vector<float> readVelocity() const;
+    [[nodiscard]] Dimension &readDimension() const;
+
     ::Actor &actor_;
+    mutable std::optional<TickState> tick_state_;
     static PermissibleBase &getPermissibleBase();
 };
 
@@ -0,0 +1,129 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "endstone/detail/tick_arena.h"
+#include "endstone/util/vector.h"
+#include "endstone/util/vector_array.h"
+
+namespace endstone::detail {
+
+/**
+ * @brief A set of actor runtime ids, stored as bitsets over pages of consecutive ids.
+ *
+ * Runtime ids are handed out in increasing order, so the actors alive at the same time share a few pages and a lookup
+ * is a hash of the page followed by a bit test.
+ */
+class RuntimeIdSet {
+public:
+    /**
+     * @return true if the id was not in the set
+     */
+    bool insert(std::uint64_t id);
+
+    /**
+     * @return true if the id was in the set
+     */
+    bool erase(std::uint64_t id);
+
+    [[nodiscard]] bool contains(std::uint64_t id) const;
+    [[nodiscard]] std::size_t size() const;
+    [[nodiscard]] bool empty() const;
+    void clear();
+
+private:
+    static constexpr std::size_t PageBits = 4096;
+    static constexpr std::size_t WordBits = 64;
+
+    struct Page {
+        std::array<std::uint64_t, PageBits / WordBits> words{};
+        std::size_t count = 0;
+    };
+
+    std::unordered_map<std::uint64_t, Page> pages_;
+    std::size_t size_ = 0;
+};
+
+/**
+ * @brief Decides which actors a player is shown, from the actors hidden by plugins and an optional cull distance.
+ *
+ * Hiding an actor removes it from the client, which vanilla adds again when the actor comes back into range. Each
+ * update is therefore given the actors around the player and removes the ones that must not be seen again, and adds
+ * back the ones removed before that may be seen now.
+ */
+class ActorVisibility {
+public:
+    /**
+     * @brief Hides an actor.
+     *
+     * @return true if the actor must be removed from the client now
+     */
+    bool hide(std::uint64_t runtime_id);
+
+    /**
+     * @brief Stops hiding an actor.
+     *
+     * @return true if the actor must be added back to the client now
+     */
+    bool show(std::uint64_t runtime_id);
+
+    [[nodiscard]] bool isHidden(std::uint64_t runtime_id) const;
+
+    /**
+     * @brief Forgets an actor removed from the world.
+     */
+    void forget(std::uint64_t runtime_id);
+
+    /**
+     * @brief Forgets what the client was sent, when it has dropped every actor such as on a change of dimension.
+     */
+    void reset();
+
+    void setCullDistance(std::optional<float> distance);
+    [[nodiscard]] std::optional<float> getCullDistance() const;
+
+    /**
+     * @brief Checks whether update has anything to do.
+     */
+    [[nodiscard]] bool isActive() const;
+
+    /**
+     * @brief Works out the actors around the player to remove from, and to add back to, the client.
+     *
+     * @param viewer The position of the player
+     * @param runtime_ids The runtime ids of the actors around the player
+     * @param positions The positions of the same actors
+     * @param remove Receives the indices of the actors to remove
+     * @param add Receives the indices of the actors to add back
+     */
+    void update(const Vector<float> &viewer, const ArenaVector<std::uint64_t> &runtime_ids,
+                const VectorArray<float> &positions, ArenaVector<std::size_t> &remove, ArenaVector<std::size_t> &add);
+
+private:
+    RuntimeIdSet hidden_;
+    RuntimeIdSet culled_;   // Out of the cull distance at the last update
+    RuntimeIdSet removed_;  // Removed from the client by us and not added back
+    std::optional<float> cull_distance_;
+    std::vector<std::uint8_t> mask_;
+};
+
+}  // namespace endstone::detail
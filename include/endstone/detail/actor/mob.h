@@ -40,6 +40,7 @@ public:
     PermissionAttachment *addAttachment(Plugin &plugin) override;
     bool removeAttachment(PermissionAttachment &attachment) override;
     void recalculatePermissions() override;
+    void recalculatePermission(PermissionAttachment &attachment, const std::string &name, bool value) override;
     [[nodiscard]] std::unordered_set<PermissionAttachmentInfo *> getEffectivePermissions() const override;
     [[nodiscard]] bool isOp() const override;
     void setOp(bool value) override;
@@ -58,6 +59,7 @@ public:
     void teleport(Actor& target) override;
     [[nodiscard]] std::int64_t getId() const override;
     [[nodiscard]] bool isDead() const override;
+    [[nodiscard]] std::string getType() const override;
 
     // Mob
     [[nodiscard]] bool isGliding() const override;
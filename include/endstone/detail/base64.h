@@ -16,6 +16,8 @@
 
 #include <libbase64.h>
 
+#include <algorithm>
+#include <optional>
 #include <string>
 #include <string_view>
 
@@ -23,20 +25,82 @@
 
 namespace endstone::detail {
 
+// libbase64 picks the fastest codec the CPU supports (AVX2, AVX, SSE4, NEON...) at runtime when flags are 0
+
+/**
+ * @brief Returns the exact length of the base64 encoding of size bytes, padding included.
+ */
+constexpr std::size_t base64_encoded_size(std::size_t size)
+{
+    return (size + 2) / 3 * 4;
+}
+
+/**
+ * @brief Returns the number of bytes encoded by a padded base64 string, or std::nullopt if it is malformed.
+ */
+inline std::optional<std::size_t> base64_decoded_size(std::string_view data)
+{
+    if ((data.size() & 3) != 0) {
+        // Invalid base64 encoded data - Size not divisible by 4
+        return std::nullopt;
+    }
+    if (data.empty()) {
+        return 0;
+    }
+
+    const std::size_t num_padding = std::count(data.rbegin(), data.rbegin() + 4, '=');
+    if (num_padding > 2) {
+        // Invalid base64 encoded data - Found more than 2 padding signs
+        return std::nullopt;
+    }
+    return (data.size() * 3 >> 2) - num_padding;
+}
+
+/**
+ * @brief Encodes into a caller provided buffer of at least base64_encoded_size(data.size()) bytes.
+ *
+ * @return the number of characters written
+ */
+inline std::size_t base64_encode(std::string_view data, char *out)
+{
+    std::size_t encoded_size = 0;
+    if (!data.empty()) {
+        ::base64_encode(data.data(), data.size(), out, &encoded_size, 0);
+    }
+    return encoded_size;
+}
+
+/**
+ * @brief Decodes into a caller provided buffer, without allocating.
+ *
+ * @return the number of bytes written, or std::nullopt if the input is malformed or does not fit in capacity bytes
+ */
+inline std::optional<std::size_t> base64_decode(std::string_view data, char *out, std::size_t capacity)
+{
+    auto size = base64_decoded_size(data);
+    if (!size || *size > capacity) {
+        return std::nullopt;
+    }
+    if (*size == 0) {
+        return 0;
+    }
+
+    std::size_t decoded_size = 0;
+    if (::base64_decode(data.data(), data.size(), out, &decoded_size, 0) != 1) {
+        return std::nullopt;
+    }
+    return decoded_size;
+}
+
 template <class OutputBuffer, class InputIterator>
 inline OutputBuffer base64_encode(InputIterator begin, InputIterator end)
 {
-    static OutputBuffer empty_buffer;
     if (begin == end) {
-        return empty_buffer;
+        return {};
     }
-    const std::size_t size = end - begin;
-    const std::size_t buffer_size = (size / 3 + (size % 3 > 0)) << 2;
-    OutputBuffer encoded(buffer_size, '=');
-    const char *bytes = reinterpret_cast<const char *>(&*begin);
-    char *out = reinterpret_cast<char *>(&encoded[0]);
-    std::size_t encoded_size;
-    ::base64_encode(bytes, size, out, &encoded_size, 0);
+    const std::string_view data(reinterpret_cast<const char *>(&*begin), end - begin);
+    OutputBuffer encoded(base64_encoded_size(data.size()), '=');
+    base64_encode(data, reinterpret_cast<char *>(&encoded[0]));
     return encoded;
 }
 
@@ -58,31 +122,19 @@ inline std::optional<OutputBuffer> base64_decode(std::string_view data)
     static_assert(std::is_same_v<output_value_type, char> || std::is_same_v<output_value_type, signed char> ||
                   std::is_same_v<output_value_type, unsigned char> || std::is_same_v<output_value_type, std::byte>);
 
-    static OutputBuffer empty_buffer;
-    if (data.empty()) {
-        return empty_buffer;
-    }
-
-    if ((data.size() & 3) != 0) {
-        // Invalid base64 encoded data - Size not divisible by 4
+    auto size = base64_decoded_size(data);
+    if (!size) {
         return std::nullopt;
     }
-
-    const size_t num_padding = std::count(data.rbegin(), data.rbegin() + 4, '=');
-    if (num_padding > 2) {
-        // Invalid base64 encoded data - Found more than 2 padding signs
-        return std::nullopt;
+    if (*size == 0) {
+        return OutputBuffer{};
     }
 
-    const size_t buffer_size = (data.size() * 3 >> 2) - num_padding;
-    OutputBuffer decoded(buffer_size, '.');
-    const auto *bytes = data.data();
-    char *out = reinterpret_cast<char *>(&decoded[0]);
-    std::size_t decoded_size;
-    if (::base64_decode(bytes, data.size(), out, &decoded_size, 0)) {
-        return decoded;
+    OutputBuffer decoded(*size, output_value_type{});
+    if (!base64_decode(data, reinterpret_cast<char *>(&decoded[0]), decoded.size())) {
+        return std::nullopt;
     }
-    return std::nullopt;
+    return decoded;
 }
 
 template <class OutputBuffer, class InputIterator>
@@ -17,12 +17,15 @@
 #include "bedrock/world/level/block_pos.h"
 #include "bedrock/world/level/block_source.h"
 #include "endstone/block/block.h"
+#include "endstone/detail/block/block_type_ids.h"
 
 namespace endstone::detail {
 class EndstoneBlock : public Block {
 public:
     EndstoneBlock(BlockSource &block_source, BlockPos block_pos);
     [[nodiscard]] std::string getType() const override;
+    [[nodiscard]] int getTypeId() const override;
+    [[nodiscard]] std::string_view getTypeName() const override;
     std::unique_ptr<Block> getRelative(int offset_x, int offset_y, int offset_z) override;
     std::unique_ptr<Block> getRelative(BlockFace face) override;
     std::unique_ptr<Block> getRelative(BlockFace face, int distance) override;
@@ -34,8 +37,25 @@ public:
 
     static std::unique_ptr<EndstoneBlock> at(BlockSource &block_source, BlockPos block_pos);
 
+    /**
+     * @brief Creates a view of a block for the handlers of one event, to be kept on the stack.
+     *
+     * The block is read from the block source on first use and kept, later reads by other handlers skip the lookup
+     * and see the block the event is about, even if a handler changed the world since.
+     */
+    static EndstoneBlock view(BlockSource &block_source, BlockPos block_pos);
+
+    /**
+     * @brief Gets the ids of the block types, numbered from the block type registry on first use.
+     */
+    static BlockTypeIds &getTypeIds();
+
 private:
+    [[nodiscard]] const ::Block &getBlock() const;
+
     BlockSource &block_source_;
     BlockPos block_pos_;
+    bool is_view_ = false;
+    mutable const ::Block *block_ = nullptr;  // Only kept by views
 };
 }  // namespace endstone::detail
@@ -0,0 +1,51 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+class BlockLegacy;
+
+namespace endstone::detail {
+
+/**
+ * @brief Numbers the block types in the order they are added, so that types can be compared as integers.
+ *
+ * Only used on the server thread.
+ */
+class BlockTypeIds {
+public:
+    static constexpr int Unknown = -1;
+
+    /**
+     * @return the id of the block type, which is only assigned the first time it is added
+     */
+    int add(const BlockLegacy *legacy, std::string name);
+    [[nodiscard]] int find(const BlockLegacy *legacy) const;
+    [[nodiscard]] int find(std::string_view name) const;
+    [[nodiscard]] std::string_view getName(int id) const;
+    [[nodiscard]] std::size_t size() const;
+
+private:
+    std::deque<std::string> names_;  // A deque keeps the views in ids_ valid while it grows
+    std::unordered_map<const BlockLegacy *, int> legacy_ids_;
+    std::unordered_map<std::string_view, int> ids_;
+};
+
+}  // namespace endstone::detail
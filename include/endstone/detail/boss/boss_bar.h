@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <unordered_set>
 #include <utility>
@@ -34,6 +35,8 @@ public:
         }
     }
 
+    ~EndstoneBossBar() override;
+
     [[nodiscard]] std::string getTitle() const override;
     void setTitle(std::string title) override;
     [[nodiscard]] BarColor getColor() const override;
@@ -52,9 +55,27 @@ public:
     void removeAll() override;
     [[nodiscard]] std::vector<Player *> getPlayers() const override;
 
+    /**
+     * @brief Sends the changes made since the last flush to the players, at most one packet per kind of change.
+     */
+    void flush();
+
+    /**
+     * @brief Progress changes smaller than this are held back until they add up, or the bar becomes empty or full.
+     *
+     * The boss bar is 182 pixels wide on the client, so smaller steps do not change what is drawn.
+     */
+    static constexpr float ProgressThreshold = 1.0F / 182.0F;
+
 private:
+    static constexpr std::uint8_t DirtyName = 1U << 0U;
+    static constexpr std::uint8_t DirtyStyle = 1U << 1U;
+    static constexpr std::uint8_t DirtyProperties = 1U << 2U;
+    static constexpr std::uint8_t DirtyPercent = 1U << 3U;
+
     void send(BossEventUpdateType event_type, Player &player);
     void broadcast(BossEventUpdateType event_type);
+    void markDirty(std::uint8_t fields);
 
     std::string title_;
     float progress_{1.0F};
@@ -63,6 +84,8 @@ private:
     std::bitset<static_cast<int>(BarFlag::Count)> flags_;
     bool visible_{true};
     mutable std::unordered_set<UUID> players_;
+    std::uint8_t dirty_{0};
+    float sent_progress_{1.0F};
 };
 
 }  // namespace endstone::detail
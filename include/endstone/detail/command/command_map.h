@@ -14,11 +14,24 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <map>
+#include <memory>
 #include <mutex>
-#include <unordered_map>
+#include <string_view>
+#include <utility>
+#include <vector>
 
+#include "bedrock/network/packet/available_commands_packet.h"
+#include "bedrock/server/commands/command_permission_level.h"
 #include "endstone/command/command.h"
 #include "endstone/command/command_map.h"
+#include "endstone/detail/command/command_rate_limiter.h"
+#include "endstone/detail/command/command_timings.h"
+#include "endstone/permissions/permission_default.h"
+#include "endstone/plugin/plugin.h"
 
 namespace endstone::detail {
 
@@ -30,18 +43,74 @@ public:
     void clearCommands() override;
     [[nodiscard]] Command *getCommand(std::string name) const override;
 
+    /**
+     * @brief Looks up a command by name or alias, ignoring case, without copying the name.
+     */
+    [[nodiscard]] Command *findCommand(std::string_view name) const;
+
+    /**
+     * @brief Gets the commands packet for a sender, shared with all senders that can use the same commands.
+     */
+    AvailableCommandsPacket &getAvailableCommands(const CommandSender &sender, CommandPermissionLevel level);
+
+    /**
+     * @brief Drops the cached commands packets, so the next ones are serialized from the registry again.
+     */
+    void invalidateAvailableCommands();
+
+    /**
+     * @brief Drops the cached commands packets if a soft enum changed since they were serialized.
+     *
+     * The players that already have a commands packet are sent the change by the registry itself, as an
+     * UpdateSoftEnumPacket, so only the packets for the next players need to be serialized again.
+     */
+    void refreshAvailableCommands();
+
+    /**
+     * @brief Gets the execution timings of the commands run on this server.
+     */
+    [[nodiscard]] CommandTimings &getTimings();
+
+    /**
+     * @brief Gets the limiter of the commands run by command blocks, entities and functions.
+     */
+    [[nodiscard]] CommandRateLimiter &getRateLimiter();
+
 private:
     friend class EndstoneServer;
+
+    struct CaseInsensitiveLess {
+        using is_transparent = void;
+        bool operator()(std::string_view lhs, std::string_view rhs) const
+        {
+            return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                                                [](unsigned char a, unsigned char b) {
+                                                    return std::tolower(a) < std::tolower(b);
+                                                });
+        }
+    };
+
     void setDefaultCommands();
     void setMinecraftCommands();
+    void setMinecraftPermissions();
     void setPluginCommands();
+    void addPluginCommands(Plugin &plugin);
+    void removePluginCommands(Plugin &plugin);
 
     void saveCommandRegistryState() const;
     void restoreCommandRegistryState() const;
+    void observeSoftEnums();
 
     EndstoneServer &server_;
     std::recursive_mutex mutex_;
-    std::unordered_map<std::string, std::shared_ptr<Command>> known_commands_;
+    std::map<std::string, std::shared_ptr<Command>, CaseInsensitiveLess> known_commands_;
+    std::map<std::string, std::shared_ptr<Command>, CaseInsensitiveLess> builtin_commands_;
+    std::vector<std::pair<std::string, PermissionDefault>> minecraft_permissions_;
+    std::map<std::pair<CommandPermissionLevel, std::vector<bool>>, std::unique_ptr<AvailableCommandsPacket>>
+        available_commands_;  // Keyed by the level and the known commands the sender has permission for
+    std::atomic<bool> soft_enums_changed_{false};
+    CommandTimings timings_;
+    CommandRateLimiter rate_limiter_;
 };
 
 }  // namespace endstone::detail
@@ -0,0 +1,48 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+
+namespace endstone::detail {
+
+/**
+ * @brief Collects the output of the commands run by the console on the current thread while it is alive, in place of
+ * logging it, so that it can be sent back to a remote console.
+ *
+ * Captures nest, the innermost one receives the output.
+ */
+class CommandOutputCapture {
+public:
+    CommandOutputCapture();
+    ~CommandOutputCapture();
+
+    CommandOutputCapture(const CommandOutputCapture &) = delete;
+    CommandOutputCapture &operator=(const CommandOutputCapture &) = delete;
+
+    /**
+     * Gets the capture of the current thread, or nullptr if there is none.
+     */
+    static CommandOutputCapture *current();
+
+    void append(const std::string &line);
+    [[nodiscard]] const std::string &getOutput() const;
+
+private:
+    CommandOutputCapture *previous_;
+    std::string output_;
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,117 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace endstone::detail {
+
+/**
+ * @brief Limits how many commands each origin, such as a command block, an entity or a function, runs per tick.
+ *
+ * Every origin has a budget per tick, and all limited origins share a budget per tick on top of that. Commands over
+ * budget are either deferred to the next tick or dropped. The limiter is only used from the server thread.
+ */
+class CommandRateLimiter {
+public:
+    enum class Overflow {
+        Defer,
+        Drop,
+    };
+
+    struct Budget {
+        std::uint32_t per_origin;  // commands a single origin may run per tick
+        std::uint32_t per_tick;    // commands all limited origins may run per tick together
+        std::size_t max_deferred;  // commands waiting for the next tick before further ones are dropped
+        Overflow overflow;
+    };
+
+    /**
+     * @brief Identifies an origin, by its position for command blocks and by its entity or name otherwise.
+     */
+    struct Origin {
+        std::uint8_t type;
+        std::uintptr_t object;
+        int x;
+        int y;
+        int z;
+
+        bool operator==(const Origin &other) const
+        {
+            return type == other.type && object == other.object && x == other.x && y == other.y && z == other.z;
+        }
+    };
+
+    struct Violation {
+        std::string origin;
+        std::uint64_t deferred;
+        std::uint64_t dropped;
+    };
+
+    static constexpr Budget DefaultBudget{1024, 8192, 4096, Overflow::Defer};
+    static constexpr std::uint64_t ReportIntervalTicks = 100;
+
+    void setBudget(const Budget &budget);
+    [[nodiscard]] const Budget &getBudget() const;
+
+    /**
+     * @return true if the command may run now, false if the origin or the tick is over its budget
+     */
+    bool tryAcquire(const Origin &origin);
+
+    /**
+     * @brief Handles a command that tryAcquire refused, deferring or dropping it as the budget says.
+     *
+     * @param origin the origin of the command
+     * @param describe gives a readable name for the origin, only called on its first violation since the last report
+     * @param retry runs the command again, it is called at the start of the next tick if the command is deferred
+     * @return true if the command was deferred, false if it was dropped
+     */
+    bool reject(const Origin &origin, const std::function<std::string()> &describe, std::function<void()> retry);
+
+    /**
+     * @brief Resets the budgets for a new tick and runs the commands deferred during the previous one.
+     */
+    void startTick();
+
+    /**
+     * @brief Gets the origins that went over budget since the last call, and forgets them.
+     */
+    std::vector<Violation> takeViolations();
+
+    [[nodiscard]] std::uint64_t getDeferredCount() const;
+    [[nodiscard]] std::uint64_t getDroppedCount() const;
+
+private:
+    struct OriginHash {
+        std::size_t operator()(const Origin &origin) const;
+    };
+
+    Budget budget_ = DefaultBudget;
+    std::uint32_t tick_count_ = 0;
+    std::unordered_map<Origin, std::uint32_t, OriginHash> counts_;
+    std::deque<std::function<void()>> deferred_;
+    std::unordered_map<Origin, Violation, OriginHash> violations_;
+    std::uint64_t deferred_count_ = 0;
+    std::uint64_t dropped_count_ = 0;
+};
+
+}  // namespace endstone::detail
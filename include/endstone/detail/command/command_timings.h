@@ -0,0 +1,84 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include "endstone/command/command.h"
+#include "endstone/detail/latency_histogram.h"
+
+namespace endstone::detail {
+
+/**
+ * Aggregated timings of a command, including the command events dispatched before it runs.
+ */
+struct CommandTiming {
+    std::string name;
+    std::string owner;  // "minecraft" for vanilla commands, "endstone" for built-in ones, or the plugin name
+    bool vanilla;
+    std::uint64_t count;
+    std::chrono::nanoseconds total;
+    std::chrono::nanoseconds max;
+    std::chrono::nanoseconds p99;
+};
+
+/**
+ * Collects the execution timings of commands, keyed by their name so aliases are counted together.
+ *
+ * Recording is off by default. While disabled, the only cost on a command is the relaxed load in isEnabled().
+ */
+class CommandTimings {
+public:
+    /**
+     * @brief Commands running for at least one tick are logged with their sender, whether timings are enabled or not.
+     */
+    static constexpr std::chrono::milliseconds SlowCommandThreshold{50};
+
+    [[nodiscard]] bool isEnabled() const
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    void setEnabled(bool enabled);
+    void record(Command &command, std::chrono::nanoseconds elapsed);
+    [[nodiscard]] std::vector<CommandTiming> getTimings() const;
+    void reset();
+
+private:
+    struct Entry {
+        std::string name;
+        std::string owner;
+        bool vanilla;
+        std::atomic<std::uint64_t> count{0};
+        std::atomic<std::uint64_t> total{0};
+        std::atomic<std::uint64_t> max{0};
+        LatencyHistogram histogram;
+    };
+
+    Entry &getEntry(Command &command);
+
+    std::atomic<bool> enabled_{false};
+    mutable std::shared_mutex mutex_;
+    std::map<std::string, std::unique_ptr<Entry>> entries_;
+};
+
+}  // namespace endstone::detail
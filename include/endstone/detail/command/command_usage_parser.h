@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -32,10 +33,24 @@ public:
         std::vector<std::string> values{};
     };
 
+    struct Result {
+        bool success{false};
+        std::string command_name{};
+        std::vector<Parameter> parameters{};
+        std::string error_message{};
+    };
+
     explicit CommandUsageParser(std::string_view input) : lexer_(input) {}
 
     bool parse(std::string &command_name, std::vector<Parameter> &parameters, std::string &error_message) noexcept;
 
+    /**
+     * @brief Parses a usage once and returns the same result for every later call with that usage.
+     *
+     * Plugins register the same usages again on every reload, so only new usages are parsed.
+     */
+    static const Result &parseCached(std::string_view usage);
+
 private:
     CommandLexer lexer_;
     std::string_view parseToken(CommandLexer::TokenType type, std::string what);
@@ -38,6 +38,7 @@ public:
     PermissionAttachment *addAttachment(Plugin &plugin) override;
     bool removeAttachment(PermissionAttachment &attachment) override;
     void recalculatePermissions() override;
+    void recalculatePermission(PermissionAttachment &attachment, const std::string &name, bool value) override;
     [[nodiscard]] std::unordered_set<PermissionAttachmentInfo *> getEffectivePermissions() const override;
 };
 
@@ -0,0 +1,42 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <vector>
+
+#include "endstone/detail/command/command_timings.h"
+#include "endstone/detail/command/endstone_command.h"
+#include "endstone/detail/hook_timings.h"
+#include "endstone/detail/join_timings.h"
+#include "endstone/event/event_timing.h"
+#include "endstone/scheduler/task_timing.h"
+
+namespace endstone::detail {
+class TimingsCommand : public EndstoneCommand {
+public:
+    TimingsCommand();
+    bool execute(CommandSender &sender, const std::vector<std::string> &args) const override;
+
+private:
+    void sendReport(CommandSender &sender) const;
+    bool executeMemory(CommandSender &sender, const std::vector<std::string> &args) const;
+    void sendEventReport(CommandSender &sender, std::vector<EventTiming> timings) const;
+    void sendTaskReport(CommandSender &sender, std::vector<TaskTiming> timings) const;
+    void sendHookReport(CommandSender &sender, std::vector<HookTiming> timings) const;
+    void sendCommandReport(CommandSender &sender, std::vector<CommandTiming> timings) const;
+    void sendJoinReport(CommandSender &sender, const std::vector<JoinPhaseTiming> &timings) const;
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,82 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "endstone/detail/console/line_editor.h"
+#include "endstone/detail/spdlog/console_log_sink.h"
+
+namespace endstone::detail {
+
+/**
+ * @brief Reads the lines typed in the console on a background thread, so that neither reading them nor echoing them
+ * waits on the server thread or on the log output.
+ *
+ * When the input is a terminal and a console sink is given, the terminal is switched to non-canonical mode and the
+ * line is edited with a LineEditor, drawn by the sink below the log messages. Otherwise, such as when the server is run
+ * by a process manager, lines are taken as they come. Reading is only implemented on POSIX systems.
+ */
+class ConsoleReader {
+public:
+    using LineCallback = std::function<void(std::string)>;
+
+    /**
+     * @param input The file descriptor to read, owned by the reader from now on
+     * @param on_line Called on the reader thread with each line, without the line ending, released once the input ends
+     * @param sink The sink that draws the line being typed, or nullptr to leave echoing to the terminal
+     */
+    ConsoleReader(int input, LineCallback on_line, ConsoleLogSink *sink = nullptr);
+    ~ConsoleReader();
+
+    ConsoleReader(const ConsoleReader &) = delete;
+    ConsoleReader &operator=(const ConsoleReader &) = delete;
+
+    /**
+     * @brief Takes over the standard input of the process and feeds the server the lines it reads.
+     *
+     * The standard input is replaced with a pipe the reader writes the completed lines to, so the server keeps reading
+     * its commands from there as before. The pipe is closed when the console input ends or the reader is destroyed.
+     *
+     * @return nullptr on Windows, where the console is left to the server, or if the standard input cannot be replaced
+     */
+    static std::unique_ptr<ConsoleReader> forStandardInput(ConsoleLogSink *sink);
+
+    [[nodiscard]] bool isInteractive() const;
+
+private:
+    void run();
+    void handle(const char *data, std::size_t size);
+    [[nodiscard]] std::string renderInputLine() const;
+
+    int input_;
+    LineCallback on_line_;
+    ConsoleLogSink *sink_;
+    bool interactive_ = false;
+    mutable std::mutex mutex_;
+    LineEditor editor_;
+    std::string pending_;
+    struct TerminalMode;
+    std::unique_ptr<TerminalMode> terminal_mode_;
+    std::atomic<bool> stopping_{false};
+    std::thread reader_;
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,79 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <optional>
+#include <string>
+
+namespace endstone::detail {
+
+/**
+ * @brief Edits the line being typed in a terminal from the bytes it sends in non-canonical mode.
+ *
+ * Supports moving the cursor with the arrow keys, Home and End, deleting with Backspace and Delete, the readline
+ * shortcuts Ctrl+A, Ctrl+E, Ctrl+B, Ctrl+F, Ctrl+K, Ctrl+U and Ctrl+W, and recalling earlier lines with the up and
+ * down arrows. UTF-8 sequences are kept whole.
+ */
+class LineEditor {
+public:
+    static constexpr std::size_t MaxHistorySize = 100;
+
+    explicit LineEditor(std::string prompt = "> ");
+
+    /**
+     * Handles one byte sent by the terminal.
+     *
+     * @return The line when Enter completes one that is not empty
+     */
+    std::optional<std::string> feed(char c);
+
+    /**
+     * Gets the prompt and the line, followed by the escape sequence that puts the cursor back in place.
+     *
+     * The caller is expected to return to the start of the terminal line and clear it first.
+     */
+    [[nodiscard]] std::string render() const;
+    [[nodiscard]] const std::string &getPrompt() const;
+    [[nodiscard]] const std::string &getLine() const;
+    [[nodiscard]] std::size_t getCursor() const;
+
+private:
+    enum class State {
+        Normal,
+        Escape,
+        ControlSequence,
+    };
+
+    std::optional<std::string> accept();
+    void handleControlSequence(char final);
+    void insert(char c);
+    void erase(std::size_t begin, std::size_t end);
+    void recall(std::size_t position);
+    [[nodiscard]] std::size_t previous(std::size_t position) const;
+    [[nodiscard]] std::size_t next(std::size_t position) const;
+
+    std::string prompt_;
+    std::string line_;
+    std::size_t cursor_ = 0;
+    State state_ = State::Normal;
+    std::string parameters_;
+    std::deque<std::string> history_;
+    std::size_t history_position_ = 0;
+    std::string draft_;
+};
+
+}  // namespace endstone::detail
@@ -14,10 +14,13 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include <nlohmann/json.hpp>
 
 #include "bedrock/nbt/compound_tag.h"
 
 namespace ImGui {
 void Json(const nlohmann::json &json);
+void Json(const nlohmann::json &json, std::size_t page_size);
 }  // namespace ImGui
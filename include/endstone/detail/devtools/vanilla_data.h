@@ -14,15 +14,25 @@
 
 #pragma once
 
+#include <filesystem>
+#include <functional>
+
 #include <nlohmann/json.hpp>
 
 #include "bedrock/nbt/compound_tag.h"
 
+class Level;
+
 namespace endstone::detail::devtools {
 
 nlohmann::json toJson(const Tag &tag);
 
 struct VanillaData {
+    enum class Format {
+        Json,
+        MessagePack,
+    };
+
     nlohmann::json block_types;
     nlohmann::json block_states;
     nlohmann::json block_tags;
@@ -47,7 +57,28 @@ struct VanillaData {
         nlohmann::json material_reducer;
     } recipes;
 
+    [[nodiscard]] nlohmann::json getRecipes() const;
+
+    /**
+     * Writes every table of the data to gzip compressed files in a directory, the palette and creative items as NBT.
+     *
+     * @param directory the directory to write to, created if it does not exist
+     * @param format the encoding of the JSON tables
+     * @throws std::runtime_error if a file cannot be written
+     */
+    void dump(const std::filesystem::path &directory, Format format) const;
+
+    /**
+     * Returns the data loaded for the DevTools window, or nullptr while it is being collected and converted.
+     */
     static VanillaData *get();
+
+    /**
+     * Copies the vanilla data out of a level, which must be done on the server thread.
+     *
+     * @return a function building the data from the copy, to be called once on any thread
+     */
+    static std::function<VanillaData()> collect(::Level &level);
 };
 
 }  // namespace endstone::detail::devtools
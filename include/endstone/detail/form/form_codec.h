@@ -14,13 +14,24 @@
 
 #pragma once
 
-#include <nlohmann/json.hpp>
+#include <string>
+
+#include "endstone/detail/form/json_writer.h"
 
 namespace endstone::detail {
 
 namespace FormCodec {
 template <typename T>
-nlohmann::json toJson(const T &);
+void write(JsonWriter &writer, const T &);
+
+template <typename T>
+std::string toJson(const T &value)
+{
+    std::string json;
+    JsonWriter writer(json);
+    write(writer, value);
+    return json;
+}
 };
 
 }  // namespace endstone::detail
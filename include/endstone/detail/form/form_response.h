@@ -0,0 +1,54 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+
+#include "bedrock/deps/jsoncpp/value.h"
+#include "endstone/detail/form/json_writer.h"
+
+namespace endstone::detail {
+
+/**
+ * @brief Reads the response to a form straight from the Json::Value sent by the client.
+ *
+ * Values are only decoded when asked for, nothing is converted to another JSON document first.
+ */
+class FormResponse {
+public:
+    explicit FormResponse(const Json::Value &value) : value_(value) {}
+
+    /**
+     * @throws std::runtime_error if the response is not a boolean
+     */
+    [[nodiscard]] bool asBool() const;
+
+    /**
+     * @throws std::runtime_error if the response is not a number
+     */
+    [[nodiscard]] int asInt() const;
+
+    /**
+     * @brief Gets the response as compact JSON text.
+     */
+    [[nodiscard]] std::string dump() const;
+
+private:
+    static void write(JsonWriter &writer, const Json::Value &value);
+
+    const Json::Value &value_;
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,58 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace endstone::detail {
+
+/**
+ * @brief Writes compact JSON straight into a string, without building a document first.
+ *
+ * The writer only inserts separators and escapes strings, it is up to the caller to pair the begin and end calls and to
+ * give every member of an object a key.
+ */
+class JsonWriter {
+public:
+    explicit JsonWriter(std::string &out) : out_(out) {}
+
+    void beginObject();
+    void endObject();
+    void beginArray();
+    void endArray();
+    void key(std::string_view key);
+    void value(std::string_view value);
+    void value(const char *value);
+    void value(bool value);
+    void value(int value);
+    void value(std::int64_t value);
+    void value(std::uint64_t value);
+    void value(float value);
+    void value(double value);
+    void null();
+
+private:
+    void separate();
+    void appendString(std::string_view value);
+    template <typename T>
+    void appendReal(T value);
+
+    std::string &out_;
+    bool need_comma_ = false;
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,75 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace endstone::detail {
+
+/**
+ * @brief Visits the variant of a gameplay event only when one of its handlers takes the alternative it holds.
+ *
+ * Coordinators see every gameplay event of their kind, while Endstone handles a few of them. Which alternatives have
+ * a handler is worked out at compile time into a table indexed by the alternative, so an event without a handler costs
+ * a single lookup and is left to the original coordinator without going through std::visit. No catch-all handler is
+ * needed.
+ */
+template <typename... Handlers>
+class GameplayEventVisitor : private Handlers... {
+public:
+    explicit GameplayEventVisitor(Handlers... handlers) : Handlers(std::move(handlers))... {}
+
+    /**
+     * @brief Whether one of the handlers takes the given alternative.
+     */
+    template <typename Alternative>
+    static constexpr bool Takes = (std::is_invocable_v<const Handlers &, const Alternative &> || ...);
+
+    /**
+     * @brief Calls the handler of the alternative held by the variant if there is one.
+     *
+     * @return true if a handler was called
+     */
+    template <typename... Alternatives>
+    bool operator()(const std::variant<Alternatives...> &variant) const
+    {
+        static constexpr std::array<bool, sizeof...(Alternatives)> Handled = {Takes<Alternatives>...};
+        if (variant.valueless_by_exception() || !Handled[variant.index()]) {
+            return false;
+        }
+        std::visit(
+            [this](const auto &alternative) {
+                if constexpr (Takes<std::decay_t<decltype(alternative)>>) {
+                    handle(alternative);
+                }
+            },
+            variant);
+        return true;
+    }
+
+private:
+    using Handlers::operator()...;
+
+    template <typename Alternative>
+    void handle(const Alternative &alternative) const
+    {
+        (*this)(alternative);
+    }
+};
+
+}  // namespace endstone::detail
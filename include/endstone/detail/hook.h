@@ -14,12 +14,15 @@
 
 #pragma once
 
-#include <functional>
+#include <cstring>
 #include <memory>
-#include <optional>
+#include <string>
 #include <system_error>
+#include <unordered_map>
+#include <utility>
 
 #include "endstone/detail/cast.h"
+#include "endstone/detail/hook_timings.h"
 #include "endstone/endstone.h"
 
 namespace endstone::detail::hook {
@@ -32,126 +35,257 @@ namespace endstone::detail::hook {
 void *get_original(void *detour);
 void *get_original(const std::string &name);
 
+/**
+ * @brief Register a slot to be filled with the original of a detour when hooks are installed.
+ *
+ * If the hooks have already been installed, the slot is filled immediately. The slot is left null when the detour
+ * was not installed.
+ */
+bool register_original(void *detour, void **slot);
+
 const std::unordered_map<std::string, void *> &get_targets();
 const std::unordered_map<std::string, void *> &get_detours();
 
+/**
+ * @brief Get the timing entry of the hooked function with the given detour or symbol name.
+ */
+HookTimings::Entry &get_timings(void *detour);
+HookTimings::Entry &get_timings(const std::string &name);
+
 }  // namespace endstone::detail::hook
 
 namespace endstone::detail::hook {
 /**
- * @brief Construct a std::function from a function pointer
+ * @brief Maps a detour type to the plain function pointer type of its original.
  */
+template <typename Fp>
+struct original_traits;
+
 template <typename Return, typename... Arg>
-std::function<Return(Arg...)> get_original(Return (*fp)(Arg...), std::optional<std::string> name = std::nullopt)
+struct original_traits<Return (*)(Arg...)> {
+    using type = Return (*)(Arg...);
+    using rvo_type = Return *(*)(Return *, Arg...);
+    static constexpr bool rvo_object_first = false;
+};
+
+template <typename Return, typename Class, typename... Arg>
+struct original_traits<Return (Class::*)(Arg...)> {
+    using type = Return (*)(Class *, Arg...);
+#ifdef _WIN32
+    using rvo_type = Return *(*)(Class *, Return *, Arg...);
+    static constexpr bool rvo_object_first = true;
+#elif __linux__
+    using rvo_type = Return *(*)(Return *, Class *, Arg...);
+    static constexpr bool rvo_object_first = false;
+#endif
+};
+
+template <typename Return, typename Class, typename... Arg>
+struct original_traits<Return (Class::*)(Arg...) const> {
+    using type = Return (*)(const Class *, Arg...);
+#ifdef _WIN32
+    using rvo_type = Return *(*)(const Class *, Return *, Arg...);
+    static constexpr bool rvo_object_first = true;
+#elif __linux__
+    using rvo_type = Return *(*)(Return *, const Class *, Arg...);
+    static constexpr bool rvo_object_first = false;
+#endif
+};
+
+/**
+ * @brief Static slot holding the original of the detour Fp.
+ *
+ * Each instantiation registers itself during static initialisation and is filled by install(), so calling through
+ * it costs a single load with no lookup.
+ */
+template <auto Fp>
+class OriginalSlot {
+public:
+    static void *get() noexcept
+    {
+        (void)registered_;
+        return address_;
+    }
+
+    static HookTimings::Entry &getTimings()
+    {
+        static HookTimings::Entry &entry = get_timings(fp_cast(Fp));
+        return entry;
+    }
+
+private:
+    static inline void *address_ = nullptr;
+    static inline const bool registered_ = register_original(fp_cast(Fp), &address_);
+};
+
+/**
+ * @brief Get the original of the detour Fp as a plain function pointer.
+ */
+template <auto Fp>
+typename original_traits<decltype(Fp)>::type get_original()
 {
-    auto *original = name.has_value() ? get_original(name.value()) : get_original(fp_cast(fp));
-    return reinterpret_cast<Return (*)(Arg...)>(original);
+    return reinterpret_cast<typename original_traits<decltype(Fp)>::type>(OriginalSlot<Fp>::get());
 }
 
 /**
- * @brief Construct a std::function from a class method (non-const, no ref-qualifier)
+ * @brief Check whether the detour Fp was installed.
+ *
+ * A detour without a symbol for the running build is skipped by install() and its original stays null. Code that may
+ * run without the detour in place must check this before calling the original.
  */
-template <typename Return, typename Class, typename... Arg>
-std::function<Return(Class *, Arg...)> get_original(Return (Class::*fp)(Arg...),
-                                                    std::optional<std::string> name = std::nullopt)
+template <auto Fp>
+bool is_installed() noexcept
 {
-    auto *original = name.has_value() ? get_original(name.value()) : get_original(fp_cast(fp));
-    auto func = reinterpret_cast<Return (*)(Class *, Arg...)>(original);
-    return [func](Class *obj, Arg... args) -> Return {
-        return func(obj, std::forward<Arg>(args)...);
-    };
+    return OriginalSlot<Fp>::get() != nullptr;
 }
 
 /**
- * @brief Construct a std::function from a class method (const, no ref-qualifier)
+ * @brief Callable for an original that returns its result through a hidden pointer argument.
+ */
+template <typename Func, bool ObjectFirst>
+struct RvoOriginal {
+    template <typename Return, typename... Arg>
+    Return *operator()(Return *ret, Arg &&...args) const
+    {
+        return func(ret, std::forward<Arg>(args)...);
+    }
+
+    Func func;
+};
+
+/**
+ * @brief On Windows, the hidden return pointer of a member function comes after the object pointer.
  */
 template <typename Return, typename Class, typename... Arg>
-std::function<Return(const Class *, Arg...)> get_original(Return (Class::*fp)(Arg...) const,
-                                                          std::optional<std::string> name = std::nullopt)
+struct RvoOriginal<Return *(*)(Class *, Return *, Arg...), true> {
+    template <typename... Args>
+    Return *operator()(Return *ret, Class *obj, Args &&...args) const
+    {
+        return func(obj, ret, std::forward<Args>(args)...);
+    }
+
+    Return *(*func)(Class *, Return *, Arg...);
+};
+
+/**
+ * @brief Get the original of the detour Fp with Return Value Optimization (RVO).
+ */
+template <auto Fp>
+auto get_original_rvo()
 {
-    auto *original = name.has_value() ? get_original(name.value()) : get_original(fp_cast(fp));
-    auto func = reinterpret_cast<Return (*)(const Class *, Arg...)>(original);
-    return [func](const Class *obj, Arg... args) -> Return {
-        return func(obj, std::forward<Arg>(args)...);
-    };
+    using traits = original_traits<decltype(Fp)>;
+    using Func = typename traits::rvo_type;
+    return RvoOriginal<Func, traits::rvo_object_first>{reinterpret_cast<Func>(OriginalSlot<Fp>::get())};
 }
-}  // namespace endstone::detail::hook
-#define ENDSTONE_HOOK_CALL_ORIGINAL(fp, ...)            endstone::detail::hook::get_original(fp)(__VA_ARGS__)
-#define ENDSTONE_HOOK_CALL_ORIGINAL_NAME(fp, name, ...) endstone::detail::hook::get_original(fp, name)(__VA_ARGS__)
 
-namespace endstone::detail::hook {
 /**
- * @brief Construct a std::function from a function pointer
- * with Return Value Optimization (RVO).
+ * @brief Get the original of a detour by its symbol name, cached in a static pointer per call site.
+ *
+ * Tag is the type of a lambda created at the call site, so every site gets its own instantiation and only the first
+ * call converts and looks up the name.
  */
-template <typename Return, typename... Arg>
-std::function<Return *(Return *, Arg...)> get_original_rvo(Return (*fp)(Arg...),
-                                                           std::optional<std::string> name = std::nullopt)
+template <typename Fp, typename Name, typename Tag>
+typename original_traits<Fp>::type get_original(Fp /*fp*/, const Name &name, Tag /*tag*/)
 {
-    auto *original = name.has_value() ? get_original(name.value()) : get_original(fp_cast(fp));
-    return reinterpret_cast<Return *(*)(Return *, Arg...)>(original);
+    using Func = typename original_traits<Fp>::type;
+    static const auto original = reinterpret_cast<Func>(get_original(std::string(name)));
+    return original;
 }
 
 /**
- * @brief Construct a std::function from a class method (non-const, no ref-qualifier)
- * with Return Value Optimization (RVO).
+ * @brief Get the original of a detour by its symbol name with Return Value Optimization (RVO), cached in a static
+ * pointer per call site.
  */
-template <typename Return, typename Class, typename... Arg>
-std::function<Return *(Return *, Class *, Arg...)> get_original_rvo(Return (Class::*fp)(Arg...),
-                                                                    std::optional<std::string> name = std::nullopt)
+template <typename Fp, typename Name, typename Tag>
+auto get_original_rvo(Fp /*fp*/, const Name &name, Tag /*tag*/)
 {
-    auto *original = name.has_value() ? get_original(name.value()) : get_original(fp_cast(fp));
-#ifdef _WIN32
-    auto func = reinterpret_cast<Return *(*)(Class *, Return *, Arg...)>(original);
-    return [func](Return *ret, Class *obj, Arg... args) -> Return * {
-        return func(obj, ret, std::forward<Arg>(args)...);
-    };
-#elif __linux__
-    auto func = reinterpret_cast<Return *(*)(Return *, Class *, Arg...)>(original);
-    return [func](Return *ret, Class *obj, Arg... args) -> Return * {
-        return func(ret, obj, std::forward<Arg>(args)...);
-    };
-#endif
+    using traits = original_traits<Fp>;
+    using Func = typename traits::rvo_type;
+    static const auto original = reinterpret_cast<Func>(get_original(std::string(name)));
+    return RvoOriginal<Func, traits::rvo_object_first>{original};
 }
 
 /**
- * @brief Construct a std::function from a class method (const, no ref-qualifier)
- * with Return Value Optimization (RVO).
+ * @brief Get the timing entry of a hooked function by its symbol name, cached per call site.
  */
-template <typename Return, typename Class, typename... Arg>
-std::function<Return *(Return *, const Class *, Arg...)> get_original_rvo(
-    Return (Class::*fp)(Arg...) const, std::optional<std::string> name = std::nullopt)
+template <typename Name, typename Tag>
+HookTimings::Entry &get_timings(const Name &name, Tag /*tag*/)
 {
-    auto *original = name.has_value() ? get_original(name.value()) : get_original(fp_cast(fp));
-#ifdef _WIN32
-    auto func = reinterpret_cast<Return *(*)(const Class *, Return *, Arg...)>(original);
-    return [func](Return *ret, const Class *obj, Arg... args) -> Return * {
-        return func(obj, ret, std::forward<Arg>(args)...);
-    };
-#elif __linux__
-    auto func = reinterpret_cast<Return *(*)(Return *, const Class *, Arg...)>(original);
-    return [func](Return *ret, const Class *obj, Arg... args) -> Return * {
-        return func(ret, obj, std::forward<Arg>(args)...);
-    };
-#endif
+    static HookTimings::Entry &entry = get_timings(std::string(name));
+    return entry;
+}
+
+/**
+ * @brief Call the original of the detour Fp, timing it when hook timings are enabled.
+ */
+template <auto Fp, typename... Arg>
+decltype(auto) call_original(Arg &&...args)
+{
+    HookTimer timer(HookTimings::isEnabled() ? &OriginalSlot<Fp>::getTimings().original : nullptr);
+    return get_original<Fp>()(std::forward<Arg>(args)...);
+}
+
+template <auto Fp, typename Return, typename... Arg>
+Return *call_original_rvo(Return *ret, Arg &&...args)
+{
+    HookTimer timer(HookTimings::isEnabled() ? &OriginalSlot<Fp>::getTimings().original : nullptr);
+    return get_original_rvo<Fp>()(ret, std::forward<Arg>(args)...);
+}
+
+template <typename Fp, typename Name, typename Tag, typename... Arg>
+decltype(auto) call_original(Fp fp, const Name &name, Tag tag, Arg &&...args)
+{
+    HookTimer timer(HookTimings::isEnabled() ? &get_timings(name, tag).original : nullptr);
+    return get_original(fp, name, tag)(std::forward<Arg>(args)...);
+}
+
+template <typename Fp, typename Name, typename Tag, typename Return, typename... Arg>
+Return *call_original_rvo(Fp fp, const Name &name, Tag tag, Return *ret, Arg &&...args)
+{
+    HookTimer timer(HookTimings::isEnabled() ? &get_timings(name, tag).original : nullptr);
+    return get_original_rvo(fp, name, tag)(ret, std::forward<Arg>(args)...);
+}
+
+template <auto Fp>
+HookTimings::Stats *get_detour_timings()
+{
+    return HookTimings::isEnabled() ? &OriginalSlot<Fp>::getTimings().detour : nullptr;
+}
+
+template <typename Name, typename Tag>
+HookTimings::Stats *get_detour_timings(const Name &name, Tag tag)
+{
+    return HookTimings::isEnabled() ? &get_timings(name, tag).detour : nullptr;
 }
 }  // namespace endstone::detail::hook
 
-#define ENDSTONE_HOOK_CALL_ORIGINAL_RVO(fp, ret, ...) *endstone::detail::hook::get_original_rvo(fp)(&ret, __VA_ARGS__)
+#define ENDSTONE_HOOK_CALL_ORIGINAL(fp, ...) endstone::detail::hook::call_original<fp>(__VA_ARGS__)
+#define ENDSTONE_HOOK_CALL_ORIGINAL_NAME(fp, name, ...) \
+    endstone::detail::hook::call_original(fp, name, [] {}, __VA_ARGS__)
+#define ENDSTONE_HOOK_CALL_ORIGINAL_RVO(fp, ret, ...) *endstone::detail::hook::call_original_rvo<fp>(&ret, __VA_ARGS__)
 #define ENDSTONE_HOOK_CALL_ORIGINAL_RVO_NAME(fp, name, ret, ...) \
-    *endstone::detail::hook::get_original_rvo(fp, name)(&ret, __VA_ARGS__)
+    *endstone::detail::hook::call_original_rvo(fp, name, [] {}, &ret, __VA_ARGS__)
+
+/**
+ * Time the rest of the enclosing detour when hook timings are enabled. Together with the time recorded by the
+ * ENDSTONE_HOOK_CALL_ORIGINAL macros, this splits the cost of a hooked function between Endstone and the original.
+ */
+#define ENDSTONE_HOOK_TIMING(fp) \
+    endstone::detail::HookTimer endstone_hook_timer_(endstone::detail::hook::get_detour_timings<fp>())
+#define ENDSTONE_HOOK_TIMING_NAME(name) \
+    endstone::detail::HookTimer endstone_hook_timer_(endstone::detail::hook::get_detour_timings(name, [] {}))
 
 namespace endstone::detail::hook {
 #ifdef _WIN32
 template <typename Class, typename... Args>
-std::function<Class *(Class *, Args...)> get_ctor(std::unique_ptr<Class> (*)(Args...), const std::string &name)
+Class *(*get_ctor(std::unique_ptr<Class> (*)(Args...), const std::string &name))(Class *, Args...)
 {
     auto *original = get_original(name);
     return reinterpret_cast<Class *(*)(Class *, Args...)>(original);
 }
 #elif __linux__
 template <typename Class, typename... Args>
-std::function<void(Class *, Args...)> get_ctor(std::unique_ptr<Class> (*)(Args...), const std::string &name)
+void (*get_ctor(std::unique_ptr<Class> (*)(Args...), const std::string &name))(Class *, Args...)
 {
     auto *original = get_original(name);
     return reinterpret_cast<void (*)(Class *, Args...)>(original);
@@ -178,7 +312,8 @@ std::function<void(Class *, Args...)> get_ctor(std::unique_ptr<Class> (*)(Args..
             ENDSTONE_FACTORY_PREFIX_REPLACEMENT(type) +                                                 \
             func_decorated_name.substr(func_decorated_name.find(ENDSTONE_FACTORY_PREFIX_TARGET(type)) + \
                                        std::strlen(ENDSTONE_FACTORY_PREFIX_TARGET(type)));              \
+        static const auto ctor = endstone::detail::hook::get_ctor(fp, __name);                          \
         auto *obj = reinterpret_cast<type *>(new char[sizeof(type)]);                                   \
-        endstone::detail::hook::get_ctor(fp, __name)(obj, __VA_ARGS__);                                 \
+        ctor(obj, __VA_ARGS__);                                                                         \
         return std::unique_ptr<type>(obj);                                                              \
     }
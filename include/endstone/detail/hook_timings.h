@@ -0,0 +1,120 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include "endstone/detail/latency_histogram.h"
+
+namespace endstone::detail {
+
+/**
+ * Aggregated timings of a hooked function.
+ */
+struct HookTiming {
+    std::string name;
+    std::uint64_t detour_count;  // zero if the detour is not instrumented, only its calls to the original
+    std::chrono::nanoseconds detour_total;
+    std::chrono::nanoseconds detour_max;
+    std::chrono::nanoseconds detour_p99;
+    std::uint64_t original_count;
+    std::chrono::nanoseconds original_total;
+    std::chrono::nanoseconds original_max;
+    std::chrono::nanoseconds original_p99;
+};
+
+/**
+ * Collects the time spent in hooked functions, split between the detour as a whole and the original it calls.
+ *
+ * Recording is off by default. While disabled, the only cost on a hooked call is the relaxed load in isEnabled().
+ */
+class HookTimings {
+public:
+    class Stats {
+    public:
+        void record(std::chrono::nanoseconds elapsed);
+        void reset();
+
+    private:
+        friend class HookTimings;
+        std::atomic<std::uint64_t> count_{0};
+        std::atomic<std::uint64_t> total_{0};
+        std::atomic<std::uint64_t> max_{0};
+        LatencyHistogram histogram_;
+    };
+
+    struct Entry {
+        std::string name;
+        Stats detour;
+        Stats original;
+    };
+
+    static HookTimings &getInstance();
+
+    [[nodiscard]] static bool isEnabled()
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    static void setEnabled(bool enabled);
+
+    /**
+     * @brief Get the entry of a hooked function, creating it on first use.
+     *
+     * Entries live as long as the process, so call sites can keep a reference to them.
+     */
+    Entry &getEntry(const std::string &name);
+    [[nodiscard]] std::vector<HookTiming> getTimings() const;
+    void reset();
+
+private:
+    static inline std::atomic<bool> enabled_{false};
+    mutable std::shared_mutex mutex_;
+    std::map<std::string, std::unique_ptr<Entry>> entries_;
+};
+
+/**
+ * Records the time until the end of its scope into hook timing stats, if timings were enabled when it was created.
+ */
+class HookTimer {
+public:
+    explicit HookTimer(HookTimings::Stats *stats)
+        : stats_(stats), start_(stats ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{})
+    {
+    }
+
+    ~HookTimer()
+    {
+        if (stats_) {
+            stats_->record(std::chrono::steady_clock::now() - start_);
+        }
+    }
+
+    HookTimer(const HookTimer &) = delete;
+    HookTimer &operator=(const HookTimer &) = delete;
+
+private:
+    HookTimings::Stats *stats_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,60 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace endstone::detail {
+
+/**
+ * Lowers the rate at which the level ticks while no player is online, to save CPU on empty servers.
+ *
+ * Once the server has been empty for a number of ticks, the level only ticks once every interval ticks, and it ticks
+ * again on every tick as soon as a player is online. Ticks are counted as calls to tick, not by the tick of the server,
+ * which may not advance while the level does not tick.
+ */
+class IdleThrottle {
+public:
+    /**
+     * @param interval the level ticks once every interval ticks while idle, 1 or less to never throttle
+     * @param idle_after the ticks the server must be empty for before it becomes idle
+     */
+    IdleThrottle(std::uint32_t interval, std::uint64_t idle_after);
+
+    /**
+     * Called once per tick, before the level ticks.
+     *
+     * @param players the number of players online
+     * @return true if the level ticks on this tick
+     */
+    bool tick(std::size_t players);
+
+    [[nodiscard]] bool isIdle() const;
+
+    /**
+     * @return the number of ticks the level skipped since the server started
+     */
+    [[nodiscard]] std::uint64_t getSkippedTicks() const;
+
+private:
+    std::uint32_t interval_;
+    std::uint64_t idle_after_;
+    std::uint64_t empty_ticks_ = 0;
+    bool idle_ = false;
+    std::uint64_t skipped_ticks_ = 0;
+};
+
+}  // namespace endstone::detail
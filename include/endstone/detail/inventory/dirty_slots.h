@@ -0,0 +1,52 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace endstone::detail {
+
+/**
+ * @brief Tracks the slots of a container that changed, published once per tick.
+ *
+ * Changes are marked as they happen and become visible when the tick ends, so that readers see every change of the
+ * previous tick exactly once, whenever during the current tick they look.
+ */
+class DirtySlots {
+public:
+    void mark(int slot);
+
+    /**
+     * @brief Publishes the slots marked since the last call and starts collecting the next tick.
+     */
+    void advance();
+
+    /**
+     * @return the slots that changed during the last tick, in ascending order
+     */
+    [[nodiscard]] std::vector<int> getChanged() const;
+    [[nodiscard]] bool isChanged(int slot) const;
+
+private:
+    static void set(std::vector<std::uint64_t> &bits, int slot);
+    [[nodiscard]] static bool test(const std::vector<std::uint64_t> &bits, int slot);
+
+    std::vector<std::uint64_t> pending_;
+    std::vector<std::uint64_t> changed_;
+    bool has_pending_ = false;
+};
+
+}  // namespace endstone::detail
@@ -24,8 +24,10 @@ public:
     explicit EndstoneInventory(::Container &container);
     [[nodiscard]] int getSize() const override;
     [[nodiscard]] int getMaxStackSize() const override;
+    [[nodiscard]] ItemStackView getItem(int index) const override;
+    [[nodiscard]] std::vector<ItemStackView> getContents() const override;
 
-private:
+protected:
     ::Container &container_;
 };
 
@@ -27,6 +27,12 @@ public:
     void setType(std::string type) override;
     [[nodiscard]] int getAmount() const override;
     void setAmount(int amount) override;
+    [[nodiscard]] ItemStackView view() const override;
+
+    /**
+     * @brief Gets a view of a BDS item stack, without wrapping or copying it.
+     */
+    static ItemStackView toView(const ::ItemStack &item);
 
 private:
     void reset();
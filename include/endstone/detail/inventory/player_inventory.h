@@ -14,14 +14,20 @@
 
 #pragma once
 
+#include <vector>
+
+#include "bedrock/world/container_content_change_listener.h"
+#include "endstone/detail/inventory/dirty_slots.h"
 #include "endstone/detail/inventory/inventory.h"
 #include "endstone/inventory/player_inventory.h"
 
 namespace endstone::detail {
 
-class EndstonePlayerInventory : public EndstoneInventory, public PlayerInventory {
+class EndstonePlayerInventory : public EndstoneInventory,
+                                public PlayerInventory,
+                                public ContainerContentChangeListener {
 public:
-    using EndstoneInventory::EndstoneInventory;
+    explicit EndstonePlayerInventory(::Container &container);
 
     int getSize() const override
     {
@@ -32,6 +38,34 @@ public:
     {
         return EndstoneInventory::getMaxStackSize();
     }
+
+    ItemStackView getItem(int index) const override
+    {
+        return EndstoneInventory::getItem(index);
+    }
+
+    std::vector<ItemStackView> getContents() const override
+    {
+        return EndstoneInventory::getContents();
+    }
+
+    [[nodiscard]] std::vector<int> getChangedSlots() const override;
+
+    void containerContentChanged(int slot) override;
+
+    /**
+     * @brief Publishes the slots changed during this tick, called once the level has ticked.
+     */
+    void tick();
+
+    /**
+     * @brief Stops observing the container, called while the player is leaving and the container still exists.
+     */
+    void close();
+
+private:
+    DirtySlots dirty_slots_;
+    bool observing_ = false;
 };
 
 }  // namespace endstone::detail
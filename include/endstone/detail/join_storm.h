@@ -0,0 +1,66 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+
+namespace endstone::detail {
+
+/**
+ * Detects a join storm, many players joining within a short window such as after a proxy restart.
+ *
+ * A storm begins once Threshold players joined within the window, and ends once fewer than half of that joined
+ * within the window, so the mode does not flicker around the threshold.
+ */
+class JoinStorm {
+public:
+    JoinStorm(std::size_t threshold, std::uint64_t window_ticks);
+
+    /**
+     * @return true if this join started a storm
+     */
+    bool onJoin(std::uint64_t current_tick);
+
+    /**
+     * @return true if the storm ended on this tick
+     */
+    bool tick(std::uint64_t current_tick);
+
+    [[nodiscard]] bool isActive() const;
+
+    /**
+     * @return the number of players that joined since the current or last storm began
+     */
+    [[nodiscard]] std::size_t getJoinCount() const;
+
+    /**
+     * @return the tick the current or last storm began on
+     */
+    [[nodiscard]] std::uint64_t getStartTick() const;
+
+private:
+    void expire(std::uint64_t current_tick);
+
+    std::size_t threshold_;
+    std::uint64_t window_ticks_;
+    std::deque<std::uint64_t> joins_;  // Ticks of the joins within the window, oldest first
+    bool active_ = false;
+    std::size_t join_count_ = 0;
+    std::uint64_t start_tick_ = 0;
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,105 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "endstone/detail/latency_histogram.h"
+
+namespace endstone::detail {
+
+/**
+ * A phase of the server thread work done for a player between login and spawn, in the order they run.
+ */
+enum class JoinPhase {
+    LoadPlayer,         // loading the saved player data, in trytLoadPlayer or _createNewPlayer
+    ConnectionRequest,  // reading the locale, device and skin from the connection request
+    LoginEvent,         // PlayerLoginEvent handlers
+    JoinEvent,          // PlayerJoinEvent handlers
+    Permissions,        // recalculatePermissions
+    Commands,           // updateCommands
+};
+
+/**
+ * Aggregated timings of a join phase.
+ */
+struct JoinPhaseTiming {
+    JoinPhase phase;
+    std::uint64_t count;
+    std::chrono::nanoseconds total;
+    std::chrono::nanoseconds max;
+    std::chrono::nanoseconds p99;
+};
+
+/**
+ * Collects the time the server thread spends in each phase of a player join.
+ *
+ * Joins are rare compared to ticks, so recording is always on.
+ */
+class JoinTimings {
+public:
+    void record(JoinPhase phase, std::chrono::nanoseconds elapsed);
+
+    /**
+     * @return the timings of the phases recorded at least once, in the order they run
+     */
+    [[nodiscard]] std::vector<JoinPhaseTiming> getTimings() const;
+    void reset();
+
+    static std::string_view getName(JoinPhase phase);
+
+private:
+    static constexpr std::size_t PhaseCount = static_cast<std::size_t>(JoinPhase::Commands) + 1;
+
+    struct Entry {
+        std::uint64_t count = 0;
+        std::uint64_t total = 0;
+        std::uint64_t max = 0;
+        LatencyHistogram histogram;
+    };
+
+    std::array<Entry, PhaseCount> entries_;
+};
+
+/**
+ * Records the time until the end of its scope into a join phase.
+ */
+class JoinTimer {
+public:
+    JoinTimer(JoinTimings &timings, JoinPhase phase)
+        : timings_(timings), phase_(phase), start_(std::chrono::steady_clock::now())
+    {
+    }
+
+    ~JoinTimer()
+    {
+        timings_.record(phase_, std::chrono::steady_clock::now() - start_);
+    }
+
+    JoinTimer(const JoinTimer &) = delete;
+    JoinTimer &operator=(const JoinTimer &) = delete;
+
+private:
+    JoinTimings &timings_;
+    JoinPhase phase_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,48 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace endstone::detail {
+
+/**
+ * Lock-free log-linear histogram of durations, with four buckets per power of two, about 19% wide each.
+ */
+class LatencyHistogram {
+public:
+    void record(std::uint64_t value);
+
+    /**
+     * @param percentile the percentile to compute, between 0 and 1
+     * @param count the number of values recorded
+     * @return the upper bound of the bucket holding the percentile
+     */
+    [[nodiscard]] std::uint64_t getPercentile(double percentile, std::uint64_t count) const;
+
+    void reset();
+
+private:
+    static constexpr std::size_t SubBuckets = 4;
+    static constexpr std::size_t NumBuckets = 64 * SubBuckets;
+    static std::size_t getBucket(std::uint64_t value);
+    static std::uint64_t getUpperBound(std::size_t bucket);
+    std::array<std::atomic<std::uint64_t>, NumBuckets> buckets_{};
+};
+
+}  // namespace endstone::detail
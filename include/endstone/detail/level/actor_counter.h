@@ -0,0 +1,117 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace endstone::detail {
+
+/**
+ * @brief Counts the actors of a dimension by type and category, per chunk and in total, and enforces caps on them.
+ *
+ * Every count is updated incrementally as actors are added and removed, so checking a spawn against the caps costs a
+ * constant number of lookups no matter how many actors the dimension holds.
+ */
+class ActorCounter {
+public:
+    static constexpr int Unlimited = -1;
+
+    /**
+     * @brief The most actors allowed in a single chunk and in the whole dimension, Unlimited for no cap.
+     */
+    struct Limit {
+        int per_chunk = Unlimited;
+        int per_dimension = Unlimited;
+    };
+
+    /**
+     * @brief Caps the actors of a type, e.g. "minecraft:zombie".
+     */
+    void setLimit(const std::string &type, const Limit &limit);
+
+    /**
+     * @brief Caps the actors having all the category bits of the mask.
+     */
+    void setLimit(std::uint32_t categories, const Limit &limit);
+
+    /**
+     * @return false if adding an actor of the type and categories to the chunk would exceed any of the caps
+     */
+    [[nodiscard]] bool canAdd(std::int64_t chunk, const std::string &type, std::uint32_t categories) const;
+
+    /**
+     * @brief Counts an actor, replacing the record of an actor already counted under the same id.
+     *
+     * Ids must stay the same across chunk reloads, so an actor loaded again is counted once in its current chunk.
+     *
+     * @return false if an actor with the same id was already counted
+     */
+    bool add(std::uint64_t id, std::int64_t chunk, const std::string &type, std::uint32_t categories);
+    bool remove(std::uint64_t id);
+
+    [[nodiscard]] std::size_t size() const;
+    [[nodiscard]] int getCount(const std::string &type) const;
+    [[nodiscard]] int getCount(std::int64_t chunk, const std::string &type) const;
+
+    /**
+     * @return the number of actors of each type present in the dimension, sorted by type
+     */
+    [[nodiscard]] std::vector<std::pair<std::string, int>> getCounts() const;
+
+    /**
+     * @return up to the given number of chunks holding the most actors, with their counts, the busiest first
+     */
+    [[nodiscard]] std::vector<std::pair<std::int64_t, int>> getBusiestChunks(std::size_t count) const;
+
+private:
+    struct CategoryLimit {
+        std::uint32_t mask;
+        Limit limit;
+        int count;
+    };
+
+    struct Chunk {
+        std::vector<int> types;       // indexed by type id
+        std::vector<int> categories;  // indexed like category_limits_
+        std::vector<std::uint64_t> actors;
+    };
+
+    struct Record {
+        std::int64_t chunk;
+        std::size_t type;
+        std::uint32_t categories;
+        std::size_t slot;  // position in the actors of the chunk
+    };
+
+    std::size_t intern(const std::string &type);
+    [[nodiscard]] static bool isFull(int count, int limit);
+    static int &at(std::vector<int> &counts, std::size_t index);
+    [[nodiscard]] static int at(const std::vector<int> &counts, std::size_t index);
+
+    std::unordered_map<std::string, std::size_t> type_ids_;
+    std::vector<const std::string *> type_names_;
+    std::vector<Limit> type_limits_;
+    std::vector<int> type_counts_;
+    std::vector<CategoryLimit> category_limits_;
+    std::unordered_map<std::int64_t, Chunk> chunks_;
+    std::unordered_map<std::uint64_t, Record> records_;
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,111 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace endstone::detail {
+
+/**
+ * @brief Plans and paces the generation of every chunk in a square around a center chunk.
+ *
+ * Chunks are visited in rings of growing distance from the center, so an interrupted run leaves a square of generated
+ * chunks behind it. Generation itself happens on the worker threads of the chunk source, this class only decides how
+ * many requests to keep in flight: the window grows by one each tick the server stays under the target tick usage
+ * and halves each tick it goes over.
+ */
+class ChunkPregenerator {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief A chunk to request from the chunk source.
+     */
+    struct Request {
+        std::uint64_t index;
+        int x;
+        int z;
+    };
+
+    ChunkPregenerator(int center_x, int center_z, int radius, float target_usage, std::size_t max_in_flight,
+                      std::uint64_t start = 0);
+
+    /**
+     * @brief Gets the offset from the center of the chunk visited at the given position in the ring order.
+     */
+    static std::pair<int, int> offsetAt(std::uint64_t index);
+
+    /**
+     * @brief Gets the chunks to request this tick, given the tick usage of the last tick.
+     */
+    std::vector<Request> poll(float tick_usage, Clock::time_point now);
+
+    /**
+     * @brief Marks a requested chunk as generated.
+     */
+    void complete(std::uint64_t index);
+
+    [[nodiscard]] int getCenterX() const;
+    [[nodiscard]] int getCenterZ() const;
+    [[nodiscard]] int getRadius() const;
+    [[nodiscard]] float getTargetUsage() const;
+    [[nodiscard]] std::uint64_t getTotal() const;
+    [[nodiscard]] std::uint64_t getCompleted() const;
+    [[nodiscard]] std::size_t getInFlight() const;
+    [[nodiscard]] std::size_t getWindow() const;
+    [[nodiscard]] bool isDone() const;
+
+    /**
+     * @brief Gets the number of chunks generated per second since this run started.
+     */
+    [[nodiscard]] double getRate(Clock::time_point now) const;
+
+    /**
+     * @return the estimated time left, or nullopt until the first chunk of this run has been generated
+     */
+    [[nodiscard]] std::optional<std::chrono::seconds> getEta(Clock::time_point now) const;
+
+    /**
+     * @brief Gets the index below which every chunk has been generated, which is where a resumed run starts.
+     */
+    [[nodiscard]] std::uint64_t getCheckpoint() const;
+
+    [[nodiscard]] std::string serialize() const;
+    static std::optional<ChunkPregenerator> deserialize(std::string_view data, std::size_t max_in_flight);
+
+private:
+    int center_x_;
+    int center_z_;
+    int radius_;
+    float target_usage_;
+    std::size_t max_in_flight_;
+    std::size_t window_;
+    std::uint64_t total_;
+    std::uint64_t next_;
+    std::uint64_t completed_;
+    std::uint64_t completed_this_run_ = 0;
+    std::set<std::uint64_t> in_flight_;
+    std::optional<Clock::time_point> started_at_;
+};
+
+}  // namespace endstone::detail
@@ -14,10 +14,26 @@
 
 #pragma once
 
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "bedrock/world/level/chunk/level_chunk.h"
 #include "bedrock/world/level/dimension/dimension.h"
 #include "endstone/actor/actor.h"
+#include "endstone/detail/level/actor_counter.h"
+#include "endstone/detail/level/chunk_pregenerator.h"
+#include "endstone/detail/level/region_index.h"
 #include "endstone/detail/server.h"
 #include "endstone/level/dimension.h"
+#include "endstone/plugin/plugin.h"
 
 namespace endstone::detail {
 
@@ -30,12 +46,108 @@ public:
     [[nodiscard]] Level &getLevel() const override;
     std::unique_ptr<Block> getBlockAt(int x, int y, int z) override;
     std::unique_ptr<Block> getBlockAt(Location location) override;
+    [[nodiscard]] std::string_view getBlockTypeAt(int x, int y, int z) override;
+    [[nodiscard]] int getBlockTypeIdAt(int x, int y, int z) override;
+    void forEachBlock(int x1, int y1, int z1, int x2, int y2, int z2,
+                      const std::function<bool(Block &)> &callback) override;
+    std::vector<std::unique_ptr<Block>> getBlocks(int x1, int y1, int z1, int x2, int y2, int z2) override;
+    int setBlocks(int x1, int y1, int z1, int x2, int y2, int z2, const std::vector<std::string> &palette,
+                  const std::vector<std::uint16_t> &indices, bool apply_physics) override;
+    RegionSnapshot snapshotRegion(int x1, int y1, int z1, int x2, int y2, int z2) override;
+    std::shared_ptr<AsyncResult<RegionSnapshot>> snapshotRegionAsync(Plugin &plugin, int x1, int y1, int z1, int x2,
+                                                                     int y2, int z2) override;
+    int restoreRegion(const RegionSnapshot &snapshot) override;
+    [[nodiscard]] std::vector<Actor *> getNearbyActors(float x, float y, float z, float radius) const override;
+    [[nodiscard]] std::vector<Actor *> getNearbyActors(float x, float y, float z, float radius,
+                                                       const std::function<bool(Actor &)> &filter) const override;
+    bool addRegion(const std::string &name, int x1, int y1, int z1, int x2, int y2, int z2) override;
+    bool removeRegion(const std::string &name) override;
+    [[nodiscard]] std::vector<std::string> getRegionsAt(float x, float y, float z) const override;
+    [[nodiscard]] std::vector<std::string> getRegions(int x1, int y1, int z1, int x2, int y2, int z2) const override;
+    [[nodiscard]] bool isChunkLoaded(int x, int z) const override;
+    bool addChunkTicket(int x, int z, Plugin &plugin) override;
+    bool removeChunkTicket(int x, int z, Plugin &plugin) override;
+    void removeChunkTickets(Plugin &plugin) override;
+    [[nodiscard]] std::vector<std::pair<int, int>> getChunkTickets(Plugin &plugin) const override;
+    bool startPregeneration(int center_x, int center_z, int radius, float target_usage) override;
+    bool stopPregeneration() override;
+    [[nodiscard]] std::optional<PregenerationProgress> getPregenerationProgress() const override;
+    void setActorLimit(const std::string &type, int per_chunk, int per_dimension) override;
+    void setActorLimit(ActorCategory categories, int per_chunk, int per_dimension) override;
+    [[nodiscard]] int getActorCount(const std::string &type) const override;
+    [[nodiscard]] std::vector<std::pair<std::string, int>> getActorCounts() const override;
+    void spawnParticles(const std::vector<ParticleEffect> &particles, const std::vector<Player *> &viewers,
+                        float radius) override;
 
     [[nodiscard]] ::Dimension &getHandle() const;
+    [[nodiscard]] const RegionIndex &getRegionIndex() const;
+    [[nodiscard]] std::vector<std::pair<std::pair<int, int>, int>> getBusiestChunks(std::size_t count) const;
+    [[nodiscard]] bool canAddActor(::Actor &actor) const;
+    void onActorAdded(::Actor &actor);
+    void onActorRemoved(::Actor &actor);
+    void tickPregeneration(float tick_usage);
+    void onLeaveGame();
 
 private:
+    static constexpr std::size_t MaxPregenerationRequestsPerWorker = 4;
+    static constexpr std::uint64_t PregenerationReportInterval = 600;
+    static constexpr int ParticleCellSize = 16;
+
+    /**
+     * @brief A block to look up, by type name and, optionally, the JSON of its block states.
+     */
+    struct PaletteEntry {
+        std::string name;
+        std::optional<std::string> states;
+    };
+
+    /**
+     * @brief The block states of a region, before they are encoded into a RegionSnapshot.
+     *
+     * Block states are owned by the block type registry and never change, so they can be encoded on any thread.
+     */
+    struct CapturedRegion {
+        int min_x;
+        int min_y;
+        int min_z;
+        int size_x;
+        int size_y;
+        int size_z;
+        std::vector<const ::Block *> states;  // nullptr for blocks that were not captured
+    };
+
+    /**
+     * @brief Keeps a chunk loaded by holding a reference to it for as long as any plugin has a ticket on it.
+     */
+    struct ChunkTicket {
+        std::shared_ptr<LevelChunk> chunk;
+        std::vector<const Plugin *> plugins;
+    };
+
+    static std::vector<const ::Block *> resolvePalette(const std::vector<PaletteEntry> &entries);
+    CapturedRegion captureRegion(int x1, int y1, int z1, int x2, int y2, int z2);
+    static RegionSnapshot encodeRegion(const CapturedRegion &region);
+    int applyBlocks(int min_x, int min_y, int min_z, int size_x, int size_y, int size_z,
+                    const std::vector<const ::Block *> &states, const std::vector<std::uint16_t> &indices, int flags);
+    [[nodiscard]] bool isTicking(const LevelChunk &chunk) const;
+    [[nodiscard]] bool isAccessible(BlockSource &block_source, const BlockPos &pos) const;
+    [[nodiscard]] std::filesystem::path getPregenerationCheckpoint() const;
+    void resumePregeneration();
+    void savePregeneration() const;
+    static std::size_t workerCount();
+    static std::int64_t toChunkKey(int x, int z);
+    static std::pair<int, int> fromChunkKey(std::int64_t key);
+    static std::int64_t toChunkKey(const ::Actor &actor);
+
     ::Dimension &dimension_;
     EndstoneLevel &level_;
+    RegionIndex regions_;
+    ActorCounter actors_;
+    std::unordered_map<std::int64_t, ChunkTicket> chunk_tickets_;
+    std::optional<ChunkPregenerator> pregenerator_;
+    std::vector<std::pair<std::uint64_t, std::shared_ptr<LevelChunk>>> pregeneration_chunks_;
+    bool pregeneration_resumed_ = false;
+    std::uint64_t pregeneration_ticks_ = 0;
 };
 
 }  // namespace endstone::detail
@@ -14,11 +14,17 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
 #include <unordered_map>
 
 #include "bedrock/world/level/dimension/dimension.h"
 #include "bedrock/world/level/level.h"
 #include "endstone/actor/actor.h"
+#include "endstone/detail/level/level_backup.h"
+#include "endstone/detail/level/level_sync.h"
 #include "endstone/detail/server.h"
 #include "endstone/level/dimension.h"
 #include "endstone/level/level.h"
@@ -27,24 +33,43 @@ namespace endstone::detail {
 
 class EndstoneLevel : public endstone::Level {
 public:
+    struct BackupResult {
+        std::string error;  // empty on success
+        LevelBackup::Result files;
+        std::chrono::milliseconds duration;  // from taking the snapshot until it was released
+    };
+
     explicit EndstoneLevel(::Level &level);
     ~EndstoneLevel() override = default;
 
     [[nodiscard]] std::string getName() const override;
     [[nodiscard]] std::vector<Actor *> getActors() const override;
+    void forEachActor(const std::function<bool(Actor &)> &callback) const override;
+    void forEachActor(ActorCategory categories, const std::function<bool(Actor &)> &callback) const override;
     [[nodiscard]] int getTime() const override;
     void setTime(int time) override;
     [[nodiscard]] std::vector<Dimension *> getDimensions() const override;
     [[nodiscard]] Dimension *getDimension(std::string name) const override;
+    [[nodiscard]] Dimension *getDimension(const ::Dimension &handle) const;
+    bool backup(Plugin &plugin, std::string destination, std::function<void(std::string)> callback) override;
+    bool backup(std::filesystem::path destination, std::function<void(const BackupResult &)> callback);
     void addDimension(std::unique_ptr<Dimension> dimension);
+    void tick(std::uint64_t current_tick);
+
+    [[nodiscard]] LevelSync &getSync();
 
     [[nodiscard]] EndstoneServer &getServer() const;
     [[nodiscard]] ::Level &getHandle() const;
+    [[nodiscard]] bool isBackupRunning() const;
 
 private:
     EndstoneServer &server_;
     ::Level &level_;
+    LevelSync sync_{LevelSync::Options::fromEnvironment()};
+    std::atomic<bool> backup_running_{false};
+    std::filesystem::path last_backup_;
     std::unordered_map<std::string, std::unique_ptr<Dimension>> dimensions_;
+    std::unordered_map<const ::Dimension *, Dimension *> dimension_handles_;
 };
 
 }  // namespace endstone::detail
@@ -0,0 +1,68 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace endstone::detail {
+
+/**
+ * Copies the files of a level storage snapshot to another directory.
+ *
+ * While the snapshot is held the storage only appends to its files and never deletes them, so copying each file up to
+ * the length recorded in the snapshot gives a consistent copy of the level even though the server keeps running.
+ *
+ * The table files of the database are never modified once written, so a table that an earlier backup already holds
+ * is hard linked from it instead of being copied again.
+ */
+class LevelBackup {
+public:
+    struct File {
+        std::string name;  // relative to the level directory
+        std::uint64_t size;
+    };
+
+    struct Result {
+        std::size_t copied = 0;
+        std::size_t linked = 0;
+        std::uint64_t bytes_copied = 0;
+    };
+
+    LevelBackup(std::filesystem::path source, std::vector<File> files);
+
+    /**
+     * Copies the files to the destination directory, which must not exist yet.
+     *
+     * @param destination the directory to copy the level to
+     * @param previous an earlier backup to link unchanged tables from, or empty to copy every file
+     * @return the number of files copied and linked
+     * @throws std::runtime_error if the destination exists or a file cannot be copied
+     */
+    Result copyTo(const std::filesystem::path &destination, const std::filesystem::path &previous = {}) const;
+
+    [[nodiscard]] const std::vector<File> &getFiles() const;
+    [[nodiscard]] std::uint64_t getTotalSize() const;
+
+    [[nodiscard]] static bool isImmutable(const std::filesystem::path &name);
+
+private:
+    std::filesystem::path source_;
+    std::vector<File> files_;
+};
+
+}  // namespace endstone::detail
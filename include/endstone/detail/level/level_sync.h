@@ -0,0 +1,79 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+namespace endstone::detail {
+
+/**
+ * Holds back the time and weather changes that would otherwise be sent to every player each tick.
+ *
+ * A time set by a plugin is applied, and so broadcast, at most once per interval unless it jumps by at least the
+ * threshold from the time of the level. A weather change that plugins cancelled is cancelled again without firing the
+ * event if the server retries it within the weather interval.
+ */
+class LevelSync {
+public:
+    enum class Weather {
+        Rain,
+        Lightning,
+    };
+
+    struct Options {
+        std::uint64_t time_interval = 0;  // 0 applies every change at once
+        int time_threshold = 0;
+        std::uint64_t weather_interval = 0;
+
+        /**
+         * Reads the options from ENDSTONE_TIME_SYNC_INTERVAL and ENDSTONE_WEATHER_EVENT_INTERVAL, in ticks, and
+         * ENDSTONE_TIME_SYNC_THRESHOLD. Invalid values are ignored.
+         */
+        static Options fromEnvironment();
+    };
+
+    LevelSync();
+    explicit LevelSync(Options options);
+
+    /**
+     * Records a time set by a plugin.
+     *
+     * @return true if the time should be applied now, otherwise it is held until pollTime returns it
+     */
+    [[nodiscard]] bool requestTime(int time, int current_time, std::uint64_t current_tick);
+
+    /**
+     * @return the held time if the interval has passed since the last time was applied
+     */
+    [[nodiscard]] std::optional<int> pollTime(std::uint64_t current_tick);
+    [[nodiscard]] std::optional<int> getPendingTime() const;
+
+    [[nodiscard]] bool isSuppressed(Weather weather, bool to_state, std::uint64_t current_tick) const;
+    void recordCancelled(Weather weather, bool to_state, std::uint64_t current_tick);
+
+private:
+    struct CancelledChange {
+        bool to_state;
+        std::uint64_t tick;
+    };
+
+    Options options_;
+    std::optional<int> pending_time_;
+    std::optional<std::uint64_t> last_time_sync_;
+    std::optional<CancelledChange> cancelled_[2];
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,106 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace endstone::detail {
+
+/**
+ * @brief Named cuboid regions indexed by a bounding volume hierarchy for fast point and box queries.
+ *
+ * Regions change rarely compared to how often they are queried, so the hierarchy is rebuilt lazily on the first query
+ * after a change rather than kept balanced on every insertion.
+ */
+class RegionIndex {
+public:
+    /**
+     * @brief An axis-aligned box, the minimum corner is inclusive and the maximum corner is exclusive.
+     */
+    struct Box {
+        float min_x;
+        float min_y;
+        float min_z;
+        float max_x;
+        float max_y;
+        float max_z;
+
+        [[nodiscard]] bool contains(float x, float y, float z) const
+        {
+            return x >= min_x && x < max_x && y >= min_y && y < max_y && z >= min_z && z < max_z;
+        }
+
+        [[nodiscard]] bool intersects(const Box &other) const
+        {
+            return min_x < other.max_x && other.min_x < max_x && min_y < other.max_y && other.min_y < max_y &&
+                   min_z < other.max_z && other.min_z < max_z;
+        }
+    };
+
+    /**
+     * @brief Gets the box covering the blocks between two corners, both inclusive and in any order.
+     */
+    static Box fromBlocks(int x1, int y1, int z1, int x2, int y2, int z2);
+
+    /**
+     * @return false if a region with the same name already exists
+     */
+    bool insert(std::string name, const Box &box);
+    bool erase(std::string_view name);
+    [[nodiscard]] const Box *find(std::string_view name) const;
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * @return the names of the regions containing the point, sorted by name
+     */
+    [[nodiscard]] std::vector<std::string> query(float x, float y, float z) const;
+
+    /**
+     * @return the names of the regions intersecting the box, sorted by name
+     */
+    [[nodiscard]] std::vector<std::string> query(const Box &box) const;
+
+private:
+    static constexpr std::size_t LeafSize = 4;
+
+    struct Node {
+        Box bounds;
+        std::uint32_t first;  // first entry for leaves, right child for inner nodes whose left child follows them
+        std::uint32_t count;  // number of entries for leaves, zero for inner nodes
+    };
+
+    struct Entry {
+        Box box;
+        const std::string *name;
+    };
+
+    void build() const;
+    void build(std::size_t begin, std::size_t end) const;
+    template <typename Overlaps>
+    [[nodiscard]] std::vector<std::string> collect(Overlaps overlaps) const;
+
+    std::map<std::string, Box, std::less<>> regions_;
+    mutable std::vector<Entry> entries_;
+    mutable std::vector<Node> nodes_;
+    mutable bool dirty_ = false;
+};
+
+}  // namespace endstone::detail
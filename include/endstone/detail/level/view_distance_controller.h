@@ -0,0 +1,61 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+namespace endstone::detail {
+
+/**
+ * @brief Caps the view distance of every player to keep the server under a target tick usage.
+ *
+ * The cap starts lifted. While the average tick usage is over the target, it is lowered by one chunk at a time, from
+ * the highest distance requested by a client down to MinDistance. Once the usage falls below the target by more than
+ * Hysteresis, it is raised again one chunk at a time, and lifted when it no longer limits any client. Changes are at
+ * least AdjustInterval ticks apart, the chunks sent or dropped after a change take a few seconds to show in the usage.
+ */
+class ViewDistanceController {
+public:
+    static constexpr int MinDistance = 4;
+    static constexpr float Hysteresis = 0.1F;
+    static constexpr std::uint64_t AdjustInterval = 100;
+
+    explicit ViewDistanceController(float target_usage);
+
+    /**
+     * @brief Adjusts the cap to the average tick usage.
+     *
+     * @param current_tick The current tick
+     * @param average_usage The average tick usage, from 0 to 1
+     * @param highest_requested The highest view distance requested by an online client
+     * @return true if the cap changed
+     */
+    bool update(std::uint64_t current_tick, float average_usage, int highest_requested);
+
+    /**
+     * @brief Gets the cap on the view distance of the players, or std::nullopt if it is lifted.
+     */
+    [[nodiscard]] std::optional<int> getCap() const;
+
+    [[nodiscard]] float getTargetUsage() const;
+
+private:
+    float target_usage_;
+    std::optional<int> cap_;
+    std::optional<std::uint64_t> last_change_;
+};
+
+}  // namespace endstone::detail
@@ -14,15 +14,49 @@
 
 #pragma once
 
+#include <chrono>
+#include <memory>
 #include <string>
 
+#include "endstone/detail/spdlog/async_log_sink.h"
+#include "endstone/detail/spdlog/console_log_sink.h"
+#include "endstone/detail/spdlog/log_rate_limiter.h"
 #include "endstone/logger.h"
 
 namespace endstone::detail {
 
 class LoggerFactory {
 public:
+    /**
+     * Gets the logger with the given name, creating it on first use.
+     *
+     * The returned logger lives until the process exits and is never moved, so callers on hot paths may cache it
+     * instead of looking it up by name each time.
+     */
     static Logger &getLogger(const std::string &name);
+
+    /**
+     * Sets what happens to messages logged while the asynchronous log queue is full, Block by default.
+     */
+    static void setOverflowPolicy(LogOverflowPolicy policy);
+
+    /**
+     * Writes the queued messages before a crash dump, waiting at most the given time for the writer thread.
+     */
+    static bool flush(std::chrono::milliseconds timeout);
+
+    /**
+     * Limits how often the logger with the given name writes messages, creating it if needed.
+     */
+    static void setRateLimit(const std::string &name, const LogRateLimit &limit);
+
+    /**
+     * Gets the sink that writes the log to the standard output, from the writer thread of the asynchronous sink.
+     */
+    static const std::shared_ptr<ConsoleLogSink> &getConsoleSink();
+
+private:
+    static const std::shared_ptr<AsyncLogSink> &getSink();
 };
 
 }  // namespace endstone::detail
@@ -0,0 +1,69 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <string_view>
+
+namespace endstone::detail {
+
+/**
+ * The parts of Endstone whose memory is accounted for by MemoryUsage.
+ */
+enum class MemorySubsystem : std::size_t {
+    Players,        // Player wrappers
+    Forms,          // Forms waiting for an answer
+    Scoreboards,    // The main scoreboard and the scoreboards created by plugins, e.g. per-player boards
+    Tasks,          // Scheduled tasks
+    EventHandlers,  // Registered event handlers
+    Permissions,    // Permission attachment infos built by getEffectivePermissions
+    LogBuffers,     // Queued log messages of the asynchronous log sinks
+    Count,
+};
+
+/**
+ * Counts the bytes held by each subsystem, updated where their objects are created and destroyed.
+ *
+ * The counts are estimates from the sizes of the objects and of the buffers they own, not measurements of the heap.
+ * Updating a count is a relaxed atomic add, so it costs next to nothing at the allocation sites.
+ */
+class MemoryUsage {
+public:
+    static MemoryUsage &getInstance();
+
+    void add(MemorySubsystem subsystem, std::size_t bytes) noexcept
+    {
+        bytes_[static_cast<std::size_t>(subsystem)].fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    void remove(MemorySubsystem subsystem, std::size_t bytes) noexcept
+    {
+        bytes_[static_cast<std::size_t>(subsystem)].fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::size_t get(MemorySubsystem subsystem) const noexcept
+    {
+        return bytes_[static_cast<std::size_t>(subsystem)].load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] static std::string_view getName(MemorySubsystem subsystem);
+
+private:
+    std::array<std::atomic<std::size_t>, static_cast<std::size_t>(MemorySubsystem::Count)> bytes_{};
+};
+
+}  // namespace endstone::detail
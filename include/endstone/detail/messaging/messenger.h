@@ -0,0 +1,97 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "endstone/detail/scheduler/thread_pool_executor.h"
+#include "endstone/logger.h"
+#include "endstone/messaging/messenger.h"
+
+namespace endstone::detail {
+
+class EndstoneMessenger : public Messenger {
+public:
+    using TransportFactory = std::function<std::unique_ptr<MessageTransport>()>;
+
+    static constexpr std::size_t MaxQueuedMessages = 65536;
+    static constexpr std::chrono::seconds StopTimeout{5};
+
+    /**
+     * @param executor The executor the transport is used from
+     * @param logger The logger errors of the transport are reported to
+     * @param server_id The ID of this server, a random one is made if it is empty
+     */
+    EndstoneMessenger(ThreadPoolExecutor &executor, Logger &logger, std::string server_id);
+    ~EndstoneMessenger() override;
+
+    EndstoneMessenger(const EndstoneMessenger &) = delete;
+    EndstoneMessenger &operator=(const EndstoneMessenger &) = delete;
+
+    void publish(const std::string &channel, std::string message) override;
+    void subscribe(Plugin &plugin, const std::string &channel, Handler handler) override;
+    void unsubscribe(Plugin &plugin, const std::string &channel) override;
+    void unregister(Plugin &plugin) override;
+    void setTransport(Plugin &plugin, std::unique_ptr<MessageTransport> transport) override;
+    [[nodiscard]] std::string getServerId() const override;
+
+    /**
+     * @brief Subscribes the server itself to a channel, for as long as it runs.
+     */
+    void subscribeServer(const std::string &channel, Handler handler);
+
+    /**
+     * @brief Sets how the transport of the server itself is made, used while no plugin provides one.
+     */
+    void setDefaultTransport(TransportFactory factory);
+
+    /**
+     * @brief Hands the messages received since the last tick to the subscribers.
+     */
+    void tick();
+
+    /**
+     * @brief Stops the transport and waits for it, no message is sent or received afterwards.
+     */
+    void close();
+
+private:
+    struct State;
+    struct Subscription {
+        Plugin *plugin;  // nullptr for the server
+        Handler handler;
+    };
+
+    void post(std::function<void(State &)> operation);
+    void replaceTransport(std::unique_ptr<MessageTransport> transport, bool wait);
+    void addSubscriber(const std::string &channel, Plugin *plugin, Handler handler);
+    void removeSubscriber(const std::string &channel, const Plugin &plugin);
+
+    ThreadPoolExecutor &executor_;
+    Logger &logger_;
+    std::shared_ptr<State> state_;
+    std::map<std::string, std::vector<Subscription>> subscriptions_;
+    TransportFactory default_factory_;
+    Plugin *transport_owner_ = nullptr;
+    bool closed_ = false;
+};
+
+}  // namespace endstone::detail
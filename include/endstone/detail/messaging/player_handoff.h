@@ -0,0 +1,51 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "endstone/detail/persistence/player_data_store.h"
+#include "endstone/util/uuid.h"
+
+namespace endstone::detail {
+
+/**
+ * @brief The state of a player sent ahead of a transfer, so the target server has it before the player connects.
+ */
+struct PlayerHandoff {
+    static constexpr std::uint32_t Version = 1;
+
+    /**
+     * @brief Gets the channel a server receives the players handed off to it on.
+     */
+    static std::string getChannel(const std::string &server_id);
+
+    [[nodiscard]] std::string encode() const;
+
+    /**
+     * @return The handoff, or nullopt if the message is truncated or of another version
+     */
+    static std::optional<PlayerHandoff> decode(const std::string &message);
+
+    UUID player_id;
+    std::string player_name;
+    std::string source_server_id;
+    std::vector<EndstonePlayerDataStore::PlayerEntry> entries;
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,57 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "endstone/messaging/messenger.h"
+
+namespace endstone::detail {
+
+/**
+ * @brief Carries messages to the servers of a network in UDP datagrams sent to a multicast group.
+ *
+ * Each datagram holds one message, so messages are limited to a little less than MaxDatagramSize and may be lost or
+ * arrive out of order, as UDP does not retry. Suited to servers on one network segment, without a broker to run.
+ */
+class UdpMulticastTransport : public MessageTransport {
+public:
+    static constexpr std::size_t MaxDatagramSize = 65507;
+
+    /**
+     * @param group The multicast group, such as 239.255.43.21
+     * @param port The port every server of the network listens on
+     */
+    UdpMulticastTransport(std::string group, std::uint16_t port);
+    ~UdpMulticastTransport() override;
+
+    void start(Receiver receiver) override;
+    void stop() override;
+    void subscribe(const std::string &channel) override;
+    void unsubscribe(const std::string &channel) override;
+    /**
+     * @throws std::length_error if the message does not fit in a datagram
+     */
+    void publish(const std::string &channel, const std::string &payload) override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,154 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace endstone::detail {
+
+namespace metrics {
+/**
+ * @brief Number of shards of a counter or histogram. Each thread updates its own shard, so that threads rarely
+ * share a cache line, and the shards are summed when the metric is read.
+ */
+constexpr std::size_t ShardCount = 16;
+
+inline std::size_t getShardIndex() noexcept
+{
+    static std::atomic<std::size_t> next{0};
+    thread_local const std::size_t index = next.fetch_add(1, std::memory_order_relaxed) % ShardCount;
+    return index;
+}
+}  // namespace metrics
+
+/**
+ * @brief A value that only goes up, such as the number of ticks run.
+ */
+class Counter {
+public:
+    void inc(std::uint64_t value = 1) noexcept
+    {
+        shards_[metrics::getShardIndex()].value.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::uint64_t value() const noexcept;
+
+private:
+    struct alignas(64) Shard {
+        std::atomic<std::uint64_t> value{0};
+    };
+    std::array<Shard, metrics::ShardCount> shards_;
+};
+
+/**
+ * @brief A value that is set to the latest reading, such as the number of players online.
+ */
+class Gauge {
+public:
+    void set(double value) noexcept
+    {
+        value_.store(value, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] double value() const noexcept
+    {
+        return value_.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<double> value_{0.0};
+};
+
+/**
+ * @brief Counts observations, such as tick durations, in buckets with fixed upper bounds.
+ */
+class Histogram {
+public:
+    static constexpr std::size_t MaxBuckets = 16;
+
+    struct Snapshot {
+        std::vector<double> bounds;
+        std::vector<std::uint64_t> counts;  // cumulative, one more than bounds for the +Inf bucket
+        double sum;
+    };
+
+    /**
+     * @param bounds the upper bounds of the buckets in ascending order, at most MaxBuckets of them
+     */
+    explicit Histogram(std::vector<double> bounds);
+
+    void observe(double value) noexcept;
+    [[nodiscard]] Snapshot snapshot() const;
+
+private:
+    struct alignas(64) Shard {
+        std::array<std::atomic<std::uint64_t>, MaxBuckets + 1> counts{};
+        std::atomic<double> sum{0.0};
+    };
+    std::vector<double> bounds_;
+    std::array<Shard, metrics::ShardCount> shards_;
+};
+
+/**
+ * @brief Holds the metrics of the server and writes them in the Prometheus text exposition format.
+ *
+ * Metrics are created once and live as long as the registry, so callers keep references to them. Updating a metric
+ * never takes a lock, only creating one and serializing do.
+ */
+class MetricsRegistry {
+public:
+    using Labels = std::vector<std::pair<std::string, std::string>>;
+
+    static MetricsRegistry &getInstance();
+
+    /**
+     * @brief Gets the counter with the given name and labels, creating it if needed.
+     *
+     * @throws std::invalid_argument if a metric of another type has the same name
+     */
+    Counter &counter(const std::string &name, const std::string &help, const Labels &labels = {});
+    Gauge &gauge(const std::string &name, const std::string &help, const Labels &labels = {});
+    Histogram &histogram(const std::string &name, const std::string &help, std::vector<double> bounds,
+                         const Labels &labels = {});
+
+    [[nodiscard]] std::string serialize() const;
+
+private:
+    using Metric = std::variant<std::unique_ptr<Counter>, std::unique_ptr<Gauge>, std::unique_ptr<Histogram>>;
+
+    struct Family {
+        std::string help;
+        std::size_t type;  // index of the alternative of Metric
+        std::map<std::string, Metric> metrics;  // by serialized labels
+    };
+
+    template <typename T, typename... Args>
+    T &getOrCreate(const std::string &name, const std::string &help, const Labels &labels, Args &&...args);
+
+    mutable std::mutex mutex_;
+    std::map<std::string, Family> families_;
+};
+
+}  // namespace endstone::detail
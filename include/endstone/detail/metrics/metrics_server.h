@@ -0,0 +1,51 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "endstone/detail/metrics/metrics_registry.h"
+
+namespace endstone::detail {
+
+/**
+ * @brief Serves the metrics of a registry over HTTP at /metrics, for Prometheus to scrape.
+ *
+ * Requests are handled on a background thread of the server, which only reads the metrics and never touches the
+ * server thread.
+ */
+class MetricsServer {
+public:
+    /**
+     * @brief Starts listening on the given address.
+     *
+     * @throws std::runtime_error if the address cannot be bound
+     */
+    MetricsServer(const MetricsRegistry &registry, const std::string &host, std::uint16_t port);
+    ~MetricsServer();
+
+    MetricsServer(const MetricsServer &) = delete;
+    MetricsServer &operator=(const MetricsServer &) = delete;
+
+    [[nodiscard]] std::uint16_t getPort() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace endstone::detail
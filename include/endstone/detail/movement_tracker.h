@@ -0,0 +1,91 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "endstone/actor/movement_stats.h"
+
+namespace endstone::detail {
+
+/**
+ * @brief Keeps the positions of every player over the last HistoryTicks ticks, and the speeds derived from them.
+ *
+ * Each player has a slot. The history is stored as one row per tick, each row holding one column per slot, so the
+ * speeds and peaks of all the players are computed in a single pass over contiguous arrays once per tick.
+ */
+class MovementTracker {
+public:
+    static constexpr std::size_t HistoryTicks = 20;
+    static constexpr float TicksPerSecond = 20.0F;
+
+    /**
+     * @brief Gives a slot to a new player, reusing the slot of a player who left if any.
+     */
+    std::size_t addSlot();
+
+    void removeSlot(std::size_t slot);
+
+    /**
+     * @brief Forgets the history of a slot, such as after a teleport, so the jump does not show as movement.
+     */
+    void reset(std::size_t slot);
+
+    /**
+     * @brief Records the position of a slot for the current tick, starting over if its dimension changed.
+     */
+    void record(std::size_t slot, float x, float y, float z, int dimension);
+
+    /**
+     * @brief Computes the speeds of every slot from the positions recorded this tick, then starts the next tick.
+     *
+     * Slots without a position this tick start their history over.
+     */
+    void advance();
+
+    [[nodiscard]] MovementStats getStats(std::size_t slot) const;
+
+    /**
+     * @brief Gets the slots whose peak horizontal speed or acceleration during the last second is over a limit.
+     */
+    [[nodiscard]] std::vector<std::size_t> findAnomalies(float max_speed, float max_acceleration) const;
+
+    [[nodiscard]] std::size_t getCapacity() const;
+
+private:
+    using Row = std::vector<float>;
+
+    std::size_t previousRow() const;
+
+    std::size_t head_ = 0;  // Row of the current tick
+    std::array<Row, HistoryTicks> x_;
+    std::array<Row, HistoryTicks> y_;
+    std::array<Row, HistoryTicks> z_;
+    std::array<Row, HistoryTicks> speed_;         // Horizontal speed reached on each tick
+    std::array<Row, HistoryTicks> acceleration_;  // Change of the horizontal speed on each tick
+    Row vertical_speed_;
+    Row peak_speed_;
+    Row peak_acceleration_;
+    std::vector<std::uint32_t> samples_;  // Consecutive ticks recorded, up to 3 which is all the speeds need
+    std::vector<std::uint8_t> recorded_;  // Whether a position was recorded this tick
+    std::vector<int> dimension_;
+    std::vector<std::uint8_t> in_use_;
+    std::vector<std::size_t> free_slots_;
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,47 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+
+#include "bedrock/nbt/tag.h"
+
+namespace endstone::detail {
+
+/**
+ * @brief Remembers Tag::hash per tag for a batch of comparisons, such as sorting an inventory or matching shop items.
+ *
+ * Vanilla tags have no room for a cached hash, so the cache is keyed by address and cannot observe mutations. Call
+ * invalidate for a tag that changed, or clear the cache once the batch is over.
+ */
+class NbtHashCache {
+public:
+    [[nodiscard]] std::uint64_t hash(const Tag &tag);
+
+    /**
+     * @brief Compares two tags, skipping the full comparison when their hashes already differ.
+     */
+    [[nodiscard]] bool equals(const Tag &lhs, const Tag &rhs);
+
+    void invalidate(const Tag &tag);
+    void clear();
+    [[nodiscard]] std::size_t size() const;
+
+private:
+    std::unordered_map<const Tag *, std::uint64_t> hashes_;
+};
+
+}  // namespace endstone::detail
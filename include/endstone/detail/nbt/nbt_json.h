@@ -0,0 +1,42 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "bedrock/nbt/compound_tag.h"
+#include "endstone/detail/form/json_writer.h"
+
+namespace endstone::detail::NbtJson {
+
+/**
+ * @brief Writes a tag as JSON. Numbers and strings map to their JSON counterparts, byte arrays become base64 strings.
+ */
+void write(JsonWriter &writer, const Tag &tag);
+std::string toJson(const Tag &tag);
+
+/**
+ * @brief Parses a JSON object into a compound tag without building a JSON document first.
+ *
+ * JSON carries no tag types, so they are inferred: integers become TAG_Int or TAG_Long depending on their range, real
+ * numbers TAG_Double, booleans TAG_Byte, strings TAG_String and arrays TAG_List. Null members are dropped.
+ *
+ * @throws std::runtime_error if the input is not valid JSON, is not an object, or has an array of mixed types
+ */
+std::unique_ptr<CompoundTag> fromJson(std::string_view json);
+
+}  // namespace endstone::detail::NbtJson
@@ -0,0 +1,97 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "bedrock/common/util/data_io.h"
+#include "bedrock/core/result.h"
+#include "bedrock/nbt/tag.h"
+
+namespace endstone::detail {
+
+/**
+ * @brief Receives the values of an NBT stream as the NbtReader walks it.
+ *
+ * Every entry of a compound is announced through visitKey before its value. Views and vectors passed to the visitor
+ * are only valid for the duration of the call.
+ */
+class NbtVisitor {
+public:
+    virtual ~NbtVisitor() = default;
+
+    virtual void visitKey(std::string_view name) {}
+    virtual void visitByte(std::uint8_t value) {}
+    virtual void visitShort(std::int16_t value) {}
+    virtual void visitInt(std::int32_t value) {}
+    virtual void visitInt64(std::int64_t value) {}
+    virtual void visitFloat(float value) {}
+    virtual void visitDouble(double value) {}
+    virtual void visitString(std::string_view value) {}
+    virtual void visitByteArray(const std::vector<std::uint8_t> &value) {}
+    virtual void visitIntArray(const std::vector<std::int32_t> &value) {}
+
+    /**
+     * @return false to skip the compound, its entries are consumed without being visited and endCompound is not called
+     */
+    virtual bool beginCompound()
+    {
+        return true;
+    }
+    virtual void endCompound() {}
+
+    /**
+     * @return false to skip the list, its elements are consumed without being visited and endList is not called
+     */
+    virtual bool beginList(Tag::Type type, std::int32_t size)
+    {
+        return true;
+    }
+    virtual void endList() {}
+};
+
+/**
+ * @brief Walks an NBT stream and reports its values to an NbtVisitor without building any tags.
+ */
+class NbtReader {
+public:
+    static constexpr int MaxDepth = 512;
+
+    explicit NbtReader(IDataInput &input) : input_(input) {}
+
+    /**
+     * @brief Reads a named root tag: its type, its name and its payload.
+     */
+    Bedrock::Result<void> read(NbtVisitor &visitor);
+
+    /**
+     * @brief Reads the payload of a tag of the given type, for streams that carry no root header.
+     */
+    Bedrock::Result<void> readPayload(Tag::Type type, NbtVisitor &visitor);
+
+private:
+    Bedrock::Result<void> readPayload(Tag::Type type, NbtVisitor *visitor, int depth);
+    Bedrock::Result<void> readCompound(NbtVisitor *visitor, int depth);
+    Bedrock::Result<void> readList(NbtVisitor *visitor, int depth);
+
+    IDataInput &input_;
+    std::vector<std::uint8_t> bytes_;
+    std::vector<std::int32_t> ints_;
+};
+
+}  // namespace endstone::detail
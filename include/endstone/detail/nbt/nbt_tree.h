@@ -0,0 +1,144 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "endstone/detail/nbt/nbt_reader.h"
+
+namespace endstone::detail {
+
+/**
+ * @brief Bump allocator that hands out memory from a few large blocks and releases it all at once.
+ *
+ * Only trivially destructible objects may live in the arena, nothing is destroyed when it goes away.
+ */
+class NbtArena {
+public:
+    static constexpr std::size_t DefaultBlockSize = 16 * 1024;
+
+    explicit NbtArena(std::size_t block_size = DefaultBlockSize);
+    NbtArena(const NbtArena &) = delete;
+    NbtArena &operator=(const NbtArena &) = delete;
+
+    void *allocate(std::size_t size, std::size_t alignment);
+
+    template <typename T>
+    T *make()
+    {
+        static_assert(std::is_trivially_destructible_v<T>);
+        return new (allocate(sizeof(T), alignof(T))) T();
+    }
+
+    std::string_view copy(std::string_view value);
+
+    template <typename T>
+    const T *copy(const std::vector<T> &values)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        if (values.empty()) {
+            return nullptr;
+        }
+        auto *data = static_cast<T *>(allocate(values.size() * sizeof(T), alignof(T)));
+        std::uninitialized_copy(values.begin(), values.end(), data);
+        return data;
+    }
+
+    /**
+     * @brief Releases everything allocated so far, keeping the first block for reuse.
+     */
+    void reset();
+
+    [[nodiscard]] std::size_t getBlockCount() const;
+
+private:
+    void grow();
+
+    std::size_t block_size_;
+    std::vector<std::unique_ptr<std::byte[]>> blocks_;
+    std::vector<std::unique_ptr<std::byte[]>> large_blocks_;
+    std::byte *cursor_ = nullptr;
+    std::byte *end_ = nullptr;
+};
+
+/**
+ * @brief A tag of a tree parsed into an NbtArena. Names, payloads and children all point into the arena.
+ */
+struct NbtNode {
+    Tag::Type type = Tag::Type::End;
+    Tag::Type element_type = Tag::Type::End;  // lists only
+    std::string_view name;                    // empty for list elements
+    std::int64_t integer = 0;                 // Byte, Short, Int and Int64
+    double real = 0;                          // Float and Double
+    std::string_view bytes;                   // String and ByteArray
+    const std::int32_t *ints = nullptr;       // IntArray
+    std::size_t size = 0;                     // entries of a compound or a list, elements of an array
+    NbtNode *first_child = nullptr;
+    NbtNode *next_sibling = nullptr;
+
+    [[nodiscard]] const NbtNode *get(std::string_view key) const;
+    [[nodiscard]] const NbtNode *at(std::size_t index) const;
+};
+
+/**
+ * @brief Visitor that builds a tree of NbtNode in an arena.
+ */
+class NbtTreeBuilder : public NbtVisitor {
+public:
+    explicit NbtTreeBuilder(NbtArena &arena) : arena_(arena) {}
+
+    [[nodiscard]] const NbtNode *getRoot() const;
+
+    void visitKey(std::string_view name) override;
+    void visitByte(std::uint8_t value) override;
+    void visitShort(std::int16_t value) override;
+    void visitInt(std::int32_t value) override;
+    void visitInt64(std::int64_t value) override;
+    void visitFloat(float value) override;
+    void visitDouble(double value) override;
+    void visitString(std::string_view value) override;
+    void visitByteArray(const std::vector<std::uint8_t> &value) override;
+    void visitIntArray(const std::vector<std::int32_t> &value) override;
+    bool beginCompound() override;
+    void endCompound() override;
+    bool beginList(Tag::Type type, std::int32_t size) override;
+    void endList() override;
+
+private:
+    struct Frame {
+        NbtNode *node;
+        NbtNode *last_child;
+    };
+
+    NbtNode &append(Tag::Type type);
+
+    NbtArena &arena_;
+    std::vector<Frame> stack_;
+    NbtNode *root_ = nullptr;
+    std::string_view key_;
+};
+
+/**
+ * @brief Reads a named root tag into the arena, the returned tree lives as long as the arena is not reset.
+ */
+Bedrock::Result<const NbtNode *> readNbtTree(IDataInput &input, NbtArena &arena);
+
+}  // namespace endstone::detail
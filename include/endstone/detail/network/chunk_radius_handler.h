@@ -0,0 +1,54 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include "bedrock/network/packet.h"
+
+namespace endstone::detail {
+
+class EndstonePlayer;
+
+/**
+ * @brief Limits the chunk radius requested by the clients to the view distance their player is allowed.
+ *
+ * RequestChunkRadius packets are routed to this handler in front of the vanilla one once read. It clamps the radius
+ * in the packet and hands it on, so the server only publishes the chunks within the allowed radius, and vanilla tells
+ * the client the radius it was given.
+ */
+class ChunkRadiusHandler : public IPacketHandlerDispatcher {
+public:
+    static ChunkRadiusHandler &getInstance();
+
+    /**
+     * @brief Routes a RequestChunkRadius packet that was just read to this handler, given its vanilla handler.
+     */
+    void intercept(const IPacketHandlerDispatcher *&handler);
+
+    void handle(const NetworkIdentifier &network_id, NetEventCallback &callback,
+                std::shared_ptr<::Packet> &packet) const override;
+
+    /**
+     * @brief Applies the view distance a player is allowed now, as if its client requested its radius again.
+     */
+    void refresh(const EndstonePlayer &player) const;
+
+private:
+    std::atomic<const IPacketHandlerDispatcher *> vanilla_{nullptr};
+};
+
+}  // namespace endstone::detail
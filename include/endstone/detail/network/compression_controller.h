@@ -0,0 +1,69 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace endstone::detail {
+
+/**
+ * @brief Decides which of the packets sent by the API are worth compressing.
+ *
+ * Packets smaller than the threshold are sent without compression, which costs them a few bytes but saves the
+ * compressor a call. With a target tick usage, the threshold is doubled while the average tick usage is over the
+ * target, trading bandwidth for CPU, up to MaxThreshold. Once the usage falls below the target by more than
+ * Hysteresis, it is halved again down to the configured threshold. Changes are at least AdjustInterval ticks apart.
+ */
+class CompressionController {
+public:
+    static constexpr std::size_t MaxThreshold = 4096;
+    // The smallest threshold raised, doubling a threshold of 0 or 1 would take too many intervals to matter
+    static constexpr std::size_t MinAdaptiveThreshold = 256;
+    static constexpr float Hysteresis = 0.1F;
+    static constexpr std::uint64_t AdjustInterval = 100;
+
+    explicit CompressionController(std::size_t threshold, std::optional<float> target_usage = std::nullopt);
+
+    /**
+     * @brief Adjusts the threshold to the average tick usage, if there is a target.
+     *
+     * @param current_tick The current tick
+     * @param average_usage The average tick usage, from 0 to 1
+     * @return true if the threshold changed
+     */
+    bool update(std::uint64_t current_tick, float average_usage);
+
+    /**
+     * @brief Checks whether a packet of the given size is to be compressed.
+     */
+    [[nodiscard]] bool isCompressible(std::size_t size) const;
+
+    /**
+     * @brief Gets the size in bytes from which packets are compressed.
+     */
+    [[nodiscard]] std::size_t getThreshold() const;
+
+    [[nodiscard]] std::optional<float> getTargetUsage() const;
+
+private:
+    std::size_t base_threshold_;
+    std::size_t threshold_;
+    std::optional<float> target_usage_;
+    std::optional<std::uint64_t> last_change_;
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,101 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <optional>
+
+#include "endstone/network/packet_priority.h"
+
+namespace endstone::detail {
+
+/**
+ * @brief Shapes the packets sent to one player with a token bucket, holding back the less urgent ones.
+ *
+ * The bucket fills at the bandwidth limit of the player, up to one second worth of bytes, and is charged with the
+ * size of each packet once it is sent, so it may go into debt. Normal and bulk packets are sent while the bucket is
+ * not empty and wait in their queue otherwise, bulk packets also wait while the send queue of the connection is deep.
+ * The queues are drained in order from the server tick, normal packets first.
+ */
+class OutboundShaper {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * Sends a packet and returns its size in bytes.
+     */
+    using Sender = std::function<std::size_t()>;
+
+    // The number of messages waiting in the send buffer of RakNet from which the connection is considered congested
+    static constexpr std::size_t DeepSendQueue = 256;
+    // Past this many held packets the oldest is sent anyway, the limit gives way rather than the memory
+    static constexpr std::size_t MaxQueuedPackets = 1024;
+
+    /**
+     * @brief Sends a packet now, or holds it back until its priority allows.
+     */
+    void submit(PacketPriority priority, Sender sender);
+
+    /**
+     * @brief Checks whether a packet of the given priority would be sent right away by submit.
+     */
+    [[nodiscard]] bool canSend(PacketPriority priority) const;
+
+    /**
+     * @brief Charges the bucket with a packet sent without going through submit.
+     */
+    void charge(std::size_t size);
+
+    /**
+     * @brief Refills the bucket and sends the held packets that are now allowed.
+     *
+     * @param now The current time
+     */
+    void tick(Clock::time_point now);
+
+    void setRate(std::optional<std::size_t> bytes_per_second, Clock::time_point now = Clock::now());
+    [[nodiscard]] std::optional<std::size_t> getRate() const;
+
+    /**
+     * @brief Sets the number of messages waiting in the send buffer of the connection, as last seen.
+     */
+    void setSendQueueSize(std::size_t send_queue_size);
+
+    [[nodiscard]] bool hasQueued() const;
+    [[nodiscard]] std::size_t getQueuedCount() const;
+
+    /**
+     * @brief Sends every held packet, ignoring the limits.
+     */
+    void flush();
+
+private:
+    [[nodiscard]] bool hasTokens() const;
+    [[nodiscard]] bool isCongested() const;
+    void send(const Sender &sender);
+    void trim(std::deque<Sender> &queue);
+
+    std::optional<std::size_t> rate_;
+    double tokens_ = 0;
+    Clock::time_point updated_{};
+    std::size_t send_queue_size_ = 0;
+    std::deque<Sender> normal_;
+    std::deque<Sender> bulk_;
+};
+
+}  // namespace endstone::detail
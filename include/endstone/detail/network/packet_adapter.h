@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include "bedrock/network/packet.h"
 #include "endstone/network/packet.h"
 
@@ -32,10 +34,16 @@ public:
     [[nodiscard]] virtual bool disallowBatching() const;
     [[nodiscard]] virtual bool isValid() const;
 
+    /**
+     * @brief Gets the size of the packet body as last written to a stream.
+     */
+    [[nodiscard]] std::size_t getEncodedSize() const;
+
 private:
     [[nodiscard]] virtual Bedrock::Result<void> _read(ReadOnlyBinaryStream &);
 
     endstone::Packet &packet_;
+    mutable std::size_t encoded_size_ = 0;
 };
 
 }  // namespace endstone::detail
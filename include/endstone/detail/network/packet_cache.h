@@ -0,0 +1,130 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+#include "bedrock/network/packet.h"
+
+namespace endstone::detail {
+
+/**
+ * Declares the virtual functions of ::Packet in the order of the server, to call them on packets it created.
+ */
+class PacketInterface : public ::Packet {
+public:
+    ~PacketInterface() override = default;
+    [[nodiscard]] virtual MinecraftPacketIds getId() const = 0;
+    [[nodiscard]] virtual std::string getName() const = 0;
+    [[nodiscard]] virtual Bedrock::Result<void> checkSize(std::uint64_t, bool) const = 0;
+    virtual void write(BinaryStream &) const = 0;
+    [[nodiscard]] virtual Bedrock::Result<void> read(ReadOnlyBinaryStream &) = 0;
+    [[nodiscard]] virtual bool disallowBatching() const = 0;
+    [[nodiscard]] virtual bool isValid() const = 0;
+
+private:
+    [[nodiscard]] virtual Bedrock::Result<void> _read(ReadOnlyBinaryStream &) = 0;
+};
+
+/**
+ * A packet created by the server, which is serialised by it once and then copied into the stream of every recipient.
+ */
+class EncodedPacket {
+public:
+    explicit EncodedPacket(std::unique_ptr<::Packet> packet);
+
+    [[nodiscard]] const PacketInterface &getPacket() const;
+    void write(BinaryStream &stream);
+
+private:
+    std::mutex mutex_;
+    std::unique_ptr<::Packet> packet_;
+    std::optional<std::string> payload_;
+};
+
+/**
+ * Stands in for a packet of type T and writes the payload of an EncodedPacket. The members inherited from T are left
+ * empty, every virtual function is forwarded to the encoded packet.
+ */
+template <typename T>
+class CachedPacket : public T {
+public:
+    explicit CachedPacket(std::shared_ptr<EncodedPacket> encoded) : encoded_(std::move(encoded)) {}
+
+    ~CachedPacket() override = default;
+    [[nodiscard]] virtual MinecraftPacketIds getId() const
+    {
+        return encoded_->getPacket().getId();
+    }
+    [[nodiscard]] virtual std::string getName() const
+    {
+        return encoded_->getPacket().getName();
+    }
+    [[nodiscard]] virtual Bedrock::Result<void> checkSize(std::uint64_t size, bool flag) const
+    {
+        return encoded_->getPacket().checkSize(size, flag);
+    }
+    virtual void write(BinaryStream &stream) const
+    {
+        encoded_->write(stream);
+    }
+    [[nodiscard]] virtual Bedrock::Result<void> read(ReadOnlyBinaryStream &stream)
+    {
+        return _read(stream);
+    }
+    [[nodiscard]] virtual bool disallowBatching() const
+    {
+        return encoded_->getPacket().disallowBatching();
+    }
+    [[nodiscard]] virtual bool isValid() const
+    {
+        return encoded_->getPacket().isValid();
+    }
+
+private:
+    [[nodiscard]] virtual Bedrock::Result<void> _read(ReadOnlyBinaryStream &)
+    {
+        throw std::runtime_error("Not implemented");
+    }
+
+    std::shared_ptr<EncodedPacket> encoded_;
+};
+
+/**
+ * Keeps the encoded packets that are the same for every player, until they are cleared.
+ */
+class PacketCache {
+public:
+    using Factory = std::function<std::unique_ptr<::Packet>()>;
+
+    /**
+     * Gets the packet stored under the key, creating it with the factory if there is none.
+     */
+    [[nodiscard]] std::shared_ptr<EncodedPacket> get(std::size_t key, const Factory &create);
+    void clear();
+
+private:
+    std::mutex mutex_;
+    std::unordered_map<std::size_t, std::shared_ptr<EncodedPacket>> packets_;
+};
+
+}  // namespace endstone::detail
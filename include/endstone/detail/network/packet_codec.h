@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 
 #include "bedrock/core/utility/binary_stream.h"
@@ -25,6 +26,8 @@ namespace PacketCodec {
 
 void encode(BinaryStream &stream, Packet &packet);
 
+std::unique_ptr<Packet> clone(const Packet &packet);
+
 template <typename T, typename = std::enable_if_t<std::is_base_of_v<Packet, T> && !std::is_same_v<Packet, T>>>
 void encode(BinaryStream &stream, T &packet);
 
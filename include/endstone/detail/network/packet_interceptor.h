@@ -0,0 +1,56 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <shared_mutex>
+#include <vector>
+
+#include "endstone/network/packet_interceptor.h"
+
+namespace endstone::detail {
+
+class EndstonePacketInterceptor : public PacketInterceptor {
+public:
+    // Packet ids are the low 10 bits of the packet header
+    static constexpr std::size_t PacketIdCount = 1024;
+
+    void addHandler(Plugin &plugin, int packet_id, Handler handler) override;
+    void removeHandlers(Plugin &plugin, int packet_id) override;
+    void unregister(Plugin &plugin) override;
+    [[nodiscard]] bool hasHandlers(int packet_id) const override;
+
+    /**
+     * @brief Passes a packet body through the handlers of its packet id, on the network thread.
+     *
+     * @return false if a handler dropped the packet
+     */
+    bool intercept(int packet_id, int sub_client_id, char *data, std::size_t size) const;
+
+private:
+    struct Entry {
+        Plugin *plugin;
+        Handler handler;
+    };
+
+    // Removing a handler waits for the handlers running on the network thread, its code may be unloaded afterwards
+    mutable std::shared_mutex mutex_;
+    std::array<std::vector<Entry>, PacketIdCount> handlers_;
+    std::array<std::atomic<bool>, PacketIdCount> active_{};
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,75 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace endstone::detail {
+
+/**
+ * @brief Counts the packets and bytes received by the server for each packet id, and those sent through the API.
+ *
+ * Counters are updated from the network thread with relaxed atomics and can be read from any thread.
+ */
+class PacketStatistics {
+public:
+    static constexpr std::size_t MaxPacketId = 0x3FF;
+
+    struct Entry {
+        int packet_id;
+        std::uint64_t count;
+        std::uint64_t bytes;
+    };
+
+    static PacketStatistics &getInstance();
+
+    void recordReceived(int packet_id, std::size_t bytes);
+
+    /**
+     * @brief Gets the packet ids received so far, ordered by the number of bytes received.
+     */
+    [[nodiscard]] std::vector<Entry> getReceived() const;
+
+    void recordSent(int packet_id, std::size_t bytes, bool compressed);
+
+    /**
+     * @brief Gets the average size of the packets sent with the given id, or std::nullopt if none was sent.
+     */
+    [[nodiscard]] std::optional<std::size_t> getAverageSentSize(int packet_id) const;
+
+    /**
+     * @brief Gets the number of packets sent without compression.
+     */
+    [[nodiscard]] std::uint64_t getUncompressedCount() const;
+
+    void reset();
+
+private:
+    struct Counter {
+        std::atomic<std::uint64_t> count{0};
+        std::atomic<std::uint64_t> bytes{0};
+    };
+
+    std::array<Counter, MaxPacketId + 1> received_;
+    std::array<Counter, MaxPacketId + 1> sent_;
+    std::atomic<std::uint64_t> uncompressed_{0};
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,85 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+namespace endstone::detail {
+
+/**
+ * @brief Limits how often each source address gets an answer to an unconnected ping.
+ *
+ * Every source has a counter that grows by one per answered ping and decays by the rate limit per second, pings that
+ * would push it past the burst limit are dropped. Counters live in a fixed size open addressing table, when it is
+ * crowded the source that has been quiet the longest gives up its slot.
+ */
+class PingRateLimiter {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief An IPv6 address, or an IPv4 address mapped into one.
+     */
+    struct Source {
+        std::uint64_t high;
+        std::uint64_t low;
+
+        bool operator==(const Source &other) const
+        {
+            return high == other.high && low == other.low;
+        }
+    };
+
+    static constexpr double DefaultRate = 10;
+    static constexpr double DefaultBurst = 20;
+
+    static PingRateLimiter &getInstance();
+
+    /**
+     * @return true if the ping should be answered, false if the source is over its limit
+     */
+    bool tryAcquire(const Source &source, Clock::time_point now = Clock::now());
+    void setLimit(double rate, double burst);
+
+    [[nodiscard]] std::uint64_t getServedCount() const;
+    [[nodiscard]] std::uint64_t getDroppedCount() const;
+
+private:
+    struct Slot {
+        Source source;
+        float level;
+        std::uint32_t updated;  // milliseconds since the limiter was created
+        bool occupied;
+    };
+
+    static constexpr std::size_t Capacity = 4096;
+    static constexpr std::size_t MaxProbes = 8;
+
+    [[nodiscard]] float decay(const Slot &slot, std::uint32_t now) const;
+
+    std::mutex mutex_;
+    Clock::time_point epoch_ = Clock::now();
+    double rate_ = DefaultRate;
+    double burst_ = DefaultBurst;
+    std::array<Slot, Capacity> slots_{};
+    std::atomic<std::uint64_t> served_{0};
+    std::atomic<std::uint64_t> dropped_{0};
+};
+
+}  // namespace endstone::detail
@@ -14,8 +14,11 @@
 
 #pragma once
 
+#include <cstddef>
 #include <functional>
+#include <optional>
 #include <string>
+#include <vector>
 
 namespace endstone::detail::os {
 
@@ -24,4 +27,44 @@ std::string get_module_pathname();
 void *get_executable_base();
 std::string get_executable_pathname();
 std::string get_name();
+
+/**
+ * @brief Gets the physical memory used by the process, in bytes, or 0 if it cannot be read.
+ */
+std::size_t get_resident_memory();
+
+struct AllocatorStats {
+    const char *name;
+    std::size_t allocated;  // Bytes allocated by the process, or 0 if the allocator does not report it
+    std::size_t committed;  // Bytes the allocator has mapped or committed for its heaps
+};
+
+/**
+ * @brief Gets the statistics of the allocator in use, if it is mimalloc or jemalloc.
+ *
+ * @return The statistics, or std::nullopt for the allocator of the C library
+ */
+std::optional<AllocatorStats> get_allocator_stats();
+
+enum class ThreadPriority {
+    Low,
+    Normal,
+    High,
+};
+
+/**
+ * @brief Restricts the calling thread to the given CPUs.
+ *
+ * @return false if the set is empty or the OS refused it
+ */
+bool set_thread_affinity(const std::vector<std::size_t> &cpus);
+
+/**
+ * @brief Sets the scheduling priority of the calling thread.
+ *
+ * Raising it above normal usually needs CAP_SYS_NICE on Linux.
+ *
+ * @return false if the OS refused it
+ */
+bool set_thread_priority(ThreadPriority priority);
 }  // namespace endstone::detail::os
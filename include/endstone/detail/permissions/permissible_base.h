@@ -14,7 +14,9 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -25,12 +27,19 @@
 
 namespace endstone::detail {
 
+class EndstonePluginManager;
+
 /**
  * Base Permissible for use in any Permissible object via proxy or extension
  */
 class PermissibleBase : public Permissible {
 public:
-    explicit PermissibleBase(Permissible *opable);
+    /**
+     * @param opable The object whose operator status is used, may be null
+     * @param plugin_manager The plugin manager holding the permissions, null to use the one of the server
+     */
+    explicit PermissibleBase(Permissible *opable, EndstonePluginManager *plugin_manager = nullptr);
+    ~PermissibleBase() override;
 
     [[nodiscard]] bool isOp() const override;
     void setOp(bool value) override;
@@ -42,6 +51,7 @@ public:
     PermissionAttachment *addAttachment(Plugin &plugin) override;
     bool removeAttachment(PermissionAttachment &attachment) override;
     void recalculatePermissions() override;
+    void recalculatePermission(PermissionAttachment &attachment, const std::string &name, bool value) override;
     [[nodiscard]] std::unordered_set<PermissionAttachmentInfo *> getEffectivePermissions() const override;
     [[nodiscard]] CommandSender *asCommandSender() const override;
     void clearPermissions();
@@ -49,10 +59,26 @@ public:
 private:
     void calculateChildPermissions(const std::unordered_map<std::string, bool> &children, bool invert,
                                    PermissionAttachment *attachment);
+    void calculateChildPermissions(std::size_t id, bool invert, PermissionAttachment *attachment);
     [[nodiscard]] static bool hasPermission(PermissionDefault default_value, bool op);
+    [[nodiscard]] bool hasPermission(std::size_t id, PermissionDefault default_value) const;
+    [[nodiscard]] bool isPermissionSet(std::size_t id) const;
+    void setPermission(std::size_t id, PermissionAttachment *attachment, bool value);
+    void recalculateIfDirty() const;
+    void releaseEffectivePermissions() const;
+    [[nodiscard]] EndstonePluginManager &getPluginManager() const;
     Permissible *opable_;
+    mutable EndstonePluginManager *plugin_manager_;
     Permissible &parent_;
     std::vector<std::unique_ptr<PermissionAttachment>> attachments_{};
-    std::unordered_map<std::string, std::unique_ptr<PermissionAttachmentInfo>> permissions_{};
+    // Effective permissions indexed by interned permission ID, for lookups without hashing or allocation
+    std::vector<bool> permission_set_{};
+    std::vector<bool> permission_values_{};
+    std::vector<std::size_t> effective_ids_{};
+    std::unordered_map<std::size_t, PermissionAttachment *> permission_attachments_{};
+    // An info and its pointer in effective_permissions_, the permission name is not counted
+    static constexpr std::size_t InfoBytes = sizeof(PermissionAttachmentInfo) + sizeof(void *);
+    // Only created on demand by getEffectivePermissions
+    mutable std::vector<std::unique_ptr<PermissionAttachmentInfo>> effective_permissions_{};
 };
 }  // namespace endstone::detail
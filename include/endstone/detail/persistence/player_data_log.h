@@ -0,0 +1,91 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace endstone::detail {
+
+/**
+ * @brief An append-only log of key-value records on disk, compacted once most of it is superseded.
+ *
+ * Each record holds a key and either a value or a tombstone, followed by a CRC-32 of its contents. Writing a batch is
+ * a single append, and loading replays the records in order, so a record torn by a crash is detected and dropped
+ * along with anything after it. Compaction rewrites the live records to a new file which then replaces the log.
+ *
+ * The log is not thread-safe, it is meant to be driven by one thread at a time.
+ */
+class PlayerDataLog {
+public:
+    using Entries = std::map<std::string, std::string>;
+
+    /**
+     * @brief A change to a key, a nullopt value removes it.
+     */
+    struct Write {
+        std::string key;
+        std::optional<std::string> value;
+    };
+
+    static constexpr std::uint64_t MinCompactionSize = 1024 * 1024;
+
+    explicit PlayerDataLog(std::filesystem::path path);
+
+    /**
+     * @brief Opens the log, creating it if needed, and replays it.
+     *
+     * @return the live entries
+     * @throws std::runtime_error if the file is not a log or cannot be opened
+     */
+    Entries open();
+    void append(const std::vector<Write> &batch);
+
+    /**
+     * @return true once the log is both large and mostly made of superseded records
+     */
+    [[nodiscard]] bool shouldCompact() const;
+    void compact();
+
+    [[nodiscard]] const std::filesystem::path &getPath() const;
+    [[nodiscard]] std::uint64_t getSize() const;
+    [[nodiscard]] std::uint64_t getLiveSize() const;
+
+private:
+    static constexpr char Magic[4] = {'E', 'S', 'P', 'D'};
+    static constexpr std::uint32_t Version = 1;
+    static constexpr std::size_t HeaderSize = sizeof(Magic) + sizeof(Version);
+    static constexpr std::uint32_t Tombstone = 0xFFFFFFFF;
+
+    Entries replay();
+    static void encode(std::string &out, const std::string &key, const std::optional<std::string> &value);
+    void track(const std::string &key, const std::optional<std::string> &value, std::uint64_t record_size);
+    void reopen();
+
+    std::filesystem::path path_;
+    std::ofstream out_;
+    std::uint64_t size_ = 0;
+    std::uint64_t live_size_ = 0;
+    std::unordered_map<std::string, std::uint64_t> record_sizes_;
+};
+
+}  // namespace endstone::detail
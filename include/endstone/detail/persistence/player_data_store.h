@@ -0,0 +1,91 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <future>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "endstone/detail/persistence/player_data_log.h"
+#include "endstone/detail/scheduler/thread_pool_executor.h"
+#include "endstone/logger.h"
+#include "endstone/persistence/player_data_store.h"
+
+namespace endstone::detail {
+
+class EndstonePlayerDataStore : public PlayerDataStore {
+public:
+    struct PlayerEntry {
+        std::string plugin;
+        std::string key;
+        std::string value;
+    };
+
+    EndstonePlayerDataStore(ThreadPoolExecutor &executor, Logger &logger, std::filesystem::path path);
+    ~EndstonePlayerDataStore() override;
+
+    [[nodiscard]] std::optional<std::string> get(const Plugin &plugin, const UUID &player_id,
+                                                 const std::string &key) const override;
+    void set(const Plugin &plugin, const UUID &player_id, const std::string &key, std::string value) override;
+    bool remove(const Plugin &plugin, const UUID &player_id, const std::string &key) override;
+    [[nodiscard]] std::vector<std::string> getKeys(const Plugin &plugin, const UUID &player_id) const override;
+    void flush() override;
+
+    /**
+     * @brief Gets every value stored for a player, by all the plugins.
+     */
+    [[nodiscard]] std::vector<PlayerEntry> getPlayerEntries(const UUID &player_id) const;
+
+    /**
+     * @brief Replaces every value stored for a player with the given ones, such as those handed off by another server.
+     */
+    void replacePlayerEntries(const UUID &player_id, const std::vector<PlayerEntry> &entries);
+
+    /**
+     * @brief Flushes the queued writes every FlushIntervalTicks ticks.
+     */
+    void tick(std::uint64_t current_tick);
+
+    /**
+     * @brief Writes out everything queued, waiting at most ShutdownTimeout for the I/O workers.
+     */
+    void close();
+
+    [[nodiscard]] std::size_t getPendingCount() const;
+
+    static constexpr std::uint64_t FlushIntervalTicks = 20;
+    static constexpr std::chrono::seconds ShutdownTimeout{5};
+
+private:
+    static std::string toPrefix(const Plugin &plugin, const UUID &player_id);
+    static std::string toPrefix(const std::string &plugin, const UUID &player_id);
+    void collect();
+
+    ThreadPoolExecutor &executor_;
+    Logger &logger_;
+    std::shared_ptr<PlayerDataLog> log_;
+    PlayerDataLog::Entries entries_;
+    std::map<std::string, std::optional<std::string>> pending_;
+    std::shared_ptr<const std::vector<PlayerDataLog::Write>> in_flight_batch_;
+    std::future<void> in_flight_;
+};
+
+}  // namespace endstone::detail
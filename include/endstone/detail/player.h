@@ -14,15 +14,26 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <map>
 #include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
 
-#include <nlohmann/json.hpp>
-
+#include "bedrock/network/minecraft_packet_ids.h"
+#include "bedrock/network/packet.h"
 #include "bedrock/network/packet/types/connection_request.h"
 #include "bedrock/network/packet/types/sub_client_connection_request.h"
 #include "bedrock/world/form/player_form_close_reason.h"
+#include "endstone/detail/actor/actor_visibility.h"
 #include "endstone/detail/actor/mob.h"
+#include "endstone/detail/form/form_response.h"
 #include "endstone/detail/inventory/player_inventory.h"
+#include "endstone/detail/network/outbound_shaper.h"
+#include "endstone/detail/scheduler/thread_pool_executor.h"
+#include "endstone/detail/seqlock.h"
 #include "endstone/player.h"
 
 class Player;
@@ -52,6 +63,7 @@ public:
     PermissionAttachment *addAttachment(Plugin &plugin) override;
     bool removeAttachment(PermissionAttachment &attachment) override;
     void recalculatePermissions() override;
+    void recalculatePermission(PermissionAttachment &attachment, const std::string &name, bool value) override;
     [[nodiscard]] std::unordered_set<PermissionAttachmentInfo *> getEffectivePermissions() const override;
     [[nodiscard]] bool isOp() const override;
     void setOp(bool value) override;
@@ -70,6 +82,7 @@ public:
     void teleport(Actor &target) override;
     [[nodiscard]] std::int64_t getId() const override;
     [[nodiscard]] bool isDead() const override;
+    [[nodiscard]] std::string getType() const override;
 
     // Mob
     [[nodiscard]] bool isGliding() const override;
@@ -103,6 +116,9 @@ public:
     void sendTitle(std::string title, std::string subtitle, int fade_in, int stay, int fade_out) const override;
     void resetTitle() const override;
     [[nodiscard]] std::chrono::milliseconds getPing() const override;
+    [[nodiscard]] NetworkStats getNetworkStats() const override;
+    [[nodiscard]] MovementStats getMovementStats() const override;
+    [[nodiscard]] Snapshot getSnapshot() const override;
     void updateCommands() const override;
     bool performCommand(std::string command) const override;  // NOLINT(*-use-nodiscard)
     [[nodiscard]] GameMode getGameMode() const override;
@@ -113,21 +129,97 @@ public:
     [[nodiscard]] std::string getDeviceId() const override;
     [[nodiscard]] const Skin &getSkin() const override;
     void transfer(std::string host, int port) const override;
+    void transfer(std::string host, int port, const std::string &server_id) const override;
+    [[nodiscard]] std::optional<int> getViewDistance() const override;
+    void setViewDistance(std::optional<int> distance) override;
+    void hideActor(Actor &actor) override;
+    void showActor(Actor &actor) override;
+    [[nodiscard]] bool canSee(const Actor &actor) const override;
+    [[nodiscard]] std::optional<float> getActorCullDistance() const override;
+    void setActorCullDistance(std::optional<float> distance) override;
+    [[nodiscard]] std::optional<int> getBandwidthLimit() const override;
+    void setBandwidthLimit(std::optional<int> bytes_per_second) override;
     void sendForm(FormVariant form) override;
     void closeForm() override;
     void sendPacket(Packet &packet) override;
+    void beginBatch() override;
+    void endBatch() override;
     void onFormClose(int form_id, PlayerFormCloseReason reason);
-    void onFormResponse(int form_id, const nlohmann::json &json);
-
-    void initFromConnectionRequest(
+    void onFormResponse(int form_id, const FormResponse &response);
+
+    /**
+     * @brief Drops a form that is still waiting for an answer after FormTimeoutTicks, calling its on close callback.
+     */
+    void onFormTimeout(int form_id);
+    [[nodiscard]] std::size_t getOpenFormCount() const;
+
+    static constexpr std::size_t MaxOpenForms = 16;
+    static constexpr std::uint64_t FormTimeoutTicks = 5 * 60 * 20;
+
+    /**
+     * @brief Fields of a connection request, whose skin images are decoded by the CPU workers in the background.
+     */
+    struct ConnectionData;
+
+    /**
+     * @brief Reads a connection request and starts decoding its skin images, before the player data is loaded.
+     */
+    static std::shared_ptr<ConnectionData> readConnectionRequest(
+        ThreadPoolExecutor &executor,
         std::variant<const ::ConnectionRequest *, const ::SubClientConnectionRequest *> request);
+
+    /**
+     * @brief Applies a connection request read by readConnectionRequest, decoding the skin images now if no worker
+     * has started on them yet.
+     */
+    void initFromConnectionRequest(ConnectionData &data);
     void disconnect();
     void updateAbilities() const;
     bool checkRightClickSpam(Vector<int> block_pos, Vector<float> click_pos);
     [[nodiscard]] ::Player &getHandle() const;
 
+    /**
+     * @brief Records the chunk radius requested by the client, and gets the radius it is allowed.
+     *
+     * The radius is limited by the view distance set by plugins and by the cap of the adaptive view distance.
+     */
+    int onChunkRadiusRequested(int radius, std::uint8_t max_radius);
+
+    /**
+     * @brief Gets the last chunk radius and maximum radius requested by the client, before they were limited.
+     */
+    [[nodiscard]] std::optional<std::pair<int, std::uint8_t>> getRequestedChunkRadius() const;
+
+    /**
+     * @brief Removes the actors around this player that it must not see, and adds back the ones it may see again.
+     */
+    void updateActorVisibility();
+
+    /**
+     * @brief Sends the held back packets this player's bandwidth now allows.
+     */
+    void tickOutboundShaping(OutboundShaper::Clock::time_point now);
+
+    /**
+     * @brief Publishes the state of this player for getSnapshot, at the end of each tick on the server thread.
+     */
+    void publishSnapshot(std::uint64_t tick);
+
 private:
     friend class ::ServerNetworkHandler;
+    friend class EndstoneServer;
+
+    void dismissForm(std::map<int, FormVariant>::iterator it);
+    void sendNetworkPacket(Packet &packet) const;
+    void sendNetworkPacket(MinecraftPacketIds id, std::shared_ptr<::Packet> packet, std::size_t size) const;
+    [[nodiscard]] bool canSendNow(PacketPriority priority) const;
+    std::size_t writeNetworkPacket(Packet &packet) const;
+    [[nodiscard]] int limitChunkRadius(int radius) const;
+    void sendRemoveActor(const Actor &actor) const;
+    void sendAddActor(Actor &actor) const;
+
+    // A node of forms_, the buttons and texts of a form are not counted
+    static constexpr std::size_t FormBytes = sizeof(std::map<int, FormVariant>::value_type) + 4 * sizeof(void *);
 
     ::Player &player_;
     UUID uuid_;
@@ -140,7 +232,17 @@ private:
     std::string device_id_;
     Skin skin_;
     int form_ids_ = 0xffff;  // Set to a large value to avoid collision with forms created by script api
-    std::unordered_map<int, FormVariant> forms_;
+    std::map<int, FormVariant> forms_;  // Ordered by id, so the oldest form comes first
+    int batch_depth_ = 0;
+    std::vector<std::unique_ptr<Packet>> batched_packets_;
+    std::optional<int> view_distance_;
+    std::optional<std::pair<int, std::uint8_t>> requested_chunk_radius_;
+    std::size_t movement_slot_ = 0;
+    ActorVisibility actor_visibility_;
+    const Dimension *visibility_dimension_ = nullptr;
+    mutable OutboundShaper outbound_shaper_;
+    mutable std::uint64_t send_queue_tick_ = 0;  // The tick the send queue size was last read on
+    Seqlock<Snapshot> snapshot_;
 };
 
 }  // namespace endstone::detail
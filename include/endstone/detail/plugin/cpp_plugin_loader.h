@@ -16,6 +16,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "endstone/plugin/plugin_loader.h"
@@ -28,10 +29,17 @@ public:
 
     [[nodiscard]] std::vector<Plugin *> loadPlugins(const std::string &directory) override;
     [[nodiscard]] std::unique_ptr<Plugin> loadPlugin(const std::string &file);
+    [[nodiscard]] Plugin *reloadPlugin(Plugin &plugin) override;
     [[nodiscard]] std::vector<std::string> getPluginFileFilters() const;
 
 private:
+    struct Library {
+        std::string file;
+        void *module;
+    };
+
     std::vector<std::unique_ptr<Plugin>> plugins_;
+    std::unordered_map<const Plugin *, Library> libraries_;
 };
 
 }  // namespace endstone::detail
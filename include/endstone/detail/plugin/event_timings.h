@@ -0,0 +1,70 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "endstone/detail/latency_histogram.h"
+#include "endstone/event/event_handler.h"
+#include "endstone/event/event_timing.h"
+
+namespace endstone::detail {
+
+/**
+ * Collects per (plugin, event type, priority) dispatch timings of event handlers.
+ *
+ * Recording is off by default. While disabled, the only cost on the dispatch path is the relaxed load in isEnabled().
+ */
+class EventTimings {
+public:
+    [[nodiscard]] bool isEnabled() const
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    void setEnabled(bool enabled);
+    void record(const EventHandler &handler, std::size_t event_type, std::chrono::nanoseconds elapsed);
+    [[nodiscard]] std::vector<EventTiming> getTimings() const;
+    void reset();
+
+private:
+    struct Entry {
+        std::string plugin;
+        std::string event;
+        EventPriority priority;
+        std::atomic<std::uint64_t> count{0};
+        std::atomic<std::uint64_t> total{0};
+        std::atomic<std::uint64_t> max{0};
+        LatencyHistogram histogram;
+    };
+
+    using Key = std::tuple<const Plugin *, std::size_t, EventPriority>;
+    template <typename Func>
+    void update(const EventHandler &handler, std::size_t event_type, Func &&func);
+
+    std::atomic<bool> enabled_{false};
+    mutable std::shared_mutex mutex_;
+    std::map<Key, std::unique_ptr<Entry>> entries_;
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,62 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "endstone/plugin/plugin.h"
+
+namespace endstone::detail {
+
+/**
+ * Orders plugins so that each one comes after its dependencies, its soft dependencies and the plugins it loads before.
+ *
+ * Plugins keep the given order wherever their dependencies allow. A plugin missing a dependency, or in a cycle of
+ * dependencies, is rejected along with the plugins depending on it. Cycles made of soft dependencies are broken
+ * instead.
+ */
+class PluginDependencyGraph {
+public:
+    struct Rejection {
+        std::size_t index;
+        std::string reason;
+    };
+
+    /**
+     * @param descriptions the plugins to order
+     * @param loaded the names, and provided names, of the plugins loaded before, which satisfy dependencies
+     */
+    PluginDependencyGraph(const std::vector<const PluginDescription *> &descriptions,
+                          const std::unordered_set<std::string> &loaded);
+
+    /**
+     * @return the indices of the accepted plugins, in the order they should be loaded and enabled
+     */
+    [[nodiscard]] const std::vector<std::size_t> &getOrder() const;
+
+    /**
+     * @return the rejected plugins with the reasons, by index
+     */
+    [[nodiscard]] const std::vector<Rejection> &getRejections() const;
+
+private:
+    std::vector<std::size_t> order_;
+    std::vector<Rejection> rejections_;
+};
+
+}  // namespace endstone::detail
@@ -14,11 +14,15 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include "endstone/detail/plugin/event_timings.h"
 #include "endstone/event/handler_list.h"
 #include "endstone/permissions/permission.h"
 #include "endstone/plugin/plugin_loader.h"
@@ -44,10 +48,27 @@ public:
     void disablePlugins() const override;
     void clearPlugins() override;
 
+    /**
+     * Unloads a single plugin and loads it again through its loader, leaving the other plugins untouched.
+     *
+     * The plugin is disabled, its event handlers, tasks and permissions are unregistered, and the new instance takes
+     * its place in the load order. The new instance is loaded but not enabled.
+     *
+     * @param plugin the plugin to reload, which is destroyed
+     * @return the new instance of the plugin, or nullptr if it could not be loaded again
+     */
+    Plugin *reloadPlugin(Plugin &plugin);
+
     /** Event system */
     void callEvent(Event &event) override;
-    void registerEvent(std::string event, std::function<void(Event &)> executor, EventPriority priority, Plugin &plugin,
+    void registerEvent(std::string event, EventExecutor executor, EventPriority priority, Plugin &plugin,
                        bool ignore_cancelled) override;
+    using PluginManager::hasListeners;
+    [[nodiscard]] bool hasListeners(const std::string &event, std::atomic<std::size_t> &type_slot) const override;
+    void setTimingsEnabled(bool enabled) override;
+    [[nodiscard]] bool isTimingsEnabled() const override;
+    [[nodiscard]] std::vector<EventTiming> getEventTimings() const override;
+    void resetTimings() override;
 
     /** Permission system */
     [[nodiscard]] Permission *getPermission(std::string name) const override;
@@ -64,20 +85,111 @@ public:
     [[nodiscard]] std::unordered_set<Permissible *> getDefaultPermSubscriptions(bool op) const override;
     [[nodiscard]] std::unordered_set<Permission *> getPermissions() const override;
 
+    /**
+     * Whether the default permissions of some permissibles changed since they last calculated their permissions.
+     */
+    [[nodiscard]] bool hasDirtyPermissibles() const;
+
+    /**
+     * Recalculate, in one batch, the permissions of all permissibles whose default permissions changed.
+     */
+    void recalculateDirtyPermissibles();
+
+    /**
+     * Returned by findPermissionId when a permission name has never been interned.
+     */
+    static constexpr std::size_t InvalidPermissionId = static_cast<std::size_t>(-1);
+
+    /**
+     * Gets the dense integer ID of a lowercase permission name, interning the name if it has none yet.
+     *
+     * IDs are never reused or released, so they stay valid across permission removal and re-registration.
+     */
+    std::size_t internPermission(const std::string &name);
+
+    /**
+     * Gets the ID of a permission name, or InvalidPermissionId if the name has never been interned.
+     *
+     * Names are matched case-insensitively, lowercase names are found without a copy.
+     */
+    [[nodiscard]] std::size_t findPermissionId(const std::string &name) const;
+
+    /**
+     * Gets the ID of a registered permission without looking up its name, or InvalidPermissionId if it is not
+     * registered.
+     */
+    [[nodiscard]] std::size_t findPermissionId(const Permission &perm) const;
+
+    /**
+     * Gets the registered Permission with the given ID, or nullptr if none is registered under it.
+     */
+    [[nodiscard]] Permission *getPermissionById(std::size_t id) const;
+
+    /**
+     * Gets the lowercase permission name of an interned ID.
+     */
+    [[nodiscard]] const std::string &getPermissionName(std::size_t id) const;
+
+    /**
+     * Gets the flattened, recursive expansion of the children of the permission with the given ID, as pairs of
+     * permission IDs and values, in the order they would be applied to a permissible.
+     *
+     * The values are those of a permission set to true, negate them all to get the expansion of a permission set to
+     * false. The expansion is computed once per permission and shared by all permissibles until the permission graph
+     * changes.
+     */
+    const std::vector<std::pair<std::size_t, bool>> &getChildPermissions(std::size_t id);
+
+    /**
+     * Subscribes the given Permissible for information about the permission with the given ID.
+     */
+    void subscribeToPermission(std::size_t id, Permissible &permissible);
+
+    /**
+     * Unsubscribes the given Permissible from information about the permission with the given ID.
+     */
+    void unsubscribeFromPermission(std::size_t id, Permissible &permissible);
+
+    /**
+     * Gets the Permissibles subscribed to the permission with the given ID, sorted by address.
+     *
+     * The list is not copied. It is invalidated when a Permissible subscribes to or unsubscribes from the permission,
+     * which includes recalculating the permissions of a subscriber.
+     */
+    [[nodiscard]] const std::vector<Permissible *> &getPermissionSubscribers(std::size_t id) const;
+
 private:
     friend class EndstoneServer;
     void initPlugin(Plugin &plugin, PluginLoader &loader, const std::filesystem::path& base_folder);
+    static void callOnLoad(Plugin &plugin);
     void calculatePermissionDefault(Permission &perm);
     void dirtyPermissibles(bool op) const;
+    static std::size_t getEventType(const Event &event);
+    HandlerList *getHandlerList(std::size_t type) const;
+    class ScopeGuard;
+    void callHandler(EventHandler &handler, Event &event, std::size_t type, ScopeGuard &scope);
+    HandlerList *getOrCreateHandlerList(const std::string &event);
+    void unregisterEvents(Plugin &plugin);
+
+    static constexpr std::size_t MaxEventTypes = 1024;
     Server &server_;
     std::vector<std::unique_ptr<PluginLoader>> plugin_loaders_;
     std::vector<Plugin *> plugins_;
     std::unordered_map<std::string, Plugin *> lookup_names_;
-    std::unordered_map<std::string, HandlerList> event_handlers_;
+    std::array<std::atomic<HandlerList *>, MaxEventTypes> event_handlers_{};
+    std::vector<std::unique_ptr<HandlerList>> handler_lists_;
+    std::unordered_map<const Plugin *, std::vector<HandlerList *>> plugin_handler_lists_;  // Lists with its handlers
+    EventTimings timings_;
     std::unordered_map<std::string, std::unique_ptr<Permission>> permissions_;
     std::unordered_map<bool, std::unordered_set<Permission *>> default_perms_;
-    std::unordered_map<std::string, std::unordered_map<Permissible *, bool>> perm_subs_;
+    std::vector<std::vector<Permissible *>> perm_subs_;
     std::unordered_map<bool, std::unordered_map<Permissible *, bool>> def_subs_;
+    mutable std::unordered_set<Permissible *> dirty_permissibles_;
+    std::unordered_map<std::string, std::size_t> permission_ids_;
+    std::vector<Permission *> permissions_by_id_;
+    std::unordered_map<const Permission *, std::size_t> registered_ids_;
+    std::vector<const std::string *> permission_names_;
+    std::unordered_map<std::size_t, std::vector<std::pair<std::size_t, bool>>> child_permissions_;
 };
 
 }  // namespace endstone::detail
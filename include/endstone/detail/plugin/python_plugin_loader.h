@@ -14,7 +14,12 @@
 
 #pragma once
 
+#include <cstddef>
+#include <optional>
+#include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include <pybind11/embed.h>
 
@@ -22,6 +27,9 @@
 
 namespace endstone::detail {
 
+/**
+ * Loads the plugins written in Python. Creating it starts the Python interpreter if it is not running yet.
+ */
 class PythonPluginLoader : public PluginLoader {
 public:
     explicit PythonPluginLoader(Server &server);
@@ -30,8 +38,43 @@ public:
     [[nodiscard]] std::vector<Plugin *> loadPlugins(const std::string &directory) override;
     void enablePlugin(Plugin &plugin) const override;
     void disablePlugin(Plugin &plugin) const override;
+    [[nodiscard]] Plugin *reloadPlugin(Plugin &plugin) override;
+
+    /**
+     * Starts or stops tracing the memory allocated by Python code with tracemalloc, which slows down allocations.
+     */
+    void setMemoryTracing(bool enabled) const;
+    [[nodiscard]] bool isMemoryTracing() const;
+
+    /**
+     * Gets the bytes allocated by each Python plugin since tracing started and not freed since, largest first.
+     */
+    [[nodiscard]] std::vector<std::pair<std::string, std::size_t>> getMemoryUsage() const;
+
+    /**
+     * Gets the number of memory blocks allocated by the interpreter, and the bytes traced by tracemalloc while memory
+     * tracing is on.
+     */
+    [[nodiscard]] std::pair<std::size_t, std::optional<std::size_t>> getHeapUsage() const;
+
+    /**
+     * Checks whether there may be Python plugins to load, without starting the interpreter, so that servers with
+     * native plugins only do without it.
+     *
+     * ENDSTONE_PYTHON set to "on" or "off" decides. Otherwise, the directory is searched for wheels and the
+     * distributions on PYTHONPATH for entry points in the endstone group. Without a PYTHONPATH, there may be.
+     *
+     * @param directory the plugin directory
+     */
+    [[nodiscard]] static bool hasPlugins(const std::string &directory);
+
+    /**
+     * @return true if the Python interpreter has been started
+     */
+    [[nodiscard]] static bool isInterpreterInitialized();
 
 private:
+    static void initializeInterpreter(Server &server);
     [[nodiscard]] PluginLoader *pimpl() const;
 
     pybind11::object obj_;
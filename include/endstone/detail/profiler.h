@@ -0,0 +1,89 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace endstone::detail {
+
+class StackSampler;
+
+/**
+ * Samples the stack of the server thread at a fixed interval, and writes the samples to the profiles folder as folded
+ * stacks, which flamegraph.pl, speedscope and most flame graph viewers read.
+ *
+ * Frames are named after their symbols, the frames of the server without one after the nearest symbol in
+ * symbols.toml. Each sample is attributed to the innermost plugin or Python frame, or else to the innermost hook.
+ */
+class Profiler {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Stacks = std::map<std::vector<std::uintptr_t>, std::size_t>;
+
+    static constexpr std::chrono::milliseconds DefaultInterval{10};
+    static constexpr std::size_t MaxReportEntries = 10;
+
+    static Profiler &getInstance();
+    ~Profiler();
+
+    /**
+     * Starts sampling the calling thread, which must be the server thread.
+     *
+     * @param interval the time between two samples
+     * @return false if a profile is still being recorded or written
+     */
+    bool start(std::chrono::milliseconds interval);
+
+    /**
+     * Stops sampling. The profile is resolved and written on the profiler thread, which logs where it is written.
+     *
+     * @return false if no profile is being recorded
+     */
+    bool stop();
+
+    /**
+     * Stops sampling and waits for the profile to be written.
+     */
+    void shutdown();
+
+    [[nodiscard]] bool isRunning() const;
+    [[nodiscard]] std::size_t getSampleCount() const;
+    [[nodiscard]] Clock::duration getElapsed() const;
+
+private:
+    Profiler() = default;
+    void run(std::chrono::milliseconds interval);
+
+    std::unique_ptr<StackSampler> sampler_;
+    std::thread thread_;
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stopping_{false};
+    std::atomic<bool> running_{false};
+    std::atomic<bool> writing_{false};
+    std::atomic<std::size_t> samples_{0};
+    Clock::time_point started_;
+};
+
+}  // namespace endstone::detail
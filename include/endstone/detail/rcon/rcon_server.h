@@ -0,0 +1,84 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace endstone::detail {
+
+/**
+ * @brief A command received by the RCON server, waiting to be run on the server thread.
+ */
+struct RconCommand {
+    std::string command;
+    std::string remote_address;
+    /**
+     * Sends the output of the command back to the connection it came from, may be called from any thread.
+     */
+    std::function<void(const std::string &)> respond;
+};
+
+/**
+ * @brief Serves the Source RCON protocol, as spoken by mcrcon and most server panels.
+ *
+ * Connections are handled on a background thread of the server, which never touches the server thread. Commands are
+ * queued until the server thread takes them in batches, so a connection may send several without waiting, the
+ * output of each is sent back with the id of its request. A connection must authenticate first, and its commands
+ * are limited to a sustained rate with some burst, those over the limit are answered without being run.
+ *
+ * Each wrong password locks its remote address out for a time that doubles with every failure in a row, up to
+ * MaxLoginBackoff, so reconnecting does not give a fresh attempt. Logins from a locked out address are refused
+ * without checking the password.
+ */
+class RconServer {
+public:
+    static constexpr std::size_t MaxConnections = 16;
+    static constexpr std::size_t MaxPendingCommands = 64;
+    static constexpr double CommandsPerSecond = 20.0;
+    static constexpr double CommandBurst = 40.0;
+    static constexpr std::chrono::seconds AuthTimeout{10};
+    static constexpr std::chrono::seconds LoginBackoff{1};
+    static constexpr std::chrono::seconds MaxLoginBackoff{300};
+    static constexpr std::size_t MaxTrackedAddresses = 1024;
+
+    /**
+     * @brief Starts listening on the given address.
+     *
+     * @throws std::runtime_error if the password is empty or the address cannot be bound
+     */
+    RconServer(std::string password, const std::string &host, std::uint16_t port);
+    ~RconServer();
+
+    RconServer(const RconServer &) = delete;
+    RconServer &operator=(const RconServer &) = delete;
+
+    /**
+     * Takes the oldest commands received, at most the given number of them.
+     */
+    [[nodiscard]] std::vector<RconCommand> takeCommands(std::size_t max_count);
+    [[nodiscard]] std::uint16_t getPort() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace endstone::detail
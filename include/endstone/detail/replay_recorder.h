@@ -0,0 +1,122 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "endstone/detail/tick_history.h"
+
+namespace endstone::detail {
+
+/**
+ * @brief A record of a replay log, as read back by ReplayReader.
+ */
+struct ReplayRecord {
+    enum class Type : std::uint8_t {
+        Tick = 1,     // The end of a server tick and the durations of its phases
+        Packet = 2,   // A packet received from a client, before any plugin handler saw it
+        Command = 3,  // A command dispatched through the API, e.g. from the console or RCON
+    };
+
+    Type type;
+    std::uint64_t time_us;  // Since the recording started
+    std::uint64_t tick = 0;
+    TickHistory::Sample timings{};
+    int packet_id = 0;
+    int sub_client_id = 0;
+    std::string data;  // The body of a packet, or the command line of a command
+    std::string sender;
+};
+
+/**
+ * @brief Records the inputs of the server into a compact binary log, to replay a lag spike on another server.
+ *
+ * Recording only appends the encoded record to an in-memory buffer under a short lock, a background thread writes
+ * the buffer to the file. Records are dropped, and counted, while more than MaxPendingBytes wait to be written.
+ *
+ * The log starts with Magic and Version, followed by the records. Each record is its type as a byte, then unsigned
+ * varints and length prefixed strings, in the order of the fields of ReplayRecord that its type uses.
+ */
+class ReplayRecorder {
+public:
+    static constexpr std::string_view Magic = "ESRP";
+    static constexpr std::uint8_t Version = 1;
+    static constexpr std::size_t MaxPendingBytes = 64 * 1024 * 1024;
+    static constexpr std::chrono::milliseconds FlushInterval{100};
+
+    /**
+     * @param path The file to write the log to, truncated if it exists
+     */
+    explicit ReplayRecorder(const std::string &path);
+    ~ReplayRecorder();
+    ReplayRecorder(const ReplayRecorder &) = delete;
+    ReplayRecorder &operator=(const ReplayRecorder &) = delete;
+
+    [[nodiscard]] bool isOpen() const;
+
+    void recordTick(std::uint64_t tick, const TickHistory::Sample &timings);
+    void recordPacket(int packet_id, int sub_client_id, std::string_view body);
+    void recordCommand(std::string_view sender, std::string_view command);
+
+    /**
+     * @brief Waits until every record so far is written to the file.
+     */
+    void flush();
+
+    [[nodiscard]] std::uint64_t getDroppedCount() const;
+    [[nodiscard]] std::uint64_t getWrittenBytes() const;
+
+private:
+    void append(const std::string &record);
+    void run();
+
+    std::ofstream file_;
+    std::chrono::steady_clock::time_point start_;
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::condition_variable flushed_;
+    std::string pending_;
+    std::uint64_t appended_ = 0;  // Bytes appended to pending_ since the start
+    std::uint64_t written_ = 0;   // Bytes of those that were written to the file
+    std::uint64_t flush_to_ = 0;  // Bytes that flush() waits for, written without waiting for FlushInterval
+    bool stopping_ = false;
+    std::atomic<std::uint64_t> dropped_{0};
+    std::thread writer_;
+};
+
+/**
+ * @brief Reads back the records of a replay log.
+ */
+class ReplayReader {
+public:
+    /**
+     * @param data The whole content of a log
+     * @return The records, or nothing if the data is not a log of a supported version. A record cut short at the end,
+     * e.g. by a crash while writing, ends the list.
+     */
+    [[nodiscard]] static std::optional<std::vector<ReplayRecord>> read(std::string_view data);
+};
+
+}  // namespace endstone::detail
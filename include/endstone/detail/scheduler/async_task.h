@@ -36,8 +36,11 @@ public:
     void doCancel() override;
 
     std::vector<Worker> getWorkers() const;
+    [[nodiscard]] AsyncExecutor getExecutor() const;
+    void setExecutor(AsyncExecutor executor);
 
 private:
+    AsyncExecutor executor_{AsyncExecutor::Cpu};
     mutable std::mutex mutex_;
     std::vector<Worker> workers_;
 };
@@ -0,0 +1,39 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <functional>
+
+#include "endstone/detail/scheduler/task.h"
+#include "endstone/level/dimension.h"
+
+namespace endstone::detail {
+
+/**
+ * A task that the scheduler runs once for each dimension on the CPU workers, instead of calling run.
+ */
+class EndstoneDimensionTask : public EndstoneTask {
+public:
+    EndstoneDimensionTask(EndstoneScheduler &scheduler, Plugin &plugin, std::function<void(Dimension &)> task,
+                          TaskId id, std::uint64_t period);
+
+    void runFor(Dimension &dimension);
+    void release() override;
+
+private:
+    std::function<void(Dimension &)> dimension_task_;
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,41 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+
+#include "endstone/detail/scheduler/task.h"
+
+namespace endstone::detail {
+
+/**
+ * A sync task that is due at a point in time rather than on a tick, run by the scheduler between ticks.
+ */
+class EndstonePreciseTask : public EndstoneTask {
+public:
+    EndstonePreciseTask(EndstoneScheduler &scheduler, Plugin &plugin, std::function<void()> task, TaskId id,
+                        std::chrono::microseconds interval);
+
+    [[nodiscard]] std::chrono::microseconds getInterval() const;
+    [[nodiscard]] TaskClock::time_point getDeadline() const;
+    void setDeadline(TaskClock::time_point deadline);
+
+private:
+    std::chrono::microseconds interval_;
+    TaskClock::time_point deadline_;
+};
+
+}  // namespace endstone::detail
@@ -15,12 +15,19 @@
 #pragma once
 
 #include <atomic>
-#include <mutex>
-#include <queue>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <vector>
 
 #include <moodycamel/concurrentqueue.h>
 
+#include "endstone/detail/scheduler/dimension_task.h"
+#include "endstone/detail/scheduler/precise_task.h"
 #include "endstone/detail/scheduler/task.h"
+#include "endstone/detail/scheduler/task_registry.h"
+#include "endstone/detail/scheduler/task_timings.h"
+#include "endstone/detail/scheduler/timing_wheel.h"
 #include "endstone/scheduler/scheduler.h"
 #include "thread_pool_executor.h"
 
@@ -28,44 +35,154 @@ namespace endstone::detail {
 
 class EndstoneScheduler : public Scheduler {
 public:
-    explicit EndstoneScheduler(Server &server);
+    struct ExecutorOptions {
+        std::size_t thread_count;
+        ThreadOptions thread{};
+    };
+
+    explicit EndstoneScheduler(Server &server,
+                               ExecutorOptions cpu_options = getDefaultExecutorOptions(AsyncExecutor::Cpu),
+                               ExecutorOptions io_options = getDefaultExecutorOptions(AsyncExecutor::Io));
     ~EndstoneScheduler() override = default;
     std::shared_ptr<Task> runTask(Plugin &plugin, std::function<void()> task) override;
     std::shared_ptr<Task> runTaskLater(Plugin &plugin, std::function<void()> task, std::uint64_t delay) override;
     std::shared_ptr<Task> runTaskTimer(Plugin &plugin, std::function<void()> task, std::uint64_t delay,
                                        std::uint64_t period) override;
+    std::shared_ptr<Task> runTaskTimerPrecise(Plugin &plugin, std::function<void()> task,
+                                              std::chrono::microseconds delay,
+                                              std::chrono::microseconds period) override;
     std::shared_ptr<Task> runTaskAsync(Plugin &plugin, std::function<void()> task) override;
     std::shared_ptr<Task> runTaskLaterAsync(Plugin &plugin, std::function<void()> task, std::uint64_t delay) override;
     std::shared_ptr<Task> runTaskTimerAsync(Plugin &plugin, std::function<void()> task, std::uint64_t delay,
                                             std::uint64_t period) override;
+    std::shared_ptr<Task> runTaskAsync(Plugin &plugin, std::function<void()> task, AsyncExecutor executor) override;
+    std::shared_ptr<Task> runTaskLaterAsync(Plugin &plugin, std::function<void()> task, std::uint64_t delay,
+                                            AsyncExecutor executor) override;
+    std::shared_ptr<Task> runTaskTimerAsync(Plugin &plugin, std::function<void()> task, std::uint64_t delay,
+                                            std::uint64_t period, AsyncExecutor executor) override;
+    void runOnMainThread(Plugin &plugin, std::function<void()> callback) override;
+    std::shared_ptr<Task> runDimensionTaskTimer(Plugin &plugin, std::function<void(Dimension &)> task,
+                                                std::uint64_t delay, std::uint64_t period) override;
     void cancelTask(TaskId id) override;
     void cancelTasks(Plugin &plugin) override;
     bool isRunning(TaskId id) override;
     bool isQueued(TaskId id) override;
     std::vector<Task *> getPendingTasks() override;
+    [[nodiscard]] std::vector<TaskTiming> getTaskTimings() const override;
 
     std::shared_ptr<Task> runTask(std::function<void()> task);
     void addTask(std::shared_ptr<EndstoneTask> task);
+
+    /**
+     * Runs the tasks that came due up to the given tick. The tick may skip ahead, as it does with wall-clock timers
+     * while the server lags, in which case the tasks due in between run once, in order, and timers do not repeat to
+     * make up for the runs they missed.
+     *
+     * @param current_tick the current tick, never lower than the one of the previous heartbeat
+     */
     void mainThreadHeartbeat(std::uint64_t current_tick);
+
+    /**
+     * Runs the sync tasks of the PostTick phase that came due in the last heartbeat. They are never deferred.
+     *
+     * @param current_tick the tick passed to the last heartbeat
+     */
+    void mainThreadPostTick(std::uint64_t current_tick);
+
+    /**
+     * Runs the precise tasks that are already due, without waiting for those that are not. Timers that fell behind
+     * run once and do not repeat to make up for the runs they missed.
+     */
+    void mainThreadRunPrecise();
     void removeTask(TaskId id);
 
-private:
-    TaskId nextId();
+    /**
+     * Cancels the tasks of a plugin and waits for those running on a worker to return, then destroys their callables
+     * and the callbacks of disabled plugins queued for the server thread. Called on the server thread before the code
+     * of a plugin is unloaded.
+     *
+     * @return false if a task of the plugin was still running at the deadline, in which case nothing is destroyed
+     */
+    bool releaseTasks(Plugin &plugin, std::chrono::steady_clock::time_point deadline);
+
+    /**
+     * Sets how long sync tasks may run per tick. Tasks with a normal priority that are due once it is spent are
+     * deferred to the following ticks, in order.
+     *
+     * @param budget The time budget per tick, zero for unlimited
+     */
+    void setTickBudget(std::chrono::nanoseconds budget);
+    [[nodiscard]] std::chrono::nanoseconds getTickBudget() const;
 
-    struct TaskComparator {
-        bool operator()(const std::shared_ptr<EndstoneTask> &lhs, const std::shared_ptr<EndstoneTask> &rhs);
+    /**
+     * @return the number of times a sync task was deferred to a later tick since the server started
+     */
+    [[nodiscard]] std::uint64_t getDeferredTaskCount() const;
+
+    /**
+     * Sets the average tick usage from which the periods of repeating tasks with a normal priority are stretched.
+     * The stretch grows linearly from none at the threshold to MaxPeriodStretch at full usage, so that plugins give
+     * the server room to catch up while it lags.
+     *
+     * @param threshold The tick usage between 0 and 1, zero to never stretch
+     */
+    void setLoadSheddingThreshold(float threshold);
+    [[nodiscard]] float getLoadSheddingThreshold() const;
+
+    void setTimingsEnabled(bool enabled);
+    [[nodiscard]] bool isTimingsEnabled() const;
+    void resetTimings();
+
+    [[nodiscard]] ThreadPoolExecutor &getExecutor(AsyncExecutor executor);
+
+    /**
+     * Returns the default options of an executor: the cores but one for CPU-bound tasks, so that the server thread
+     * keeps a core, at least four workers for I/O-bound tasks, which mostly block, and one for Python tasks.
+     * Their threads use the options of the CPU, IO and PYTHON groups from the environment.
+     */
+    static ExecutorOptions getDefaultExecutorOptions(AsyncExecutor executor);
+
+    static constexpr std::chrono::milliseconds DefaultTickBudget{20};
+    static constexpr float MaxPeriodStretch = 4.0F;
+    static constexpr std::size_t DimensionWorkerCount = 2;  // One per vanilla dimension but the one run inline
+
+private:
+    struct Completion {
+        Plugin *plugin;
+        std::function<void()> callback;
     };
 
+    TaskId nextId();
+    void consumePending(std::uint64_t current_tick);
+    void runCompletions();
+    void runSyncTask(EndstoneTask &task);
+    void runDueTask(const std::shared_ptr<EndstoneTask> &task, std::uint64_t current_tick);
+    void runDimensionTasks(std::uint64_t current_tick);
+    void finishDueTask(const std::shared_ptr<EndstoneTask> &task, std::uint64_t current_tick);
+
     Server &server_;
     std::atomic<TaskId> ids_{1};
     moodycamel::ConcurrentQueue<std::shared_ptr<EndstoneTask>> pending_{};
-    std::unordered_map<TaskId, std::shared_ptr<EndstoneTask>> tasks_{};
-    std::mutex tasks_mtx_{};
-    std::map<std::uint64_t, std::vector<std::shared_ptr<EndstoneTask>>> queue_{};
-    std::uint64_t current_tick_{0};
+    TaskRegistry tasks_{};
+    TimingWheel<std::shared_ptr<EndstoneTask>> wheel_{};
+    moodycamel::ConcurrentQueue<Completion> completions_{};
+    std::vector<Completion> completion_buffer_{};
+    std::deque<std::shared_ptr<EndstoneTask>> deferred_{};
+    std::vector<std::shared_ptr<EndstoneTask>> post_tick_{};
+    std::vector<std::shared_ptr<EndstoneDimensionTask>> dimension_tasks_{};
+    std::vector<std::shared_ptr<EndstonePreciseTask>> precise_{};  // Heap, the earliest deadline first
+    std::atomic<std::chrono::nanoseconds> tick_budget_{DefaultTickBudget};
+    std::atomic<std::uint64_t> deferred_count_{0};
+    std::atomic<float> load_shedding_threshold_{0.0F};
+    float period_stretch_ = 1.0F;
+    std::atomic<std::uint64_t> current_tick_{0};
     std::atomic<TaskId> current_task_{0};
-    TaskComparator cmp_{};
-    ThreadPoolExecutor executor_;
+    TaskTimings timings_;
+    ThreadPoolExecutor cpu_executor_;
+    ThreadPoolExecutor io_executor_;
+    ThreadPoolExecutor python_executor_;
+    // Runs dimension tasks only, so that the server thread never waits behind the async tasks on the CPU workers
+    ThreadPoolExecutor dimension_executor_;
 };
 
 }  // namespace endstone::detail
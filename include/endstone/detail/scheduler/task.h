@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <functional>
 
@@ -39,8 +40,17 @@ public:
     [[nodiscard]] bool isSync() const override;
     [[nodiscard]] bool isCancelled() const override;
     void cancel() override;
+    [[nodiscard]] TaskPriority getPriority() const override;
+    void setPriority(TaskPriority priority) override;
+    [[nodiscard]] TaskPhase getPhase() const override;
+    void setPhase(TaskPhase phase) override;
     virtual void run();
     virtual void doCancel();
+    /**
+     * Destroys the callable of the task, so that no code of its plugin is left behind once that is unloaded. Only
+     * called on a cancelled task that is not running.
+     */
+    virtual void release();
 
     EndstoneScheduler &getScheduler() const;
     [[nodiscard]] CreatedAt getCreatedAt() const;
@@ -58,6 +68,8 @@ private:
     std::uint64_t period_;
     std::uint64_t next_run_;
     std::atomic<bool> cancelled_{false};
+    std::atomic<TaskPriority> priority_{TaskPriority::Normal};
+    std::atomic<TaskPhase> phase_{TaskPhase::PreTick};
 };
 
 }  // namespace endstone::detail
@@ -0,0 +1,75 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "endstone/detail/scheduler/task.h"
+
+namespace endstone::detail {
+
+/**
+ * Maps task ids to the tasks known by the scheduler.
+ *
+ * The tasks are spread over shards by id, each with its own lock, so scheduling, cancelling and querying tasks from
+ * worker threads rarely contends with the server thread. The ids are also indexed by owner, so the tasks of one plugin
+ * are found without visiting those of the others.
+ */
+class TaskRegistry {
+public:
+    TaskRegistry() = default;
+    ~TaskRegistry();
+    TaskRegistry(const TaskRegistry &) = delete;
+    TaskRegistry &operator=(const TaskRegistry &) = delete;
+
+    void insert(std::shared_ptr<EndstoneTask> task);
+    [[nodiscard]] std::shared_ptr<EndstoneTask> find(TaskId id) const;
+    [[nodiscard]] bool contains(TaskId id) const;
+    void erase(TaskId id);
+    [[nodiscard]] std::vector<std::shared_ptr<EndstoneTask>> getTasks() const;
+    [[nodiscard]] std::vector<std::shared_ptr<EndstoneTask>> getTasks(const Plugin &owner) const;
+
+private:
+    static constexpr std::size_t NumShards = 16;
+    // A task and its node in a shard, what the task captured is not counted
+    static constexpr std::size_t TaskBytes = sizeof(EndstoneTask) + sizeof(TaskId) + 4 * sizeof(void *);
+
+    struct Shard {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<TaskId, std::shared_ptr<EndstoneTask>> tasks;
+    };
+
+    Shard &getShard(TaskId id)
+    {
+        return shards_[id % NumShards];
+    }
+
+    const Shard &getShard(TaskId id) const
+    {
+        return shards_[id % NumShards];
+    }
+
+    std::array<Shard, NumShards> shards_;
+    mutable std::mutex owners_mutex_;  // Always taken after the lock of a shard
+    std::unordered_map<const Plugin *, std::unordered_set<TaskId>> owners_;
+};
+
+}  // namespace endstone::detail
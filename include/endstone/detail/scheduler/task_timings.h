@@ -0,0 +1,75 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include "endstone/plugin/plugin.h"
+#include "endstone/scheduler/task_timing.h"
+
+namespace endstone::detail {
+
+/**
+ * Collects per plugin run timings of scheduled tasks.
+ *
+ * Recording is off by default. While disabled, the only cost on the scheduling path is the relaxed load in
+ * isEnabled(). The sync counters and endTick() are only touched by the server thread.
+ */
+class TaskTimings {
+public:
+    [[nodiscard]] bool isEnabled() const
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    void setEnabled(bool enabled);
+    void recordSync(const Plugin *plugin, std::chrono::nanoseconds elapsed);
+    void recordAsyncSubmitted(const Plugin *plugin);
+    void recordAsync(const Plugin *plugin, std::chrono::nanoseconds elapsed);
+    void endTick();
+    [[nodiscard]] std::vector<TaskTiming> getTimings() const;
+    void reset();
+
+private:
+    struct Entry {
+        std::string plugin;
+        std::atomic<std::uint64_t> sync_count{0};
+        std::atomic<std::uint64_t> sync_ticks{0};
+        std::atomic<std::uint64_t> sync_max_per_tick{0};
+        std::atomic<std::uint64_t> sync_total{0};
+        std::atomic<std::uint64_t> sync_max{0};
+        std::atomic<std::uint64_t> async_count{0};
+        std::atomic<std::uint64_t> async_pending{0};
+        std::atomic<std::uint64_t> async_total{0};
+        std::uint64_t tick_count{0};
+    };
+
+    template <typename Func>
+    void update(const Plugin *plugin, Func &&func);
+
+    std::atomic<bool> enabled_{false};
+    mutable std::shared_mutex mutex_;
+    std::map<const Plugin *, std::unique_ptr<Entry>> entries_;
+    std::vector<Entry *> ticked_;
+};
+
+}  // namespace endstone::detail
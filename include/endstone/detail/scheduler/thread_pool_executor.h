@@ -14,23 +14,41 @@
 
 #pragma once
 
-#pragma once
-
 #include <atomic>
+#include <condition_variable>
 #include <functional>
 #include <future>
+#include <memory>
+#include <mutex>
 #include <thread>
 #include <vector>
 
 #include <moodycamel/concurrentqueue.h>
 
+#include "endstone/detail/scheduler/work_stealing_deque.h"
+#include "endstone/detail/thread_options.h"
+
 namespace endstone::detail {
 
+/**
+ * @brief A work-stealing thread pool.
+ *
+ * Each worker owns a deque which tasks submitted from that worker go to. Tasks submitted from other threads go to a
+ * shared queue. Idle workers take from their own deque first, then from the shared queue, then steal from the other
+ * workers, and spin for a while before they park.
+ */
 class ThreadPoolExecutor {
 public:
-    explicit ThreadPoolExecutor(size_t threadCount = std::thread::hardware_concurrency());
+    /**
+     * @param thread_count the number of workers
+     * @param options the CPUs and the priority of the workers, applied on a best-effort basis
+     */
+    explicit ThreadPoolExecutor(size_t thread_count = std::thread::hardware_concurrency(), ThreadOptions options = {});
     ~ThreadPoolExecutor();
 
+    /**
+     * Submits a task whose result is delivered through a future
+     */
     template <typename Func, typename... Args>
     auto submit(Func &&func, Args &&...args) -> std::future<std::invoke_result_t<Func, Args...>>
     {
@@ -40,20 +58,48 @@ public:
             std::bind(std::forward<Func>(func), std::forward<Args>(args)...));
 
         auto result = task->get_future();
-        tasks.enqueue([task]() { (*task)(); });
-
-        condition.notify_one();
+        execute([task]() { (*task)(); });
         return result;
     }
 
+    /**
+     * Submits a task without tracking its completion
+     *
+     * @remark Exceptions thrown by the task are discarded, so the task should handle its own errors
+     */
+    void execute(std::function<void()> task);
+
+    [[nodiscard]] std::size_t getThreadCount() const;
+
+    /**
+     * @return the number of submitted tasks that no worker has started yet
+     */
+    [[nodiscard]] std::size_t getQueueDepth() const;
+
 private:
-    void worker();
+    using Job = std::function<void()>;
+
+    struct Worker {
+        WorkStealingDeque<Job> deque;
+        std::thread thread;
+    };
+
+    void worker(std::size_t index);
+    Job *findJob(std::size_t index);
+    [[nodiscard]] bool hasJobs() const;
+    void park();
+    void run(Job *job);
+
+    static constexpr int SpinCount = 64;
 
-    std::vector<std::thread> threads;
-    moodycamel::ConcurrentQueue<std::function<void()>> tasks;
-    std::atomic<bool> done;
-    std::mutex mutex;
-    std::condition_variable condition;
+    ThreadOptions options_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+    moodycamel::ConcurrentQueue<Job *> injected_;
+    std::atomic<bool> done_{false};
+    std::atomic<std::size_t> sleepers_{0};
+    std::atomic<std::size_t> queued_{0};
+    std::mutex mutex_;
+    std::condition_variable condition_;
 };
 
 }  // namespace endstone::detail
@@ -0,0 +1,207 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace endstone::detail {
+
+/**
+ * @brief A hierarchical timing wheel keyed on server ticks.
+ *
+ * Values are kept in four levels of 256 slots each, where a slot of level k spans 256^k ticks. Scheduling takes
+ * constant time: a value is appended to the slot of the lowest level whose window it falls into, and is moved down a
+ * level each time the wheel enters the window of its slot. Values due more than 2^32 ticks ahead wait in an overflow
+ * list. Advancing jumps over empty slots, and slots keep their capacity, so a steady amount of timers does not
+ * allocate.
+ *
+ * @tparam T The type of the scheduled values
+ */
+template <typename T>
+class TimingWheel {
+public:
+    explicit TimingWheel(std::uint64_t tick = 0) : tick_(tick) {}
+
+    /**
+     * Schedules a value to be due at the given tick
+     *
+     * @param value The value to schedule
+     * @param tick The tick the value is due at, values due in the past are due at the next advanced tick
+     */
+    void schedule(T value, std::uint64_t tick)
+    {
+        tick = std::max(tick, tick_);
+        getSlot(tick).push_back({tick, std::move(value)});
+        ++size_;
+    }
+
+    /**
+     * Advances the wheel up to and including the given tick, calling the function with each value that became due
+     *
+     * Values are passed in the order of their ticks, and in the order they were scheduled within a tick. The function
+     * may schedule new values, which are never due before the tick following the one being processed.
+     *
+     * @param tick The last tick to process
+     * @param func The function receiving the due values
+     */
+    template <typename Func>
+    void advance(std::uint64_t tick, Func &&func)
+    {
+        while (tick_ <= tick) {
+            auto current = getNextTick();
+            if (current > tick) {
+                moveTo(tick + 1);
+                break;
+            }
+
+            moveTo(current);
+            due_.swap(slots_[0][current & SlotMask]);
+            moveTo(current + 1);
+            size_ -= due_.size();
+            for (auto &entry : due_) {
+                func(entry.value);
+            }
+            due_.clear();
+        }
+    }
+
+    /**
+     * @return the next tick to be processed by advance
+     */
+    [[nodiscard]] std::uint64_t getTick() const
+    {
+        return tick_;
+    }
+
+    /**
+     * @return the number of scheduled values
+     */
+    [[nodiscard]] std::size_t size() const
+    {
+        return size_;
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return size_ == 0;
+    }
+
+private:
+    struct Entry {
+        std::uint64_t tick;
+        T value;
+    };
+    using Slot = std::vector<Entry>;
+
+    static constexpr std::size_t SlotBits = 8;
+    static constexpr std::size_t SlotCount = 1 << SlotBits;
+    static constexpr std::uint64_t SlotMask = SlotCount - 1;
+    static constexpr std::size_t Levels = 4;
+
+    /**
+     * Gets the first tick from the current one on at which a slot becomes due or has to be cascaded
+     */
+    [[nodiscard]] std::uint64_t getNextTick() const
+    {
+        if (size_ == 0) {
+            return std::numeric_limits<std::uint64_t>::max();
+        }
+        for (std::size_t level = 0; level < Levels; ++level) {
+            auto shift = SlotBits * level;
+            auto index = (tick_ >> shift) & SlotMask;
+            // The current slot of an upper level was cascaded when the wheel entered its window
+            if (level > 0) {
+                ++index;
+            }
+            for (; index < SlotCount; ++index) {
+                if (!slots_[level][index].empty()) {
+                    auto window = (tick_ >> (shift + SlotBits)) << (shift + SlotBits);
+                    return std::max(tick_, window | (index << shift));
+                }
+            }
+        }
+        return ((tick_ >> (SlotBits * Levels)) + 1) << (SlotBits * Levels);
+    }
+
+    Slot &getSlot(std::uint64_t tick)
+    {
+        // Pick the lowest level whose current window contains the tick
+        for (std::size_t level = 0; level < Levels; ++level) {
+            auto shift = SlotBits * level;
+            if (((tick ^ tick_) >> (shift + SlotBits)) == 0) {
+                return slots_[level][(tick >> shift) & SlotMask];
+            }
+        }
+        return overflow_;
+    }
+
+    /**
+     * Moves the wheel to the given tick, cascading the slots of the windows it enters
+     *
+     * The cascade has to happen right away, since values scheduled at the new tick are put into the lower levels of
+     * its windows and would be scanned ahead of the values still waiting in the upper levels.
+     */
+    void moveTo(std::uint64_t tick)
+    {
+        if (tick != tick_) {
+            tick_ = tick;
+            cascade(tick);
+        }
+    }
+
+    void cascade(std::uint64_t tick)
+    {
+        if ((tick & SlotMask) != 0) {
+            return;
+        }
+
+        // The wheel enters new windows on every level whose lower bits of the tick are all zero
+        std::size_t highest = 1;
+        while (highest < Levels && ((tick >> (SlotBits * highest)) & SlotMask) == 0) {
+            ++highest;
+        }
+        if (highest == Levels) {
+            reschedule(overflow_);
+            --highest;
+        }
+        for (auto level = highest; level > 0; --level) {
+            reschedule(slots_[level][(tick >> (SlotBits * level)) & SlotMask]);
+        }
+    }
+
+    void reschedule(Slot &slot)
+    {
+        cascading_.swap(slot);
+        for (auto &entry : cascading_) {
+            getSlot(entry.tick).push_back(std::move(entry));
+        }
+        cascading_.clear();
+    }
+
+    std::array<std::array<Slot, SlotCount>, Levels> slots_{};
+    Slot overflow_;
+    Slot due_;
+    Slot cascading_;
+    std::uint64_t tick_;
+    std::size_t size_{0};
+};
+
+}  // namespace endstone::detail
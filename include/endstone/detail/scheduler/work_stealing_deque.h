@@ -0,0 +1,161 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace endstone::detail {
+
+/**
+ * @brief A Chase-Lev work-stealing deque of pointers.
+ *
+ * The owning thread pushes and pops at the bottom without contention, while any other thread may steal from the top.
+ * The buffer grows on demand; outgrown buffers are kept until the deque is destroyed, as thieves may still read them.
+ *
+ * @tparam T The type of the pointed-to items
+ */
+template <typename T>
+class WorkStealingDeque {
+public:
+    /**
+     * @param capacity The initial capacity, must be a power of two
+     */
+    explicit WorkStealingDeque(std::size_t capacity = 64)
+    {
+        auto buffer = std::make_unique<Buffer>(capacity);
+        buffer_.store(buffer.get(), std::memory_order_relaxed);
+        buffers_.push_back(std::move(buffer));
+    }
+
+    WorkStealingDeque(const WorkStealingDeque &) = delete;
+    WorkStealingDeque &operator=(const WorkStealingDeque &) = delete;
+
+    /**
+     * Pushes an item at the bottom. Must only be called by the owning thread.
+     *
+     * @param item The item to push
+     */
+    void push(T *item)
+    {
+        auto bottom = bottom_.load(std::memory_order_relaxed);
+        auto top = top_.load(std::memory_order_acquire);
+        auto *buffer = buffer_.load(std::memory_order_relaxed);
+        if (bottom - top > static_cast<std::int64_t>(buffer->capacity) - 1) {
+            buffer = grow(buffer, bottom, top);
+        }
+        buffer->put(bottom, item);
+        // A release store rather than a release fence, which thread sanitizers do not model
+        bottom_.store(bottom + 1, std::memory_order_release);
+    }
+
+    /**
+     * Pops the item at the bottom. Must only be called by the owning thread.
+     *
+     * @return the most recently pushed item, or nullptr if the deque is empty
+     */
+    T *pop()
+    {
+        auto bottom = bottom_.load(std::memory_order_relaxed) - 1;
+        auto *buffer = buffer_.load(std::memory_order_relaxed);
+        bottom_.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto top = top_.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        auto *item = buffer->get(bottom);
+        if (top == bottom) {
+            // Last item, race against thieves for it
+            if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                item = nullptr;
+            }
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+
+    /**
+     * Steals the item at the top. May be called by any thread.
+     *
+     * @return the least recently pushed item, or nullptr if the deque is empty or the steal lost a race
+     */
+    T *steal()
+    {
+        auto top = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto bottom = bottom_.load(std::memory_order_acquire);
+        if (top >= bottom) {
+            return nullptr;
+        }
+
+        auto *item = buffer_.load(std::memory_order_acquire)->get(top);
+        if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return item;
+    }
+
+    /**
+     * @return true if the deque looked empty at the time of the call
+     */
+    [[nodiscard]] bool empty() const
+    {
+        return bottom_.load(std::memory_order_relaxed) <= top_.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Buffer {
+        explicit Buffer(std::size_t capacity) : capacity(capacity), items(new std::atomic<T *>[capacity]) {}
+
+        T *get(std::int64_t index) const
+        {
+            return items[static_cast<std::size_t>(index) & (capacity - 1)].load(std::memory_order_relaxed);
+        }
+
+        void put(std::int64_t index, T *item)
+        {
+            items[static_cast<std::size_t>(index) & (capacity - 1)].store(item, std::memory_order_relaxed);
+        }
+
+        std::size_t capacity;
+        std::unique_ptr<std::atomic<T *>[]> items;
+    };
+
+    Buffer *grow(Buffer *buffer, std::int64_t bottom, std::int64_t top)
+    {
+        auto grown = std::make_unique<Buffer>(buffer->capacity * 2);
+        for (auto i = top; i < bottom; ++i) {
+            grown->put(i, buffer->get(i));
+        }
+        buffer = grown.get();
+        buffers_.push_back(std::move(grown));
+        buffer_.store(buffer, std::memory_order_release);
+        return buffer;
+    }
+
+    std::atomic<std::int64_t> top_{0};
+    std::atomic<std::int64_t> bottom_{0};
+    std::atomic<Buffer *> buffer_{nullptr};
+    std::vector<std::unique_ptr<Buffer>> buffers_;
+};
+
+}  // namespace endstone::detail
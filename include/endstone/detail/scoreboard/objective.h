@@ -46,11 +46,12 @@ public:
     [[nodiscard]] std::optional<RenderType> getRenderType() const override;
     void setRenderType(RenderType render_type) override;
     [[nodiscard]] std::unique_ptr<Score> getScore(ScoreEntry entry) const override;
+    [[nodiscard]] std::vector<std::unique_ptr<Score>> getTopScores(std::size_t count) const override;
+    [[nodiscard]] std::optional<std::size_t> getRank(ScoreEntry entry) const override;
     bool operator==(const Objective &other) const override;
     bool operator!=(const Objective &other) const override;
 
     [[nodiscard]] bool checkState() const;
-    [[nodiscard]] std::unique_ptr<EndstoneObjective> copy() const;
 
 private:
     friend class EndstoneScore;
@@ -0,0 +1,95 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <random>
+#include <unordered_map>
+#include <utility>
+
+namespace endstone::detail {
+
+/**
+ * @brief The scores of an objective kept in order, so the highest ones and the rank of one are read without sorting
+ * them all.
+ *
+ * Scores are keyed by the raw scoreboard id of their identity and held in a treap that counts the scores below each
+ * node, so a change and a rank cost logarithmic time and reading k scores costs O(k + log n). A full sync between
+ * beginSync and endSync drops the scores that were not set again.
+ */
+class RankedScores {
+public:
+    RankedScores();
+    ~RankedScores();
+    RankedScores(RankedScores &&) noexcept;
+    RankedScores &operator=(RankedScores &&) noexcept;
+
+    void set(std::int64_t id, int score);
+    void remove(std::int64_t id);
+
+    void beginSync();
+    void endSync();
+
+    /**
+     * @brief Calls the callback with the scores from the highest to the lowest, until it returns false.
+     *
+     * Equal scores are ordered by the id, the highest first.
+     */
+    void forEachDescending(const std::function<bool(std::int64_t id, int score)> &callback) const;
+
+    /**
+     * @brief Gets the position of a score from the highest one, which is ranked 1.
+     *
+     * @return The rank, or nullopt if there is no score for the id
+     */
+    [[nodiscard]] std::optional<std::size_t> getRank(std::int64_t id) const;
+
+    [[nodiscard]] std::size_t size() const;
+
+private:
+    using Key = std::pair<int, std::int64_t>;
+
+    struct Node {
+        Key key;
+        std::uint32_t priority;
+        std::size_t size = 1;
+        std::unique_ptr<Node> left;
+        std::unique_ptr<Node> right;
+    };
+
+    struct Entry {
+        int score;
+        std::uint32_t generation;
+    };
+
+    static std::size_t sizeOf(const std::unique_ptr<Node> &node);
+    static void update(Node &node);
+    static std::pair<std::unique_ptr<Node>, std::unique_ptr<Node>> split(std::unique_ptr<Node> node, const Key &key);
+    static std::unique_ptr<Node> merge(std::unique_ptr<Node> left, std::unique_ptr<Node> right);
+    void insert(const Key &key);
+    void erase(const Key &key);
+    static void erase(std::unique_ptr<Node> &node, const Key &key);
+
+    std::unique_ptr<Node> root_;
+    std::unordered_map<std::int64_t, Entry> entries_;
+    std::uint32_t generation_ = 0;
+    std::minstd_rand random_;
+};
+
+}  // namespace endstone::detail
@@ -14,22 +14,23 @@
 
 #pragma once
 
-#include <memory>
-
 #include "bedrock/world/scores/scoreboard_id.h"
+#include "endstone/detail/scoreboard/objective.h"
 #include "endstone/scoreboard/score.h"
 #include "endstone/scoreboard/score_entry.h"
 
 namespace endstone::detail {
 
-class EndstoneObjective;
+class EndstonePlayer;
 
 class EndstoneScore : public Score {
 public:
-    EndstoneScore(std::unique_ptr<EndstoneObjective> objective, ScoreEntry entry);
+    EndstoneScore(EndstoneObjective objective, ScoreEntry entry);
     [[nodiscard]] ScoreEntry getEntry() const override;
     [[nodiscard]] int getValue() const override;
     void setValue(int score) override;
+    void setViewerValue(Player &viewer, int score) override;
+    void resetViewerValue(Player &viewer) override;
     [[nodiscard]] bool isScoreSet() const override;
     [[nodiscard]] Objective &getObjective() const override;
     [[nodiscard]] Scoreboard &getScoreboard() const override;
@@ -37,8 +38,9 @@ public:
 private:
     [[nodiscard]] const ScoreboardId &getScoreboardId() const;
     [[nodiscard]] const ScoreboardId &getOrCreateScoreboardId() ;
+    [[nodiscard]] EndstonePlayer *getViewer(Player &player) const;
 
-    std::unique_ptr<EndstoneObjective> objective_;
+    EndstoneObjective objective_;
     ScoreEntry entry_;
 };
 
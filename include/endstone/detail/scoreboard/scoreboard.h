@@ -14,18 +14,28 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstddef>
 #include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "bedrock/world/scores/scoreboard.h"
+#include "endstone/detail/scoreboard/ranked_scores.h"
 #include "endstone/detail/scoreboard/scoreboard_packet_sender.h"
 #include "endstone/scoreboard/scoreboard.h"
 
 namespace endstone::detail {
 
+class EndstonePlayer;
+
 class EndstoneScoreboard : public Scoreboard {
 public:
     explicit EndstoneScoreboard(::Scoreboard &board);
     explicit EndstoneScoreboard(std::unique_ptr<::Scoreboard> board);
+    ~EndstoneScoreboard() override;
     void init();
 
     std::unique_ptr<Objective> addObjective(std::string name, Criteria::Type criteria) override;
@@ -39,23 +49,90 @@ public:
     [[nodiscard]] std::vector<std::unique_ptr<Objective>> getObjectivesByCriteria(
         Criteria::Type criteria) const override;
     [[nodiscard]] std::vector<std::unique_ptr<Score>> getScores(ScoreEntry entry) const override;
+    void forEachObjective(const std::function<void(Objective &)> &callback) const override;
+    void forEachScore(ScoreEntry entry, const std::function<void(Score &)> &callback) const override;
     void resetScores(ScoreEntry entry) override;
     [[nodiscard]] std::vector<ScoreEntry> getEntries() const override;
     void clearSlot(DisplaySlot slot) override;
     [[nodiscard]] const ::ScoreboardId &getScoreboardId(ScoreEntry entry) const;
     const ::ScoreboardId &getOrCreateScoreboardId(ScoreEntry entry);
     [[nodiscard]] ::Scoreboard &getHandle() const;
+    [[nodiscard]] ScoreboardPacketSender &getPacketSender() const;
+
+    /**
+     * @brief Queues a score change made through the API, to be sent to the viewers on the next flush.
+     */
+    void queueScoreChange(const ::ScoreboardId &id, const ::Objective &objective);
+
+    /**
+     * @brief Overrides the score shown to a single viewer, or removes its override when no score is given.
+     */
+    void setViewerScore(const EndstonePlayer &viewer, const ::ScoreboardId &id, const ::Objective &objective,
+                        std::optional<int> score);
+
+    /**
+     * @brief Drops the score overrides of a viewer that stopped viewing this scoreboard.
+     */
+    void clearViewerScores(const EndstonePlayer &viewer);
+
+    /**
+     * @brief Sends the queued score changes that differ from what the viewers were last sent, as a single packet.
+     */
+    void flushScores();
+
+    /**
+     * @brief Forgets the scores last sent to the viewers, after packets the flush did not build were sent to them.
+     */
+    void invalidateSentScores();
+
+    /**
+     * @brief Gets the highest scores of an objective, from a ranking kept up to date as the scores change.
+     */
+    [[nodiscard]] std::vector<std::unique_ptr<Score>> getTopScores(::Objective &objective, std::size_t count);
+
+    /**
+     * @brief Gets the rank of an entry in an objective, from the same ranking as getTopScores.
+     */
+    [[nodiscard]] std::optional<std::size_t> getRank(const ::Objective &objective, ScoreEntry entry);
 
     static std::string getCriteriaName(Criteria::Type type);
+
+    // Changes made outside of the API, such as by commands, reach the rankings when they are synced again
+    static constexpr std::chrono::seconds RankingSyncInterval{1};
     static std::string getDisplaySlotName(DisplaySlot slot);
 
 private:
     friend class EndstoneObjective;
     friend class EndstoneScore;
 
+    using ScoreSet = std::unordered_map<std::string, std::unordered_set<::ScoreboardId>>;
+    using ScoreValues = std::unordered_map<std::string, std::unordered_map<::ScoreboardId, int>>;
+
+    struct ViewerScores {
+        ScoreValues scores;
+        ScoreSet reset;  // Overrides removed since the last flush
+        bool dirty{false};
+    };
+
+    struct Ranking {
+        const ::Objective *objective{nullptr};
+        std::chrono::steady_clock::time_point synced;
+        RankedScores scores;
+    };
+
+    [[nodiscard]] std::size_t getFootprint() const;
+    RankedScores &getRanking(const ::Objective &objective);
+    void sendSharedScores(const ScoreSet &pending);
+    void sendViewerScores(const EndstonePlayer &viewer, ViewerScores &viewer_scores);
+
     ::Scoreboard &board_;
     std::unique_ptr<::Scoreboard> holder_;
     std::unique_ptr<ScoreboardPacketSender> packet_sender_;
+    ScoreSet pending_scores_;
+    ScoreValues sent_scores_;
+    std::unordered_map<const EndstonePlayer *, ViewerScores> viewer_scores_;
+    bool viewer_scores_stale_{false};
+    std::unordered_map<std::string, Ranking> rankings_;
 };
 
 }  // namespace endstone::detail
@@ -14,10 +14,16 @@
 
 #pragma once
 
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 #include "bedrock/network/packet_sender.h"
 
 namespace endstone::detail {
 
+class EndstonePlayer;
 class EndstoneScoreboard;
 class EndstoneServer;
 
@@ -34,10 +40,27 @@ public:
     void sendBroadcast(const NetworkIdentifier &, SubClientId, const ::Packet &) override;
     void flush(const NetworkIdentifier &, std::function<void()> &&) override;
 
+    void addViewer(const EndstonePlayer &player);
+    void removeViewer(const EndstonePlayer &player);
+    void sendToViewer(const EndstonePlayer &player, const ::Packet &packet);
+    void sendToViewers(const ::Packet &packet);
+    void setSuppressed(bool suppressed);
+
 private:
+    struct ViewerHash {
+        std::size_t operator()(const NetworkIdentifierWithSubId &viewer) const;
+    };
+    struct ViewerEqual {
+        bool operator()(const NetworkIdentifierWithSubId &lhs, const NetworkIdentifierWithSubId &rhs) const;
+    };
+
     EndstoneServer &server_;
     EndstoneScoreboard &scoreboard_;
     PacketSender &sender_;
+    std::unordered_set<NetworkIdentifierWithSubId, ViewerHash, ViewerEqual> viewers_;
+    std::unordered_map<const EndstonePlayer *, NetworkIdentifierWithSubId> viewer_ids_;
+    std::optional<std::vector<NetworkIdentifierWithSubId>> broadcast_targets_;  // Rebuilt after the viewers change
+    bool suppressed_{false};
 };
 
 }  // namespace endstone::detail
@@ -0,0 +1,95 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+namespace endstone::detail {
+
+/**
+ * @brief Publishes a value written by one thread to readers on any thread, without ever blocking the writer.
+ *
+ * The writer bumps a sequence number to odd, stores the value, then bumps it back to even. Readers copy the value and
+ * retry if the sequence number was odd or changed meanwhile, so they only ever see a whole value. The value is stored
+ * as relaxed atomic words, which makes the copy a torn read at worst instead of a data race.
+ */
+template <typename T>
+class Seqlock {
+    static_assert(std::is_trivially_copyable_v<T>, "values are copied word by word");
+
+public:
+    Seqlock() : Seqlock(T{}) {}
+
+    explicit Seqlock(const T &value)
+    {
+        store(value);
+    }
+
+    /**
+     * @brief Publishes a new value. Only one thread may store at a time.
+     */
+    void store(const T &value) noexcept
+    {
+        Words words{};
+        std::memcpy(words.data(), &value, sizeof(T));
+
+        const auto seq = seq_.load(std::memory_order_relaxed);
+        seq_.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (std::size_t i = 0; i < WordCount; ++i) {
+            words_[i].store(words[i], std::memory_order_relaxed);
+        }
+        seq_.store(seq + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Gets the last value published, from any thread.
+     */
+    [[nodiscard]] T load() const noexcept
+    {
+        Words words{};
+        while (true) {
+            const auto before = seq_.load(std::memory_order_acquire);
+            if (before & 1) {
+                std::this_thread::yield();
+                continue;
+            }
+            for (std::size_t i = 0; i < WordCount; ++i) {
+                words[i] = words_[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (seq_.load(std::memory_order_relaxed) == before) {
+                break;
+            }
+        }
+        T value;
+        std::memcpy(&value, words.data(), sizeof(T));
+        return value;
+    }
+
+private:
+    static constexpr std::size_t WordCount = (sizeof(T) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+    using Words = std::array<std::uint64_t, WordCount>;
+
+    std::atomic<std::uint64_t> seq_{0};
+    std::array<std::atomic<std::uint64_t>, WordCount> words_{};
+};
+
+}  // namespace endstone::detail
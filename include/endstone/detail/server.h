@@ -14,23 +14,59 @@
 
 #pragma once
 
+#include <array>
 #include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
+#include "bedrock/network/compressibility.h"
 #include "bedrock/server/server_instance.h"
 #include "endstone/command/console_command_sender.h"
 #include "endstone/detail/command/command_map.h"
+#include "endstone/detail/console/console_reader.h"
+#include "endstone/detail/idle_throttle.h"
+#include "endstone/detail/join_storm.h"
+#include "endstone/detail/join_timings.h"
+#include "endstone/detail/level/view_distance_controller.h"
+#include "endstone/detail/messaging/messenger.h"
+#include "endstone/detail/metrics/metrics_server.h"
+#include "endstone/detail/movement_tracker.h"
+#include "endstone/detail/network/compression_controller.h"
+#include "endstone/detail/network/packet_cache.h"
+#include "endstone/detail/network/packet_interceptor.h"
+#include "endstone/detail/persistence/player_data_store.h"
 #include "endstone/detail/plugin/plugin_manager.h"
+#include "endstone/detail/rcon/rcon_server.h"
+#include "endstone/detail/replay_recorder.h"
 #include "endstone/detail/scheduler/scheduler.h"
+#include "endstone/detail/scheduler/timing_wheel.h"
 #include "endstone/detail/scoreboard/scoreboard.h"
+#include "endstone/detail/skin_data_pool.h"
+#include "endstone/detail/tick_arena.h"
+#include "endstone/detail/tick_clock.h"
+#include "endstone/detail/tick_history.h"
+#include "endstone/detail/tick_percentiles.h"
+#include "endstone/detail/translation_cache.h"
+#include "endstone/event/async_monitor.h"
 #include "endstone/level/level.h"
 #include "endstone/plugin/plugin_manager.h"
 #include "endstone/server.h"
 
 namespace endstone::detail {
 
+class EndstoneBossBar;
+
 class EndstoneServer : public Server {
 public:
     explicit EndstoneServer(ServerInstance &server_instance);
@@ -59,15 +95,24 @@ public:
     void disablePlugins() const;
 
     [[nodiscard]] Scheduler &getScheduler() const override;
+    [[nodiscard]] PlayerDataStore &getPlayerDataStore() const override;
+    [[nodiscard]] Messenger &getMessenger() const override;
+    [[nodiscard]] EndstonePacketInterceptor &getPacketInterceptor() const override;
+    [[nodiscard]] PacketPriority getPacketPriority(int packet_id) const override;
+    void setPacketPriority(int packet_id, PacketPriority priority) override;
 
     [[nodiscard]] Level *getLevel() const override;
     void setLevel(std::unique_ptr<EndstoneLevel> level);
+    [[nodiscard]] int getBlockTypeId(std::string_view type) const override;
 
-    [[nodiscard]] std::vector<Player *> getOnlinePlayers() const override;
+    [[nodiscard]] const std::vector<Player *> &getOnlinePlayers() const override;
     [[nodiscard]] int getMaxPlayers() const override;
     void setMaxPlayers(int max_players) override;
     [[nodiscard]] Player *getPlayer(endstone::UUID id) const override;
     [[nodiscard]] Player *getPlayer(std::string name) const override;
+    [[nodiscard]] Player *getPlayerByXuid(const std::string &xuid) const override;
+    [[nodiscard]] Player *getPlayerByRuntimeId(std::uint64_t runtime_id) const override;
+    [[nodiscard]] std::vector<Player *> getMovementAnomalies(float max_speed, float max_acceleration) const override;
 
     void shutdown() override;
     void reload() override;
@@ -75,6 +120,10 @@ public:
 
     void broadcast(const std::string &message, const std::string &permission) const override;
     void broadcastMessage(const std::string &message) const override;
+    void broadcastPacket(Packet &packet, const std::vector<Player *> &recipients) const override;
+    void broadcastPacket(Packet &packet, const std::function<bool(const Player &)> &predicate) const override;
+    [[nodiscard]] std::string translate(const Translatable &message, const std::string &locale) const override;
+    void sendTranslated(const Translatable &message, const std::vector<Player *> &recipients) const override;
 
     [[nodiscard]] bool isPrimaryThread() const override;
 
@@ -87,44 +136,221 @@ public:
     float getAverageTicksPerSecond() override;
     float getCurrentTickUsage() override;
     float getAverageTickUsage() override;
+    [[nodiscard]] TickStatistics getTickStatistics(TickWindow window) const override;
+    [[nodiscard]] std::uint64_t getWallClockTick() const override;
     [[nodiscard]] std::chrono::system_clock::time_point getStartTime() override;
+    void setTickConsistentActorReads(bool value) override;
+    [[nodiscard]] bool isTickConsistentActorReads() const override;
+    void setPlayerMoveThresholds(float distance, float rotation) override;
+    [[nodiscard]] float getPlayerMoveDistanceThreshold() const override;
+    [[nodiscard]] float getPlayerMoveRotationThreshold() const override;
     [[nodiscard]] std::unique_ptr<BossBar> createBossBar(std::string title, BarColor color, BarStyle style) const override;
     [[nodiscard]] std::unique_ptr<BossBar> createBossBar(std::string title, BarColor color, BarStyle style,
                                                          std::vector<BarFlag> flags) const override;
 
     [[nodiscard]] EndstoneScoreboard &getPlayerBoard(const EndstonePlayer &player) const;
     void setPlayerBoard(EndstonePlayer &player, Scoreboard &scoreboard);
+    void addPlayerBoard(EndstonePlayer &player);
     void removePlayerBoard(EndstonePlayer &player);
+    void addDirtyBossBar(EndstoneBossBar &boss_bar);
+    void scheduleFormTimeout(const EndstonePlayer &player, int form_id);
+    [[nodiscard]] std::size_t getOpenFormCount() const;
+    void removeDirtyBossBar(EndstoneBossBar &boss_bar);
     [[nodiscard]] ::ServerNetworkHandler &getServerNetworkHandler() const;
-    void tick(std::uint64_t current_tick, const std::function<void()> &tick_function);
+    void tick(std::uint64_t level_tick, const std::function<void()> &tick_function);
+    [[nodiscard]] const TickHistory &getTickHistory() const;
+    [[nodiscard]] JoinTimings &getJoinTimings();
+
+    /**
+     * @brief Gets the recorder of the inputs of the server, started by ENDSTONE_REPLAY_RECORD=<path>.
+     *
+     * @return The recorder, or nullptr if the server is not recording
+     */
+    [[nodiscard]] ReplayRecorder *getReplayRecorder() const;
+
+    /**
+     * @brief Records a player join, starting a join storm once JoinStormThreshold players joined within
+     * JoinStormWindowTicks.
+     */
+    void onPlayerJoin();
+
+    /**
+     * @brief Sends the commands to a player now, or during a join storm, queues them with the command updates spread
+     * over the next ticks, where players with the same permissions share a packet.
+     */
+    void requestCommandUpdate(const EndstonePlayer &player);
+
+    /**
+     * @brief Reloads a single plugin without touching the other plugins, then sends the commands again to the
+     * players who could use the commands of the plugin before or after the reload.
+     *
+     * @return the new instance of the plugin, or nullptr if it could not be loaded again
+     */
+    Plugin *reloadPlugin(Plugin &plugin);
+
+    /**
+     * @brief Dispatches AsyncPlayerChatEvent on the CPU workers, then calls deliver on the server thread with the
+     * final message unless a handler cancelled it.
+     *
+     * Messages are delivered in batches once per tick, in the order they were submitted.
+     */
+    void submitAsyncChat(const EndstonePlayer &player, std::string message,
+                         std::function<void(std::string)> deliver);
+    /**
+     * @brief Gets the current Endstone tick, which advances on every tick, including the ones the idle throttle skips
+     * the level on.
+     */
+    [[nodiscard]] std::uint64_t getCurrentTick() const;
+
+    /**
+     * @brief Gets the arena for the temporaries of the current tick, reset once the level has ticked.
+     */
+    [[nodiscard]] TickArena &getTickArena();
+
+    /**
+     * @brief Gets the serialised crafting data sent to joining players, cleared when the data is reloaded or a plugin
+     * is enabled.
+     */
+    [[nodiscard]] PacketCache &getCraftingDataCache();
+
+    /**
+     * @brief Gets the cap the adaptive view distance puts on the view distance of every player, if any.
+     */
+    [[nodiscard]] std::optional<int> getViewDistanceCap() const;
+
+    /**
+     * @brief Gets whether the packets sent by the API with the given id are compressed, from their average size.
+     */
+    [[nodiscard]] Compressibility getCompressibility(int packet_id) const;
+
+    /**
+     * @brief Starts the movement history of a player over, after it was teleported.
+     */
+    void resetMovement(const EndstonePlayer &player);
+
+    /**
+     * @brief Forgets whether an actor removed from the world was hidden from, or culled for, each player.
+     */
+    void onActorRemoved(std::uint64_t runtime_id);
 
     static constexpr int TargetTicksPerSecond = 20;
     static constexpr int TargetMillisecondsPerTick = 1000 / TargetTicksPerSecond;
+    static constexpr int CommandUpdatesPerTick = 20;
+    static constexpr std::size_t JoinStormThreshold = 20;
+    static constexpr std::uint64_t JoinStormWindowTicks = 5 * TargetTicksPerSecond;
+    static constexpr std::uint64_t ActorVisibilityIntervalTicks = 5;
+    static constexpr std::uint64_t DefaultIdleAfterTicks = 60 * TargetTicksPerSecond;
+    static constexpr std::chrono::milliseconds PluginWorkTimeout{2500};  // For the async work of a reloaded plugin
 
 private:
     friend class EndstonePlayer;
 
     void enablePlugin(Plugin &plugin);
+    void startMetricsServer(const std::string &address);
+    void startRconServer(const std::string &address);
+    void startMulticastMessaging(const std::string &address);
+    void updateMetrics(std::uint64_t current_tick, std::chrono::steady_clock::duration tick_duration);
+    void flushScoreboards();
+    void flushBossBars();
+    void updatePendingCommands();
+    void runDeferredCommands(std::uint64_t current_tick);
+    void runRconCommands();
+    void expireForms(std::uint64_t current_tick);
+    void dispatchPlayerMoves();
+    [[nodiscard]] bool hasMoved(const Location &from, const Location &to) const;
+    void dispatchPlayerRegions();
+    void tickPregeneration();
+    void tickInventories();
+    void tickViewDistance();
+    void tickCompression();
+    void tickMovement();
+    void publishPlayerSnapshots();
+    void tickActorVisibility();
+    void tickOutboundShaping();
+    void collectAsyncChat();
+    bool awaitAsyncChat(std::chrono::steady_clock::time_point deadline);
+    void deliverAsyncChat();
+    void addPlayer(EndstonePlayer &player);
+    void removePlayer(EndstonePlayer &player);
+    void handOffPlayer(const EndstonePlayer &player, const std::string &server_id);
+    void receivePlayerHandoff(const std::string &message);
+    static std::string foldPlayerName(std::string name);
+    static std::string resolveTranslation(const std::string &key, const std::vector<std::string> &params,
+                                          const std::string &locale);
+
     ServerInstance &server_instance_;
     Logger &logger_;
     std::unique_ptr<EndstoneCommandMap> command_map_;
     std::unique_ptr<EndstonePluginManager> plugin_manager_;
     std::unique_ptr<ConsoleCommandSender> command_sender_;
     std::unique_ptr<EndstoneScheduler> scheduler_;
+    std::unique_ptr<EndstonePlayerDataStore> player_data_store_;
+    std::unique_ptr<EndstoneMessenger> messenger_;
+    std::unique_ptr<EndstonePacketInterceptor> packet_interceptor_;
+    std::array<PacketPriority, EndstonePacketInterceptor::PacketIdCount> packet_priorities_;
     std::unique_ptr<EndstoneLevel> level_;
     std::unordered_map<UUID, Player *> players_;
+    std::vector<Player *> online_players_;
+    std::unordered_map<std::string, Player *> player_names_;
+    std::unordered_map<std::string, Player *> player_xuids_;
+    std::unordered_map<std::uint64_t, Player *> player_runtime_ids_;
     std::shared_ptr<EndstoneScoreboard> scoreboard_;
     std::vector<std::weak_ptr<EndstoneScoreboard>> scoreboards_;
     std::unordered_map<const EndstonePlayer *, std::shared_ptr<EndstoneScoreboard>> player_boards_;
+    std::unordered_set<EndstoneBossBar *> dirty_boss_bars_;
+    std::deque<UUID> pending_command_updates_;
+    JoinStorm join_storm_{JoinStormThreshold, JoinStormWindowTicks};
+    IdleThrottle idle_throttle_{1, DefaultIdleAfterTicks};
+    std::optional<ViewDistanceController> view_distance_controller_;
+    std::optional<CompressionController> compression_controller_;
+    MovementTracker movement_tracker_;
+    TickArena tick_arena_;
+    std::vector<Player *> movement_players_;  // The player of each slot of the movement tracker
+
+    struct AsyncChatResult {
+        std::uint64_t id;
+        std::optional<std::string> message;  // nullopt if cancelled
+    };
+    struct PendingChat {
+        std::function<void(std::string)> deliver;
+        std::optional<AsyncChatResult> result;
+    };
+    std::uint64_t next_chat_id_ = 0;
+    std::map<std::uint64_t, PendingChat> pending_chats_;  // Touched on the server thread only, ordered by id
+    std::shared_ptr<BatchQueue<AsyncChatResult>> chat_results_ = std::make_shared<BatchQueue<AsyncChatResult>>();
+    TimingWheel<std::pair<UUID, int>> form_timeouts_;
+    SkinDataPool skin_data_pool_;
+    PacketCache crafting_data_cache_;
+    mutable std::mutex translation_mutex_;
+    mutable TranslationCache translation_cache_{&EndstoneServer::resolveTranslation};
+    std::unordered_map<const Player *, Location> move_origins_;
+    struct RegionMembership {
+        const Dimension *dimension;
+        std::vector<std::string> regions;
+    };
+    std::unordered_map<const Player *, RegionMembership> region_memberships_;
     std::chrono::system_clock::time_point start_time_;
 
     int tick_counter_ = 0;
+    std::uint64_t current_tick_ = 0;
+    TickClock tick_clock_;
+    bool wall_clock_timers_ = false;
+    bool tick_consistent_actor_reads_ = false;
+    float move_distance_threshold_ = 1.0F / 16;
+    float move_rotation_threshold_ = 10.0F;
     float current_mspt_ = TargetMillisecondsPerTick * 1.0F;
     float average_mspt_[TargetTicksPerSecond] = {TargetMillisecondsPerTick};
     float current_tps_ = TargetTicksPerSecond * 1.0F;
     float average_tps_[TargetTicksPerSecond] = {TargetTicksPerSecond};
     float current_usage_ = 0.0F;
     float average_usage_[TargetTicksPerSecond] = {0.0F};
+    TickHistory tick_history_;
+    TickPercentiles tick_percentiles_;
+    JoinTimings join_timings_;
+    std::unique_ptr<MetricsServer> metrics_server_;
+    std::unique_ptr<ConsoleReader> console_reader_;
+    std::unique_ptr<RconServer> rcon_server_;
+    std::unique_ptr<ReplayRecorder> replay_recorder_;
 };
 
 }  // namespace endstone::detail
@@ -14,16 +14,20 @@
 
 #pragma once
 
+#include <chrono>
 #include <iostream>
 
 #include <cpptrace/cpptrace.hpp>
 #include <fmt/format.h>
 
+#include "endstone/detail/logger_factory.h"
 #include "endstone/detail/os.h"
 #include "endstone/endstone.h"
 
 namespace endstone::detail {
 
+inline constexpr std::chrono::milliseconds CrashLogFlushTimeout{500};
+
 inline void print_frame(std::ostream &stream, bool color, unsigned frame_number_width, std::size_t counter,
                         const cpptrace::stacktrace_frame &frame)
 {
@@ -56,6 +60,9 @@ inline void print_frame(std::ostream &stream, bool color, unsigned frame_number_
 
 inline void print_crash_dump(const std::string &message, std::size_t skip = 0)
 {
+    // The messages still queued for the log writer come first, std::quick_exit would discard them
+    LoggerFactory::flush(CrashLogFlushTimeout);
+
     printf("=== ENDSTONE CRASHED! - PLEASE REPORT THIS AS AN ISSUE ON GITHUB ===\n");
     printf("Operation system: %s\n", os::get_name().c_str());
     printf("Endstone version: %s\n", ENDSTONE_VERSION);
@@ -0,0 +1,49 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace endstone::detail {
+
+/**
+ * @brief Deduplicates skin and cape pixels by content, players wearing the same skin share one buffer.
+ *
+ * The pool only holds weak references, a buffer is freed as soon as the last skin using it is gone.
+ */
+class SkinDataPool {
+public:
+    [[nodiscard]] std::shared_ptr<const std::string> intern(std::string data);
+
+    /**
+     * @return the number of distinct buffers still alive
+     */
+    [[nodiscard]] std::size_t size() const;
+
+private:
+    static constexpr std::size_t MinPurgeThreshold = 64;
+
+    void purge();
+
+    mutable std::mutex mutex_;
+    std::unordered_multimap<std::size_t, std::weak_ptr<const std::string>> buffers_;
+    std::size_t purge_threshold_ = MinPurgeThreshold;
+};
+
+}  // namespace endstone::detail
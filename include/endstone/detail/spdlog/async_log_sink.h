@@ -0,0 +1,145 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <spdlog/details/log_msg.h>
+#include <spdlog/sinks/sink.h>
+#include <spdlog/spdlog.h>
+
+namespace endstone::detail {
+
+/**
+ * @brief What happens to a message logged while the queue of an AsyncLogSink is full.
+ */
+enum class LogOverflowPolicy {
+    /**
+     * Wait for the writer thread to make room, no message is lost.
+     */
+    Block,
+    /**
+     * Drop the message without waiting.
+     */
+    Drop,
+    /**
+     * Keep one in every sample rate messages by waiting for room, drop the others.
+     */
+    Sample,
+};
+
+/**
+ * @brief A sink that queues messages in a bounded lock-free ring buffer and writes them to its sinks in batches from a
+ * dedicated writer thread.
+ *
+ * Logging copies the message into a preallocated slot, so no formatting or I/O happens on the logging thread and,
+ * once the slots have grown to fit the longest messages, no allocation either. The sinks are flushed once per batch,
+ * or at most once per flush interval when one is set.
+ */
+class AsyncLogSink final : public spdlog::sinks::sink {
+public:
+    static constexpr std::size_t DefaultCapacity = 8192;
+    static constexpr std::size_t DefaultSampleRate = 100;
+
+    /**
+     * @param sinks The sinks the writer thread writes to
+     * @param capacity The number of messages that can be queued, rounded up to a power of two
+     * @param policy What happens to messages logged while the queue is full
+     */
+    explicit AsyncLogSink(std::vector<spdlog::sink_ptr> sinks, std::size_t capacity = DefaultCapacity,
+                          LogOverflowPolicy policy = LogOverflowPolicy::Block);
+    ~AsyncLogSink() override;
+    AsyncLogSink(const AsyncLogSink &) = delete;
+    AsyncLogSink &operator=(const AsyncLogSink &) = delete;
+
+    void log(const spdlog::details::log_msg &msg) override;
+    /**
+     * Waits until every message queued so far is written, then flushes the sinks.
+     */
+    void flush() override;
+    /**
+     * Like flush, but gives up after the timeout, for a process that is about to end without running destructors.
+     *
+     * @return false if the messages were not written in time
+     */
+    bool flushFor(std::chrono::milliseconds timeout);
+    void set_pattern(const std::string &pattern) override;
+    void set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter) override;
+
+    void setOverflowPolicy(LogOverflowPolicy policy);
+    [[nodiscard]] LogOverflowPolicy getOverflowPolicy() const;
+    void setSampleRate(std::size_t rate);
+    /**
+     * Sets the minimum time between two flushes of the sinks, batches written in between are flushed together.
+     *
+     * Zero, the default, flushes after every batch. Explicit calls to flush are never delayed.
+     */
+    void setFlushInterval(std::chrono::milliseconds interval);
+    [[nodiscard]] std::size_t getCapacity() const;
+    /**
+     * Gets the number of messages dropped because the queue was full.
+     */
+    [[nodiscard]] std::size_t getDroppedCount() const;
+
+private:
+    struct Slot {
+        std::atomic<std::size_t> sequence;
+        spdlog::level::level_enum level;
+        spdlog::log_clock::time_point time;
+        std::size_t thread_id;
+        spdlog::source_loc source;
+        std::size_t name_size;
+        // The logger name followed by the payload, reused across messages
+        spdlog::memory_buf_t buffer;
+    };
+
+    bool tryPush(const spdlog::details::log_msg &msg);
+    void push(const spdlog::details::log_msg &msg);
+    std::size_t writeBatch();
+    void write(const spdlog::details::log_msg &msg);
+    void reportDropped();
+    void wakeWriter();
+    void run();
+
+    std::vector<spdlog::sink_ptr> sinks_;
+    std::unique_ptr<Slot[]> slots_;
+    std::size_t mask_;
+    alignas(64) std::atomic<std::size_t> enqueue_pos_{0};
+    alignas(64) std::size_t dequeue_pos_{0};
+    std::atomic<LogOverflowPolicy> policy_;
+    std::atomic<std::size_t> sample_rate_{DefaultSampleRate};
+    std::atomic<std::chrono::milliseconds> flush_interval_{std::chrono::milliseconds::zero()};
+    std::atomic<std::size_t> overflowed_{0};
+    std::atomic<std::size_t> dropped_{0};
+    std::size_t reported_dropped_{0};
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable flushed_;
+    std::atomic<bool> waiting_{false};
+    bool stopping_{false};
+    std::size_t flush_requested_{0};
+    std::size_t flush_completed_{0};
+    std::thread writer_;
+};
+
+}  // namespace endstone::detail
@@ -15,6 +15,9 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
+#include <functional>
+#include <string>
 #include <string_view>
 
 #include <spdlog/details/console_globals.h>
@@ -28,6 +31,26 @@ class ConsoleLogSink : public spdlog::sinks::base_sink<spdlog::details::console_
 public:
     explicit ConsoleLogSink(FILE *target_file, spdlog::color_mode mode = spdlog::color_mode::automatic);
     void setColorMode(spdlog::color_mode mode);
+    /**
+     * Sets whether the target file is flushed after every message, disable it when the caller flushes in batches.
+     *
+     * Without auto flush, messages are kept in a buffer and written to the target file in a single write on flush.
+     */
+    void setAutoFlush(bool auto_flush);
+    /**
+     * Sets the line being typed in the console, which is erased before and drawn again after every write.
+     *
+     * @param render Returns the line as it should be drawn, called on the thread that flushes, or nullptr for none
+     */
+    void setInputLine(std::function<std::string()> render);
+    /**
+     * Writes what is buffered and draws the line being typed again, or erases it once the input line is unset.
+     */
+    void redrawInputLine();
+    /**
+     * Buffers a completed input line, so it is kept above the next drawing of the line being typed.
+     */
+    void echo(std::string_view line);
 
 protected:
     void sink_it_(const spdlog::details::log_msg &msg) override;
@@ -70,12 +93,20 @@ public:
     const spdlog::string_view_t bold_on_red = "\033[1m\033[41m";
 
 private:
+    void writeBuffer();
     void printColorCode(const spdlog::string_view_t &color_code);
     void printRange(const spdlog::memory_buf_t &formatted, std::size_t start, std::size_t end);
     static std::string toString(const spdlog::string_view_t &sv);
 
+    // Buffered messages are written early once they reach this size
+    static constexpr std::size_t MaxBufferSize = 64 * 1024;
+
     FILE *target_file_;
     bool should_do_colors_;
+    bool auto_flush_ = true;
+    spdlog::memory_buf_t buffer_;
+    std::function<std::string()> input_line_;
+    bool input_line_drawn_ = false;
     std::array<std::string, spdlog::level::n_levels> colors_;
 };
 
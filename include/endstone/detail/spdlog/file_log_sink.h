@@ -14,11 +14,14 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <cstdint>
 #include <ctime>
+#include <deque>
 #include <iomanip>
 #include <mutex>
 #include <sstream>
+#include <thread>
 
 #include <spdlog/details/file_helper.h>
 #include <spdlog/details/os.h>
@@ -27,10 +30,26 @@
 
 namespace endstone::detail {
 
+/**
+ * @brief A sink that writes to a file and rotates it daily, and optionally when it grows past a size.
+ *
+ * A rotated file takes the next free index for the day in the file pattern, so rotating is a single rename. Rotated
+ * files can be gzip compressed on a background thread.
+ */
 class FileLogSink final : public spdlog::sinks::base_sink<std::mutex> {
 public:
+    /**
+     * @param base_filename The file currently written to
+     * @param file_pattern The name of rotated files, formatted with the current date and the rotation index
+     * @param max_files The highest rotation index of a day, later rotations of that day replace the last file
+     * @param max_size The size in bytes after which the file is rotated, 0 to rotate daily only
+     * @param compress Whether rotated files are gzip compressed and given the .gz extension
+     */
     explicit FileLogSink(spdlog::filename_t base_filename, spdlog::filename_t file_pattern, std::uint16_t max_files,
+                         std::size_t max_size = 0, bool compress = false,
                          const spdlog::file_event_handlers &event_handlers = {});
+    ~FileLogSink() override;
+
     spdlog::filename_t filename();
     static spdlog::filename_t calcFilename(const spdlog::filename_t &base_filename,
                                            const spdlog::filename_t &file_pattern, std::size_t index);
@@ -41,8 +60,13 @@ protected:
 
 private:
     void rotate();
+    bool isRotatedFile(const spdlog::filename_t &filename) const;
     static bool rename(const spdlog::filename_t &src_filename, const spdlog::filename_t &target_filename);
 
+    void scheduleCompression(spdlog::filename_t filename);
+    void runCompression();
+    static bool compressFile(const spdlog::filename_t &filename);
+
     static std::tm localtime(spdlog::log_clock::time_point tp);
     static spdlog::log_clock::time_point nextRotation();
 
@@ -51,6 +75,18 @@ private:
     spdlog::log_clock::time_point rotation_tp_;
     spdlog::details::file_helper file_helper_;
     uint16_t max_files_;
+    std::size_t max_size_;
+    std::size_t current_size_{0};
+    std::size_t rotation_size_{0};
+    std::size_t next_index_{1};
+    int next_index_day_{-1};
+    bool compress_;
+
+    std::mutex compression_mutex_;
+    std::condition_variable compression_cv_;
+    std::deque<spdlog::filename_t> compression_queue_;
+    bool stopping_{false};
+    std::thread compressor_;
 };
 
 }  // namespace endstone::detail
@@ -0,0 +1,49 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+
+#include <spdlog/formatter.h>
+#include <spdlog/spdlog.h>
+
+namespace endstone::detail {
+
+/**
+ * @brief A formatter that writes each message as a single line JSON object.
+ *
+ * Each line holds the time in UTC, the level, the logger name, the thread id, the source location when known and the
+ * message, so log pipelines can ingest it without parsing the text pattern.
+ */
+class JsonLogFormatter final : public spdlog::formatter {
+public:
+    /**
+     * @param strip_color_codes Whether color codes are removed from messages, or written as they were logged
+     */
+    explicit JsonLogFormatter(bool strip_color_codes = true);
+
+    void format(const spdlog::details::log_msg &msg, spdlog::memory_buf_t &dest) override;
+    [[nodiscard]] std::unique_ptr<spdlog::formatter> clone() const override;
+
+private:
+    void appendString(spdlog::string_view_t input, spdlog::memory_buf_t &dest) const;
+
+    bool strip_color_codes_;
+    std::chrono::seconds cached_seconds_{-1};
+    spdlog::memory_buf_t cached_time_;
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,95 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+namespace endstone::detail {
+
+/**
+ * @brief Limits on how often a logger writes messages, all of them are off by default.
+ */
+struct LogRateLimit {
+    /**
+     * Messages the logger writes per second on average, 0 for no limit.
+     */
+    double messages_per_second = 0;
+    /**
+     * Messages the logger can write at once before the average applies, defaults to one second worth.
+     */
+    std::size_t burst = 0;
+    /**
+     * Copies of the same message written in full per repeat interval, 0 for no limit.
+     */
+    std::size_t repeat_first = 0;
+    /**
+     * After the first copies, write one in every this many copies of the same message, 0 to write none.
+     */
+    std::size_t repeat_every = 0;
+    std::chrono::milliseconds repeat_interval{60000};
+};
+
+/**
+ * @brief Decides which messages of a logger are written under its LogRateLimit.
+ *
+ * Repeats are detected by message text, as messages carry no call site. Suppressed messages are counted and reported
+ * with the next message that is written.
+ */
+class LogRateLimiter {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Decision {
+        bool allowed;
+        /**
+         * Copies of this message suppressed since one was last written.
+         */
+        std::size_t repeats;
+        /**
+         * Messages suppressed because the logger exceeded its rate.
+         */
+        std::size_t suppressed;
+    };
+
+    void setLimit(const LogRateLimit &limit);
+    [[nodiscard]] bool isEnabled() const
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+    Decision check(std::string_view message, Clock::time_point now = Clock::now());
+
+private:
+    struct Repeat {
+        std::size_t count = 0;
+        std::size_t suppressed = 0;
+        Clock::time_point since;
+    };
+    static constexpr std::size_t MaxTrackedMessages = 1024;
+
+    std::atomic<bool> enabled_{false};
+    std::mutex mutex_;
+    LogRateLimit limit_;
+    double tokens_ = 0;
+    Clock::time_point refilled_;
+    std::size_t suppressed_ = 0;
+    std::unordered_map<std::size_t, Repeat> repeats_;
+};
+
+}  // namespace endstone::detail
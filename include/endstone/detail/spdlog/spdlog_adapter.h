@@ -14,8 +14,11 @@
 
 #pragma once
 
+#include <memory>
+
 #include <spdlog/spdlog.h>
 
+#include "endstone/detail/spdlog/log_rate_limiter.h"
 #include "endstone/logger.h"
 
 namespace endstone::detail {
@@ -28,8 +31,14 @@ public:
     [[nodiscard]] std::string_view getName() const override;
     void log(Level level, const std::string &message) const override;
 
+    /**
+     * Limits how often messages are written, suppressed messages are dropped before they are formatted or queued.
+     */
+    void setRateLimit(const LogRateLimit &limit);
+
 private:
     std::shared_ptr<spdlog::logger> logger_;
+    std::unique_ptr<LogRateLimiter> rate_limiter_;
 };
 
 }  // namespace endstone::detail
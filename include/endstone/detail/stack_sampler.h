@@ -0,0 +1,54 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <cpptrace/cpptrace.hpp>
+
+namespace endstone::detail {
+
+/**
+ * Captures the stack of a thread from another thread. Implemented per platform.
+ *
+ * Several samplers may be bound to the same thread, such as the watchdog's and the profiler's.
+ */
+class StackSampler {
+public:
+    static constexpr std::size_t MaxFrames = 128;
+
+    /**
+     * Binds the sampler to the calling thread.
+     */
+    StackSampler();
+    ~StackSampler();
+    StackSampler(const StackSampler &) = delete;
+    StackSampler &operator=(const StackSampler &) = delete;
+
+    /**
+     * Gets the return addresses on the stack of the bound thread, most recent call first, or nothing if the thread
+     * could not be sampled.
+     *
+     * The bound thread is only interrupted while its stack is walked, the addresses are resolved afterwards.
+     */
+    [[nodiscard]] std::vector<cpptrace::frame_ptr> sample() const;
+
+private:
+    std::uintptr_t thread_;
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,100 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "endstone/logger.h"
+
+namespace endstone::detail {
+
+/**
+ * Collects the time spent in each phase of the boot and in the onLoad and onEnable of each plugin, until the
+ * summary is reported once the server has loaded.
+ */
+class StartupTimings {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Phase {
+        std::string name;
+        Clock::duration elapsed;
+    };
+
+    struct PluginTiming {
+        std::string name;
+        Clock::duration load;
+        Clock::duration enable;
+    };
+
+    StartupTimings() = default;
+
+    static StartupTimings &getInstance();
+
+    /**
+     * Records a phase, in the order the phases end. Does nothing once the summary is reported.
+     */
+    void record(std::string name, Clock::duration elapsed);
+    void recordLoad(const std::string &plugin, Clock::duration elapsed);
+    void recordEnable(const std::string &plugin, Clock::duration elapsed);
+
+    [[nodiscard]] std::vector<Phase> getPhases() const;
+    [[nodiscard]] std::vector<PluginTiming> getPlugins() const;
+
+    /**
+     * @return the time since the timings were created, early in the initialisation of the runtime
+     */
+    [[nodiscard]] Clock::duration getElapsed() const;
+
+    /**
+     * Logs the phases and the plugins as tables, and stops recording.
+     */
+    void report(const Logger &logger);
+
+private:
+    PluginTiming &getPlugin(const std::string &plugin);
+
+    mutable std::mutex mutex_;
+    Clock::time_point start_ = Clock::now();
+    std::vector<Phase> phases_;
+    std::vector<PluginTiming> plugins_;
+    bool reported_ = false;
+};
+
+/**
+ * Records the time until the end of its scope as a phase of the boot.
+ */
+class StartupTimer {
+public:
+    explicit StartupTimer(std::string name) : name_(std::move(name)), start_(StartupTimings::Clock::now()) {}
+
+    ~StartupTimer()
+    {
+        StartupTimings::getInstance().record(std::move(name_), StartupTimings::Clock::now() - start_);
+    }
+
+    StartupTimer(const StartupTimer &) = delete;
+    StartupTimer &operator=(const StartupTimer &) = delete;
+
+private:
+    std::string name_;
+    StartupTimings::Clock::time_point start_;
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,64 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace endstone::detail::hook {
+
+/**
+ * @brief Offsets of the symbols used by the hooks, relative to the base of their module.
+ */
+struct SymbolTable {
+    std::unordered_map<std::string, std::size_t> detours;  // exported by the runtime
+    std::unordered_map<std::string, std::size_t> targets;  // in the server executable
+};
+
+/**
+ * @brief Read the targets in the server executable from symbols.toml.
+ */
+std::unordered_map<std::string, std::size_t> read_targets();
+
+/**
+ * @brief Read the detours exported by the runtime module.
+ *
+ * Only the exports with a target are materialized, the others are reported as warnings.
+ */
+std::unordered_map<std::string, std::size_t> read_detours(const std::unordered_map<std::string, std::size_t> &targets);
+
+/**
+ * @brief Compute the key of a symbol cache from the path, size and modification time of the files it is built from.
+ */
+std::uint64_t get_symbol_cache_key(const std::vector<std::filesystem::path> &files);
+
+/**
+ * @brief Map a symbol cache file and read the table from it.
+ *
+ * @return the symbol table, or std::nullopt if the file does not exist, is malformed or was built with another key.
+ */
+std::optional<SymbolTable> load_symbol_cache(const std::filesystem::path &path, std::uint64_t key);
+
+/**
+ * @brief Write a symbol table to a cache file, replacing it atomically.
+ */
+void save_symbol_cache(const std::filesystem::path &path, std::uint64_t key, const SymbolTable &table);
+
+}  // namespace endstone::detail::hook
@@ -0,0 +1,54 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "endstone/detail/os.h"
+
+namespace endstone::detail {
+
+/**
+ * The CPUs and the priority a group of threads runs with, so that they compete less with the threads of the server
+ * on shared hosts.
+ */
+struct ThreadOptions {
+    std::vector<std::size_t> affinity{};
+    std::optional<os::ThreadPriority> priority{};
+
+    /**
+     * Applies the options to the calling thread, leaving unset ones as they are.
+     *
+     * @return false if the OS refused any of them
+     */
+    bool apply() const;
+
+    /**
+     * Reads the options of a group from ENDSTONE_<GROUP>_THREAD_AFFINITY, a list of CPUs and ranges such as "0-3,6",
+     * and ENDSTONE_<GROUP>_THREAD_PRIORITY, one of "low", "normal" or "high". Invalid values are ignored.
+     *
+     * @param group the group of threads, such as "SERVER" or "IO"
+     */
+    static ThreadOptions fromEnvironment(const std::string &group);
+
+    static std::optional<std::vector<std::size_t>> parseAffinity(std::string_view value);
+    static std::optional<os::ThreadPriority> parsePriority(std::string_view value);
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,128 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace endstone::detail {
+
+/**
+ * @brief Bump allocator for the temporaries of one server tick, released all at once when the tick is over.
+ *
+ * Memory is handed out from a few large blocks that are kept and reused from one tick to the next, so that a steady
+ * server stops allocating from the heap for these temporaries after its first ticks. Nothing is destroyed on reset,
+ * objects in the arena must be destroyed by their owners before then, as containers using ArenaAllocator do.
+ *
+ * Only the server thread may use the arena.
+ */
+class TickArena {
+public:
+    static constexpr std::size_t DefaultBlockSize = 64 * 1024;
+
+    explicit TickArena(std::size_t block_size = DefaultBlockSize);
+    TickArena(const TickArena &) = delete;
+    TickArena &operator=(const TickArena &) = delete;
+
+    void *allocate(std::size_t size, std::size_t alignment);
+
+    /**
+     * @brief Releases everything allocated so far, keeping the blocks for reuse.
+     */
+    void reset();
+
+    /**
+     * @brief Gets the number of bytes handed out since the last reset.
+     */
+    [[nodiscard]] std::size_t getAllocatedBytes() const;
+
+    [[nodiscard]] std::size_t getBlockCount() const;
+
+private:
+    void nextBlock();
+
+    std::size_t block_size_;
+    std::vector<std::unique_ptr<std::byte[]>> blocks_;
+    std::vector<std::unique_ptr<std::byte[]>> large_blocks_;
+    std::size_t block_ = 0;  // The index of the block in use
+    std::byte *cursor_ = nullptr;
+    std::byte *end_ = nullptr;
+    std::size_t allocated_ = 0;
+};
+
+/**
+ * @brief Allocator handing out memory from a TickArena, or from the heap when default constructed.
+ *
+ * Deallocating memory from the arena does nothing, it is released when the arena is reset.
+ */
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    ArenaAllocator() noexcept = default;
+    explicit ArenaAllocator(TickArena &arena) noexcept : arena_(&arena) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U> &other) noexcept : arena_(other.getArena())  // NOLINT(*-explicit-constructor)
+    {
+    }
+
+    T *allocate(std::size_t n)
+    {
+        if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+        if (!arena_) {
+            return static_cast<T *>(::operator new(n * sizeof(T)));
+        }
+        return static_cast<T *>(arena_->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T *p, std::size_t /*n*/) noexcept
+    {
+        if (!arena_) {
+            ::operator delete(p);
+        }
+    }
+
+    [[nodiscard]] TickArena *getArena() const noexcept
+    {
+        return arena_;
+    }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U> &other) const noexcept
+    {
+        return arena_ == other.getArena();
+    }
+
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U> &other) const noexcept
+    {
+        return arena_ != other.getArena();
+    }
+
+private:
+    TickArena *arena_ = nullptr;
+};
+
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+}  // namespace endstone::detail
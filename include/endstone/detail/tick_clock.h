@@ -0,0 +1,53 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+namespace endstone::detail {
+
+/**
+ * Counts the ticks that would have elapsed at the target tick rate since the first tick, so that timers can follow
+ * the wall clock while the server falls behind. Only used from the server thread.
+ */
+class TickClock {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * Updates the clock at the start of a tick, the first call anchors it to the given tick.
+     *
+     * @param current_tick the tick of the server
+     * @param now the time the tick started
+     * @return the wall-clock tick, which never goes backwards
+     */
+    std::uint64_t update(std::uint64_t current_tick, Clock::time_point now);
+
+    /**
+     * @return the wall-clock tick of the last update
+     */
+    [[nodiscard]] std::uint64_t getTick() const;
+
+    static constexpr std::chrono::milliseconds TickDuration{50};
+
+private:
+    std::optional<Clock::time_point> start_time_;
+    std::uint64_t start_tick_ = 0;
+    std::uint64_t tick_ = 0;
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,70 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+namespace endstone::detail {
+
+/**
+ * Keeps the durations of the phases of the last server ticks in a ring buffer.
+ */
+class TickHistory {
+public:
+    struct Sample {
+        std::chrono::nanoseconds scheduler{0};
+        std::chrono::nanoseconds level{0};
+        std::chrono::nanoseconds post_tick{0};
+
+        [[nodiscard]] std::chrono::nanoseconds getTotal() const
+        {
+            return scheduler + level + post_tick;
+        }
+    };
+
+    // One minute at the target tick rate
+    static constexpr std::size_t Capacity = 1200;
+
+    void push(const Sample &sample);
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * @param count the number of most recent ticks to consider
+     * @return the average duration of each phase over the last ticks
+     */
+    [[nodiscard]] Sample getAverage(std::size_t count) const;
+
+    /**
+     * @param count the number of most recent ticks to consider
+     * @return the slowest of the last ticks
+     */
+    [[nodiscard]] Sample getMax(std::size_t count) const;
+
+    /**
+     * @param count the number of most recent ticks to return
+     * @return the last ticks, from the oldest to the most recent
+     */
+    [[nodiscard]] std::vector<Sample> getSamples(std::size_t count) const;
+
+private:
+    std::array<Sample, Capacity> samples_{};
+    std::size_t next_{0};
+    std::size_t size_{0};
+};
+
+}  // namespace endstone::detail
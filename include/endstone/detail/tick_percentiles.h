@@ -0,0 +1,65 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "endstone/tick_statistics.h"
+
+namespace endstone::detail {
+
+/**
+ * Keeps log-linear histograms of the tick durations of each of the last seconds and minutes, which are merged to
+ * compute the percentiles over a window.
+ *
+ * A window is made of whole seconds, or whole minutes from five minutes on, ending with the current one, so it spans
+ * up to a second or a minute more than its length. Only used from the server thread.
+ */
+class TickPercentiles {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    void record(Clock::time_point now, std::chrono::microseconds duration);
+    [[nodiscard]] TickStatistics getStatistics(Clock::time_point now, TickWindow window) const;
+
+private:
+    // Sixteen buckets per power of two from 16us, the first sixteen hold 0 to 15us exactly
+    static constexpr std::size_t SubBuckets = 16;
+    static constexpr std::size_t SubBucketBits = 4;
+    static constexpr std::size_t MaxExponent = 26;  // about 67s, longer ticks are counted in the last bucket
+    static constexpr std::size_t NumBuckets = (MaxExponent - SubBucketBits + 2) * SubBuckets;
+
+    struct Slot {
+        std::int64_t id{-1};
+        std::uint32_t count{0};
+        std::uint64_t max{0};
+        std::array<std::uint32_t, NumBuckets> buckets{};
+
+        void add(std::uint64_t value);
+    };
+
+    static std::size_t getBucket(std::uint64_t value);
+    static std::uint64_t getUpperBound(std::size_t bucket);
+    template <std::size_t N>
+    static void merge(const std::array<Slot, N> &slots, std::int64_t first, std::int64_t last, Slot &result);
+
+    std::array<Slot, 61> seconds_{};
+    std::array<Slot, 16> minutes_{};
+};
+
+}  // namespace endstone::detail
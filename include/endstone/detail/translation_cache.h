@@ -0,0 +1,84 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "endstone/translatable.h"
+
+namespace endstone::detail {
+
+/**
+ * A translation compiled into literal text and parameter slots, so formatting it is a single concatenation.
+ */
+class TranslationTemplate {
+public:
+    /**
+     * @param text the translation with every parameter replaced by TranslationCache::getMarker
+     */
+    explicit TranslationTemplate(std::string_view text);
+
+    [[nodiscard]] std::string format(const std::vector<std::string> &params) const;
+
+private:
+    struct Segment {
+        std::string text;
+        std::size_t param;  // NoParam for literal text
+    };
+    static constexpr std::size_t NoParam = static_cast<std::size_t>(-1);
+
+    std::vector<Segment> segments_;
+    std::size_t literal_size_ = 0;
+};
+
+/**
+ * Caches the translations of messages per locale, compiled once per key.
+ *
+ * The resolver translates a key with the markers of getMarker as parameters, which shows where each parameter lands
+ * whatever placeholder syntax the translation uses. Parameters starting with '%' are translated themselves, as the
+ * client does.
+ */
+class TranslationCache {
+public:
+    /**
+     * @brief Translates a key for a locale, or for the server language if the locale is empty.
+     */
+    using Resolver = std::function<std::string(const std::string &key, const std::vector<std::string> &params,
+                                               const std::string &locale)>;
+
+    static constexpr std::size_t MaxParameters = 16;
+
+    explicit TranslationCache(Resolver resolver);
+
+    [[nodiscard]] std::string translate(const Translatable &message, const std::string &locale);
+    void clear();
+    [[nodiscard]] std::size_t size() const;
+
+    static std::string getMarker(std::size_t param);
+
+private:
+    const TranslationTemplate &compile(const std::string &key, const std::string &locale);
+
+    Resolver resolver_;
+    std::vector<std::string> markers_;
+    std::unordered_map<std::string, TranslationTemplate> templates_;  // Keyed by locale and key, split by a NUL
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,100 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "endstone/detail/stack_sampler.h"
+
+namespace endstone::detail {
+
+/**
+ * Watches the ticks of the server thread, and samples its stack while a tick is overdue, to tell what the server is
+ * stuck in.
+ *
+ * A tick is overdue once no tick has started for ENDSTONE_WATCHDOG_THRESHOLD_MS milliseconds, 5000 by default. Setting
+ * it to 0 disables the watchdog. When ENDSTONE_WATCHDOG_REPORT_DIR is set, every sampled stack of an overdue tick is
+ * also written to a report in that directory.
+ */
+class Watchdog {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::chrono::milliseconds DefaultThreshold{5000};
+    static constexpr std::chrono::milliseconds SampleInterval{500};
+    static constexpr std::size_t MaxSamples = 20;
+    static constexpr std::size_t MaxLoggedFrames = 24;
+
+    static Watchdog &getInstance();
+
+    /**
+     * Starts watching the calling thread, which must be the server thread.
+     */
+    void start();
+
+    /**
+     * Stops watching, waiting for the watchdog thread to exit.
+     */
+    void stop();
+
+    /**
+     * Marks the start of a tick. Called on the server thread.
+     */
+    void heartbeat(std::uint64_t tick) noexcept
+    {
+        last_tick_.store(tick, std::memory_order_relaxed);
+        last_heartbeat_.store(Clock::now().time_since_epoch().count(), std::memory_order_release);
+    }
+
+private:
+    struct Sample {
+        std::chrono::milliseconds elapsed;
+        std::string location;
+        std::vector<std::string> frames;
+    };
+
+    struct Stall {
+        std::uint64_t tick;
+        Clock::rep since;
+        std::vector<Sample> samples;
+        bool reported;
+    };
+
+    void run();
+    [[nodiscard]] Sample sample(std::chrono::milliseconds elapsed) const;
+    void finish(Stall &stall, std::chrono::milliseconds duration) const;
+    void writeReport(const Stall &stall) const;
+
+    std::chrono::milliseconds threshold_{DefaultThreshold};
+    std::string report_dir_;
+    std::unique_ptr<StackSampler> sampler_;
+    std::thread thread_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stopping_{false};
+    std::atomic<std::uint64_t> last_tick_{0};
+    std::atomic<Clock::rep> last_heartbeat_{0};
+};
+
+}  // namespace endstone::detail
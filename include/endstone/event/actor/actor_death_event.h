@@ -26,11 +26,7 @@ public:
     explicit ActorDeathEvent(Actor &actor) : ActorEvent(actor) {}
     ~ActorDeathEvent() override = default;
 
-    inline static const std::string NAME = "ActorDeathEvent";
-    [[nodiscard]] std::string getEventName() const override
-    {
-        return NAME;
-    }
+    ENDSTONE_EVENT(ActorDeathEvent);
 
     [[nodiscard]] bool isCancellable() const override
     {
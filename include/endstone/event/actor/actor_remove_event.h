@@ -29,11 +29,7 @@ public:
     explicit ActorRemoveEvent(Actor &actor) : ActorEvent(actor) {}
     ~ActorRemoveEvent() override = default;
 
-    inline static const std::string NAME = "ActorRemoveEvent";
-    [[nodiscard]] std::string getEventName() const override
-    {
-        return NAME;
-    }
+    ENDSTONE_EVENT(ActorRemoveEvent);
 
     [[nodiscard]] bool isCancellable() const override
     {
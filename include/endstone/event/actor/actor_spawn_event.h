@@ -28,11 +28,7 @@ public:
     explicit ActorSpawnEvent(Actor &actor) : ActorEvent(actor) {}
     ~ActorSpawnEvent() override = default;
 
-    inline static const std::string NAME = "ActorSpawnEvent";
-    [[nodiscard]] std::string getEventName() const override
-    {
-        return NAME;
-    }
+    ENDSTONE_EVENT(ActorSpawnEvent);
 
     [[nodiscard]] bool isCancellable() const override
     {
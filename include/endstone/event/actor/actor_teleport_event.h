@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <optional>
+
 #include "endstone/event/actor/actor_event.h"
 #include "endstone/level/location.h"
 
@@ -27,13 +29,14 @@ namespace endstone {
 class ActorTeleportEvent : public ActorEvent {
 public:
     explicit ActorTeleportEvent(Actor &actor, Location from, Location to) : ActorEvent(actor), from_(from), to_(to) {}
+
+    /**
+     * @brief Creates the event with the current location of the actor as the origin, read only if asked for
+     */
+    explicit ActorTeleportEvent(Actor &actor, Location to) : ActorEvent(actor), to_(to) {}
     ~ActorTeleportEvent() override = default;
 
-    inline static const std::string NAME = "ActorTeleportEvent";
-    [[nodiscard]] std::string getEventName() const override
-    {
-        return NAME;
-    }
+    ENDSTONE_EVENT(ActorTeleportEvent);
 
     [[nodiscard]] bool isCancellable() const override
     {
@@ -47,7 +50,10 @@ public:
      */
     [[nodiscard]] const Location &getFrom() const
     {
-        return from_;
+        if (!from_) {
+            from_ = getActor().getLocation();
+        }
+        return *from_;
     }
 
     /**
@@ -81,7 +87,7 @@ public:
     }
 
 private:
-    Location from_;
+    mutable std::optional<Location> from_;
     Location to_;
 };
 
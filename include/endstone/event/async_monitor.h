@@ -0,0 +1,160 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "endstone/event/event_priority.h"
+#include "endstone/plugin/plugin.h"
+#include "endstone/plugin/plugin_manager.h"
+#include "endstone/scheduler/scheduler.h"
+
+namespace endstone {
+
+/**
+ * @brief A lock-free multi-producer queue that hands out its contents in batches.
+ *
+ * Producers push with a single CAS on the head; a consumer takes everything queued so far with one exchange.
+ *
+ * @tparam T The type of the queued values
+ */
+template <typename T>
+class BatchQueue {
+public:
+    BatchQueue() = default;
+    BatchQueue(const BatchQueue &) = delete;
+    BatchQueue &operator=(const BatchQueue &) = delete;
+
+    ~BatchQueue()
+    {
+        release(head_.exchange(nullptr, std::memory_order_acquire));
+    }
+
+    /**
+     * Pushes a value onto the queue
+     *
+     * @param value The value to push
+     */
+    void push(T value)
+    {
+        auto *node = new Node{std::move(value), head_.load(std::memory_order_relaxed)};
+        while (!head_.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+    }
+
+    /**
+     * Takes every value pushed so far, in push order
+     *
+     * @return The batch of values, empty if nothing was queued
+     */
+    [[nodiscard]] std::vector<T> drain()
+    {
+        std::vector<T> batch;
+        auto *head = head_.exchange(nullptr, std::memory_order_acquire);
+        for (auto *node = head; node; node = node->next) {
+            batch.push_back(std::move(node->value));
+        }
+        release(head);
+        std::reverse(batch.begin(), batch.end());
+        return batch;
+    }
+
+private:
+    struct Node {
+        T value;
+        Node *next;
+    };
+
+    static void release(Node *node)
+    {
+        while (node) {
+            auto *next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+
+    std::atomic<Node *> head_{nullptr};
+};
+
+/**
+ * @brief Registers a Monitor listener whose work is moved off the server thread.
+ *
+ * The capture function runs on the server thread while the event is dispatched and must copy whatever the consumer
+ * needs out of the event, since events are neither copyable nor valid after dispatch. The snapshots are queued and
+ * delivered to the consumer in batches from an asynchronous task, once per tick.
+ *
+ * @remark The consumer runs asynchronously and should never access any Endstone API
+ *
+ * @tparam EventType The type of the event to monitor
+ * @tparam Snapshot The type of the data captured from each event
+ * @param plugin The plugin registering the listener
+ * @param capture Function copying the needed data out of an event
+ * @param consumer Function receiving the captured data in batches
+ * @param ignore_cancelled Whether to skip events that were cancelled
+ * @return The asynchronous task delivering the batches, cancel it to stop delivery and capturing
+ */
+template <typename EventType, typename Snapshot>
+std::shared_ptr<Task> registerAsyncMonitor(Plugin &plugin, std::function<Snapshot(const EventType &)> capture,
+                                           std::function<void(std::vector<Snapshot> &)> consumer,
+                                           bool ignore_cancelled = false)
+{
+    auto queue = std::make_shared<BatchQueue<Snapshot>>();
+    auto draining = std::make_shared<std::atomic<bool>>(false);
+    auto delivery = std::make_shared<std::weak_ptr<Task>>();
+    plugin.getServer().getPluginManager().registerEvent(
+        EventType::NAME,
+        EventExecutor::create<EventType>([queue, delivery, capture = std::move(capture)](EventType &e) {
+            // The listener cannot be unregistered on its own, stop queueing once nobody drains the queue anymore
+            auto task = delivery->lock();
+            if (!task || task->isCancelled()) {
+                (void)queue->drain();
+                return;
+            }
+            queue->push(capture(e));
+        }),
+        EventPriority::Monitor, plugin, ignore_cancelled);
+
+    auto task = plugin.getServer().getScheduler().runTaskTimerAsync(
+        plugin,
+        [queue, draining, consumer = std::move(consumer)]() {
+            // A slow consumer may still be busy with the previous batch, keep batches in order by skipping this run
+            if (draining->exchange(true, std::memory_order_acq_rel)) {
+                return;
+            }
+            struct Guard {
+                std::atomic<bool> &flag;
+                ~Guard()
+                {
+                    flag.store(false, std::memory_order_release);
+                }
+            } guard{*draining};
+
+            auto batch = queue->drain();
+            if (!batch.empty()) {
+                consumer(batch);
+            }
+        },
+        1, 1);
+    *delivery = task;
+    return task;
+}
+
+}  // namespace endstone
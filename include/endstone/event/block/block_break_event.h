@@ -30,11 +30,7 @@ public:
     explicit BlockBreakEvent(Block &block, Player &player) : BlockEvent(block), player_(player) {}
     ~BlockBreakEvent() override = default;
 
-    inline static const std::string NAME = "BlockBreakEvent";
-    [[nodiscard]] std::string getEventName() const override
-    {
-        return NAME;
-    }
+    ENDSTONE_EVENT(BlockBreakEvent);
 
     [[nodiscard]] bool isCancellable() const override
     {
@@ -32,11 +32,7 @@ public:
     }
     ~BlockPlaceEvent() override = default;
 
-    inline static const std::string NAME = "BlockPlaceEvent";
-    [[nodiscard]] std::string getEventName() const override
-    {
-        return NAME;
-    }
+    ENDSTONE_EVENT(BlockPlaceEvent);
 
     [[nodiscard]] bool isCancellable() const override
     {
@@ -14,7 +14,11 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <limits>
 #include <string>
+#include <typeinfo>
 
 namespace endstone {
 
@@ -36,6 +40,27 @@ public:
      */
     [[nodiscard]] virtual std::string getEventName() const = 0;
 
+    /**
+     * Gets the slot caching the interned type id of this event.
+     *
+     * The plugin manager assigns every event name an integer id the first time it is seen and stores it here, so that
+     * subsequent calls can index the handler lists directly instead of looking them up by name. Events declared with
+     * ENDSTONE_EVENT share a single slot per class; other events, including subclasses of those that do not declare
+     * themselves with ENDSTONE_EVENT, fall back to a slot per instance, which the plugin manager fills from a cache
+     * per dynamic type.
+     *
+     * @return the slot holding the interned type id, or UnresolvedType if not yet assigned
+     */
+    [[nodiscard]] virtual std::atomic<std::size_t> &getEventTypeSlot() const
+    {
+        return type_slot_;
+    }
+
+    /**
+     * The value held by a type slot before the event type has been interned.
+     */
+    static constexpr std::size_t UnresolvedType = std::numeric_limits<std::size_t>::max();
+
     /**
      * Whether the event can be cancelled by a plugin or the server.
      *
@@ -83,6 +108,28 @@ public:
 private:
     bool async_;
     bool cancelled_{false};
+    mutable std::atomic<std::size_t> type_slot_{UnresolvedType};
 };
 
 }  // namespace endstone
+
+#ifndef ENDSTONE_EVENT
+#define ENDSTONE_EVENT(EventType)                                              \
+    inline static const std::string NAME = #EventType;                         \
+    [[nodiscard]] std::string getEventName() const override                    \
+    {                                                                          \
+        return NAME;                                                           \
+    }                                                                          \
+    [[nodiscard]] static std::atomic<std::size_t> &getStaticEventTypeSlot()    \
+    {                                                                          \
+        static std::atomic<std::size_t> slot{endstone::Event::UnresolvedType}; \
+        return slot;                                                           \
+    }                                                                          \
+    [[nodiscard]] std::atomic<std::size_t> &getEventTypeSlot() const override  \
+    {                                                                          \
+        if (typeid(*this) != typeid(EventType)) {                              \
+            return endstone::Event::getEventTypeSlot();                        \
+        }                                                                      \
+        return getStaticEventTypeSlot();                                       \
+    }
+#endif
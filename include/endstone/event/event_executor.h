@@ -0,0 +1,182 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "endstone/event/event.h"
+
+namespace endstone {
+
+/**
+ * @brief Shared setup around consecutive event handlers.
+ *
+ * When several handlers sharing the same scope are called in a row for an event, the scope is entered once before
+ * the first of them and exited once after the last, e.g. to acquire an interpreter lock or to convert the event
+ * only once for all of them.
+ */
+class EventDispatchScope {
+public:
+    virtual ~EventDispatchScope() = default;
+
+    /**
+     * Called before the first handler of a run of handlers sharing this scope
+     *
+     * @param event The event being dispatched
+     */
+    virtual void enter(Event &event) = 0;
+
+    /**
+     * Called after the last handler of a run of handlers sharing this scope
+     *
+     * @param event The event being dispatched
+     */
+    virtual void exit(Event &event) noexcept = 0;
+};
+
+/**
+ * @brief A delegate which calls the handler of an event.
+ *
+ * Small trivially copyable handlers, such as a member function pointer bound to an instance, are stored inline and
+ * called through a single plain function pointer that casts the event to its concrete type. Larger handlers are
+ * stored on the heap.
+ */
+class EventExecutor {
+public:
+    EventExecutor() = default;
+
+    /**
+     * Creates an executor from a callable accepting the base Event
+     *
+     * @param func The callable
+     */
+    template <typename Func, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Func>, EventExecutor> &&
+                                                         std::is_invocable_v<std::decay_t<Func> &, Event &>>>
+    EventExecutor(Func &&func)  // NOLINT(*-explicit-constructor)
+    {
+        bind<Event>(std::forward<Func>(func));
+    }
+
+    /**
+     * Creates an executor from a callable accepting the concrete event type
+     *
+     * @tparam EventType The event type the executor will be called with
+     * @param func The callable
+     * @return The executor
+     */
+    template <typename EventType, typename Func>
+    static EventExecutor create(Func &&func)
+    {
+        EventExecutor executor;
+        executor.bind<EventType>(std::forward<Func>(func));
+        return executor;
+    }
+
+    /**
+     * Creates an executor calling a member function on an instance
+     *
+     * @tparam EventType The event type the executor will be called with
+     * @param func The member function
+     * @param instance The instance to call the member function on
+     * @return The executor
+     */
+    template <typename EventType, typename T>
+    static EventExecutor create(void (T::*func)(EventType &), T &instance)
+    {
+        return create<EventType>(MemberFunction<EventType, T>{func, &instance});
+    }
+
+    /**
+     * Calls the handler with the given event
+     *
+     * @param event The event, which must be of the type this executor was created for
+     */
+    void operator()(Event &event) const
+    {
+        invoke_(*this, event);
+    }
+
+    explicit operator bool() const
+    {
+        return invoke_ != nullptr;
+    }
+
+    /**
+     * Sets the scope shared with other handlers around calls of this executor
+     *
+     * @param scope The scope, or nullptr for none
+     */
+    void setScope(std::shared_ptr<EventDispatchScope> scope)
+    {
+        scope_ = std::move(scope);
+    }
+
+    /**
+     * Gets the scope shared with other handlers around calls of this executor
+     *
+     * @return The scope, or nullptr if none
+     */
+    [[nodiscard]] EventDispatchScope *getScope() const
+    {
+        return scope_.get();
+    }
+
+private:
+    template <typename EventType, typename T>
+    struct MemberFunction {
+        void (T::*func)(EventType &);
+        T *instance;
+
+        void operator()(EventType &event) const
+        {
+            (instance->*func)(event);
+        }
+    };
+
+    static constexpr std::size_t BufferSize = 4 * sizeof(void *);
+
+    template <typename Func>
+    static constexpr bool IsInline = std::is_trivially_copyable_v<Func> && sizeof(Func) <= BufferSize &&
+                                     alignof(Func) <= alignof(std::max_align_t);
+
+    template <typename EventType, typename Func>
+    void bind(Func &&func)
+    {
+        using F = std::decay_t<Func>;
+        if constexpr (IsInline<F>) {
+            ::new (static_cast<void *>(buffer_)) F(std::forward<Func>(func));
+            invoke_ = [](const EventExecutor &self, Event &event) {
+                (*std::launder(reinterpret_cast<F *>(self.buffer_)))(static_cast<EventType &>(event));
+            };
+        }
+        else {
+            heap_ = std::make_shared<F>(std::forward<Func>(func));
+            invoke_ = [](const EventExecutor &self, Event &event) {
+                (*static_cast<F *>(self.heap_.get()))(static_cast<EventType &>(event));
+            };
+        }
+    }
+
+    alignas(std::max_align_t) mutable unsigned char buffer_[BufferSize]{};
+    std::shared_ptr<void> heap_;
+    std::shared_ptr<EventDispatchScope> scope_;
+    void (*invoke_)(const EventExecutor &, Event &){nullptr};
+};
+
+}  // namespace endstone
@@ -14,13 +14,13 @@
 
 #pragma once
 
-#include <functional>
 #include <map>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "endstone/event/event.h"
+#include "endstone/event/event_executor.h"
 #include "endstone/event/event_priority.h"
 #include "endstone/plugin/plugin.h"
 
@@ -31,7 +31,7 @@ namespace endstone {
  */
 class EventHandler {
 public:
-    EventHandler(std::string event, std::function<void(Event &)> executor, EventPriority priority, Plugin &plugin,
+    EventHandler(std::string event, EventExecutor executor, EventPriority priority, Plugin &plugin,
                  bool ignore_cancelled)
         : event_(std::move(event)), executor_(std::move(executor)), priority_(priority), plugin_(plugin),
           ignore_cancelled_(ignore_cancelled)
@@ -57,6 +57,16 @@ public:
         return priority_;
     }
 
+    /**
+     * Gets the executor for this registration
+     *
+     * @return Registered executor
+     */
+    [[nodiscard]] const EventExecutor &getExecutor() const
+    {
+        return executor_;
+    }
+
     /**
      * Whether this listener accepts cancelled events
      *
@@ -70,13 +80,12 @@ public:
     /**
      * Calls the event executor
      *
+     * The event is expected to match the registered event type, which the HandlerList owning this handler guarantees.
+     *
      * @param event The event
      */
     void callEvent(Event &event)
     {
-        if (event.getEventName() != event_) {
-            return;
-        }
         if (event.isCancellable() && event.isCancelled() && isIgnoreCancelled()) {
             return;
         }
@@ -95,7 +104,7 @@ public:
 
 private:
     std::string event_;
-    std::function<void(Event &)> executor_;
+    EventExecutor executor_;
     EventPriority priority_;
     Plugin &plugin_;
     bool ignore_cancelled_;
@@ -0,0 +1,59 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include "endstone/event/event_priority.h"
+
+namespace endstone {
+
+/**
+ * @brief Aggregated dispatch timings of the handlers a plugin registered for an event at a given priority.
+ */
+struct EventTiming {
+    /**
+     * Name of the plugin owning the handlers
+     */
+    std::string plugin;
+    /**
+     * Name of the event handled
+     */
+    std::string event;
+    /**
+     * Priority the handlers were registered with
+     */
+    EventPriority priority;
+    /**
+     * Number of times the handlers were called
+     */
+    std::uint64_t count;
+    /**
+     * Cumulative time spent in the handlers
+     */
+    std::chrono::nanoseconds total;
+    /**
+     * Longest single call
+     */
+    std::chrono::nanoseconds max;
+    /**
+     * 99th percentile of the call durations
+     */
+    std::chrono::nanoseconds p99;
+};
+
+}  // namespace endstone
@@ -14,7 +14,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <utility>
@@ -30,7 +33,30 @@ namespace endstone {
  */
 class HandlerList {
 public:
-    explicit HandlerList(std::string event) : event_(std::move(event)) {}
+    /**
+     * @brief The registered handlers baked in the order they are called.
+     */
+    struct BakedHandlers {
+        /**
+         * All handlers, ordered by priority
+         */
+        std::vector<std::shared_ptr<EventHandler>> handlers;
+
+        /**
+         * Ascending indices into handlers of those which are still called once the event is cancelled
+         */
+        std::vector<std::size_t> accepting_cancelled;
+    };
+
+    /**
+     * An immutable view of the registered handlers.
+     */
+    using Snapshot = std::shared_ptr<const BakedHandlers>;
+
+    explicit HandlerList(std::string event)
+        : baked_handlers_(std::make_shared<BakedHandlers>()), event_(std::move(event))
+    {
+    }
 
     /**
      * Register a new handler
@@ -45,10 +71,9 @@ public:
         }
 
         std::lock_guard lock(mtx_);
-        valid_ = false;
-        auto &vector =
-            handlers_.emplace(handler->getPriority(), std::vector<std::unique_ptr<EventHandler>>{}).first->second;
+        auto &vector = handlers_[handler->getPriority()];
         auto &it = vector.emplace_back(std::move(handler));
+        bake();
         return it.get();
     }
 
@@ -60,13 +85,12 @@ public:
     void unregister(EventHandler &handler)
     {
         std::lock_guard lock(mtx_);
-        auto &vector =
-            handlers_.emplace(handler.getPriority(), std::vector<std::unique_ptr<EventHandler>>{}).first->second;
+        auto &vector = handlers_[handler.getPriority()];
         auto it = std::find_if(vector.begin(), vector.end(),
-                               [&](const std::unique_ptr<EventHandler> &h) { return h.get() == &handler; });
+                               [&](const std::shared_ptr<EventHandler> &h) { return h.get() == &handler; });
         if (it != vector.end()) {
-            valid_ = false;
             vector.erase(it);
+            bake();
         }
     }
 
@@ -78,50 +102,66 @@ public:
     void unregister(Plugin &plugin)
     {
         std::lock_guard lock(mtx_);
+        bool changed = false;
         for (auto &[priority, vector] : handlers_) {
-            vector.erase(
-                std::remove_if(vector.begin(), vector.end(),
-                               [&](const std::unique_ptr<EventHandler> &h) { return &h->getPlugin() == &plugin; }),
-                vector.end());
-            valid_ = false;
+            auto it = std::remove_if(vector.begin(), vector.end(), [&](const std::shared_ptr<EventHandler> &h) {
+                return &h->getPlugin() == &plugin;
+            });
+            changed |= it != vector.end();
+            vector.erase(it, vector.end());
+        }
+        if (changed) {
+            bake();
         }
     }
 
     /**
      * Get the baked registered handlers associated with this handler list
      *
-     * @return the array of registered handlers
+     * The snapshot is never modified once published; registering or unregistering a handler publishes a new one.
+     * It can therefore be iterated without locking, and handlers stay alive for as long as the snapshot is held.
+     *
+     * @return the snapshot of registered handlers
      */
-    std::vector<EventHandler *> getHandlers() const
+    [[nodiscard]] Snapshot getHandlers() const
     {
-        std::lock_guard lock(mtx_);
-        if (!valid_) {
-            bake();
-        }
-        return baked_handlers_;
+        return std::atomic_load_explicit(&baked_handlers_, std::memory_order_acquire);
     }
 
-protected:
-    void bake() const
+    /**
+     * Get the number of registered handlers associated with this handler list
+     *
+     * @return the number of registered handlers
+     */
+    [[nodiscard]] std::size_t getHandlerCount() const
     {
-        if (valid_) {
-            return;
-        }
+        return handler_count_.load(std::memory_order_relaxed);
+    }
 
-        baked_handlers_.clear();
+protected:
+    /**
+     * Publish a new snapshot of the handlers. Must be called with mtx_ held.
+     */
+    void bake()
+    {
+        auto baked = std::make_shared<BakedHandlers>();
         for (const auto &[priority, vector] : handlers_) {
             for (const auto &handler : vector) {
-                baked_handlers_.push_back(handler.get());
+                if (!handler->isIgnoreCancelled()) {
+                    baked->accepting_cancelled.push_back(baked->handlers.size());
+                }
+                baked->handlers.push_back(handler);
             }
         }
-        valid_ = true;
+        handler_count_.store(baked->handlers.size(), std::memory_order_relaxed);
+        std::atomic_store_explicit(&baked_handlers_, Snapshot(std::move(baked)), std::memory_order_release);
     }
 
 private:
-    mutable std::mutex mtx_;
-    std::map<EventPriority, std::vector<std::unique_ptr<EventHandler>>> handlers_;
-    mutable std::vector<EventHandler *> baked_handlers_;
-    mutable bool valid_{false};
+    std::mutex mtx_;
+    std::map<EventPriority, std::vector<std::shared_ptr<EventHandler>>> handlers_;
+    Snapshot baked_handlers_;
+    std::atomic<std::size_t> handler_count_{0};
     std::string event_;
 };
 
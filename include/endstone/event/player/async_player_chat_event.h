@@ -0,0 +1,95 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+#include <utility>
+
+#include "endstone/event/event.h"
+#include "endstone/util/uuid.h"
+
+namespace endstone {
+
+/**
+ * @brief Called on the CPU workers of the scheduler when a player sends a chat message, after PlayerChatEvent.
+ *
+ * Handlers can run expensive filters here without costing tick time. The message is delivered on the server thread
+ * with the next batch of chat once every handler returned, in the order the messages were sent.
+ *
+ * @remark The player may have left by the time a handler runs, so the event carries their name and UUID instead of
+ * the player. Look the player up with Server::getPlayer from a task on the server thread if needed.
+ */
+class AsyncPlayerChatEvent : public Event {
+public:
+    AsyncPlayerChatEvent(UUID player_id, std::string player_name, std::string message)
+        : Event(true), player_id_(player_id), player_name_(std::move(player_name)), message_(std::move(message))
+    {
+    }
+    ~AsyncPlayerChatEvent() override = default;
+
+    ENDSTONE_EVENT(AsyncPlayerChatEvent);
+
+    [[nodiscard]] bool isCancellable() const override
+    {
+        return true;
+    }
+
+    /**
+     * Gets the UUID of the player that sent the message.
+     *
+     * @return UUID of the player
+     */
+    [[nodiscard]] UUID getPlayerId() const
+    {
+        return player_id_;
+    }
+
+    /**
+     * Gets the name of the player that sent the message.
+     *
+     * @return Name of the player
+     */
+    [[nodiscard]] const std::string &getPlayerName() const
+    {
+        return player_name_;
+    }
+
+    /**
+     * Gets the message that the player is attempting to send.
+     *
+     * @return Message the player is attempting to send
+     */
+    [[nodiscard]] std::string getMessage() const
+    {
+        return message_;
+    }
+
+    /**
+     * Sets the message that the player will send.
+     *
+     * @param message New message that the player will send
+     */
+    void setMessage(std::string message)
+    {
+        message_ = std::move(message);
+    }
+
+private:
+    UUID player_id_;
+    std::string player_name_;
+    std::string message_;
+};
+
+}  // namespace endstone
@@ -0,0 +1,67 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "endstone/event/event.h"
+#include "endstone/level/location.h"
+#include "endstone/player.h"
+
+namespace endstone {
+
+/**
+ * @brief Called once per tick with every player that moved further than the movement thresholds.
+ *
+ * This reports the same movements as PlayerMoveEvent, after its handlers have run, but in a single dispatch. Players
+ * whose PlayerMoveEvent was cancelled are left out.
+ */
+class PlayerBatchMoveEvent : public Event {
+public:
+    /**
+     * @brief Describes the movement of a single player
+     */
+    struct Movement {
+        Player *player;
+        Location from;
+        Location to;
+    };
+
+    explicit PlayerBatchMoveEvent(std::vector<Movement> movements) : movements_(std::move(movements)) {}
+    ~PlayerBatchMoveEvent() override = default;
+
+    ENDSTONE_EVENT(PlayerBatchMoveEvent);
+
+    [[nodiscard]] bool isCancellable() const override
+    {
+        return false;
+    }
+
+    /**
+     * @brief Gets the movements of all players that moved this tick
+     *
+     * @return Movements of the players
+     */
+    [[nodiscard]] const std::vector<Movement> &getMovements() const
+    {
+        return movements_;
+    }
+
+private:
+    std::vector<Movement> movements_;
+};
+
+}  // namespace endstone
@@ -26,11 +26,7 @@ public:
     explicit PlayerChatEvent(Player &player, std::string message) : PlayerEvent(player), message_(std::move(message)) {}
     ~PlayerChatEvent() override = default;
 
-    inline static const std::string NAME = "PlayerChatEvent";
-    [[nodiscard]] std::string getEventName() const override
-    {
-        return NAME;
-    }
+    ENDSTONE_EVENT(PlayerChatEvent);
 
     [[nodiscard]] bool isCancellable() const override
     {
@@ -28,11 +28,7 @@ public:
     }
     ~PlayerCommandEvent() override = default;
 
-    inline static const std::string NAME = "PlayerCommandEvent";
-    [[nodiscard]] std::string getEventName() const override
-    {
-        return NAME;
-    }
+    ENDSTONE_EVENT(PlayerCommandEvent);
 
     [[nodiscard]] bool isCancellable() const override
     {
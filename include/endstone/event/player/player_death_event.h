@@ -30,11 +30,7 @@ public:
     }
     ~PlayerDeathEvent() override = default;
 
-    inline static const std::string NAME = "PlayerDeathEvent";
-    [[nodiscard]] std::string getEventName() const override
-    {
-        return NAME;
-    }
+    ENDSTONE_EVENT(PlayerDeathEvent);
 
     [[nodiscard]] bool isCancellable() const override
     {
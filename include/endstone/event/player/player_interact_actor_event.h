@@ -26,11 +26,7 @@ public:
     explicit PlayerInteractActorEvent(Player &player, Actor &actor) : PlayerEvent(player), actor_(actor) {}
     ~PlayerInteractActorEvent() override = default;
 
-    inline static const std::string NAME = "PlayerInteractActorEvent";
-    [[nodiscard]] std::string getEventName() const override
-    {
-        return NAME;
-    }
+    ENDSTONE_EVENT(PlayerInteractActorEvent);
 
     [[nodiscard]] bool isCancellable() const override
     {
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include "endstone/block/block.h"
+#include "endstone/block/block_face.h"
 #include "endstone/event/player/player_event.h"
 #include "endstone/inventory/item_stack.h"
 
@@ -21,22 +23,20 @@ namespace endstone {
 
 /**
  * @brief Represents an event that is called when a player right-clicks a block.
+ *
+ * The item and the block are owned by the caller and are only valid while the event is being dispatched.
  */
 class PlayerInteractEvent : public PlayerEvent {
 public:
-    PlayerInteractEvent(Player &player, std::unique_ptr<ItemStack> item, std::unique_ptr<Block> block_clicked,
-                        BlockFace block_face, const Vector<float> &clicked_position)
-        : PlayerEvent(player), item_(std::move(item)), block_clicked_(std::move(block_clicked)),
-          block_face_(block_face), clicked_position_(clicked_position)
+    PlayerInteractEvent(Player &player, ItemStack *item, Block *block_clicked, BlockFace block_face,
+                        const Vector<float> &clicked_position)
+        : PlayerEvent(player), item_(item), block_clicked_(block_clicked), block_face_(block_face),
+          clicked_position_(clicked_position)
     {
     }
     ~PlayerInteractEvent() override = default;
 
-    inline static const std::string NAME = "PlayerInteractEvent";
-    [[nodiscard]] std::string getEventName() const override
-    {
-        return NAME;
-    }
+    ENDSTONE_EVENT(PlayerInteractEvent);
 
     [[nodiscard]] bool isCancellable() const override
     {
@@ -60,7 +60,7 @@ public:
      */
     [[nodiscard]] ItemStack *getItem() const
     {
-        return item_.get();
+        return item_;
     }
 
     /**
@@ -80,7 +80,7 @@ public:
      */
     [[nodiscard]] Block *getBlock() const
     {
-        return block_clicked_.get();
+        return block_clicked_;
     }
 
     /**
@@ -106,8 +106,8 @@ public:
     }
 
 private:
-    std::unique_ptr<ItemStack> item_;
-    std::unique_ptr<Block> block_clicked_;
+    ItemStack *item_;
+    Block *block_clicked_;
     BlockFace block_face_;
     Vector<float> clicked_position_;
 };
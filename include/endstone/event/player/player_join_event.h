@@ -26,11 +26,7 @@ public:
     explicit PlayerJoinEvent(Player &player) : PlayerEvent(player) {}
     ~PlayerJoinEvent() override = default;
 
-    inline static const std::string NAME = "PlayerJoinEvent";
-    [[nodiscard]] std::string getEventName() const override
-    {
-        return NAME;
-    }
+    ENDSTONE_EVENT(PlayerJoinEvent);
 
     [[nodiscard]] bool isCancellable() const override
     {
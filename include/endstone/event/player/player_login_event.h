@@ -29,11 +29,7 @@ public:
     }
     ~PlayerLoginEvent() override = default;
 
-    inline static const std::string NAME = "PlayerLoginEvent";
-    [[nodiscard]] std::string getEventName() const override
-    {
-        return NAME;
-    }
+    ENDSTONE_EVENT(PlayerLoginEvent);
 
     [[nodiscard]] bool isCancellable() const override
     {
@@ -0,0 +1,90 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "endstone/event/player/player_event.h"
+#include "endstone/level/location.h"
+
+namespace endstone {
+
+/**
+ * @brief Called when a player moves or turns further than the thresholds set with Server::setPlayerMoveThresholds.
+ *
+ * Movement is checked once per tick. The origin is where the player was when this event was last fired for them, so
+ * slow movement is still reported once it adds up past the thresholds.
+ */
+class PlayerMoveEvent : public PlayerEvent {
+public:
+    explicit PlayerMoveEvent(Player &player, Location from, Location to) : PlayerEvent(player), from_(from), to_(to) {}
+    ~PlayerMoveEvent() override = default;
+
+    ENDSTONE_EVENT(PlayerMoveEvent);
+
+    /**
+     * @brief Cancelling this event moves the player back to where they came from.
+     */
+    [[nodiscard]] bool isCancellable() const override
+    {
+        return true;
+    }
+
+    /**
+     * @brief Gets the location this player moved from
+     *
+     * @return Location the player moved from
+     */
+    [[nodiscard]] const Location &getFrom() const
+    {
+        return from_;
+    }
+
+    /**
+     * @brief Gets the location this player moved to
+     *
+     * @return Location the player moved to
+     */
+    [[nodiscard]] const Location &getTo() const
+    {
+        return to_;
+    }
+
+    /**
+     * @brief Sets the location to move this player to instead
+     *
+     * @param to New location the player will be moved to
+     */
+    void setTo(const Location &to)
+    {
+        to_ = to;
+        to_changed_ = true;
+    }
+
+    /**
+     * @brief Checks whether a handler changed the destination with setTo
+     *
+     * @return true if the destination was changed
+     */
+    [[nodiscard]] bool isToChanged() const
+    {
+        return to_changed_;
+    }
+
+private:
+    Location from_;
+    Location to_;
+    bool to_changed_ = false;
+};
+
+}  // namespace endstone
@@ -26,11 +26,7 @@ public:
     explicit PlayerQuitEvent(Player &player) : PlayerEvent(player) {}
     ~PlayerQuitEvent() override = default;
 
-    inline static const std::string NAME = "PlayerQuitEvent";
-    [[nodiscard]] std::string getEventName() const override
-    {
-        return NAME;
-    }
+    ENDSTONE_EVENT(PlayerQuitEvent);
 
     [[nodiscard]] bool isCancellable() const override
     {
@@ -0,0 +1,58 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+#include <utility>
+
+#include "endstone/event/player/player_event.h"
+
+namespace endstone {
+
+/**
+ * @brief Called when a player leaves a region added with Dimension::addRegion.
+ *
+ * Region membership is checked once per tick, against the location of the player at the end of the tick.
+ */
+class PlayerRegionLeaveEvent : public PlayerEvent {
+public:
+    explicit PlayerRegionLeaveEvent(Player &player, std::string region)
+        : PlayerEvent(player), region_(std::move(region))
+    {
+    }
+    ~PlayerRegionLeaveEvent() override = default;
+
+    ENDSTONE_EVENT(PlayerRegionLeaveEvent);
+
+    [[nodiscard]] bool isCancellable() const override
+    {
+        return false;
+    }
+
+    /**
+     * @brief Gets the name of the region the player leaves
+     *
+     * @return Name of the region
+     */
+    [[nodiscard]] const std::string &getRegion() const
+    {
+        return region_;
+    }
+
+private:
+    std::string region_;
+};
+
+}  // namespace endstone
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <optional>
+
 #include "endstone/event/player/player_event.h"
 #include "endstone/level/location.h"
 
@@ -27,13 +29,14 @@ public:
     explicit PlayerTeleportEvent(Player &player, Location from, Location to) : PlayerEvent(player), from_(from), to_(to)
     {
     }
+
+    /**
+     * @brief Creates the event with the current location of the player as the origin, read only if asked for
+     */
+    explicit PlayerTeleportEvent(Player &player, Location to) : PlayerEvent(player), to_(to) {}
     ~PlayerTeleportEvent() override = default;
 
-    inline static const std::string NAME = "PlayerTeleportEvent";
-    [[nodiscard]] std::string getEventName() const override
-    {
-        return NAME;
-    }
+    ENDSTONE_EVENT(PlayerTeleportEvent);
 
     [[nodiscard]] bool isCancellable() const override
     {
@@ -47,7 +50,10 @@ public:
      */
     [[nodiscard]] const Location &getFrom() const
     {
-        return from_;
+        if (!from_) {
+            from_ = getPlayer().getLocation();
+        }
+        return *from_;
     }
 
     /**
@@ -81,7 +87,7 @@ public:
     }
 
 private:
-    Location from_;
+    mutable std::optional<Location> from_;
     Location to_;
 };
 
@@ -36,11 +36,7 @@ public:
     {
     }
 
-    inline static const std::string NAME = "BroadcastMessageEvent";
-    [[nodiscard]] std::string getEventName() const override
-    {
-        return NAME;
-    }
+    ENDSTONE_EVENT(BroadcastMessageEvent);
 
     [[nodiscard]] bool isCancellable() const override
     {
@@ -0,0 +1,80 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string_view>
+
+#include "endstone/event/event.h"
+#include "endstone/event/server/server_event.h"
+
+namespace endstone {
+
+/**
+ * @brief Called when a packet is received from a client, before it is deserialized.
+ *
+ * This event is called from the network thread. The payload can be decoded with a BinaryStreamReader and is only
+ * valid until the event returns. Cancelling the event drops the packet without deserializing or handling it.
+ */
+class PacketReceiveEvent : public ServerEvent {
+public:
+    PacketReceiveEvent(int packet_id, int sub_client_id, std::string_view payload)
+        : ServerEvent(true), packet_id_(packet_id), sub_client_id_(sub_client_id), payload_(payload)
+    {
+    }
+
+    ENDSTONE_EVENT(PacketReceiveEvent);
+
+    [[nodiscard]] bool isCancellable() const override
+    {
+        return true;
+    }
+
+    /**
+     * Gets the id of the packet received.
+     *
+     * @return The packet id
+     */
+    [[nodiscard]] int getPacketId() const
+    {
+        return packet_id_;
+    }
+
+    /**
+     * Gets the id of the sub client, on the same connection, that sent the packet.
+     *
+     * @return The sub client id
+     */
+    [[nodiscard]] int getSubClientId() const
+    {
+        return sub_client_id_;
+    }
+
+    /**
+     * Gets the serialized packet body following the packet header.
+     *
+     * @return The packet payload
+     */
+    [[nodiscard]] std::string_view getPayload() const
+    {
+        return payload_;
+    }
+
+private:
+    int packet_id_;
+    int sub_client_id_;
+    std::string_view payload_;
+};
+
+}  // namespace endstone
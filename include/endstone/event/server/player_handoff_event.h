@@ -0,0 +1,82 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+#include <utility>
+
+#include "endstone/event/event.h"
+#include "endstone/event/server/server_event.h"
+#include "endstone/util/uuid.h"
+
+namespace endstone {
+
+/**
+ * @brief Called when another server of the network hands off a player it transfers to this server.
+ *
+ * The event is called before the player connects, and the values the plugins stored for the player on the other
+ * server are already in the PlayerDataStore, so plugins may start loading what the player will need.
+ */
+class PlayerHandoffEvent : public ServerEvent {
+public:
+    PlayerHandoffEvent(UUID unique_id, std::string player_name, std::string source_server_id)
+        : unique_id_(unique_id), player_name_(std::move(player_name)), source_server_id_(std::move(source_server_id))
+    {
+    }
+
+    ENDSTONE_EVENT(PlayerHandoffEvent);
+
+    [[nodiscard]] bool isCancellable() const override
+    {
+        return false;
+    }
+
+    /**
+     * @brief Gets the unique ID of the player being transferred.
+     *
+     * @return The unique ID of the player
+     */
+    [[nodiscard]] UUID getUniqueId() const
+    {
+        return unique_id_;
+    }
+
+    /**
+     * @brief Gets the name of the player being transferred.
+     *
+     * @return The name of the player
+     */
+    [[nodiscard]] const std::string &getPlayerName() const
+    {
+        return player_name_;
+    }
+
+    /**
+     * @brief Gets the ID of the server the player is transferred from.
+     *
+     * @return The ID of the other server
+     */
+    [[nodiscard]] const std::string &getSourceServerId() const
+    {
+        return source_server_id_;
+    }
+
+private:
+    UUID unique_id_;
+    std::string player_name_;
+    std::string source_server_id_;
+};
+
+}  // namespace endstone
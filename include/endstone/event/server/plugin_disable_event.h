@@ -37,11 +37,7 @@ public:
         return plugin_;
     }
 
-    inline static const std::string NAME = "PluginDisableEvent";
-    [[nodiscard]] std::string getEventName() const override
-    {
-        return NAME;
-    }
+    ENDSTONE_EVENT(PluginDisableEvent);
 
     [[nodiscard]] bool isCancellable() const override
     {
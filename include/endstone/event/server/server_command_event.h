@@ -35,11 +35,7 @@ class ServerCommandEvent : public ServerEvent {
 public:
     ServerCommandEvent(CommandSender &sender, std::string command) : sender_(sender), command_(std::move(command)) {}
 
-    inline static const std::string NAME = "ServerCommandEvent";
-    [[nodiscard]] std::string getEventName() const override
-    {
-        return NAME;
-    }
+    ENDSTONE_EVENT(ServerCommandEvent);
 
     [[nodiscard]] bool isCancellable() const override
     {
@@ -214,11 +214,7 @@ public:
         game_mode_ = game_mode;
     }
 
-    inline static const std::string NAME = "ServerListPingEvent";
-    [[nodiscard]] std::string getEventName() const override
-    {
-        return NAME;
-    }
+    ENDSTONE_EVENT(ServerListPingEvent);
 
     [[nodiscard]] bool isCancellable() const override
     {
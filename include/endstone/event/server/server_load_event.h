@@ -39,11 +39,7 @@ public:
         return type_;
     }
 
-    inline static const std::string NAME = "ServerLoadEvent";
-    [[nodiscard]] std::string getEventName() const override
-    {
-        return NAME;
-    }
+    ENDSTONE_EVENT(ServerLoadEvent);
 
     [[nodiscard]] bool isCancellable() const override
     {
@@ -36,11 +36,7 @@ public:
         return to_;
     }
 
-    inline static const std::string NAME = "ThunderChangeEvent";
-    [[nodiscard]] std::string getEventName() const override
-    {
-        return NAME;
-    }
+    ENDSTONE_EVENT(ThunderChangeEvent);
 
     [[nodiscard]] bool isCancellable() const override
     {
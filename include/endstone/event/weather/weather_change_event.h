@@ -36,11 +36,7 @@ public:
         return to_;
     }
 
-    inline static const std::string NAME = "WeatherChangeEvent";
-    [[nodiscard]] std::string getEventName() const override
-    {
-        return NAME;
-    }
+    ENDSTONE_EVENT(WeatherChangeEvent);
 
     [[nodiscard]] bool isCancellable() const override
     {
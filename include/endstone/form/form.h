@@ -15,6 +15,8 @@
 #pragma once
 
 #include <functional>
+#include <memory>
+#include <string>
 
 #include "endstone/message.h"
 
@@ -79,9 +81,45 @@ public:
         return on_close_;
     }
 
+    /**
+     * @brief Sets whether the form is static.
+     *
+     * The JSON of a static form is serialized the first time it is sent, and reused every time it or one of its copies
+     * is sent again. A static form must not be changed after it is first sent.
+     *
+     * @param value true to make the form static.
+     * @return A reference to the current form.
+     */
+    T &setStatic(bool value)
+    {
+        serialized_ = value ? std::make_shared<std::string>() : nullptr;
+        return *static_cast<T *>(this);
+    }
+
+    /**
+     * @brief Checks whether the form is static.
+     *
+     * @return true if the form is static.
+     */
+    [[nodiscard]] bool isStatic() const
+    {
+        return serialized_ != nullptr;
+    }
+
+    /**
+     * @brief Gets the JSON kept for a static form, shared with its copies.
+     *
+     * @return The JSON, empty until the form is first sent, or nullptr if the form is not static.
+     */
+    [[nodiscard]] std::string *getSerialized() const
+    {
+        return serialized_.get();
+    }
+
 protected:
     Message title_;
     OnCloseCallback on_close_;
+    std::shared_ptr<std::string> serialized_;
 };
 
 }  // namespace endstone
@@ -14,6 +14,10 @@
 
 #pragma once
 
+#include <vector>
+
+#include "endstone/inventory/item_stack_view.h"
+
 namespace endstone {
 /**
  * @brief Interface to the various inventories.
@@ -34,5 +38,25 @@ public:
      * @return The maximum size for an ItemStack in this inventory.
      */
     [[nodiscard]] virtual int getMaxStackSize() const = 0;
+
+    /**
+     * @brief Gets a view of the ItemStack found in the slot at the given index
+     *
+     * Unlike an ItemStack, a view is a plain value that is taken without allocating, which makes it suited to
+     * scanning inventories every tick.
+     *
+     * @param index The index of the slot
+     * @return A view of the ItemStack in the slot, empty if the slot is empty or the index is out of range
+     */
+    [[nodiscard]] virtual ItemStackView getItem(int index) const = 0;
+
+    /**
+     * @brief Gets a view of every ItemStack in this inventory, in slot order
+     *
+     * The views are stored contiguously and the whole snapshot takes a single allocation.
+     *
+     * @return Views of the ItemStacks, one per slot, including the empty ones
+     */
+    [[nodiscard]] virtual std::vector<ItemStackView> getContents() const = 0;
 };
 }  // namespace endstone
@@ -1,5 +1,3 @@
-#include <utility>
-
 // Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
@@ -16,6 +14,11 @@
 
 #pragma once
 
+#include <string>
+#include <utility>
+
+#include "endstone/inventory/item_stack_view.h"
+
 namespace endstone {
 
 /**
@@ -25,6 +28,7 @@ class ItemStack {
 public:
     ItemStack() = default;
     explicit ItemStack(std::string type, int amount = 1) : type_(std::move(type)), amount_(amount) {}
+    explicit ItemStack(const ItemStackView &view) : type_(view.getType()), amount_(view.getAmount()) {}
 
     virtual ~ItemStack() = default;
 
@@ -69,6 +73,18 @@ public:
         amount_ = amount;
     }
 
+    /**
+     * @brief Gets a non-owning view of this item stack
+     *
+     * The view refers to the type of this stack and must not outlive it, nor be used after the type is changed.
+     *
+     * @return View of the type and amount of this stack
+     */
+    [[nodiscard]] virtual ItemStackView view() const
+    {
+        return {type_, amount_};
+    }
+
 private:
     std::string type_ = "minecraft:air";
     int amount_ = 0;
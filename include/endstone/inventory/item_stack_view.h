@@ -0,0 +1,68 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string_view>
+
+namespace endstone {
+
+/**
+ * @brief A lightweight, non-owning snapshot of a stack of items.
+ *
+ * The type refers to a name owned by the item registry of the server, or by the ItemStack the view was taken from,
+ * so a view is trivially copyable and taking one never allocates. The amount is captured when the view is taken and
+ * does not follow later changes to the stack.
+ */
+class ItemStackView {
+public:
+    constexpr ItemStackView() = default;
+    constexpr ItemStackView(std::string_view type, int amount) : type_(type), amount_(amount) {}
+
+    /**
+     * @brief Gets the type of this item
+     *
+     * @return Type of the items in this stack
+     */
+    [[nodiscard]] constexpr std::string_view getType() const
+    {
+        return type_;
+    }
+
+    /**
+     * @brief Gets the amount of items in this stack
+     *
+     * @return Amount of items in this stack
+     */
+    [[nodiscard]] constexpr int getAmount() const
+    {
+        return amount_;
+    }
+
+    /**
+     * @brief Checks whether this stack holds no items
+     *
+     * @return true if the stack is air or its amount is zero
+     */
+    [[nodiscard]] constexpr bool isEmpty() const
+    {
+        return amount_ <= 0 || type_ == "minecraft:air";
+    }
+
+private:
+    std::string_view type_ = "minecraft:air";
+    int amount_ = 0;
+};
+
+}  // namespace endstone
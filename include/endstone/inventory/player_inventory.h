@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "endstone/inventory/inventory.h"
 
 namespace endstone {
@@ -21,6 +23,17 @@ namespace endstone {
 /**
  * @brief Interface to the inventory of a Player, including the four armor slots and any extra slots.
  */
-class PlayerInventory : public Inventory {};
+class PlayerInventory : public Inventory {
+public:
+    /**
+     * @brief Gets the slots whose contents changed during the last tick
+     *
+     * Each change is reported during the tick that follows it, so a task that runs every tick and reads only these
+     * slots sees every change exactly once, without diffing the whole inventory.
+     *
+     * @return The indices of the changed slots, in ascending order
+     */
+    [[nodiscard]] virtual std::vector<int> getChangedSlots() const = 0;
+};
 
 }  // namespace endstone
@@ -14,10 +14,28 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "endstone/actor/actor.h"
+#include "endstone/actor/actor_category.h"
 #include "endstone/block/block.h"
+#include "endstone/level/region_snapshot.h"
+#include "endstone/scheduler/scheduler.h"
+#include "endstone/util/vector.h"
 
 namespace endstone {
 
+class Player;
+class Plugin;
+
 /**
  * @brief Represents a dimension within a Level.
  */
@@ -33,6 +51,28 @@ public:
         Custom = 999
     };
 
+    /**
+     * @brief Describes how far a chunk pre-generation run has got.
+     */
+    struct PregenerationProgress {
+        int center_x;
+        int center_z;
+        int radius;
+        std::uint64_t completed;
+        std::uint64_t total;
+        double chunks_per_second;
+        std::optional<std::chrono::seconds> eta;
+    };
+
+    /**
+     * @brief A particle effect to spawn with spawnParticles.
+     */
+    struct ParticleEffect {
+        std::string effect_name;
+        Vector<float> position;
+        std::optional<std::string> molang_variables_json;
+    };
+
     virtual ~Dimension() = default;
 
     /**
@@ -73,5 +113,333 @@ public:
      * @return Block at the given coordinates
      */
     virtual std::unique_ptr<Block> getBlockAt(Location location) = 0;
+
+    /**
+     * @brief Gets the type of the block at the given coordinates without creating a Block
+     *
+     * @param x X-coordinate of the block
+     * @param y Y-coordinate of the block
+     * @param z Z-coordinate of the block
+     * @return The type of the block, or an empty string if the coordinates are outside of the world boundaries.
+     */
+    [[nodiscard]] virtual std::string_view getBlockTypeAt(int x, int y, int z) = 0;
+
+    /**
+     * @brief Gets the numeric id of the type of the block at the given coordinates without creating a Block
+     *
+     * @param x X-coordinate of the block
+     * @param y Y-coordinate of the block
+     * @param z Z-coordinate of the block
+     * @return The id of the type of the block, or -1 if the coordinates are outside of the world boundaries.
+     */
+    [[nodiscard]] virtual int getBlockTypeIdAt(int x, int y, int z) = 0;
+
+    /**
+     * @brief Visits every Block in the given region, one chunk at a time.
+     *
+     * Both corners are inclusive and may be given in any order. The region is clamped to the world height, and
+     * columns in chunks that are not loaded and ticking are skipped. The Block passed to the callback is only valid
+     * for the duration of the call.
+     *
+     * @param x1 X-coordinate of the first corner
+     * @param y1 Y-coordinate of the first corner
+     * @param z1 Z-coordinate of the first corner
+     * @param x2 X-coordinate of the second corner
+     * @param y2 Y-coordinate of the second corner
+     * @param z2 Z-coordinate of the second corner
+     * @param callback Called for each block, return false to stop the iteration
+     */
+    virtual void forEachBlock(int x1, int y1, int z1, int x2, int y2, int z2,
+                              const std::function<bool(Block &)> &callback) = 0;
+
+    /**
+     * @brief Gets all the Blocks in the given region.
+     *
+     * Both corners are inclusive and may be given in any order. Blocks in chunks that are not loaded and ticking are
+     * not included.
+     *
+     * @param x1 X-coordinate of the first corner
+     * @param y1 Y-coordinate of the first corner
+     * @param z1 Z-coordinate of the first corner
+     * @param x2 X-coordinate of the second corner
+     * @param y2 Y-coordinate of the second corner
+     * @param z2 Z-coordinate of the second corner
+     * @return Blocks in the given region
+     */
+    virtual std::vector<std::unique_ptr<Block>> getBlocks(int x1, int y1, int z1, int x2, int y2, int z2) = 0;
+
+    /**
+     * @brief Sets every Block in the given region from a palette, one chunk at a time.
+     *
+     * Both corners are inclusive and may be given in any order. The indices refer to entries in the palette and are
+     * laid out with z varying fastest, then y, then x, i.e. the index of (x, y, z) relative to the lowest corner is
+     * (x * size_y + y) * size_z + z. Blocks outside the world height or in chunks that are not loaded and ticking are
+     * left unchanged.
+     *
+     * @param x1 X-coordinate of the first corner
+     * @param y1 Y-coordinate of the first corner
+     * @param z1 Z-coordinate of the first corner
+     * @param x2 X-coordinate of the second corner
+     * @param y2 Y-coordinate of the second corner
+     * @param z2 Z-coordinate of the second corner
+     * @param palette Block types used by the region, e.g. "minecraft:stone"
+     * @param indices Palette index of each block in the region
+     * @param apply_physics false to skip neighbour updates, e.g. when pasting a whole structure
+     * @return Number of blocks that were changed, or -1 if the palette or indices are invalid
+     */
+    virtual int setBlocks(int x1, int y1, int z1, int x2, int y2, int z2, const std::vector<std::string> &palette,
+                          const std::vector<std::uint16_t> &indices, bool apply_physics) = 0;
+
+    /**
+     * @brief Takes a snapshot of every Block in the given region, including their block states.
+     *
+     * Both corners are inclusive and may be given in any order. Blocks outside the world height or in chunks that are
+     * not loaded and ticking are recorded as RegionSnapshot::Missing.
+     *
+     * @param x1 X-coordinate of the first corner
+     * @param y1 Y-coordinate of the first corner
+     * @param z1 Z-coordinate of the first corner
+     * @param x2 X-coordinate of the second corner
+     * @param y2 Y-coordinate of the second corner
+     * @param z2 Z-coordinate of the second corner
+     * @return Snapshot of the region
+     */
+    virtual RegionSnapshot snapshotRegion(int x1, int y1, int z1, int x2, int y2, int z2) = 0;
+
+    /**
+     * @brief Takes a snapshot of every Block in the given region, finishing it on the CPU workers of the scheduler.
+     *
+     * The block states are copied on the server thread before this returns, so the snapshot shows the region as it is
+     * now. Encoding the states into the palette, which takes most of the time, is left to the workers. The result
+     * is the same as that of snapshotRegion, and can be read from any thread.
+     *
+     * @param plugin the plugin owning the task that finishes the snapshot
+     * @param x1 X-coordinate of the first corner
+     * @param y1 Y-coordinate of the first corner
+     * @param z1 Z-coordinate of the first corner
+     * @param x2 X-coordinate of the second corner
+     * @param y2 Y-coordinate of the second corner
+     * @param z2 Z-coordinate of the second corner
+     * @return a handle to the snapshot (nullptr if the task could not be scheduled)
+     */
+    virtual std::shared_ptr<AsyncResult<RegionSnapshot>> snapshotRegionAsync(Plugin &plugin, int x1, int y1, int z1,
+                                                                             int x2, int y2, int z2) = 0;
+
+    /**
+     * @brief Restores a region to the state captured in a snapshot.
+     *
+     * Only blocks that differ from the snapshot are changed, and neighbour updates are not triggered. Missing blocks,
+     * blocks in chunks that are not loaded and ticking, and block states that no longer exist are skipped.
+     *
+     * @param snapshot Snapshot to restore
+     * @return Number of blocks that were changed, or -1 if the snapshot is invalid
+     */
+    virtual int restoreRegion(const RegionSnapshot &snapshot) = 0;
+
+    /**
+     * @brief Gets all the Actors within a radius of the given coordinates.
+     *
+     * Only the chunks overlapping the radius are searched, so the cost depends on how crowded the area is rather than
+     * on the number of actors in the level.
+     *
+     * @param x X-coordinate of the center
+     * @param y Y-coordinate of the center
+     * @param z Z-coordinate of the center
+     * @param radius Maximum distance from the center to the location of an actor
+     * @return Actors within the radius
+     */
+    [[nodiscard]] virtual std::vector<Actor *> getNearbyActors(float x, float y, float z, float radius) const = 0;
+
+    /**
+     * @brief Gets the Actors within a radius of the given coordinates that match a filter.
+     *
+     * @param x X-coordinate of the center
+     * @param y Y-coordinate of the center
+     * @param z Z-coordinate of the center
+     * @param radius Maximum distance from the center to the location of an actor
+     * @param filter Called for each actor within the radius, return true to include it
+     * @return Actors within the radius that match the filter
+     */
+    [[nodiscard]] virtual std::vector<Actor *> getNearbyActors(float x, float y, float z, float radius,
+                                                               const std::function<bool(Actor &)> &filter) const = 0;
+
+    /**
+     * @brief Adds a named region covering the blocks between two corners.
+     *
+     * Players entering or leaving the region are reported with PlayerRegionEnterEvent and PlayerRegionLeaveEvent.
+     *
+     * @param name Name of the region, unique within this dimension
+     * @param x1 X-coordinate of the first corner, inclusive
+     * @param y1 Y-coordinate of the first corner, inclusive
+     * @param z1 Z-coordinate of the first corner, inclusive
+     * @param x2 X-coordinate of the second corner, inclusive
+     * @param y2 Y-coordinate of the second corner, inclusive
+     * @param z2 Z-coordinate of the second corner, inclusive
+     * @return true if the region was added, false if a region with the same name already exists
+     */
+    virtual bool addRegion(const std::string &name, int x1, int y1, int z1, int x2, int y2, int z2) = 0;
+
+    /**
+     * @brief Removes a named region.
+     *
+     * @param name Name of the region
+     * @return true if the region existed and was removed
+     */
+    virtual bool removeRegion(const std::string &name) = 0;
+
+    /**
+     * @brief Gets the names of the regions containing the given coordinates.
+     *
+     * @param x X-coordinate
+     * @param y Y-coordinate
+     * @param z Z-coordinate
+     * @return Names of the regions, sorted by name
+     */
+    [[nodiscard]] virtual std::vector<std::string> getRegionsAt(float x, float y, float z) const = 0;
+
+    /**
+     * @brief Gets the names of the regions overlapping the blocks between two corners.
+     *
+     * @param x1 X-coordinate of the first corner, inclusive
+     * @param y1 Y-coordinate of the first corner, inclusive
+     * @param z1 Z-coordinate of the first corner, inclusive
+     * @param x2 X-coordinate of the second corner, inclusive
+     * @param y2 Y-coordinate of the second corner, inclusive
+     * @param z2 Z-coordinate of the second corner, inclusive
+     * @return Names of the regions, sorted by name
+     */
+    [[nodiscard]] virtual std::vector<std::string> getRegions(int x1, int y1, int z1, int x2, int y2,
+                                                              int z2) const = 0;
+
+    /**
+     * @brief Checks whether the chunk at the given chunk coordinates is loaded.
+     *
+     * This asks the chunk source for the chunk if it is already in memory, it never loads the chunk. No events are
+     * called when chunks are loaded or unloaded, so plugins caching data per chunk should check this to evict it.
+     *
+     * @param x X-coordinate of the chunk
+     * @param z Z-coordinate of the chunk
+     * @return true if the chunk is loaded
+     */
+    [[nodiscard]] virtual bool isChunkLoaded(int x, int z) const = 0;
+
+    /**
+     * @brief Adds a ticket that keeps the chunk at the given chunk coordinates loaded, loading it if needed.
+     *
+     * The chunk stays loaded until every plugin holding a ticket on it has removed its ticket. Tickets are removed
+     * when their plugin is disabled. A ticket keeps the chunk in memory, it does not make the chunk tick.
+     *
+     * @param x X-coordinate of the chunk
+     * @param z Z-coordinate of the chunk
+     * @param plugin Plugin that owns the ticket
+     * @return true if the ticket was added, false if the plugin already holds one or is not enabled
+     */
+    virtual bool addChunkTicket(int x, int z, Plugin &plugin) = 0;
+
+    /**
+     * @brief Removes the ticket a plugin holds on the chunk at the given chunk coordinates.
+     *
+     * @param x X-coordinate of the chunk
+     * @param z Z-coordinate of the chunk
+     * @param plugin Plugin that owns the ticket
+     * @return true if the plugin held a ticket on the chunk
+     */
+    virtual bool removeChunkTicket(int x, int z, Plugin &plugin) = 0;
+
+    /**
+     * @brief Removes all the tickets a plugin holds in this dimension.
+     *
+     * @param plugin Plugin that owns the tickets
+     */
+    virtual void removeChunkTickets(Plugin &plugin) = 0;
+
+    /**
+     * @brief Gets the coordinates of the chunks a plugin holds tickets on in this dimension.
+     *
+     * @param plugin Plugin that owns the tickets
+     * @return Chunk coordinates as (x, z) pairs, in no particular order
+     */
+    [[nodiscard]] virtual std::vector<std::pair<int, int>> getChunkTickets(Plugin &plugin) const = 0;
+
+    /**
+     * @brief Starts generating every chunk in a square around a center chunk.
+     *
+     * Chunks are requested from the chunk source, which generates them on its worker threads, and released once
+     * generated so they can be saved and unloaded. The number of requests in flight shrinks whenever the tick usage
+     * of the server goes over the target. Progress is saved to a checkpoint, and an interrupted run resumes from it
+     * once the server starts again.
+     *
+     * @param center_x X-coordinate of the center chunk
+     * @param center_z Z-coordinate of the center chunk
+     * @param radius Number of chunks to generate on each side of the center chunk
+     * @param target_usage Tick usage, between 0 and 1, above which requests are held back
+     * @return true if the run was started, false if one is already running in this dimension
+     */
+    virtual bool startPregeneration(int center_x, int center_z, int radius, float target_usage) = 0;
+
+    /**
+     * @brief Stops the chunk pre-generation run of this dimension and discards its checkpoint.
+     *
+     * @return true if a run was stopped
+     */
+    virtual bool stopPregeneration() = 0;
+
+    /**
+     * @brief Gets the progress of the chunk pre-generation run of this dimension.
+     *
+     * @return Progress of the run, or nullopt if no run is in progress
+     */
+    [[nodiscard]] virtual std::optional<PregenerationProgress> getPregenerationProgress() const = 0;
+
+    /**
+     * @brief Caps the number of actors of a type in each chunk and in the whole dimension.
+     *
+     * A spawn that would go over a cap is rejected before the ActorSpawnEvent is called. Actors are counted in the
+     * chunk they spawned or were loaded in, and actors loaded from the world are counted but never rejected.
+     * An actor stays counted until it is removed, including while its chunk is unloaded, and is counted once in its
+     * current chunk when the chunk is loaded again.
+     *
+     * @param type Namespaced identifier of the actor type, e.g. "minecraft:zombie"
+     * @param per_chunk Most actors of the type allowed in a chunk, or a negative value for no cap
+     * @param per_dimension Most actors of the type allowed in the dimension, or a negative value for no cap
+     */
+    virtual void setActorLimit(const std::string &type, int per_chunk, int per_dimension) = 0;
+
+    /**
+     * @brief Caps the number of actors having all the given categories in each chunk and in the whole dimension.
+     *
+     * @param categories Categories an actor must have to be capped, e.g. ActorCategory::Monster
+     * @param per_chunk Most matching actors allowed in a chunk, or a negative value for no cap
+     * @param per_dimension Most matching actors allowed in the dimension, or a negative value for no cap
+     */
+    virtual void setActorLimit(ActorCategory categories, int per_chunk, int per_dimension) = 0;
+
+    /**
+     * @brief Gets the number of actors of a type in this dimension, players excluded.
+     *
+     * @param type Namespaced identifier of the actor type, e.g. "minecraft:zombie"
+     * @return Number of actors of the type
+     */
+    [[nodiscard]] virtual int getActorCount(const std::string &type) const = 0;
+
+    /**
+     * @brief Gets the number of actors of each type in this dimension, players excluded.
+     *
+     * @return (type, count) pairs sorted by type
+     */
+    [[nodiscard]] virtual std::vector<std::pair<std::string, int>> getActorCounts() const = 0;
+
+    /**
+     * @brief Spawns a batch of particle effects, each sent only to the viewers within the radius of it.
+     *
+     * The viewers near the particles are looked up once per 16 block cell of the batch rather than once per particle,
+     * and the packet of each particle is serialized once for all its viewers.
+     *
+     * @param particles The particle effects to spawn
+     * @param viewers The players who may see the particles, every player in this dimension if empty
+     * @param radius The distance from a particle within which a viewer sees it
+     */
+    virtual void spawnParticles(const std::vector<ParticleEffect> &particles, const std::vector<Player *> &viewers,
+                                float radius) = 0;
 };
 }  // namespace endstone
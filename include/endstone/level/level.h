@@ -14,12 +14,17 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
+#include <vector>
 
 #include "endstone/actor/actor.h"
+#include "endstone/actor/actor_category.h"
 
 namespace endstone {
 
+class Plugin;
+
 /**
  * @brief Represents a level, which may contain actors, chunks and blocks
  */
@@ -41,6 +46,25 @@ public:
      */
     [[nodiscard]] virtual std::vector<Actor *> getActors() const = 0;
 
+    /**
+     * @brief Visits every actor in this level without building a list first.
+     *
+     * The callback must not spawn or remove actors, defer those until the iteration is over.
+     *
+     * @param callback Called for each actor, return false to stop the iteration
+     */
+    virtual void forEachActor(const std::function<bool(Actor &)> &callback) const = 0;
+
+    /**
+     * @brief Visits every actor in this level that belongs to all the given categories.
+     *
+     * The callback must not spawn or remove actors, defer those until the iteration is over.
+     *
+     * @param categories Categories an actor must have to be visited, e.g. ActorCategory::Zombie | ActorCategory::Mob
+     * @param callback Called for each matching actor, return false to stop the iteration
+     */
+    virtual void forEachActor(ActorCategory categories, const std::function<bool(Actor &)> &callback) const = 0;
+
     /**
      * @brief Gets the relative in-game time of this level.
      *
@@ -51,6 +75,9 @@ public:
     /**
      * @brief Sets the relative in-game time on the server.
      *
+     * With ENDSTONE_TIME_SYNC_INTERVAL set, the time is applied and sent to the players at most once per interval,
+     * unless it jumps by at least ENDSTONE_TIME_SYNC_THRESHOLD. getTime returns the time held back in between.
+     *
      * @param time The new relative time to set the in-game time to
      */
     virtual void setTime(int time) = 0;
@@ -69,6 +96,20 @@ public:
      * @return The Dimension with the given name, or nullptr if none exists
      */
     [[nodiscard]] virtual Dimension *getDimension(std::string name) const = 0;
+
+    /**
+     * @brief Copies the level to a directory while the server keeps running.
+     *
+     * The level storage is held at a consistent snapshot on the server thread, and the files are copied on the I/O
+     * workers of the scheduler. The copy can be opened by offline tools once the callback has been called.
+     *
+     * @param plugin the plugin requesting the backup
+     * @param destination the directory to copy the level to, which must not exist yet
+     * @param callback called on the server thread when the copy is finished, with an empty string on success or the
+     * reason it failed otherwise
+     * @return false if the backup could not be started, e.g. another one is still running
+     */
+    virtual bool backup(Plugin &plugin, std::string destination, std::function<void(std::string)> callback) = 0;
 };
 
 }  // namespace endstone
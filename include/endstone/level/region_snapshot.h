@@ -0,0 +1,231 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace endstone {
+
+/**
+ * @brief A palette compressed copy of the blocks in a cuboid region of a Dimension.
+ *
+ * Each palette entry describes one block state. The indices hold one palette index per block, laid out with z varying
+ * fastest, then y, then x, the same way Dimension::setBlocks expects them.
+ */
+class RegionSnapshot {
+public:
+    /**
+     * @brief Index of a block that was not captured, e.g. because its chunk was not loaded.
+     */
+    static constexpr std::uint16_t Missing = 0xFFFF;
+
+    RegionSnapshot(int min_x, int min_y, int min_z, int size_x, int size_y, int size_z,
+                   std::vector<std::string> palette, std::vector<std::uint16_t> indices)
+        : min_x_(min_x), min_y_(min_y), min_z_(min_z), size_x_(size_x), size_y_(size_y), size_z_(size_z),
+          palette_(std::move(palette)), indices_(std::move(indices))
+    {
+    }
+
+    [[nodiscard]] int getMinX() const
+    {
+        return min_x_;
+    }
+
+    [[nodiscard]] int getMinY() const
+    {
+        return min_y_;
+    }
+
+    [[nodiscard]] int getMinZ() const
+    {
+        return min_z_;
+    }
+
+    [[nodiscard]] int getSizeX() const
+    {
+        return size_x_;
+    }
+
+    [[nodiscard]] int getSizeY() const
+    {
+        return size_y_;
+    }
+
+    [[nodiscard]] int getSizeZ() const
+    {
+        return size_z_;
+    }
+
+    [[nodiscard]] const std::vector<std::string> &getPalette() const
+    {
+        return palette_;
+    }
+
+    [[nodiscard]] const std::vector<std::uint16_t> &getIndices() const
+    {
+        return indices_;
+    }
+
+    /**
+     * @brief Encodes this snapshot into a compact binary form, e.g. to be saved to disk.
+     *
+     * Runs of equal indices are stored once, so large uniform areas such as air take only a few bytes.
+     *
+     * @return Encoded snapshot
+     */
+    [[nodiscard]] std::string serialize() const
+    {
+        std::string out(Magic);
+        out.push_back(static_cast<char>(Version));
+        for (auto value : {min_x_, min_y_, min_z_, size_x_, size_y_, size_z_}) {
+            writeVarInt(out, zigzag(value));
+        }
+        writeVarInt(out, palette_.size());
+        for (const auto &entry : palette_) {
+            writeVarInt(out, entry.size());
+            out.append(entry);
+        }
+        for (std::size_t i = 0; i < indices_.size();) {
+            auto run = i + 1;
+            while (run < indices_.size() && indices_[run] == indices_[i]) {
+                run++;
+            }
+            writeVarInt(out, run - i);
+            writeVarInt(out, indices_[i]);
+            i = run;
+        }
+        return out;
+    }
+
+    /**
+     * @brief Decodes a snapshot produced by serialize().
+     *
+     * @param data Encoded snapshot
+     * @return The decoded snapshot, or std::nullopt if the data is truncated or malformed
+     */
+    static std::optional<RegionSnapshot> deserialize(std::string_view data)
+    {
+        if (data.substr(0, Magic.size()) != Magic || data.size() <= Magic.size() ||
+            static_cast<std::uint8_t>(data[Magic.size()]) != Version) {
+            return std::nullopt;
+        }
+        data.remove_prefix(Magic.size() + 1);
+
+        int values[6];
+        for (auto &value : values) {
+            auto raw = readVarInt(data);
+            if (!raw || *raw > 0xFFFFFFFFULL) {
+                return std::nullopt;
+            }
+            value = unzigzag(static_cast<std::uint32_t>(*raw));
+        }
+        if (values[3] <= 0 || values[4] <= 0 || values[5] <= 0) {
+            return std::nullopt;
+        }
+        std::uint64_t volume = 1;
+        for (auto i = 3; i < 6; i++) {
+            if (volume > std::numeric_limits<std::uint32_t>::max() / static_cast<std::uint64_t>(values[i])) {
+                return std::nullopt;
+            }
+            volume *= static_cast<std::uint64_t>(values[i]);
+        }
+
+        auto palette_size = readVarInt(data);
+        if (!palette_size || *palette_size >= Missing || *palette_size > data.size()) {
+            return std::nullopt;
+        }
+        std::vector<std::string> palette;
+        palette.reserve(*palette_size);
+        for (std::uint64_t i = 0; i < *palette_size; i++) {
+            auto length = readVarInt(data);
+            if (!length || *length > data.size()) {
+                return std::nullopt;
+            }
+            palette.emplace_back(data.substr(0, *length));
+            data.remove_prefix(*length);
+        }
+
+        std::vector<std::uint16_t> indices;
+        while (indices.size() < volume) {
+            auto run = readVarInt(data);
+            auto index = readVarInt(data);
+            if (!run || !index || *run == 0 || *run > volume - indices.size() ||
+                (*index >= palette.size() && *index != Missing)) {
+                return std::nullopt;
+            }
+            indices.insert(indices.end(), *run, static_cast<std::uint16_t>(*index));
+        }
+        if (!data.empty()) {
+            return std::nullopt;
+        }
+        return RegionSnapshot(values[0], values[1], values[2], values[3], values[4], values[5], std::move(palette),
+                              std::move(indices));
+    }
+
+private:
+    static constexpr std::string_view Magic = "ESRS";
+    static constexpr std::uint8_t Version = 1;
+
+    static std::uint32_t zigzag(int value)
+    {
+        return (static_cast<std::uint32_t>(value) << 1) ^ static_cast<std::uint32_t>(-(value < 0));
+    }
+
+    static int unzigzag(std::uint32_t value)
+    {
+        return static_cast<int>((value >> 1) ^ (~(value & 1) + 1));
+    }
+
+    static void writeVarInt(std::string &out, std::uint64_t value)
+    {
+        while (value >= 0x80) {
+            out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<char>(value));
+    }
+
+    static std::optional<std::uint64_t> readVarInt(std::string_view &data)
+    {
+        std::uint64_t value = 0;
+        for (int shift = 0; shift < 64 && !data.empty(); shift += 7) {
+            auto byte = static_cast<std::uint8_t>(data.front());
+            data.remove_prefix(1);
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) {
+                return value;
+            }
+        }
+        return std::nullopt;
+    }
+
+    int min_x_;
+    int min_y_;
+    int min_z_;
+    int size_x_;
+    int size_y_;
+    int size_z_;
+    std::vector<std::string> palette_;
+    std::vector<std::uint16_t> indices_;
+};
+
+}  // namespace endstone
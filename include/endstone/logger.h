@@ -77,6 +77,9 @@ public:
     template <typename... Args>
     void log(Level level, const fmt::format_string<Args...> format, Args &&...args) const
     {
+        if (!isEnabledFor(level)) {
+            return;
+        }
         try {
             log(level, fmt::format(format, std::forward<Args>(args)...));
         }
@@ -0,0 +1,132 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace endstone {
+
+class Plugin;
+
+/**
+ * @brief Carries the messages of a Messenger between servers, over a broker such as Redis or NATS, or the network.
+ *
+ * The methods are called on the I/O workers of the scheduler, one at a time and in the order of the calls to the
+ * Messenger, so implementations may block but need no locking of their own.
+ */
+class MessageTransport {
+public:
+    /**
+     * Takes a message received on a subscribed channel, may be called from any thread.
+     */
+    using Receiver = std::function<void(const std::string &channel, const std::string &payload)>;
+
+    virtual ~MessageTransport() = default;
+
+    /**
+     * @brief Connects the transport, before any other method is called.
+     *
+     * @param receiver Called with every message received on the subscribed channels, until stop returns
+     */
+    virtual void start(Receiver receiver) = 0;
+
+    /**
+     * @brief Disconnects the transport, no other method is called afterwards.
+     */
+    virtual void stop() = 0;
+
+    virtual void subscribe(const std::string &channel) = 0;
+
+    virtual void unsubscribe(const std::string &channel) = 0;
+
+    /**
+     * @brief Sends a message to every server subscribed to the channel.
+     *
+     * The transport may deliver it back to this server, the Messenger discards it.
+     */
+    virtual void publish(const std::string &channel, const std::string &payload) = 0;
+};
+
+/**
+ * @brief Publishes messages to, and receives them from, the other servers of a network on named channels.
+ *
+ * Messages are sent and received on the I/O workers of the scheduler. The messages received are queued and handed to
+ * the subscribers on the server thread at the start of the next tick, all at once.
+ *
+ * All the methods must be called from the server thread.
+ */
+class Messenger {
+public:
+    /**
+     * Handles a message received on a channel, on the server thread.
+     */
+    using Handler = std::function<void(const std::string &channel, const std::string &message)>;
+
+    virtual ~Messenger() = default;
+
+    /**
+     * @brief Sends a message to the other servers subscribed to the channel.
+     *
+     * @param channel Name of the channel
+     * @param message Message to send, any bytes are allowed
+     */
+    virtual void publish(const std::string &channel, std::string message) = 0;
+
+    /**
+     * @brief Subscribes a plugin to a channel, replacing its previous handler for it.
+     *
+     * @param plugin Plugin that handles the messages
+     * @param channel Name of the channel
+     * @param handler Called with each message received on the channel
+     */
+    virtual void subscribe(Plugin &plugin, const std::string &channel, Handler handler) = 0;
+
+    /**
+     * @brief Unsubscribes a plugin from a channel.
+     *
+     * @param plugin Plugin to unsubscribe
+     * @param channel Name of the channel
+     */
+    virtual void unsubscribe(Plugin &plugin, const std::string &channel) = 0;
+
+    /**
+     * @brief Unsubscribes a plugin from every channel, and removes the transport it set.
+     *
+     * @param plugin Plugin to unregister
+     */
+    virtual void unregister(Plugin &plugin) = 0;
+
+    /**
+     * @brief Replaces the transport messages are carried with.
+     *
+     * The transport stays in use until another one is set or the plugin is disabled, then it is stopped and
+     * destroyed before this method or the disabling returns.
+     *
+     * @param plugin Plugin that provides the transport
+     * @param transport The transport
+     */
+    virtual void setTransport(Plugin &plugin, std::unique_ptr<MessageTransport> transport) = 0;
+
+    /**
+     * @brief Gets the ID this server publishes its messages with, taken from ENDSTONE_SERVER_ID if it is set.
+     *
+     * @return The ID of this server
+     */
+    [[nodiscard]] virtual std::string getServerId() const = 0;
+};
+
+}  // namespace endstone
@@ -0,0 +1,252 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#include "endstone/util/vector.h"
+
+namespace endstone {
+
+/**
+ * @brief Reads values from serialized packet data without copying it.
+ *
+ * All reads are bounds-checked. Once a read runs past the end of the data or meets a malformed varint, the reader is
+ * marked as overflowed, the read returns a zero value and every following read does the same, so a packet can be
+ * decoded field by field and checked once at the end.
+ */
+class BinaryStreamReader {
+public:
+    explicit BinaryStreamReader(std::string_view data) : data_(data) {}
+
+    /**
+     * @brief Reads an unsigned byte.
+     *
+     * @return The value read
+     */
+    std::uint8_t readByte()
+    {
+        if (!ensure(1)) {
+            return 0;
+        }
+        return static_cast<std::uint8_t>(data_[position_++]);
+    }
+
+    /**
+     * @brief Reads a boolean stored as a single byte.
+     *
+     * @return The value read
+     */
+    bool readBool()
+    {
+        return readByte() != 0;
+    }
+
+    /**
+     * @brief Reads a little endian unsigned 16-bit integer.
+     *
+     * @return The value read
+     */
+    std::uint16_t readUnsignedShort()
+    {
+        return static_cast<std::uint16_t>(readLittleEndian(2));
+    }
+
+    /**
+     * @brief Reads a little endian signed 32-bit integer.
+     *
+     * @return The value read
+     */
+    std::int32_t readInt()
+    {
+        return static_cast<std::int32_t>(readLittleEndian(4));
+    }
+
+    /**
+     * @brief Reads a little endian 32-bit float.
+     *
+     * @return The value read
+     */
+    float readFloat()
+    {
+        auto bits = static_cast<std::uint32_t>(readLittleEndian(4));
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    /**
+     * @brief Reads three floats as a vector.
+     *
+     * @return The vector read
+     */
+    Vector<float> readVec3()
+    {
+        auto x = readFloat();
+        auto y = readFloat();
+        auto z = readFloat();
+        return {x, y, z};
+    }
+
+    /**
+     * @brief Reads an unsigned varint of at most 32 bits.
+     *
+     * @return The value read
+     */
+    std::uint32_t readUnsignedVarInt()
+    {
+        return static_cast<std::uint32_t>(readVarUInt(5));
+    }
+
+    /**
+     * @brief Reads an unsigned varint of at most 64 bits.
+     *
+     * @return The value read
+     */
+    std::uint64_t readUnsignedVarInt64()
+    {
+        return readVarUInt(10);
+    }
+
+    /**
+     * @brief Reads a zigzag encoded signed varint of at most 32 bits.
+     *
+     * @return The value read
+     */
+    std::int32_t readVarInt()
+    {
+        auto value = readUnsignedVarInt();
+        return static_cast<std::int32_t>(value >> 1) ^ -static_cast<std::int32_t>(value & 1);
+    }
+
+    /**
+     * @brief Reads a zigzag encoded signed varint of at most 64 bits.
+     *
+     * @return The value read
+     */
+    std::int64_t readVarInt64()
+    {
+        auto value = readUnsignedVarInt64();
+        return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+    }
+
+    /**
+     * @brief Reads a string prefixed with its length as an unsigned varint.
+     *
+     * @return A view into the underlying data, valid for as long as the data is
+     */
+    std::string_view readString()
+    {
+        auto length = readUnsignedVarInt();
+        if (!ensure(length)) {
+            return {};
+        }
+        auto value = data_.substr(position_, length);
+        position_ += length;
+        return value;
+    }
+
+    /**
+     * @brief Skips over a number of bytes.
+     *
+     * @param size The number of bytes to skip
+     */
+    void skip(std::size_t size)
+    {
+        if (ensure(size)) {
+            position_ += size;
+        }
+    }
+
+    /**
+     * @brief Gets the number of bytes read so far.
+     *
+     * @return The read position
+     */
+    [[nodiscard]] std::size_t getPosition() const
+    {
+        return position_;
+    }
+
+    /**
+     * @brief Gets the number of bytes left to read.
+     *
+     * @return The remaining size
+     */
+    [[nodiscard]] std::size_t getRemaining() const
+    {
+        return data_.size() - position_;
+    }
+
+    /**
+     * @brief Checks whether a read went past the end of the data or met a malformed value.
+     *
+     * @return true if the reader has overflowed
+     */
+    [[nodiscard]] bool hasOverflowed() const
+    {
+        return overflowed_;
+    }
+
+private:
+    bool ensure(std::size_t size)
+    {
+        if (overflowed_ || size > data_.size() - position_) {
+            overflowed_ = true;
+            return false;
+        }
+        return true;
+    }
+
+    std::uint64_t readLittleEndian(std::size_t size)
+    {
+        if (!ensure(size)) {
+            return 0;
+        }
+        std::uint64_t value = 0;
+        for (std::size_t i = 0; i < size; ++i) {
+            value |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(data_[position_ + i])) << (8 * i);
+        }
+        position_ += size;
+        return value;
+    }
+
+    std::uint64_t readVarUInt(std::size_t max_bytes)
+    {
+        std::uint64_t value = 0;
+        for (std::size_t i = 0; i < max_bytes; ++i) {
+            if (!ensure(1)) {
+                return 0;
+            }
+            auto byte = static_cast<std::uint8_t>(data_[position_++]);
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << (7 * i);
+            if ((byte & 0x80) == 0) {
+                return value;
+            }
+        }
+        // Too many continuation bytes for the type
+        overflowed_ = true;
+        return 0;
+    }
+
+    std::string_view data_;
+    std::size_t position_{0};
+    bool overflowed_{false};
+};
+
+}  // namespace endstone
@@ -0,0 +1,176 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "endstone/util/vector.h"
+
+namespace endstone {
+
+/**
+ * @brief Overwrites values in serialized packet data in place.
+ *
+ * The writer never changes the size of the data, so only fixed width values can be written. A field is usually found
+ * with a BinaryStreamReader over the same data first, then the writer is moved to the position of that field.
+ *
+ * All writes are bounds-checked. Once a write runs past the end of the data the writer is marked as overflowed, the
+ * write leaves the data untouched and every following write does the same.
+ */
+class BinaryStreamWriter {
+public:
+    BinaryStreamWriter(char *data, std::size_t size) : data_(data), size_(size) {}
+
+    /**
+     * @brief Writes an unsigned byte.
+     *
+     * @param value The value to write
+     */
+    void writeByte(std::uint8_t value)
+    {
+        writeLittleEndian(value, 1);
+    }
+
+    /**
+     * @brief Writes a boolean as a single byte.
+     *
+     * @param value The value to write
+     */
+    void writeBool(bool value)
+    {
+        writeByte(value ? 1 : 0);
+    }
+
+    /**
+     * @brief Writes a little endian unsigned 16-bit integer.
+     *
+     * @param value The value to write
+     */
+    void writeUnsignedShort(std::uint16_t value)
+    {
+        writeLittleEndian(value, 2);
+    }
+
+    /**
+     * @brief Writes a little endian signed 32-bit integer.
+     *
+     * @param value The value to write
+     */
+    void writeInt(std::int32_t value)
+    {
+        writeLittleEndian(static_cast<std::uint32_t>(value), 4);
+    }
+
+    /**
+     * @brief Writes a little endian 32-bit float.
+     *
+     * @param value The value to write
+     */
+    void writeFloat(float value)
+    {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        writeLittleEndian(bits, 4);
+    }
+
+    /**
+     * @brief Writes a vector as three floats.
+     *
+     * @param value The vector to write
+     */
+    void writeVec3(const Vector<float> &value)
+    {
+        if (!ensure(12)) {
+            return;
+        }
+        writeFloat(value.getX());
+        writeFloat(value.getY());
+        writeFloat(value.getZ());
+    }
+
+    /**
+     * @brief Moves the writer to a position in the data, such as one taken from a BinaryStreamReader.
+     *
+     * @param position The position of the next write
+     */
+    void seek(std::size_t position)
+    {
+        if (position > size_) {
+            overflowed_ = true;
+            return;
+        }
+        position_ = position;
+    }
+
+    /**
+     * @brief Gets the position of the next write.
+     *
+     * @return The write position
+     */
+    [[nodiscard]] std::size_t getPosition() const
+    {
+        return position_;
+    }
+
+    /**
+     * @brief Gets the number of bytes after the write position.
+     *
+     * @return The remaining size
+     */
+    [[nodiscard]] std::size_t getRemaining() const
+    {
+        return size_ - position_;
+    }
+
+    /**
+     * @brief Checks whether a write or a seek went past the end of the data.
+     *
+     * @return true if the writer has overflowed
+     */
+    [[nodiscard]] bool hasOverflowed() const
+    {
+        return overflowed_;
+    }
+
+private:
+    bool ensure(std::size_t size)
+    {
+        if (overflowed_ || size > size_ - position_) {
+            overflowed_ = true;
+            return false;
+        }
+        return true;
+    }
+
+    void writeLittleEndian(std::uint64_t value, std::size_t size)
+    {
+        if (!ensure(size)) {
+            return;
+        }
+        for (std::size_t i = 0; i < size; ++i) {
+            data_[position_ + i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+        }
+        position_ += size;
+    }
+
+    char *data_;
+    std::size_t size_;
+    std::size_t position_{0};
+    bool overflowed_{false};
+};
+
+}  // namespace endstone
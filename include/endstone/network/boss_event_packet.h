@@ -0,0 +1,62 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "endstone/boss/bar_color.h"
+#include "endstone/boss/bar_style.h"
+#include "endstone/network/packet.h"
+#include "endstone/network/packet_type.h"
+
+namespace endstone {
+
+/**
+ * @brief Represents a packet for showing, updating or hiding a boss bar.
+ */
+class BossEventPacket final : public Packet {
+public:
+    enum class EventType : std::uint32_t {
+        Add = 0,
+        PlayerAdded = 1,
+        Remove = 2,
+        PlayerRemoved = 3,
+        UpdatePercent = 4,
+        UpdateName = 5,
+        UpdateProperties = 6,
+        UpdateStyle = 7,
+        Query = 8,
+    };
+
+    [[nodiscard]] PacketType getType() const override
+    {
+        return PacketType::BossEvent;
+    }
+
+    std::int64_t boss_actor_id{-1};
+    EventType event_type{EventType::Add};
+    /**
+     * The player the event is about, only sent for PlayerAdded, PlayerRemoved and Query.
+     */
+    std::int64_t player_actor_id{-1};
+    std::string title;
+    float progress{1.0F};
+    bool darken_sky{false};
+    BarColor color{BarColor::Purple};
+    BarStyle style{BarStyle::Solid};
+};
+
+}  // namespace endstone
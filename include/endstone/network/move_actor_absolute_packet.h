@@ -0,0 +1,48 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "endstone/network/packet.h"
+#include "endstone/network/packet_type.h"
+#include "endstone/util/vector.h"
+
+namespace endstone {
+
+/**
+ * @brief Represents a packet for moving an actor to an absolute position.
+ */
+class MoveActorAbsolutePacket final : public Packet {
+public:
+    [[nodiscard]] PacketType getType() const override
+    {
+        return PacketType::MoveActorAbsolute;
+    }
+
+    std::uint64_t actor_runtime_id{0};
+    Vector<float> position;
+    /**
+     * The rotation in degrees, sent with a precision of 360/256 degrees.
+     */
+    float pitch{0};
+    float yaw{0};
+    float head_yaw{0};
+    bool on_ground{false};
+    bool teleported{false};
+    bool force_move{false};
+};
+
+}  // namespace endstone
@@ -0,0 +1,71 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+namespace endstone {
+
+/**
+ * @brief Represents the network statistics of a player's connection.
+ */
+struct NetworkStats {
+    /**
+     * @brief Total bytes sent on the connection, including protocol overhead and resends.
+     */
+    std::uint64_t bytes_sent{0};
+
+    /**
+     * @brief Total bytes received on the connection, including protocol overhead.
+     */
+    std::uint64_t bytes_received{0};
+
+    /**
+     * @brief Bytes sent during the last second.
+     */
+    std::uint64_t bytes_sent_per_second{0};
+
+    /**
+     * @brief Bytes received during the last second.
+     */
+    std::uint64_t bytes_received_per_second{0};
+
+    /**
+     * @brief Total bytes of messages that had to be resent.
+     */
+    std::uint64_t bytes_resent{0};
+
+    /**
+     * @brief Fraction of datagrams lost during the last second, between 0 and 1.
+     */
+    float packet_loss{0};
+
+    /**
+     * @brief Fraction of datagrams lost since the connection started, between 0 and 1.
+     */
+    float packet_loss_total{0};
+
+    /**
+     * @brief Number of messages waiting to be sent.
+     */
+    std::uint32_t send_queue_size{0};
+
+    /**
+     * @brief Number of sent messages waiting for an acknowledgement.
+     */
+    std::uint32_t resend_queue_size{0};
+};
+
+}  // namespace endstone
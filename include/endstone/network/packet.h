@@ -20,6 +20,9 @@ namespace endstone {
 
 /**
  * @brief Represents a packet.
+ *
+ * Packets are plain values encoded straight into the network stream when sent, so a packet can be kept and its fields
+ * updated between sends without allocating a new one each time.
  */
 class Packet {
 public:
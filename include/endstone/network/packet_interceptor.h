@@ -0,0 +1,78 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <functional>
+
+#include "endstone/network/binary_stream_reader.h"
+#include "endstone/network/binary_stream_writer.h"
+
+namespace endstone {
+
+class Plugin;
+
+/**
+ * @brief Filters and rewrites the packets received from clients, by packet id, before they are deserialized.
+ *
+ * Handlers are kept in a table indexed by packet id, so a packet whose id has no handler costs a single load. Unlike
+ * PacketReceiveEvent, a handler only runs for the packet id it was added for and may change the packet body in place.
+ *
+ * Handlers run on the network thread and must not call into the rest of the API. The handlers of a plugin are removed
+ * when it is disabled. The other methods must be called from the server thread.
+ */
+class PacketInterceptor {
+public:
+    /**
+     * Handles a packet body, read through the reader and overwritten through the writer, which share the same data.
+     * Returning false drops the packet without deserializing or handling it, and the next handlers are not called.
+     */
+    using Handler = std::function<bool(int sub_client_id, BinaryStreamReader &reader, BinaryStreamWriter &writer)>;
+
+    virtual ~PacketInterceptor() = default;
+
+    /**
+     * @brief Adds a handler for the packets with the given id, called after the handlers added before it.
+     *
+     * @param plugin The plugin the handler belongs to
+     * @param packet_id The id of the packets to handle
+     * @param handler The handler
+     */
+    virtual void addHandler(Plugin &plugin, int packet_id, Handler handler) = 0;
+
+    /**
+     * @brief Removes the handlers of a plugin for the packets with the given id.
+     *
+     * @param plugin The plugin the handlers belong to
+     * @param packet_id The id of the packets
+     */
+    virtual void removeHandlers(Plugin &plugin, int packet_id) = 0;
+
+    /**
+     * @brief Removes all the handlers of a plugin.
+     *
+     * @param plugin The plugin the handlers belong to
+     */
+    virtual void unregister(Plugin &plugin) = 0;
+
+    /**
+     * @brief Checks whether any handler is added for the packets with the given id.
+     *
+     * @param packet_id The id of the packets
+     * @return true if the packets have a handler
+     */
+    [[nodiscard]] virtual bool hasHandlers(int packet_id) const = 0;
+};
+
+}  // namespace endstone
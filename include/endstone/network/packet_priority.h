@@ -0,0 +1,37 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+namespace endstone {
+
+/**
+ * @brief Represents how urgently the packets sent by the server to a player are delivered.
+ */
+enum class PacketPriority {
+    /**
+     * Sent right away, regardless of the bandwidth limit of the player.
+     */
+    Critical,
+    /**
+     * Sent right away while the player is within its bandwidth limit, held back in order otherwise.
+     */
+    Normal,
+    /**
+     * Like Normal, and also held back while the send queue of the player's connection is deep.
+     */
+    Bulk,
+};
+
+}  // namespace endstone
@@ -19,6 +19,13 @@ namespace endstone {
  * @brief Represents the types of packets.
  */
 enum class PacketType {
-    SpawnParticleEffect = 118
+    Text = 9,
+    RemoveActor = 14,
+    MoveActorAbsolute = 18,
+    BossEvent = 74,
+    SetTitle = 88,
+    SetScore = 108,
+    SpawnParticleEffect = 118,
+    ToastRequest = 186,
 };
 }  // namespace endstone
@@ -0,0 +1,63 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "endstone/network/packet.h"
+#include "endstone/network/packet_type.h"
+
+namespace endstone {
+
+/**
+ * @brief Represents a packet for changing or removing scores shown on a scoreboard.
+ */
+class SetScorePacket final : public Packet {
+public:
+    enum class Action : std::uint8_t {
+        Change = 0,
+        Remove = 1,
+    };
+
+    enum class IdentityType : std::uint8_t {
+        Player = 1,
+        Actor = 2,
+        FakePlayer = 3,
+    };
+
+    struct Entry {
+        std::int64_t scoreboard_id{0};
+        std::string objective_name;
+        std::int32_t score{0};
+        /**
+         * Who the score belongs to, only sent for Change.
+         */
+        IdentityType identity_type{IdentityType::FakePlayer};
+        std::int64_t actor_id{-1};
+        std::string fake_player_name;
+    };
+
+    [[nodiscard]] PacketType getType() const override
+    {
+        return PacketType::SetScore;
+    }
+
+    Action action{Action::Change};
+    std::vector<Entry> entries;
+};
+
+}  // namespace endstone
@@ -0,0 +1,60 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "endstone/network/packet.h"
+#include "endstone/network/packet_type.h"
+
+namespace endstone {
+
+/**
+ * @brief Represents a packet for showing a title, subtitle or action bar message.
+ */
+class SetTitlePacket final : public Packet {
+public:
+    enum class TitleType : std::int32_t {
+        Clear = 0,
+        Reset = 1,
+        Title = 2,
+        Subtitle = 3,
+        ActionBar = 4,
+        Times = 5,
+        TitleTextObject = 6,
+        SubtitleTextObject = 7,
+        ActionBarTextObject = 8,
+    };
+
+    [[nodiscard]] PacketType getType() const override
+    {
+        return PacketType::SetTitle;
+    }
+
+    TitleType title_type{TitleType::Title};
+    std::string text;
+    /**
+     * The fade in, stay and fade out times in ticks, only used by the client for Times.
+     */
+    int fade_in_time{10};
+    int stay_time{70};
+    int fade_out_time{20};
+    std::string xuid;
+    std::string platform_online_id;
+    std::string filtered_text;
+};
+
+}  // namespace endstone
@@ -0,0 +1,67 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "endstone/network/packet.h"
+#include "endstone/network/packet_type.h"
+
+namespace endstone {
+
+/**
+ * @brief Represents a packet for sending a chat, system or popup message.
+ */
+class TextPacket final : public Packet {
+public:
+    enum class TextType : std::uint8_t {
+        Raw = 0,
+        Chat = 1,
+        Translation = 2,
+        Popup = 3,
+        JukeboxPopup = 4,
+        Tip = 5,
+        System = 6,
+        Whisper = 7,
+        Announcement = 8,
+        ObjectWhisper = 9,
+        Object = 10,
+        ObjectAnnouncement = 11,
+    };
+
+    [[nodiscard]] PacketType getType() const override
+    {
+        return PacketType::Text;
+    }
+
+    TextType text_type{TextType::Raw};
+    bool needs_translation{false};
+    /**
+     * The name of the sender, only sent for Chat, Whisper and Announcement messages.
+     */
+    std::string source_name;
+    std::string message;
+    /**
+     * The translation parameters, only sent for Translation, Popup and JukeboxPopup messages.
+     */
+    std::vector<std::string> parameters;
+    std::string xuid;
+    std::string platform_id;
+    std::string filtered_message;
+};
+
+}  // namespace endstone
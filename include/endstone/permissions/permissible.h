@@ -113,6 +113,19 @@ public:
      */
     virtual void recalculatePermissions() = 0;
 
+    /**
+     * Recalculates the permissions for this object after a single permission of one of its attachments was set.
+     * Implementations may update only the permissions affected by the change, the default recalculates all of them.
+     *
+     * @param attachment Attachment whose permission was set
+     * @param name Lowercase name of the permission that was set
+     * @param value New value of the permission
+     */
+    virtual void recalculatePermission(PermissionAttachment &attachment, const std::string &name, bool value)
+    {
+        recalculatePermissions();
+    }
+
     /**
      * Gets a set containing all of the permissions currently in effect by this object
      *
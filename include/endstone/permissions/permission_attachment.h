@@ -96,7 +96,7 @@ public:
     {
         std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
         permissions_[name] = value;
-        permissible_.recalculatePermissions();
+        permissible_.recalculatePermission(*this, name, value);
     }
 
     /**
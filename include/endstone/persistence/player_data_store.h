@@ -0,0 +1,86 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "endstone/util/uuid.h"
+
+namespace endstone {
+
+class Plugin;
+
+/**
+ * @brief Stores blobs of data per player, in a namespace per plugin, and persists them in the background.
+ *
+ * Reads and writes are served from memory and never block. Writes are queued, batched across players and plugins,
+ * and appended to a log on disk from the I/O workers of the scheduler. Queued writes are flushed when the server
+ * stops, within a bounded time.
+ *
+ * All the methods must be called from the server thread.
+ */
+class PlayerDataStore {
+public:
+    virtual ~PlayerDataStore() = default;
+
+    /**
+     * @brief Gets a value stored for a player.
+     *
+     * @param plugin Plugin that owns the value
+     * @param player_id Unique ID of the player
+     * @param key Key of the value
+     * @return The value, or nullopt if none is stored
+     */
+    [[nodiscard]] virtual std::optional<std::string> get(const Plugin &plugin, const UUID &player_id,
+                                                         const std::string &key) const = 0;
+
+    /**
+     * @brief Stores a value for a player, replacing the previous one.
+     *
+     * @param plugin Plugin that owns the value
+     * @param player_id Unique ID of the player
+     * @param key Key of the value
+     * @param value Value to store, any bytes are allowed
+     */
+    virtual void set(const Plugin &plugin, const UUID &player_id, const std::string &key, std::string value) = 0;
+
+    /**
+     * @brief Removes a value stored for a player.
+     *
+     * @param plugin Plugin that owns the value
+     * @param player_id Unique ID of the player
+     * @param key Key of the value
+     * @return true if a value was stored
+     */
+    virtual bool remove(const Plugin &plugin, const UUID &player_id, const std::string &key) = 0;
+
+    /**
+     * @brief Gets the keys of all the values a plugin stores for a player.
+     *
+     * @param plugin Plugin that owns the values
+     * @param player_id Unique ID of the player
+     * @return The keys, sorted
+     */
+    [[nodiscard]] virtual std::vector<std::string> getKeys(const Plugin &plugin, const UUID &player_id) const = 0;
+
+    /**
+     * @brief Hands the queued writes to the I/O workers now rather than with the next batch.
+     */
+    virtual void flush() = 0;
+};
+
+}  // namespace endstone
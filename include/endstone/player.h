@@ -15,14 +15,18 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
+#include <optional>
 #include <variant>
 
 #include "endstone/actor/mob.h"
+#include "endstone/actor/movement_stats.h"
 #include "endstone/form/action_form.h"
 #include "endstone/form/message_form.h"
 #include "endstone/form/modal_form.h"
 #include "endstone/game_mode.h"
 #include "endstone/inventory/player_inventory.h"
+#include "endstone/network/network_stats.h"
 #include "endstone/network/spawn_particle_effect_packet.h"
 #include "endstone/scoreboard/scoreboard.h"
 #include "endstone/skin.h"
@@ -39,6 +43,38 @@ protected:
     using FormVariant = std::variant<MessageForm, ActionForm, ModalForm>;
 
 public:
+    /**
+     * @brief The state of a player as of the end of a server tick.
+     *
+     * The server publishes a new snapshot of every online player after each tick. Unlike the other getters of a
+     * player, it may be read from any thread, e.g. by asynchronous tasks, and its fields always come from the same
+     * tick.
+     */
+    struct Snapshot {
+        /**
+         * @brief The tick the snapshot was taken at the end of.
+         */
+        std::uint64_t tick{0};
+
+        float x{0};
+        float y{0};
+        float z{0};
+        float pitch{0};
+        float yaw{0};
+
+        /**
+         * @brief The Dimension::Type of the dimension the player is in.
+         */
+        int dimension{0};
+
+        GameMode game_mode{GameMode::Survival};
+
+        /**
+         * @brief The average ping of the player's connection.
+         */
+        std::chrono::milliseconds ping{0};
+    };
+
     Player() = default;
     Player(const Player &) = delete;
     Player &operator=(const Player &) = delete;
@@ -263,6 +299,29 @@ public:
      */
     [[nodiscard]] virtual std::chrono::milliseconds getPing() const = 0;
 
+    /**
+     * @brief Gets the statistics of the player's network connection
+     *
+     * @return network statistics
+     */
+    [[nodiscard]] virtual NetworkStats getNetworkStats() const = 0;
+
+    /**
+     * @brief Gets the statistics of the player's movement during the last second
+     *
+     * @return movement statistics
+     */
+    [[nodiscard]] virtual MovementStats getMovementStats() const = 0;
+
+    /**
+     * @brief Gets the state of the player as of the end of the last tick
+     *
+     * Unlike the other methods of a player, this may be called from any thread while the player is online.
+     *
+     * @return the last snapshot published by the server
+     */
+    [[nodiscard]] virtual Snapshot getSnapshot() const = 0;
+
     /**
      * @brief Send the list of commands to the client.
      *
@@ -335,6 +394,95 @@ public:
      */
     virtual void transfer(std::string host, int port) const = 0;
 
+    /**
+     * @brief Transfers the player to another server of the network, handing off the player ahead of the connection
+     *
+     * The values plugins store for the player in the PlayerDataStore are sent to the target server through the
+     * Messenger, which replaces its own with them and calls a PlayerHandoffEvent before the player connects.
+     *
+     * @param host Server address to transfer the player to.
+     * @param port Server port to transfer the player to
+     * @param server_id ID of the target server in the Messenger
+     */
+    virtual void transfer(std::string host, int port, const std::string &server_id) const = 0;
+
+    /**
+     * @brief Gets the maximum view distance set for this player by plugins.
+     *
+     * @return The maximum view distance in chunks, or std::nullopt if there is none
+     */
+    [[nodiscard]] virtual std::optional<int> getViewDistance() const = 0;
+
+    /**
+     * @brief Sets the maximum view distance of this player, limiting the chunks the server sends to the client.
+     *
+     * The client keeps a lower view distance if it asks for one, and the server's own limits still apply.
+     *
+     * @param distance The maximum view distance in chunks, or std::nullopt to remove it
+     */
+    virtual void setViewDistance(std::optional<int> distance) = 0;
+
+    /**
+     * @brief Hides an actor from this player, until it is shown again with showActor.
+     *
+     * The actor is removed from the client and is removed again whenever vanilla sends it back, such as when it comes
+     * back into range. A player cannot hide itself.
+     *
+     * @param actor The actor to hide
+     */
+    virtual void hideActor(Actor &actor) = 0;
+
+    /**
+     * @brief Shows an actor to this player that was hidden with hideActor.
+     *
+     * @param actor The actor to show
+     */
+    virtual void showActor(Actor &actor) = 0;
+
+    /**
+     * @brief Checks whether this player can see an actor, meaning it is not hidden with hideActor.
+     *
+     * @param actor The actor to check
+     * @return true if the actor is not hidden from this player
+     */
+    [[nodiscard]] virtual bool canSee(const Actor &actor) const = 0;
+
+    /**
+     * @brief Gets the distance beyond which actors are not shown to this player.
+     *
+     * @return The distance in blocks, or std::nullopt if actors are shown at any distance the server sends them
+     */
+    [[nodiscard]] virtual std::optional<float> getActorCullDistance() const = 0;
+
+    /**
+     * @brief Sets the distance beyond which actors are not shown to this player, lowering the load of the client in
+     * crowded places.
+     *
+     * Actors are culled and shown again from the server tick, a few times a second.
+     *
+     * @param distance The distance in blocks, or std::nullopt to show actors at any distance
+     */
+    virtual void setActorCullDistance(std::optional<float> distance) = 0;
+
+    /**
+     * @brief Gets the bandwidth limit of the packets the API sends to this player.
+     *
+     * @return The limit in bytes per second, or std::nullopt if there is none
+     */
+    [[nodiscard]] virtual std::optional<int> getBandwidthLimit() const = 0;
+
+    /**
+     * @brief Sets the bandwidth limit of the packets the API sends to this player.
+     *
+     * Over the limit, the packets of normal and bulk priority are held back and sent in order from the following ticks,
+     * critical packets are always sent. Bulk packets are also held back while the connection has many messages
+     * waiting to be sent, with or without a limit.
+     *
+     * @param bytes_per_second The limit in bytes per second, or std::nullopt to remove it
+     * @see Server::setPacketPriority
+     */
+    virtual void setBandwidthLimit(std::optional<int> bytes_per_second) = 0;
+
     /**
      * @brief Sends a form to the player.
      *
@@ -353,6 +501,22 @@ public:
      * @param packet The packet to be sent.
      */
     virtual void sendPacket(Packet &packet) = 0;
+
+    /**
+     * @brief Starts batching the packets sent to the player.
+     *
+     * Until the matching call to endBatch, packets passed to sendPacket are held back instead of being sent. Batches
+     * can be nested, in which case packets are held until the outermost batch ends.
+     */
+    virtual void beginBatch() = 0;
+
+    /**
+     * @brief Ends a batch started with beginBatch.
+     *
+     * When the outermost batch ends, the held packets are sent in order and flushed to the client in one network
+     * batch.
+     */
+    virtual void endBatch() = 0;
 };
 
 }  // namespace endstone
@@ -0,0 +1,95 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "endstone/player.h"
+#include "endstone/util/uuid.h"
+
+namespace endstone {
+
+/**
+ * @brief A reference to a Player that keeps a copy of the data which never changes while the player is online.
+ *
+ * The unique id, name, XUID and runtime id of a player are each a virtual call, with a string copy for the name and
+ * the XUID. A handle reads them once when it is made and returns them inline afterwards, which suits plugins that
+ * keep their own per-player state and look it up every tick.
+ *
+ * A handle does not extend the lifetime of the player, it must be dropped when the player quits.
+ */
+class PlayerHandle {
+public:
+    explicit PlayerHandle(Player &player)
+        : player_(&player), unique_id_(player.getUniqueId()), runtime_id_(player.getRuntimeId()),
+          name_(player.getName()), xuid_(player.getXuid())
+    {
+    }
+
+    [[nodiscard]] Player &getPlayer() const
+    {
+        return *player_;
+    }
+
+    Player *operator->() const
+    {
+        return player_;
+    }
+
+    Player &operator*() const
+    {
+        return *player_;
+    }
+
+    [[nodiscard]] const UUID &getUniqueId() const
+    {
+        return unique_id_;
+    }
+
+    [[nodiscard]] std::uint64_t getRuntimeId() const
+    {
+        return runtime_id_;
+    }
+
+    [[nodiscard]] const std::string &getName() const
+    {
+        return name_;
+    }
+
+    [[nodiscard]] const std::string &getXuid() const
+    {
+        return xuid_;
+    }
+
+    bool operator==(const PlayerHandle &other) const
+    {
+        return player_ == other.player_;
+    }
+
+    bool operator!=(const PlayerHandle &other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+    Player *player_;
+    UUID unique_id_;
+    std::uint64_t runtime_id_;
+    std::string name_;
+    std::string xuid_;
+};
+
+}  // namespace endstone
@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <filesystem>
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -24,9 +25,11 @@
 
 #include "endstone/command/command_executor.h"
 #include "endstone/detail/plugin/plugin_description_builder.h"
+#include "endstone/event/event_executor.h"
 #include "endstone/logger.h"
 #include "endstone/permissions/permission.h"
 #include "endstone/plugin/plugin_description.h"
+#include "endstone/plugin/server_api.h"
 #include "endstone/server.h"
 
 namespace endstone {
@@ -117,6 +120,21 @@ public:
         return *server_;
     }
 
+    /**
+     * @brief Returns the services of the Server running this plugin, looked up once and kept for the library of the
+     * plugin.
+     *
+     * The table is not a member, so that the layout of Plugin stays the same for plugins built against older headers.
+     * The first call must be made on the server thread, such as from onLoad or onEnable.
+     *
+     * @return the services of the server
+     */
+    [[nodiscard]] const ServerApi &getServerApi() const
+    {
+        static const ServerApi server_api{getServer()};
+        return server_api;
+    }
+
     /**
      * @brief Returns the name of the plugin.
      *
@@ -158,8 +176,7 @@ public:
                        bool ignore_cancelled = false)
     {
         getServer().getPluginManager().registerEvent(
-            EventType::NAME, [func, &instance](Event &e) { (instance.*func)(static_cast<EventType &>(e)); }, priority,
-            *this, ignore_cancelled);
+            EventType::NAME, EventExecutor::create<EventType>(func, instance), priority, *this, ignore_cancelled);
     }
 
     template <typename EventType>
@@ -167,8 +184,7 @@ public:
                        bool ignore_cancelled = false)
     {
         getServer().getPluginManager().registerEvent(
-            EventType::NAME, [func](Event &e) { func(static_cast<EventType &>(e)); }, priority, *this,
-            ignore_cancelled);
+            EventType::NAME, EventExecutor::create<EventType>(std::move(func)), priority, *this, ignore_cancelled);
     }
 
 protected:
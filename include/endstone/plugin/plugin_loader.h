@@ -94,6 +94,20 @@ public:
         }
     }
 
+    /**
+     * Unloads the specified plugin and loads it again from the same source
+     *
+     * The plugin must be disabled and unregistered from the server beforehand, it is destroyed by this call.
+     *
+     * @param plugin Plugin to reload
+     * @return The new instance of the plugin, or nullptr if it could not be loaded again or if this loader does not
+     * support reloading a single plugin
+     */
+    [[nodiscard]] virtual Plugin *reloadPlugin(Plugin &plugin)
+    {
+        return nullptr;
+    }
+
     /**
      * @brief Retrieves the Server object associated with the PluginLoader.
      *
@@ -14,13 +14,16 @@
 
 #pragma once
 
-#include <functional>
+#include <atomic>
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "endstone/event/event.h"
+#include "endstone/event/event_executor.h"
 #include "endstone/event/event_priority.h"
+#include "endstone/event/event_timing.h"
 
 namespace endstone {
 
@@ -135,9 +138,58 @@ public:
      * @param ignore_cancelled Do not call executor if event was already
      *     cancelled
      */
-    virtual void registerEvent(std::string event, std::function<void(Event &)> executor, EventPriority priority,
+    virtual void registerEvent(std::string event, EventExecutor executor, EventPriority priority,
                                Plugin &plugin, bool ignore_cancelled) = 0;
 
+    /**
+     * Checks whether any handler is registered for the given event type.
+     *
+     * Callers can use this to skip constructing an event that no plugin listens to.
+     *
+     * @tparam EventType Event type to check, declared with ENDSTONE_EVENT
+     * @return true if at least one handler is registered
+     */
+    template <typename EventType>
+    [[nodiscard]] bool hasListeners() const
+    {
+        return hasListeners(EventType::NAME, EventType::getStaticEventTypeSlot());
+    }
+
+    /**
+     * Checks whether any handler is registered for the given event type.
+     *
+     * @param event Event name to check
+     * @param type_slot Slot caching the interned type id of the event
+     * @return true if at least one handler is registered
+     */
+    [[nodiscard]] virtual bool hasListeners(const std::string &event, std::atomic<std::size_t> &type_slot) const = 0;
+
+    /**
+     * Enables or disables recording of event handler timings.
+     *
+     * @param enabled true to start recording timings, false to stop
+     */
+    virtual void setTimingsEnabled(bool enabled) = 0;
+
+    /**
+     * Checks whether event handler timings are being recorded.
+     *
+     * @return true if timings are enabled
+     */
+    [[nodiscard]] virtual bool isTimingsEnabled() const = 0;
+
+    /**
+     * Gets the event handler timings recorded since timings were last reset.
+     *
+     * @return Timings aggregated per plugin, event type and priority
+     */
+    [[nodiscard]] virtual std::vector<EventTiming> getEventTimings() const = 0;
+
+    /**
+     * Discards all recorded event handler timings.
+     */
+    virtual void resetTimings() = 0;
+
     /**
      * Gets a Permission from its fully qualified name
      *
@@ -0,0 +1,82 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "endstone/server.h"
+
+namespace endstone {
+
+class PluginManager;
+class Scheduler;
+
+/**
+ * @brief A table of the services of the server, resolved once for a plugin.
+ *
+ * Each getter of Server is a virtual call into the server library, and a chain such as
+ * `getServer().getPluginManager()` pays for every hop on each call. The services returned by those getters live as
+ * long as the server, so this table looks them up once and hands them out with a plain load afterwards. The level
+ * and the scoreboard are not included, as they are created and replaced while the server runs.
+ *
+ * @see Plugin::getServerApi
+ */
+class ServerApi {
+public:
+    explicit ServerApi(Server &server)
+        : server_(&server), logger_(&server.getLogger()), plugin_manager_(&server.getPluginManager()),
+          scheduler_(&server.getScheduler()), player_data_store_(&server.getPlayerDataStore()),
+          messenger_(&server.getMessenger())
+    {
+    }
+
+    [[nodiscard]] Server &getServer() const
+    {
+        return *server_;
+    }
+
+    [[nodiscard]] Logger &getLogger() const
+    {
+        return *logger_;
+    }
+
+    [[nodiscard]] PluginManager &getPluginManager() const
+    {
+        return *plugin_manager_;
+    }
+
+    [[nodiscard]] Scheduler &getScheduler() const
+    {
+        return *scheduler_;
+    }
+
+    [[nodiscard]] PlayerDataStore &getPlayerDataStore() const
+    {
+        return *player_data_store_;
+    }
+
+    [[nodiscard]] Messenger &getMessenger() const
+    {
+        return *messenger_;
+    }
+
+private:
+    Server *server_;
+    Logger *logger_;
+    PluginManager *plugin_manager_;
+    Scheduler *scheduler_;
+    PlayerDataStore *player_data_store_;
+    Messenger *messenger_;
+};
+
+}  // namespace endstone
@@ -0,0 +1,238 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include "endstone/plugin/plugin.h"
+#include "endstone/scheduler/scheduler.h"
+
+namespace endstone {
+
+/**
+ * @brief Represents a plugin job that runs across several server ticks, possibly switching threads.
+ *
+ * A function returning a Coroutine may suspend itself with `co_await ticks(n)`, `co_await nextTick()`,
+ * `co_await async()` and `co_await sync()`. It does not start until it is passed to runCoroutine.
+ *
+ * @remark Only available to plugins compiled with C++20 coroutines, on top of the public Scheduler API.
+ */
+class Coroutine {
+public:
+    struct promise_type {
+        Coroutine get_return_object()
+        {
+            return Coroutine{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+        std::suspend_always initial_suspend() noexcept
+        {
+            return {};
+        }
+        std::suspend_never final_suspend() noexcept
+        {
+            return {};
+        }
+        void return_void() {}
+        void unhandled_exception()
+        {
+            try {
+                std::rethrow_exception(std::current_exception());
+            }
+            catch (std::exception &e) {
+                plugin->getLogger().error("Unhandled exception in coroutine: {}", e.what());
+            }
+            catch (...) {
+                plugin->getLogger().error("Unhandled exception in coroutine");
+            }
+        }
+
+        Scheduler *scheduler{nullptr};
+        Plugin *plugin{nullptr};
+    };
+
+    Coroutine(const Coroutine &) = delete;
+    Coroutine &operator=(const Coroutine &) = delete;
+    Coroutine(Coroutine &&other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+    Coroutine &operator=(Coroutine &&other) noexcept
+    {
+        if (this != &other) {
+            reset();
+            handle_ = std::exchange(other.handle_, {});
+        }
+        return *this;
+    }
+    ~Coroutine()
+    {
+        reset();
+    }
+
+private:
+    friend void runCoroutine(Scheduler &scheduler, Plugin &plugin, Coroutine coroutine);
+
+    explicit Coroutine(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+    void reset()
+    {
+        if (handle_) {
+            handle_.destroy();
+            handle_ = {};
+        }
+    }
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+/**
+ * @brief Starts a coroutine on the calling thread, on behalf of a plugin.
+ *
+ * A coroutine suspended when its plugin is disabled, or when the scheduler refuses to resume it, is destroyed without
+ * being resumed.
+ *
+ * @param scheduler the scheduler resuming the coroutine
+ * @param plugin the plugin owning the coroutine
+ * @param coroutine the coroutine to run
+ */
+inline void runCoroutine(Scheduler &scheduler, Plugin &plugin, Coroutine coroutine)
+{
+    auto handle = std::exchange(coroutine.handle_, {});
+    handle.promise().scheduler = &scheduler;
+    handle.promise().plugin = &plugin;
+    handle.resume();
+}
+
+namespace detail {
+
+/**
+ * Resumes a suspended coroutine at most once, destroying it instead if the callback owning it is dropped.
+ */
+class CoroutineResumer {
+public:
+    explicit CoroutineResumer(std::coroutine_handle<Coroutine::promise_type> handle) : handle_(handle) {}
+    CoroutineResumer(const CoroutineResumer &) = delete;
+    CoroutineResumer &operator=(const CoroutineResumer &) = delete;
+    ~CoroutineResumer()
+    {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    void resume()
+    {
+        std::exchange(handle_, {}).resume();
+    }
+
+    static std::function<void()> callback(std::coroutine_handle<Coroutine::promise_type> handle)
+    {
+        return [resumer = std::make_shared<CoroutineResumer>(handle)]() { resumer->resume(); };
+    }
+
+private:
+    std::coroutine_handle<Coroutine::promise_type> handle_;
+};
+
+struct TicksAwaiter {
+    std::uint64_t ticks;
+
+    [[nodiscard]] bool await_ready() const noexcept
+    {
+        return ticks == 0;
+    }
+    void await_suspend(std::coroutine_handle<Coroutine::promise_type> handle) const
+    {
+        auto &[scheduler, plugin] = handle.promise();
+        if (ticks == 1) {
+            scheduler->runOnMainThread(*plugin, CoroutineResumer::callback(handle));
+        }
+        else {
+            scheduler->runTaskLater(*plugin, CoroutineResumer::callback(handle), ticks);
+        }
+    }
+    void await_resume() const noexcept {}
+};
+
+struct AsyncAwaiter {
+    [[nodiscard]] bool await_ready() const noexcept
+    {
+        return false;
+    }
+    void await_suspend(std::coroutine_handle<Coroutine::promise_type> handle) const
+    {
+        auto &[scheduler, plugin] = handle.promise();
+        scheduler->runTaskAsync(*plugin, CoroutineResumer::callback(handle));
+    }
+    void await_resume() const noexcept {}
+};
+
+struct SyncAwaiter {
+    [[nodiscard]] bool await_ready() const noexcept
+    {
+        return false;
+    }
+    void await_suspend(std::coroutine_handle<Coroutine::promise_type> handle) const
+    {
+        auto &[scheduler, plugin] = handle.promise();
+        scheduler->runOnMainThread(*plugin, CoroutineResumer::callback(handle));
+    }
+    void await_resume() const noexcept {}
+};
+
+}  // namespace detail
+
+/**
+ * @brief Suspends the coroutine until the given number of server ticks have passed, resuming it on the server thread.
+ *
+ * @param ticks the ticks to wait, zero to continue immediately
+ */
+inline detail::TicksAwaiter ticks(std::uint64_t ticks)
+{
+    return {ticks};
+}
+
+/**
+ * @brief Suspends the coroutine until the next server tick, resuming it on the server thread.
+ */
+inline detail::TicksAwaiter nextTick()
+{
+    return {1};
+}
+
+/**
+ * @brief Moves the coroutine to an asynchronous worker thread.
+ * @remark The coroutine should never access any Endstone API until it awaits sync()
+ */
+inline detail::AsyncAwaiter async()
+{
+    return {};
+}
+
+/**
+ * @brief Moves the coroutine back to the server thread, at the start of the next server tick.
+ */
+inline detail::SyncAwaiter sync()
+{
+    return {};
+}
+
+}  // namespace endstone
+
+#endif
@@ -14,10 +14,25 @@
 
 #pragma once
 
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
 #include "endstone/scheduler/task.h"
+#include "endstone/scheduler/task_timing.h"
 
 namespace endstone {
 
+class Dimension;
+template <typename T>
+class AsyncResult;
+
 /**
  * @brief Represents a scheduler that executes various tasks.
  */
@@ -57,6 +72,24 @@ public:
     virtual std::shared_ptr<Task> runTaskTimer(Plugin &plugin, std::function<void()> task, std::uint64_t delay,
                                                std::uint64_t period) = 0;
 
+    /**
+     * @brief Returns a task that will be executed synchronously after the specified time, and repeatedly until
+     * cancelled if a period is given, timed by the clock rather than by server ticks.
+     *
+     * The server thread checks for due tasks at the start and at the end of each tick, and runs a task at the first
+     * check after its deadline. It is never deferred by the time budget of a tick. A task is late by at most the
+     * time between two checks, but its deadlines do not drift when ticks run late, which suits countdowns.
+     *
+     * @param plugin the reference to the plugin scheduling task
+     * @param task the task to be run
+     * @param delay the time to wait before running the task
+     * @param period the time to wait between runs, 0 to run it once
+     * @return a Task that contains the id number (nullptr if task is empty)
+     */
+    virtual std::shared_ptr<Task> runTaskTimerPrecise(Plugin &plugin, std::function<void()> task,
+                                                      std::chrono::microseconds delay,
+                                                      std::chrono::microseconds period) = 0;
+
     /**
      * @brief Returns a task that will be executed asynchronously on the next server tick.
      * @remark Asynchronous tasks should never access any Endstone API
@@ -92,6 +125,90 @@ public:
     virtual std::shared_ptr<Task> runTaskTimerAsync(Plugin &plugin, std::function<void()> task, std::uint64_t delay,
                                                std::uint64_t period) = 0;
 
+    /**
+     * @brief Returns a task that will be executed asynchronously by the given executor on the next server tick.
+     * @remark Asynchronous tasks should never access any Endstone API
+     *
+     * @param plugin the reference to the plugin scheduling task
+     * @param task the task to be run
+     * @param executor the pool of workers to run the task on
+     * @return a Task that contains the id number (nullptr if task is empty)
+     */
+    virtual std::shared_ptr<Task> runTaskAsync(Plugin &plugin, std::function<void()> task, AsyncExecutor executor) = 0;
+
+    /**
+     * @brief Returns a task that will be executed asynchronously by the given executor after the specified number of
+     * server ticks.
+     * @remark Asynchronous tasks should never access any Endstone API
+     *
+     * @param plugin the reference to the plugin scheduling task
+     * @param task the task to be run
+     * @param delay the ticks to wait before running the task
+     * @param executor the pool of workers to run the task on
+     * @return a Task that contains the id number (nullptr if task is empty)
+     */
+    virtual std::shared_ptr<Task> runTaskLaterAsync(Plugin &plugin, std::function<void()> task, std::uint64_t delay,
+                                                    AsyncExecutor executor) = 0;
+
+    /**
+     * @brief Returns a task that will be executed repeatedly (and asynchronously) by the given executor until
+     * cancelled, starting after the specified number of server ticks.
+     * @remark Asynchronous tasks should never access any Endstone API
+     *
+     * @param plugin the reference to the plugin scheduling task
+     * @param task the task to be run
+     * @param delay the ticks to wait before running the task
+     * @param period the ticks to wait between runs
+     * @param executor the pool of workers to run the task on
+     * @return a Task that contains the id number (nullptr if task is empty)
+     */
+    virtual std::shared_ptr<Task> runTaskTimerAsync(Plugin &plugin, std::function<void()> task, std::uint64_t delay,
+                                                    std::uint64_t period, AsyncExecutor executor) = 0;
+
+    /**
+     * @brief Runs a callback on the server thread at the start of the next server tick.
+     *
+     * Unlike runTask, no Task is created for the callback, and it is safe to call from any thread. The callback is
+     * dropped if the plugin is disabled by then.
+     *
+     * @param plugin the reference to the plugin owning the callback
+     * @param callback the callback to be run
+     */
+    virtual void runOnMainThread(Plugin &plugin, std::function<void()> callback) = 0;
+
+    /**
+     * @brief Returns a task that runs once for each dimension, in parallel, before the level ticks.
+     * @remark The task may only read the dimension it is given, through snapshots or other read-only views, and must
+     * not touch any other state of the server
+     *
+     * The server thread waits for the tasks of every dimension to finish before the level is ticked, so the world does
+     * not change while they run. Tasks that are due on the same tick share one such wait. One dimension is run on the
+     * server thread, the others on workers that run nothing but these tasks.
+     *
+     * @param plugin the reference to the plugin scheduling task
+     * @param task the task to be run for each dimension
+     * @param delay the ticks to wait before running the task
+     * @param period the ticks to wait between runs, 0 to run it once
+     * @return a Task that contains the id number (nullptr if task is empty)
+     */
+    virtual std::shared_ptr<Task> runDimensionTaskTimer(Plugin &plugin, std::function<void(Dimension &)> task,
+                                                        std::uint64_t delay, std::uint64_t period) = 0;
+
+    /**
+     * @brief Runs a supplier asynchronously on the next server tick and returns a handle to its result.
+     * @remark The supplier should never access any Endstone API
+     *
+     * A callback registered with AsyncResult::thenSync receives the result on the server thread, once the supplier
+     * has returned.
+     *
+     * @param plugin the reference to the plugin scheduling task
+     * @param supplier the function computing the result
+     * @return a handle to the result (nullptr if the task could not be scheduled)
+     */
+    template <typename Func>
+    std::shared_ptr<AsyncResult<std::invoke_result_t<std::decay_t<Func> &>>> supplyAsync(Plugin &plugin,
+                                                                                         Func &&supplier);
+
     /**
      * Removes task from scheduler.
      *
@@ -133,6 +250,159 @@ public:
      * @return Pending tasks
      */
     virtual std::vector<Task *> getPendingTasks() = 0;
+
+    /**
+     * Gets the task timings recorded since timings were last reset.
+     *
+     * Timings are only recorded while enabled with the /timings command.
+     *
+     * @return Timings aggregated per plugin
+     */
+    [[nodiscard]] virtual std::vector<TaskTiming> getTaskTimings() const = 0;
+};
+
+/**
+ * @brief Represents the result of a supplier run asynchronously by Scheduler::supplyAsync.
+ *
+ * @tparam T the type of the result
+ */
+template <typename T>
+class AsyncResult : public std::enable_shared_from_this<AsyncResult<T>> {
+public:
+    using Value = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+    using Callback = std::conditional_t<std::is_void_v<T>, std::function<void()>, std::function<void(Value)>>;
+
+    AsyncResult(Scheduler &scheduler, Plugin &plugin) : scheduler_(scheduler), plugin_(plugin) {}
+
+    /**
+     * Sets the callback receiving the result on the server thread.
+     *
+     * The callback is run on the tick after the supplier returns, or on the next tick if it already has. It is not run
+     * if the supplier throws; the exception is logged instead.
+     *
+     * @param callback the callback to be run
+     */
+    void thenSync(Callback callback)
+    {
+        std::lock_guard lock{mutex_};
+        callback_ = std::move(callback);
+        if (done_) {
+            post();
+        }
+    }
+
+    /**
+     * Returns the asynchronous task running the supplier.
+     *
+     * @return the task
+     */
+    [[nodiscard]] std::shared_ptr<Task> getTask() const
+    {
+        std::lock_guard lock{mutex_};
+        return task_;
+    }
+
+    /**
+     * Returns true if the supplier has returned or thrown.
+     *
+     * @return true if the result is available
+     */
+    [[nodiscard]] bool isDone() const
+    {
+        std::lock_guard lock{mutex_};
+        return done_;
+    }
+
+private:
+    friend class Scheduler;
+
+    void setTask(std::shared_ptr<Task> task)
+    {
+        std::lock_guard lock{mutex_};
+        task_ = std::move(task);
+    }
+
+    template <typename Func>
+    void supply(Func &supplier)
+    {
+        std::optional<Value> value;
+        std::exception_ptr error;
+        try {
+            if constexpr (std::is_void_v<T>) {
+                supplier();
+                value.emplace();
+            }
+            else {
+                value.emplace(supplier());
+            }
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+
+        std::lock_guard lock{mutex_};
+        value_ = std::move(value);
+        error_ = error;
+        done_ = true;
+        if (callback_) {
+            post();
+        }
+    }
+
+    void post()
+    {
+        scheduler_.runOnMainThread(plugin_, [self = this->shared_from_this()]() { self->deliver(); });
+    }
+
+    void deliver()
+    {
+        Callback callback;
+        std::optional<Value> value;
+        std::exception_ptr error;
+        {
+            std::lock_guard lock{mutex_};
+            callback = std::move(callback_);
+            value = std::move(value_);
+            error = error_;
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        if (!callback || !value) {
+            return;
+        }
+        if constexpr (std::is_void_v<T>) {
+            callback();
+        }
+        else {
+            callback(std::move(*value));
+        }
+    }
+
+    Scheduler &scheduler_;
+    Plugin &plugin_;
+    mutable std::mutex mutex_;
+    bool done_{false};
+    Callback callback_;
+    std::optional<Value> value_;
+    std::exception_ptr error_;
+    std::shared_ptr<Task> task_;
 };
 
+template <typename Func>
+std::shared_ptr<AsyncResult<std::invoke_result_t<std::decay_t<Func> &>>> Scheduler::supplyAsync(Plugin &plugin,
+                                                                                                Func &&supplier)
+{
+    using Result = AsyncResult<std::invoke_result_t<std::decay_t<Func> &>>;
+    auto result = std::make_shared<Result>(*this, plugin);
+    auto task = runTaskAsync(plugin, [result, supplier = std::forward<Func>(supplier)]() mutable {
+        result->supply(supplier);
+    });
+    if (!task) {
+        return nullptr;
+    }
+    result->setTask(std::move(task));
+    return result;
+}
+
 }  // namespace endstone
@@ -22,6 +22,52 @@ namespace endstone {
 
 using TaskId = std::uint32_t;
 
+/**
+ * @brief Represents how a sync task is treated once the scheduler has spent its time budget for a tick.
+ */
+enum class TaskPriority {
+    /**
+     * The task may be deferred to the following tick.
+     */
+    Normal,
+    /**
+     * The task always runs on the tick it is due.
+     */
+    Critical,
+};
+
+/**
+ * @brief Represents when a sync task runs within the server tick it is due.
+ */
+enum class TaskPhase {
+    /**
+     * The task runs before the level is ticked.
+     */
+    PreTick,
+    /**
+     * The task runs after the level is ticked, on the same server tick.
+     */
+    PostTick,
+};
+
+/**
+ * @brief Represents the pool of worker threads an async task is run on.
+ */
+enum class AsyncExecutor {
+    /**
+     * Workers for CPU-bound tasks, sized to leave a core for the server thread.
+     */
+    Cpu,
+    /**
+     * Workers for tasks that block on I/O, such as database queries or HTTP requests.
+     */
+    Io,
+    /**
+     * A single worker for Python tasks, which would otherwise take turns on the GIL across every worker of a pool.
+     */
+    Python,
+};
+
 /**
  * @brief Represents a task being executed by the scheduler.
  */
@@ -61,6 +107,34 @@ public:
      * Attempts to cancel this task.
      */
     virtual void cancel() = 0;
+
+    /**
+     * Returns the priority of this task.
+     *
+     * @return The priority of the task
+     */
+    [[nodiscard]] virtual TaskPriority getPriority() const = 0;
+
+    /**
+     * Sets the priority of this task.
+     *
+     * @param priority The priority of the task
+     */
+    virtual void setPriority(TaskPriority priority) = 0;
+
+    /**
+     * Returns the phase of the server tick this task runs in.
+     *
+     * @return The phase of the task
+     */
+    [[nodiscard]] virtual TaskPhase getPhase() const = 0;
+
+    /**
+     * Sets the phase of the server tick this task runs in. Has no effect on async tasks.
+     *
+     * @param phase The phase of the task
+     */
+    virtual void setPhase(TaskPhase phase) = 0;
 };
 
 }  // namespace endstone
@@ -0,0 +1,65 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace endstone {
+
+/**
+ * @brief Aggregated run timings of the tasks a plugin scheduled.
+ */
+struct TaskTiming {
+    /**
+     * Name of the plugin owning the tasks
+     */
+    std::string plugin;
+    /**
+     * Number of times sync tasks were run
+     */
+    std::uint64_t sync_count;
+    /**
+     * Number of ticks in which at least one sync task was run
+     */
+    std::uint64_t sync_ticks;
+    /**
+     * Largest number of sync tasks run in a single tick
+     */
+    std::uint64_t sync_max_per_tick;
+    /**
+     * Cumulative time spent in sync tasks on the server thread
+     */
+    std::chrono::nanoseconds sync_total;
+    /**
+     * Longest single run of a sync task
+     */
+    std::chrono::nanoseconds sync_max;
+    /**
+     * Number of times async tasks were run
+     */
+    std::uint64_t async_count;
+    /**
+     * Number of async task runs submitted to the workers but not finished yet
+     */
+    std::uint64_t async_pending;
+    /**
+     * Cumulative time spent in async tasks on the worker threads
+     */
+    std::chrono::nanoseconds async_total;
+};
+
+}  // namespace endstone
@@ -14,7 +14,10 @@
 
 #pragma once
 
+#include <cstddef>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "endstone/scoreboard/objective_sort_order.h"
 #include "endstone/scoreboard/score.h"
@@ -130,6 +133,28 @@ public:
      */
     [[nodiscard]] virtual std::unique_ptr<Score> getScore(ScoreEntry entry) const = 0;
 
+    /**
+     * @brief Gets the highest scores of this objective, from the highest to the lowest.
+     *
+     * The scores are kept ranked as they change, so leaderboards can be read often without sorting every score.
+     * Entries that are neither online players, actors in the level nor fake players are left out.
+     *
+     * @param count Maximum number of scores to get
+     * @return The highest scores of this objective
+     */
+    [[nodiscard]] virtual std::vector<std::unique_ptr<Score>> getTopScores(std::size_t count) const = 0;
+
+    /**
+     * @brief Gets the rank of an entry in this objective, 1 being the highest score.
+     *
+     * Entries with equal scores are given distinct ranks. All the entries with a score are ranked, including the ones
+     * left out of getTopScores.
+     *
+     * @param entry Entry to get the rank of
+     * @return The rank of the entry, or std::nullopt if it has no score in this objective
+     */
+    [[nodiscard]] virtual std::optional<std::size_t> getRank(ScoreEntry entry) const = 0;
+
     virtual bool operator==(const Objective &other) const = 0;
     virtual bool operator!=(const Objective &other) const = 0;
 };
@@ -20,6 +20,7 @@ namespace endstone {
 
 class Scoreboard;
 class Objective;
+class Player;
 
 /**
  * @brief Represents a score for an objective on a scoreboard.
@@ -49,6 +50,24 @@ public:
      */
     virtual void setValue(int score) = 0;
 
+    /**
+     * @brief Sets the score shown to a single viewer of the scoreboard, without changing it for the other viewers.
+     *
+     * This lets players share one scoreboard and only override the lines that differ between them, rather than
+     * each player holding a copy of the whole scoreboard.
+     *
+     * @param viewer Player viewing the scoreboard of this score
+     * @param score New score shown to the viewer
+     */
+    virtual void setViewerValue(Player &viewer, int score) = 0;
+
+    /**
+     * @brief Removes the score override of a viewer, so that it is shown the shared score again.
+     *
+     * @param viewer Player viewing the scoreboard of this score
+     */
+    virtual void resetViewerValue(Player &viewer) = 0;
+
     /**
      * @brief Shows if this score has been set at any point in time.
      *
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
 
 #include "endstone/scoreboard/criteria.h"
@@ -105,6 +106,27 @@ public:
      */
     [[nodiscard]] virtual std::vector<std::unique_ptr<Score>> getScores(ScoreEntry entry) const = 0;
 
+    /**
+     * @brief Calls the given function for each Objective on this Scoreboard
+     *
+     * Unlike getObjectives, this does not allocate an Objective per call. The Objective passed to the function is
+     * only valid for the duration of that call.
+     *
+     * @param callback the function to call for each Objective
+     */
+    virtual void forEachObjective(const std::function<void(Objective &)> &callback) const = 0;
+
+    /**
+     * @brief Calls the given function for each score of an entry on this Scoreboard
+     *
+     * Unlike getScores, this does not allocate a Score per call. The Score passed to the function is only valid for
+     * the duration of that call.
+     *
+     * @param entry the entry whose scores are being visited
+     * @param callback the function to call for each Score
+     */
+    virtual void forEachScore(ScoreEntry entry, const std::function<void(Score &)> &callback) const = 0;
+
     /**
      * @brief Removes all scores for an entry on this Scoreboard
      *
@@ -15,6 +15,8 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -23,8 +25,15 @@
 #include "endstone/boss/boss_bar.h"
 #include "endstone/level/level.h"
 #include "endstone/logger.h"
+#include "endstone/messaging/messenger.h"
+#include "endstone/network/packet.h"
+#include "endstone/network/packet_interceptor.h"
+#include "endstone/network/packet_priority.h"
+#include "endstone/persistence/player_data_store.h"
 #include "endstone/player.h"
 #include "endstone/scoreboard/scoreboard.h"
+#include "endstone/tick_statistics.h"
+#include "endstone/translatable.h"
 #include "endstone/util/uuid.h"
 
 namespace endstone {
@@ -111,6 +120,47 @@ public:
      */
     [[nodiscard]] virtual Scheduler &getScheduler() const = 0;
 
+    /**
+     * @brief Gets the store for the data plugins keep per player.
+     *
+     * @return a player data service for this server
+     */
+    [[nodiscard]] virtual PlayerDataStore &getPlayerDataStore() const = 0;
+
+    /**
+     * @brief Gets the messenger plugins exchange messages with the other servers of the network through.
+     *
+     * @return a messaging service for this server
+     */
+    [[nodiscard]] virtual Messenger &getMessenger() const = 0;
+
+    /**
+     * @brief Gets the packet interceptor plugins filter and rewrite the packets received from clients with.
+     *
+     * @return a packet interceptor for this server
+     */
+    [[nodiscard]] virtual PacketInterceptor &getPacketInterceptor() const = 0;
+
+    /**
+     * @brief Gets the priority the packets with the given id are sent to players with.
+     *
+     * @param packet_id The id of the packets
+     * @return the priority of the packets
+     * @see Player::setBandwidthLimit
+     */
+    [[nodiscard]] virtual PacketPriority getPacketPriority(int packet_id) const = 0;
+
+    /**
+     * @brief Sets the priority the packets with the given id are sent to players with.
+     *
+     * This applies to the packets sent by the API, such as messages, titles, toasts, particles and forms. Packets
+     * sent by vanilla are not held back.
+     *
+     * @param packet_id The id of the packets
+     * @param priority The new priority of the packets
+     */
+    virtual void setPacketPriority(int packet_id, PacketPriority priority) = 0;
+
     /**
      * @brief Gets the server level.
      *
@@ -118,12 +168,42 @@ public:
      */
     [[nodiscard]] virtual Level *getLevel() const = 0;
 
+    /**
+     * @brief Gets the numeric id of a block type, to compare with Block::getTypeId.
+     *
+     * The ids are assigned when the server starts and may differ between runs, they should not be stored.
+     *
+     * @param type The type of the block, for example, minecraft:acacia_stairs.
+     * @return The id of the block type, or -1 if there is no block type with this name.
+     */
+    [[nodiscard]] virtual int getBlockTypeId(std::string_view type) const = 0;
+
     /**
      * @brief Gets a list of all currently online players.
      *
-     * @return a list of currently online players.
+     * @warning The list is the one the server keeps, not a copy. It is updated in place as players join and quit, which
+     * invalidates the reference's iterators, so a loop over it must not do anything that can make a player leave, such
+     * as Player::kick, or join. It may only be read on the server thread, and must not be held across ticks. Copy it
+     * into a vector of your own in any of these cases.
+     *
+     * @return a reference to the list of currently online players.
      */
-    [[nodiscard]] virtual std::vector<Player *> getOnlinePlayers() const = 0;
+    [[nodiscard]] virtual const std::vector<Player *> &getOnlinePlayers() const = 0;
+
+    /**
+     * @brief Calls a function for each currently online player, in the order they joined.
+     *
+     * @warning This iterates the list returned by getOnlinePlayers, with the same restrictions on what func may do.
+     *
+     * @param func The function to call with each player
+     */
+    template <typename Func>
+    void forEachOnlinePlayer(Func &&func) const
+    {
+        for (auto *player : getOnlinePlayers()) {
+            func(*player);
+        }
+    }
 
     /**
      * @brief Get the maximum amount of players which can login to this server.
@@ -155,6 +235,36 @@ public:
      */
     [[nodiscard]] virtual Player *getPlayer(std::string name) const = 0;
 
+    /**
+     * @brief Gets the player with the given Xbox User ID (XUID).
+     *
+     * @param xuid XUID of the player to retrieve
+     * @return a player object if one was found, null otherwise
+     */
+    [[nodiscard]] virtual Player *getPlayerByXuid(const std::string &xuid) const = 0;
+
+    /**
+     * @brief Gets the player with the given runtime id, as used in packets.
+     *
+     * @param runtime_id Runtime id of the player to retrieve
+     * @return a player object if one was found, null otherwise
+     */
+    [[nodiscard]] virtual Player *getPlayerByRuntimeId(std::uint64_t runtime_id) const = 0;
+
+    /**
+     * @brief Gets the online players whose movement during the last second went over a speed or acceleration.
+     *
+     * The movement of every player is tracked each tick, and all of them are checked in a single pass. Legitimate
+     * movement can be fast too, such as flying with elytra, riding or being knocked back, so the players returned are
+     * candidates for a closer look rather than cheaters.
+     *
+     * @param max_speed The highest horizontal speed allowed, in blocks per second
+     * @param max_acceleration The largest change of the horizontal speed allowed, in blocks per second squared
+     * @return the players over either limit
+     * @see Player::getMovementStats
+     */
+    [[nodiscard]] virtual std::vector<Player *> getMovementAnomalies(float max_speed, float max_acceleration) const = 0;
+
     /**
      * @brief Shutdowns the server, stopping everything.
      */
@@ -198,6 +308,44 @@ public:
         }
     }
 
+    /**
+     * @brief Sends a packet to the given players, serializing it once for all of them.
+     *
+     * @param packet The packet to be sent.
+     * @param recipients The players to send the packet to.
+     */
+    virtual void broadcastPacket(Packet &packet, const std::vector<Player *> &recipients) const = 0;
+
+    /**
+     * @brief Sends a packet to every online player accepted by the predicate, serializing it once for all of them.
+     *
+     * @param packet The packet to be sent.
+     * @param predicate Decides which players receive the packet, every online player if empty.
+     */
+    virtual void broadcastPacket(Packet &packet, const std::function<bool(const Player &)> &predicate) const = 0;
+
+    /**
+     * @brief Translates a message on the server, as a client using the given locale would.
+     *
+     * Translations are compiled once per locale and cached until the data is reloaded.
+     *
+     * @param message The message to translate.
+     * @param locale The locale to translate for, e.g. en_US, or empty for the language of the server.
+     * @return the translated message
+     */
+    [[nodiscard]] virtual std::string translate(const Translatable &message, const std::string &locale) const = 0;
+
+    /**
+     * @brief Sends a message translated on the server to the given players.
+     *
+     * The players are grouped by locale, each group receives a single text packet serialized once for all of them. Use
+     * this for keys the clients may not know, such as translations shipped with a plugin.
+     *
+     * @param message The message to translate and send.
+     * @param recipients The players to send the message to.
+     */
+    virtual void sendTranslated(const Translatable &message, const std::vector<Player *> &recipients) const = 0;
+
     /**
      * @brief Checks the current thread against the expected primary server thread
      *
@@ -265,6 +413,26 @@ public:
      */
     virtual float getAverageTickUsage() = 0;
 
+    /**
+     * @brief Gets the percentiles of the tick durations over a window of recent ticks.
+     *
+     * Unlike the averages, the percentiles show the occasional slow ticks that players notice as lag spikes.
+     *
+     * @param window The window of recent ticks.
+     * @return The count, percentiles and maximum of the tick durations in the window.
+     */
+    [[nodiscard]] virtual TickStatistics getTickStatistics(TickWindow window) const = 0;
+
+    /**
+     * @brief Gets the tick the server would be at had every tick run on time.
+     *
+     * It follows the wall clock from the first tick at the target rate of 20 ticks per second, so the difference to
+     * the ticks actually run shows how far the server fell behind.
+     *
+     * @return The wall-clock tick.
+     */
+    [[nodiscard]] virtual std::uint64_t getWallClockTick() const = 0;
+
     /**
      * @brief Creates a boss bar instance to display to players. The progress defaults to 1.0.
      *
@@ -294,6 +462,47 @@ public:
      */
     [[nodiscard]] virtual std::chrono::system_clock::time_point getStartTime() = 0;
 
+    /**
+     * @brief Sets whether actor state is read once per tick.
+     *
+     * When enabled, the location, velocity, ground and water state and dimension of an actor are captured the first
+     * time any of them is read in a tick, and later reads in the same tick return the same values. This makes repeated
+     * reads cheaper and consistent with each other, at the cost of not seeing movement that happens later in the tick.
+     * Teleporting or rotating an actor through the API refreshes its state.
+     *
+     * @param value true to read actor state once per tick
+     */
+    virtual void setTickConsistentActorReads(bool value) = 0;
+
+    /**
+     * @brief Checks whether actor state is read once per tick.
+     *
+     * @return true if actor state is read once per tick
+     */
+    [[nodiscard]] virtual bool isTickConsistentActorReads() const = 0;
+
+    /**
+     * @brief Sets how far a player has to move or turn before a PlayerMoveEvent is fired.
+     *
+     * @param distance Minimum distance in blocks between the origin and the destination
+     * @param rotation Minimum change in pitch or yaw, in degrees
+     */
+    virtual void setPlayerMoveThresholds(float distance, float rotation) = 0;
+
+    /**
+     * @brief Gets how far a player has to move before a PlayerMoveEvent is fired.
+     *
+     * @return Minimum distance in blocks
+     */
+    [[nodiscard]] virtual float getPlayerMoveDistanceThreshold() const = 0;
+
+    /**
+     * @brief Gets how far a player has to turn before a PlayerMoveEvent is fired.
+     *
+     * @return Minimum change in pitch or yaw, in degrees
+     */
+    [[nodiscard]] virtual float getPlayerMoveRotationThreshold() const = 0;
+
     /**
      * @brief Used for all administrative messages, such as an operator using a command.
      */
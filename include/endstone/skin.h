@@ -14,8 +14,10 @@
 
 #pragma once
 
+#include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <utility>
 
 namespace endstone {
@@ -25,10 +27,48 @@ namespace endstone {
  */
 class Skin {
 public:
-    struct ImageData {
-        int height;
-        int width;
-        std::string data;
+    /**
+     * @brief RGBA pixels of a skin or cape image.
+     *
+     * The pixels are held in an immutable buffer shared by all copies, copying an image never copies its pixels.
+     */
+    class ImageData {
+    public:
+        ImageData() = default;
+        ImageData(int height, int width, std::string data)
+            : ImageData(height, width, std::make_shared<const std::string>(std::move(data)))
+        {
+        }
+        ImageData(int height, int width, std::shared_ptr<const std::string> data)
+            : height(height), width(width), data_(std::move(data))
+        {
+        }
+
+        /**
+         * @brief Gets a view of the pixels, valid for as long as this image or a copy of it is alive.
+         *
+         * @return the pixels, row by row.
+         */
+        [[nodiscard]] std::string_view getData() const
+        {
+            return data_ ? std::string_view(*data_) : std::string_view();
+        }
+
+        /**
+         * @brief Gets the shared buffer holding the pixels, to keep them alive without copying.
+         *
+         * @return the buffer, or nullptr for an empty image.
+         */
+        [[nodiscard]] const std::shared_ptr<const std::string> &getBuffer() const
+        {
+            return data_;
+        }
+
+        int height = 0;
+        int width = 0;
+
+    private:
+        std::shared_ptr<const std::string> data_;
     };
 
     Skin() = default;
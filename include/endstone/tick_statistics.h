@@ -0,0 +1,65 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace endstone {
+
+/**
+ * @brief The window of recent ticks that TickStatistics are computed over.
+ */
+enum class TickWindow {
+    OneSecond,
+    OneMinute,
+    FiveMinutes,
+    FifteenMinutes,
+};
+
+/**
+ * @brief Percentiles of the durations of the server ticks in a window.
+ *
+ * Durations are measured in microseconds and kept in buckets about 4% wide, so the percentiles are the upper bound
+ * of the bucket they fall in, never more than the slowest tick.
+ */
+struct TickStatistics {
+    /**
+     * @brief Number of ticks in the window.
+     */
+    std::uint64_t count{0};
+
+    /**
+     * @brief Median tick duration.
+     */
+    std::chrono::microseconds p50{0};
+
+    /**
+     * @brief Tick duration that 95% of the ticks were faster than or equal to.
+     */
+    std::chrono::microseconds p95{0};
+
+    /**
+     * @brief Tick duration that 99% of the ticks were faster than or equal to.
+     */
+    std::chrono::microseconds p99{0};
+
+    /**
+     * @brief Duration of the slowest tick.
+     */
+    std::chrono::microseconds max{0};
+};
+
+}  // namespace endstone
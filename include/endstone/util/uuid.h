@@ -17,7 +17,11 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <type_traits>
 
 namespace endstone {
 
@@ -58,7 +62,7 @@ public:
         return std::all_of(std::begin(data), std::end(data), [](const auto &val) { return val == 0U; });
     }
 
-    [[nodiscard]] int version() const noexcept
+    [[nodiscard]] constexpr int version() const noexcept
     {
         // version is stored in octet 9 which is index 6, since indexes count backwards
         uint8_t octet9 = data[6];
@@ -89,24 +93,64 @@ public:
 
     [[nodiscard]] std::string str() const
     {
-        std::string result;
-        result.reserve(36);
-
-        static const char *chars = "0123456789abcdef";
+        std::string result(36, '-');
+        constexpr const char *chars = "0123456789abcdef";
+        for (std::size_t i = 0; i < 16; ++i) {
+            const auto pos = TextPositions[i];
+            result[pos] = chars[(data[i] >> 4) & 0x0F];
+            result[pos + 1] = chars[data[i] & 0x0F];
+        }
+        return result;
+    }
 
-        for (size_t i = 0; i < 16; ++i) {
-            result.push_back(chars[(data[i] >> 4) & 0x0F]);
-            result.push_back(chars[data[i] & 0x0F]);
-            if (i == 3 || i == 5 || i == 7 || i == 9) {
-                result.push_back('-');
+    /**
+     * @brief Parses a UUID from its canonical form, such as "123e4567-e89b-12d3-a456-426614174000".
+     *
+     * The hex digits may be in either case. This can be evaluated at compile time.
+     *
+     * @param text The text to parse
+     * @return The UUID, or std::nullopt if the text is not in the canonical form
+     */
+    [[nodiscard]] static constexpr std::optional<UUID> fromString(std::string_view text) noexcept
+    {
+        if (text.size() != 36 || text[8] != '-' || text[13] != '-' || text[18] != '-' || text[23] != '-') {
+            return std::nullopt;
+        }
+        UUID result{};
+        for (std::size_t i = 0; i < 16; ++i) {
+            const auto pos = TextPositions[i];
+            const auto high = hexValue(text[pos]);
+            const auto low = hexValue(text[pos + 1]);
+            if (high < 0 || low < 0) {
+                return std::nullopt;
             }
+            result.data[i] = static_cast<std::uint8_t>((high << 4) | low);
         }
-
         return result;
     }
+
     std::uint8_t data[16];
+
+private:
+    // Position of the two hex digits of each octet in the canonical form
+    static constexpr std::uint8_t TextPositions[16] = {0, 2, 4, 6, 9, 11, 14, 16, 19, 21, 24, 26, 28, 30, 32, 34};
+
+    static constexpr int hexValue(char c) noexcept
+    {
+        if (c >= '0' && c <= '9') {
+            return c - '0';
+        }
+        if (c >= 'a' && c <= 'f') {
+            return c - 'a' + 10;
+        }
+        if (c >= 'A' && c <= 'F') {
+            return c - 'A' + 10;
+        }
+        return -1;
+    }
 };
 static_assert(sizeof(endstone::UUID) == endstone::UUID::size());
+static_assert(std::is_trivially_copyable_v<endstone::UUID>);
 
 inline bool operator==(UUID const &lhs, UUID const &rhs) noexcept
 {
@@ -144,12 +188,17 @@ inline void swap(UUID &lhs, UUID &rhs) noexcept
 
 inline std::size_t hash_value(UUID const &u) noexcept
 {
-    std::size_t seed = 0;
-    for (unsigned char i : u) {
-        seed ^= static_cast<std::size_t>(i) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    }
-
-    return seed;
+    // The two halves are read as words, and mixed so that UUIDs differing in a few bits do not collide
+    std::uint64_t high;
+    std::uint64_t low;
+    std::memcpy(&high, u.data, sizeof(high));
+    std::memcpy(&low, u.data + sizeof(high), sizeof(low));
+    std::uint64_t seed = (high ^ (high >> 32)) * 0x9e3779b97f4a7c15ULL;
+    seed ^= low;
+    seed ^= seed >> 32;
+    seed *= 0xd6e8feb86659fd93ULL;
+    seed ^= seed >> 32;
+    return static_cast<std::size_t>(seed);
 }
 
 }  // namespace endstone
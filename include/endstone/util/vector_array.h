@@ -0,0 +1,317 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "endstone/util/vector.h"
+
+namespace endstone {
+
+/**
+ * @brief Allocator of memory aligned to a given boundary, such as that of SIMD registers or cache lines.
+ */
+template <typename T, std::size_t Alignment>
+class AlignedAllocator {
+public:
+    static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0);
+
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment> &) noexcept  // NOLINT(*-explicit-constructor)
+    {
+    }
+
+    T *allocate(std::size_t n)
+    {
+        if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+        return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t{Alignment}));
+    }
+
+    void deallocate(T *p, std::size_t /*n*/) noexcept
+    {
+        ::operator delete(p, std::align_val_t{Alignment});
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment> &) const noexcept
+    {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment> &) const noexcept
+    {
+        return false;
+    }
+};
+
+/**
+ * @brief Represents an array of 3-dimensional vectors, stored as one array per component.
+ *
+ * Each component is stored contiguously and aligned to a cache line, so that the batch operations below run as
+ * loops without branches the compiler vectorizes, such as when checking the distance of thousands of actors to a
+ * point.
+ */
+template <typename T>
+class VectorArray {
+public:
+    static constexpr std::size_t Alignment = 64;
+    using Components = std::vector<T, AlignedAllocator<T, Alignment>>;
+
+    VectorArray() = default;
+
+    /**
+     * @brief Constructs an array of the given number of zero vectors.
+     *
+     * @param count The number of vectors
+     */
+    explicit VectorArray(std::size_t count) : x_(count), y_(count), z_(count) {}
+
+    /**
+     * @brief Gets the number of vectors in this array.
+     *
+     * @return The number of vectors
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return x_.size();
+    }
+
+    /**
+     * @brief Checks if this array has no vectors.
+     *
+     * @return true if this array is empty
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return x_.empty();
+    }
+
+    /**
+     * @brief Reserves the storage for the given number of vectors.
+     *
+     * @param count The number of vectors
+     */
+    void reserve(std::size_t count)
+    {
+        x_.reserve(count);
+        y_.reserve(count);
+        z_.reserve(count);
+    }
+
+    /**
+     * @brief Removes all the vectors, keeping the storage.
+     */
+    void clear() noexcept
+    {
+        x_.clear();
+        y_.clear();
+        z_.clear();
+    }
+
+    /**
+     * @brief Adds a vector to the end of this array.
+     *
+     * @param vector The vector to add
+     */
+    void push_back(const Vector<T> &vector)
+    {
+        x_.push_back(vector.getX());
+        y_.push_back(vector.getY());
+        z_.push_back(vector.getZ());
+    }
+
+    /**
+     * @brief Gets the vector at the given index.
+     *
+     * @param index The index of the vector
+     * @return The vector
+     */
+    [[nodiscard]] Vector<T> get(std::size_t index) const
+    {
+        return {x_[index], y_[index], z_[index]};
+    }
+
+    /**
+     * @brief Sets the vector at the given index.
+     *
+     * @param index The index of the vector
+     * @param vector The new vector
+     */
+    void set(std::size_t index, const Vector<T> &vector)
+    {
+        x_[index] = vector.getX();
+        y_[index] = vector.getY();
+        z_[index] = vector.getZ();
+    }
+
+    /**
+     * @brief Gets the X components of all the vectors.
+     *
+     * @return The X components
+     */
+    [[nodiscard]] const Components &getX() const noexcept
+    {
+        return x_;
+    }
+
+    /**
+     * @brief Gets the Y components of all the vectors.
+     *
+     * @return The Y components
+     */
+    [[nodiscard]] const Components &getY() const noexcept
+    {
+        return y_;
+    }
+
+    /**
+     * @brief Gets the Z components of all the vectors.
+     *
+     * @return The Z components
+     */
+    [[nodiscard]] const Components &getZ() const noexcept
+    {
+        return z_;
+    }
+
+    /**
+     * @brief Computes the squared distance of every vector to a point.
+     *
+     * @param point The point
+     * @param out Receives the squared distance of each vector, in the same order, resized to the size of this array
+     */
+    void distanceSquared(const Vector<T> &point, std::vector<T> &out) const
+    {
+        out.resize(size());
+        const T px = point.getX();
+        const T py = point.getY();
+        const T pz = point.getZ();
+        forEachBlock(out.data(), [&](std::size_t i) {
+            const T dx = x_[i] - px;
+            const T dy = y_[i] - py;
+            const T dz = z_[i] - pz;
+            return (dx * dx) + (dy * dy) + (dz * dz);
+        });
+    }
+
+    /**
+     * @brief Checks which vectors are within a distance of a point.
+     *
+     * @param point The point
+     * @param radius The distance, inclusive
+     * @param out Receives 1 for each vector within the distance and 0 otherwise, resized to the size of this array
+     * @return The number of vectors within the distance
+     */
+    std::size_t withinRadius(const Vector<T> &point, T radius, std::vector<std::uint8_t> &out) const
+    {
+        out.resize(size());
+        const T px = point.getX();
+        const T py = point.getY();
+        const T pz = point.getZ();
+        const T radius_squared = radius * radius;
+        return forEachBlock(out.data(), [&](std::size_t i) {
+            const T dx = x_[i] - px;
+            const T dy = y_[i] - py;
+            const T dz = z_[i] - pz;
+            return static_cast<std::uint8_t>((dx * dx) + (dy * dy) + (dz * dz) <= radius_squared);
+        });
+    }
+
+    /**
+     * @brief Checks which vectors are inside an axis-aligned box.
+     *
+     * @param min The corner of the box with the lowest components
+     * @param max The corner of the box with the highest components, inclusive
+     * @param out Receives 1 for each vector inside the box and 0 otherwise, resized to the size of this array
+     * @return The number of vectors inside the box
+     */
+    std::size_t withinBox(const Vector<T> &min, const Vector<T> &max, std::vector<std::uint8_t> &out) const
+    {
+        out.resize(size());
+        const T min_x = min.getX();
+        const T min_y = min.getY();
+        const T min_z = min.getZ();
+        const T max_x = max.getX();
+        const T max_y = max.getY();
+        const T max_z = max.getZ();
+        return forEachBlock(out.data(), [&](std::size_t i) {
+            // Bitwise and, the six comparisons are made for every vector instead of branching on each
+            return static_cast<std::uint8_t>((x_[i] >= min_x) & (x_[i] <= max_x) & (y_[i] >= min_y) &
+                                             (y_[i] <= max_y) & (z_[i] >= min_z) & (z_[i] <= max_z));
+        });
+    }
+
+private:
+    static constexpr std::size_t BlockSize = 16;
+
+    /**
+     * Writes the result of a kernel for every vector, and returns the sum of the results when they are masks.
+     *
+     * The vectors are processed in blocks of a fixed size, written to a local buffer first. The compiler then knows
+     * the trip count and that the output cannot alias the components, which it needs to vectorize at -O2.
+     */
+    template <typename Out, typename Kernel>
+    std::size_t forEachBlock(Out *out, Kernel kernel) const
+    {
+        const auto count = size();
+        std::size_t sum = 0;
+        std::size_t i = 0;
+        for (; i + BlockSize <= count; i += BlockSize) {
+            Out block[BlockSize];
+            for (std::size_t j = 0; j < BlockSize; ++j) {
+                block[j] = kernel(i + j);
+            }
+            if constexpr (std::is_same_v<Out, std::uint8_t>) {
+                std::uint8_t block_sum = 0;  // At most BlockSize
+                for (std::size_t j = 0; j < BlockSize; ++j) {
+                    block_sum += block[j];
+                }
+                sum += block_sum;
+            }
+            std::copy(block, block + BlockSize, out + i);
+        }
+        for (; i < count; ++i) {
+            out[i] = kernel(i);
+            if constexpr (std::is_same_v<Out, std::uint8_t>) {
+                sum += out[i];
+            }
+        }
+        return sum;
+    }
+
+    Components x_;
+    Components y_;
+    Components z_;
+};
+
+}  // namespace endstone
@@ -52,9 +52,17 @@ def catch_exceptions(func):
     default="https://raw.githubusercontent.com/EndstoneMC/bedrock-server-data/main/bedrock_server_data.json",
     help="The remote URL to retrieve bedrock server data from.",
 )
+@click.option(
+    "--prepare",
+    default=False,
+    is_flag=True,
+    show_default=True,
+    help="Install the server, its plugins and the symbol cache, then exit without starting the server. "
+    "The next starts skip installing, updating and validating the server.",
+)
 @click.version_option(__version__)
 @catch_exceptions
-def cli(server_folder: str, no_confirm: bool, remote: str) -> None:
+def cli(server_folder: str, no_confirm: bool, remote: str, prepare: bool) -> None:
     system = platform.system()
     if system == "Windows":
         from endstone._internal.bootstrap.windows import WindowsBootstrap
@@ -69,5 +77,5 @@ def cli(server_folder: str, no_confirm: bool, remote: str) -> None:
         raise NotImplementedError(f"{system} is not supported.")
 
     bootstrap = cls(server_folder=server_folder, no_confirm=no_confirm, remote=remote)
-    exit_code = bootstrap.run()
+    exit_code = bootstrap.prepare() if prepare else bootstrap.run()
     sys.exit(exit_code)
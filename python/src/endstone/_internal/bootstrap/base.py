@@ -1,5 +1,6 @@
 import errno
 import hashlib
+import json
 import logging
 import os
 import platform
@@ -13,11 +14,14 @@ from typing import Union
 import click
 import requests
 from endstone import __minecraft_version__ as minecraft_version
+from endstone._internal.version import __version__
 from packaging.version import Version
 from rich.progress import Progress, TextColumn, BarColumn, DownloadColumn, TimeRemainingColumn
 
 
 class Bootstrap:
+    PREPARED_FILENAME = ".endstone_prepared"
+
     def __init__(self, server_folder: str, no_confirm: bool, remote: str) -> None:
         self._server_path = Path(server_folder).absolute()
         self._no_confirm = no_confirm
@@ -49,6 +53,27 @@ class Bootstrap:
     def plugin_path(self) -> Path:
         return self.server_path / "plugins"
 
+    @property
+    def prepared_path(self) -> Path:
+        return self.server_path / self.PREPARED_FILENAME
+
+    @property
+    def _prepared_stamp(self) -> dict:
+        return {"endstone": __version__, "minecraft": minecraft_version, "runtime": str(self._endstone_runtime_path)}
+
+    @property
+    def is_prepared(self) -> bool:
+        """
+        Whether the server folder was prepared by this version of endstone, in which case installing, updating and
+        validating it on start can be skipped.
+        """
+
+        try:
+            with self.prepared_path.open("r", encoding="utf-8") as file:
+                return json.load(file) == self._prepared_stamp
+        except (OSError, ValueError):
+            return False
+
     def _validate(self) -> None:
         if platform.system().lower() != self.target_system:
             raise NotImplementedError(f"{platform.system()} is not supported by this bootstrap.")
@@ -190,11 +215,51 @@ class Bootstrap:
         self._download(self.server_path)
 
     def run(self) -> int:
+        if self.is_prepared:
+            self._logger.info(f"Using the server prepared in {self.server_path}.")
+        else:
+            self._install()
+            self._validate()
+            self._prepare()
+        self._create_process()
+        return self._wait_for_server()
+
+    def prepare(self) -> int:
+        """
+        Installs the server, the plugins in its plugin folder and the symbol cache of the runtime, then stamps the
+        server folder so that the next starts go straight to launching the server.
+
+        Meant to be run while building an image, so that all of it ends up in its layers.
+        """
+
+        self.prepared_path.unlink(missing_ok=True)
+        self._no_confirm = True
         self._install()
         self._validate()
         self._prepare()
-        self._create_process()
-        return self._wait_for_server()
+
+        # Imported here as the plugin loader is otherwise only used inside the server
+        from endstone._internal.plugin_loader import install_wheels
+
+        self._logger.info(f"Installing plugins from {self.plugin_path}...")
+        install_wheels(str(self.plugin_path), self._logger)
+
+        # The runtime exits right after installing its hooks, which writes the symbol cache next to it
+        self._logger.info("Building the symbol cache...")
+        os.environ["ENDSTONE_PREPARE"] = "1"
+        try:
+            self._create_process()
+            exit_code = self._wait_for_server()
+        finally:
+            os.environ.pop("ENDSTONE_PREPARE")
+        if exit_code != 0:
+            self._logger.error(f"Server exited with code {exit_code} while building the symbol cache.")
+            return exit_code
+
+        with self.prepared_path.open("w", encoding="utf-8") as file:
+            json.dump(self._prepared_stamp, file)
+        self._logger.info(f"Server is prepared in {self.server_path}.")
+        return 0
 
     @property
     def _endstone_runtime_filename(self) -> str:
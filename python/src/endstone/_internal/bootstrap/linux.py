@@ -2,6 +2,7 @@ import ctypes.util
 import os
 import stat
 from pathlib import Path
+from typing import Optional
 
 from endstone._internal.bootstrap.base import Bootstrap
 
@@ -30,10 +31,40 @@ class LinuxBootstrap(Bootstrap):
 
     def _create_process(self, *args, **kwargs) -> None:
         env = os.environ.copy()
-        env["LD_PRELOAD"] = str(self._endstone_runtime_path.absolute())
+        preload = [str(self._endstone_runtime_path.absolute())]
+        allocator = self._allocator_path
+        if allocator is not None:
+            # Loaded first so that the server and endstone allocate from, and free to, the same heap
+            preload.insert(0, allocator)
+        env["LD_PRELOAD"] = os.pathsep.join(preload)
         env["LD_LIBRARY_PATH"] = str(self._linked_libpython_path.parent.absolute())
         super()._create_process(env=env)
 
+    @property
+    def _allocator_path(self) -> Optional[str]:
+        """
+        Find the allocator set by ENDSTONE_ALLOCATOR, either mimalloc, jemalloc or the path of a shared library.
+
+        Returns:
+            (Optional[str]): Path of the allocator to preload, or None to keep the allocator of the C library.
+        """
+
+        allocator = os.environ.get("ENDSTONE_ALLOCATOR")
+        if not allocator:
+            return None
+
+        if allocator in ("mimalloc", "jemalloc"):
+            path = ctypes.util.find_library(allocator)
+        else:
+            path = allocator if Path(allocator).is_file() else None
+
+        if path is None:
+            self._logger.warning(f"Allocator {allocator} not found, using the default allocator.")
+            return None
+
+        self._logger.info(f"Using allocator {path}.")
+        return path
+
     @property
     def _linked_libpython_path(self) -> Path:
         """
@@ -116,6 +116,10 @@ class WindowsBootstrap(Bootstrap):
     def _create_process(self, *args, **kwargs) -> None:
         self._add_loopback_exemption()
 
+        if os.environ.get("ENDSTONE_ALLOCATOR"):
+            # The heap of the CRT is in use by the time the runtime is injected, it cannot be replaced from here
+            self._logger.warning("ENDSTONE_ALLOCATOR is not supported on Windows, using the default allocator.")
+
         # Add paths for symbol lookup
         env = os.environ.copy()
         symbol_path = env.get("_NT_SYMBOL_PATH", "")
@@ -4,7 +4,7 @@ import numpy
 import os
 import typing
 import uuid
-__all__ = ['ActionForm', 'Actor', 'ActorDeathEvent', 'ActorEvent', 'ActorRemoveEvent', 'ActorSpawnEvent', 'ActorTeleportEvent', 'BarColor', 'BarFlag', 'BarStyle', 'Block', 'BlockBreakEvent', 'BlockEvent', 'BlockFace', 'BlockPlaceEvent', 'BossBar', 'BroadcastMessageEvent', 'ColorFormat', 'Command', 'CommandExecutor', 'CommandSender', 'ConsoleCommandSender', 'Criteria', 'Dimension', 'DisplaySlot', 'Dropdown', 'Event', 'EventPriority', 'GameMode', 'Inventory', 'ItemStack', 'Label', 'Level', 'Location', 'Logger', 'MessageForm', 'Mob', 'ModalForm', 'Objective', 'ObjectiveSortOrder', 'Packet', 'PacketType', 'Permissible', 'Permission', 'PermissionAttachment', 'PermissionAttachmentInfo', 'PermissionDefault', 'Player', 'PlayerChatEvent', 'PlayerCommandEvent', 'PlayerDeathEvent', 'PlayerEvent', 'PlayerInteractActorEvent', 'PlayerInteractEvent', 'PlayerInventory', 'PlayerJoinEvent', 'PlayerLoginEvent', 'PlayerQuitEvent', 'PlayerTeleportEvent', 'Plugin', 'PluginCommand', 'PluginDescription', 'PluginDisableEvent', 'PluginEnableEvent', 'PluginLoadOrder', 'PluginLoader', 'PluginManager', 'Position', 'RenderType', 'Scheduler', 'Score', 'Scoreboard', 'Server', 'ServerCommandEvent', 'ServerListPingEvent', 'ServerLoadEvent', 'Skin', 'Slider', 'SocketAddress', 'SpawnParticleEffectPacket', 'StepSlider', 'Task', 'TextInput', 'ThunderChangeEvent', 'Toggle', 'Translatable', 'Vector', 'WeatherChangeEvent']
+__all__ = ['ActionForm', 'Actor', 'ActorDeathEvent', 'ActorEvent', 'ActorRemoveEvent', 'ActorSpawnEvent', 'ActorTeleportEvent', 'AsyncExecutor', 'AsyncPlayerChatEvent', 'BarColor', 'BarFlag', 'BarStyle', 'Block', 'BlockBreakEvent', 'BlockEvent', 'BlockFace', 'BlockPlaceEvent', 'BossBar', 'BossEventPacket', 'BroadcastMessageEvent', 'ColorFormat', 'Command', 'CommandExecutor', 'CommandSender', 'ConsoleCommandSender', 'Criteria', 'Dimension', 'DisplaySlot', 'Dropdown', 'Event', 'EventPriority', 'GameMode', 'Inventory', 'ItemStack', 'ItemStackView', 'Label', 'Level', 'Location', 'Logger', 'MessageForm', 'Messenger', 'Mob', 'ModalForm', 'MoveActorAbsolutePacket', 'MovementStats', 'NetworkStats', 'Objective', 'ObjectiveSortOrder', 'Packet', 'PacketPriority', 'PacketReceiveEvent', 'PacketType', 'Permissible', 'Permission', 'PermissionAttachment', 'PermissionAttachmentInfo', 'PermissionDefault', 'Player', 'PlayerBatchMoveEvent', 'PlayerChatEvent', 'PlayerCommandEvent', 'PlayerDataStore', 'PlayerDeathEvent', 'PlayerEvent', 'PlayerHandoffEvent', 'PlayerInteractActorEvent', 'PlayerInteractEvent', 'PlayerInventory', 'PlayerJoinEvent', 'PlayerLoginEvent', 'PlayerMoveEvent', 'PlayerQuitEvent', 'PlayerRegionEnterEvent', 'PlayerRegionLeaveEvent', 'PlayerTeleportEvent', 'Plugin', 'PluginCommand', 'PluginDescription', 'PluginDisableEvent', 'PluginEnableEvent', 'PluginLoadOrder', 'PluginLoader', 'PluginManager', 'Position', 'RegionSnapshot', 'RemoveActorPacket', 'RenderType', 'Scheduler', 'Score', 'Scoreboard', 'Server', 'ServerCommandEvent', 'ServerListPingEvent', 'ServerLoadEvent', 'SetScorePacket', 'SetTitlePacket', 'Skin', 'Slider', 'SocketAddress', 'SpawnParticleEffectPacket', 'StepSlider', 'Task', 'TaskPhase', 'TaskPriority', 'TextInput', 'TextPacket', 'ThunderChangeEvent', 'TickStatistics', 'TickWindow', 'ToastRequestPacket', 'Toggle', 'Translatable', 'Vector', 'WeatherChangeEvent']
 class ActionForm:
     """
     Represents a form with buttons that let the player take action.
@@ -62,6 +62,14 @@ class ActionForm:
     def content(self, arg1: str | Translatable) -> ActionForm:
         ...
     @property
+    def is_static(self) -> bool:
+        """
+        Gets or sets whether the form is static, its JSON is then serialized once and reused.
+        """
+    @is_static.setter
+    def is_static(self, arg1: bool) -> ActionForm:
+        ...
+    @property
     def on_close(self) -> typing.Callable[[Player], None]:
         """
         Gets or sets the on close callback.
@@ -149,6 +157,11 @@ class Actor(CommandSender):
         Returns the runtime id for this actor.
         """
     @property
+    def type(self) -> str:
+        """
+        Gets the type of this actor, e.g. minecraft:zombie.
+        """
+    @property
     def velocity(self) -> Vector:
         """
         Gets this actor's current velocity.
@@ -194,6 +207,62 @@ class ActorTeleportEvent(ActorEvent):
     @to_location.setter
     def to_location(self, arg1: Location) -> None:
         ...
+class AsyncExecutor:
+    """
+    Represents the pool of worker threads an async task is run on.
+    """
+    CPU: typing.ClassVar[AsyncExecutor]  # value = <AsyncExecutor.CPU: 0>
+    IO: typing.ClassVar[AsyncExecutor]  # value = <AsyncExecutor.IO: 1>
+    PYTHON: typing.ClassVar[AsyncExecutor]  # value = <AsyncExecutor.PYTHON: 2>
+    __members__: typing.ClassVar[dict[str, AsyncExecutor]]  # value = {'CPU': <AsyncExecutor.CPU: 0>, 'IO': <AsyncExecutor.IO: 1>, 'PYTHON': <AsyncExecutor.PYTHON: 2>}
+    def __eq__(self, other: typing.Any) -> bool:
+        ...
+    def __getstate__(self) -> int:
+        ...
+    def __hash__(self) -> int:
+        ...
+    def __index__(self) -> int:
+        ...
+    def __init__(self, value: int) -> None:
+        ...
+    def __int__(self) -> int:
+        ...
+    def __ne__(self, other: typing.Any) -> bool:
+        ...
+    def __repr__(self) -> str:
+        ...
+    def __setstate__(self, state: int) -> None:
+        ...
+    def __str__(self) -> str:
+        ...
+    @property
+    def name(self) -> str:
+        ...
+    @property
+    def value(self) -> int:
+        ...
+class AsyncPlayerChatEvent(Event):
+    """
+    Called on the CPU workers when a player sends a chat message, after PlayerChatEvent.
+    """
+    @property
+    def message(self) -> str:
+        """
+        Gets or sets the message that the player will send.
+        """
+    @message.setter
+    def message(self, arg1: str) -> None:
+        ...
+    @property
+    def player_id(self) -> uuid.UUID:
+        """
+        Gets the UUID of the player that sent the message.
+        """
+    @property
+    def player_name(self) -> str:
+        """
+        Gets the name of the player that sent the message.
+        """
 class BarColor:
     BLUE: typing.ClassVar[BarColor]  # value = <BarColor.BLUE: 1>
     GREEN: typing.ClassVar[BarColor]  # value = <BarColor.GREEN: 3>
@@ -321,6 +390,11 @@ class Block:
         Get the type of the block.
         """
     @property
+    def type_id(self) -> int:
+        """
+        Get the numeric id of the type of the block.
+        """
+    @property
     def x(self) -> int:
         """
         Gets the x-coordinate of this block
@@ -479,6 +553,57 @@ class BossBar:
     @visible.setter
     def visible(self, arg1: bool) -> None:
         ...
+class BossEventPacket(Packet):
+    """
+    Represents a packet for updating a boss bar.
+    """
+    class EventType:
+        ADD: typing.ClassVar[BossEventPacket.EventType]  # value = <EventType.ADD: 0>
+        PLAYER_ADDED: typing.ClassVar[BossEventPacket.EventType]  # value = <EventType.PLAYER_ADDED: 1>
+        PLAYER_REMOVED: typing.ClassVar[BossEventPacket.EventType]  # value = <EventType.PLAYER_REMOVED: 3>
+        QUERY: typing.ClassVar[BossEventPacket.EventType]  # value = <EventType.QUERY: 8>
+        REMOVE: typing.ClassVar[BossEventPacket.EventType]  # value = <EventType.REMOVE: 2>
+        UPDATE_NAME: typing.ClassVar[BossEventPacket.EventType]  # value = <EventType.UPDATE_NAME: 5>
+        UPDATE_PERCENT: typing.ClassVar[BossEventPacket.EventType]  # value = <EventType.UPDATE_PERCENT: 4>
+        UPDATE_PROPERTIES: typing.ClassVar[BossEventPacket.EventType]  # value = <EventType.UPDATE_PROPERTIES: 6>
+        UPDATE_STYLE: typing.ClassVar[BossEventPacket.EventType]  # value = <EventType.UPDATE_STYLE: 7>
+        __members__: typing.ClassVar[dict[str, BossEventPacket.EventType]]  # value = {'ADD': <EventType.ADD: 0>, 'PLAYER_ADDED': <EventType.PLAYER_ADDED: 1>, 'REMOVE': <EventType.REMOVE: 2>, 'PLAYER_REMOVED': <EventType.PLAYER_REMOVED: 3>, 'UPDATE_PERCENT': <EventType.UPDATE_PERCENT: 4>, 'UPDATE_NAME': <EventType.UPDATE_NAME: 5>, 'UPDATE_PROPERTIES': <EventType.UPDATE_PROPERTIES: 6>, 'UPDATE_STYLE': <EventType.UPDATE_STYLE: 7>, 'QUERY': <EventType.QUERY: 8>}
+        def __eq__(self, other: typing.Any) -> bool:
+            ...
+        def __getstate__(self) -> int:
+            ...
+        def __hash__(self) -> int:
+            ...
+        def __index__(self) -> int:
+            ...
+        def __init__(self, value: int) -> None:
+            ...
+        def __int__(self) -> int:
+            ...
+        def __ne__(self, other: typing.Any) -> bool:
+            ...
+        def __repr__(self) -> str:
+            ...
+        def __setstate__(self, state: int) -> None:
+            ...
+        def __str__(self) -> str:
+            ...
+        @property
+        def name(self) -> str:
+            ...
+        @property
+        def value(self) -> int:
+            ...
+    boss_actor_id: int
+    color: BarColor
+    darken_sky: bool
+    event_type: BossEventPacket.EventType
+    player_actor_id: int
+    progress: float
+    style: BarStyle
+    title: str
+    def __init__(self) -> None:
+        ...
 class BroadcastMessageEvent(Event):
     """
     Event triggered for server broadcast messages such as from Server.broadcast
@@ -692,6 +817,40 @@ class Dimension:
     """
     Represents a dimension within a Level.
     """
+    class ParticleEffect:
+        """
+        A particle effect to spawn with spawn_particles.
+        """
+        effect_name: str
+        molang_variables_json: str | None
+        position: Vector
+        def __init__(self, effect_name: str, position: Vector, molang_variables_json: str | None = None) -> None:
+            ...
+    class PregenerationProgress:
+        """
+        Describes how far a chunk pre-generation run has got.
+        """
+        @property
+        def center_x(self) -> int:
+            ...
+        @property
+        def center_z(self) -> int:
+            ...
+        @property
+        def chunks_per_second(self) -> float:
+            ...
+        @property
+        def completed(self) -> int:
+            ...
+        @property
+        def eta(self) -> datetime.timedelta | None:
+            ...
+        @property
+        def radius(self) -> int:
+            ...
+        @property
+        def total(self) -> int:
+            ...
     class Type:
         """
         Represents various dimension types.
@@ -731,6 +890,18 @@ class Dimension:
     NETHER: typing.ClassVar[Dimension.Type]  # value = <Type.NETHER: 1>
     OVERWORLD: typing.ClassVar[Dimension.Type]  # value = <Type.OVERWORLD: 0>
     THE_END: typing.ClassVar[Dimension.Type]  # value = <Type.THE_END: 2>
+    def add_chunk_ticket(self, x: int, z: int, plugin: Plugin) -> bool:
+        """
+        Adds a ticket that keeps the chunk at the given chunk coordinates loaded until it is removed
+        """
+    def add_region(self, name: str, x1: int, y1: int, z1: int, x2: int, y2: int, z2: int) -> bool:
+        """
+        Adds a named region covering the blocks between two corners. Returns False if the name is taken
+        """
+    def get_actor_count(self, type: str) -> int:
+        """
+        Gets the number of actors of a type in this dimension, players excluded
+        """
     @typing.overload
     def get_block_at(self, x: int, y: int, z: int) -> Block:
         """
@@ -741,6 +912,81 @@ class Dimension:
         """
         Gets the Block at the given Location
         """
+    def get_blocks(self, x1: int, y1: int, z1: int, x2: int, y2: int, z2: int) -> list[Block]:
+        """
+        Gets all the Blocks in the region between two corners, skipping chunks that are not loaded
+        """
+    def get_chunk_tickets(self, plugin: Plugin) -> list[tuple[int, int]]:
+        """
+        Gets the coordinates of the chunks a plugin holds tickets on in this dimension
+        """
+    def get_nearby_actors(self, x: float, y: float, z: float, radius: float) -> list[Actor]:
+        """
+        Gets all the Actors within a radius of the given coordinates
+        """
+    def get_regions(self, x1: int, y1: int, z1: int, x2: int, y2: int, z2: int) -> list[str]:
+        """
+        Gets the names of the regions overlapping the blocks between two corners
+        """
+    def get_regions_at(self, x: float, y: float, z: float) -> list[str]:
+        """
+        Gets the names of the regions containing the given coordinates
+        """
+    def is_chunk_loaded(self, x: int, z: int) -> bool:
+        """
+        Checks whether the chunk at the given chunk coordinates is loaded
+        """
+    def remove_chunk_ticket(self, x: int, z: int, plugin: Plugin) -> bool:
+        """
+        Removes the ticket a plugin holds on the chunk at the given chunk coordinates
+        """
+    def remove_chunk_tickets(self, plugin: Plugin) -> None:
+        """
+        Removes all the tickets a plugin holds in this dimension
+        """
+    def remove_region(self, name: str) -> bool:
+        """
+        Removes a named region. Returns True if the region existed
+        """
+    def restore_region(self, snapshot: RegionSnapshot) -> int:
+        """
+        Restores a region to a snapshot, changing only the blocks that differ. Returns the number of blocks changed, or -1 if the snapshot is invalid
+        """
+    def set_actor_limit(self, type: str, per_chunk: int, per_dimension: int) -> None:
+        """
+        Caps the number of actors of a type in each chunk and in the whole dimension, negative for no cap
+        """
+    @typing.overload
+    def set_blocks(self, x1: int, y1: int, z1: int, x2: int, y2: int, z2: int, palette: list[str], indices: numpy.ndarray[numpy.uint16], apply_physics: bool = True) -> int:
+        """
+        Sets every Block in the region between two corners from a palette, indexed by a contiguous uint16 array with z varying fastest, then y, then x. Returns the number of blocks changed, or -1 if the palette or indices are invalid
+        """
+    @typing.overload
+    def set_blocks(self, x1: int, y1: int, z1: int, x2: int, y2: int, z2: int, palette: list[str], indices: list[int], apply_physics: bool = True) -> int:
+        """
+        Sets every Block in the region between two corners from a palette, indexed with z varying fastest, then y, then x. Returns the number of blocks changed, or -1 if the palette or indices are invalid
+        """
+    def start_pregeneration(self, center_x: int, center_z: int, radius: int, target_usage: float = 0.8) -> bool:
+        """
+        Starts generating every chunk in a square around a center chunk, throttled to a target tick usage
+        """
+    def stop_pregeneration(self) -> bool:
+        """
+        Stops the chunk pre-generation run of this dimension and discards its checkpoint
+        """
+    def snapshot_region(self, x1: int, y1: int, z1: int, x2: int, y2: int, z2: int) -> RegionSnapshot:
+        """
+        Takes a snapshot of every Block in the region between two corners
+        """
+    def spawn_particles(self, particles: list[Dimension.ParticleEffect], viewers: list[Player] = [], radius: float = 64.0) -> None:
+        """
+        Spawns a batch of particle effects, each sent only to the viewers within the radius of it. Every player in this dimension is a viewer if none are given
+        """
+    @property
+    def actor_counts(self) -> list[tuple[str, int]]:
+        """
+        Gets the number of actors of each type in this dimension as (type, count) tuples
+        """
     @property
     def level(self) -> Level:
         """
@@ -752,6 +998,11 @@ class Dimension:
         Gets the name of this dimension
         """
     @property
+    def pregeneration_progress(self) -> Dimension.PregenerationProgress | None:
+        """
+        Gets the progress of the chunk pre-generation run of this dimension, if any
+        """
+    @property
     def type(self) -> Dimension.Type:
         """
         Gets the type of this dimension
@@ -927,6 +1178,15 @@ class Inventory:
     """
     Interface to the various inventories.
     """
+    def get_item(self, index: int) -> ItemStackView:
+        """
+        Gets a view of the ItemStack found in the slot at the given index
+        """
+    @property
+    def contents(self) -> list[ItemStackView]:
+        """
+        Gets a view of every ItemStack in this inventory, in slot order
+        """
     @property
     def max_stack_size(self) -> int:
         """
@@ -941,8 +1201,16 @@ class ItemStack:
     """
     Represents a stack of items.
     """
+    @typing.overload
     def __init__(self, type: str = 'minecraft:air', amount: int = 1) -> None:
         ...
+    @typing.overload
+    def __init__(self, view: ItemStackView) -> None:
+        ...
+    def view(self) -> ItemStackView:
+        """
+        Gets a non-owning view of this item stack.
+        """
     @property
     def amount(self) -> int:
         """
@@ -959,6 +1227,25 @@ class ItemStack:
     @type.setter
     def type(self, arg1: str) -> None:
         ...
+class ItemStackView:
+    """
+    A lightweight, non-owning snapshot of a stack of items.
+    """
+    @property
+    def amount(self) -> int:
+        """
+        Gets the amount of items in this stack.
+        """
+    @property
+    def is_empty(self) -> bool:
+        """
+        Checks whether this stack holds no items.
+        """
+    @property
+    def type(self) -> str:
+        """
+        Gets the type of this item.
+        """
 class Label:
     """
     Represents a text label.
@@ -974,6 +1261,18 @@ class Label:
     def text(self, arg1: str | Translatable) -> Label:
         ...
 class Level:
+    def actor_positions(self) -> numpy.ndarray[numpy.float32]:
+        """
+        Gets the position of every actor in this level as an N x 3 float32 array, in the same order as actor_runtime_ids() within a tick
+        """
+    def actor_runtime_ids(self) -> numpy.ndarray[numpy.uint64]:
+        """
+        Gets the runtime id of every actor in this level as a uint64 array, in the same order as actor_positions() within a tick
+        """
+    def backup(self, plugin: Plugin, destination: str, callback: typing.Callable[[str], None]) -> bool:
+        """
+        Copies the level to a directory while the server keeps running.
+        """
     def get_dimension(self, name: str) -> Dimension:
         """
         Gets the dimension with the given name.
@@ -1142,6 +1441,14 @@ class MessageForm:
     def content(self, arg1: str | Translatable) -> MessageForm:
         ...
     @property
+    def is_static(self) -> bool:
+        """
+        Gets or sets whether the form is static, its JSON is then serialized once and reused.
+        """
+    @is_static.setter
+    def is_static(self, arg1: bool) -> MessageForm:
+        ...
+    @property
     def on_close(self) -> typing.Callable[[Player], None]:
         """
         Gets or sets the on close callback.
@@ -1165,6 +1472,31 @@ class MessageForm:
     @title.setter
     def title(self, arg1: str | Translatable) -> MessageForm:
         ...
+class Messenger:
+    """
+    Publishes messages to, and receives them from, the other servers of a network on named channels.
+    """
+    def publish(self, channel: str, message: bytes) -> None:
+        """
+        Sends a message to the other servers subscribed to the channel.
+        """
+    def subscribe(self, plugin: Plugin, channel: str, handler: typing.Callable[[str, bytes], None]) -> None:
+        """
+        Subscribes a plugin to a channel, replacing its previous handler for it. The handler is called with the channel and the message on the server thread.
+        """
+    def unregister(self, plugin: Plugin) -> None:
+        """
+        Unsubscribes a plugin from every channel, and removes the transport it set.
+        """
+    def unsubscribe(self, plugin: Plugin, channel: str) -> None:
+        """
+        Unsubscribes a plugin from a channel.
+        """
+    @property
+    def server_id(self) -> str:
+        """
+        Gets the ID this server publishes its messages with.
+        """
 class Mob(Actor):
     """
     Represents a mobile entity (i.e. living entity), such as a monster or player.
@@ -1201,6 +1533,14 @@ class ModalForm:
     def icon(self, arg1: str | None) -> ModalForm:
         ...
     @property
+    def is_static(self) -> bool:
+        """
+        Gets or sets whether the form is static, its JSON is then serialized once and reused.
+        """
+    @is_static.setter
+    def is_static(self, arg1: bool) -> ModalForm:
+        ...
+    @property
     def on_close(self) -> typing.Callable[[Player], None]:
         """
         Gets or sets the on close callback.
@@ -1232,6 +1572,67 @@ class ModalForm:
     @title.setter
     def title(self, arg1: str | Translatable) -> ModalForm:
         ...
+class MoveActorAbsolutePacket(Packet):
+    """
+    Represents a packet for moving an actor to an absolute position.
+    """
+    actor_runtime_id: int
+    force_move: bool
+    head_yaw: float
+    on_ground: bool
+    pitch: float
+    position: Vector
+    teleported: bool
+    yaw: float
+    def __init__(self) -> None:
+        ...
+class MovementStats:
+    """
+    Represents the movement statistics of a player.
+    """
+    @property
+    def horizontal_speed(self) -> float:
+        ...
+    @property
+    def peak_horizontal_acceleration(self) -> float:
+        ...
+    @property
+    def peak_horizontal_speed(self) -> float:
+        ...
+    @property
+    def vertical_speed(self) -> float:
+        ...
+class NetworkStats:
+    """
+    Represents the network statistics of a player's connection.
+    """
+    @property
+    def bytes_received(self) -> int:
+        ...
+    @property
+    def bytes_received_per_second(self) -> int:
+        ...
+    @property
+    def bytes_resent(self) -> int:
+        ...
+    @property
+    def bytes_sent(self) -> int:
+        ...
+    @property
+    def bytes_sent_per_second(self) -> int:
+        ...
+    @property
+    def packet_loss(self) -> float:
+        ...
+    @property
+    def packet_loss_total(self) -> float:
+        ...
+    @property
+    def resend_queue_size(self) -> int:
+        ...
+    @property
+    def send_queue_size(self) -> int:
+        ...
 class Objective:
     """
     Represents an objective on a scoreboard that can show scores specific to entries.
@@ -1241,10 +1642,18 @@ class Objective:
         ...
     def __ne__(self, arg0: Objective) -> bool:
         ...
+    def get_rank(self, entry: Player | Actor | str) -> int | None:
+        """
+        Gets the rank of an entry in this objective, 1 being the highest score, or None if it has no score
+        """
     def get_score(self, entry: Player | Actor | str) -> Score:
         """
         Gets an entry's Score for this objective
         """
+    def get_top_scores(self, count: int) -> list[Score]:
+        """
+        Gets the highest scores of this objective, from the highest to the lowest
+        """
     def set_display(self, slot: DisplaySlot | None, order: ObjectiveSortOrder | None = None) -> None:
         """
         Sets the display slot and sort order for this objective. This will remove it from any other display slot.
@@ -1341,12 +1750,33 @@ class Packet:
         """
         Gets the type of the packet.
         """
-class PacketType:
+class PacketReceiveEvent(Event):
     """
-    Represents the types of packets.
+    Called when a packet is received from a client, before it is deserialized.
     """
-    SPAWN_PARTICLE_EFFECT: typing.ClassVar[PacketType]  # value = <PacketType.SPAWN_PARTICLE_EFFECT: 118>
-    __members__: typing.ClassVar[dict[str, PacketType]]  # value = {'SPAWN_PARTICLE_EFFECT': <PacketType.SPAWN_PARTICLE_EFFECT: 118>}
+    @property
+    def packet_id(self) -> int:
+        """
+        Gets the id of the packet received.
+        """
+    @property
+    def payload(self) -> bytes:
+        """
+        Gets the serialized packet body following the packet header.
+        """
+    @property
+    def sub_client_id(self) -> int:
+        """
+        Gets the id of the sub client that sent the packet.
+        """
+class PacketPriority:
+    """
+    Represents the priorities of the packets sent to a player.
+    """
+    BULK: typing.ClassVar[PacketPriority]  # value = <PacketPriority.BULK: 2>
+    CRITICAL: typing.ClassVar[PacketPriority]  # value = <PacketPriority.CRITICAL: 0>
+    NORMAL: typing.ClassVar[PacketPriority]  # value = <PacketPriority.NORMAL: 1>
+    __members__: typing.ClassVar[dict[str, PacketPriority]]  # value = {'CRITICAL': <PacketPriority.CRITICAL: 0>, 'NORMAL': <PacketPriority.NORMAL: 1>, 'BULK': <PacketPriority.BULK: 2>}
     def __eq__(self, other: typing.Any) -> bool:
         ...
     def __getstate__(self) -> int:
@@ -1373,9 +1803,48 @@ class PacketType:
     @property
     def value(self) -> int:
         ...
-class Permissible:
+class PacketType:
     """
-    Represents an object that may become a server operator and can be assigned permissions.
+    Represents the types of packets.
+    """
+    BOSS_EVENT: typing.ClassVar[PacketType]  # value = <PacketType.BOSS_EVENT: 74>
+    MOVE_ACTOR_ABSOLUTE: typing.ClassVar[PacketType]  # value = <PacketType.MOVE_ACTOR_ABSOLUTE: 18>
+    REMOVE_ACTOR: typing.ClassVar[PacketType]  # value = <PacketType.REMOVE_ACTOR: 14>
+    SET_SCORE: typing.ClassVar[PacketType]  # value = <PacketType.SET_SCORE: 108>
+    SET_TITLE: typing.ClassVar[PacketType]  # value = <PacketType.SET_TITLE: 88>
+    SPAWN_PARTICLE_EFFECT: typing.ClassVar[PacketType]  # value = <PacketType.SPAWN_PARTICLE_EFFECT: 118>
+    TEXT: typing.ClassVar[PacketType]  # value = <PacketType.TEXT: 9>
+    TOAST_REQUEST: typing.ClassVar[PacketType]  # value = <PacketType.TOAST_REQUEST: 186>
+    __members__: typing.ClassVar[dict[str, PacketType]]  # value = {'TEXT': <PacketType.TEXT: 9>, 'REMOVE_ACTOR': <PacketType.REMOVE_ACTOR: 14>, 'MOVE_ACTOR_ABSOLUTE': <PacketType.MOVE_ACTOR_ABSOLUTE: 18>, 'BOSS_EVENT': <PacketType.BOSS_EVENT: 74>, 'SET_TITLE': <PacketType.SET_TITLE: 88>, 'SET_SCORE': <PacketType.SET_SCORE: 108>, 'SPAWN_PARTICLE_EFFECT': <PacketType.SPAWN_PARTICLE_EFFECT: 118>, 'TOAST_REQUEST': <PacketType.TOAST_REQUEST: 186>}
+    def __eq__(self, other: typing.Any) -> bool:
+        ...
+    def __getstate__(self) -> int:
+        ...
+    def __hash__(self) -> int:
+        ...
+    def __index__(self) -> int:
+        ...
+    def __init__(self, value: int) -> None:
+        ...
+    def __int__(self) -> int:
+        ...
+    def __ne__(self, other: typing.Any) -> bool:
+        ...
+    def __repr__(self) -> str:
+        ...
+    def __setstate__(self, state: int) -> None:
+        ...
+    def __str__(self) -> str:
+        ...
+    @property
+    def name(self) -> str:
+        ...
+    @property
+    def value(self) -> int:
+        ...
+class Permissible:
+    """
+    Represents an object that may become a server operator and can be assigned permissions.
     """
     @typing.overload
     def add_attachment(self, plugin: Plugin, name: str, value: bool) -> PermissionAttachment:
@@ -1599,10 +2068,53 @@ class Player(Mob):
     """
     Represents a player.
     """
+    class Snapshot:
+        """
+        The state of a player as of the end of a server tick.
+        """
+        @property
+        def dimension(self) -> Dimension.Type:
+            ...
+        @property
+        def game_mode(self) -> GameMode:
+            ...
+        @property
+        def pitch(self) -> float:
+            ...
+        @property
+        def ping(self) -> int:
+            ...
+        @property
+        def tick(self) -> int:
+            ...
+        @property
+        def x(self) -> float:
+            ...
+        @property
+        def y(self) -> float:
+            ...
+        @property
+        def yaw(self) -> float:
+            ...
+        @property
+        def z(self) -> float:
+            ...
+    def begin_batch(self) -> None:
+        """
+        Starts batching the packets sent to the player.
+        """
+    def can_see(self, actor: Actor) -> bool:
+        """
+        Checks whether this player can see an actor.
+        """
     def close_form(self) -> None:
         """
         Closes the forms that are currently open for the player.
         """
+    def end_batch(self) -> None:
+        """
+        Ends a batch, sending the held packets and flushing them to the client in one network batch.
+        """
     def give_exp(self, amount: int) -> None:
         """
         Gives the player the amount of experience specified.
@@ -1611,6 +2123,10 @@ class Player(Mob):
         """
         Gives the player the amount of experience levels specified.
         """
+    def hide_actor(self, actor: Actor) -> None:
+        """
+        Hides an actor from this player.
+        """
     def kick(self, message: str) -> None:
         """
         Kicks player with custom kick message.
@@ -1647,15 +2163,33 @@ class Player(Mob):
         """
         Sends this player a toast notification.
         """
+    def show_actor(self, actor: Actor) -> None:
+        """
+        Shows an actor to this player that was hidden.
+        """
+    @typing.overload
     def transfer(self, host: str, port: int = 19132) -> None:
         """
         Transfers the player to another server.
         """
+    @typing.overload
+    def transfer(self, host: str, port: int, server_id: str) -> None:
+        """
+        Transfers the player to another server of the network, handing off the data plugins store for the player ahead of the connection.
+        """
     def update_commands(self) -> None:
         """
         Send the list of commands to the client.
         """
     @property
+    def actor_cull_distance(self) -> float | None:
+        """
+        Gets or sets the distance in blocks beyond which actors are not shown to this player, or None.
+        """
+    @actor_cull_distance.setter
+    def actor_cull_distance(self, arg1: float | None) -> None:
+        ...
+    @property
     def address(self) -> SocketAddress:
         """
         Gets the socket address of this player
@@ -1669,6 +2203,14 @@ class Player(Mob):
     def allow_flight(self, arg1: bool) -> None:
         ...
     @property
+    def bandwidth_limit(self) -> int | None:
+        """
+        Gets or sets the bandwidth limit in bytes per second of the packets sent to this player, or None.
+        """
+    @bandwidth_limit.setter
+    def bandwidth_limit(self, arg1: int | None) -> None:
+        ...
+    @property
     def device_id(self) -> str:
         """
         Get the player's current device id.
@@ -1729,6 +2271,16 @@ class Player(Mob):
         Get the player's current locale.
         """
     @property
+    def movement_stats(self) -> MovementStats:
+        """
+        Gets the statistics of the player's movement over the last second.
+        """
+    @property
+    def network_stats(self) -> NetworkStats:
+        """
+        Gets the statistics of the player's network connection.
+        """
+    @property
     def ping(self) -> int:
         """
         Gets the player's average ping in milliseconds.
@@ -1747,6 +2299,11 @@ class Player(Mob):
         Get the player's skin.
         """
     @property
+    def snapshot(self) -> Player.Snapshot:
+        """
+        Gets the state of the player as of the end of the last tick, from any thread.
+        """
+    @property
     def total_exp(self) -> int:
         """
         Gets the players total experience points.
@@ -1757,6 +2314,14 @@ class Player(Mob):
         Returns the UUID of this player
         """
     @property
+    def view_distance(self) -> int | None:
+        """
+        Gets or sets the maximum view distance of this player in chunks, or None if there is none.
+        """
+    @view_distance.setter
+    def view_distance(self, arg1: int | None) -> None:
+        ...
+    @property
     def walk_speed(self) -> float:
         """
         Gets or sets the current allowed speed that a client can walk.
@@ -1769,6 +2334,28 @@ class Player(Mob):
         """
         Returns the Xbox User ID (XUID) of this player
         """
+class PlayerBatchMoveEvent(Event):
+    """
+    Called once per tick with every player that moved further than the thresholds.
+    """
+    class Movement:
+        """
+        Describes the movement of a single player.
+        """
+        @property
+        def from_location(self) -> Location:
+            ...
+        @property
+        def player(self) -> Player:
+            ...
+        @property
+        def to_location(self) -> Location:
+            ...
+    @property
+    def movements(self) -> list[PlayerBatchMoveEvent.Movement]:
+        """
+        Gets the movements of all players that moved this tick.
+        """
 class PlayerChatEvent(PlayerEvent):
     """
     Called when a player sends a chat message.
@@ -1793,6 +2380,30 @@ class PlayerCommandEvent(PlayerEvent):
     @command.setter
     def command(self, arg1: str) -> None:
         ...
+class PlayerDataStore:
+    """
+    Stores blobs of data per player, in a namespace per plugin, and persists them in the background.
+    """
+    def flush(self) -> None:
+        """
+        Hands the queued writes to the I/O workers now rather than with the next batch.
+        """
+    def get(self, plugin: Plugin, player_id: uuid.UUID, key: str) -> bytes | None:
+        """
+        Gets a value stored for a player.
+        """
+    def get_keys(self, plugin: Plugin, player_id: uuid.UUID) -> list[str]:
+        """
+        Gets the keys of all the values a plugin stores for a player.
+        """
+    def remove(self, plugin: Plugin, player_id: uuid.UUID, key: str) -> bool:
+        """
+        Removes a value stored for a player.
+        """
+    def set(self, plugin: Plugin, player_id: uuid.UUID, key: str, value: bytes) -> None:
+        """
+        Stores a value for a player, replacing the previous one.
+        """
 class PlayerDeathEvent(ActorDeathEvent, PlayerEvent):
     """
     Called when a player dies
@@ -1814,6 +2425,25 @@ class PlayerEvent(Event):
         """
         Returns the player involved in this event.
         """
+class PlayerHandoffEvent(Event):
+    """
+    Called when another server of the network hands off a player it transfers to this server.
+    """
+    @property
+    def player_name(self) -> str:
+        """
+        Gets the name of the player being transferred.
+        """
+    @property
+    def source_server_id(self) -> str:
+        """
+        Gets the ID of the server the player is transferred from.
+        """
+    @property
+    def unique_id(self) -> uuid.UUID:
+        """
+        Gets the unique ID of the player being transferred.
+        """
 class PlayerInteractActorEvent(PlayerEvent):
     """
     Represents an event that is called when a player right-clicks an actor.
@@ -1861,6 +2491,11 @@ class PlayerInventory(Inventory):
     """
     Interface to the inventory of a Player, including the four armor slots and any extra slots.
     """
+    @property
+    def changed_slots(self) -> list[int]:
+        """
+        Gets the slots whose contents changed during the last tick, in ascending order
+        """
 class PlayerJoinEvent(PlayerEvent):
     """
     Called when a player joins a server
@@ -1877,10 +2512,45 @@ class PlayerLoginEvent(PlayerEvent):
     @kick_message.setter
     def kick_message(self, arg1: str) -> None:
         ...
+class PlayerMoveEvent(PlayerEvent):
+    """
+    Called when a player moves or turns further than the player movement thresholds.
+    """
+    @property
+    def from_location(self) -> Location:
+        """
+        Gets the location this player moved from.
+        """
+    @property
+    def to_location(self) -> Location:
+        """
+        Gets or sets the location this player moved to.
+        """
+    @to_location.setter
+    def to_location(self, arg1: Location) -> None:
+        ...
 class PlayerQuitEvent(PlayerEvent):
     """
     Called when a player leaves a server.
     """
+class PlayerRegionEnterEvent(PlayerEvent):
+    """
+    Called when a player enters a region added with add_region.
+    """
+    @property
+    def region(self) -> str:
+        """
+        Gets the name of the region the player enters.
+        """
+class PlayerRegionLeaveEvent(PlayerEvent):
+    """
+    Called when a player leaves a region added with add_region.
+    """
+    @property
+    def region(self) -> str:
+        """
+        Gets the name of the region the player leaves.
+        """
 class PlayerTeleportEvent(PlayerEvent):
     """
     Called when a player is teleported from one location to another.
@@ -1968,6 +2638,14 @@ class PluginCommand(Command):
     def executor(self, arg1: CommandExecutor) -> None:
         ...
     @property
+    def is_async(self) -> bool:
+        """
+        Whether the executor of this command runs on the I/O workers of the scheduler
+        """
+    @is_async.setter
+    def is_async(self, arg1: bool) -> None:
+        ...
+    @property
     def plugin(self) -> Plugin:
         """
         The owner of this PluginCommand
@@ -2128,6 +2806,10 @@ class PluginLoader:
         """
         Loads the plugin contained within the specified directory
         """
+    def reload_plugin(self, plugin: Plugin) -> Plugin | None:
+        """
+        Unloads the specified plugin and loads it again from the same source
+        """
     @property
     def server(self) -> Server:
         """
@@ -2257,6 +2939,60 @@ class Position(Vector):
     @dimension.setter
     def dimension(self, arg1: Dimension) -> None:
         ...
+class RegionSnapshot:
+    """
+    A palette compressed copy of the blocks in a cuboid region of a Dimension.
+    """
+    MISSING: typing.ClassVar[int] = 65535
+    @staticmethod
+    def deserialize(data: bytes) -> RegionSnapshot | None:
+        """
+        Decodes a snapshot produced by serialize(), returns None if the data is malformed.
+        """
+    def serialize(self) -> bytes:
+        """
+        Encodes this snapshot into a compact binary form, e.g. to be saved to disk.
+        """
+    @property
+    def index_array(self) -> numpy.ndarray[numpy.uint16]:
+        """
+        Palette index of each block as a read-only uint16 array of shape (size_x, size_y, size_z), without copying the snapshot
+        """
+    @property
+    def indices(self) -> list[int]:
+        """
+        Palette index of each block, with z varying fastest, then y, then x
+        """
+    @property
+    def min_x(self) -> int:
+        ...
+    @property
+    def min_y(self) -> int:
+        ...
+    @property
+    def min_z(self) -> int:
+        ...
+    @property
+    def palette(self) -> list[str]:
+        """
+        The block states used by the region
+        """
+    @property
+    def size_x(self) -> int:
+        ...
+    @property
+    def size_y(self) -> int:
+        ...
+    @property
+    def size_z(self) -> int:
+        ...
+class RemoveActorPacket(Packet):
+    """
+    Represents a packet for removing an actor from the client.
+    """
+    actor_unique_id: int
+    def __init__(self) -> None:
+        ...
 class RenderType:
     """
     Controls the way in which an Objective is rendered on the client side.
@@ -2317,10 +3053,26 @@ class Scheduler:
         """
         Returns a task that will be executed synchronously
         """
+    def run_task_async(self, plugin: Plugin, task: typing.Callable[[], None], delay: int = 0, period: int = 0, executor: AsyncExecutor | None = None) -> Task:
+        """
+        Returns a task that will be executed asynchronously, by the Python worker unless another is given
+        """
+    def run_task_precise(self, plugin: Plugin, task: typing.Callable[[], None], delay: datetime.timedelta = datetime.timedelta(0), period: datetime.timedelta = datetime.timedelta(0)) -> Task:
+        """
+        Returns a task that will be executed synchronously after a delay timed by the clock rather than by ticks
+        """
 class Score:
     """
     Represents a score for an objective on a scoreboard.
     """
+    def reset_viewer_value(self, viewer: Player) -> None:
+        """
+        Removes the score override of a viewer, so that it is shown the shared score again.
+        """
+    def set_viewer_value(self, viewer: Player, score: int) -> None:
+        """
+        Sets the score shown to a single viewer of the scoreboard, without changing it for the other viewers.
+        """
     @property
     def entry(self) -> Player | Actor | str:
         """
@@ -2405,6 +3157,10 @@ class Server:
         """
         Broadcasts the specified message to every user with permission endstone.broadcast.user
         """
+    def broadcast_packet(self, packet: Packet, recipients: list[Player] | None = None) -> None:
+        """
+        Sends a packet to the given players, or every online player, serializing it once for all of them.
+        """
     def create_boss_bar(self, title: str, color: BarColor, style: BarStyle, flags: list[BarFlag] | None = None) -> BossBar:
         """
         Creates a boss bar instance to display to players. The progress defaults to 1.0.
@@ -2413,6 +3169,10 @@ class Server:
         """
         Dispatches a command on this server, and executes it if found.
         """
+    def get_block_type_id(self, type: str) -> int:
+        """
+        Gets the numeric id of a block type, or -1 if there is no block type with this name.
+        """
     def get_new_scoreboard(self) -> Scoreboard:
         """
         Gets a new Scoreboard to be tracked by the server.
@@ -2423,14 +3183,38 @@ class Server:
         Gets the player with the exact given name, case insensitive.
         """
     @typing.overload
+    def get_movement_anomalies(self, max_speed: float, max_acceleration: float) -> list[Player]:
+        """
+        Gets the players whose movement over the last second exceeded the given speed or acceleration.
+        """
+    def get_packet_priority(self, packet_id: int) -> PacketPriority:
+        """
+        Gets the priority of the packets with the given id sent through the API.
+        """
     def get_player(self, unique_id: uuid.UUID) -> Player:
         """
         Gets the player with the given UUID.
         """
+    def get_player_by_runtime_id(self, runtime_id: int) -> Player:
+        """
+        Gets the player with the given runtime id, as used in packets.
+        """
+    def get_player_by_xuid(self, xuid: str) -> Player:
+        """
+        Gets the player with the given Xbox User ID (XUID).
+        """
     def get_plugin_command(self, name: str) -> PluginCommand:
         """
         Gets a PluginCommand with the given name or alias.
         """
+    def get_tick_statistics(self, window: TickWindow = TickWindow.ONE_MINUTE) -> TickStatistics:
+        """
+        Gets the percentiles of the tick durations over a window of recent ticks.
+        """
+    def player_pings(self) -> numpy.ndarray[numpy.int32]:
+        """
+        Gets the ping of every online player in milliseconds as an int32 array, in the order of online_players
+        """
     def reload(self) -> None:
         """
         Reloads the server configuration, functions, scripts and plugins.
@@ -2439,10 +3223,26 @@ class Server:
         """
         Reload only the Minecraft data for the server.
         """
+    def send_translated(self, message: Translatable, recipients: list[Player]) -> None:
+        """
+        Sends a message translated on the server to the given players, one packet per locale.
+        """
+    def set_packet_priority(self, packet_id: int, priority: PacketPriority) -> None:
+        """
+        Sets the priority of the packets with the given id sent through the API.
+        """
+    def set_player_move_thresholds(self, distance: float, rotation: float) -> None:
+        """
+        Sets how far a player has to move, in blocks, or turn, in degrees, before a PlayerMoveEvent is fired.
+        """
     def shutdown(self) -> None:
         """
         Shutdowns the server, stopping everything.
         """
+    def translate(self, message: Translatable, locale: str = '') -> str:
+        """
+        Translates a message on the server, for the given locale or the language of the server if empty.
+        """
     @property
     def average_mspt(self) -> float:
         """
@@ -2497,6 +3297,11 @@ class Server:
     def max_players(self, arg1: int) -> None:
         ...
     @property
+    def messenger(self) -> Messenger:
+        """
+        Gets the messenger plugins exchange messages with the other servers of the network through.
+        """
+    @property
     def minecraft_version(self) -> str:
         """
         Gets the Minecraft version that this server is running.
@@ -2512,6 +3317,21 @@ class Server:
         Gets a list of all currently online players.
         """
     @property
+    def player_data_store(self) -> PlayerDataStore:
+        """
+        Gets the store for the data plugins keep per player.
+        """
+    @property
+    def player_move_distance_threshold(self) -> float:
+        """
+        Gets how far a player has to move before a PlayerMoveEvent is fired.
+        """
+    @property
+    def player_move_rotation_threshold(self) -> float:
+        """
+        Gets how far a player has to turn before a PlayerMoveEvent is fired.
+        """
+    @property
     def plugin_manager(self) -> PluginManager:
         """
         Gets the plugin manager for interfacing with plugins.
@@ -2532,10 +3352,23 @@ class Server:
         Gets the start time of the server.
         """
     @property
+    def tick_consistent_actor_reads(self) -> bool:
+        """
+        Whether actor state is read once per tick and reused by later reads in the same tick.
+        """
+    @tick_consistent_actor_reads.setter
+    def tick_consistent_actor_reads(self, arg1: bool) -> None:
+        ...
+    @property
     def version(self) -> str:
         """
         Gets the version of this server implementation.
         """
+    @property
+    def wall_clock_tick(self) -> int:
+        """
+        Gets the tick the server would be at had every tick run on time.
+        """
 class ServerCommandEvent(Event):
     """
     Called when the console runs a command, early in the process.
@@ -2672,6 +3505,138 @@ class ServerLoadEvent(Event):
     @property
     def type(self) -> ServerLoadEvent.LoadType:
         ...
+class SetScorePacket(Packet):
+    """
+    Represents a packet for changing or removing scores.
+    """
+    class Action:
+        CHANGE: typing.ClassVar[SetScorePacket.Action]  # value = <Action.CHANGE: 0>
+        REMOVE: typing.ClassVar[SetScorePacket.Action]  # value = <Action.REMOVE: 1>
+        __members__: typing.ClassVar[dict[str, SetScorePacket.Action]]  # value = {'CHANGE': <Action.CHANGE: 0>, 'REMOVE': <Action.REMOVE: 1>}
+        def __eq__(self, other: typing.Any) -> bool:
+            ...
+        def __getstate__(self) -> int:
+            ...
+        def __hash__(self) -> int:
+            ...
+        def __index__(self) -> int:
+            ...
+        def __init__(self, value: int) -> None:
+            ...
+        def __int__(self) -> int:
+            ...
+        def __ne__(self, other: typing.Any) -> bool:
+            ...
+        def __repr__(self) -> str:
+            ...
+        def __setstate__(self, state: int) -> None:
+            ...
+        def __str__(self) -> str:
+            ...
+        @property
+        def name(self) -> str:
+            ...
+        @property
+        def value(self) -> int:
+            ...
+    class Entry:
+        """
+        Represents a single score entry.
+        """
+        actor_id: int
+        fake_player_name: str
+        identity_type: SetScorePacket.IdentityType
+        objective_name: str
+        score: int
+        scoreboard_id: int
+        def __init__(self) -> None:
+            ...
+    class IdentityType:
+        ACTOR: typing.ClassVar[SetScorePacket.IdentityType]  # value = <IdentityType.ACTOR: 2>
+        FAKE_PLAYER: typing.ClassVar[SetScorePacket.IdentityType]  # value = <IdentityType.FAKE_PLAYER: 3>
+        PLAYER: typing.ClassVar[SetScorePacket.IdentityType]  # value = <IdentityType.PLAYER: 1>
+        __members__: typing.ClassVar[dict[str, SetScorePacket.IdentityType]]  # value = {'PLAYER': <IdentityType.PLAYER: 1>, 'ACTOR': <IdentityType.ACTOR: 2>, 'FAKE_PLAYER': <IdentityType.FAKE_PLAYER: 3>}
+        def __eq__(self, other: typing.Any) -> bool:
+            ...
+        def __getstate__(self) -> int:
+            ...
+        def __hash__(self) -> int:
+            ...
+        def __index__(self) -> int:
+            ...
+        def __init__(self, value: int) -> None:
+            ...
+        def __int__(self) -> int:
+            ...
+        def __ne__(self, other: typing.Any) -> bool:
+            ...
+        def __repr__(self) -> str:
+            ...
+        def __setstate__(self, state: int) -> None:
+            ...
+        def __str__(self) -> str:
+            ...
+        @property
+        def name(self) -> str:
+            ...
+        @property
+        def value(self) -> int:
+            ...
+    action: SetScorePacket.Action
+    entries: list[SetScorePacket.Entry]
+    def __init__(self) -> None:
+        ...
+class SetTitlePacket(Packet):
+    """
+    Represents a packet for showing titles.
+    """
+    class TitleType:
+        ACTION_BAR: typing.ClassVar[SetTitlePacket.TitleType]  # value = <TitleType.ACTION_BAR: 4>
+        ACTION_BAR_TEXT_OBJECT: typing.ClassVar[SetTitlePacket.TitleType]  # value = <TitleType.ACTION_BAR_TEXT_OBJECT: 8>
+        CLEAR: typing.ClassVar[SetTitlePacket.TitleType]  # value = <TitleType.CLEAR: 0>
+        RESET: typing.ClassVar[SetTitlePacket.TitleType]  # value = <TitleType.RESET: 1>
+        SUBTITLE: typing.ClassVar[SetTitlePacket.TitleType]  # value = <TitleType.SUBTITLE: 3>
+        SUBTITLE_TEXT_OBJECT: typing.ClassVar[SetTitlePacket.TitleType]  # value = <TitleType.SUBTITLE_TEXT_OBJECT: 7>
+        TIMES: typing.ClassVar[SetTitlePacket.TitleType]  # value = <TitleType.TIMES: 5>
+        TITLE: typing.ClassVar[SetTitlePacket.TitleType]  # value = <TitleType.TITLE: 2>
+        TITLE_TEXT_OBJECT: typing.ClassVar[SetTitlePacket.TitleType]  # value = <TitleType.TITLE_TEXT_OBJECT: 6>
+        __members__: typing.ClassVar[dict[str, SetTitlePacket.TitleType]]  # value = {'CLEAR': <TitleType.CLEAR: 0>, 'RESET': <TitleType.RESET: 1>, 'TITLE': <TitleType.TITLE: 2>, 'SUBTITLE': <TitleType.SUBTITLE: 3>, 'ACTION_BAR': <TitleType.ACTION_BAR: 4>, 'TIMES': <TitleType.TIMES: 5>, 'TITLE_TEXT_OBJECT': <TitleType.TITLE_TEXT_OBJECT: 6>, 'SUBTITLE_TEXT_OBJECT': <TitleType.SUBTITLE_TEXT_OBJECT: 7>, 'ACTION_BAR_TEXT_OBJECT': <TitleType.ACTION_BAR_TEXT_OBJECT: 8>}
+        def __eq__(self, other: typing.Any) -> bool:
+            ...
+        def __getstate__(self) -> int:
+            ...
+        def __hash__(self) -> int:
+            ...
+        def __index__(self) -> int:
+            ...
+        def __init__(self, value: int) -> None:
+            ...
+        def __int__(self) -> int:
+            ...
+        def __ne__(self, other: typing.Any) -> bool:
+            ...
+        def __repr__(self) -> str:
+            ...
+        def __setstate__(self, state: int) -> None:
+            ...
+        def __str__(self) -> str:
+            ...
+        @property
+        def name(self) -> str:
+            ...
+        @property
+        def value(self) -> int:
+            ...
+    fade_in_time: int
+    fade_out_time: int
+    filtered_text: str
+    platform_online_id: str
+    stay_time: int
+    text: str
+    title_type: SetTitlePacket.TitleType
+    xuid: str
+    def __init__(self) -> None:
+        ...
 class Skin:
     def __init__(self, skin_id: str, skin_data: numpy.ndarray[numpy.uint8], cape_id: str | None = None, cape_data: numpy.ndarray[numpy.uint8] | None = None) -> None:
         ...
@@ -2834,10 +3799,92 @@ class Task:
         Returns the Plugin that owns the task.
         """
     @property
+    def phase(self) -> TaskPhase:
+        """
+        Gets or sets the phase of the server tick this task runs in.
+        """
+    @phase.setter
+    def phase(self, arg1: TaskPhase) -> None:
+        ...
+    @property
+    def priority(self) -> TaskPriority:
+        """
+        Gets or sets the priority of this task.
+        """
+    @priority.setter
+    def priority(self, arg1: TaskPriority) -> None:
+        ...
+    @property
     def task_id(self) -> int:
         """
         Returns the task id.
         """
+class TaskPhase:
+    """
+    Represents when a sync task runs within the server tick it is due.
+    """
+    POST_TICK: typing.ClassVar[TaskPhase]  # value = <TaskPhase.POST_TICK: 1>
+    PRE_TICK: typing.ClassVar[TaskPhase]  # value = <TaskPhase.PRE_TICK: 0>
+    __members__: typing.ClassVar[dict[str, TaskPhase]]  # value = {'PRE_TICK': <TaskPhase.PRE_TICK: 0>, 'POST_TICK': <TaskPhase.POST_TICK: 1>}
+    def __eq__(self, other: typing.Any) -> bool:
+        ...
+    def __getstate__(self) -> int:
+        ...
+    def __hash__(self) -> int:
+        ...
+    def __index__(self) -> int:
+        ...
+    def __init__(self, value: int) -> None:
+        ...
+    def __int__(self) -> int:
+        ...
+    def __ne__(self, other: typing.Any) -> bool:
+        ...
+    def __repr__(self) -> str:
+        ...
+    def __setstate__(self, state: int) -> None:
+        ...
+    def __str__(self) -> str:
+        ...
+    @property
+    def name(self) -> str:
+        ...
+    @property
+    def value(self) -> int:
+        ...
+class TaskPriority:
+    """
+    Represents how a sync task is treated once the scheduler has spent its time budget for a tick.
+    """
+    CRITICAL: typing.ClassVar[TaskPriority]  # value = <TaskPriority.CRITICAL: 1>
+    NORMAL: typing.ClassVar[TaskPriority]  # value = <TaskPriority.NORMAL: 0>
+    __members__: typing.ClassVar[dict[str, TaskPriority]]  # value = {'NORMAL': <TaskPriority.NORMAL: 0>, 'CRITICAL': <TaskPriority.CRITICAL: 1>}
+    def __eq__(self, other: typing.Any) -> bool:
+        ...
+    def __getstate__(self) -> int:
+        ...
+    def __hash__(self) -> int:
+        ...
+    def __index__(self) -> int:
+        ...
+    def __init__(self, value: int) -> None:
+        ...
+    def __int__(self) -> int:
+        ...
+    def __ne__(self, other: typing.Any) -> bool:
+        ...
+    def __repr__(self) -> str:
+        ...
+    def __setstate__(self, state: int) -> None:
+        ...
+    def __str__(self) -> str:
+        ...
+    @property
+    def name(self) -> str:
+        ...
+    @property
+    def value(self) -> int:
+        ...
 class TextInput:
     """
     Represents a text input field.
@@ -2868,6 +3915,60 @@ class TextInput:
     @placeholder.setter
     def placeholder(self, arg1: str | Translatable) -> TextInput:
         ...
+class TextPacket(Packet):
+    """
+    Represents a packet for sending a chat message.
+    """
+    class TextType:
+        ANNOUNCEMENT: typing.ClassVar[TextPacket.TextType]  # value = <TextType.ANNOUNCEMENT: 8>
+        CHAT: typing.ClassVar[TextPacket.TextType]  # value = <TextType.CHAT: 1>
+        JUKEBOX_POPUP: typing.ClassVar[TextPacket.TextType]  # value = <TextType.JUKEBOX_POPUP: 4>
+        OBJECT: typing.ClassVar[TextPacket.TextType]  # value = <TextType.OBJECT: 10>
+        OBJECT_ANNOUNCEMENT: typing.ClassVar[TextPacket.TextType]  # value = <TextType.OBJECT_ANNOUNCEMENT: 11>
+        OBJECT_WHISPER: typing.ClassVar[TextPacket.TextType]  # value = <TextType.OBJECT_WHISPER: 9>
+        POPUP: typing.ClassVar[TextPacket.TextType]  # value = <TextType.POPUP: 3>
+        RAW: typing.ClassVar[TextPacket.TextType]  # value = <TextType.RAW: 0>
+        SYSTEM: typing.ClassVar[TextPacket.TextType]  # value = <TextType.SYSTEM: 6>
+        TIP: typing.ClassVar[TextPacket.TextType]  # value = <TextType.TIP: 5>
+        TRANSLATION: typing.ClassVar[TextPacket.TextType]  # value = <TextType.TRANSLATION: 2>
+        WHISPER: typing.ClassVar[TextPacket.TextType]  # value = <TextType.WHISPER: 7>
+        __members__: typing.ClassVar[dict[str, TextPacket.TextType]]  # value = {'RAW': <TextType.RAW: 0>, 'CHAT': <TextType.CHAT: 1>, 'TRANSLATION': <TextType.TRANSLATION: 2>, 'POPUP': <TextType.POPUP: 3>, 'JUKEBOX_POPUP': <TextType.JUKEBOX_POPUP: 4>, 'TIP': <TextType.TIP: 5>, 'SYSTEM': <TextType.SYSTEM: 6>, 'WHISPER': <TextType.WHISPER: 7>, 'ANNOUNCEMENT': <TextType.ANNOUNCEMENT: 8>, 'OBJECT_WHISPER': <TextType.OBJECT_WHISPER: 9>, 'OBJECT': <TextType.OBJECT: 10>, 'OBJECT_ANNOUNCEMENT': <TextType.OBJECT_ANNOUNCEMENT: 11>}
+        def __eq__(self, other: typing.Any) -> bool:
+            ...
+        def __getstate__(self) -> int:
+            ...
+        def __hash__(self) -> int:
+            ...
+        def __index__(self) -> int:
+            ...
+        def __init__(self, value: int) -> None:
+            ...
+        def __int__(self) -> int:
+            ...
+        def __ne__(self, other: typing.Any) -> bool:
+            ...
+        def __repr__(self) -> str:
+            ...
+        def __setstate__(self, state: int) -> None:
+            ...
+        def __str__(self) -> str:
+            ...
+        @property
+        def name(self) -> str:
+            ...
+        @property
+        def value(self) -> int:
+            ...
+    filtered_message: str
+    message: str
+    needs_translation: bool
+    parameters: list[str]
+    platform_id: str
+    source_name: str
+    text_type: TextPacket.TextType
+    xuid: str
+    def __init__(self) -> None:
+        ...
 class ThunderChangeEvent(Event):
     """
     Called when the thunder state in a world is changing.
@@ -2882,6 +3983,78 @@ class ThunderChangeEvent(Event):
         """
         Gets the state of thunder that the world is being set to
         """
+class TickStatistics:
+    """
+    Percentiles of the durations of the server ticks in a window.
+    """
+    @property
+    def count(self) -> int:
+        """
+        Number of ticks in the window.
+        """
+    @property
+    def max(self) -> datetime.timedelta:
+        """
+        Duration of the slowest tick.
+        """
+    @property
+    def p50(self) -> datetime.timedelta:
+        """
+        Median tick duration.
+        """
+    @property
+    def p95(self) -> datetime.timedelta:
+        """
+        Tick duration that 95% of the ticks were faster than or equal to.
+        """
+    @property
+    def p99(self) -> datetime.timedelta:
+        """
+        Tick duration that 99% of the ticks were faster than or equal to.
+        """
+class TickWindow:
+    """
+    The window of recent ticks that TickStatistics are computed over.
+    """
+    FIFTEEN_MINUTES: typing.ClassVar[TickWindow]  # value = <TickWindow.FIFTEEN_MINUTES: 3>
+    FIVE_MINUTES: typing.ClassVar[TickWindow]  # value = <TickWindow.FIVE_MINUTES: 2>
+    ONE_MINUTE: typing.ClassVar[TickWindow]  # value = <TickWindow.ONE_MINUTE: 1>
+    ONE_SECOND: typing.ClassVar[TickWindow]  # value = <TickWindow.ONE_SECOND: 0>
+    __members__: typing.ClassVar[dict[str, TickWindow]]  # value = {'ONE_SECOND': <TickWindow.ONE_SECOND: 0>, 'ONE_MINUTE': <TickWindow.ONE_MINUTE: 1>, 'FIVE_MINUTES': <TickWindow.FIVE_MINUTES: 2>, 'FIFTEEN_MINUTES': <TickWindow.FIFTEEN_MINUTES: 3>}
+    def __eq__(self, other: typing.Any) -> bool:
+        ...
+    def __getstate__(self) -> int:
+        ...
+    def __hash__(self) -> int:
+        ...
+    def __index__(self) -> int:
+        ...
+    def __init__(self, value: int) -> None:
+        ...
+    def __int__(self) -> int:
+        ...
+    def __ne__(self, other: typing.Any) -> bool:
+        ...
+    def __repr__(self) -> str:
+        ...
+    def __setstate__(self, state: int) -> None:
+        ...
+    def __str__(self) -> str:
+        ...
+    @property
+    def name(self) -> str:
+        ...
+    @property
+    def value(self) -> int:
+        ...
+class ToastRequestPacket(Packet):
+    """
+    Represents a packet for showing a toast notification.
+    """
+    content: str
+    title: str
+    def __init__(self) -> None:
+        ...
 class Toggle:
     """
     Represents a toggle button with a label.
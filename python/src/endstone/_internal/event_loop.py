@@ -0,0 +1,55 @@
+import asyncio
+import time
+
+__all__ = ["EndstoneEventLoop"]
+
+
+class EndstoneEventLoop(asyncio.SelectorEventLoop):
+    """
+    An asyncio event loop stepped by the server thread, once per tick, instead of running on a thread of its own.
+
+    Each step polls the selector without blocking and runs the ready callbacks, until nothing is ready or the time
+    budget is spent. Coroutines therefore run on the server thread between ticks and may use the Endstone API.
+    """
+
+    DEFAULT_BUDGET = 0.005  # seconds per tick
+
+    def __init__(self, logger=None):
+        super().__init__()
+        self._logger = logger
+        if logger is not None:
+            self.set_exception_handler(self._log_exception)
+
+    def step(self, budget: float = DEFAULT_BUDGET) -> None:
+        if self.is_closed() or self.is_running():
+            return
+
+        deadline = time.perf_counter() + budget
+        while True:
+            # A pending stop makes the iteration poll the selector with a zero timeout, so it never blocks the tick
+            self.call_soon(self.stop)
+            self.run_forever()
+            if not self._ready or time.perf_counter() >= deadline:
+                break
+
+    def shutdown(self) -> None:
+        """
+        Cancels the pending tasks and closes the loop, running it until the cancellations are handled.
+        """
+        if self.is_closed():
+            return
+
+        tasks = [task for task in asyncio.all_tasks(self) if not task.done()]
+        for task in tasks:
+            task.cancel()
+        if tasks:
+            self.run_until_complete(asyncio.gather(*tasks, return_exceptions=True))
+        self.run_until_complete(self.shutdown_asyncgens())
+        self.close()
+
+    def _log_exception(self, loop, context) -> None:
+        message = context.get("message", "Unhandled exception in event loop")
+        exception = context.get("exception")
+        if exception is not None:
+            message = f"{message}: {exception!r}"
+        self._logger.error(message)
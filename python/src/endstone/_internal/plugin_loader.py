@@ -1,4 +1,5 @@
 import glob
+import hashlib
 import importlib
 import os
 import os.path
@@ -6,7 +7,9 @@ import shutil
 import site
 import subprocess
 import sys
-from typing import List
+import tracemalloc
+from concurrent.futures import ThreadPoolExecutor
+from typing import List, Optional, Tuple
 
 from endstone import Server
 from endstone.command import Command
@@ -14,7 +17,7 @@ from endstone.permissions import Permission, PermissionDefault
 from endstone.plugin import PluginDescription, PluginLoader, Plugin, PluginLoadOrder
 from importlib_metadata import entry_points, metadata
 
-__all__ = ["PythonPluginLoader"]
+__all__ = ["PythonPluginLoader", "install_wheels"]
 
 
 def find_python():
@@ -33,12 +36,82 @@ def find_python():
     raise RuntimeError(f"Unable to find Python executable. Attempted paths: {paths}")
 
 
+def hash_file(path: str) -> str:
+    digest = hashlib.sha256()
+    with open(path, "rb") as f:
+        for chunk in iter(lambda: f.read(1 << 20), b""):
+            digest.update(chunk)
+    return digest.hexdigest()[:32]
+
+
+def install_wheels(directory: str, logger) -> List[str]:
+    """
+    Installs every wheel of the directory into a prefix of its own, named after the hash of the wheel, and returns
+    the prefixes. Wheels installed by a previous start are kept, only new or changed wheels are installed, in
+    parallel.
+
+    The bootstrap calls this when preparing an image so that the prefixes are baked in and nothing is installed on
+    start.
+    """
+    prefix = os.path.join(directory, ".local")
+    os.makedirs(prefix, exist_ok=True)
+
+    wheels = {hash_file(file): file for file in sorted(glob.glob(os.path.join(directory, "*.whl")))}
+
+    # Removes the installs of wheels that were changed or removed, and any left unfinished
+    for entry in os.listdir(prefix):
+        if entry not in wheels:
+            shutil.rmtree(os.path.join(prefix, entry), ignore_errors=True)
+
+    missing = [(file, os.path.join(prefix, key)) for key, file in wheels.items()
+               if not os.path.isdir(os.path.join(prefix, key))]
+    if missing:
+        with ThreadPoolExecutor(max_workers=min(len(missing), os.cpu_count() or 1)) as executor:
+            list(executor.map(lambda args: _install_wheel(*args, logger), missing))
+
+    installed = [os.path.join(prefix, key) for key in wheels]
+    return [path for path in installed if os.path.isdir(path)]
+
+
+def _install_wheel(file: str, target: str, logger) -> None:
+    env = os.environ.copy()
+    env.pop("LD_PRELOAD", "")
+
+    # Installed next to the target and renamed once complete, so an interrupted install is never picked up
+    temp = target + ".tmp"
+    shutil.rmtree(temp, ignore_errors=True)
+    logger.info(f"Installing {os.path.basename(file)}")
+    result = subprocess.run(
+        [
+            sys.executable,
+            "-m",
+            "pip",
+            "install",
+            file,
+            "--prefix",
+            temp,
+            "--quiet",
+            "--no-warn-script-location",
+            "--disable-pip-version-check",
+        ],
+        env=env,
+    )
+    if result.returncode != 0:
+        logger.error(f"Error occurred when trying to install {os.path.basename(file)}.")
+        shutil.rmtree(temp, ignore_errors=True)
+        return
+
+    os.replace(temp, target)
+
+
 class PythonPluginLoader(PluginLoader):
     SUPPORTED_API = ["0.5"]
+    MEMORY_TRACE_FRAMES = 16
 
     def __init__(self, server: Server):
         PluginLoader.__init__(self, server)
         self._plugins = []
+        self._sources = {}
         sys.executable = find_python()
 
     @staticmethod
@@ -72,121 +145,176 @@ class PythonPluginLoader(PluginLoader):
             if module.startswith("endstone_"):
                 del sys.modules[module]
 
-        env = os.environ.copy()
-        env.pop("LD_PRELOAD", "")
-
-        prefix = os.path.join(directory, ".local")
-        shutil.rmtree(prefix, ignore_errors=True)
-
-        for file in glob.glob(os.path.join(directory, "*.whl")):
-            subprocess.run(
-                [
-                    sys.executable,
-                    "-m",
-                    "pip",
-                    "install",
-                    file,
-                    "--prefix",
-                    prefix,
-                    "--quiet",
-                    "--no-warn-script-location",
-                    "--disable-pip-version-check",
-                ],
-                env=env,
-            )
-
-        for site_dir in site.getsitepackages(prefixes=[prefix]):
+        for site_dir in site.getsitepackages(prefixes=install_wheels(directory, self.server.logger)):
             site.addsitedir(site_dir)
 
         loaded_plugins = []
         eps = entry_points(group="endstone")
         for ep in eps:
-            # enforce naming convention
-            if not ep.dist.name.replace("_", "-").startswith("endstone-"):
-                self.server.logger.error(
-                    f"Error occurred when trying to load plugin from entry point '{ep.name}': Invalid name."
-                )
-                self.server.logger.error(
-                    f"The name of distribution ({ep.dist.name}) does not start with 'endstone-' or 'endstone_'."
-                )
-                continue
-
-            dist_name = "endstone-" + ep.name.replace("_", "-")
-            if ep.dist.name.replace("_", "-") != dist_name:
-                self.server.logger.error(
-                    f"Error occurred when trying to load plugin from entry point '{ep.name}': Invalid name."
-                )
-                self.server.logger.error(f"You need to make **ONE** of the following changes.")
-                self.server.logger.error(
-                    f"* If you intend to use the current entry point name ({ep.name}), "
-                    f"please change the distribution name from '{ep.dist.name}' to '{dist_name}'."
-                )
-                self.server.logger.error(
-                    f"* If not, " f"please change the entry point name from '{ep.name}' to '{ep.dist.name[9:]}'."
-                )
-                continue
-
-            # get distribution metadata
-            try:
-                plugin_metadata = metadata(ep.dist.name).json
-                cls = ep.load()
-            except Exception as e:
-                self.server.logger.error(f"Error occurred when trying to load plugin from entry point '{ep.name}': {e}")
-                continue
-
-            # prepare plugin description
-            cls_attr = dict(cls.__dict__)
-            name = cls_attr.pop("name", ep.name.replace("-", "_"))
-            version = cls_attr.pop("version", plugin_metadata["version"])
-
-            api_version = cls_attr.pop("api_version", None)
-            if api_version is None:
-                self.server.logger.warning(
-                    f"Plugin '{name}' does not specify an API version. This may prevent the plugin from loading in "
-                    f"future releases."
-                )
-            elif api_version not in self.SUPPORTED_API:
-                self.server.logger.error(
-                    f"Error occurred when trying to load plugin '{name}': plugin was designed for API version: "
-                    f"{api_version} which is not compatible with this server."
-                )
-                continue
-
-            load = cls_attr.pop("load", None)
-            if load is not None:
-                if isinstance(load, str):
-                    load = PluginLoadOrder.__members__[load.strip().replace(" ", "_").upper()]
-                elif not isinstance(load, PluginLoadOrder):
-                    raise TypeError(f"Invalid value for load order: {load}")
-
-            description = cls_attr.pop("description", plugin_metadata.get("summary", None))
-            authors = cls_attr.pop("authors", plugin_metadata.get("author_email", "").split(","))
-            website = cls_attr.pop("website", "; ".join(plugin_metadata.get("project_url", [])))
-
-            commands = cls_attr.pop("commands", {})
-            commands = self._build_commands(commands)
-
-            permissions = cls_attr.pop("permissions", {})
-            permissions = self._build_permissions(permissions)
-
-            plugin_description = PluginDescription(
-                name=name,
-                version=version,
-                load=load,
-                description=description,
-                authors=authors,
-                website=website,
-                commands=commands,
-                permissions=permissions,
-                **cls_attr,
+            plugin = self._load_plugin(ep, directory)
+            if plugin is not None:
+                loaded_plugins.append(plugin)
+
+        return loaded_plugins
+
+    def reload_plugin(self, plugin: Plugin) -> Optional[Plugin]:
+        source = self._sources.pop(plugin.name, None)
+        if source is None or plugin not in self._plugins:
+            return None
+
+        ep, directory = source
+        self._plugins.remove(plugin)
+
+        # Only the package of the plugin is imported again, the modules of other plugins are left alone
+        package = ep.module.split(".")[0]
+        for module in list(sys.modules.keys()):
+            if module == package or module.startswith(package + "."):
+                del sys.modules[module]
+
+        for site_dir in site.getsitepackages(prefixes=install_wheels(directory, self.server.logger)):
+            site.addsitedir(site_dir)
+        importlib.invalidate_caches()
+
+        for new_ep in entry_points(group="endstone", name=ep.name):
+            return self._load_plugin(new_ep, directory)
+
+        self.server.logger.error(f"Error occurred when trying to reload plugin '{plugin.name}': Entry point is gone.")
+        return None
+
+    def _load_plugin(self, ep, directory) -> Optional[Plugin]:
+        # enforce naming convention
+        if not ep.dist.name.replace("_", "-").startswith("endstone-"):
+            self.server.logger.error(
+                f"Error occurred when trying to load plugin from entry point '{ep.name}': Invalid name."
             )
+            self.server.logger.error(
+                f"The name of distribution ({ep.dist.name}) does not start with 'endstone-' or 'endstone_'."
+            )
+            return None
 
-            # instantiate plugin
-            plugin = cls()
-            if not isinstance(plugin, Plugin):
-                raise TypeError(f"Main class {ep.value} does not extend endstone.plugin.Plugin")
-            plugin._description = plugin_description
-            self._plugins.append(plugin)
-            loaded_plugins.append(plugin)
+        dist_name = "endstone-" + ep.name.replace("_", "-")
+        if ep.dist.name.replace("_", "-") != dist_name:
+            self.server.logger.error(
+                f"Error occurred when trying to load plugin from entry point '{ep.name}': Invalid name."
+            )
+            self.server.logger.error(f"You need to make **ONE** of the following changes.")
+            self.server.logger.error(
+                f"* If you intend to use the current entry point name ({ep.name}), "
+                f"please change the distribution name from '{ep.dist.name}' to '{dist_name}'."
+            )
+            self.server.logger.error(
+                f"* If not, " f"please change the entry point name from '{ep.name}' to '{ep.dist.name[9:]}'."
+            )
+            return None
 
-        return loaded_plugins
+        # get distribution metadata
+        try:
+            plugin_metadata = metadata(ep.dist.name).json
+            cls = ep.load()
+        except Exception as e:
+            self.server.logger.error(f"Error occurred when trying to load plugin from entry point '{ep.name}': {e}")
+            return None
+
+        # prepare plugin description
+        cls_attr = dict(cls.__dict__)
+        name = cls_attr.pop("name", ep.name.replace("-", "_"))
+        version = cls_attr.pop("version", plugin_metadata["version"])
+
+        api_version = cls_attr.pop("api_version", None)
+        if api_version is None:
+            self.server.logger.warning(
+                f"Plugin '{name}' does not specify an API version. This may prevent the plugin from loading in "
+                f"future releases."
+            )
+        elif api_version not in self.SUPPORTED_API:
+            self.server.logger.error(
+                f"Error occurred when trying to load plugin '{name}': plugin was designed for API version: "
+                f"{api_version} which is not compatible with this server."
+            )
+            return None
+
+        load = cls_attr.pop("load", None)
+        if load is not None:
+            if isinstance(load, str):
+                load = PluginLoadOrder.__members__[load.strip().replace(" ", "_").upper()]
+            elif not isinstance(load, PluginLoadOrder):
+                raise TypeError(f"Invalid value for load order: {load}")
+
+        description = cls_attr.pop("description", plugin_metadata.get("summary", None))
+        authors = cls_attr.pop("authors", plugin_metadata.get("author_email", "").split(","))
+        website = cls_attr.pop("website", "; ".join(plugin_metadata.get("project_url", [])))
+
+        commands = cls_attr.pop("commands", {})
+        commands = self._build_commands(commands)
+
+        permissions = cls_attr.pop("permissions", {})
+        permissions = self._build_permissions(permissions)
+
+        plugin_description = PluginDescription(
+            name=name,
+            version=version,
+            load=load,
+            description=description,
+            authors=authors,
+            website=website,
+            commands=commands,
+            permissions=permissions,
+            **cls_attr,
+        )
+
+        # instantiate plugin
+        plugin = cls()
+        if not isinstance(plugin, Plugin):
+            raise TypeError(f"Main class {ep.value} does not extend endstone.plugin.Plugin")
+        plugin._description = plugin_description
+        self._plugins.append(plugin)
+        self._sources[plugin_description.name] = (ep, directory)
+        return plugin
+
+    def start_memory_tracing(self) -> None:
+        if not tracemalloc.is_tracing():
+            tracemalloc.start(self.MEMORY_TRACE_FRAMES)
+
+    def stop_memory_tracing(self) -> None:
+        tracemalloc.stop()
+
+    def is_memory_tracing(self) -> bool:
+        return tracemalloc.is_tracing()
+
+    def get_memory_usage(self) -> List[Tuple[str, int]]:
+        """
+        Returns the bytes currently allocated by each plugin since tracing started, largest first. An allocation is
+        attributed to the plugin owning the innermost frame of its traceback that lies in the package of a plugin.
+        """
+        if not tracemalloc.is_tracing():
+            return []
+
+        roots = []
+        for name, (ep, _) in self._sources.items():
+            module = sys.modules.get(ep.module.split(".")[0])
+            for path in getattr(module, "__path__", []):
+                roots.append((os.path.join(os.path.abspath(path), ""), name))
+
+        owners = {}
+        usage = dict.fromkeys(self._sources, 0)
+        for trace in tracemalloc.take_snapshot().traces:
+            for frame in reversed(trace.traceback):
+                if frame.filename not in owners:
+                    owners[frame.filename] = next(
+                        (name for root, name in roots if frame.filename.startswith(root)), None
+                    )
+                owner = owners[frame.filename]
+                if owner is not None:
+                    usage[owner] += trace.size
+                    break
+
+        return sorted(usage.items(), key=lambda item: item[1], reverse=True)
+
+    def disable_plugin(self, plugin: Plugin) -> None:
+        # Pending coroutines are cancelled while the plugin is still enabled, so their cleanup may use the API
+        loop = getattr(plugin, "_loop", None)
+        if plugin.enabled and loop is not None:
+            plugin._loop = None
+            loop.shutdown()
+
+        super().disable_plugin(plugin)
@@ -1,3 +1,3 @@
-from endstone._internal.endstone_python import Actor, Mob
+from endstone._internal.endstone_python import Actor, Mob, MovementStats
 
-__all__ = ["Actor", "Mob"]
+__all__ = ["Actor", "Mob", "MovementStats"]
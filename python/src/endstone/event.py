@@ -10,16 +10,23 @@ from endstone._internal.endstone_python import (
     BlockBreakEvent,
     BlockPlaceEvent,
     PlayerEvent,
+    PlayerBatchMoveEvent,
     PlayerChatEvent,
+    AsyncPlayerChatEvent,
     PlayerCommandEvent,
     PlayerDeathEvent,
     PlayerInteractEvent,
     PlayerInteractActorEvent,
     PlayerJoinEvent,
     PlayerLoginEvent,
+    PlayerMoveEvent,
     PlayerQuitEvent,
+    PlayerRegionEnterEvent,
+    PlayerRegionLeaveEvent,
     PlayerTeleportEvent,
     BroadcastMessageEvent,
+    PacketReceiveEvent,
+    PlayerHandoffEvent,
     PluginEnableEvent,
     PluginDisableEvent,
     ServerCommandEvent,
@@ -42,16 +49,23 @@ __all__ = [
     "BlockBreakEvent",
     "BlockPlaceEvent",
     "PlayerEvent",
+    "PlayerBatchMoveEvent",
     "PlayerChatEvent",
+    "AsyncPlayerChatEvent",
     "PlayerCommandEvent",
     "PlayerDeathEvent",
     "PlayerInteractEvent",
     "PlayerInteractActorEvent",
     "PlayerJoinEvent",
     "PlayerLoginEvent",
+    "PlayerMoveEvent",
     "PlayerQuitEvent",
+    "PlayerRegionEnterEvent",
+    "PlayerRegionLeaveEvent",
     "PlayerTeleportEvent",
     "BroadcastMessageEvent",
+    "PacketReceiveEvent",
+    "PlayerHandoffEvent",
     "PluginEnableEvent",
     "PluginDisableEvent",
     "ServerCommandEvent",
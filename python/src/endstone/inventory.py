@@ -1,3 +1,3 @@
-from endstone._internal.endstone_python import ItemStack, Inventory, PlayerInventory
+from endstone._internal.endstone_python import ItemStack, ItemStackView, Inventory, PlayerInventory
 
-__all__ = ["ItemStack", "Inventory", "PlayerInventory"]
+__all__ = ["ItemStack", "ItemStackView", "Inventory", "PlayerInventory"]
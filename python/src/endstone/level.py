@@ -1,3 +1,3 @@
-from endstone._internal.endstone_python import Dimension, Level, Location, Position
+from endstone._internal.endstone_python import Dimension, Level, Location, Position, RegionSnapshot
 
-__all__ = ["Dimension", "Level", "Location", "Position"]
+__all__ = ["Dimension", "Level", "Location", "Position", "RegionSnapshot"]
@@ -0,0 +1,3 @@
+from endstone._internal.endstone_python import Messenger
+
+__all__ = ["Messenger"]
@@ -1,3 +1,29 @@
-from endstone._internal.endstone_python import Packet, PacketType, SpawnParticleEffectPacket
+from endstone._internal.endstone_python import (
+    BossEventPacket,
+    MoveActorAbsolutePacket,
+    NetworkStats,
+    Packet,
+    PacketPriority,
+    PacketType,
+    RemoveActorPacket,
+    SetScorePacket,
+    SetTitlePacket,
+    SpawnParticleEffectPacket,
+    TextPacket,
+    ToastRequestPacket,
+)
 
-__all__ = ["Packet", "PacketType", "SpawnParticleEffectPacket"]
+__all__ = [
+    "BossEventPacket",
+    "MoveActorAbsolutePacket",
+    "NetworkStats",
+    "Packet",
+    "PacketPriority",
+    "PacketType",
+    "RemoveActorPacket",
+    "SetScorePacket",
+    "SetTitlePacket",
+    "SpawnParticleEffectPacket",
+    "TextPacket",
+    "ToastRequestPacket",
+]
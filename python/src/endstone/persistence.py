@@ -0,0 +1,3 @@
+from endstone._internal.endstone_python import PlayerDataStore
+
+__all__ = ["PlayerDataStore"]
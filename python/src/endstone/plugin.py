@@ -1,3 +1,4 @@
+import asyncio
 import inspect
 import os
 import shutil
@@ -6,6 +7,7 @@ from pathlib import Path
 
 import tomlkit
 from endstone._internal import endstone_python
+from endstone._internal.event_loop import EndstoneEventLoop
 from endstone._internal.endstone_python import (
     PluginCommand,
     PluginDescription,
@@ -58,6 +60,7 @@ class Plugin(endstone_python.Plugin):
         self._description: typing.Optional[PluginDescription] = None
         self._config = None
         self._listeners = []
+        self._loop: typing.Optional[EndstoneEventLoop] = None
 
     def _get_description(self) -> PluginDescription:
         return self._description
@@ -99,6 +102,21 @@ class Plugin(endstone_python.Plugin):
                 getattr(event_cls, "NAME", event_cls.__name__), func, priority, self, ignore_cancelled
             )
 
+    @property
+    def loop(self) -> asyncio.AbstractEventLoop:
+        """
+        The asyncio event loop of this plugin, stepped on the server thread every tick while the plugin is enabled.
+        Its pending tasks are cancelled when the plugin is disabled.
+        """
+        if not self.enabled:
+            raise RuntimeError(f"Plugin {self.name} attempted to use its event loop while not enabled")
+
+        if self._loop is None:
+            self._loop = EndstoneEventLoop(self.logger)
+            self.server.scheduler.run_task(self, self._loop.step, delay=0, period=1)
+
+        return self._loop
+
     @property
     def config(self) -> dict:
         if self._config is None:
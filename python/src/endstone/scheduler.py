@@ -1,3 +1,3 @@
-from endstone._internal.endstone_python import Scheduler, Task
+from endstone._internal.endstone_python import AsyncExecutor, Scheduler, Task, TaskPhase, TaskPriority
 
-__all__ = ["Scheduler", "Task"]
+__all__ = ["AsyncExecutor", "Scheduler", "Task", "TaskPhase", "TaskPriority"]
@@ -0,0 +1,59 @@
+import asyncio
+import time
+
+import pytest
+from endstone._internal.event_loop import EndstoneEventLoop
+
+
+@pytest.fixture
+def loop():
+    loop = EndstoneEventLoop()
+    yield loop
+    loop.shutdown()
+
+
+def test_step_runs_ready_callbacks(loop):
+    steps = []
+
+    async def work():
+        steps.append(1)
+        await asyncio.sleep(0)
+        steps.append(2)
+        await asyncio.sleep(0.01)
+        steps.append(3)
+
+    loop.create_task(work())
+    loop.step()
+    assert steps == [1, 2]
+
+    time.sleep(0.02)
+    loop.step()
+    assert steps == [1, 2, 3]
+
+
+def test_step_does_not_block(loop):
+    async def idle():
+        await asyncio.sleep(10)
+
+    loop.create_task(idle())
+    start = time.perf_counter()
+    loop.step()
+    assert time.perf_counter() - start < 0.1
+
+
+def test_shutdown_cancels_pending_tasks():
+    loop = EndstoneEventLoop()
+    cancelled = []
+
+    async def idle():
+        try:
+            await asyncio.sleep(10)
+        except asyncio.CancelledError:
+            cancelled.append(True)
+            raise
+
+    loop.create_task(idle())
+    loop.step()
+    loop.shutdown()
+    assert cancelled == [True]
+    assert loop.is_closed()
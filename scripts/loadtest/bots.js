@@ -0,0 +1,196 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Connects a swarm of headless clients to a Bedrock server and prints one JSON line of statistics per second.
+// The packet field sets below follow the schema of the bedrock-protocol release pinned in package.json.
+
+'use strict';
+
+const bedrock = require('bedrock-protocol');
+
+function parseArgs(argv) {
+    const options = {
+        host: '127.0.0.1',
+        port: 19132,
+        bots: 100,
+        ramp: 100,
+        duration: 300,
+        prefix: 'bot',
+        version: undefined,
+        actionInterval: 1000,
+        formCommand: '',
+    };
+    for (let i = 2; i < argv.length; i += 2) {
+        const key = argv[i].replace(/^--/, '').replace(/-([a-z])/g, (_, c) => c.toUpperCase());
+        if (!(key in options)) {
+            throw new Error(`unknown option ${argv[i]}`);
+        }
+        const value = argv[i + 1];
+        options[key] = typeof options[key] === 'number' ? Number(value) : value;
+    }
+    return options;
+}
+
+const options = parseArgs(process.argv);
+
+const stats = {
+    connected: 0,
+    spawned: 0,
+    disconnects: 0,
+    errors: 0,
+    chats: 0,
+    moves: 0,
+    breaks: 0,
+    forms: 0,
+    rtts: [],
+};
+
+function percentile(sorted, p) {
+    if (sorted.length === 0) {
+        return null;
+    }
+    return sorted[Math.min(sorted.length - 1, Math.floor(p * sorted.length))];
+}
+
+function report(elapsed) {
+    const rtts = stats.rtts.sort((a, b) => a - b);
+    const line = {
+        t: elapsed,
+        connected: stats.connected,
+        spawned: stats.spawned,
+        disconnects: stats.disconnects,
+        errors: stats.errors,
+        chats: stats.chats,
+        moves: stats.moves,
+        breaks: stats.breaks,
+        forms: stats.forms,
+        chat_rtt_ms: {p50: percentile(rtts, 0.5), p95: percentile(rtts, 0.95), max: percentile(rtts, 1)},
+    };
+    process.stdout.write(JSON.stringify(line) + '\n');
+    stats.rtts = [];
+}
+
+function sendCommand(client, command) {
+    client.queue('command_request', {
+        command,
+        origin: {type: 'player', uuid: client.profile.uuid, request_id: ''},
+        internal: false,
+        version: 52,
+    });
+}
+
+function sendChat(client, message) {
+    client.queue('text', {
+        type: 'chat',
+        needs_translation: false,
+        source_name: client.username,
+        message,
+        xuid: '',
+        platform_chat_id: '',
+        filtered_message: '',
+    });
+}
+
+// Movement and block breaking go through commands, so every bot needs operator permission on the server
+const actions = [
+    (bot) => {
+        const dx = Math.floor(Math.random() * 9) - 4;
+        const dz = Math.floor(Math.random() * 9) - 4;
+        sendCommand(bot.client, `/tp @s ~${dx} ~ ~${dz}`);
+        stats.moves++;
+    },
+    (bot) => {
+        const nonce = `${bot.client.username}:${bot.sequence++}`;
+        bot.pending.set(nonce, Date.now());
+        sendChat(bot.client, `loadtest ${nonce}`);
+        stats.chats++;
+    },
+    (bot) => {
+        sendCommand(bot.client, '/setblock ~1 ~ ~1 stone');
+        sendCommand(bot.client, '/setblock ~1 ~ ~1 air destroy');
+        stats.breaks++;
+    },
+    (bot) => {
+        if (options.formCommand) {
+            sendCommand(bot.client, options.formCommand);
+        }
+    },
+];
+
+function spawnBot(index) {
+    const client = bedrock.createClient({
+        host: options.host,
+        port: options.port,
+        username: `${options.prefix}${index}`,
+        offline: true,
+        skipPing: true,
+        version: options.version,
+        conLog: null,
+    });
+    const bot = {client, sequence: 0, pending: new Map(), timer: null};
+
+    client.on('join', () => stats.connected++);
+    client.on('spawn', () => {
+        stats.spawned++;
+        // Spread the bots over the interval so they do not all act in the same tick
+        setTimeout(() => {
+            bot.timer = setInterval(() => {
+                actions[Math.floor(Math.random() * actions.length)](bot);
+            }, options.actionInterval);
+        }, Math.random() * options.actionInterval);
+    });
+    client.on('text', (packet) => {
+        const match = /loadtest (\S+)/.exec(packet.message || '');
+        if (match && bot.pending.has(match[1])) {
+            stats.rtts.push(Date.now() - bot.pending.get(match[1]));
+            bot.pending.delete(match[1]);
+        }
+    });
+    client.on('modal_form_request', (packet) => {
+        stats.forms++;
+        client.queue('modal_form_response', {
+            form_id: packet.form_id,
+            has_response_data: false,
+            has_cancel_reason: true,
+            cancel_reason: 'user_closed',
+        });
+    });
+    client.on('close', () => {
+        clearInterval(bot.timer);
+        stats.disconnects++;
+    });
+    client.on('error', () => stats.errors++);
+    return bot;
+}
+
+const bots = [];
+const start = Date.now();
+for (let i = 0; i < options.bots; i++) {
+    setTimeout(() => bots.push(spawnBot(i)), i * options.ramp);
+}
+
+const reporter = setInterval(() => report(Math.round((Date.now() - start) / 1000)), 1000);
+
+function shutdown() {
+    clearInterval(reporter);
+    for (const bot of bots) {
+        clearInterval(bot.timer);
+        bot.client.close();
+    }
+    setTimeout(() => process.exit(0), 1000);
+}
+
+setTimeout(shutdown, options.duration * 1000);
+process.on('SIGINT', shutdown);
+process.on('SIGTERM', shutdown);
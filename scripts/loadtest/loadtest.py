@@ -0,0 +1,206 @@
+"""Puts a Bedrock server under simulated player load and records how it copes.
+
+The `run` command drives bots.js against a running server while sampling the process and, for Endstone, the
+Prometheus endpoint enabled by ENDSTONE_METRICS_ADDRESS. The `compare` command prints two saved runs side by side,
+typically an Endstone run against a vanilla BDS baseline that was loaded the same way.
+"""
+
+import argparse
+import json
+import os
+import re
+import statistics
+import subprocess
+import sys
+import threading
+import time
+import urllib.request
+from pathlib import Path
+from typing import Dict, List, Optional, Tuple
+
+_HERE = Path(__file__).resolve().parent
+_SAMPLE = re.compile(r"^([a-zA-Z_:][a-zA-Z0-9_:]*)(\{[^}]*\})?\s+(\S+)")
+
+
+def scrape(url: str) -> Dict[str, float]:
+    """Reads every endstone_* sample from a Prometheus text endpoint, keyed by name and labels."""
+    with urllib.request.urlopen(url, timeout=2) as response:
+        text = response.read().decode()
+    samples = {}
+    for line in text.splitlines():
+        match = _SAMPLE.match(line)
+        if match and match.group(1).startswith("endstone_"):
+            samples[match.group(1) + (match.group(2) or "")] = float(match.group(3))
+    return samples
+
+
+def process_usage(pid: int) -> Tuple[float, int]:
+    """Returns the CPU seconds used so far and the resident set size in bytes of a Linux process."""
+    with open(f"/proc/{pid}/stat") as f:
+        fields = f.read().rsplit(")", 1)[1].split()
+    ticks = os.sysconf("SC_CLK_TCK")
+    cpu = (int(fields[11]) + int(fields[12])) / ticks
+    rss = int(fields[21]) * os.sysconf("SC_PAGE_SIZE")
+    return cpu, rss
+
+
+def tick_durations(before: Dict[str, float], after: Dict[str, float]) -> Optional[Dict[str, float]]:
+    """Derives the mean and 95th percentile tick duration in milliseconds between two scrapes."""
+    name = "endstone_tick_duration_seconds"
+    count = after.get(f"{name}_count", 0) - before.get(f"{name}_count", 0)
+    if count <= 0:
+        return None
+    total = after.get(f"{name}_sum", 0) - before.get(f"{name}_sum", 0)
+    buckets = []
+    for key, value in after.items():
+        match = re.match(rf'^{name}_bucket\{{le="([^"]+)"\}}$', key)
+        if match:
+            buckets.append((float(match.group(1)), value - before.get(key, 0)))
+    buckets.sort()
+    p95 = None
+    for bound, cumulative in buckets:
+        if cumulative >= 0.95 * count:
+            p95 = bound * 1000
+            break
+    return {"mspt_mean": total / count * 1000, "mspt_p95_upper": p95}
+
+
+def summarize(series: List[Optional[float]]) -> Optional[Dict[str, float]]:
+    values = [v for v in series if v is not None]
+    if not values:
+        return None
+    return {"mean": statistics.fmean(values), "min": min(values), "max": max(values)}
+
+
+def run(args: argparse.Namespace) -> None:
+    command = [
+        "node",
+        str(_HERE / "bots.js"),
+        "--host", args.host,
+        "--port", str(args.port),
+        "--bots", str(args.bots),
+        "--ramp", str(args.ramp),
+        "--duration", str(args.duration),
+        "--action-interval", str(args.action_interval),
+    ]  # fmt: skip
+    if args.version:
+        command += ["--version", args.version]
+    if args.form_command:
+        command += ["--form-command", args.form_command]
+
+    bots = subprocess.Popen(command, stdout=subprocess.PIPE, text=True, cwd=_HERE)
+    latest = {}
+
+    def read_bots() -> None:
+        for line in bots.stdout:
+            try:
+                latest.update(json.loads(line))
+            except json.JSONDecodeError:
+                print(line, end="", file=sys.stderr)
+
+    reader = threading.Thread(target=read_bots, daemon=True)
+    reader.start()
+
+    samples = []
+    previous_metrics = scrape(args.metrics) if args.metrics else None
+    previous_cpu = process_usage(args.pid)[0] if args.pid else None
+    start = previous_time = time.monotonic()
+    while bots.poll() is None:
+        time.sleep(args.interval)
+        now = time.monotonic()
+        sample = {"t": round(now - start, 3), "bots": dict(latest)}
+        if args.pid:
+            cpu, rss = process_usage(args.pid)
+            sample["cpu_percent"] = (cpu - previous_cpu) / (now - previous_time) * 100
+            sample["rss_bytes"] = rss
+            previous_cpu = cpu
+        if args.metrics:
+            metrics = scrape(args.metrics)
+            sample["tps"] = metrics.get("endstone_ticks_per_second")
+            sample["tick_usage"] = metrics.get("endstone_tick_usage_ratio")
+            sample.update(tick_durations(previous_metrics, metrics) or {})
+            sample["metrics"] = metrics
+            previous_metrics = metrics
+        previous_time = now
+        samples.append(sample)
+        print(
+            f"bots={latest.get('spawned', 0)}/{args.bots} tps={sample.get('tps')} mspt={sample.get('mspt_mean')} "
+            f"cpu={sample.get('cpu_percent')} rtt_p95={latest.get('chat_rtt_ms', {}).get('p95')}",
+            file=sys.stderr,
+        )
+    reader.join(timeout=2)
+
+    # Only the samples taken once every bot has joined describe the server at full load
+    loaded = [s for s in samples if s["bots"].get("spawned", 0) >= args.bots] or samples
+    for s in loaded:
+        s["chat_rtt_p95_ms"] = s["bots"].get("chat_rtt_ms", {}).get("p95")
+    result = {
+        "label": args.label,
+        "config": {k: v for k, v in vars(args).items() if k != "func"},
+        "summary": {
+            key: summarize([s.get(key) for s in loaded])
+            for key in (
+                "tps",
+                "tick_usage",
+                "mspt_mean",
+                "mspt_p95_upper",
+                "cpu_percent",
+                "rss_bytes",
+                "chat_rtt_p95_ms",
+            )
+        },
+        "disconnects": latest.get("disconnects"),
+        "samples": samples,
+    }
+    Path(args.output).write_text(json.dumps(result, indent=2))
+    print(f"Results written to {args.output}", file=sys.stderr)
+
+
+def compare(args: argparse.Namespace) -> None:
+    baseline = json.loads(Path(args.baseline).read_text())
+    candidate = json.loads(Path(args.candidate).read_text())
+    print(f"{'metric':<20}{baseline['label']:>16}{candidate['label']:>16}{'change':>10}")
+    def show(value: Optional[float]) -> str:
+        return "n/a" if value is None else f"{value:.6g}"
+
+    for key in sorted(baseline["summary"].keys() | candidate["summary"].keys()):
+        before = (baseline["summary"].get(key) or {}).get("mean")
+        after = (candidate["summary"].get(key) or {}).get("mean")
+        if before is None and after is None:
+            continue
+        change = f"{(after - before) / before * 100:+.1f}%" if before and after is not None else "n/a"
+        print(f"{key:<20}{show(before):>16}{show(after):>16}{change:>10}")
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    commands = parser.add_subparsers(required=True)
+
+    run_parser = commands.add_parser("run", help="load a running server and record the result")
+    run_parser.add_argument("--host", default="127.0.0.1")
+    run_parser.add_argument("--port", type=int, default=19132)
+    run_parser.add_argument("--bots", type=int, default=100, help="number of simulated players")
+    run_parser.add_argument("--ramp", type=int, default=100, help="milliseconds between two bots joining")
+    run_parser.add_argument("--duration", type=int, default=300, help="seconds the bots stay connected")
+    run_parser.add_argument("--action-interval", type=int, default=1000, help="milliseconds between bot actions")
+    run_parser.add_argument("--version", help="Minecraft version the bots speak, defaults to the latest")
+    run_parser.add_argument("--form-command", help="command that makes the server send the bot a form")
+    run_parser.add_argument(
+        "--metrics", help="Prometheus endpoint of an Endstone server, e.g. http://127.0.0.1:9464/metrics"
+    )
+    run_parser.add_argument("--pid", type=int, help="process id of the server, to sample its CPU and memory")
+    run_parser.add_argument("--interval", type=float, default=5, help="seconds between two samples")
+    run_parser.add_argument("--label", default="endstone", help="name of this run in comparisons")
+    run_parser.add_argument("--output", default="loadtest.json")
+    run_parser.set_defaults(func=run)
+
+    compare_parser = commands.add_parser("compare", help="compare two recorded runs")
+    compare_parser.add_argument("baseline")
+    compare_parser.add_argument("candidate")
+    compare_parser.set_defaults(func=compare)
+
+    args = parser.parse_args()
+    args.func(args)
+
+
+if __name__ == "__main__":
+    main()
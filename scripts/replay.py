@@ -0,0 +1,158 @@
+"""Reads the replay logs written by a server started with ENDSTONE_REPLAY_RECORD=<path>.
+
+The `summary` command prints what a log holds and its slowest ticks, with the packets and commands received just
+before each of them. The `compare` command lines up the ticks of two logs of the same inputs, e.g. recorded on the
+live server and on a staging server, and prints where their timings differ.
+"""
+
+import argparse
+import collections
+import sys
+from pathlib import Path
+from typing import Iterator, List, NamedTuple, Tuple
+
+MAGIC = b"ESRP"
+VERSION = 1
+TICK, PACKET, COMMAND = 1, 2, 3
+
+
+class Record(NamedTuple):
+    type: int
+    time_us: int
+    fields: tuple
+
+
+def _varint(data: bytes, pos: int) -> Tuple[int, int]:
+    value = shift = 0
+    while True:
+        if pos >= len(data):
+            raise EOFError
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            return value, pos
+
+
+def _string(data: bytes, pos: int) -> Tuple[bytes, int]:
+    size, pos = _varint(data, pos)
+    if pos + size > len(data):
+        raise EOFError
+    return data[pos : pos + size], pos + size
+
+
+def read(path: Path) -> Iterator[Record]:
+    """Yields the records of a log, a record cut short at the end of the file ends it."""
+    data = path.read_bytes()
+    if data[: len(MAGIC)] != MAGIC or len(data) <= len(MAGIC) or data[len(MAGIC)] != VERSION:
+        sys.exit(f"{path} is not a replay log of version {VERSION}")
+    pos = len(MAGIC) + 1
+    try:
+        while pos < len(data):
+            kind = data[pos]
+            time_us, pos = _varint(data, pos + 1)
+            if kind == TICK:
+                fields = []
+                for _ in range(4):  # tick, scheduler, level, post tick
+                    value, pos = _varint(data, pos)
+                    fields.append(value)
+            elif kind == PACKET:
+                packet_id, pos = _varint(data, pos)
+                sub_client_id, pos = _varint(data, pos)
+                body, pos = _string(data, pos)
+                fields = [packet_id, sub_client_id, body]
+            elif kind == COMMAND:
+                sender, pos = _string(data, pos)
+                command, pos = _string(data, pos)
+                fields = [sender.decode(errors="replace"), command.decode(errors="replace")]
+            else:
+                print(f"unknown record type {kind} at offset {pos}, stopping", file=sys.stderr)
+                return
+            yield Record(kind, time_us, tuple(fields))
+    except EOFError:
+        print("the log ends with a truncated record", file=sys.stderr)
+
+
+def _tick_ms(record: Record) -> float:
+    return sum(record.fields[1:]) / 1000
+
+
+def summary(args: argparse.Namespace) -> None:
+    ticks: List[Tuple[Record, List[Record]]] = []
+    inputs: List[Record] = []
+    packets = collections.Counter()
+    commands = 0
+    for record in read(args.log):
+        if record.type == TICK:
+            ticks.append((record, inputs))
+            inputs = []
+        else:
+            inputs.append(record)
+            if record.type == PACKET:
+                packets[record.fields[0]] += 1
+            else:
+                commands += 1
+
+    duration = ticks[-1][0].time_us / 1e6 if ticks else 0
+    print(f"{len(ticks)} ticks over {duration:.1f}s, {sum(packets.values())} packets, {commands} commands")
+    for packet_id, count in packets.most_common(10):
+        print(f"  packet {packet_id:>4}: {count}")
+
+    print(f"slowest {args.top} ticks:")
+    for tick, received in sorted(ticks, key=lambda t: _tick_ms(t[0]), reverse=True)[: args.top]:
+        number, scheduler, level, post_tick = tick.fields
+        print(f"  tick {number}: {_tick_ms(tick):.2f} ms "
+              f"(scheduler {scheduler / 1000:.2f}, level {level / 1000:.2f}, post tick {post_tick / 1000:.2f})")
+        ids = collections.Counter(r.fields[0] for r in received if r.type == PACKET)
+        if ids:
+            print("    packets before: " + ", ".join(f"{i} x{n}" for i, n in ids.most_common(5)))
+        for command in (r for r in received if r.type == COMMAND):
+            print(f"    command from {command.fields[0]}: {command.fields[1]}")
+
+
+def compare(args: argparse.Namespace) -> None:
+    base = [r for r in read(args.base) if r.type == TICK]
+    other = [r for r in read(args.other) if r.type == TICK]
+    count = min(len(base), len(other))
+    if count == 0:
+        sys.exit("no ticks to compare")
+
+    def mean(records: List[Record], field: int) -> float:
+        return sum(r.fields[field] for r in records[:count]) / count / 1000
+
+    print(f"{count} ticks compared (of {len(base)} and {len(other)})")
+    print(f"{'phase':<10}{'base ms':>12}{'other ms':>12}{'change':>10}")
+    for field, name in ((1, "scheduler"), (2, "level"), (3, "post tick")):
+        a, b = mean(base, field), mean(other, field)
+        change = f"{(b - a) / a * 100:+.1f}%" if a else "-"
+        print(f"{name:<10}{a:>12.3f}{b:>12.3f}{change:>10}")
+
+    # Ticks are matched by their position, both servers ran the same inputs from the start
+    diffs = sorted(range(count), key=lambda i: abs(_tick_ms(other[i]) - _tick_ms(base[i])), reverse=True)
+    print(f"largest {args.top} differences:")
+    for i in diffs[: args.top]:
+        print(f"  tick #{i}: {_tick_ms(base[i]):.2f} ms -> {_tick_ms(other[i]):.2f} ms")
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    summary_parser = commands.add_parser("summary", help="print what a log holds and its slowest ticks")
+    summary_parser.add_argument("log", type=Path)
+    summary_parser.add_argument("--top", type=int, default=10)
+    summary_parser.set_defaults(func=summary)
+
+    compare_parser = commands.add_parser("compare", help="compare the tick timings of two logs")
+    compare_parser.add_argument("base", type=Path)
+    compare_parser.add_argument("other", type=Path)
+    compare_parser.add_argument("--top", type=int, default=10)
+    compare_parser.set_defaults(func=compare)
+
+    args = parser.parse_args()
+    args.func(args)
+
+
+if __name__ == "__main__":
+    main()
@@ -20,6 +20,7 @@
 #include "bedrock/server/commands/standard/teleport_command.h"
 #include "bedrock/world/actor/actor.h"
 #include "bedrock/world/actor/actor_collision.h"
+#include "bedrock/world/actor/actor_type.h"
 #include "bedrock/world/level/dimension/vanilla_dimensions.h"
 #include "bedrock/world/level/level.h"
 #include "endstone/detail/level/dimension.h"
@@ -88,6 +89,11 @@ void EndstoneActor::recalculatePermissions()
     getPermissibleBase().recalculatePermissions();
 }
 
+void EndstoneActor::recalculatePermission(PermissionAttachment &attachment, const std::string &name, bool value)
+{
+    getPermissibleBase().recalculatePermission(attachment, name, value);
+}
+
 std::unordered_set<PermissionAttachmentInfo *> EndstoneActor::getEffectivePermissions() const
 {
     return getPermissibleBase().getEffectivePermissions();
@@ -110,38 +116,33 @@ std::uint64_t EndstoneActor::getRuntimeId() const
 
 Location EndstoneActor::getLocation() const
 {
-    auto position = actor_.getPosition();
-    position.y -= actor_.getPersistentComponent<OffsetsComponent>()->height_offset;
-    const auto &rotation = actor_.getRotation();
-
-    return {&getDimension(), position.x, position.y, position.z, rotation.x, rotation.y};
+    if (const auto *state = getTickState()) {
+        return state->location;
+    }
+    return readLocation();
 }
 
 Vector<float> EndstoneActor::getVelocity() const
 {
-    if (actor_.hasCategory(ActorCategory::Mob) || actor_.hasCategory(ActorCategory::Ridable)) {
-        auto *actor = actor_.getVehicle();
-        if (!actor) {
-            actor = &actor_;
-        }
-        auto *component = actor->tryGetComponent<PostTickPositionDeltaComponent>();
-        if (component) {
-            const auto &delta = component->value;
-            return {delta.x, delta.y, delta.z};
-        }
+    if (const auto *state = getTickState()) {
+        return state->velocity;
     }
-
-    const auto &delta = actor_.getPosDelta();
-    return {delta.x, delta.y, delta.z};
+    return readVelocity();
 }
 
 bool EndstoneActor::isOnGround() const
 {
+    if (const auto *state = getTickState()) {
+        return state->on_ground;
+    }
     return actor_.isOnGround();
 }
 
 bool EndstoneActor::isInWater() const
 {
+    if (const auto *state = getTickState()) {
+        return state->in_water;
+    }
     return actor_.isInWater();
 }
 
@@ -157,12 +158,16 @@ Level &EndstoneActor::getLevel() const
 
 Dimension &EndstoneActor::getDimension() const
 {
-    return *getLevel().getDimension(actor_.getDimension().getName());
+    if (const auto *state = getTickState()) {
+        return *state->location.getDimension();
+    }
+    return readDimension();
 }
 
 void EndstoneActor::setRotation(float yaw, float pitch)
 {
     actor_.setRotationWrapped({pitch, yaw});
+    tick_state_.reset();
 }
 
 void EndstoneActor::teleport(Location location)
@@ -183,6 +188,7 @@ void EndstoneActor::teleport(Location location)
                                                  CommandVersion::CurrentVersion);
 
     TeleportCommand::applyTarget(actor_, std::move(target), /*keep_velocity*/ false);
+    tick_state_.reset();
 }
 
 void EndstoneActor::teleport(Actor &target)
@@ -200,6 +206,11 @@ bool EndstoneActor::isDead() const
     return !actor_.isAlive();
 }
 
+std::string EndstoneActor::getType() const
+{
+    return EntityTypeToString(actor_.getEntityTypeId(), ActorTypeNamespaceRules::ReturnWithNamespace);
+}
+
 PermissibleBase &EndstoneActor::getPermissibleBase()
 {
     static std::unique_ptr<PermissibleBase> perm = []() {
@@ -215,4 +226,48 @@ PermissibleBase &EndstoneActor::getPermissibleBase()
     return actor_;
 }
 
+const EndstoneActor::TickState *EndstoneActor::getTickState() const
+{
+    if (!server_.isTickConsistentActorReads()) {
+        return nullptr;
+    }
+    auto tick = server_.getCurrentTick();
+    if (!tick_state_ || tick_state_->tick != tick) {
+        tick_state_.emplace(TickState{tick, readLocation(), readVelocity(), actor_.isOnGround(), actor_.isInWater()});
+    }
+    return &tick_state_.value();
+}
+
+Location EndstoneActor::readLocation() const
+{
+    auto position = actor_.getPosition();
+    position.y -= actor_.getPersistentComponent<OffsetsComponent>()->height_offset;
+    const auto &rotation = actor_.getRotation();
+
+    return {&readDimension(), position.x, position.y, position.z, rotation.x, rotation.y};
+}
+
+Vector<float> EndstoneActor::readVelocity() const
+{
+    if (actor_.hasCategory(::ActorCategory::Mob) || actor_.hasCategory(::ActorCategory::Ridable)) {
+        auto *actor = actor_.getVehicle();
+        if (!actor) {
+            actor = &actor_;
+        }
+        auto *component = actor->tryGetComponent<PostTickPositionDeltaComponent>();
+        if (component) {
+            const auto &delta = component->value;
+            return {delta.x, delta.y, delta.z};
+        }
+    }
+
+    const auto &delta = actor_.getPosDelta();
+    return {delta.x, delta.y, delta.z};
+}
+
+Dimension &EndstoneActor::readDimension() const
+{
+    return *static_cast<EndstoneLevel &>(getLevel()).getDimension(actor_.getDimension());
+}
+
 }  // namespace endstone::detail
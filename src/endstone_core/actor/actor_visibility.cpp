@@ -0,0 +1,159 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/actor/actor_visibility.h"
+
+#include <utility>
+
+namespace endstone::detail {
+
+bool RuntimeIdSet::insert(std::uint64_t id)
+{
+    auto &page = pages_[id / PageBits];
+    auto &word = page.words[(id % PageBits) / WordBits];
+    const auto bit = std::uint64_t{1} << (id % WordBits);
+    if (word & bit) {
+        return false;
+    }
+    word |= bit;
+    ++page.count;
+    ++size_;
+    return true;
+}
+
+bool RuntimeIdSet::erase(std::uint64_t id)
+{
+    auto it = pages_.find(id / PageBits);
+    if (it == pages_.end()) {
+        return false;
+    }
+    auto &page = it->second;
+    auto &word = page.words[(id % PageBits) / WordBits];
+    const auto bit = std::uint64_t{1} << (id % WordBits);
+    if (!(word & bit)) {
+        return false;
+    }
+    word &= ~bit;
+    --size_;
+    if (--page.count == 0) {
+        pages_.erase(it);
+    }
+    return true;
+}
+
+bool RuntimeIdSet::contains(std::uint64_t id) const
+{
+    auto it = pages_.find(id / PageBits);
+    if (it == pages_.end()) {
+        return false;
+    }
+    return (it->second.words[(id % PageBits) / WordBits] >> (id % WordBits)) & 1;
+}
+
+std::size_t RuntimeIdSet::size() const
+{
+    return size_;
+}
+
+bool RuntimeIdSet::empty() const
+{
+    return size_ == 0;
+}
+
+void RuntimeIdSet::clear()
+{
+    pages_.clear();
+    size_ = 0;
+}
+
+bool ActorVisibility::hide(std::uint64_t runtime_id)
+{
+    hidden_.insert(runtime_id);
+    return removed_.insert(runtime_id);
+}
+
+bool ActorVisibility::show(std::uint64_t runtime_id)
+{
+    if (!hidden_.erase(runtime_id) || culled_.contains(runtime_id)) {
+        return false;
+    }
+    return removed_.erase(runtime_id);
+}
+
+bool ActorVisibility::isHidden(std::uint64_t runtime_id) const
+{
+    return hidden_.contains(runtime_id);
+}
+
+void ActorVisibility::forget(std::uint64_t runtime_id)
+{
+    hidden_.erase(runtime_id);
+    culled_.erase(runtime_id);
+    removed_.erase(runtime_id);
+}
+
+void ActorVisibility::reset()
+{
+    culled_.clear();
+    removed_.clear();
+}
+
+void ActorVisibility::setCullDistance(std::optional<float> distance)
+{
+    cull_distance_ = distance;
+}
+
+std::optional<float> ActorVisibility::getCullDistance() const
+{
+    return cull_distance_;
+}
+
+bool ActorVisibility::isActive() const
+{
+    return cull_distance_.has_value() || !hidden_.empty() || !removed_.empty();
+}
+
+void ActorVisibility::update(const Vector<float> &viewer, const ArenaVector<std::uint64_t> &runtime_ids,
+                             const VectorArray<float> &positions, ArenaVector<std::size_t> &remove,
+                             ArenaVector<std::size_t> &add)
+{
+    if (cull_distance_) {
+        positions.withinRadius(viewer, *cull_distance_, mask_);
+    }
+    else {
+        mask_.assign(runtime_ids.size(), 1);
+    }
+
+    // Rebuilt from the actors around the player, so an actor that comes back into range is removed again
+    RuntimeIdSet removed;
+    culled_.clear();
+    for (std::size_t i = 0; i < runtime_ids.size(); ++i) {
+        const auto id = runtime_ids[i];
+        const bool culled = mask_[i] == 0;
+        if (culled) {
+            culled_.insert(id);
+        }
+        if (culled || hidden_.contains(id)) {
+            // Sent again on every update, vanilla may have added the actor back since
+            remove.push_back(i);
+            removed.insert(id);
+        }
+        else if (removed_.contains(id)) {
+            add.push_back(i);
+        }
+    }
+    removed_ = std::move(removed);
+}
+
+}  // namespace endstone::detail
@@ -90,6 +90,11 @@ void EndstoneMob::recalculatePermissions()
     EndstoneActor::recalculatePermissions();
 }
 
+void EndstoneMob::recalculatePermission(PermissionAttachment &attachment, const std::string &name, bool value)
+{
+    EndstoneActor::recalculatePermission(attachment, name, value);
+}
+
 std::unordered_set<PermissionAttachmentInfo *> EndstoneMob::getEffectivePermissions() const
 {
     return EndstoneActor::getEffectivePermissions();
@@ -171,6 +176,11 @@ bool EndstoneMob::isDead() const
     return EndstoneActor::isDead();
 }
 
+std::string EndstoneMob::getType() const
+{
+    return EndstoneActor::getType();
+}
+
 bool EndstoneMob::isGliding() const
 {
     return mob_.isGliding();
@@ -14,6 +14,7 @@
 
 #include "endstone/detail/block/block.h"
 
+#include "bedrock/world/level/block/registry/block_type_registry.h"
 #include "bedrock/world/level/dimension/dimension.h"
 #include "endstone/detail/block/block_face.h"
 
@@ -25,7 +26,23 @@ EndstoneBlock::EndstoneBlock(BlockSource &block_source, BlockPos block_pos)
 
 std::string EndstoneBlock::getType() const
 {
-    return block_source_.getBlock(block_pos_).getLegacyBlock().getFullNameId();
+    return getBlock().getLegacyBlock().getFullNameId();
+}
+
+int EndstoneBlock::getTypeId() const
+{
+    const auto &legacy = getBlock().getLegacyBlock();
+    auto &ids = getTypeIds();
+    if (auto id = ids.find(&legacy); id != BlockTypeIds::Unknown) {
+        return id;
+    }
+    // Registered after the ids were numbered
+    return ids.add(&legacy, legacy.getFullNameId());
+}
+
+std::string_view EndstoneBlock::getTypeName() const
+{
+    return getBlock().getLegacyBlock().getFullNameId();
 }
 
 std::unique_ptr<Block> EndstoneBlock::getRelative(int offset_x, int offset_y, int offset_z)
@@ -74,4 +91,35 @@ std::unique_ptr<EndstoneBlock> EndstoneBlock::at(BlockSource &block_source, Bloc
     return std::make_unique<EndstoneBlock>(block_source, block_pos);
 }
 
+EndstoneBlock EndstoneBlock::view(BlockSource &block_source, BlockPos block_pos)
+{
+    EndstoneBlock block{block_source, block_pos};
+    block.is_view_ = true;
+    return block;
+}
+
+const ::Block &EndstoneBlock::getBlock() const
+{
+    if (!is_view_) {
+        return block_source_.getBlock(block_pos_);
+    }
+    if (!block_) {
+        block_ = &block_source_.getBlock(block_pos_);
+    }
+    return *block_;
+}
+
+BlockTypeIds &EndstoneBlock::getTypeIds()
+{
+    static BlockTypeIds ids = []() {
+        BlockTypeIds result;
+        BlockTypeRegistry::forEachBlock([&result](const BlockLegacy &legacy) {
+            result.add(&legacy, legacy.getFullNameId());
+            return true;
+        });
+        return result;
+    }();
+    return ids;
+}
+
 }  // namespace endstone::detail
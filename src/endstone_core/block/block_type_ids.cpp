@@ -0,0 +1,64 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/block/block_type_ids.h"
+
+namespace endstone::detail {
+
+int BlockTypeIds::add(const BlockLegacy *legacy, std::string name)
+{
+    if (auto it = legacy_ids_.find(legacy); it != legacy_ids_.end()) {
+        return it->second;
+    }
+
+    // Block types registered under the same name share one id
+    auto id = find(name);
+    if (id == Unknown) {
+        id = static_cast<int>(names_.size());
+        ids_.emplace(names_.emplace_back(std::move(name)), id);
+    }
+    legacy_ids_.emplace(legacy, id);
+    return id;
+}
+
+int BlockTypeIds::find(const BlockLegacy *legacy) const
+{
+    if (auto it = legacy_ids_.find(legacy); it != legacy_ids_.end()) {
+        return it->second;
+    }
+    return Unknown;
+}
+
+int BlockTypeIds::find(std::string_view name) const
+{
+    if (auto it = ids_.find(name); it != ids_.end()) {
+        return it->second;
+    }
+    return Unknown;
+}
+
+std::string_view BlockTypeIds::getName(int id) const
+{
+    if (id < 0 || static_cast<std::size_t>(id) >= names_.size()) {
+        return {};
+    }
+    return names_[id];
+}
+
+std::size_t BlockTypeIds::size() const
+{
+    return names_.size();
+}
+
+}  // namespace endstone::detail
@@ -14,6 +14,8 @@
 
 #include "endstone/detail/boss/boss_bar.h"
 
+#include <cmath>
+
 #include <entt/entt.hpp>
 
 #include "bedrock/network/minecraft_packets.h"
@@ -22,6 +24,13 @@
 
 namespace endstone::detail {
 
+EndstoneBossBar::~EndstoneBossBar()
+{
+    if (dirty_ != 0 && entt::locator<EndstoneServer>::has_value()) {
+        entt::locator<EndstoneServer>::value().removeDirtyBossBar(*this);
+    }
+}
+
 std::string EndstoneBossBar::getTitle() const
 {
     return title_;
@@ -31,7 +40,7 @@ void EndstoneBossBar::setTitle(std::string title)
 {
     if (title_ != title) {
         title_ = std::move(title);
-        broadcast(BossEventUpdateType::UpdateName);
+        markDirty(DirtyName);
     }
 }
 
@@ -44,7 +53,7 @@ void EndstoneBossBar::setColor(BarColor color)
 {
     if (color_ != color) {
         color_ = color;
-        broadcast(BossEventUpdateType::UpdateStyle);
+        markDirty(DirtyStyle);
     }
 }
 
@@ -57,7 +66,7 @@ void EndstoneBossBar::setStyle(BarStyle style)
 {
     if (style_ != style) {
         style_ = style;
-        broadcast(BossEventUpdateType::UpdateStyle);
+        markDirty(DirtyStyle);
     }
 }
 
@@ -70,7 +79,7 @@ void EndstoneBossBar::addFlag(BarFlag flag)
 {
     if (!hasFlag(flag)) {
         flags_.set(static_cast<int>(flag));
-        broadcast(BossEventUpdateType::UpdateProperties);
+        markDirty(DirtyProperties);
     }
 }
 
@@ -78,7 +87,7 @@ void EndstoneBossBar::removeFlag(BarFlag flag)
 {
     if (hasFlag(flag)) {
         flags_.reset(static_cast<int>(flag));
-        broadcast(BossEventUpdateType::UpdateProperties);
+        markDirty(DirtyProperties);
     }
 }
 
@@ -96,7 +105,7 @@ void EndstoneBossBar::setProgress(float progress)
     }
     if (progress_ != progress) {
         progress_ = progress;
-        broadcast(BossEventUpdateType::UpdatePercent);
+        markDirty(DirtyPercent);
     }
 }
 
@@ -109,6 +118,10 @@ void EndstoneBossBar::setVisible(bool visible)
 {
     if (visible_ != visible) {
         visible_ = visible;
+        // Add carries the current progress, so a pending small change has nothing left to catch up on
+        if (visible) {
+            sent_progress_ = progress_;
+        }
         for (const auto &player : getPlayers()) {
             send(visible ? BossEventUpdateType::Add : BossEventUpdateType::Remove, *player);
         }
@@ -170,6 +183,41 @@ void EndstoneBossBar::send(BossEventUpdateType event_type, Player &player)
     handle.sendNetworkPacket(*packet);
 }
 
+void EndstoneBossBar::flush()
+{
+    const auto dirty = dirty_;
+    dirty_ = 0;
+    if (!visible_) {
+        return;
+    }
+
+    if ((dirty & DirtyPercent) != 0) {
+        const auto at_end = progress_ == 0.0F || progress_ == 1.0F;
+        if (at_end || std::abs(progress_ - sent_progress_) >= ProgressThreshold) {
+            sent_progress_ = progress_;
+            broadcast(BossEventUpdateType::UpdatePercent);
+        }
+    }
+    if ((dirty & DirtyName) != 0) {
+        broadcast(BossEventUpdateType::UpdateName);
+    }
+    // Properties also carry the color and overlay, so a style update would be redundant next to them
+    if ((dirty & DirtyProperties) != 0) {
+        broadcast(BossEventUpdateType::UpdateProperties);
+    }
+    else if ((dirty & DirtyStyle) != 0) {
+        broadcast(BossEventUpdateType::UpdateStyle);
+    }
+}
+
+void EndstoneBossBar::markDirty(std::uint8_t fields)
+{
+    if (dirty_ == 0) {
+        entt::locator<EndstoneServer>::value().addDirtyBossBar(*this);
+    }
+    dirty_ |= fields;
+}
+
 void EndstoneBossBar::broadcast(BossEventUpdateType event_type)
 {
     if (!visible_) {
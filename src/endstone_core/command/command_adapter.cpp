@@ -83,7 +83,7 @@ void CommandAdapter::execute(const CommandOrigin &origin, CommandOutput &output)
     auto &server = entt::locator<EndstoneServer>::value();
     auto &command_map = server.getCommandMap();
     auto command_name = getCommandName();
-    auto *command = command_map.getCommand(command_name);
+    auto *command = command_map.findCommand(command_name);
 
     if (!command) {
         server.getLogger().error("An unregistered command '{}' was executed by {}.", command_name, origin.getName());
@@ -15,8 +15,11 @@
 #include "endstone/detail/command/command_map.h"
 
 #include <algorithm>
+#include <atomic>
+#include <functional>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "bedrock/locale/i18n.h"
@@ -25,9 +28,16 @@
 #include "endstone/detail/command/bedrock_command.h"
 #include "endstone/detail/command/command_adapter.h"
 #include "endstone/detail/command/command_usage_parser.h"
+#include "endstone/detail/command/defaults/backup_command.h"
+#include "endstone/detail/command/defaults/dump_data_command.h"
+#include "endstone/detail/command/defaults/entities_command.h"
+#include "endstone/detail/command/defaults/netstats_command.h"
 #include "endstone/detail/command/defaults/plugins_command.h"
+#include "endstone/detail/command/defaults/pregen_command.h"
+#include "endstone/detail/command/defaults/profile_command.h"
 #include "endstone/detail/command/defaults/reload_command.h"
 #include "endstone/detail/command/defaults/status_command.h"
+#include "endstone/detail/command/defaults/timings_command.h"
 #include "endstone/detail/command/defaults/version_command.h"
 #include "endstone/detail/devtools/devtools_command.h"
 #include "endstone/detail/permissions/default_permissions.h"
@@ -35,29 +45,53 @@
 
 namespace endstone::detail {
 
+namespace {
+// Forwards the soft enum updates of the registry to the players and flags the commands packets as stale
+struct SoftEnumObserver {
+    std::function<void(const ::Packet &)> send;
+    std::atomic<bool> *changed;
+
+    void operator()(const ::Packet &packet) const
+    {
+        changed->store(true);
+        if (send) {
+            send(packet);
+        }
+    }
+};
+}  // namespace
+
 EndstoneCommandMap::EndstoneCommandMap(EndstoneServer &server) : server_(server)
 {
-    saveCommandRegistryState();
     setMinecraftCommands();
     setDefaultCommands();
+    // The built-in commands never change, so they are kept across reloads along with their registry entries
+    saveCommandRegistryState();
+    builtin_commands_ = known_commands_;
+    observeSoftEnums();
 }
 
 void EndstoneCommandMap::clearCommands()
 {
     std::lock_guard lock(mutex_);
     for (const auto &[name, command] : known_commands_) {
-        command->unregisterFrom(*this);
+        if (auto it = builtin_commands_.find(name); it == builtin_commands_.end() || it->second != command) {
+            command->unregisterFrom(*this);
+        }
     }
-    known_commands_.clear();
+    known_commands_ = builtin_commands_;
+    available_commands_.clear();
     restoreCommandRegistryState();
-    setMinecraftCommands();
-    setDefaultCommands();
+    setMinecraftPermissions();
 }
 
 Command *EndstoneCommandMap::getCommand(std::string name) const
 {
-    std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
+    return findCommand(name);
+}
 
+Command *EndstoneCommandMap::findCommand(std::string_view name) const
+{
     auto it = known_commands_.find(name);
     if (it == known_commands_.end()) {
         return nullptr;
@@ -66,11 +100,79 @@ Command *EndstoneCommandMap::getCommand(std::string name) const
     return it->second.get();
 }
 
+AvailableCommandsPacket &EndstoneCommandMap::getAvailableCommands(const CommandSender &sender,
+                                                                  CommandPermissionLevel level)
+{
+    std::lock_guard lock(mutex_);
+
+    // Senders with the same level and the same permitted commands are sent the same packet
+    std::vector<bool> permitted;
+    permitted.reserve(known_commands_.size());
+    for (const auto &[name, command] : known_commands_) {
+        permitted.push_back(command->isRegistered() && command->testPermissionSilently(sender));
+    }
+
+    auto &packet = available_commands_[{level, std::move(permitted)}];
+    if (packet) {
+        return *packet;
+    }
+
+    // Initialized directly from the returned value: copying the packet is not safe, as its overload data is opaque
+    auto &registry = server_.getMinecraftCommands().getRegistry();
+    packet.reset(new AvailableCommandsPacket(registry.serializeAvailableCommands()));
+    for (auto it = packet->commands.begin(); it != packet->commands.end();) {
+        auto *command = findCommand(it->name);
+        if (command && command->isRegistered() && command->testPermissionSilently(sender) &&
+            it->permission_level <= level) {
+            ++it;
+            continue;
+        }
+        it = packet->commands.erase(it);
+    }
+    return *packet;
+}
+
+void EndstoneCommandMap::invalidateAvailableCommands()
+{
+    std::lock_guard lock(mutex_);
+    available_commands_.clear();
+}
+
+void EndstoneCommandMap::refreshAvailableCommands()
+{
+    auto &registry = server_.getMinecraftCommands().getRegistry();
+    if (!registry.network_update_callback.target<SoftEnumObserver>()) {
+        // The callback was replaced, changes made since then may have been missed
+        observeSoftEnums();
+        soft_enums_changed_ = true;
+    }
+    if (soft_enums_changed_.exchange(false)) {
+        invalidateAvailableCommands();
+    }
+}
+
+CommandTimings &EndstoneCommandMap::getTimings()
+{
+    return timings_;
+}
+
+CommandRateLimiter &EndstoneCommandMap::getRateLimiter()
+{
+    return rate_limiter_;
+}
+
 void EndstoneCommandMap::setDefaultCommands()
 {
+    registerCommand(std::make_unique<BackupCommand>());
+    registerCommand(std::make_unique<DumpDataCommand>());
+    registerCommand(std::make_unique<EntitiesCommand>());
+    registerCommand(std::make_unique<NetStatsCommand>());
     registerCommand(std::make_unique<PluginsCommand>());
+    registerCommand(std::make_unique<PregenCommand>());
+    registerCommand(std::make_unique<ProfileCommand>());
     registerCommand(std::make_unique<ReloadCommand>());
     registerCommand(std::make_unique<StatusCommand>());
+    registerCommand(std::make_unique<TimingsCommand>());
     registerCommand(std::make_unique<VersionCommand>());
 #ifdef ENDSTONE_DEVTOOLS
     registerCommand(std::make_unique<DevToolsCommand>());
@@ -90,11 +192,6 @@ void EndstoneCommandMap::setMinecraftCommands()
         it->second.push_back(alias);
     }
 
-    auto *root = DefaultPermissions::registerPermission(
-        "minecraft", nullptr, "Gives the user the ability to use all vanilla utilities and commands");
-    auto *parent = DefaultPermissions::registerPermission(
-        root->getName() + ".command", root, "Gives the user the ability to use all vanilla minecraft commands");
-
     for (const auto &[command_name, signature] : registry.signatures) {
         auto description = getI18n().get(signature.description, {}, nullptr);
 
@@ -118,11 +215,25 @@ void EndstoneCommandMap::setMinecraftCommands()
             known_commands_.emplace(alias, command);
         }
 
+        minecraft_permissions_.emplace_back(command_name, signature.permission_level > CommandPermissionLevel::Any
+                                                              ? PermissionDefault::Operator
+                                                              : PermissionDefault::True);
+    }
+
+    setMinecraftPermissions();
+}
+
+void EndstoneCommandMap::setMinecraftPermissions()
+{
+    auto *root = DefaultPermissions::registerPermission(
+        "minecraft", nullptr, "Gives the user the ability to use all vanilla utilities and commands");
+    auto *parent = DefaultPermissions::registerPermission(
+        root->getName() + ".command", root, "Gives the user the ability to use all vanilla minecraft commands");
+
+    for (const auto &[command_name, permission_default] : minecraft_permissions_) {
         DefaultPermissions::registerPermission(parent->getName() + "." + command_name, parent,
                                                "Gives the user the ability to use the /" + command_name + " command",
-                                               signature.permission_level > CommandPermissionLevel::Any
-                                                   ? PermissionDefault::Operator
-                                                   : PermissionDefault::True);
+                                               permission_default);
     }
 
     parent->recalculatePermissibles();
@@ -133,14 +244,54 @@ void EndstoneCommandMap::setPluginCommands()
 {
     auto plugins = server_.getPluginManager().getPlugins();
     for (auto *plugin : plugins) {
-        auto name = plugin->getName();
-        std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
-        server_.getMinecraftCommands().getRegistry().addEnumValues("PluginName", {name});
+        addPluginCommands(*plugin);
+    }
+}
+
+void EndstoneCommandMap::addPluginCommands(Plugin &plugin)
+{
+    auto name = plugin.getName();
+    std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
+    server_.getMinecraftCommands().getRegistry().addEnumValues("PluginName", {name});
+
+    auto commands = plugin.getDescription().getCommands();
+    for (const auto &command : commands) {
+        registerCommand(std::make_unique<PluginCommand>(command, plugin));
+    }
+}
+
+void EndstoneCommandMap::removePluginCommands(Plugin &plugin)
+{
+    std::lock_guard lock(mutex_);
+
+    // Entries cannot be taken out of the command registry, so it is reset and the other commands are registered again
+    std::vector<std::shared_ptr<Command>> commands;
+    for (const auto &[name, command] : known_commands_) {
+        if (name != command->getName()) {
+            continue;  // aliases are registered again along with their command
+        }
+        if (auto it = builtin_commands_.find(name); it != builtin_commands_.end() && it->second == command) {
+            continue;
+        }
+        if (auto *plugin_command = command->asPluginCommand();
+            plugin_command && &plugin_command->getPlugin() == &plugin) {
+            continue;
+        }
+        commands.push_back(command);
+    }
 
-        auto commands = plugin->getDescription().getCommands();
-        for (const auto &command : commands) {
-            registerCommand(std::make_unique<PluginCommand>(command, *plugin));
+    clearCommands();
+    auto &registry = server_.getMinecraftCommands().getRegistry();
+    for (auto *other : server_.getPluginManager().getPlugins()) {
+        if (other == &plugin) {
+            continue;
         }
+        auto name = other->getName();
+        std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
+        registry.addEnumValues("PluginName", {name});
+    }
+    for (const auto &command : commands) {
+        registerCommand(command);
     }
 }
 
@@ -177,6 +328,7 @@ bool EndstoneCommandMap::registerCommand(std::shared_ptr<Command> command)
         return false;  // the name was registered and is not an alias, we don't replace it
     }
 
+    available_commands_.clear();
     auto &registry = server_.getMinecraftCommands().getRegistry();
     registry.registerCommand(name, command->getDescription().c_str(), CommandPermissionLevel::Any,
                              CommandFlag::NotCheat, CommandFlag::None);
@@ -192,11 +344,8 @@ bool EndstoneCommandMap::registerCommand(std::shared_ptr<Command> command)
     }
 
     for (const auto &usage : command->getUsages()) {
-        auto parser = CommandUsageParser(usage);
-        std::string command_name;
-        std::vector<CommandUsageParser::Parameter> parameters;
-        std::string error_message;
-        if (parser.parse(command_name, parameters, error_message)) {
+        const auto &[success, command_name, parameters, error_message] = CommandUsageParser::parseCached(usage);
+        if (success) {
             if (command_name != name) {
                 server_.getLogger().warning("Unexpected command name '{}' in usage '{}', do you mean '{}'?",
                                             command_name, usage, name);
@@ -286,6 +435,18 @@ void EndstoneCommandMap::saveCommandRegistryState() const
     gCommandRegistryState.aliases = registry.aliases;
 }
 
+void EndstoneCommandMap::observeSoftEnums()
+{
+    // The registry only sends UpdateSoftEnumPackets through this callback
+    auto &registry = server_.getMinecraftCommands().getRegistry();
+    if (auto *observer = registry.network_update_callback.target<SoftEnumObserver>()) {
+        observer->changed = &soft_enums_changed_;
+        return;
+    }
+    registry.network_update_callback =
+        SoftEnumObserver{std::move(registry.network_update_callback), &soft_enums_changed_};
+}
+
 void EndstoneCommandMap::restoreCommandRegistryState() const
 {
     auto &registry = server_.getMinecraftCommands().getRegistry();
@@ -0,0 +1,51 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/command/command_output_capture.h"
+
+namespace endstone::detail {
+
+namespace {
+thread_local CommandOutputCapture *current_capture = nullptr;
+}  // namespace
+
+CommandOutputCapture::CommandOutputCapture() : previous_(current_capture)
+{
+    current_capture = this;
+}
+
+CommandOutputCapture::~CommandOutputCapture()
+{
+    current_capture = previous_;
+}
+
+CommandOutputCapture *CommandOutputCapture::current()
+{
+    return current_capture;
+}
+
+void CommandOutputCapture::append(const std::string &line)
+{
+    if (!output_.empty()) {
+        output_.push_back('\n');
+    }
+    output_ += line;
+}
+
+const std::string &CommandOutputCapture::getOutput() const
+{
+    return output_;
+}
+
+}  // namespace endstone::detail
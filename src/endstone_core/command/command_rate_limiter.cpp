@@ -0,0 +1,108 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/command/command_rate_limiter.h"
+
+#include <initializer_list>
+#include <utility>
+
+namespace endstone::detail {
+
+std::size_t CommandRateLimiter::OriginHash::operator()(const Origin &origin) const
+{
+    std::size_t hash = std::hash<std::uintptr_t>{}(origin.object);
+    for (auto value : {static_cast<int>(origin.type), origin.x, origin.y, origin.z}) {
+        hash ^= std::hash<int>{}(value) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    }
+    return hash;
+}
+
+void CommandRateLimiter::setBudget(const Budget &budget)
+{
+    budget_ = budget;
+}
+
+const CommandRateLimiter::Budget &CommandRateLimiter::getBudget() const
+{
+    return budget_;
+}
+
+bool CommandRateLimiter::tryAcquire(const Origin &origin)
+{
+    if (tick_count_ >= budget_.per_tick) {
+        return false;
+    }
+    auto &count = counts_[origin];
+    if (count >= budget_.per_origin) {
+        return false;
+    }
+    ++count;
+    ++tick_count_;
+    return true;
+}
+
+bool CommandRateLimiter::reject(const Origin &origin, const std::function<std::string()> &describe,
+                                std::function<void()> retry)
+{
+    auto [it, inserted] = violations_.try_emplace(origin);
+    auto &violation = it->second;
+    if (inserted) {
+        violation.origin = describe();
+    }
+
+    if (budget_.overflow == Overflow::Defer && deferred_.size() < budget_.max_deferred) {
+        deferred_.push_back(std::move(retry));
+        ++violation.deferred;
+        ++deferred_count_;
+        return true;
+    }
+    ++violation.dropped;
+    ++dropped_count_;
+    return false;
+}
+
+void CommandRateLimiter::startTick()
+{
+    counts_.clear();
+    tick_count_ = 0;
+
+    // Commands deferred again while these run wait for the next tick
+    auto deferred = std::exchange(deferred_, {});
+    for (auto &retry : deferred) {
+        retry();
+    }
+}
+
+std::vector<CommandRateLimiter::Violation> CommandRateLimiter::takeViolations()
+{
+    std::vector<Violation> violations;
+    violations.reserve(violations_.size());
+    for (auto &[origin, violation] : violations_) {
+        violations.push_back(std::move(violation));
+    }
+    violations_.clear();
+    return violations;
+}
+
+std::uint64_t CommandRateLimiter::getDeferredCount() const
+{
+    return deferred_count_;
+}
+
+std::uint64_t CommandRateLimiter::getDroppedCount() const
+{
+    return dropped_count_;
+}
+
+}  // namespace endstone::detail
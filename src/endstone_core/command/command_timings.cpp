@@ -0,0 +1,102 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/command/command_timings.h"
+
+#include <algorithm>
+#include <mutex>
+
+#include "endstone/command/plugin_command.h"
+#include "endstone/detail/command/endstone_command.h"
+
+namespace endstone::detail {
+
+void CommandTimings::setEnabled(bool enabled)
+{
+    enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+void CommandTimings::record(Command &command, std::chrono::nanoseconds elapsed)
+{
+    auto &entry = getEntry(command);
+    auto value = static_cast<std::uint64_t>(std::max<std::int64_t>(elapsed.count(), 0));
+    entry.count.fetch_add(1, std::memory_order_relaxed);
+    entry.total.fetch_add(value, std::memory_order_relaxed);
+    auto max = entry.max.load(std::memory_order_relaxed);
+    while (value > max && !entry.max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {}
+    entry.histogram.record(value);
+}
+
+std::vector<CommandTiming> CommandTimings::getTimings() const
+{
+    std::shared_lock lock(mutex_);
+    std::vector<CommandTiming> timings;
+    timings.reserve(entries_.size());
+    for (const auto &[name, entry] : entries_) {
+        auto count = entry->count.load(std::memory_order_relaxed);
+        if (count == 0) {
+            continue;
+        }
+        auto max = entry->max.load(std::memory_order_relaxed);
+        timings.push_back({
+            entry->name,
+            entry->owner,
+            entry->vanilla,
+            count,
+            std::chrono::nanoseconds(entry->total.load(std::memory_order_relaxed)),
+            std::chrono::nanoseconds(max),
+            std::chrono::nanoseconds(std::min(entry->histogram.getPercentile(0.99, count), max)),
+        });
+    }
+    return timings;
+}
+
+void CommandTimings::reset()
+{
+    std::unique_lock lock(mutex_);
+    entries_.clear();
+}
+
+CommandTimings::Entry &CommandTimings::getEntry(Command &command)
+{
+    auto name = command.getName();
+    {
+        std::shared_lock lock(mutex_);
+        if (auto it = entries_.find(name); it != entries_.end()) {
+            return *it->second;
+        }
+    }
+
+    std::unique_lock lock(mutex_);
+    auto &entry = entries_[name];
+    if (!entry) {
+        entry = std::make_unique<Entry>();
+        entry->name = name;
+        if (auto *plugin_command = command.asPluginCommand(); plugin_command) {
+            entry->owner = plugin_command->getPlugin().getName();
+            entry->vanilla = false;
+        }
+        else if (dynamic_cast<EndstoneCommand *>(&command)) {
+            entry->owner = "endstone";
+            entry->vanilla = false;
+        }
+        else {
+            entry->owner = "minecraft";
+            entry->vanilla = true;
+        }
+    }
+    return *entry;
+}
+
+}  // namespace endstone::detail
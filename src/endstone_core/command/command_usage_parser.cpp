@@ -14,6 +14,8 @@
 
 #include "endstone/detail/command/command_usage_parser.h"
 
+#include <mutex>
+#include <unordered_map>
 #include <utility>
 
 #include <fmt/format.h>
@@ -51,6 +53,20 @@ bool CommandUsageParser::parse(std::string &command_name, std::vector<Parameter>
     }
 }
 
+const CommandUsageParser::Result &CommandUsageParser::parseCached(std::string_view usage)
+{
+    static std::mutex mutex;
+    static std::unordered_map<std::string, Result> cache;
+
+    std::lock_guard lock(mutex);
+    auto [it, inserted] = cache.try_emplace(std::string(usage));
+    if (inserted) {
+        auto &result = it->second;
+        result.success = CommandUsageParser(usage).parse(result.command_name, result.parameters, result.error_message);
+    }
+    return it->second;
+}
+
 std::string_view CommandUsageParser::parseToken(CommandLexer::TokenType type, std::string what)
 {
     auto token = lexer_.next();
@@ -14,7 +14,7 @@
 
 #include "endstone/detail/command/console_command_sender.h"
 
-#include "bedrock/locale/i18n.h"
+#include "endstone/detail/command/command_output_capture.h"
 #include "endstone/detail/server.h"
 
 namespace endstone::detail {
@@ -26,22 +26,30 @@ ConsoleCommandSender *EndstoneConsoleCommandSender::asConsole() const
 
 void EndstoneConsoleCommandSender::sendMessage(const std::string &message) const
 {
+    if (auto *capture = CommandOutputCapture::current()) {
+        capture->append(message);
+        return;
+    }
     getServer().getLogger().info(message);
 }
 
 void EndstoneConsoleCommandSender::sendMessage(const Translatable &message) const
 {
-    getServer().getLogger().info(getI18n().get(message.getTranslationKey(), message.getParameters(), nullptr));
+    sendMessage(getServer().translate(message, ""));
 }
 
 void EndstoneConsoleCommandSender::sendErrorMessage(const std::string &message) const
 {
+    if (auto *capture = CommandOutputCapture::current()) {
+        capture->append(message);
+        return;
+    }
     getServer().getLogger().error(message);
 }
 
 void EndstoneConsoleCommandSender::sendErrorMessage(const Translatable &message) const
 {
-    getServer().getLogger().error(getI18n().get(message.getTranslationKey(), message.getParameters(), nullptr));
+    sendErrorMessage(getServer().translate(message, ""));
 }
 
 Server &EndstoneConsoleCommandSender::getServer() const
@@ -104,6 +112,11 @@ void EndstoneConsoleCommandSender::recalculatePermissions()
     ServerCommandSender::recalculatePermissions();
 }
 
+void EndstoneConsoleCommandSender::recalculatePermission(PermissionAttachment &attachment, const std::string &name, bool value)
+{
+    ServerCommandSender::recalculatePermission(attachment, name, value);
+}
+
 std::unordered_set<PermissionAttachmentInfo *> EndstoneConsoleCommandSender::getEffectivePermissions() const
 {
     return ServerCommandSender::getEffectivePermissions();
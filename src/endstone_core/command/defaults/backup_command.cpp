@@ -0,0 +1,86 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/command/defaults/backup_command.h"
+
+#include <optional>
+#include <string>
+
+#include <entt/entt.hpp>
+#include <fmt/format.h>
+
+#include "endstone/color_format.h"
+#include "endstone/detail/level/level.h"
+#include "endstone/detail/server.h"
+
+namespace endstone::detail {
+
+BackupCommand::BackupCommand() : EndstoneCommand("backup")
+{
+    setDescription("Copies the level to a directory while the server keeps running.");
+    setUsages("/backup <destination: message>");
+    setPermissions("endstone.command.backup");
+}
+
+bool BackupCommand::execute(CommandSender &sender, const std::vector<std::string> &args) const
+{
+    if (!testPermission(sender)) {
+        return true;
+    }
+
+    auto &server = entt::locator<EndstoneServer>::value();
+    auto *level = static_cast<EndstoneLevel *>(server.getLevel());
+    if (!level) {
+        sender.sendErrorMessage("The level has not been loaded yet.");
+        return false;
+    }
+    if (args.empty() || args[0].empty()) {
+        sender.sendErrorMessage("The destination directory must be given.");
+        return false;
+    }
+
+    // The sender may be gone by the time the copy is finished, players are looked up again
+    std::optional<UUID> player_id;
+    if (auto *player = sender.asPlayer()) {
+        player_id = player->getUniqueId();
+    }
+    const auto &destination = args[0];
+    auto started = level->backup(destination, [&server, player_id, destination](const auto &result) {
+        auto *player = player_id ? server.getPlayer(*player_id) : nullptr;
+        if (!result.error.empty()) {
+            server.getLogger().error("Unable to back up the level to {}: {}", destination, result.error);
+            if (player) {
+                player->sendErrorMessage("Unable to back up the level to {}: {}", destination, result.error);
+            }
+            return;
+        }
+        auto message = fmt::format("Finished the backup of the level to {} in {:.2f}s, {} files copied ({:.1f} MiB), "
+                                   "{} unchanged files linked.",
+                                   destination, static_cast<double>(result.duration.count()) / 1000.0,
+                                   result.files.copied, static_cast<double>(result.files.bytes_copied) / 1048576.0,
+                                   result.files.linked);
+        server.getLogger().info(message);
+        if (player) {
+            player->sendMessage(ColorFormat::Green + message);
+        }
+    });
+    if (!started) {
+        sender.sendErrorMessage("A backup of the level is already running.");
+        return false;
+    }
+    sender.sendMessage("{}Started the backup of the level to {}.", ColorFormat::Green, destination);
+    return true;
+}
+
+}  // namespace endstone::detail
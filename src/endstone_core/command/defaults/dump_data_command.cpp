@@ -0,0 +1,128 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/command/defaults/dump_data_command.h"
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <optional>
+#include <string>
+
+#include <entt/entt.hpp>
+#include <fmt/format.h>
+
+#include "endstone/color_format.h"
+#include "endstone/detail/devtools/vanilla_data.h"
+#include "endstone/detail/level/level.h"
+#include "endstone/detail/scheduler/scheduler.h"
+#include "endstone/detail/server.h"
+
+namespace endstone::detail {
+
+namespace {
+std::atomic<bool> gRunning = false;
+}  // namespace
+
+DumpDataCommand::DumpDataCommand() : EndstoneCommand("dumpdata")
+{
+    setDescription("Writes the block, item, recipe and creative data of the server to compressed files.");
+    setUsages("/dumpdata (json|msgpack)<format: DumpDataFormat> <destination: message>");
+    setPermissions("endstone.command.dumpdata");
+}
+
+bool DumpDataCommand::execute(CommandSender &sender, const std::vector<std::string> &args) const
+{
+    if (!testPermission(sender)) {
+        return true;
+    }
+
+    auto &server = entt::locator<EndstoneServer>::value();
+    auto *level = static_cast<EndstoneLevel *>(server.getLevel());
+    if (!level) {
+        sender.sendErrorMessage("The level has not been loaded yet.");
+        return false;
+    }
+    if (args.size() < 2 || args[1].empty()) {
+        sender.sendErrorMessage("The format and the destination directory must be given.");
+        return false;
+    }
+    using Format = devtools::VanillaData::Format;
+    Format format;
+    if (args[0] == "json") {
+        format = Format::Json;
+    }
+    else if (args[0] == "msgpack") {
+        format = Format::MessagePack;
+    }
+    else {
+        sender.sendErrorMessage("Unknown format: {}", args[0]);
+        return false;
+    }
+    if (gRunning.exchange(true)) {
+        sender.sendErrorMessage("The data is already being written.");
+        return false;
+    }
+
+    // Only the copy is made on the server thread, building and writing the files is left to an I/O worker
+    const auto start = std::chrono::steady_clock::now();
+    std::function<devtools::VanillaData()> build;
+    try {
+        build = devtools::VanillaData::collect(level->getHandle());
+    }
+    catch (std::exception &e) {
+        gRunning = false;
+        sender.sendErrorMessage("Unable to collect the data: {}", e.what());
+        return false;
+    }
+
+    // The sender may be gone by the time the files are written, players are looked up again
+    std::optional<UUID> player_id;
+    if (auto *player = sender.asPlayer()) {
+        player_id = player->getUniqueId();
+    }
+    const auto &destination = args[1];
+    auto &scheduler = static_cast<EndstoneScheduler &>(server.getScheduler());
+    auto &executor = scheduler.getExecutor(AsyncExecutor::Io);
+    executor.execute([&server, &scheduler, start, format, player_id, destination, build]() {
+        std::string error;
+        try {
+            build().dump(destination, format);
+        }
+        catch (std::exception &e) {
+            error = e.what();
+        }
+        scheduler.runTask([&server, start, player_id, destination, error]() {
+            gRunning = false;
+            auto *player = player_id ? server.getPlayer(*player_id) : nullptr;
+            if (!error.empty()) {
+                server.getLogger().error("Unable to write the data to {}: {}", destination, error);
+                if (player) {
+                    player->sendErrorMessage("Unable to write the data to {}: {}", destination, error);
+                }
+                return;
+            }
+            auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            auto message = fmt::format("Wrote the data to {} in {:.2f}s.", destination, seconds);
+            server.getLogger().info(message);
+            if (player) {
+                player->sendMessage(ColorFormat::Green + message);
+            }
+        });
+    });
+    sender.sendMessage("{}Writing the data to {}.", ColorFormat::Green, destination);
+    return true;
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,84 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/command/defaults/entities_command.h"
+
+#include <algorithm>
+#include <string>
+
+#include <entt/entt.hpp>
+#include <fmt/format.h>
+
+#include "endstone/color_format.h"
+#include "endstone/detail/server.h"
+
+namespace endstone::detail {
+
+EntitiesCommand::EntitiesCommand() : EndstoneCommand("entities")
+{
+    setDescription("Shows the number of actors of each type and the busiest chunks.");
+    setUsages("/entities");
+    setPermissions("endstone.command.entities");
+}
+
+bool EntitiesCommand::execute(CommandSender &sender, const std::vector<std::string> &args) const
+{
+    if (!testPermission(sender)) {
+        return true;
+    }
+
+    auto &server = entt::locator<EndstoneServer>::value();
+    auto *level = server.getLevel();
+    if (!level) {
+        sender.sendErrorMessage("The level has not been loaded yet.");
+        return false;
+    }
+
+    for (auto *dimension : level->getDimensions()) {
+        sendSummary(sender, static_cast<EndstoneDimension &>(*dimension));
+    }
+    return true;
+}
+
+void EntitiesCommand::sendSummary(CommandSender &sender, const EndstoneDimension &dimension) const
+{
+    auto counts = dimension.getActorCounts();
+    auto total = 0;
+    for (const auto &[type, count] : counts) {
+        total += count;
+    }
+    sender.sendMessage("{}Actors in {}: {}{}", ColorFormat::Gold, dimension.getName(), ColorFormat::Red, total);
+    if (counts.empty()) {
+        return;
+    }
+
+    std::stable_sort(counts.begin(), counts.end(), [](const auto &lhs, const auto &rhs) {
+        return lhs.second > rhs.second;
+    });
+    counts.resize(std::min(counts.size(), MaxTypes));
+    for (const auto &[type, count] : counts) {
+        sender.sendMessage("{}- {}: {}{}", ColorFormat::Gold, type, ColorFormat::Red, count);
+    }
+
+    std::string chunks;
+    for (const auto &[pos, count] : dimension.getBusiestChunks(MaxChunks)) {
+        if (!chunks.empty()) {
+            chunks += ", ";
+        }
+        chunks += fmt::format("({}, {}): {}", pos.first, pos.second, count);
+    }
+    sender.sendMessage("{}Busiest chunks: {}{}", ColorFormat::Gold, ColorFormat::Red, chunks);
+}
+
+}  // namespace endstone::detail
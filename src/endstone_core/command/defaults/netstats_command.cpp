@@ -0,0 +1,119 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/command/defaults/netstats_command.h"
+
+#include <algorithm>
+
+#include <entt/entt.hpp>
+#include <magic_enum/magic_enum.hpp>
+
+#include "bedrock/network/minecraft_packet_ids.h"
+#include "endstone/color_format.h"
+#include "endstone/detail/network/packet_statistics.h"
+#include "endstone/detail/server.h"
+
+template <>
+struct magic_enum::customize::enum_range<MinecraftPacketIds> {
+    static constexpr int min = 0;
+    static constexpr int max = static_cast<int>(endstone::detail::PacketStatistics::MaxPacketId);
+};
+
+namespace endstone::detail {
+
+namespace {
+constexpr std::size_t MaxReportEntries = 10;
+
+double toKilobytes(std::uint64_t bytes)
+{
+    return static_cast<double>(bytes) / 1024.0;
+}
+
+void sendPlayerStats(CommandSender &sender, const Player &player)
+{
+    auto stats = player.getNetworkStats();
+    auto color = ColorFormat::Green;
+    if (stats.packet_loss > 0.05F) {
+        color = ColorFormat::Red;
+    }
+    else if (stats.packet_loss > 0.01F) {
+        color = ColorFormat::Gold;
+    }
+
+    sender.sendMessage("{}{}: {}{}ms{}, out {}{:.1f} KiB/s{}, in {}{:.1f} KiB/s{}, loss {}{:.1f}%{}, queued {}{}{}, "
+                       "unacked {}{}",
+                       ColorFormat::Gold, player.getName(), ColorFormat::Red, player.getPing().count(),
+                       ColorFormat::Gold, ColorFormat::Red, toKilobytes(stats.bytes_sent_per_second),
+                       ColorFormat::Gold, ColorFormat::Red, toKilobytes(stats.bytes_received_per_second),
+                       ColorFormat::Gold, color, stats.packet_loss * 100, ColorFormat::Gold, ColorFormat::Red,
+                       stats.send_queue_size, ColorFormat::Gold, ColorFormat::Red, stats.resend_queue_size);
+}
+}  // namespace
+
+NetStatsCommand::NetStatsCommand() : EndstoneCommand("netstats")
+{
+    setDescription("Reports the network statistics of players and the packets received by the server.");
+    setUsages("/netstats", "/netstats [player: str]");
+    setPermissions("endstone.command.netstats");
+}
+
+bool NetStatsCommand::execute(CommandSender &sender, const std::vector<std::string> &args) const
+{
+    if (!testPermission(sender)) {
+        return true;
+    }
+
+    auto &server = entt::locator<EndstoneServer>::value();
+    if (!args.empty()) {
+        auto *player = server.getPlayer(args[0]);
+        if (player == nullptr) {
+            sender.sendErrorMessage("Player {} is not online.", args[0]);
+            return false;
+        }
+
+        auto stats = player->getNetworkStats();
+        sender.sendMessage("{}---- {}Network statistics of {}{} ----", ColorFormat::Green, ColorFormat::Reset,
+                           player->getName(), ColorFormat::Green);
+        sendPlayerStats(sender, *player);
+        sender.sendMessage("{}Total: {}{:.1f} KiB{} sent, {}{:.1f} KiB{} received, {}{:.1f} KiB{} resent, {}{:.1f}%{} "
+                           "lost",
+                           ColorFormat::Gold, ColorFormat::Red, toKilobytes(stats.bytes_sent), ColorFormat::Gold,
+                           ColorFormat::Red, toKilobytes(stats.bytes_received), ColorFormat::Gold, ColorFormat::Red,
+                           toKilobytes(stats.bytes_resent), ColorFormat::Gold, ColorFormat::Red,
+                           stats.packet_loss_total * 100, ColorFormat::Gold);
+        return true;
+    }
+
+    sender.sendMessage("{}---- {}Network statistics{} ----", ColorFormat::Green, ColorFormat::Reset,
+                       ColorFormat::Green);
+    for (const auto *player : server.getOnlinePlayers()) {
+        sendPlayerStats(sender, *player);
+    }
+
+    auto received = PacketStatistics::getInstance().getReceived();
+    if (received.empty()) {
+        return true;
+    }
+    sender.sendMessage("{}Packets received, by size:", ColorFormat::Gold);
+    for (std::size_t i = 0; i < std::min(received.size(), MaxReportEntries); ++i) {
+        const auto &entry = received[i];
+        auto name = magic_enum::enum_name(static_cast<MinecraftPacketIds>(entry.packet_id));
+        sender.sendMessage("  {}{} ({}){}: {}{}{} packets, {}{:.1f} KiB", ColorFormat::Gold,
+                           name.empty() ? "Unknown" : name, entry.packet_id, ColorFormat::Reset, ColorFormat::Red,
+                           entry.count, ColorFormat::Reset, ColorFormat::Red, toKilobytes(entry.bytes));
+    }
+    return true;
+}
+
+}  // namespace endstone::detail
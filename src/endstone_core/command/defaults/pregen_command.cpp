@@ -0,0 +1,174 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/command/defaults/pregen_command.h"
+
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <optional>
+#include <string>
+
+#include <entt/entt.hpp>
+#include <fmt/format.h>
+
+#include "endstone/color_format.h"
+#include "endstone/detail/server.h"
+
+namespace endstone::detail {
+
+namespace {
+std::optional<int> parseInt(const std::string &arg)
+{
+    int value;
+    auto [end, ec] = std::from_chars(arg.data(), arg.data() + arg.size(), value);
+    if (ec != std::errc() || end != arg.data() + arg.size()) {
+        return std::nullopt;
+    }
+    return value;
+}
+
+std::optional<float> parseFloat(const std::string &arg)
+{
+    char *end = nullptr;
+    auto value = std::strtof(arg.c_str(), &end);
+    if (arg.empty() || end != arg.c_str() + arg.size()) {
+        return std::nullopt;
+    }
+    return value;
+}
+}  // namespace
+
+PregenCommand::PregenCommand() : EndstoneCommand("pregen")
+{
+    setDescription("Generates the chunks around a center chunk ahead of time.");
+    setUsages("/pregen (start)<action: PregenStartAction> <radius: int> [center_x: int] [center_z: int] "
+              "[target_usage: float]",
+              "/pregen (stop|status)<action: PregenAction>");
+    setPermissions("endstone.command.pregen");
+}
+
+bool PregenCommand::execute(CommandSender &sender, const std::vector<std::string> &args) const
+{
+    if (!testPermission(sender)) {
+        return true;
+    }
+
+    auto &server = entt::locator<EndstoneServer>::value();
+    auto *level = server.getLevel();
+    if (!level) {
+        sender.sendErrorMessage("The level has not been loaded yet.");
+        return false;
+    }
+
+    // Players work on the dimension they are in, the console on the overworld
+    Dimension *dimension = nullptr;
+    if (auto *player = sender.asPlayer()) {
+        dimension = &player->getDimension();
+    }
+    else {
+        dimension = level->getDimension("overworld");
+    }
+    if (!dimension) {
+        sender.sendErrorMessage("Unable to find the dimension to pre-generate.");
+        return false;
+    }
+
+    if (args.empty() || args[0] == "status") {
+        sendProgress(sender, *dimension);
+        return true;
+    }
+
+    const auto &action = args[0];
+    if (action == "start") {
+        return start(sender, *dimension, args);
+    }
+    if (action == "stop") {
+        if (!dimension->stopPregeneration()) {
+            sender.sendErrorMessage("No pre-generation is running in {}.", dimension->getName());
+            return false;
+        }
+        sender.sendMessage(ColorFormat::Green + "Stopped the pre-generation of " + dimension->getName() + ".");
+        return true;
+    }
+
+    sender.sendErrorMessage("Unknown action: {}", action);
+    return false;
+}
+
+bool PregenCommand::start(CommandSender &sender, Dimension &dimension, const std::vector<std::string> &args) const
+{
+    auto radius = args.size() > 1 ? parseInt(args[1]) : std::nullopt;
+    if (!radius || *radius < 0) {
+        sender.sendErrorMessage("The radius must be a non-negative number of chunks.");
+        return false;
+    }
+
+    // Defaults to the chunk the player is standing in
+    auto center_x = 0;
+    auto center_z = 0;
+    if (auto *player = sender.asPlayer()) {
+        auto location = player->getLocation();
+        center_x = static_cast<int>(std::floor(location.getX())) >> 4;
+        center_z = static_cast<int>(std::floor(location.getZ())) >> 4;
+    }
+    if (args.size() > 3) {
+        auto x = parseInt(args[2]);
+        auto z = parseInt(args[3]);
+        if (!x || !z) {
+            sender.sendErrorMessage("The center must be given as chunk coordinates.");
+            return false;
+        }
+        center_x = *x;
+        center_z = *z;
+    }
+    auto target_usage = args.size() > 4 ? parseFloat(args[4]) : DefaultTargetUsage;
+    if (!target_usage || !(*target_usage > 0.0F && *target_usage <= 1.0F)) {
+        sender.sendErrorMessage("The target usage must be between 0 and 1.");
+        return false;
+    }
+
+    if (!dimension.startPregeneration(center_x, center_z, *radius, *target_usage)) {
+        sender.sendErrorMessage("A pre-generation is already running in {}.", dimension.getName());
+        return false;
+    }
+    auto side = 2 * static_cast<std::uint64_t>(*radius) + 1;
+    sender.sendMessage("{}Started the pre-generation of {} chunks around chunk ({}, {}) in {}.", ColorFormat::Green,
+                       side * side, center_x, center_z, dimension.getName());
+    return true;
+}
+
+void PregenCommand::sendProgress(CommandSender &sender, const Dimension &dimension) const
+{
+    auto progress = dimension.getPregenerationProgress();
+    if (!progress) {
+        sender.sendMessage("{}No pre-generation is running in {}.", ColorFormat::Gold, dimension.getName());
+        return;
+    }
+
+    std::string eta = "unknown";
+    if (progress->eta) {
+        auto seconds = progress->eta->count();
+        eta = fmt::format("{}h {}m {}s", seconds / 3600, (seconds / 60) % 60, seconds % 60);
+    }
+    sender.sendMessage("{}Pre-generation of {} around chunk ({}, {}): {}{}/{} chunks ({:.1f}%), {:.1f} chunks/s, "
+                       "ETA {}",
+                       ColorFormat::Gold, dimension.getName(), progress->center_x, progress->center_z,
+                       ColorFormat::Red, progress->completed, progress->total,
+                       100.0 * static_cast<double>(progress->completed) / static_cast<double>(progress->total),
+                       progress->chunks_per_second, eta);
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,108 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/command/defaults/profile_command.h"
+
+#include <charconv>
+#include <chrono>
+#include <optional>
+#include <string>
+
+#include "endstone/color_format.h"
+#include "endstone/detail/profiler.h"
+
+namespace endstone::detail {
+
+namespace {
+constexpr int MaxInterval = 1000;
+
+std::optional<int> parseInt(const std::string &arg)
+{
+    int value;
+    auto [end, ec] = std::from_chars(arg.data(), arg.data() + arg.size(), value);
+    if (ec != std::errc() || end != arg.data() + arg.size()) {
+        return std::nullopt;
+    }
+    return value;
+}
+}  // namespace
+
+ProfileCommand::ProfileCommand() : EndstoneCommand("profile")
+{
+    setDescription("Samples the stack of the server thread and writes a flame graph of where the time is spent.");
+    setUsages("/profile (start)<action: ProfileStartAction> [interval: int]",
+              "/profile (stop|status)<action: ProfileAction>");
+    setPermissions("endstone.command.profile");
+}
+
+bool ProfileCommand::execute(CommandSender &sender, const std::vector<std::string> &args) const
+{
+    if (!testPermission(sender)) {
+        return true;
+    }
+
+    if (args.empty() || args[0] == "status") {
+        sendStatus(sender);
+        return true;
+    }
+
+    const auto &action = args[0];
+    if (action == "start") {
+        return start(sender, args);
+    }
+    if (action == "stop") {
+        auto &profiler = Profiler::getInstance();
+        const auto samples = profiler.getSampleCount();
+        if (!profiler.stop()) {
+            sender.sendErrorMessage("The server is not being profiled.");
+            return false;
+        }
+        sender.sendMessage("{}Stopped profiling after {} samples. The profile is being written to the profiles folder.",
+                           ColorFormat::Green, samples);
+        return true;
+    }
+
+    sender.sendErrorMessage("Unknown action: {}", action);
+    return false;
+}
+
+bool ProfileCommand::start(CommandSender &sender, const std::vector<std::string> &args) const
+{
+    auto interval = args.size() > 1 ? parseInt(args[1]) : static_cast<int>(Profiler::DefaultInterval.count());
+    if (!interval || *interval < 1 || *interval > MaxInterval) {
+        sender.sendErrorMessage("The interval must be between 1 and {} milliseconds.", MaxInterval);
+        return false;
+    }
+
+    if (!Profiler::getInstance().start(std::chrono::milliseconds(*interval))) {
+        sender.sendErrorMessage("A profile is already being recorded or written.");
+        return false;
+    }
+    sender.sendMessage("{}Started profiling the server thread every {}ms.", ColorFormat::Green, *interval);
+    return true;
+}
+
+void ProfileCommand::sendStatus(CommandSender &sender) const
+{
+    auto &profiler = Profiler::getInstance();
+    if (!profiler.isRunning()) {
+        sender.sendMessage("{}The server is not being profiled.", ColorFormat::Gold);
+        return;
+    }
+    sender.sendMessage("{}Profiling for {:.1f}s, {}{}{} samples taken.", ColorFormat::Gold,
+                       std::chrono::duration<double>(profiler.getElapsed()).count(), ColorFormat::Red,
+                       profiler.getSampleCount(), ColorFormat::Gold);
+}
+
+}  // namespace endstone::detail
@@ -14,6 +14,9 @@
 
 #include "endstone/detail/command/defaults/reload_command.h"
 
+#include <algorithm>
+#include <cctype>
+
 #include <entt/entt.hpp>
 
 #include "endstone/color_format.h"
@@ -23,8 +26,8 @@ namespace endstone::detail {
 
 ReloadCommand::ReloadCommand() : EndstoneCommand("reload")
 {
-    setDescription("Reloads the server configuration, functions, scripts and plugins.");
-    setUsages("/reload");
+    setDescription("Reloads the server configuration, functions, scripts and plugins, or a single plugin.");
+    setUsages("/reload", "/reload ()[plugin: PluginName]");
     setPermissions("endstone.command.reload");
     setAliases("rl");
 }
@@ -41,8 +44,37 @@ bool ReloadCommand::execute(CommandSender &sender, const std::vector<std::string
     }
 
     auto &server = entt::locator<EndstoneServer>::value();
-    server.reload();
-    server.broadcast(ColorFormat::Green + "Reload complete.", Server::BroadcastChannelAdmin);
+    if (args.empty()) {
+        server.reload();
+        server.broadcast(ColorFormat::Green + "Reload complete.", Server::BroadcastChannelAdmin);
+        return true;
+    }
+
+    auto target_name = args[0];
+    std::transform(target_name.begin(), target_name.end(), target_name.begin(),
+                   [](unsigned char c) { return std::tolower(c); });
+
+    auto plugins = server.getPluginManager().getPlugins();
+    auto it = std::find_if(plugins.begin(), plugins.end(), [&target_name](const auto *plugin) {
+        auto name = plugin->getName();
+        std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
+        return name == target_name;
+    });
+    if (it == plugins.end()) {
+        sender.sendErrorMessage("This server is not running any plugin by that name.");
+        sender.sendMessage("Use /plugins to get a list of plugins.");
+        return false;
+    }
+
+    auto name = (*it)->getName();
+    auto *reloaded = server.reloadPlugin(**it);
+    if (!reloaded) {
+        server.broadcast(ColorFormat::Red + "Could not reload " + name + ", see the console for details.",
+                         Server::BroadcastChannelAdmin);
+        return false;
+    }
+    server.broadcast(ColorFormat::Green + "Reloaded " + reloaded->getDescription().getFullName() + ".",
+                     Server::BroadcastChannelAdmin);
     return true;
 }
 
@@ -14,13 +14,26 @@
 
 #include "endstone/detail/command/defaults/status_command.h"
 
+#include <chrono>
+#include <utility>
+
 #include <entt/entt.hpp>
 
 #include "endstone/color_format.h"
+#include "endstone/detail/memory_usage.h"
+#include "endstone/detail/plugin/python_plugin_loader.h"
+#include "endstone/detail/scheduler/scheduler.h"
 #include "endstone/detail/server.h"
 
 namespace endstone::detail {
 
+namespace {
+double toKibibytes(std::size_t bytes)
+{
+    return static_cast<double>(bytes) / 1024;
+}
+}  // namespace
+
 StatusCommand::StatusCommand() : EndstoneCommand("status")
 {
     setDescription("Gets the status of the server.");
@@ -68,6 +81,60 @@ bool StatusCommand::execute(CommandSender &sender, const std::vector<std::string
     sender.sendMessage("{}TPS: {}{:.2f}", ColorFormat::Gold, color, server.getAverageTicksPerSecond());
     sender.sendMessage("{}Usage: {}{:.2f}%", ColorFormat::Gold, color, server.getAverageTickUsage() * 100);
 
+    const auto &history = server.getTickHistory();
+    const auto average = history.getAverage(TickHistory::Capacity);
+    const auto max = history.getMax(TickHistory::Capacity);
+    auto to_ms = [](std::chrono::nanoseconds duration) {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    };
+    sender.sendMessage("{}Tick breakdown (last {} ticks): {}scheduler {:.3f}ms, level {:.3f}ms, post-tick {:.3f}ms",
+                       ColorFormat::Gold, history.size(), ColorFormat::Red, to_ms(average.scheduler),
+                       to_ms(average.level), to_ms(average.post_tick));
+    sender.sendMessage("{}Slowest tick: {}{:.3f}ms {}(scheduler {:.3f}ms, level {:.3f}ms, post-tick {:.3f}ms)",
+                       ColorFormat::Gold, ColorFormat::Red, to_ms(max.getTotal()), ColorFormat::Gold,
+                       to_ms(max.scheduler), to_ms(max.level), to_ms(max.post_tick));
+
+    sender.sendMessage("{}Tick durations (p50 / p95 / p99 / max):", ColorFormat::Gold);
+    for (auto [window, name] :
+         {std::pair{TickWindow::OneSecond, "1s"}, std::pair{TickWindow::OneMinute, "1m"},
+          std::pair{TickWindow::FiveMinutes, "5m"}, std::pair{TickWindow::FifteenMinutes, "15m"}}) {
+        auto statistics = server.getTickStatistics(window);
+        sender.sendMessage("  {}{}: {}{:.2f} / {:.2f} / {:.2f} / {:.2f}ms {}({} ticks)", ColorFormat::Gold, name,
+                           ColorFormat::Red, to_ms(statistics.p50), to_ms(statistics.p95), to_ms(statistics.p99),
+                           to_ms(statistics.max), ColorFormat::Gold, statistics.count);
+    }
+
+    auto &scheduler = static_cast<EndstoneScheduler &>(server.getScheduler());
+    sender.sendMessage("{}Deferred tasks: {}{}", ColorFormat::Gold, ColorFormat::Red, scheduler.getDeferredTaskCount());
+    sender.sendMessage("{}Open forms: {}{}", ColorFormat::Gold, ColorFormat::Red, server.getOpenFormCount());
+    for (auto [type, name] : {std::pair{AsyncExecutor::Cpu, "CPU"}, std::pair{AsyncExecutor::Io, "I/O"},
+                              std::pair{AsyncExecutor::Python, "Python"}}) {
+        auto &executor = scheduler.getExecutor(type);
+        sender.sendMessage("{}{} workers: {}{}{}, queued: {}{}", ColorFormat::Gold, name, ColorFormat::Red,
+                           executor.getThreadCount(), ColorFormat::Gold, ColorFormat::Red, executor.getQueueDepth());
+    }
+
+    sender.sendMessage("{}Memory (estimated):", ColorFormat::Gold);
+    auto &usage = MemoryUsage::getInstance();
+    for (std::size_t i = 0; i < static_cast<std::size_t>(MemorySubsystem::Count); ++i) {
+        const auto subsystem = static_cast<MemorySubsystem>(i);
+        sender.sendMessage("  {}{}: {}{:.1f} KiB", ColorFormat::Gold, MemoryUsage::getName(subsystem),
+                           ColorFormat::Red, toKibibytes(usage.get(subsystem)));
+    }
+    for (auto *plugin : server.getPluginManager().getPlugins()) {
+        if (auto *loader = dynamic_cast<PythonPluginLoader *>(&plugin->getPluginLoader())) {
+            auto [blocks, traced] = loader->getHeapUsage();
+            if (traced) {
+                sender.sendMessage("  {}Python heap: {}{} blocks, {:.1f} KiB traced", ColorFormat::Gold,
+                                   ColorFormat::Red, blocks, toKibibytes(*traced));
+            }
+            else {
+                sender.sendMessage("  {}Python heap: {}{} blocks", ColorFormat::Gold, ColorFormat::Red, blocks);
+            }
+            break;
+        }
+    }
+
     return true;
 }
 
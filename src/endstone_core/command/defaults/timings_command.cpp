@@ -0,0 +1,312 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/command/defaults/timings_command.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include <entt/entt.hpp>
+#include <magic_enum/magic_enum.hpp>
+
+#include "endstone/color_format.h"
+#include "endstone/detail/hook_timings.h"
+#include "endstone/detail/network/ping_rate_limiter.h"
+#include "endstone/detail/plugin/python_plugin_loader.h"
+#include "endstone/detail/scheduler/scheduler.h"
+#include "endstone/detail/server.h"
+
+namespace endstone::detail {
+
+namespace {
+constexpr std::size_t MaxReportEntries = 10;
+
+double toMilliseconds(std::chrono::nanoseconds duration)
+{
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+double toMebibytes(std::size_t bytes)
+{
+    return static_cast<double>(bytes) / (1024 * 1024);
+}
+
+PythonPluginLoader *findPythonPluginLoader(Server &server)
+{
+    for (auto *plugin : server.getPluginManager().getPlugins()) {
+        if (auto *loader = dynamic_cast<PythonPluginLoader *>(&plugin->getPluginLoader())) {
+            return loader;
+        }
+    }
+    return nullptr;
+}
+}  // namespace
+
+TimingsCommand::TimingsCommand() : EndstoneCommand("timings")
+{
+    setDescription("Records and reports the time spent in event handlers, tasks, hooked functions and commands.");
+    setUsages("/timings", "/timings (on|off|reset)<action: TimingsAction>",
+              "/timings (memory)<memory: TimingsMemoryAction> (on|off)[state: TimingsMemoryState]");
+    setPermissions("endstone.command.timings");
+}
+
+bool TimingsCommand::execute(CommandSender &sender, const std::vector<std::string> &args) const
+{
+    if (!testPermission(sender)) {
+        return true;
+    }
+
+    auto &server = entt::locator<EndstoneServer>::value();
+    auto &plugin_manager = server.getPluginManager();
+    auto &scheduler = static_cast<EndstoneScheduler &>(server.getScheduler());
+    auto &command_timings = server.getCommandMap().getTimings();
+    if (args.empty()) {
+        sendReport(sender);
+        return true;
+    }
+
+    const auto &action = args[0];
+    if (action == "memory") {
+        return executeMemory(sender, args);
+    }
+    if (action == "on") {
+        plugin_manager.resetTimings();
+        plugin_manager.setTimingsEnabled(true);
+        scheduler.resetTimings();
+        scheduler.setTimingsEnabled(true);
+        HookTimings::getInstance().reset();
+        HookTimings::setEnabled(true);
+        command_timings.reset();
+        command_timings.setEnabled(true);
+        server.getJoinTimings().reset();
+        sender.sendMessage(ColorFormat::Green + "Enabled timings and reset.");
+    }
+    else if (action == "off") {
+        plugin_manager.setTimingsEnabled(false);
+        scheduler.setTimingsEnabled(false);
+        HookTimings::setEnabled(false);
+        command_timings.setEnabled(false);
+        sender.sendMessage(ColorFormat::Green + "Disabled timings.");
+    }
+    else if (action == "reset") {
+        plugin_manager.resetTimings();
+        scheduler.resetTimings();
+        HookTimings::getInstance().reset();
+        command_timings.reset();
+        server.getJoinTimings().reset();
+        sender.sendMessage(ColorFormat::Green + "Timings reset.");
+    }
+    else {
+        sender.sendErrorMessage("Unknown action: {}", action);
+        return false;
+    }
+    return true;
+}
+
+void TimingsCommand::sendReport(CommandSender &sender) const
+{
+    auto &server = entt::locator<EndstoneServer>::value();
+    auto &plugin_manager = server.getPluginManager();
+    auto event_timings = plugin_manager.getEventTimings();
+    auto task_timings = server.getScheduler().getTaskTimings();
+    auto hook_timings = HookTimings::getInstance().getTimings();
+    auto command_timings = server.getCommandMap().getTimings().getTimings();
+    auto join_timings = server.getJoinTimings().getTimings();
+    if (event_timings.empty() && task_timings.empty() && hook_timings.empty() && command_timings.empty() &&
+        join_timings.empty()) {
+        if (plugin_manager.isTimingsEnabled()) {
+            sender.sendMessage(ColorFormat::Gold + "No event handlers, tasks, hooks or commands have been run yet.");
+        }
+        else {
+            sender.sendMessage(ColorFormat::Gold + "Timings are disabled. Use /timings on to enable them.");
+        }
+        return;
+    }
+
+    if (!event_timings.empty()) {
+        sendEventReport(sender, event_timings);
+    }
+    if (!task_timings.empty()) {
+        sendTaskReport(sender, task_timings);
+    }
+    if (!hook_timings.empty()) {
+        sendHookReport(sender, hook_timings);
+    }
+    if (!command_timings.empty()) {
+        sendCommandReport(sender, command_timings);
+    }
+    if (!join_timings.empty()) {
+        sendJoinReport(sender, join_timings);
+    }
+
+    const auto &ping_limiter = PingRateLimiter::getInstance();
+    if (ping_limiter.getServedCount() > 0 || ping_limiter.getDroppedCount() > 0) {
+        sender.sendMessage("{}Server list pings: {}{} answered, {} dropped by rate limit", ColorFormat::Gold,
+                           ColorFormat::Red, ping_limiter.getServedCount(), ping_limiter.getDroppedCount());
+    }
+
+    const auto &rate_limiter = server.getCommandMap().getRateLimiter();
+    if (rate_limiter.getDeferredCount() > 0 || rate_limiter.getDroppedCount() > 0) {
+        sender.sendMessage("{}Commands over budget: {}{} deferred, {} dropped", ColorFormat::Gold, ColorFormat::Red,
+                           rate_limiter.getDeferredCount(), rate_limiter.getDroppedCount());
+    }
+}
+
+bool TimingsCommand::executeMemory(CommandSender &sender, const std::vector<std::string> &args) const
+{
+    auto &server = entt::locator<EndstoneServer>::value();
+    auto *loader = findPythonPluginLoader(server);
+    if (!loader) {
+        sender.sendErrorMessage("No Python plugins are loaded, the memory of C++ plugins is not tracked.");
+        return false;
+    }
+
+    if (args.size() > 1) {
+        const auto &state = args[1];
+        if (state != "on" && state != "off") {
+            sender.sendErrorMessage("Unknown state: {}", state);
+            return false;
+        }
+        loader->setMemoryTracing(state == "on");
+        sender.sendMessage(ColorFormat::Green + (state == "on" ? "Enabled" : "Disabled") +
+                           " memory tracing of Python plugins.");
+        return true;
+    }
+
+    if (!loader->isMemoryTracing()) {
+        sender.sendMessage(ColorFormat::Gold + "Memory tracing is disabled. Use /timings memory on to enable it.");
+        return true;
+    }
+
+    auto usage = loader->getMemoryUsage();
+    sender.sendMessage("{}---- {}Python plugin memory{} ----", ColorFormat::Green, ColorFormat::Reset,
+                       ColorFormat::Green);
+    for (std::size_t i = 0; i < std::min(usage.size(), MaxReportEntries); ++i) {
+        const auto &[plugin, bytes] = usage[i];
+        sender.sendMessage("{}{}: {}{:.2f} MiB", ColorFormat::Gold, plugin, ColorFormat::Red, toMebibytes(bytes));
+    }
+    if (usage.size() > MaxReportEntries) {
+        sender.sendMessage("{}... and {} more", ColorFormat::Gold, usage.size() - MaxReportEntries);
+    }
+    return true;
+}
+
+void TimingsCommand::sendEventReport(CommandSender &sender, std::vector<EventTiming> timings) const
+{
+    std::sort(timings.begin(), timings.end(), [](const auto &a, const auto &b) { return a.total > b.total; });
+    sender.sendMessage("{}---- {}Event timings{} ----", ColorFormat::Green, ColorFormat::Reset, ColorFormat::Green);
+    for (std::size_t i = 0; i < std::min(timings.size(), MaxReportEntries); ++i) {
+        const auto &timing = timings[i];
+        sender.sendMessage("{}{} {}{} ({}): {}{} calls, total {:.2f}ms, avg {:.3f}ms, max {:.3f}ms, p99 {:.3f}ms",
+                           ColorFormat::Gold, timing.plugin, ColorFormat::White, timing.event,
+                           magic_enum::enum_name(timing.priority), ColorFormat::Red, timing.count,
+                           toMilliseconds(timing.total), toMilliseconds(timing.total) / timing.count,
+                           toMilliseconds(timing.max), toMilliseconds(timing.p99));
+    }
+    if (timings.size() > MaxReportEntries) {
+        sender.sendMessage("{}... and {} more", ColorFormat::Gold, timings.size() - MaxReportEntries);
+    }
+}
+
+void TimingsCommand::sendTaskReport(CommandSender &sender, std::vector<TaskTiming> timings) const
+{
+    std::sort(timings.begin(), timings.end(),
+              [](const auto &a, const auto &b) { return a.sync_total > b.sync_total; });
+    sender.sendMessage("{}---- {}Task timings{} ----", ColorFormat::Green, ColorFormat::Reset, ColorFormat::Green);
+    for (std::size_t i = 0; i < std::min(timings.size(), MaxReportEntries); ++i) {
+        const auto &timing = timings[i];
+        sender.sendMessage("{}{}: {}{} sync runs ({:.1f}/tick, max {}/tick), total {:.2f}ms, max {:.3f}ms; "
+                           "{} async runs, {:.2f}ms on workers, {} queued",
+                           ColorFormat::Gold, timing.plugin, ColorFormat::Red, timing.sync_count,
+                           timing.sync_ticks == 0 ? 0.0
+                                                  : static_cast<double>(timing.sync_count) / timing.sync_ticks,
+                           timing.sync_max_per_tick, toMilliseconds(timing.sync_total),
+                           toMilliseconds(timing.sync_max), timing.async_count, toMilliseconds(timing.async_total),
+                           timing.async_pending);
+    }
+    if (timings.size() > MaxReportEntries) {
+        sender.sendMessage("{}... and {} more", ColorFormat::Gold, timings.size() - MaxReportEntries);
+    }
+}
+
+void TimingsCommand::sendHookReport(CommandSender &sender, std::vector<HookTiming> timings) const
+{
+    auto total = [](const HookTiming &timing) {
+        return timing.detour_count > 0 ? timing.detour_total : timing.original_total;
+    };
+    std::sort(timings.begin(), timings.end(), [&](const auto &a, const auto &b) { return total(a) > total(b); });
+    sender.sendMessage("{}---- {}Hook timings{} ----", ColorFormat::Green, ColorFormat::Reset, ColorFormat::Green);
+    for (std::size_t i = 0; i < std::min(timings.size(), MaxReportEntries); ++i) {
+        const auto &timing = timings[i];
+        if (timing.detour_count > 0) {
+            sender.sendMessage("{}{}: {}{} calls, total {:.2f}ms (Endstone {:.2f}ms, original {:.2f}ms), "
+                               "max {:.3f}ms, p99 {:.3f}ms",
+                               ColorFormat::Gold, timing.name, ColorFormat::Red, timing.detour_count,
+                               toMilliseconds(timing.detour_total),
+                               toMilliseconds(timing.detour_total - timing.original_total),
+                               toMilliseconds(timing.original_total), toMilliseconds(timing.detour_max),
+                               toMilliseconds(timing.detour_p99));
+        }
+        else {
+            sender.sendMessage("{}{}: {}{} calls to the original, total {:.2f}ms, max {:.3f}ms, p99 {:.3f}ms",
+                               ColorFormat::Gold, timing.name, ColorFormat::Red, timing.original_count,
+                               toMilliseconds(timing.original_total), toMilliseconds(timing.original_max),
+                               toMilliseconds(timing.original_p99));
+        }
+    }
+    if (timings.size() > MaxReportEntries) {
+        sender.sendMessage("{}... and {} more", ColorFormat::Gold, timings.size() - MaxReportEntries);
+    }
+}
+
+void TimingsCommand::sendCommandReport(CommandSender &sender, std::vector<CommandTiming> timings) const
+{
+    std::uint64_t vanilla_count = 0;
+    std::uint64_t plugin_count = 0;
+    std::chrono::nanoseconds vanilla_total{0};
+    std::chrono::nanoseconds plugin_total{0};
+    for (const auto &timing : timings) {
+        (timing.vanilla ? vanilla_count : plugin_count) += timing.count;
+        (timing.vanilla ? vanilla_total : plugin_total) += timing.total;
+    }
+
+    std::sort(timings.begin(), timings.end(), [](const auto &a, const auto &b) { return a.total > b.total; });
+    sender.sendMessage("{}---- {}Command timings{} ----", ColorFormat::Green, ColorFormat::Reset, ColorFormat::Green);
+    sender.sendMessage("{}Vanilla: {}{} calls, total {:.2f}ms; {}Endstone and plugins: {}{} calls, total {:.2f}ms",
+                       ColorFormat::Gold, ColorFormat::Red, vanilla_count, toMilliseconds(vanilla_total),
+                       ColorFormat::Gold, ColorFormat::Red, plugin_count, toMilliseconds(plugin_total));
+    for (std::size_t i = 0; i < std::min(timings.size(), MaxReportEntries); ++i) {
+        const auto &timing = timings[i];
+        sender.sendMessage("{}{} {}/{}: {}{} calls, total {:.2f}ms, avg {:.3f}ms, max {:.3f}ms, p99 {:.3f}ms",
+                           ColorFormat::Gold, timing.owner, ColorFormat::White, timing.name, ColorFormat::Red,
+                           timing.count, toMilliseconds(timing.total), toMilliseconds(timing.total) / timing.count,
+                           toMilliseconds(timing.max), toMilliseconds(timing.p99));
+    }
+    if (timings.size() > MaxReportEntries) {
+        sender.sendMessage("{}... and {} more", ColorFormat::Gold, timings.size() - MaxReportEntries);
+    }
+}
+
+void TimingsCommand::sendJoinReport(CommandSender &sender, const std::vector<JoinPhaseTiming> &timings) const
+{
+    sender.sendMessage("{}---- {}Join timings{} ----", ColorFormat::Green, ColorFormat::Reset, ColorFormat::Green);
+    for (const auto &timing : timings) {
+        sender.sendMessage("{}{}: {}{} joins, total {:.2f}ms, avg {:.3f}ms, max {:.3f}ms, p99 {:.3f}ms",
+                           ColorFormat::Gold, JoinTimings::getName(timing.phase), ColorFormat::Red, timing.count,
+                           toMilliseconds(timing.total), toMilliseconds(timing.total) / timing.count,
+                           toMilliseconds(timing.max), toMilliseconds(timing.p99));
+    }
+}
+
+}  // namespace endstone::detail
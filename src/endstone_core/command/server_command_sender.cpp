@@ -71,6 +71,11 @@ void ServerCommandSender::recalculatePermissions()
     perm_.recalculatePermissions();
 }
 
+void ServerCommandSender::recalculatePermission(PermissionAttachment &attachment, const std::string &name, bool value)
+{
+    perm_.recalculatePermission(attachment, name, value);
+}
+
 std::unordered_set<PermissionAttachmentInfo *> ServerCommandSender::getEffectivePermissions() const
 {
     return perm_.getEffectivePermissions();
@@ -0,0 +1,200 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/console/console_reader.h"
+
+#include <array>
+#include <cerrno>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+#endif
+
+namespace endstone::detail {
+
+namespace {
+constexpr int PollTimeoutMilliseconds = 100;
+}  // namespace
+
+struct ConsoleReader::TerminalMode {
+#ifndef _WIN32
+    termios original;
+#endif
+};
+
+ConsoleReader::ConsoleReader(int input, LineCallback on_line, ConsoleLogSink *sink)
+    : input_(input), on_line_(std::move(on_line)), sink_(sink)
+{
+#ifndef _WIN32
+    termios mode{};
+    if (sink_ && isatty(input_) && tcgetattr(input_, &mode) == 0) {
+        terminal_mode_ = std::make_unique<TerminalMode>(TerminalMode{mode});
+        // Signals are kept so that Ctrl+C still stops the server
+        mode.c_lflag &= ~static_cast<tcflag_t>(ICANON | ECHO);
+        mode.c_cc[VMIN] = 1;
+        mode.c_cc[VTIME] = 0;
+        interactive_ = tcsetattr(input_, TCSANOW, &mode) == 0;
+    }
+    if (interactive_) {
+        sink_->setInputLine([this] { return renderInputLine(); });
+        sink_->redrawInputLine();
+    }
+    reader_ = std::thread(&ConsoleReader::run, this);
+#endif
+}
+
+ConsoleReader::~ConsoleReader()
+{
+    stopping_ = true;
+    if (reader_.joinable()) {
+        reader_.join();
+    }
+#ifndef _WIN32
+    if (interactive_) {
+        sink_->setInputLine(nullptr);
+        sink_->redrawInputLine();
+    }
+    if (terminal_mode_) {
+        tcsetattr(input_, TCSANOW, &terminal_mode_->original);
+    }
+    close(input_);
+#endif
+}
+
+std::unique_ptr<ConsoleReader> ConsoleReader::forStandardInput(ConsoleLogSink *sink)
+{
+#ifdef _WIN32
+    return nullptr;
+#else
+    std::array<int, 2> pipe_fds{};
+    if (pipe(pipe_fds.data()) != 0) {
+        return nullptr;
+    }
+    const int input = dup(STDIN_FILENO);
+    if (input < 0 || dup2(pipe_fds[0], STDIN_FILENO) < 0) {
+        if (input >= 0) {
+            close(input);
+        }
+        close(pipe_fds[0]);
+        close(pipe_fds[1]);
+        return nullptr;
+    }
+    close(pipe_fds[0]);
+
+    // Closing the write end when the callback is released lets the server see the end of its input
+    auto output = std::shared_ptr<int>(new int(pipe_fds[1]), [](const int *fd) {
+        close(*fd);
+        delete fd;
+    });
+    auto on_line = [output](std::string line) {
+        line.push_back('\n');
+        const auto *data = line.data();
+        auto size = line.size();
+        while (size > 0) {
+            auto written = write(*output, data, size);
+            if (written <= 0) {
+                return;
+            }
+            data += written;
+            size -= static_cast<std::size_t>(written);
+        }
+    };
+    return std::make_unique<ConsoleReader>(input, std::move(on_line), sink);
+#endif
+}
+
+bool ConsoleReader::isInteractive() const
+{
+    return interactive_;
+}
+
+void ConsoleReader::run()
+{
+#ifndef _WIN32
+    std::array<char, 256> buffer{};
+    pollfd descriptor{input_, POLLIN, 0};
+    while (!stopping_) {
+        // Waits with a timeout, so that the reader can be stopped without closing the input under it
+        descriptor.revents = 0;
+        const auto ready = poll(&descriptor, 1, PollTimeoutMilliseconds);
+        if (ready == 0 || (ready < 0 && errno == EINTR)) {
+            continue;
+        }
+        if (ready < 0) {
+            break;
+        }
+        const auto size = read(input_, buffer.data(), buffer.size());
+        if (size < 0 && errno == EINTR) {
+            continue;
+        }
+        if (size <= 0) {
+            break;
+        }
+        handle(buffer.data(), static_cast<std::size_t>(size));
+    }
+
+    // The last line of a piped input may have no line ending
+    if (!interactive_ && !pending_.empty()) {
+        on_line_(std::move(pending_));
+    }
+    on_line_ = nullptr;
+#endif
+}
+
+void ConsoleReader::handle(const char *data, std::size_t size)
+{
+    if (!interactive_) {
+        for (std::size_t i = 0; i < size; ++i) {
+            if (data[i] != '\n') {
+                pending_.push_back(data[i]);
+                continue;
+            }
+            if (!pending_.empty() && pending_.back() == '\r') {
+                pending_.pop_back();
+            }
+            on_line_(std::move(pending_));
+            pending_.clear();
+        }
+        return;
+    }
+
+    std::vector<std::string> lines;
+    {
+        std::lock_guard lock(mutex_);
+        for (std::size_t i = 0; i < size; ++i) {
+            if (auto line = editor_.feed(data[i])) {
+                lines.push_back(std::move(*line));
+            }
+        }
+    }
+    // Completed lines are echoed through the sink, so they stay above the line being typed
+    for (auto &line : lines) {
+        sink_->echo(editor_.getPrompt() + line);
+        on_line_(std::move(line));
+    }
+    sink_->redrawInputLine();
+}
+
+std::string ConsoleReader::renderInputLine() const
+{
+    std::lock_guard lock(mutex_);
+    return editor_.render();
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,239 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/console/line_editor.h"
+
+#include <utility>
+
+namespace endstone::detail {
+
+namespace {
+bool isContinuation(char c)
+{
+    return (static_cast<unsigned char>(c) & 0xC0) == 0x80;
+}
+}  // namespace
+
+LineEditor::LineEditor(std::string prompt) : prompt_(std::move(prompt)) {}
+
+std::optional<std::string> LineEditor::feed(char c)
+{
+    switch (state_) {
+    case State::Escape:
+        // ESC [ and ESC O both start the sequences sent by the cursor keys
+        state_ = (c == '[' || c == 'O') ? State::ControlSequence : State::Normal;
+        parameters_.clear();
+        return std::nullopt;
+    case State::ControlSequence:
+        if (c >= 0x40 && c <= 0x7E) {
+            state_ = State::Normal;
+            handleControlSequence(c);
+        }
+        else {
+            parameters_.push_back(c);
+        }
+        return std::nullopt;
+    case State::Normal:
+    default:
+        break;
+    }
+
+    switch (c) {
+    case '\r':
+    case '\n':
+        return accept();
+    case '\x1B':
+        state_ = State::Escape;
+        break;
+    case '\x7F':
+    case '\b':
+        erase(previous(cursor_), cursor_);
+        break;
+    case '\x01':  // Ctrl+A
+        cursor_ = 0;
+        break;
+    case '\x05':  // Ctrl+E
+        cursor_ = line_.size();
+        break;
+    case '\x02':  // Ctrl+B
+        cursor_ = previous(cursor_);
+        break;
+    case '\x06':  // Ctrl+F
+        cursor_ = next(cursor_);
+        break;
+    case '\x0B':  // Ctrl+K
+        erase(cursor_, line_.size());
+        break;
+    case '\x15':  // Ctrl+U
+        erase(0, cursor_);
+        break;
+    case '\x17': {  // Ctrl+W
+        auto begin = cursor_;
+        while (begin > 0 && line_[begin - 1] == ' ') {
+            --begin;
+        }
+        while (begin > 0 && line_[begin - 1] != ' ') {
+            --begin;
+        }
+        erase(begin, cursor_);
+        break;
+    }
+    default:
+        if (static_cast<unsigned char>(c) >= 0x20) {
+            insert(c);
+        }
+        break;
+    }
+    return std::nullopt;
+}
+
+std::string LineEditor::render() const
+{
+    auto result = prompt_ + line_;
+    std::size_t behind = 0;
+    for (auto i = cursor_; i < line_.size(); ++i) {
+        if (!isContinuation(line_[i])) {
+            ++behind;
+        }
+    }
+    if (behind > 0) {
+        result += "\x1B[" + std::to_string(behind) + "D";
+    }
+    return result;
+}
+
+const std::string &LineEditor::getPrompt() const
+{
+    return prompt_;
+}
+
+const std::string &LineEditor::getLine() const
+{
+    return line_;
+}
+
+std::size_t LineEditor::getCursor() const
+{
+    return cursor_;
+}
+
+std::optional<std::string> LineEditor::accept()
+{
+    auto line = std::move(line_);
+    line_.clear();
+    cursor_ = 0;
+    draft_.clear();
+    if (line.empty()) {
+        history_position_ = history_.size();
+        return std::nullopt;
+    }
+    if (history_.empty() || history_.back() != line) {
+        history_.push_back(line);
+        if (history_.size() > MaxHistorySize) {
+            history_.pop_front();
+        }
+    }
+    history_position_ = history_.size();
+    return line;
+}
+
+void LineEditor::handleControlSequence(char final)
+{
+    switch (final) {
+    case 'A':
+        if (history_position_ > 0) {
+            recall(history_position_ - 1);
+        }
+        break;
+    case 'B':
+        if (history_position_ < history_.size()) {
+            recall(history_position_ + 1);
+        }
+        break;
+    case 'C':
+        cursor_ = next(cursor_);
+        break;
+    case 'D':
+        cursor_ = previous(cursor_);
+        break;
+    case 'H':
+        cursor_ = 0;
+        break;
+    case 'F':
+        cursor_ = line_.size();
+        break;
+    case '~':
+        // VT sequences of the editing keys: 1 and 7 are Home, 4 and 8 are End, 3 is Delete
+        if (parameters_ == "1" || parameters_ == "7") {
+            cursor_ = 0;
+        }
+        else if (parameters_ == "4" || parameters_ == "8") {
+            cursor_ = line_.size();
+        }
+        else if (parameters_ == "3") {
+            erase(cursor_, next(cursor_));
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void LineEditor::insert(char c)
+{
+    line_.insert(line_.begin() + static_cast<std::ptrdiff_t>(cursor_), c);
+    ++cursor_;
+}
+
+void LineEditor::erase(std::size_t begin, std::size_t end)
+{
+    line_.erase(begin, end - begin);
+    cursor_ = begin;
+}
+
+void LineEditor::recall(std::size_t position)
+{
+    if (history_position_ == history_.size()) {
+        draft_ = line_;
+    }
+    history_position_ = position;
+    line_ = position == history_.size() ? draft_ : history_[position];
+    cursor_ = line_.size();
+}
+
+std::size_t LineEditor::previous(std::size_t position) const
+{
+    if (position == 0) {
+        return 0;
+    }
+    --position;
+    while (position > 0 && isContinuation(line_[position])) {
+        --position;
+    }
+    return position;
+}
+
+std::size_t LineEditor::next(std::size_t position) const
+{
+    if (position >= line_.size()) {
+        return line_.size();
+    }
+    ++position;
+    while (position < line_.size() && isContinuation(line_[position])) {
+        ++position;
+    }
+    return position;
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,879 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/devtools/vanilla_data.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <magic_enum/magic_enum.hpp>
+#include <zlib.h>
+
+#include "bedrock/nbt/nbt_io.h"
+#include "bedrock/network/packet/crafting_data_packet.h"
+#include "bedrock/world/item/registry/creative_item_registry.h"
+#include "bedrock/world/level/block/actor/furnace_block_actor.h"
+#include "bedrock/world/level/dimension/vanilla_dimensions.h"
+#include "endstone/detail/base64.h"
+#include "endstone/detail/hook.h"
+#include "endstone/detail/level/level.h"
+#include "endstone/detail/server.h"
+
+namespace endstone::detail::devtools {
+
+nlohmann::json toJson(const Tag &tag)  // NOLINT(*-no-recursion)
+{
+    switch (tag.getId()) {
+    case Tag::Type::Byte: {
+        const auto &t = static_cast<const ByteTag &>(tag);
+        return t.data;
+    }
+    case Tag::Type::Short: {
+        const auto &t = static_cast<const ShortTag &>(tag);
+        return t.data;
+    }
+    case Tag::Type::Int: {
+        const auto &t = static_cast<const IntTag &>(tag);
+        return t.data;
+    }
+    case Tag::Type::Int64: {
+        const auto &t = static_cast<const Int64Tag &>(tag);
+        return t.data;
+    }
+    case Tag::Type::Float: {
+        const auto &t = static_cast<const FloatTag &>(tag);
+        return t.data;
+    }
+    case Tag::Type::Double: {
+        const auto &t = static_cast<const DoubleTag &>(tag);
+        return t.data;
+    }
+    case Tag::Type::String: {
+        const auto &t = static_cast<const StringTag &>(tag);
+        return t.data;
+    }
+    case Tag::Type::List: {
+        nlohmann::json array;
+        const auto &t = static_cast<const ListTag &>(tag);
+        for (auto i = 0; i < t.size(); i++) {
+            array.push_back(toJson(*t.get(i)));
+        }
+        return array;
+    }
+    case Tag::Type::Compound: {
+        nlohmann::json object;
+        const auto &t = static_cast<const CompoundTag &>(tag);
+        for (const auto &[key, value] : t) {
+            object[key] = toJson(*value.get());
+        }
+        return object;
+    }
+    case Tag::Type::IntArray: {
+        nlohmann::json array;
+        const auto &t = static_cast<const IntArrayTag &>(tag);
+        for (const auto &i : t.data) {
+            array.push_back(i);
+        }
+        return array;
+    }
+    case Tag::Type::ByteArray: {
+        nlohmann::json array;
+        const auto &t = static_cast<const ByteArrayTag &>(tag);
+        for (const auto &i : t.data) {
+            array.push_back(i);
+        }
+        return array;
+    }
+    case Tag::Type::End:
+    default:
+        return {};
+    }
+}
+
+namespace {
+double round(double d)
+{
+    d *= 1000000.0;
+    if (d >= 0) {
+        d += 0.5;
+    }
+    else {
+        d -= 0.5;
+    }
+    return static_cast<int>(d) / 1000000.0;
+}
+
+// The collection below runs on the server thread and only copies values out of the server. Turning them into JSON is
+// left to the DevTools thread, so a large pack costs the server one pass over its registries and nothing more.
+struct Material {
+    std::string name;
+    bool is_never_buildable;
+    bool is_always_destroyable;
+    bool is_liquid;
+    double translucency;
+    bool blocks_motion;
+    bool blocks_precipitation;
+    bool is_solid;
+    bool is_super_hot;
+    bool is_solid_blocking;
+};
+
+struct BlockType {
+    std::string name;
+    std::string material;
+    std::vector<std::string> tags;
+    std::vector<std::string> special_tools;
+};
+
+struct BlockState {
+    std::string name;
+    BlockRuntimeId runtime_id;
+    BurnOdds burn_odds;
+    FlameOdds flame_odds;
+    double thickness;
+    Brightness light;
+    Brightness light_emission;
+    double explosion_resistance;
+    double friction;
+    double hardness;
+    bool can_contain_liquid;
+    std::string map_color;
+    std::array<float, 6> collision_shape;
+};
+
+struct ItemType {
+    std::string name;
+    std::int16_t id;
+    int attack_damage;
+    int armor_value;
+    int toughness_value;
+    std::int16_t max_damage;
+    bool is_damageable;
+    std::uint8_t max_stack_size;
+    float furnace_burn_duration;
+    float furnace_xp_multiplier;
+    std::vector<std::string> tags;
+};
+
+struct RecipeItem {
+    std::string item;
+    std::optional<std::string> tag;
+    std::optional<int> count;
+    std::optional<int> data;
+    std::optional<std::string> nbt;
+};
+
+struct RecipeEntry {
+    CraftingDataEntryType type;
+    bool has_recipe;
+    std::string id;
+    unsigned int net_id;
+    std::string uuid;
+    std::string tag;
+    int priority;
+    int width;
+    int height;
+    std::vector<RecipeItem> input;
+    std::vector<RecipeItem> output;
+};
+
+struct PotionMix {
+    RecipeItem input;
+    RecipeItem reagent;
+    RecipeItem output;
+};
+
+struct ContainerMix {
+    std::string input;
+    std::string reagent;
+    std::string output;
+};
+
+struct MaterialReducer {
+    int input;
+    std::vector<RecipeItem> outputs;
+};
+
+struct CollectedData {
+    std::vector<Material> materials;
+    std::vector<BlockType> block_types;
+    std::vector<BlockState> block_states;
+    ::ListTag block_palette;
+    std::vector<ItemType> items;
+    ::ListTag creative_items;
+    std::vector<RecipeEntry> recipes;
+    std::vector<PotionMix> potion_mixes;
+    std::vector<ContainerMix> container_mixes;
+    std::vector<MaterialReducer> material_reducers;
+};
+
+std::optional<int> auxValue(int aux)
+{
+    if (aux != 0 && aux != 0x7fff) {
+        return aux;
+    }
+    return std::nullopt;
+}
+
+void collectBlockData(CollectedData &data, ::Level &level)
+{
+    auto overworld = level.getDimension(VanillaDimensions::Overworld);
+    auto &region = overworld->getBlockSourceFromMainChunkSource();
+    auto item_registry = level.getItemRegistry();
+
+    BlockTypeRegistry::forEachBlock([&](const BlockLegacy &block_legacy) {
+        const auto &material = block_legacy.getMaterial();
+        auto material_name = std::string(magic_enum::enum_name(material.getType()));
+        data.materials.push_back({
+            material_name,
+            material.isNeverBuildable(),
+            material.isAlwaysDestroyable(),
+            material.isLiquid(),
+            round(material.getTranslucency()),
+            material.getBlocksMotion(),
+            material.getBlocksPrecipitation(),
+            material.isSolid(),
+            material.isSuperHot(),
+            material.isSolidBlocking(),
+        });
+
+        const auto &name = block_legacy.getFullNameId();
+        auto &block_type = data.block_types.emplace_back();
+        block_type.name = name;
+        block_type.material = material_name;
+        for (const auto &tag : block_legacy.getTags()) {
+            auto tag_name = tag.getString();
+            if (tag_name.rfind("minecraft:", 0) == std::string::npos) {
+                tag_name = "minecraft:" + tag_name;
+            }
+            block_type.tags.push_back(tag_name);
+        }
+        for (const auto &[key, item] : item_registry.getNameToItemMap()) {
+            if (item->canDestroySpecial(*block_legacy.getDefaultState())) {
+                block_type.special_tools.push_back(item->getFullItemName());
+            }
+        }
+
+        block_legacy.forEachBlockPermutation([&](const ::Block &block) {
+            AABB collision_shape = {0};
+            block.getCollisionShape(collision_shape, region, {0, 0, 0}, nullptr);
+            auto map_color = block.getLegacyBlock().getMapColor(region, {0, 10, 0}, block);
+            data.block_states.push_back({
+                name,
+                block.getRuntimeId(),
+                block.getBurnOdds(),
+                block.getFlameOdds(),
+                round(block.getThickness()),
+                block.getLight(),
+                block.getLightEmission(),
+                round(block.getExplosionResistance()),
+                round(block.getFriction()),
+                round(block.getDestroySpeed()),
+                block.getLegacyBlock().canContainLiquid(),
+                map_color.toHexString(),
+                {
+                    collision_shape.min.x,
+                    collision_shape.min.y,
+                    collision_shape.min.z,
+                    collision_shape.max.x,
+                    collision_shape.max.y,
+                    collision_shape.max.z,
+                },
+            });
+            data.block_palette.add(block.getSerializationId().copy());
+            return true;
+        });
+        return true;
+    });
+}
+
+void collectItemData(CollectedData &data, ::Level &level)
+{
+    auto item_registry = level.getItemRegistry();
+    for (const auto &[key, item] : item_registry.getNameToItemMap()) {
+        auto &item_type = data.items.emplace_back();
+        item_type.name = item->getFullItemName();
+        item_type.id = item->getId();
+        item_type.attack_damage = item->getAttackDamage();
+        item_type.armor_value = item->getArmorValue();
+        item_type.toughness_value = item->getToughnessValue();
+        item_type.max_damage = item->getMaxDamage();
+        item_type.is_damageable = item->isDamageable();
+        item_type.max_stack_size = item->getMaxStackSize({});
+        item_type.furnace_burn_duration = FurnaceBlockActor::getBurnDuration(*ItemStack::create(*item), 200);
+        item_type.furnace_xp_multiplier = item->getFurnaceXPmultiplier(nullptr);
+        for (const auto &tag : item->getTags()) {
+            item_type.tags.push_back(tag.getString());
+        }
+    }
+
+    CreativeItemRegistry::forEachCreativeItemInstance([&](ItemInstance &item_instance) {
+        CompoundTag tag;
+        tag.putString("name", item_instance.getItem()->getFullItemName());
+        tag.putShort("damage", static_cast<std::int16_t>(item_instance.getAuxValue()));
+
+        if (const auto *user_data = item_instance.getUserData(); user_data) {
+            tag.putCompound("tag", user_data->clone());
+        }
+
+        if (item_instance.isBlock()) {
+            tag.putInt("blockStateHash", static_cast<std::int32_t>(item_instance.getBlock()->getRuntimeId()));
+        }
+        data.creative_items.add(tag.copy());
+        return true;
+    });
+}
+
+void collectRecipes(CollectedData &data, ::Level &level)
+{
+    // The detour returns a stand-in for the cached packet without any entries, the original builds a new one
+    std::unique_ptr<CraftingDataPacket> packet;
+    ENDSTONE_HOOK_CALL_ORIGINAL_RVO(&CraftingDataPacket::prepareFromRecipes, packet, level.getRecipes(), false);
+    auto id_to_name = [&level](int id) {
+        return level.getItemRegistry().getItem(id)->getFullItemName();
+    };
+
+    for (const auto &entry : packet->crafting_entries) {
+        if (entry.entry_type < ShapelessRecipe || entry.entry_type >= COUNT) {
+            throw std::runtime_error("Unknown craft data type");
+        }
+
+        auto &recipe = data.recipes.emplace_back();
+        recipe.type = entry.entry_type;
+        recipe.has_recipe = entry.recipe != nullptr;
+        if (!entry.recipe) {
+            recipe.tag = entry.tag.getString();
+            recipe.input.push_back({id_to_name(entry.item_data), std::nullopt, std::nullopt, auxValue(entry.item_aux)});
+            recipe.output.push_back({entry.item_result.getFullName(), std::nullopt, entry.item_result.getStackSize(),
+                                     auxValue(entry.item_result.getAuxValue())});
+            continue;
+        }
+
+        recipe.id = entry.recipe->getRecipeId();
+        recipe.net_id = entry.recipe->getNetId().raw_id;
+        recipe.uuid = entry.recipe->getId().toEndstone().str();
+        recipe.tag = entry.recipe->getTag().getString();
+        recipe.priority = entry.recipe->getPriority();
+        recipe.width = entry.recipe->getWidth();
+        recipe.height = entry.recipe->getHeight();
+
+        for (const auto &ingredient : entry.recipe->getIngredients()) {
+            auto &input = recipe.input.emplace_back();
+            input.count = ingredient.getStackSize();
+            if (ingredient.impl && ingredient.impl->getType() == ItemDescriptor::InternalType::ItemTag) {
+                input.tag =
+                    static_cast<ItemDescriptor::ItemTagDescriptor *>(ingredient.impl.get())->item_tag.getString();
+            }
+            else {
+                input.item = ingredient.getFullName();
+            }
+            input.data = auxValue(ingredient.getAuxValue());
+        }
+
+        for (const auto &result_item : entry.recipe->getResultItems()) {
+            auto &output = recipe.output.emplace_back();
+            output.item = result_item.getItem()->getFullItemName();
+            output.count = result_item.getCount();
+            output.data = auxValue(result_item.getAuxValue());
+            if (result_item.hasUserData()) {
+                std::string nbt;
+                NbtIo::writeNamedTag("", *result_item.getUserData(), nbt, NbtIo::Encoding::BigEndian);
+                output.nbt = base64_encode(nbt);
+            }
+        }
+    }
+
+    for (const auto &entry : packet->potion_mix_entries) {
+        data.potion_mixes.push_back({
+            {id_to_name(entry.from_item_id), std::nullopt, std::nullopt, entry.from_item_aux},
+            {id_to_name(entry.reagent_item_id), std::nullopt, std::nullopt, entry.reagent_item_aux},
+            {id_to_name(entry.to_item_id), std::nullopt, std::nullopt, entry.to_item_aux},
+        });
+    }
+
+    for (const auto &entry : packet->container_mix_entries) {
+        data.container_mixes.push_back({
+            id_to_name(entry.from_item_id),
+            id_to_name(entry.reagent_item_id),
+            id_to_name(entry.to_item_id),
+        });
+    }
+
+    for (const auto &entry : packet->material_reducer_entries) {
+        auto &reducer = data.material_reducers.emplace_back();
+        reducer.input = entry.from_item_key;
+        for (const auto &item : entry.to_item_ids_and_counts) {
+            reducer.outputs.push_back({id_to_name(item.to_item_id), std::nullopt, item.to_item_count});
+        }
+    }
+}
+
+nlohmann::json toJson(const RecipeItem &item)
+{
+    nlohmann::json json;
+    if (item.count) {
+        json["count"] = *item.count;
+    }
+    if (item.tag) {
+        json["tag"] = *item.tag;
+    }
+    else {
+        json["item"] = item.item;
+    }
+    if (item.data) {
+        json["data"] = *item.data;
+    }
+    if (item.nbt) {
+        json["nbt"] = *item.nbt;
+    }
+    return json;
+}
+
+void convertShapedRecipe(const RecipeEntry &recipe, nlohmann::json &json)
+{
+    auto input = json["input"];
+    json.erase("input");
+    char next_key = 'A';
+    std::unordered_map<std::string, char> ingredient_key;
+    for (int i = 0; i < recipe.height; i++) {
+        std::string pattern;
+        for (int j = 0; j < recipe.width; j++) {
+            const auto &ingredient = input[j + i * recipe.width];
+            if (ingredient["count"] == 0) {
+                pattern.push_back(' ');
+                continue;
+            }
+            auto name_or_tag = ingredient.contains("tag") ? ingredient["tag"] : ingredient["item"];
+            if (ingredient_key.find(name_or_tag) == ingredient_key.end()) {
+                json["input"][std::string{next_key}] = ingredient;
+                ingredient_key[name_or_tag] = next_key++;
+            }
+            pattern.push_back(ingredient_key[name_or_tag]);
+        }
+        json["pattern"].push_back(pattern);
+    }
+    json["width"] = recipe.width;
+    json["height"] = recipe.height;
+}
+
+void convertRecipe(VanillaData &data, const RecipeEntry &entry)
+{
+    nlohmann::json recipe;
+    recipe["tag"] = entry.tag;
+    if (entry.has_recipe) {
+        recipe["id"] = entry.id;
+        recipe["netId"] = entry.net_id;
+        recipe["uuid"] = entry.uuid;
+        recipe["priority"] = entry.priority;
+        for (const auto &input : entry.input) {
+            recipe["input"].push_back(toJson(input));
+        }
+        for (const auto &output : entry.output) {
+            recipe["output"].push_back(toJson(output));
+        }
+    }
+    else {
+        recipe["input"] = toJson(entry.input.front());
+        recipe["output"] = toJson(entry.output.front());
+    }
+
+    switch (entry.type) {
+    case ShapelessRecipe:
+        data.recipes.shapeless.push_back(recipe);
+        break;
+    case ShapedRecipe:
+        convertShapedRecipe(entry, recipe);
+        data.recipes.shaped.push_back(recipe);
+        break;
+    case FurnaceRecipe:
+        data.recipes.furnace.push_back(recipe);
+        break;
+    case FurnaceAuxRecipe:
+        data.recipes.furnace_aux.push_back(recipe);
+        break;
+    case MultiRecipe:
+        data.recipes.multi.push_back(recipe);
+        break;
+    case ShulkerBoxRecipe:
+        data.recipes.shulker_box.push_back(recipe);
+        break;
+    case ShapelessChemistryRecipe:
+        data.recipes.shapeless_chemistry.push_back(recipe);
+        break;
+    case ShapedChemistryRecipe:
+        convertShapedRecipe(entry, recipe);
+        data.recipes.shaped_chemistry.push_back(recipe);
+        break;
+    case SmithingTransformRecipe:
+    case SmithingTrimRecipe: {
+        recipe["template"] = recipe["input"][0];
+        recipe["base"] = recipe["input"][1];
+        recipe["addition"] = recipe["input"][2];
+        recipe.erase("input");
+        auto &recipes = entry.type == SmithingTransformRecipe ? data.recipes.smithing_transform
+                                                               : data.recipes.smithing_trim;
+        recipes.push_back(recipe);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+/**
+ * Converts the collected values to JSON on the DevTools thread, a slice of entries per frame.
+ */
+class Converter {
+public:
+    explicit Converter(std::shared_ptr<CollectedData> collected) : collected_(std::move(collected))
+    {
+        auto &data = data_;
+        for (const auto &material : collected_->materials) {
+            jobs_.emplace_back([&data, &material]() {
+                data.materials[material.name] = {
+                    {"isNeverBuildable", material.is_never_buildable},
+                    {"isAlwaysDestroyable", material.is_always_destroyable},
+                    {"isLiquid", material.is_liquid},
+                    {"translucency", material.translucency},
+                    {"blocksMotion", material.blocks_motion},
+                    {"blocksPrecipitation", material.blocks_precipitation},
+                    {"isSolid", material.is_solid},
+                    {"isSuperHot", material.is_super_hot},
+                    {"isSolidBlocking", material.is_solid_blocking},
+                };
+            });
+        }
+        for (const auto &block_type : collected_->block_types) {
+            jobs_.emplace_back([&data, &block_type]() {
+                auto &json = data.block_types[block_type.name];
+                json = {{"material", block_type.material}};
+                for (const auto &tag : block_type.tags) {
+                    json["tags"].push_back(tag);
+                    data.block_tags[tag].push_back(block_type.name);
+                }
+                for (const auto &tool : block_type.special_tools) {
+                    json["specialTools"].push_back(tool);
+                }
+            });
+        }
+        for (const auto &state : collected_->block_states) {
+            jobs_.emplace_back([&data, &state]() {
+                data.block_states.push_back({
+                    {"name", state.name},
+                    {"blockStateHash", state.runtime_id},
+                    {"burnOdds", state.burn_odds},
+                    {"flameOdds", state.flame_odds},
+                    {"thickness", state.thickness},
+                    {"light", state.light},
+                    {"lightEmission", state.light_emission},
+                    {"explosionResistance", state.explosion_resistance},
+                    {"friction", state.friction},
+                    {"hardness", state.hardness},
+                    {"canContainLiquid", state.can_contain_liquid},
+                    {"mapColor", state.map_color},
+                    {"collisionShape", state.collision_shape},
+                });
+            });
+        }
+        for (const auto &item : collected_->items) {
+            jobs_.emplace_back([&data, &item]() {
+                auto &json = data.items[item.name];
+                json = {{"id", item.id},
+                        {"attackDamage", item.attack_damage},
+                        {"armorValue", item.armor_value},
+                        {"toughnessValue", item.toughness_value},
+                        {"maxDamage", item.max_damage},
+                        {"isDamageable", item.is_damageable},
+                        {"maxStackSize", item.max_stack_size},
+                        {"furnaceBurnDuration", item.furnace_burn_duration},
+                        {"furnaceXPMultiplier", item.furnace_xp_multiplier}};
+                for (const auto &tag : item.tags) {
+                    json["tags"].push_back(tag);
+                    data.item_tags[tag].push_back(item.name);
+                }
+            });
+        }
+        for (const auto &recipe : collected_->recipes) {
+            jobs_.emplace_back([&data, &recipe]() { convertRecipe(data, recipe); });
+        }
+        for (const auto &mix : collected_->potion_mixes) {
+            jobs_.emplace_back([&data, &mix]() {
+                data.recipes.potion_mixes.push_back({
+                    {"input", toJson(mix.input)},
+                    {"reagent", toJson(mix.reagent)},
+                    {"output", toJson(mix.output)},
+                });
+            });
+        }
+        for (const auto &mix : collected_->container_mixes) {
+            jobs_.emplace_back([&data, &mix]() {
+                data.recipes.container_mixes.push_back({
+                    {"input", mix.input},
+                    {"reagent", mix.reagent},
+                    {"output", mix.output},
+                });
+            });
+        }
+        for (const auto &reducer : collected_->material_reducers) {
+            jobs_.emplace_back([&data, &reducer]() {
+                nlohmann::json json = {
+                    {"input", reducer.input},
+                    {"outputs", {}},
+                };
+                for (const auto &output : reducer.outputs) {
+                    json["outputs"].push_back({{"item", output.item}, {"count", *output.count}});
+                }
+                data.recipes.material_reducer.push_back(json);
+            });
+        }
+    }
+
+    /**
+     * Converts entries until the budget is used up.
+     *
+     * @return true once every entry has been converted
+     */
+    bool step(std::chrono::nanoseconds budget)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + budget;
+        while (next_ < jobs_.size()) {
+            jobs_[next_++]();
+            if (std::chrono::steady_clock::now() >= deadline) {
+                break;
+            }
+        }
+        return next_ == jobs_.size();
+    }
+
+    VanillaData build()
+    {
+        while (next_ < jobs_.size()) {
+            jobs_[next_++]();
+        }
+        return take();
+    }
+
+    VanillaData take()
+    {
+        data_.block_palette = std::move(collected_->block_palette);
+        data_.creative_items = std::move(collected_->creative_items);
+        return std::move(data_);
+    }
+
+private:
+    std::shared_ptr<CollectedData> collected_;
+    VanillaData data_;
+    std::vector<std::function<void()>> jobs_;
+    std::size_t next_ = 0;
+};
+
+class CompressedFile {
+public:
+    explicit CompressedFile(const std::filesystem::path &path)
+        : path_(path.string()), file_(gzopen(path_.c_str(), "wb"))
+    {
+        if (!file_) {
+            throw std::runtime_error(fmt::format("Unable to create {}", path_));
+        }
+    }
+
+    CompressedFile(const CompressedFile &) = delete;
+    CompressedFile &operator=(const CompressedFile &) = delete;
+
+    ~CompressedFile()
+    {
+        if (file_) {
+            gzclose(file_);
+        }
+    }
+
+    void write(std::string_view bytes)
+    {
+        if (!bytes.empty() &&
+            gzwrite(file_, bytes.data(), static_cast<unsigned>(bytes.size())) != static_cast<int>(bytes.size())) {
+            throw std::runtime_error(fmt::format("Unable to write {}", path_));
+        }
+    }
+
+    void close()
+    {
+        auto result = gzclose(file_);
+        file_ = nullptr;
+        if (result != Z_OK) {
+            throw std::runtime_error(fmt::format("Unable to write {}", path_));
+        }
+    }
+
+private:
+    std::string path_;
+    gzFile file_;
+};
+
+void dumpJson(const std::filesystem::path &path, const nlohmann::json &json, VanillaData::Format format)
+{
+    CompressedFile file{path};
+    if (format == VanillaData::Format::MessagePack) {
+        auto bytes = nlohmann::json::to_msgpack(json);
+        file.write({reinterpret_cast<const char *>(bytes.data()), bytes.size()});
+        file.close();
+        return;
+    }
+
+    // One top-level entry at a time, the tables are never held as a single string
+    if (!json.is_structured()) {
+        file.write(json.dump());
+        file.close();
+        return;
+    }
+    file.write(json.is_array() ? "[" : "{");
+    for (auto it = json.cbegin(); it != json.cend(); ++it) {
+        if (it != json.cbegin()) {
+            file.write(",");
+        }
+        if (json.is_object()) {
+            file.write(nlohmann::json(it.key()).dump());
+            file.write(":");
+        }
+        file.write(it.value().dump());
+    }
+    file.write(json.is_array() ? "]" : "}");
+    file.close();
+}
+
+void dumpNbt(const std::filesystem::path &path, const std::string &name, const ::ListTag &list)
+{
+    CompoundTag tag;
+    tag.put(name, list.copy());
+    std::string nbt;
+    NbtIo::writeNamedTag("", tag, nbt, NbtIo::Encoding::BigEndian);
+    CompressedFile file{path};
+    file.write(nbt);
+    file.close();
+}
+
+}  // namespace
+
+nlohmann::json VanillaData::getRecipes() const
+{
+    return {
+        {"shapeless", recipes.shapeless},
+        {"shaped", recipes.shaped},
+        {"furnace", recipes.furnace},
+        {"furnaceAux", recipes.furnace_aux},
+        {"multi", recipes.multi},
+        {"shulkerBox", recipes.shulker_box},
+        {"shapelessChemistry", recipes.shapeless_chemistry},
+        {"shapedChemistry", recipes.shaped_chemistry},
+        {"smithingTransform", recipes.smithing_transform},
+        {"smithingTrim", recipes.smithing_trim},
+        {"potionMixes", recipes.potion_mixes},
+        {"containerMixes", recipes.container_mixes},
+        {"materialReducer", recipes.material_reducer},
+    };
+}
+
+void VanillaData::dump(const std::filesystem::path &directory, Format format) const
+{
+    std::filesystem::create_directories(directory);
+    const auto *extension = format == Format::Json ? ".json.gz" : ".msgpack.gz";
+    auto path = [&](const char *name) {
+        return directory / (std::string(name) + extension);
+    };
+    dumpJson(path("block_types"), block_types, format);
+    dumpJson(path("block_states"), block_states, format);
+    dumpJson(path("block_tags"), block_tags, format);
+    dumpJson(path("materials"), materials, format);
+    dumpJson(path("items"), items, format);
+    dumpJson(path("item_tags"), item_tags, format);
+    dumpJson(path("recipes"), getRecipes(), format);
+    dumpNbt(directory / "block_palette.nbt", "blocks", block_palette);
+    dumpNbt(directory / "creative_items.nbt", "items", creative_items);
+}
+
+std::function<VanillaData()> VanillaData::collect(::Level &level)
+{
+    auto data = std::make_shared<CollectedData>();
+    collectBlockData(*data, level);
+    collectItemData(*data, level);
+    collectRecipes(*data, level);
+    return [data]() { return Converter{data}.build(); };
+}
+
+VanillaData *VanillaData::get()
+{
+    // Only the DevTools thread calls this, the collected data is the one thing the server thread hands over
+    static constexpr std::chrono::milliseconds FrameBudget{4};
+    static std::atomic<bool> should_run = true;
+    static std::mutex mutex;
+    static std::shared_ptr<CollectedData> collected;
+    static std::unique_ptr<Converter> converter;
+    static bool ready = false;
+
+    if (ready) {
+        return &entt::locator<VanillaData>::value();
+    }
+
+    if (converter) {
+        if (converter->step(FrameBudget)) {
+            entt::locator<VanillaData>::emplace(converter->take());
+            converter.reset();
+            ready = true;
+            return &entt::locator<VanillaData>::value();
+        }
+        return nullptr;
+    }
+
+    {
+        std::lock_guard lock{mutex};
+        if (collected) {
+            converter = std::make_unique<Converter>(std::move(collected));
+            return nullptr;
+        }
+    }
+
+    if (entt::locator<EndstoneServer>::has_value()) {
+        auto &server = entt::locator<EndstoneServer>::value();
+        if (auto *server_level = server.getLevel(); server_level) {
+            auto &level = static_cast<EndstoneLevel *>(server_level)->getHandle();
+            auto &scheduler = static_cast<EndstoneScheduler &>(server.getScheduler());
+            if (should_run) {
+                scheduler.runTask([&level]() {
+                    // run on the server thread instead of UI thread
+                    auto data = std::make_shared<CollectedData>();
+                    collectBlockData(*data, level);
+                    collectItemData(*data, level);
+                    collectRecipes(*data, level);
+                    std::lock_guard lock{mutex};
+                    collected = std::move(data);
+                });
+                should_run = false;
+            }
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace endstone::detail::devtools
@@ -14,8 +14,10 @@
 
 #include "endstone/detail/form/form_codec.h"
 
+#include <string>
+#include <vector>
+
 #include <entt/entt.hpp>
-#include <nlohmann/json.hpp>
 
 #include "endstone/form/action_form.h"
 #include "endstone/form/controls/dropdown.h"
@@ -30,177 +32,229 @@
 
 namespace endstone::detail {
 
+namespace {
+void writeImage(JsonWriter &writer, const std::string &icon)
+{
+    writer.beginObject();
+    writer.key("type");
+    writer.value(icon.rfind("http://", 0) == 0 || icon.rfind("https://", 0) == 0 ? "url" : "path");
+    writer.key("data");
+    writer.value(icon);
+    writer.endObject();
+}
+
+void writeStrings(JsonWriter &writer, const std::vector<std::string> &values)
+{
+    writer.beginArray();
+    for (const auto &value : values) {
+        writer.value(value);
+    }
+    writer.endArray();
+}
+}  // namespace
+
 template <>
-nlohmann::json FormCodec::toJson(const Message &message)
+void FormCodec::write(JsonWriter &writer, const Message &message)
 {
-    return std::visit(entt::overloaded{[&](const std::string &arg) -> nlohmann::json {
-                                           nlohmann::json json;
-                                           json["rawtext"].push_back({
-                                               {"text", arg},
-                                           });
-                                           return json;
-                                       },
-                                       [&](const Translatable &arg) -> nlohmann::json {
-                                           nlohmann::json json;
-                                           json["rawtext"].push_back({
-                                               {"translate", arg.getTranslationKey()},
-                                               {"with", arg.getParameters()},
-                                           });
-                                           return json;
-                                       }},
-                      message);
+    writer.beginObject();
+    writer.key("rawtext");
+    writer.beginArray();
+    writer.beginObject();
+    std::visit(entt::overloaded{[&](const std::string &arg) {
+                                    writer.key("text");
+                                    writer.value(arg);
+                                },
+                                [&](const Translatable &arg) {
+                                    writer.key("translate");
+                                    writer.value(arg.getTranslationKey());
+                                    writer.key("with");
+                                    writeStrings(writer, arg.getParameters());
+                                }},
+               message);
+    writer.endObject();
+    writer.endArray();
+    writer.endObject();
 }
 
 /**
  * Controls
  */
 template <>
-nlohmann::json FormCodec::toJson(const Label &label)
+void FormCodec::write(JsonWriter &writer, const Label &label)
 {
-    nlohmann::json json;
-    json["type"] = "label";
-    json["text"] = toJson(label.getText());
-    return json;
+    writer.beginObject();
+    writer.key("type");
+    writer.value("label");
+    writer.key("text");
+    write(writer, label.getText());
+    writer.endObject();
 }
 
 template <>
-nlohmann::json FormCodec::toJson(const Dropdown &dropdown)
+void FormCodec::write(JsonWriter &writer, const Dropdown &dropdown)
 {
-    nlohmann::json json;
-    json["type"] = "dropdown";
-    json["text"] = toJson(dropdown.getLabel());
-    json["options"] = dropdown.getOptions();
+    writer.beginObject();
+    writer.key("type");
+    writer.value("dropdown");
+    writer.key("text");
+    write(writer, dropdown.getLabel());
+    writer.key("options");
+    writeStrings(writer, dropdown.getOptions());
     if (auto default_index = dropdown.getDefaultIndex()) {
-        json["default"] = default_index.value();
+        writer.key("default");
+        writer.value(default_index.value());
     }
-    return json;
+    writer.endObject();
 }
 
 template <>
-nlohmann::json FormCodec::toJson(const Slider &slider)
+void FormCodec::write(JsonWriter &writer, const Slider &slider)
 {
-    nlohmann::json json;
-    json["type"] = "slider";
-    json["text"] = toJson(slider.getLabel());
-    json["min"] = slider.getMin();
-    json["max"] = slider.getMax();
-    json["step"] = slider.getStep();
+    writer.beginObject();
+    writer.key("type");
+    writer.value("slider");
+    writer.key("text");
+    write(writer, slider.getLabel());
+    writer.key("min");
+    writer.value(slider.getMin());
+    writer.key("max");
+    writer.value(slider.getMax());
+    writer.key("step");
+    writer.value(slider.getStep());
     if (auto default_value = slider.getDefaultValue()) {
-        json["default"] = default_value.value();
+        writer.key("default");
+        writer.value(default_value.value());
     }
-    return json;
+    writer.endObject();
 }
 
 template <>
-nlohmann::json FormCodec::toJson(const StepSlider &slider)
+void FormCodec::write(JsonWriter &writer, const StepSlider &slider)
 {
-    nlohmann::json json;
-    json["type"] = "step_slider";
-    json["text"] = toJson(slider.getLabel());
-    json["steps"] = slider.getOptions();
+    writer.beginObject();
+    writer.key("type");
+    writer.value("step_slider");
+    writer.key("text");
+    write(writer, slider.getLabel());
+    writer.key("steps");
+    writeStrings(writer, slider.getOptions());
     if (auto default_index = slider.getDefaultIndex()) {
-        json["default"] = default_index.value();
+        writer.key("default");
+        writer.value(default_index.value());
     }
-    return json;
+    writer.endObject();
 }
 
 template <>
-nlohmann::json FormCodec::toJson(const TextInput &input)
+void FormCodec::write(JsonWriter &writer, const TextInput &input)
 {
-    nlohmann::json json;
-    json["type"] = "input";
-    json["text"] = toJson(input.getLabel());
-    json["placeholder"] = toJson(input.getPlaceholder());
+    writer.beginObject();
+    writer.key("type");
+    writer.value("input");
+    writer.key("text");
+    write(writer, input.getLabel());
+    writer.key("placeholder");
+    write(writer, input.getPlaceholder());
     if (auto default_value = input.getDefaultValue()) {
-        json["default"] = default_value.value();
+        writer.key("default");
+        writer.value(default_value.value());
     }
-    return json;
+    writer.endObject();
 }
 
 template <>
-nlohmann::json FormCodec::toJson(const Toggle &toggle)
+void FormCodec::write(JsonWriter &writer, const Toggle &toggle)
 {
-    nlohmann::json json;
-    json["type"] = "toggle";
-    json["text"] = toJson(toggle.getLabel());
-    json["default"] = toggle.getDefaultValue();
-    return json;
+    writer.beginObject();
+    writer.key("type");
+    writer.value("toggle");
+    writer.key("text");
+    write(writer, toggle.getLabel());
+    writer.key("default");
+    writer.value(toggle.getDefaultValue());
+    writer.endObject();
 }
 
 /**
  * Forms
  */
 template <>
-nlohmann::json FormCodec::toJson(const MessageForm &form)
+void FormCodec::write(JsonWriter &writer, const MessageForm &form)
 {
-    nlohmann::json json;
-    json["type"] = "modal";
-    json["title"] = toJson(form.getTitle());
-    json["content"] = toJson(form.getContent());
-    json["button1"] = toJson(form.getButton1());
-    json["button2"] = toJson(form.getButton2());
-    return json;
+    writer.beginObject();
+    writer.key("type");
+    writer.value("modal");
+    writer.key("title");
+    write(writer, form.getTitle());
+    writer.key("content");
+    write(writer, form.getContent());
+    writer.key("button1");
+    write(writer, form.getButton1());
+    writer.key("button2");
+    write(writer, form.getButton2());
+    writer.endObject();
 }
 
 template <>
-nlohmann::json FormCodec::toJson(const ActionForm::Button &button)
+void FormCodec::write(JsonWriter &writer, const ActionForm::Button &button)
 {
-    nlohmann::json json;
-    json["text"] = toJson(button.getText());
+    writer.beginObject();
+    writer.key("text");
+    write(writer, button.getText());
     if (auto icon = button.getIcon(); icon.has_value()) {
-        if (icon.value().rfind("http://", 0) == 0 || icon.value().rfind("https://", 0) == 0) {
-            json["image"]["type"] = "url";
-        }
-        else {
-            json["image"]["type"] = "path";
-        }
-        json["image"]["data"] = icon.value();
+        writer.key("image");
+        writeImage(writer, icon.value());
     }
-    return json;
+    writer.endObject();
 }
 
 template <>
-nlohmann::json FormCodec::toJson(const ActionForm &form)
+void FormCodec::write(JsonWriter &writer, const ActionForm &form)
 {
-    nlohmann::json json;
-    json["type"] = "form";
-    json["title"] = toJson(form.getTitle());
-    json["content"] = toJson(form.getContent());
-    json["buttons"] = nlohmann::json::array();
+    writer.beginObject();
+    writer.key("type");
+    writer.value("form");
+    writer.key("title");
+    write(writer, form.getTitle());
+    writer.key("content");
+    write(writer, form.getContent());
+    writer.key("buttons");
+    writer.beginArray();
     for (const auto &button : form.getButtons()) {
-        json["buttons"].push_back(toJson(button));
+        write(writer, button);
     }
-    return json;
+    writer.endArray();
+    writer.endObject();
 }
 
 template <>
-nlohmann::json FormCodec::toJson(const ModalForm &form)
+void FormCodec::write(JsonWriter &writer, const ModalForm &form)
 {
-    nlohmann::json json;
-    json["type"] = "custom_form";
-    json["title"] = toJson(form.getTitle());
-    json["content"] = nlohmann::json::array();
+    writer.beginObject();
+    writer.key("type");
+    writer.value("custom_form");
+    writer.key("title");
+    write(writer, form.getTitle());
+    writer.key("content");
+    writer.beginArray();
     for (const auto &control : form.getControls()) {
-        json["content"].push_back(std::visit(entt::overloaded{[](auto &&arg) {
-                                                 return toJson(arg);
-                                             }},
-                                             control));
+        std::visit(entt::overloaded{[&](auto &&arg) {
+                       write(writer, arg);
+                   }},
+                   control);
     }
+    writer.endArray();
 
     if (auto submit_button = form.getSubmitButton(); submit_button.has_value()) {
-        json["submit"] = toJson(submit_button.value());
+        writer.key("submit");
+        write(writer, submit_button.value());
     }
 
     if (auto icon = form.getIcon(); icon.has_value()) {
-        if (icon.value().rfind("http://", 0) == 0 || icon.value().rfind("https://", 0) == 0) {
-            json["icon"]["type"] = "url";
-        }
-        else {
-            json["icon"]["type"] = "path";
-        }
-        json["icon"]["data"] = icon.value();
+        writer.key("icon");
+        writeImage(writer, icon.value());
     }
-    return json;
+    writer.endObject();
 }
 
 }  // namespace endstone::detail
@@ -0,0 +1,90 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/form/form_response.h"
+
+#include <stdexcept>
+
+namespace endstone::detail {
+
+bool FormResponse::asBool() const
+{
+    if (value_.type() != Json::booleanValue) {
+        throw std::runtime_error("Form response is not a boolean");
+    }
+    return value_.asBool();
+}
+
+int FormResponse::asInt() const
+{
+    switch (value_.type()) {
+    case Json::intValue:
+    case Json::uintValue:
+    case Json::realValue:
+        return value_.asInt();
+    default:
+        throw std::runtime_error("Form response is not a number");
+    }
+}
+
+std::string FormResponse::dump() const
+{
+    std::string json;
+    JsonWriter writer(json);
+    write(writer, value_);
+    return json;
+}
+
+void FormResponse::write(JsonWriter &writer, const Json::Value &value)
+{
+    switch (value.type()) {
+    case Json::nullValue:
+        writer.null();
+        break;
+    case Json::intValue:
+        writer.value(value.asInt64());
+        break;
+    case Json::uintValue:
+        writer.value(value.asUInt64());
+        break;
+    case Json::realValue:
+        writer.value(value.asDouble());
+        break;
+    case Json::stringValue:
+        writer.value(value.asStringView());
+        break;
+    case Json::booleanValue:
+        writer.value(value.asBool());
+        break;
+    case Json::arrayValue:
+        writer.beginArray();
+        for (int i = 0; i < value.size(); i++) {
+            write(writer, value[i]);
+        }
+        writer.endArray();
+        break;
+    case Json::objectValue:
+        writer.beginObject();
+        value.forEachMember([&](std::string_view key, const Json::Value &member) {
+            writer.key(key);
+            write(writer, member);
+        });
+        writer.endObject();
+        break;
+    default:
+        throw std::runtime_error("Unexpected type of Json::Value");
+    }
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,177 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/form/json_writer.h"
+
+#include <cmath>
+#include <iterator>
+
+#include <fmt/format.h>
+
+namespace endstone::detail {
+
+void JsonWriter::beginObject()
+{
+    separate();
+    out_.push_back('{');
+    need_comma_ = false;
+}
+
+void JsonWriter::endObject()
+{
+    out_.push_back('}');
+    need_comma_ = true;
+}
+
+void JsonWriter::beginArray()
+{
+    separate();
+    out_.push_back('[');
+    need_comma_ = false;
+}
+
+void JsonWriter::endArray()
+{
+    out_.push_back(']');
+    need_comma_ = true;
+}
+
+void JsonWriter::key(std::string_view key)
+{
+    separate();
+    appendString(key);
+    out_.push_back(':');
+    need_comma_ = false;
+}
+
+void JsonWriter::value(std::string_view value)
+{
+    separate();
+    appendString(value);
+    need_comma_ = true;
+}
+
+void JsonWriter::value(const char *value)
+{
+    this->value(std::string_view(value));
+}
+
+void JsonWriter::value(bool value)
+{
+    separate();
+    out_.append(value ? "true" : "false");
+    need_comma_ = true;
+}
+
+void JsonWriter::value(int value)
+{
+    separate();
+    fmt::format_to(std::back_inserter(out_), "{}", value);
+    need_comma_ = true;
+}
+
+void JsonWriter::value(std::int64_t value)
+{
+    separate();
+    fmt::format_to(std::back_inserter(out_), "{}", value);
+    need_comma_ = true;
+}
+
+void JsonWriter::value(std::uint64_t value)
+{
+    separate();
+    fmt::format_to(std::back_inserter(out_), "{}", value);
+    need_comma_ = true;
+}
+
+void JsonWriter::value(float value)
+{
+    separate();
+    appendReal(value);
+    need_comma_ = true;
+}
+
+void JsonWriter::value(double value)
+{
+    separate();
+    appendReal(value);
+    need_comma_ = true;
+}
+
+void JsonWriter::null()
+{
+    separate();
+    out_.append("null");
+    need_comma_ = true;
+}
+
+void JsonWriter::separate()
+{
+    if (need_comma_) {
+        out_.push_back(',');
+    }
+}
+
+void JsonWriter::appendString(std::string_view value)
+{
+    // Copies runs of characters that need no escaping in one go
+    out_.push_back('"');
+    std::size_t start = 0;
+    for (std::size_t i = 0; i < value.size(); i++) {
+        auto c = static_cast<unsigned char>(value[i]);
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;
+        }
+
+        out_.append(value.data() + start, i - start);
+        if (c == '"' || c == '\\') {
+            out_.push_back('\\');
+            out_.push_back(static_cast<char>(c));
+        }
+        else if (c == '\n') {
+            out_.append("\\n");
+        }
+        else if (c == '\r') {
+            out_.append("\\r");
+        }
+        else if (c == '\t') {
+            out_.append("\\t");
+        }
+        else {
+            fmt::format_to(std::back_inserter(out_), "\\u{:04x}", c);
+        }
+        start = i + 1;
+    }
+    out_.append(value.data() + start, value.size() - start);
+    out_.push_back('"');
+}
+
+template <typename T>
+void JsonWriter::appendReal(T value)
+{
+    if (!std::isfinite(value)) {
+        out_.append("null");
+        return;
+    }
+
+    // Floats are formatted as such, the shortest representation of a widened double is often longer. Integral values
+    // keep a fraction, so they are read back as real numbers.
+    auto start = out_.size();
+    fmt::format_to(std::back_inserter(out_), "{}", value);
+    if (out_.find_first_of(".e", start) == std::string::npos) {
+        out_.append(".0");
+    }
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,109 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/hook_timings.h"
+
+#include <algorithm>
+#include <mutex>
+
+namespace endstone::detail {
+
+void HookTimings::Stats::record(std::chrono::nanoseconds elapsed)
+{
+    auto value = static_cast<std::uint64_t>(std::max<std::int64_t>(elapsed.count(), 0));
+    count_.fetch_add(1, std::memory_order_relaxed);
+    total_.fetch_add(value, std::memory_order_relaxed);
+    auto max = max_.load(std::memory_order_relaxed);
+    while (value > max && !max_.compare_exchange_weak(max, value, std::memory_order_relaxed)) {}
+    histogram_.record(value);
+}
+
+void HookTimings::Stats::reset()
+{
+    count_.store(0, std::memory_order_relaxed);
+    total_.store(0, std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+    histogram_.reset();
+}
+
+HookTimings &HookTimings::getInstance()
+{
+    static HookTimings instance;
+    return instance;
+}
+
+void HookTimings::setEnabled(bool enabled)
+{
+    enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+HookTimings::Entry &HookTimings::getEntry(const std::string &name)
+{
+    {
+        std::shared_lock lock(mutex_);
+        if (auto it = entries_.find(name); it != entries_.end()) {
+            return *it->second;
+        }
+    }
+
+    std::unique_lock lock(mutex_);
+    auto &entry = entries_[name];
+    if (!entry) {
+        entry = std::make_unique<Entry>();
+        entry->name = name;
+    }
+    return *entry;
+}
+
+std::vector<HookTiming> HookTimings::getTimings() const
+{
+    std::shared_lock lock(mutex_);
+    std::vector<HookTiming> timings;
+    timings.reserve(entries_.size());
+    for (const auto &[name, entry] : entries_) {
+        const auto &detour = entry->detour;
+        const auto &original = entry->original;
+        auto detour_count = detour.count_.load(std::memory_order_relaxed);
+        auto original_count = original.count_.load(std::memory_order_relaxed);
+        if (detour_count == 0 && original_count == 0) {
+            continue;
+        }
+        auto detour_max = detour.max_.load(std::memory_order_relaxed);
+        auto original_max = original.max_.load(std::memory_order_relaxed);
+        timings.push_back({
+            name,
+            detour_count,
+            std::chrono::nanoseconds(detour.total_.load(std::memory_order_relaxed)),
+            std::chrono::nanoseconds(detour_max),
+            std::chrono::nanoseconds(std::min(detour.histogram_.getPercentile(0.99, detour_count), detour_max)),
+            original_count,
+            std::chrono::nanoseconds(original.total_.load(std::memory_order_relaxed)),
+            std::chrono::nanoseconds(original_max),
+            std::chrono::nanoseconds(std::min(original.histogram_.getPercentile(0.99, original_count), original_max)),
+        });
+    }
+    return timings;
+}
+
+void HookTimings::reset()
+{
+    // Entries are referenced by their call sites, so they are cleared instead of removed
+    std::shared_lock lock(mutex_);
+    for (const auto &[name, entry] : entries_) {
+        entry->detour.reset();
+        entry->original.reset();
+    }
+}
+
+}  // namespace endstone::detail
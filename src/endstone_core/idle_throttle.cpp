@@ -0,0 +1,59 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/idle_throttle.h"
+
+namespace endstone::detail {
+
+IdleThrottle::IdleThrottle(std::uint32_t interval, std::uint64_t idle_after)
+    : interval_(interval), idle_after_(idle_after)
+{
+}
+
+bool IdleThrottle::tick(std::size_t players)
+{
+    if (interval_ <= 1) {
+        return true;
+    }
+
+    if (players > 0) {
+        empty_ticks_ = 0;
+        idle_ = false;
+        return true;
+    }
+
+    // The first idle tick runs the level, then one in every interval
+    const auto ticks = empty_ticks_++;
+    if (ticks < idle_after_) {
+        return true;
+    }
+    idle_ = true;
+    if ((ticks - idle_after_) % interval_ == 0) {
+        return true;
+    }
+    ++skipped_ticks_;
+    return false;
+}
+
+bool IdleThrottle::isIdle() const
+{
+    return idle_;
+}
+
+std::uint64_t IdleThrottle::getSkippedTicks() const
+{
+    return skipped_ticks_;
+}
+
+}  // namespace endstone::detail
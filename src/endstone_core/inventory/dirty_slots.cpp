@@ -0,0 +1,79 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/inventory/dirty_slots.h"
+
+#include <algorithm>
+
+namespace endstone::detail {
+
+void DirtySlots::mark(int slot)
+{
+    if (slot < 0) {
+        return;
+    }
+    set(pending_, slot);
+    has_pending_ = true;
+}
+
+void DirtySlots::advance()
+{
+    // Nothing to clear on the quiet ticks, which are most of them
+    if (!has_pending_ && changed_.empty()) {
+        return;
+    }
+    changed_.swap(pending_);
+    std::fill(pending_.begin(), pending_.end(), 0);
+    has_pending_ = false;
+
+    auto last = std::find_if(changed_.rbegin(), changed_.rend(), [](auto word) { return word != 0; });
+    changed_.erase(last.base(), changed_.end());
+}
+
+std::vector<int> DirtySlots::getChanged() const
+{
+    std::vector<int> slots;
+    for (std::size_t i = 0; i < changed_.size(); i++) {
+        for (auto word = changed_[i]; word != 0; word &= word - 1) {
+            auto bit = 0;
+            while (((word >> bit) & 1) == 0) {
+                bit++;
+            }
+            slots.push_back(static_cast<int>(i * 64) + bit);
+        }
+    }
+    return slots;
+}
+
+bool DirtySlots::isChanged(int slot) const
+{
+    return slot >= 0 && test(changed_, slot);
+}
+
+void DirtySlots::set(std::vector<std::uint64_t> &bits, int slot)
+{
+    auto index = static_cast<std::size_t>(slot) / 64;
+    if (index >= bits.size()) {
+        bits.resize(index + 1, 0);
+    }
+    bits[index] |= std::uint64_t{1} << (slot % 64);
+}
+
+bool DirtySlots::test(const std::vector<std::uint64_t> &bits, int slot)
+{
+    auto index = static_cast<std::size_t>(slot) / 64;
+    return index < bits.size() && ((bits[index] >> (slot % 64)) & 1) != 0;
+}
+
+}  // namespace endstone::detail
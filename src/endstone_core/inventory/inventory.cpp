@@ -14,6 +14,8 @@
 
 #include "endstone/detail/inventory/inventory.h"
 
+#include "endstone/detail/inventory/item_stack.h"
+
 namespace endstone::detail {
 
 EndstoneInventory::EndstoneInventory(Container &container) : container_(container) {}
@@ -28,4 +30,23 @@ int EndstoneInventory::getMaxStackSize() const
     return container_.getMaxStackSize();
 }
 
+ItemStackView EndstoneInventory::getItem(int index) const
+{
+    if (index < 0 || index >= container_.getContainerSize()) {
+        return {};
+    }
+    return EndstoneItemStack::toView(container_.getItem(index));
+}
+
+std::vector<ItemStackView> EndstoneInventory::getContents() const
+{
+    auto size = container_.getContainerSize();
+    std::vector<ItemStackView> contents;
+    contents.reserve(size);
+    for (auto i = 0; i < size; i++) {
+        contents.push_back(EndstoneItemStack::toView(container_.getItem(i)));
+    }
+    return contents;
+}
+
 }  // namespace endstone::detail
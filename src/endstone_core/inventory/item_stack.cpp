@@ -18,7 +18,7 @@ namespace endstone::detail {
 
 std::string EndstoneItemStack::getType() const
 {
-    return handle_ != nullptr ? handle_->getItem()->getFullItemName() : "minecraft:air";
+    return std::string(view().getType());
 }
 
 void EndstoneItemStack::setType(std::string type)
@@ -51,6 +51,21 @@ void EndstoneItemStack::setAmount(int amount)
     handle_->set(count);
 }
 
+ItemStackView EndstoneItemStack::view() const
+{
+    return handle_ != nullptr ? toView(*handle_) : ItemStackView{};
+}
+
+ItemStackView EndstoneItemStack::toView(const ::ItemStack &item)
+{
+    // The name is owned by the item registry, so the view stays valid after the stack changes or goes away
+    const auto *type = item.getItem();
+    if (type == nullptr) {
+        return {};
+    }
+    return {type->getFullItemName(), item.getCount()};
+}
+
 void EndstoneItemStack::reset()
 {
     handle_ = nullptr;
@@ -0,0 +1,48 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/inventory/player_inventory.h"
+
+namespace endstone::detail {
+
+EndstonePlayerInventory::EndstonePlayerInventory(::Container &container) : EndstoneInventory(container)
+{
+    container_.addContentChangeListener(this);
+    observing_ = true;
+}
+
+std::vector<int> EndstonePlayerInventory::getChangedSlots() const
+{
+    return dirty_slots_.getChanged();
+}
+
+void EndstonePlayerInventory::containerContentChanged(int slot)
+{
+    dirty_slots_.mark(slot);
+}
+
+void EndstonePlayerInventory::tick()
+{
+    dirty_slots_.advance();
+}
+
+void EndstonePlayerInventory::close()
+{
+    if (observing_) {
+        container_.removeContentChangeListener(this);
+        observing_ = false;
+    }
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,73 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/join_storm.h"
+
+namespace endstone::detail {
+
+JoinStorm::JoinStorm(std::size_t threshold, std::uint64_t window_ticks)
+    : threshold_(threshold), window_ticks_(window_ticks)
+{
+}
+
+bool JoinStorm::onJoin(std::uint64_t current_tick)
+{
+    expire(current_tick);
+    joins_.push_back(current_tick);
+    if (active_) {
+        join_count_++;
+        return false;
+    }
+    if (joins_.size() < threshold_) {
+        return false;
+    }
+    active_ = true;
+    join_count_ = joins_.size();
+    start_tick_ = joins_.front();
+    return true;
+}
+
+bool JoinStorm::tick(std::uint64_t current_tick)
+{
+    expire(current_tick);
+    if (!active_ || joins_.size() >= (threshold_ + 1) / 2) {
+        return false;
+    }
+    active_ = false;
+    return true;
+}
+
+bool JoinStorm::isActive() const
+{
+    return active_;
+}
+
+std::size_t JoinStorm::getJoinCount() const
+{
+    return join_count_;
+}
+
+std::uint64_t JoinStorm::getStartTick() const
+{
+    return start_tick_;
+}
+
+void JoinStorm::expire(std::uint64_t current_tick)
+{
+    while (!joins_.empty() && joins_.front() + window_ticks_ <= current_tick) {
+        joins_.pop_front();
+    }
+}
+
+}  // namespace endstone::detail
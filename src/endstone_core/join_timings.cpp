@@ -0,0 +1,79 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/join_timings.h"
+
+#include <algorithm>
+
+namespace endstone::detail {
+
+void JoinTimings::record(JoinPhase phase, std::chrono::nanoseconds elapsed)
+{
+    auto value = static_cast<std::uint64_t>(std::max<std::int64_t>(elapsed.count(), 0));
+    auto &entry = entries_[static_cast<std::size_t>(phase)];
+    entry.count++;
+    entry.total += value;
+    entry.max = std::max(entry.max, value);
+    entry.histogram.record(value);
+}
+
+std::vector<JoinPhaseTiming> JoinTimings::getTimings() const
+{
+    std::vector<JoinPhaseTiming> timings;
+    for (std::size_t i = 0; i < PhaseCount; i++) {
+        const auto &entry = entries_[i];
+        if (entry.count == 0) {
+            continue;
+        }
+        timings.push_back({
+            static_cast<JoinPhase>(i),
+            entry.count,
+            std::chrono::nanoseconds(entry.total),
+            std::chrono::nanoseconds(entry.max),
+            std::chrono::nanoseconds(std::min(entry.histogram.getPercentile(0.99, entry.count), entry.max)),
+        });
+    }
+    return timings;
+}
+
+void JoinTimings::reset()
+{
+    for (auto &entry : entries_) {
+        entry.count = 0;
+        entry.total = 0;
+        entry.max = 0;
+        entry.histogram.reset();
+    }
+}
+
+std::string_view JoinTimings::getName(JoinPhase phase)
+{
+    switch (phase) {
+    case JoinPhase::LoadPlayer:
+        return "Load player data";
+    case JoinPhase::ConnectionRequest:
+        return "Connection request";
+    case JoinPhase::LoginEvent:
+        return "PlayerLoginEvent";
+    case JoinPhase::JoinEvent:
+        return "PlayerJoinEvent";
+    case JoinPhase::Permissions:
+        return "Recalculate permissions";
+    case JoinPhase::Commands:
+        return "Update commands";
+    }
+    return "Unknown";
+}
+
+}  // namespace endstone::detail
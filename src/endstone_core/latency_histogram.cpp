@@ -0,0 +1,71 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/latency_histogram.h"
+
+#include <cmath>
+
+namespace endstone::detail {
+
+void LatencyHistogram::record(std::uint64_t value)
+{
+    buckets_[getBucket(value)].fetch_add(1, std::memory_order_relaxed);
+}
+
+std::uint64_t LatencyHistogram::getPercentile(double percentile, std::uint64_t count) const
+{
+    auto target = static_cast<std::uint64_t>(std::ceil(percentile * static_cast<double>(count)));
+    std::uint64_t cumulative = 0;
+    for (std::size_t i = 0; i < NumBuckets; ++i) {
+        cumulative += buckets_[i].load(std::memory_order_relaxed);
+        if (cumulative >= target) {
+            return getUpperBound(i);
+        }
+    }
+    return getUpperBound(NumBuckets - 1);
+}
+
+void LatencyHistogram::reset()
+{
+    for (auto &bucket : buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+std::size_t LatencyHistogram::getBucket(std::uint64_t value)
+{
+    if (value < SubBuckets) {
+        return value;
+    }
+    std::size_t msb = 0;
+    for (auto v = value; v > 1; v >>= 1) {
+        ++msb;
+    }
+    return (msb * SubBuckets) + ((value >> (msb - 2)) & (SubBuckets - 1));
+}
+
+std::uint64_t LatencyHistogram::getUpperBound(std::size_t bucket)
+{
+    if (bucket < SubBuckets) {
+        return bucket;
+    }
+    auto msb = bucket / SubBuckets;
+    auto sub = bucket % SubBuckets;
+    if (msb >= 63 && sub == SubBuckets - 1) {
+        return UINT64_MAX;
+    }
+    return ((SubBuckets + sub + 1) << (msb - 2)) - 1;
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,207 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/level/actor_counter.h"
+
+#include <algorithm>
+
+namespace endstone::detail {
+
+void ActorCounter::setLimit(const std::string &type, const Limit &limit)
+{
+    type_limits_[intern(type)] = limit;
+}
+
+void ActorCounter::setLimit(std::uint32_t categories, const Limit &limit)
+{
+    auto it = std::find_if(category_limits_.begin(), category_limits_.end(),
+                           [&](const auto &entry) { return entry.mask == categories; });
+    if (it != category_limits_.end()) {
+        it->limit = limit;
+        return;
+    }
+
+    // Actors counted before the limit existed are matched against it once, from then on it is kept up to date
+    auto index = category_limits_.size();
+    auto &entry = category_limits_.emplace_back(CategoryLimit{categories, limit, 0});
+    for (const auto &[id, record] : records_) {
+        if ((record.categories & categories) == categories) {
+            entry.count++;
+            at(chunks_[record.chunk].categories, index)++;
+        }
+    }
+}
+
+bool ActorCounter::canAdd(std::int64_t chunk, const std::string &type, std::uint32_t categories) const
+{
+    static const Chunk empty;
+    auto chunk_it = chunks_.find(chunk);
+    const auto &counts = chunk_it == chunks_.end() ? empty : chunk_it->second;
+
+    if (auto it = type_ids_.find(type); it != type_ids_.end()) {
+        const auto &limit = type_limits_[it->second];
+        if (isFull(type_counts_[it->second], limit.per_dimension) ||
+            isFull(at(counts.types, it->second), limit.per_chunk)) {
+            return false;
+        }
+    }
+
+    for (std::size_t i = 0; i < category_limits_.size(); i++) {
+        const auto &entry = category_limits_[i];
+        if ((categories & entry.mask) != entry.mask) {
+            continue;
+        }
+        if (isFull(entry.count, entry.limit.per_dimension) || isFull(at(counts.categories, i), entry.limit.per_chunk)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ActorCounter::add(std::uint64_t id, std::int64_t chunk, const std::string &type, std::uint32_t categories)
+{
+    auto replaced = remove(id);
+
+    auto type_id = intern(type);
+    auto &counts = chunks_[chunk];
+    at(counts.types, type_id)++;
+    type_counts_[type_id]++;
+    for (std::size_t i = 0; i < category_limits_.size(); i++) {
+        auto &entry = category_limits_[i];
+        if ((categories & entry.mask) == entry.mask) {
+            entry.count++;
+            at(counts.categories, i)++;
+        }
+    }
+
+    records_.emplace(id, Record{chunk, type_id, categories, counts.actors.size()});
+    counts.actors.push_back(id);
+    return !replaced;
+}
+
+bool ActorCounter::remove(std::uint64_t id)
+{
+    auto it = records_.find(id);
+    if (it == records_.end()) {
+        return false;
+    }
+
+    const auto record = it->second;
+    records_.erase(it);
+
+    auto chunk_it = chunks_.find(record.chunk);
+    auto &counts = chunk_it->second;
+    at(counts.types, record.type)--;
+    type_counts_[record.type]--;
+    for (std::size_t i = 0; i < category_limits_.size(); i++) {
+        auto &entry = category_limits_[i];
+        if ((record.categories & entry.mask) == entry.mask) {
+            entry.count--;
+            at(counts.categories, i)--;
+        }
+    }
+
+    // Swap the last actor of the chunk into the freed slot so removal does not shift the others
+    auto &actors = counts.actors;
+    if (record.slot != actors.size() - 1) {
+        actors[record.slot] = actors.back();
+        records_[actors[record.slot]].slot = record.slot;
+    }
+    actors.pop_back();
+    if (actors.empty()) {
+        chunks_.erase(chunk_it);
+    }
+    return true;
+}
+
+std::size_t ActorCounter::size() const
+{
+    return records_.size();
+}
+
+int ActorCounter::getCount(const std::string &type) const
+{
+    auto it = type_ids_.find(type);
+    return it == type_ids_.end() ? 0 : type_counts_[it->second];
+}
+
+int ActorCounter::getCount(std::int64_t chunk, const std::string &type) const
+{
+    auto it = type_ids_.find(type);
+    auto chunk_it = chunks_.find(chunk);
+    if (it == type_ids_.end() || chunk_it == chunks_.end()) {
+        return 0;
+    }
+    return at(chunk_it->second.types, it->second);
+}
+
+std::vector<std::pair<std::string, int>> ActorCounter::getCounts() const
+{
+    std::vector<std::pair<std::string, int>> result;
+    for (std::size_t i = 0; i < type_counts_.size(); i++) {
+        if (type_counts_[i] > 0) {
+            result.emplace_back(*type_names_[i], type_counts_[i]);
+        }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+std::vector<std::pair<std::int64_t, int>> ActorCounter::getBusiestChunks(std::size_t count) const
+{
+    std::vector<std::pair<std::int64_t, int>> result;
+    result.reserve(chunks_.size());
+    for (const auto &[key, counts] : chunks_) {
+        result.emplace_back(key, static_cast<int>(counts.actors.size()));
+    }
+
+    auto busier = [](const auto &lhs, const auto &rhs) {
+        return lhs.second != rhs.second ? lhs.second > rhs.second : lhs.first < rhs.first;
+    };
+    count = std::min(count, result.size());
+    std::partial_sort(result.begin(), result.begin() + static_cast<std::ptrdiff_t>(count), result.end(), busier);
+    result.resize(count);
+    return result;
+}
+
+std::size_t ActorCounter::intern(const std::string &type)
+{
+    auto [it, inserted] = type_ids_.emplace(type, type_names_.size());
+    if (inserted) {
+        type_names_.push_back(&it->first);
+        type_limits_.emplace_back();
+        type_counts_.push_back(0);
+    }
+    return it->second;
+}
+
+bool ActorCounter::isFull(int count, int limit)
+{
+    return limit != Unlimited && count >= limit;
+}
+
+int &ActorCounter::at(std::vector<int> &counts, std::size_t index)
+{
+    if (index >= counts.size()) {
+        counts.resize(index + 1, 0);
+    }
+    return counts[index];
+}
+
+int ActorCounter::at(const std::vector<int> &counts, std::size_t index)
+{
+    return index < counts.size() ? counts[index] : 0;
+}
+
+}  // namespace endstone::detail
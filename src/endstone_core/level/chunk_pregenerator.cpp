@@ -0,0 +1,194 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/level/chunk_pregenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+namespace endstone::detail {
+
+ChunkPregenerator::ChunkPregenerator(int center_x, int center_z, int radius, float target_usage,
+                                     std::size_t max_in_flight, std::uint64_t start)
+    : center_x_(center_x), center_z_(center_z), radius_(std::max(radius, 0)),
+      target_usage_(std::clamp(target_usage, 0.01F, 1.0F)), max_in_flight_(std::max<std::size_t>(max_in_flight, 1)),
+      window_(1)
+{
+    auto side = 2 * static_cast<std::uint64_t>(radius_) + 1;
+    total_ = side * side;
+    next_ = std::min(start, total_);
+    completed_ = next_;
+}
+
+std::pair<int, int> ChunkPregenerator::offsetAt(std::uint64_t index)
+{
+    if (index == 0) {
+        return {0, 0};
+    }
+
+    // Ring r holds the 8r chunks at a Chebyshev distance of r, and the rings before it fill a (2r - 1)^2 square
+    auto ring = static_cast<std::uint64_t>((std::sqrt(static_cast<double>(index)) + 1) / 2);
+    while ((2 * ring + 1) * (2 * ring + 1) <= index) {
+        ring++;
+    }
+    while (ring > 1 && (2 * ring - 1) * (2 * ring - 1) > index) {
+        ring--;
+    }
+
+    auto offset = index - (2 * ring - 1) * (2 * ring - 1);
+    auto side = offset / (2 * ring);
+    auto step = static_cast<int>(offset % (2 * ring));
+    auto r = static_cast<int>(ring);
+    switch (side) {
+    case 0:
+        return {r, -r + 1 + step};
+    case 1:
+        return {r - 1 - step, r};
+    case 2:
+        return {-r, r - 1 - step};
+    default:
+        return {-r + 1 + step, -r};
+    }
+}
+
+std::vector<ChunkPregenerator::Request> ChunkPregenerator::poll(float tick_usage, Clock::time_point now)
+{
+    if (!started_at_) {
+        started_at_ = now;
+    }
+
+    if (tick_usage > target_usage_) {
+        window_ = std::max<std::size_t>(window_ / 2, 1);
+        return {};
+    }
+    window_ = std::min(window_ + 1, max_in_flight_);
+
+    std::vector<Request> requests;
+    while (in_flight_.size() < window_ && next_ < total_) {
+        auto [dx, dz] = offsetAt(next_);
+        requests.push_back({next_, center_x_ + dx, center_z_ + dz});
+        in_flight_.insert(next_);
+        next_++;
+    }
+    return requests;
+}
+
+void ChunkPregenerator::complete(std::uint64_t index)
+{
+    if (in_flight_.erase(index) > 0) {
+        completed_++;
+        completed_this_run_++;
+    }
+}
+
+int ChunkPregenerator::getCenterX() const
+{
+    return center_x_;
+}
+
+int ChunkPregenerator::getCenterZ() const
+{
+    return center_z_;
+}
+
+int ChunkPregenerator::getRadius() const
+{
+    return radius_;
+}
+
+float ChunkPregenerator::getTargetUsage() const
+{
+    return target_usage_;
+}
+
+std::uint64_t ChunkPregenerator::getTotal() const
+{
+    return total_;
+}
+
+std::uint64_t ChunkPregenerator::getCompleted() const
+{
+    return completed_;
+}
+
+std::size_t ChunkPregenerator::getInFlight() const
+{
+    return in_flight_.size();
+}
+
+std::size_t ChunkPregenerator::getWindow() const
+{
+    return window_;
+}
+
+bool ChunkPregenerator::isDone() const
+{
+    return next_ >= total_ && in_flight_.empty();
+}
+
+double ChunkPregenerator::getRate(Clock::time_point now) const
+{
+    if (!started_at_) {
+        return 0.0;
+    }
+    auto elapsed = std::chrono::duration<double>(now - *started_at_).count();
+    if (elapsed <= 0.0) {
+        return 0.0;
+    }
+    return static_cast<double>(completed_this_run_) / elapsed;
+}
+
+std::optional<std::chrono::seconds> ChunkPregenerator::getEta(Clock::time_point now) const
+{
+    auto rate = getRate(now);
+    if (completed_this_run_ == 0 || rate <= 0.0) {
+        return std::nullopt;
+    }
+    auto remaining = static_cast<double>(total_ - completed_);
+    return std::chrono::seconds(static_cast<std::int64_t>(std::ceil(remaining / rate)));
+}
+
+std::uint64_t ChunkPregenerator::getCheckpoint() const
+{
+    return in_flight_.empty() ? next_ : *in_flight_.begin();
+}
+
+std::string ChunkPregenerator::serialize() const
+{
+    std::ostringstream out;
+    out << center_x_ << ' ' << center_z_ << ' ' << radius_ << ' ' << target_usage_ << ' ' << getCheckpoint() << '\n';
+    return out.str();
+}
+
+std::optional<ChunkPregenerator> ChunkPregenerator::deserialize(std::string_view data, std::size_t max_in_flight)
+{
+    std::istringstream in{std::string(data)};
+    int center_x;
+    int center_z;
+    int radius;
+    float target_usage;
+    std::uint64_t checkpoint;
+    if (!(in >> center_x >> center_z >> radius >> target_usage >> checkpoint) || radius < 0 ||
+        !(target_usage > 0.0F && target_usage <= 1.0F)) {
+        return std::nullopt;
+    }
+    ChunkPregenerator pregenerator{center_x, center_z, radius, target_usage, max_in_flight, checkpoint};
+    if (checkpoint > pregenerator.getTotal()) {
+        return std::nullopt;
+    }
+    return pregenerator;
+}
+
+}  // namespace endstone::detail
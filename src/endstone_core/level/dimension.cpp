@@ -14,9 +14,33 @@
 
 #include "endstone/detail/level/dimension.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+#include "bedrock/world/actor/actor.h"
+#include "bedrock/world/level/block/block_update_flag.h"
+#include "bedrock/world/level/block/registry/block_type_registry.h"
+#include "bedrock/world/level/chunk/chunk_source.h"
 #include "bedrock/world/level/dimension/vanilla_dimensions.h"
+#include "bedrock/world/phys/aabb.h"
+#include "endstone/detail/actor/actor.h"
 #include "endstone/detail/block/block.h"
 #include "endstone/detail/level/level.h"
+#include "endstone/detail/nbt/nbt_json.h"
+#include "endstone/network/spawn_particle_effect_packet.h"
+#include "endstone/player.h"
 
 namespace endstone::detail {
 
@@ -65,9 +89,7 @@ std::unique_ptr<Block> EndstoneDimension::getBlockAt(int x, int y, int z)
         return nullptr;
     }
 
-    auto current_level_tick = level_.getHandle().getCurrentTick();
-    auto chunk_last_tick = chunk->getLastTick();
-    if (current_level_tick != chunk_last_tick && current_level_tick != chunk_last_tick + 1) {
+    if (!isTicking(*chunk)) {
         logger.error("Trying to access location ({}, {}, {}) which is not in a chunk currently ticking.", x, y, z);
         return nullptr;
     }
@@ -80,9 +102,712 @@ std::unique_ptr<Block> EndstoneDimension::getBlockAt(Location location)
     return getBlockAt(location.getBlockX(), location.getBlockY(), location.getBlockZ());
 }
 
+std::string_view EndstoneDimension::getBlockTypeAt(int x, int y, int z)
+{
+    auto &block_source = getHandle().getBlockSourceFromMainChunkSource();
+    BlockPos pos{x, y, z};
+    if (!isAccessible(block_source, pos)) {
+        return {};
+    }
+    return EndstoneBlock{block_source, pos}.getTypeName();
+}
+
+int EndstoneDimension::getBlockTypeIdAt(int x, int y, int z)
+{
+    auto &block_source = getHandle().getBlockSourceFromMainChunkSource();
+    BlockPos pos{x, y, z};
+    if (!isAccessible(block_source, pos)) {
+        return BlockTypeIds::Unknown;
+    }
+    return EndstoneBlock{block_source, pos}.getTypeId();
+}
+
+void EndstoneDimension::forEachBlock(int x1, int y1, int z1, int x2, int y2, int z2,
+                                     const std::function<bool(Block &)> &callback)
+{
+    auto &block_source = getHandle().getBlockSourceFromMainChunkSource();
+    auto min_x = std::min(x1, x2);
+    auto max_x = std::max(x1, x2);
+    auto min_z = std::min(z1, z2);
+    auto max_z = std::max(z1, z2);
+    auto min_y = std::max(std::min(y1, y2), static_cast<int>(block_source.getMinHeight()));
+    auto max_y = std::min(std::max(y1, y2), static_cast<int>(block_source.getMaxHeight()));
+    if (min_y > max_y) {
+        return;
+    }
+
+    // Walk the region column by column so that each chunk is only looked up and checked once
+    for (auto chunk_x = min_x >> 4; chunk_x <= max_x >> 4; chunk_x++) {
+        for (auto chunk_z = min_z >> 4; chunk_z <= max_z >> 4; chunk_z++) {
+            auto *chunk = block_source.getChunk(chunk_x, chunk_z);
+            if (!chunk || !isTicking(*chunk)) {
+                continue;
+            }
+
+            auto start_x = std::max(min_x, chunk_x << 4);
+            auto end_x = std::min(max_x, (chunk_x << 4) + 15);
+            auto start_z = std::max(min_z, chunk_z << 4);
+            auto end_z = std::min(max_z, (chunk_z << 4) + 15);
+            for (auto x = start_x; x <= end_x; x++) {
+                for (auto z = start_z; z <= end_z; z++) {
+                    for (auto y = min_y; y <= max_y; y++) {
+                        EndstoneBlock block{block_source, BlockPos(x, y, z)};
+                        if (!callback(block)) {
+                            return;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+std::vector<std::unique_ptr<Block>> EndstoneDimension::getBlocks(int x1, int y1, int z1, int x2, int y2, int z2)
+{
+    std::vector<std::unique_ptr<Block>> blocks;
+    forEachBlock(x1, y1, z1, x2, y2, z2, [&blocks](Block &block) {
+        blocks.push_back(std::make_unique<EndstoneBlock>(static_cast<EndstoneBlock &>(block)));
+        return true;
+    });
+    return blocks;
+}
+
+int EndstoneDimension::setBlocks(int x1, int y1, int z1, int x2, int y2, int z2,
+                                 const std::vector<std::string> &palette, const std::vector<std::uint16_t> &indices,
+                                 bool apply_physics)
+{
+    auto &logger = level_.getServer().getLogger();
+    auto min_x = std::min(x1, x2);
+    auto min_y = std::min(y1, y2);
+    auto min_z = std::min(z1, z2);
+    auto size_x = std::max(x1, x2) - min_x + 1;
+    auto size_y = std::max(y1, y2) - min_y + 1;
+    auto size_z = std::max(z1, z2) - min_z + 1;
+    if (indices.size() != static_cast<std::size_t>(size_x) * size_y * size_z) {
+        logger.error("Trying to set {} blocks in a region of {} x {} x {} blocks.", indices.size(), size_x, size_y,
+                     size_z);
+        return -1;
+    }
+
+    std::vector<PaletteEntry> entries;
+    entries.reserve(palette.size());
+    for (const auto &name : palette) {
+        entries.push_back({name, std::nullopt});
+    }
+    auto states = resolvePalette(entries);
+    for (std::size_t i = 0; i < states.size(); i++) {
+        if (!states[i]) {
+            logger.error("Trying to set blocks to an unknown block type '{}'.", palette[i]);
+            return -1;
+        }
+    }
+    for (auto index : indices) {
+        if (index >= states.size()) {
+            logger.error("Palette index {} is out of range, the palette has {} entries.", index, states.size());
+            return -1;
+        }
+    }
+
+    return applyBlocks(min_x, min_y, min_z, size_x, size_y, size_z, states, indices,
+                       apply_physics ? BlockUpdateFlag::All : BlockUpdateFlag::Network);
+}
+
+RegionSnapshot EndstoneDimension::snapshotRegion(int x1, int y1, int z1, int x2, int y2, int z2)
+{
+    return encodeRegion(captureRegion(x1, y1, z1, x2, y2, z2));
+}
+
+std::shared_ptr<AsyncResult<RegionSnapshot>> EndstoneDimension::snapshotRegionAsync(Plugin &plugin, int x1, int y1,
+                                                                                    int z1, int x2, int y2, int z2)
+{
+    return level_.getServer().getScheduler().supplyAsync(
+        plugin, [region = captureRegion(x1, y1, z1, x2, y2, z2)]() { return encodeRegion(region); });
+}
+
+EndstoneDimension::CapturedRegion EndstoneDimension::captureRegion(int x1, int y1, int z1, int x2, int y2, int z2)
+{
+    CapturedRegion region;
+    region.min_x = std::min(x1, x2);
+    region.min_y = std::min(y1, y2);
+    region.min_z = std::min(z1, z2);
+    region.size_x = std::max(x1, x2) - region.min_x + 1;
+    region.size_y = std::max(y1, y2) - region.min_y + 1;
+    region.size_z = std::max(z1, z2) - region.min_z + 1;
+    region.states.resize(static_cast<std::size_t>(region.size_x) * region.size_y * region.size_z, nullptr);
+
+    // Only the pointers to the block states are copied here, encoding them is left to encodeRegion
+    auto &block_source = getHandle().getBlockSourceFromMainChunkSource();
+    forEachBlock(x1, y1, z1, x2, y2, z2, [&](Block &block) {
+        auto x = static_cast<std::size_t>(block.getX() - region.min_x);
+        auto y = static_cast<std::size_t>(block.getY() - region.min_y);
+        auto z = static_cast<std::size_t>(block.getZ() - region.min_z);
+        region.states[(x * region.size_y + y) * region.size_z + z] =
+            &block_source.getBlock(BlockPos(block.getX(), block.getY(), block.getZ()));
+        return true;
+    });
+    return region;
+}
+
+RegionSnapshot EndstoneDimension::encodeRegion(const CapturedRegion &region)
+{
+    std::unordered_map<const ::Block *, std::uint16_t> lookup;
+    std::vector<std::string> palette;
+    std::vector<std::uint16_t> indices(region.states.size(), RegionSnapshot::Missing);
+    for (std::size_t i = 0; i < region.states.size(); i++) {
+        const auto *state = region.states[i];
+        if (!state) {
+            continue;
+        }
+        auto it = lookup.find(state);
+        if (it == lookup.end()) {
+            if (palette.size() >= RegionSnapshot::Missing) {
+                continue;
+            }
+            it = lookup.emplace(state, static_cast<std::uint16_t>(palette.size())).first;
+            palette.push_back(NbtJson::toJson(state->getSerializationId()));
+        }
+        indices[i] = it->second;
+    }
+    return {region.min_x, region.min_y, region.min_z, region.size_x, region.size_y, region.size_z, std::move(palette),
+            std::move(indices)};
+}
+
+int EndstoneDimension::restoreRegion(const RegionSnapshot &snapshot)
+{
+    auto &logger = level_.getServer().getLogger();
+    const auto &palette = snapshot.getPalette();
+    const auto &indices = snapshot.getIndices();
+    if (snapshot.getSizeX() <= 0 || snapshot.getSizeY() <= 0 || snapshot.getSizeZ() <= 0 ||
+        indices.size() != static_cast<std::size_t>(snapshot.getSizeX()) * snapshot.getSizeY() * snapshot.getSizeZ()) {
+        logger.error("Trying to restore a region snapshot whose indices do not match its size.");
+        return -1;
+    }
+
+    std::vector<PaletteEntry> entries;
+    entries.reserve(palette.size());
+    for (const auto &entry : palette) {
+        try {
+            auto tag = NbtJson::fromJson(entry);
+            const auto *states = tag->getCompound("states");
+            entries.push_back({tag->getString("name"), states ? NbtJson::toJson(*states) : "{}"});
+        }
+        catch (const std::exception &) {
+            entries.push_back({"", std::nullopt});
+        }
+    }
+    auto states = resolvePalette(entries);
+    for (std::size_t i = 0; i < states.size(); i++) {
+        if (!states[i]) {
+            logger.warning("Skipping blocks of unknown block state '{}' in region snapshot.", palette[i]);
+        }
+    }
+
+    // Blocks that already match the snapshot are left alone, so only what changed since it was taken is sent out
+    return applyBlocks(snapshot.getMinX(), snapshot.getMinY(), snapshot.getMinZ(), snapshot.getSizeX(),
+                       snapshot.getSizeY(), snapshot.getSizeZ(), states, indices, BlockUpdateFlag::Network);
+}
+
 ::Dimension &EndstoneDimension::getHandle() const
 {
     return dimension_;
 }
 
+std::vector<Actor *> EndstoneDimension::getNearbyActors(float x, float y, float z, float radius) const
+{
+    return getNearbyActors(x, y, z, radius, nullptr);
+}
+
+std::vector<Actor *> EndstoneDimension::getNearbyActors(float x, float y, float z, float radius,
+                                                        const std::function<bool(Actor &)> &filter) const
+{
+    std::vector<Actor *> result;
+    if (radius < 0) {
+        return result;
+    }
+
+    // The block source keeps actors in per chunk lists, so only the chunks overlapping the box are visited. The span
+    // it hands out is reused by the next fetch, which the filter may well trigger, so take a copy first.
+    auto &block_source = getHandle().getBlockSourceFromMainChunkSource();
+    AABB box{{x - radius, y - radius, z - radius}, {x + radius, y + radius, z + radius}};
+    auto fetched = block_source.fetchEntities(nullptr, box, true, false);
+    std::vector<::Actor *> candidates(fetched.begin(), fetched.end());
+
+    auto radius_squared = radius * radius;
+    for (auto *candidate : candidates) {
+        if (candidate->isRemoved()) {
+            continue;
+        }
+        auto &actor = candidate->getEndstoneActor();
+        auto location = actor.getLocation();
+        auto dx = location.getX() - x;
+        auto dy = location.getY() - y;
+        auto dz = location.getZ() - z;
+        if (dx * dx + dy * dy + dz * dz > radius_squared) {
+            continue;
+        }
+        if (filter && !filter(actor)) {
+            continue;
+        }
+        result.push_back(&actor);
+    }
+    return result;
+}
+
+bool EndstoneDimension::addRegion(const std::string &name, int x1, int y1, int z1, int x2, int y2, int z2)
+{
+    return regions_.insert(name, RegionIndex::fromBlocks(x1, y1, z1, x2, y2, z2));
+}
+
+bool EndstoneDimension::removeRegion(const std::string &name)
+{
+    return regions_.erase(name);
+}
+
+std::vector<std::string> EndstoneDimension::getRegionsAt(float x, float y, float z) const
+{
+    return regions_.query(x, y, z);
+}
+
+std::vector<std::string> EndstoneDimension::getRegions(int x1, int y1, int z1, int x2, int y2, int z2) const
+{
+    return regions_.query(RegionIndex::fromBlocks(x1, y1, z1, x2, y2, z2));
+}
+
+const RegionIndex &EndstoneDimension::getRegionIndex() const
+{
+    return regions_;
+}
+
+bool EndstoneDimension::isChunkLoaded(int x, int z) const
+{
+    auto &chunk_source = getHandle().getBlockSourceFromMainChunkSource().getChunkSource();
+    return chunk_source.getExistingChunk(ChunkPos{x, z}) != nullptr;
+}
+
+bool EndstoneDimension::addChunkTicket(int x, int z, Plugin &plugin)
+{
+    if (!plugin.isEnabled()) {
+        return false;
+    }
+
+    auto key = toChunkKey(x, z);
+    auto &ticket = chunk_tickets_[key];
+    if (std::find(ticket.plugins.begin(), ticket.plugins.end(), &plugin) != ticket.plugins.end()) {
+        return false;
+    }
+    if (!ticket.chunk) {
+        // The chunk source discards a chunk once the last reference to it is released, holding one keeps it loaded
+        auto &chunk_source = getHandle().getBlockSourceFromMainChunkSource().getChunkSource();
+        ticket.chunk = chunk_source.getOrLoadChunk(ChunkPos{x, z}, ChunkSource::LoadMode::Deferred, false);
+        if (!ticket.chunk) {
+            chunk_tickets_.erase(key);
+            return false;
+        }
+    }
+    ticket.plugins.push_back(&plugin);
+    return true;
+}
+
+bool EndstoneDimension::removeChunkTicket(int x, int z, Plugin &plugin)
+{
+    auto it = chunk_tickets_.find(toChunkKey(x, z));
+    if (it == chunk_tickets_.end()) {
+        return false;
+    }
+    auto &plugins = it->second.plugins;
+    auto owner = std::find(plugins.begin(), plugins.end(), &plugin);
+    if (owner == plugins.end()) {
+        return false;
+    }
+    plugins.erase(owner);
+    if (plugins.empty()) {
+        chunk_tickets_.erase(it);
+    }
+    return true;
+}
+
+void EndstoneDimension::removeChunkTickets(Plugin &plugin)
+{
+    for (auto it = chunk_tickets_.begin(); it != chunk_tickets_.end();) {
+        auto &plugins = it->second.plugins;
+        plugins.erase(std::remove(plugins.begin(), plugins.end(), &plugin), plugins.end());
+        if (plugins.empty()) {
+            it = chunk_tickets_.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+std::vector<std::pair<int, int>> EndstoneDimension::getChunkTickets(Plugin &plugin) const
+{
+    std::vector<std::pair<int, int>> result;
+    for (const auto &[key, ticket] : chunk_tickets_) {
+        if (std::find(ticket.plugins.begin(), ticket.plugins.end(), &plugin) != ticket.plugins.end()) {
+            result.push_back(fromChunkKey(key));
+        }
+    }
+    return result;
+}
+
+bool EndstoneDimension::startPregeneration(int center_x, int center_z, int radius, float target_usage)
+{
+    if (pregenerator_ || radius < 0) {
+        return false;
+    }
+    pregeneration_resumed_ = true;
+    pregenerator_.emplace(center_x, center_z, radius, target_usage, MaxPregenerationRequestsPerWorker * workerCount());
+    savePregeneration();
+    return true;
+}
+
+bool EndstoneDimension::stopPregeneration()
+{
+    if (!pregenerator_) {
+        return false;
+    }
+    pregenerator_.reset();
+    pregeneration_chunks_.clear();
+    std::error_code ec;
+    std::filesystem::remove(getPregenerationCheckpoint(), ec);
+    return true;
+}
+
+std::optional<Dimension::PregenerationProgress> EndstoneDimension::getPregenerationProgress() const
+{
+    if (!pregenerator_) {
+        return std::nullopt;
+    }
+    auto now = ChunkPregenerator::Clock::now();
+    const auto &pregenerator = *pregenerator_;
+    return PregenerationProgress{pregenerator.getCenterX(),   pregenerator.getCenterZ(), pregenerator.getRadius(),
+                                 pregenerator.getCompleted(), pregenerator.getTotal(),   pregenerator.getRate(now),
+                                 pregenerator.getEta(now)};
+}
+
+void EndstoneDimension::setActorLimit(const std::string &type, int per_chunk, int per_dimension)
+{
+    actors_.setLimit(type,
+                     {std::max(per_chunk, ActorCounter::Unlimited), std::max(per_dimension, ActorCounter::Unlimited)});
+}
+
+void EndstoneDimension::setActorLimit(ActorCategory categories, int per_chunk, int per_dimension)
+{
+    actors_.setLimit(static_cast<std::uint32_t>(categories),
+                     {std::max(per_chunk, ActorCounter::Unlimited), std::max(per_dimension, ActorCounter::Unlimited)});
+}
+
+int EndstoneDimension::getActorCount(const std::string &type) const
+{
+    return actors_.getCount(type);
+}
+
+std::vector<std::pair<std::string, int>> EndstoneDimension::getActorCounts() const
+{
+    return actors_.getCounts();
+}
+
+void EndstoneDimension::spawnParticles(const std::vector<ParticleEffect> &particles,
+                                       const std::vector<Player *> &viewers, float radius)
+{
+    if (particles.empty() || radius < 0) {
+        return;
+    }
+
+    // Particles are grouped into cells, the viewers that may see any particle of a cell are found once for the cell
+    std::map<std::tuple<int, int, int>, std::vector<const ParticleEffect *>> cells;
+    for (const auto &particle : particles) {
+        auto cell_x = static_cast<int>(std::floor(particle.position.getX() / ParticleCellSize));
+        auto cell_y = static_cast<int>(std::floor(particle.position.getY() / ParticleCellSize));
+        auto cell_z = static_cast<int>(std::floor(particle.position.getZ() / ParticleCellSize));
+        cells[{cell_x, cell_y, cell_z}].push_back(&particle);
+    }
+
+    auto &server = level_.getServer();
+    auto cell_radius = radius + ParticleCellSize * std::sqrt(3.0F) / 2;
+    auto radius_squared = radius * radius;
+    auto distance_squared = [](const Location &location, const Vector<float> &position) {
+        auto dx = location.getX() - position.getX();
+        auto dy = location.getY() - position.getY();
+        auto dz = location.getZ() - position.getZ();
+        return dx * dx + dy * dy + dz * dz;
+    };
+
+    auto half = ParticleCellSize / 2.0F;
+    std::vector<Player *> candidates;
+    std::vector<Player *> recipients;
+    for (const auto &[cell, cell_particles] : cells) {
+        Vector<float> center{std::get<0>(cell) * ParticleCellSize + half, std::get<1>(cell) * ParticleCellSize + half,
+                             std::get<2>(cell) * ParticleCellSize + half};
+        candidates.clear();
+        if (viewers.empty()) {
+            auto actors = getNearbyActors(center.getX(), center.getY(), center.getZ(), cell_radius,
+                                          [](Actor &actor) { return actor.asPlayer() != nullptr; });
+            for (auto *actor : actors) {
+                candidates.push_back(actor->asPlayer());
+            }
+        }
+        else {
+            for (auto *viewer : viewers) {
+                if (&viewer->getDimension() == this &&
+                    distance_squared(viewer->getLocation(), center) <= cell_radius * cell_radius) {
+                    candidates.push_back(viewer);
+                }
+            }
+        }
+        if (candidates.empty()) {
+            continue;
+        }
+
+        for (const auto *particle : cell_particles) {
+            recipients.clear();
+            for (auto *candidate : candidates) {
+                if (distance_squared(candidate->getLocation(), particle->position) <= radius_squared) {
+                    recipients.push_back(candidate);
+                }
+            }
+            if (recipients.empty()) {
+                continue;
+            }
+            SpawnParticleEffectPacket packet;
+            packet.dimension_id = dimension_.getDimensionId().id;
+            packet.position = particle->position;
+            packet.effect_name = particle->effect_name;
+            packet.molang_variables_json = particle->molang_variables_json;
+            server.broadcastPacket(packet, recipients);
+        }
+    }
+}
+
+void EndstoneDimension::tickPregeneration(float tick_usage)
+{
+    if (!pregeneration_resumed_) {
+        pregeneration_resumed_ = true;
+        resumePregeneration();
+    }
+    if (!pregenerator_) {
+        return;
+    }
+
+    // Generated chunks are released straight away so that the chunk source can save and discard them
+    pregeneration_chunks_.erase(std::remove_if(pregeneration_chunks_.begin(), pregeneration_chunks_.end(),
+                                               [this](const auto &entry) {
+                                                   const auto &chunk = entry.second;
+                                                   if (chunk && chunk->getState() < ChunkState::Generated) {
+                                                       return false;
+                                                   }
+                                                   pregenerator_->complete(entry.first);
+                                                   return true;
+                                               }),
+                                pregeneration_chunks_.end());
+
+    auto &logger = level_.getServer().getLogger();
+    if (pregenerator_->isDone()) {
+        logger.info("Pre-generation of {} finished, {} chunks generated.", getName(), pregenerator_->getTotal());
+        stopPregeneration();
+        return;
+    }
+
+    auto &chunk_source = getHandle().getBlockSourceFromMainChunkSource().getChunkSource();
+    for (const auto &request : pregenerator_->poll(tick_usage, ChunkPregenerator::Clock::now())) {
+        pregeneration_chunks_.emplace_back(
+            request.index,
+            chunk_source.getOrLoadChunk(ChunkPos{request.x, request.z}, ChunkSource::LoadMode::Deferred, false));
+    }
+
+    if (++pregeneration_ticks_ % PregenerationReportInterval == 0) {
+        savePregeneration();
+        auto progress = *getPregenerationProgress();
+        logger.info("Pre-generation of {}: {}/{} chunks ({:.1f}%), {:.1f} chunks/s, ETA {}", getName(),
+                    progress.completed, progress.total, 100.0 * progress.completed / progress.total,
+                    progress.chunks_per_second,
+                    progress.eta ? std::to_string(progress.eta->count()) + "s" : std::string("unknown"));
+    }
+}
+
+void EndstoneDimension::onLeaveGame()
+{
+    // The chunk source goes away with the level, references to its chunks must not outlive it
+    if (pregenerator_) {
+        savePregeneration();
+        pregenerator_.reset();
+    }
+    pregeneration_chunks_.clear();
+    chunk_tickets_.clear();
+}
+
+std::vector<std::pair<std::pair<int, int>, int>> EndstoneDimension::getBusiestChunks(std::size_t count) const
+{
+    std::vector<std::pair<std::pair<int, int>, int>> result;
+    for (const auto &[key, actors] : actors_.getBusiestChunks(count)) {
+        result.emplace_back(fromChunkKey(key), actors);
+    }
+    return result;
+}
+
+bool EndstoneDimension::canAddActor(::Actor &actor) const
+{
+    // Actors loaded from the world or converted from another actor were already there, only new spawns are capped
+    auto method = actor.getInitializationMethod();
+    if (method != ActorInitializationMethod::Spawned && method != ActorInitializationMethod::Born) {
+        return true;
+    }
+    return actors_.canAdd(toChunkKey(actor), actor.getEndstoneActor().getType(),
+                          static_cast<std::uint32_t>(actor.getCategories()));
+}
+
+void EndstoneDimension::onActorAdded(::Actor &actor)
+{
+    // Runtime ids are handed out again when a chunk is reloaded, unique ids are saved with the actor
+    auto id = static_cast<std::uint64_t>(actor.getOrCreateUniqueID().raw_id);
+    actors_.add(id, toChunkKey(actor), actor.getEndstoneActor().getType(),
+                static_cast<std::uint32_t>(actor.getCategories()));
+}
+
+void EndstoneDimension::onActorRemoved(::Actor &actor)
+{
+    actors_.remove(static_cast<std::uint64_t>(actor.getOrCreateUniqueID().raw_id));
+}
+
+std::vector<const ::Block *> EndstoneDimension::resolvePalette(const std::vector<PaletteEntry> &entries)
+{
+    // A single pass over the block type registry resolves every entry
+    std::unordered_map<std::string_view, std::vector<std::size_t>> pending;
+    for (std::size_t i = 0; i < entries.size(); i++) {
+        pending[entries[i].name].push_back(i);
+    }
+
+    std::vector<const ::Block *> states(entries.size(), nullptr);
+    BlockTypeRegistry::forEachBlock([&](const BlockLegacy &block_legacy) {
+        auto it = pending.find(block_legacy.getFullNameId());
+        if (it == pending.end()) {
+            return true;
+        }
+        for (auto i : it->second) {
+            if (!entries[i].states) {
+                states[i] = block_legacy.getDefaultState();
+                continue;
+            }
+            block_legacy.forEachBlockPermutation([&](const ::Block &block) {
+                const auto *block_states = block.getSerializationId().getCompound("states");
+                if ((block_states ? NbtJson::toJson(*block_states) : "{}") == *entries[i].states) {
+                    states[i] = &block;
+                }
+                return true;
+            });
+        }
+        pending.erase(it);
+        return !pending.empty();
+    });
+    return states;
+}
+
+int EndstoneDimension::applyBlocks(int min_x, int min_y, int min_z, int size_x, int size_y, int size_z,
+                                   const std::vector<const ::Block *> &states,
+                                   const std::vector<std::uint16_t> &indices, int flags)
+{
+    auto &block_source = getHandle().getBlockSourceFromMainChunkSource();
+    auto count = 0;
+    forEachBlock(min_x, min_y, min_z, min_x + size_x - 1, min_y + size_y - 1, min_z + size_z - 1, [&](Block &block) {
+        auto x = static_cast<std::size_t>(block.getX() - min_x);
+        auto y = static_cast<std::size_t>(block.getY() - min_y);
+        auto z = static_cast<std::size_t>(block.getZ() - min_z);
+        auto index = indices[(x * size_y + y) * size_z + z];
+        if (index >= states.size() || !states[index]) {
+            return true;
+        }
+        auto pos = BlockPos(block.getX(), block.getY(), block.getZ());
+        const auto &state = *states[index];
+        if (&block_source.getBlock(pos) != &state && block_source.setBlock(pos, state, flags, nullptr, nullptr)) {
+            count++;
+        }
+        return true;
+    });
+    return count;
+}
+
+bool EndstoneDimension::isTicking(const LevelChunk &chunk) const
+{
+    auto current_level_tick = level_.getHandle().getCurrentTick();
+    auto chunk_last_tick = chunk.getLastTick();
+    return current_level_tick == chunk_last_tick || current_level_tick == chunk_last_tick + 1;
+}
+
+bool EndstoneDimension::isAccessible(BlockSource &block_source, const BlockPos &pos) const
+{
+    // The same checks as getBlockAt, without the errors: walking off the loaded area is expected when traversing
+    if (pos.y < block_source.getMinHeight() || pos.y > block_source.getMaxHeight()) {
+        return false;
+    }
+    const auto *chunk = block_source.getChunkAt(pos);
+    return chunk && isTicking(*chunk);
+}
+
+std::filesystem::path EndstoneDimension::getPregenerationCheckpoint() const
+{
+    return std::filesystem::current_path() / "pregen" / (getName() + ".txt");
+}
+
+void EndstoneDimension::resumePregeneration()
+{
+    auto path = getPregenerationCheckpoint();
+    std::ifstream file(path);
+    if (!file) {
+        return;
+    }
+
+    auto data = std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    auto &logger = level_.getServer().getLogger();
+    pregenerator_ = ChunkPregenerator::deserialize(data, MaxPregenerationRequestsPerWorker * workerCount());
+    if (!pregenerator_) {
+        logger.error("Pre-generation checkpoint {} is invalid and has been ignored.", path.string());
+        return;
+    }
+    logger.info("Resuming pre-generation of {} at {}/{} chunks.", getName(), pregenerator_->getCompleted(),
+                pregenerator_->getTotal());
+}
+
+void EndstoneDimension::savePregeneration() const
+{
+    auto path = getPregenerationCheckpoint();
+    auto temp = path;
+    temp += ".tmp";
+    std::error_code ec;
+    std::filesystem::create_directories(path.parent_path(), ec);
+    {
+        std::ofstream file(temp, std::ios::trunc);
+        file << pregenerator_->serialize();
+        if (!file) {
+            level_.getServer().getLogger().error("Unable to save pre-generation checkpoint {}.", path.string());
+            return;
+        }
+    }
+    std::filesystem::rename(temp, path, ec);
+}
+
+std::size_t EndstoneDimension::workerCount()
+{
+    return std::max(1U, std::thread::hardware_concurrency());
+}
+
+std::int64_t EndstoneDimension::toChunkKey(int x, int z)
+{
+    return static_cast<std::int64_t>(static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32 |
+                                     static_cast<std::uint32_t>(z));
+}
+
+std::pair<int, int> EndstoneDimension::fromChunkKey(std::int64_t key)
+{
+    auto bits = static_cast<std::uint64_t>(key);
+    return {static_cast<std::int32_t>(static_cast<std::uint32_t>(bits >> 32)),
+            static_cast<std::int32_t>(static_cast<std::uint32_t>(bits))};
+}
+
+std::int64_t EndstoneDimension::toChunkKey(const ::Actor &actor)
+{
+    const auto &pos = actor.getPosition();
+    return toChunkKey(static_cast<int>(std::floor(pos.x)) >> 4, static_cast<int>(std::floor(pos.z)) >> 4);
+}
+
 }  // namespace endstone::detail
@@ -14,15 +14,22 @@
 
 #include "endstone/detail/level/level.h"
 
+#include <utility>
+
 #include <entt/entt.hpp>
 #include <magic_enum/magic_enum.hpp>
 
 #include "bedrock/core/automatic_id.h"
+#include "bedrock/entity/components/actor_owner_component.h"
 #include "bedrock/world/level/dimension/dimension.h"
 #include "bedrock/world/level/dimension/vanilla_dimensions.h"
 #include "bedrock/world/level/level.h"
+#include "bedrock/world/level/storage/level_storage.h"
 #include "endstone/detail/level/dimension.h"
+#include "endstone/detail/level/level_backup.h"
+#include "endstone/detail/scheduler/scheduler.h"
 #include "endstone/level/dimension.h"
+#include "endstone/plugin/plugin.h"
 
 namespace endstone::detail {
 
@@ -65,14 +72,60 @@ std::vector<Actor *> EndstoneLevel::getActors() const
     return result;
 }
 
+void EndstoneLevel::forEachActor(const std::function<bool(Actor &)> &callback) const
+{
+    forEachActor(ActorCategory::None, callback);
+}
+
+void EndstoneLevel::forEachActor(ActorCategory categories, const std::function<bool(Actor &)> &callback) const
+{
+    auto registry = level_.getEntityRegistry().value;
+    if (!registry) {
+        return;
+    }
+
+    static_assert(static_cast<int>(ActorCategory::Boat) == static_cast<int>(::ActorCategory::Boat));
+    static_assert(static_cast<int>(ActorCategory::Zombie) == static_cast<int>(::ActorCategory::Zombie));
+
+    // Walk the packed storage of the owner component directly, it holds exactly the entities that are actors
+    auto mask = static_cast<::ActorCategory>(categories);
+    for (auto &&[entity, component] : registry->getRegistry().view<ActorOwnerComponent>().each()) {
+        auto &actor = component.actor;
+        if (!actor || actor->isRemoved() || &actor->getLevel() != &level_) {
+            continue;
+        }
+        if ((actor->getCategories() & mask) != mask) {
+            continue;
+        }
+        if (!callback(actor->getEndstoneActor())) {
+            return;
+        }
+    }
+}
+
 int EndstoneLevel::getTime() const
 {
-    return level_.getTime();
+    return sync_.getPendingTime().value_or(level_.getTime());
 }
 
 void EndstoneLevel::setTime(int time)
 {
-    level_.setTime(time);
+    // Setting the time broadcasts it to every player, a plugin setting it every tick is only applied once per interval
+    if (sync_.requestTime(time, level_.getTime(), server_.getCurrentTick())) {
+        level_.setTime(time);
+    }
+}
+
+void EndstoneLevel::tick(std::uint64_t current_tick)
+{
+    if (auto time = sync_.pollTime(current_tick)) {
+        level_.setTime(*time);
+    }
+}
+
+LevelSync &EndstoneLevel::getSync()
+{
+    return sync_;
 }
 
 std::vector<Dimension *> EndstoneLevel::getDimensions() const
@@ -95,6 +148,79 @@ Dimension *EndstoneLevel::getDimension(std::string name) const
     return it->second.get();
 }
 
+Dimension *EndstoneLevel::getDimension(const ::Dimension &handle) const
+{
+    // Avoids building and folding the name of the dimension on hot paths such as EndstoneActor::getDimension
+    auto it = dimension_handles_.find(&handle);
+    if (it == dimension_handles_.end()) {
+        return getDimension(handle.getName());
+    }
+    return it->second;
+}
+
+bool EndstoneLevel::backup(Plugin &plugin, std::string destination, std::function<void(std::string)> callback)
+{
+    if (!plugin.isEnabled()) {
+        server_.getLogger().error("Plugin {} attempted to back up the level while disabled", plugin.getName());
+        return false;
+    }
+    return backup(std::filesystem::path(destination),
+                  [&plugin, callback = std::move(callback)](const BackupResult &result) {
+                      if (callback && plugin.isEnabled()) {
+                          callback(result.error);
+                      }
+                  });
+}
+
+bool EndstoneLevel::backup(std::filesystem::path destination, std::function<void(const BackupResult &)> callback)
+{
+    if (!level_.hasLevelStorage() || backup_running_.exchange(true)) {
+        return false;
+    }
+
+    // The storage keeps every file of the snapshot alive until it is released, and is only touched on this thread
+    const auto start = std::chrono::steady_clock::now();
+    auto &storage = level_.getLevelStorage();
+    std::vector<LevelBackup::File> files;
+    for (const auto &file : storage.createSnapshot("", true)) {
+        files.push_back({file.filename, file.file_size});
+    }
+    auto backup = std::make_shared<LevelBackup>(storage.getFullPath().getContainer(), std::move(files));
+
+    // Tables the last backup holds are linked from it, provided it has not been removed in the meantime
+    std::filesystem::path previous;
+    if (std::error_code ec; !last_backup_.empty() && std::filesystem::is_directory(last_backup_, ec)) {
+        previous = last_backup_;
+    }
+
+    auto &scheduler = static_cast<EndstoneScheduler &>(server_.getScheduler());
+    scheduler.getExecutor(AsyncExecutor::Io)
+        .execute([this, &scheduler, &storage, backup, start, destination = std::move(destination),
+                  previous = std::move(previous), callback = std::move(callback)]() mutable {
+            BackupResult result;
+            try {
+                result.files = backup->copyTo(destination, previous);
+            }
+            catch (std::exception &e) {
+                result.error = e.what();
+            }
+            scheduler.runTask([this, &storage, start, result = std::move(result), destination = std::move(destination),
+                               callback = std::move(callback)]() mutable {
+                storage.releaseSnapshot();
+                backup_running_ = false;
+                if (result.error.empty()) {
+                    last_backup_ = destination;
+                }
+                result.duration =
+                    std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+                if (callback) {
+                    callback(result);
+                }
+            });
+        });
+    return true;
+}
+
 void EndstoneLevel::addDimension(std::unique_ptr<Dimension> dimension)
 {
     auto name = dimension->getName();
@@ -104,6 +230,7 @@ void EndstoneLevel::addDimension(std::unique_ptr<Dimension> dimension)
             "Dimension {} is a duplicate of another dimension and has been prevented from loading.", name);
         return;
     }
+    dimension_handles_[&static_cast<EndstoneDimension &>(*dimension).getHandle()] = dimension.get();
     dimensions_[name] = std::move(dimension);
 }
 
@@ -112,6 +239,11 @@ EndstoneServer &EndstoneLevel::getServer() const
     return server_;
 }
 
+bool EndstoneLevel::isBackupRunning() const
+{
+    return backup_running_;
+}
+
 ::Level &EndstoneLevel::getHandle() const
 {
     return level_;
@@ -0,0 +1,113 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/level/level_backup.h"
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+namespace endstone::detail {
+
+LevelBackup::LevelBackup(std::filesystem::path source, std::vector<File> files)
+    : source_(std::move(source)), files_(std::move(files))
+{
+}
+
+LevelBackup::Result LevelBackup::copyTo(const std::filesystem::path &destination,
+                                        const std::filesystem::path &previous) const
+{
+    if (std::filesystem::exists(destination)) {
+        throw std::runtime_error(fmt::format("The destination {} already exists", destination.string()));
+    }
+
+    static constexpr std::size_t ChunkSize = 1 << 16;
+    std::array<char, ChunkSize> buffer{};
+    Result result;
+    for (const auto &file : files_) {
+        auto name = std::filesystem::path(file.name).relative_path();
+        if (name.empty() || std::any_of(name.begin(), name.end(), [](const auto &part) { return part == ".."; })) {
+            throw std::runtime_error(fmt::format("Invalid file name in snapshot: {}", file.name));
+        }
+
+        auto target = destination / name;
+        std::filesystem::create_directories(target.parent_path());
+        if (!previous.empty() && isImmutable(name)) {
+            std::error_code ec;
+            auto linked = previous / name;
+            auto size = std::filesystem::file_size(linked, ec);
+            if (!ec && size == file.size) {
+                std::filesystem::create_hard_link(linked, target, ec);
+                if (!ec) {
+                    ++result.linked;
+                    continue;
+                }
+            }
+        }
+
+        std::ifstream in(source_ / name, std::ios::binary);
+        if (!in) {
+            throw std::runtime_error(fmt::format("Unable to open {}", (source_ / name).string()));
+        }
+        std::ofstream out(target, std::ios::binary);
+        if (!out) {
+            throw std::runtime_error(fmt::format("Unable to create {}", target.string()));
+        }
+
+        // Bytes written after the snapshot was taken are not part of it
+        auto remaining = file.size;
+        while (remaining > 0) {
+            auto count = static_cast<std::streamsize>(std::min<std::uint64_t>(remaining, ChunkSize));
+            in.read(buffer.data(), count);
+            if (in.gcount() != count) {
+                throw std::runtime_error(fmt::format("{} is shorter than recorded in the snapshot", file.name));
+            }
+            out.write(buffer.data(), count);
+            remaining -= count;
+        }
+        if (!out) {
+            throw std::runtime_error(fmt::format("Unable to write {}", target.string()));
+        }
+        ++result.copied;
+        result.bytes_copied += file.size;
+    }
+    return result;
+}
+
+const std::vector<LevelBackup::File> &LevelBackup::getFiles() const
+{
+    return files_;
+}
+
+std::uint64_t LevelBackup::getTotalSize() const
+{
+    std::uint64_t total = 0;
+    for (const auto &file : files_) {
+        total += file.size;
+    }
+    return total;
+}
+
+bool LevelBackup::isImmutable(const std::filesystem::path &name)
+{
+    // Tables are written once by a flush or compaction and only ever deleted afterwards
+    auto extension = name.extension();
+    return extension == ".ldb" || extension == ".sst";
+}
+
+}  // namespace endstone::detail
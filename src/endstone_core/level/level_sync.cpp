@@ -0,0 +1,102 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/level/level_sync.h"
+
+#include <charconv>
+#include <cstdlib>
+#include <string_view>
+#include <type_traits>
+
+namespace endstone::detail {
+
+namespace {
+template <typename T>
+void readOption(const char *name, T &value)
+{
+    const auto *env = std::getenv(name);
+    if (!env) {
+        return;
+    }
+    std::string_view text{env};
+    T result{};
+    auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), result);
+    if (text.empty() || ec != std::errc() || end != text.data() + text.size()) {
+        return;
+    }
+    if constexpr (std::is_signed_v<T>) {
+        if (result < 0) {
+            return;
+        }
+    }
+    value = result;
+}
+}  // namespace
+
+LevelSync::Options LevelSync::Options::fromEnvironment()
+{
+    Options options;
+    readOption("ENDSTONE_TIME_SYNC_INTERVAL", options.time_interval);
+    readOption("ENDSTONE_TIME_SYNC_THRESHOLD", options.time_threshold);
+    readOption("ENDSTONE_WEATHER_EVENT_INTERVAL", options.weather_interval);
+    return options;
+}
+
+LevelSync::LevelSync() : LevelSync(Options{}) {}
+
+LevelSync::LevelSync(Options options) : options_(options) {}
+
+bool LevelSync::requestTime(int time, int current_time, std::uint64_t current_tick)
+{
+    auto jump = static_cast<std::int64_t>(time) - current_time;
+    if (options_.time_interval == 0 || !last_time_sync_ ||
+        current_tick - *last_time_sync_ >= options_.time_interval ||
+        (options_.time_threshold > 0 && (jump >= options_.time_threshold || -jump >= options_.time_threshold))) {
+        pending_time_.reset();
+        last_time_sync_ = current_tick;
+        return true;
+    }
+    pending_time_ = time;
+    return false;
+}
+
+std::optional<int> LevelSync::pollTime(std::uint64_t current_tick)
+{
+    if (!pending_time_ || (last_time_sync_ && current_tick - *last_time_sync_ < options_.time_interval)) {
+        return std::nullopt;
+    }
+    last_time_sync_ = current_tick;
+    auto time = pending_time_;
+    pending_time_.reset();
+    return time;
+}
+
+std::optional<int> LevelSync::getPendingTime() const
+{
+    return pending_time_;
+}
+
+bool LevelSync::isSuppressed(Weather weather, bool to_state, std::uint64_t current_tick) const
+{
+    const auto &cancelled = cancelled_[static_cast<int>(weather)];
+    return options_.weather_interval > 0 && cancelled && cancelled->to_state == to_state &&
+           current_tick - cancelled->tick < options_.weather_interval;
+}
+
+void LevelSync::recordCancelled(Weather weather, bool to_state, std::uint64_t current_tick)
+{
+    cancelled_[static_cast<int>(weather)] = CancelledChange{to_state, current_tick};
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,165 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/level/region_index.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace endstone::detail {
+
+RegionIndex::Box RegionIndex::fromBlocks(int x1, int y1, int z1, int x2, int y2, int z2)
+{
+    return {static_cast<float>(std::min(x1, x2)),     static_cast<float>(std::min(y1, y2)),
+            static_cast<float>(std::min(z1, z2)),     static_cast<float>(std::max(x1, x2)) + 1,
+            static_cast<float>(std::max(y1, y2)) + 1, static_cast<float>(std::max(z1, z2)) + 1};
+}
+
+bool RegionIndex::insert(std::string name, const Box &box)
+{
+    auto inserted = regions_.emplace(std::move(name), box).second;
+    dirty_ = dirty_ || inserted;
+    return inserted;
+}
+
+bool RegionIndex::erase(std::string_view name)
+{
+    auto it = regions_.find(name);
+    if (it == regions_.end()) {
+        return false;
+    }
+    regions_.erase(it);
+    dirty_ = true;
+    return true;
+}
+
+const RegionIndex::Box *RegionIndex::find(std::string_view name) const
+{
+    auto it = regions_.find(name);
+    if (it == regions_.end()) {
+        return nullptr;
+    }
+    return &it->second;
+}
+
+std::size_t RegionIndex::size() const
+{
+    return regions_.size();
+}
+
+std::vector<std::string> RegionIndex::query(float x, float y, float z) const
+{
+    return collect([x, y, z](const Box &box) { return box.contains(x, y, z); });
+}
+
+std::vector<std::string> RegionIndex::query(const Box &box) const
+{
+    return collect([&box](const Box &other) { return box.intersects(other); });
+}
+
+template <typename Overlaps>
+std::vector<std::string> RegionIndex::collect(Overlaps overlaps) const
+{
+    if (dirty_) {
+        build();
+    }
+
+    std::vector<std::string> result;
+    if (nodes_.empty()) {
+        return result;
+    }
+
+    std::uint32_t stack[64];
+    std::size_t top = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+        const auto &node = nodes_[stack[--top]];
+        if (!overlaps(node.bounds)) {
+            continue;
+        }
+        if (node.count > 0) {
+            for (auto i = node.first; i < node.first + node.count; i++) {
+                if (overlaps(entries_[i].box)) {
+                    result.push_back(*entries_[i].name);
+                }
+            }
+            continue;
+        }
+        stack[top++] = static_cast<std::uint32_t>(&node - nodes_.data()) + 1;
+        stack[top++] = node.first;
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+void RegionIndex::build() const
+{
+    entries_.clear();
+    entries_.reserve(regions_.size());
+    for (const auto &[name, box] : regions_) {
+        entries_.push_back({box, &name});
+    }
+    nodes_.clear();
+    if (!entries_.empty()) {
+        nodes_.reserve(2 * (entries_.size() / LeafSize + 1));
+        build(0, entries_.size());
+    }
+    dirty_ = false;
+}
+
+void RegionIndex::build(std::size_t begin, std::size_t end) const
+{
+    auto bounds = entries_[begin].box;
+    for (auto i = begin + 1; i < end; i++) {
+        const auto &box = entries_[i].box;
+        bounds = {std::min(bounds.min_x, box.min_x), std::min(bounds.min_y, box.min_y),
+                  std::min(bounds.min_z, box.min_z), std::max(bounds.max_x, box.max_x),
+                  std::max(bounds.max_y, box.max_y), std::max(bounds.max_z, box.max_z)};
+    }
+
+    auto index = nodes_.size();
+    nodes_.push_back({bounds, static_cast<std::uint32_t>(begin), static_cast<std::uint32_t>(end - begin)});
+    if (end - begin <= LeafSize) {
+        return;
+    }
+
+    // Split at the median along the longest axis, which keeps the tree balanced and its depth logarithmic
+    auto extent_x = bounds.max_x - bounds.min_x;
+    auto extent_y = bounds.max_y - bounds.min_y;
+    auto extent_z = bounds.max_z - bounds.min_z;
+    auto axis = extent_x >= extent_y && extent_x >= extent_z ? 0 : (extent_y >= extent_z ? 1 : 2);
+    auto center = [axis](const Entry &entry) {
+        const auto &box = entry.box;
+        switch (axis) {
+        case 0:
+            return box.min_x + box.max_x;
+        case 1:
+            return box.min_y + box.max_y;
+        default:
+            return box.min_z + box.max_z;
+        }
+    };
+    auto mid = begin + (end - begin) / 2;
+    std::nth_element(entries_.begin() + static_cast<std::ptrdiff_t>(begin),
+                     entries_.begin() + static_cast<std::ptrdiff_t>(mid),
+                     entries_.begin() + static_cast<std::ptrdiff_t>(end),
+                     [&center](const Entry &lhs, const Entry &rhs) { return center(lhs) < center(rhs); });
+
+    nodes_[index].count = 0;
+    build(begin, mid);
+    nodes_[index].first = static_cast<std::uint32_t>(nodes_.size());
+    build(mid, end);
+}
+
+}  // namespace endstone::detail
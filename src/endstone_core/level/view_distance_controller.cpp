@@ -0,0 +1,63 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/level/view_distance_controller.h"
+
+#include <algorithm>
+
+namespace endstone::detail {
+
+ViewDistanceController::ViewDistanceController(float target_usage) : target_usage_(target_usage) {}
+
+bool ViewDistanceController::update(std::uint64_t current_tick, float average_usage, int highest_requested)
+{
+    if (last_change_ && current_tick - *last_change_ < AdjustInterval) {
+        return false;
+    }
+
+    if (average_usage > target_usage_) {
+        // A cap above every request limits nobody, lowering it starts from the highest request instead
+        const auto current = std::min(cap_.value_or(highest_requested), highest_requested);
+        const auto next = std::max(MinDistance, current - 1);
+        if (next >= current) {
+            return false;
+        }
+        cap_ = next;
+    }
+    else if (cap_ && average_usage < target_usage_ - Hysteresis) {
+        if (*cap_ + 1 >= highest_requested) {
+            cap_.reset();
+        }
+        else {
+            cap_ = *cap_ + 1;
+        }
+    }
+    else {
+        return false;
+    }
+    last_change_ = current_tick;
+    return true;
+}
+
+std::optional<int> ViewDistanceController::getCap() const
+{
+    return cap_;
+}
+
+float ViewDistanceController::getTargetUsage() const
+{
+    return target_usage_;
+}
+
+}  // namespace endstone::detail
@@ -14,18 +14,28 @@
 
 #include "endstone/detail/logger_factory.h"
 
+#include <chrono>
+#include <cstdlib>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
 #include <spdlog/spdlog.h>
 
 #include "endstone/detail/spdlog/console_log_sink.h"
 #include "endstone/detail/spdlog/file_log_sink.h"
+#include "endstone/detail/spdlog/json_log_formatter.h"
 #include "endstone/detail/spdlog/spdlog_adapter.h"
 
 namespace endstone::detail {
 
+namespace {
+constexpr std::chrono::milliseconds FlushInterval{50};
+}  // namespace
+
 Logger &LoggerFactory::getLogger(const std::string &name)
 {
     static std::mutex mutex;
@@ -37,14 +47,54 @@ Logger &LoggerFactory::getLogger(const std::string &name)
         return it->second;
     }
 
-    static std::vector<spdlog::sink_ptr> sinks = {
-        std::make_shared<ConsoleLogSink>(stdout),
-        std::make_shared<FileLogSink>("logs/latest.log", "logs/{:%Y-%m-%d}-{}.log", 1000)};
-
-    auto console = std::make_shared<spdlog::logger>(name, std::begin(sinks), std::end(sinks));
+    auto console = std::make_shared<spdlog::logger>(name, getSink());
     spdlog::register_logger(console);
     it = loggers.emplace(name, SpdLogAdapter(console)).first;
     return it->second;
 }
 
+void LoggerFactory::setOverflowPolicy(LogOverflowPolicy policy)
+{
+    getSink()->setOverflowPolicy(policy);
+}
+
+bool LoggerFactory::flush(std::chrono::milliseconds timeout)
+{
+    return getSink()->flushFor(timeout);
+}
+
+void LoggerFactory::setRateLimit(const std::string &name, const LogRateLimit &limit)
+{
+    static_cast<SpdLogAdapter &>(getLogger(name)).setRateLimit(limit);
+}
+
+const std::shared_ptr<ConsoleLogSink> &LoggerFactory::getConsoleSink()
+{
+    static const auto console = [] {
+        auto sink = std::make_shared<ConsoleLogSink>(stdout);
+        sink->setAutoFlush(false);
+        return sink;
+    }();
+    return console;
+}
+
+const std::shared_ptr<AsyncLogSink> &LoggerFactory::getSink()
+{
+    // Console and file I/O happen on the writer thread of the sink, which flushes at most once per frame so that a
+    // burst of messages reaches the terminal in a few writes instead of one per line
+    static const auto sink = [] {
+        const auto &console = getConsoleSink();
+        auto file = std::make_shared<FileLogSink>("logs/latest.log", "logs/{:%Y-%m-%d}-{}.log", 1000,
+                                                  100 * 1024 * 1024, true);
+        // ENDSTONE_LOG_FORMAT=json writes the log file as JSON lines for log pipelines
+        if (const auto *format = std::getenv("ENDSTONE_LOG_FORMAT"); format && std::string_view(format) == "json") {
+            file->set_formatter(std::make_unique<JsonLogFormatter>());
+        }
+        auto async = std::make_shared<AsyncLogSink>(std::vector<spdlog::sink_ptr>{console, file});
+        async->setFlushInterval(FlushInterval);
+        return async;
+    }();
+    return sink;
+}
+
 }  // namespace endstone::detail
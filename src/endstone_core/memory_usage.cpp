@@ -0,0 +1,47 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/memory_usage.h"
+
+namespace endstone::detail {
+
+MemoryUsage &MemoryUsage::getInstance()
+{
+    static MemoryUsage instance;
+    return instance;
+}
+
+std::string_view MemoryUsage::getName(MemorySubsystem subsystem)
+{
+    switch (subsystem) {
+    case MemorySubsystem::Players:
+        return "Players";
+    case MemorySubsystem::Forms:
+        return "Forms";
+    case MemorySubsystem::Scoreboards:
+        return "Scoreboards";
+    case MemorySubsystem::Tasks:
+        return "Tasks";
+    case MemorySubsystem::EventHandlers:
+        return "Event handlers";
+    case MemorySubsystem::Permissions:
+        return "Permissions";
+    case MemorySubsystem::LogBuffers:
+        return "Log buffers";
+    default:
+        return "Unknown";
+    }
+}
+
+}  // namespace endstone::detail
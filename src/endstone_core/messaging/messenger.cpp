@@ -0,0 +1,308 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/messaging/messenger.h"
+
+#include <algorithm>
+#include <deque>
+#include <exception>
+#include <future>
+#include <mutex>
+#include <random>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "endstone/plugin/plugin.h"
+
+namespace endstone::detail {
+
+namespace {
+std::string makeServerId()
+{
+    std::random_device device;
+    std::uniform_int_distribution<unsigned int> distribution(0, 0xFFFF);
+    return fmt::format("{:04x}{:04x}{:04x}{:04x}", distribution(device), distribution(device), distribution(device),
+                       distribution(device));
+}
+}  // namespace
+
+/**
+ * The part of the messenger shared with the I/O workers. Operations run one at a time, so only they touch the
+ * transport, and a message is published with the ID of its server followed by a null byte.
+ */
+struct EndstoneMessenger::State {
+    State(Logger &logger, std::string server_id) : logger(logger), server_id(std::move(server_id)) {}
+
+    static void drain(const std::shared_ptr<State> &state)
+    {
+        while (true) {
+            std::function<void(State &)> operation;
+            {
+                std::lock_guard lock(state->mutex);
+                if (state->operations.empty()) {
+                    state->draining = false;
+                    return;
+                }
+                operation = std::move(state->operations.front());
+                state->operations.pop_front();
+            }
+            try {
+                operation(*state);
+            }
+            catch (const std::exception &e) {
+                state->logger.error("The message transport failed: {}", e.what());
+            }
+        }
+    }
+
+    void receive(const std::string &channel, const std::string &payload)
+    {
+        const auto separator = payload.find('\0');
+        if (separator == std::string::npos || payload.compare(0, separator, server_id) == 0) {
+            return;
+        }
+        std::lock_guard lock(received_mutex);
+        if (received.size() >= MaxQueuedMessages) {
+            ++dropped;
+            return;
+        }
+        received.emplace_back(channel, payload.substr(separator + 1));
+    }
+
+    Logger &logger;
+    const std::string server_id;
+
+    std::mutex mutex;
+    std::deque<std::function<void(State &)>> operations;
+    bool draining = false;
+    std::shared_ptr<MessageTransport> transport;
+
+    std::mutex received_mutex;
+    std::vector<std::pair<std::string, std::string>> received;
+    std::size_t dropped = 0;
+};
+
+EndstoneMessenger::EndstoneMessenger(ThreadPoolExecutor &executor, Logger &logger, std::string server_id)
+    : executor_(executor), logger_(logger),
+      state_(std::make_shared<State>(logger, server_id.empty() ? makeServerId() : std::move(server_id)))
+{
+}
+
+EndstoneMessenger::~EndstoneMessenger()
+{
+    close();
+}
+
+void EndstoneMessenger::publish(const std::string &channel, std::string message)
+{
+    auto payload = state_->server_id;
+    payload.push_back('\0');
+    payload += message;
+    post([channel, payload = std::move(payload)](State &state) {
+        if (state.transport) {
+            state.transport->publish(channel, payload);
+        }
+    });
+}
+
+void EndstoneMessenger::subscribe(Plugin &plugin, const std::string &channel, Handler handler)
+{
+    addSubscriber(channel, &plugin, std::move(handler));
+}
+
+void EndstoneMessenger::unsubscribe(Plugin &plugin, const std::string &channel)
+{
+    removeSubscriber(channel, plugin);
+}
+
+void EndstoneMessenger::unregister(Plugin &plugin)
+{
+    std::vector<std::string> channels;
+    for (const auto &[channel, subscribers] : subscriptions_) {
+        channels.push_back(channel);
+    }
+    for (const auto &channel : channels) {
+        removeSubscriber(channel, plugin);
+    }
+    if (transport_owner_ == &plugin) {
+        transport_owner_ = nullptr;
+        // The code of the transport may be unloaded along with the plugin once this returns
+        replaceTransport(default_factory_ ? default_factory_() : nullptr, true);
+    }
+}
+
+void EndstoneMessenger::setTransport(Plugin &plugin, std::unique_ptr<MessageTransport> transport)
+{
+    if (closed_) {
+        return;
+    }
+    // The previous transport may belong to a plugin too, so it is gone before this returns
+    transport_owner_ = &plugin;
+    replaceTransport(std::move(transport), true);
+}
+
+std::string EndstoneMessenger::getServerId() const
+{
+    return state_->server_id;
+}
+
+void EndstoneMessenger::subscribeServer(const std::string &channel, Handler handler)
+{
+    addSubscriber(channel, nullptr, std::move(handler));
+}
+
+void EndstoneMessenger::setDefaultTransport(TransportFactory factory)
+{
+    if (closed_) {
+        return;
+    }
+    default_factory_ = std::move(factory);
+    if (!transport_owner_) {
+        replaceTransport(default_factory_ ? default_factory_() : nullptr, false);
+    }
+}
+
+void EndstoneMessenger::tick()
+{
+    std::vector<std::pair<std::string, std::string>> received;
+    std::size_t dropped;
+    {
+        std::lock_guard lock(state_->received_mutex);
+        received.swap(state_->received);
+        dropped = std::exchange(state_->dropped, 0);
+    }
+    if (dropped > 0) {
+        logger_.warning("{} messages were dropped because the message queue was full.", dropped);
+    }
+
+    for (const auto &[channel, message] : received) {
+        auto it = subscriptions_.find(channel);
+        if (it == subscriptions_.end()) {
+            continue;
+        }
+        // Handlers may subscribe or unsubscribe while the message is handed out
+        const auto subscribers = it->second;
+        for (const auto &subscriber : subscribers) {
+            if (subscriber.plugin && !subscriber.plugin->isEnabled()) {
+                continue;
+            }
+            try {
+                subscriber.handler(channel, message);
+            }
+            catch (const std::exception &e) {
+                logger_.error("Could not pass a message on channel {} to {}: {}", channel,
+                              subscriber.plugin ? subscriber.plugin->getName() : "the server", e.what());
+            }
+        }
+    }
+}
+
+void EndstoneMessenger::close()
+{
+    if (closed_) {
+        return;
+    }
+    closed_ = true;
+    default_factory_ = nullptr;
+    transport_owner_ = nullptr;
+    replaceTransport(nullptr, true);
+}
+
+void EndstoneMessenger::post(std::function<void(State &)> operation)
+{
+    {
+        std::lock_guard lock(state_->mutex);
+        state_->operations.push_back(std::move(operation));
+        if (state_->draining) {
+            return;
+        }
+        state_->draining = true;
+    }
+    executor_.execute([state = state_]() { State::drain(state); });
+}
+
+void EndstoneMessenger::replaceTransport(std::unique_ptr<MessageTransport> transport, bool wait)
+{
+    std::vector<std::string> channels;
+    for (const auto &[channel, subscribers] : subscriptions_) {
+        channels.push_back(channel);
+    }
+    auto done = std::make_shared<std::promise<void>>();
+    auto future = done->get_future();
+    std::shared_ptr<MessageTransport> next = std::move(transport);
+    post([next, channels = std::move(channels), done](State &state) {
+        try {
+            if (auto previous = std::move(state.transport)) {
+                previous->stop();
+            }
+            if (next) {
+                next->start([&state](const std::string &channel, const std::string &payload) {
+                    state.receive(channel, payload);
+                });
+                for (const auto &channel : channels) {
+                    next->subscribe(channel);
+                }
+                state.transport = next;
+            }
+        }
+        catch (const std::exception &e) {
+            state.logger.error("Unable to replace the message transport: {}", e.what());
+        }
+        done->set_value();
+    });
+    if (wait && future.wait_for(StopTimeout) != std::future_status::ready) {
+        logger_.error("The message transport did not stop within {} seconds.", StopTimeout.count());
+    }
+}
+
+void EndstoneMessenger::addSubscriber(const std::string &channel, Plugin *plugin, Handler handler)
+{
+    auto &subscribers = subscriptions_[channel];
+    if (subscribers.empty()) {
+        post([channel](State &state) {
+            if (state.transport) {
+                state.transport->subscribe(channel);
+            }
+        });
+    }
+    auto it = std::find_if(subscribers.begin(), subscribers.end(), [&](const auto &s) { return s.plugin == plugin; });
+    if (it != subscribers.end()) {
+        it->handler = std::move(handler);
+        return;
+    }
+    subscribers.push_back({plugin, std::move(handler)});
+}
+
+void EndstoneMessenger::removeSubscriber(const std::string &channel, const Plugin &plugin)
+{
+    auto it = subscriptions_.find(channel);
+    if (it == subscriptions_.end()) {
+        return;
+    }
+    auto &subscribers = it->second;
+    subscribers.erase(std::remove_if(subscribers.begin(), subscribers.end(),
+                                     [&](const auto &s) { return s.plugin == &plugin; }),
+                      subscribers.end());
+    if (subscribers.empty()) {
+        subscriptions_.erase(it);
+        post([channel](State &state) {
+            if (state.transport) {
+                state.transport->unsubscribe(channel);
+            }
+        });
+    }
+}
+
+}  // namespace endstone::detail
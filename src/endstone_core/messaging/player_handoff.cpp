@@ -0,0 +1,138 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/messaging/player_handoff.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+namespace endstone::detail {
+
+namespace {
+void writeU32(std::string &out, std::uint32_t value)
+{
+    for (auto i = 0; i < 4; i++) {
+        out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+void writeString(std::string &out, const std::string &value)
+{
+    writeU32(out, static_cast<std::uint32_t>(value.size()));
+    out += value;
+}
+
+class Reader {
+public:
+    explicit Reader(const std::string &in) : in_(in) {}
+
+    std::optional<std::uint32_t> readU32()
+    {
+        if (in_.size() - offset_ < 4) {
+            return std::nullopt;
+        }
+        std::uint32_t value = 0;
+        for (auto i = 0; i < 4; i++) {
+            value |= static_cast<std::uint32_t>(static_cast<unsigned char>(in_[offset_ + i])) << (8 * i);
+        }
+        offset_ += 4;
+        return value;
+    }
+
+    std::optional<std::string> readString()
+    {
+        auto size = readU32();
+        if (!size || in_.size() - offset_ < *size) {
+            return std::nullopt;
+        }
+        auto value = in_.substr(offset_, *size);
+        offset_ += *size;
+        return value;
+    }
+
+    bool readUUID(UUID &uuid)
+    {
+        if (in_.size() - offset_ < UUID::size()) {
+            return false;
+        }
+        std::copy_n(in_.data() + offset_, UUID::size(), reinterpret_cast<char *>(uuid.begin()));
+        offset_ += UUID::size();
+        return true;
+    }
+
+    [[nodiscard]] bool atEnd() const
+    {
+        return offset_ == in_.size();
+    }
+
+private:
+    const std::string &in_;
+    std::size_t offset_ = 0;
+};
+}  // namespace
+
+std::string PlayerHandoff::getChannel(const std::string &server_id)
+{
+    return "endstone:handoff:" + server_id;
+}
+
+std::string PlayerHandoff::encode() const
+{
+    std::string out;
+    writeU32(out, Version);
+    out.append(reinterpret_cast<const char *>(player_id.begin()), UUID::size());
+    writeString(out, player_name);
+    writeString(out, source_server_id);
+    writeU32(out, static_cast<std::uint32_t>(entries.size()));
+    for (const auto &entry : entries) {
+        writeString(out, entry.plugin);
+        writeString(out, entry.key);
+        writeString(out, entry.value);
+    }
+    return out;
+}
+
+std::optional<PlayerHandoff> PlayerHandoff::decode(const std::string &message)
+{
+    Reader reader(message);
+    PlayerHandoff handoff;
+    if (reader.readU32() != Version || !reader.readUUID(handoff.player_id)) {
+        return std::nullopt;
+    }
+    auto player_name = reader.readString();
+    auto source_server_id = reader.readString();
+    auto count = reader.readU32();
+    if (!player_name || !source_server_id || !count) {
+        return std::nullopt;
+    }
+    handoff.player_name = std::move(*player_name);
+    handoff.source_server_id = std::move(*source_server_id);
+    for (std::uint32_t i = 0; i < *count; i++) {
+        auto plugin = reader.readString();
+        auto key = reader.readString();
+        auto value = reader.readString();
+        // A NUL in the name of a plugin would let its entries pass for those of another player
+        if (!plugin || !key || !value || plugin->find('\0') != std::string::npos) {
+            return std::nullopt;
+        }
+        handoff.entries.push_back({std::move(*plugin), std::move(*key), std::move(*value)});
+    }
+    if (!reader.atEnd()) {
+        return std::nullopt;
+    }
+    return handoff;
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,146 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/messaging/udp_multicast_transport.h"
+
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <boost/asio.hpp>
+#include <fmt/format.h>
+
+namespace endstone::detail {
+
+namespace asio = boost::asio;
+using asio::ip::udp;
+
+// A datagram is the length of the channel name in two bytes, big-endian, then the name and then the payload
+struct UdpMulticastTransport::Impl {
+    Impl(std::string group, std::uint16_t port) : group(std::move(group)), port(port), socket(io_context) {}
+
+    void receive()
+    {
+        socket.async_receive_from(asio::buffer(buffer), sender, [this](const boost::system::error_code &ec,
+                                                                       std::size_t size) {
+            if (ec == asio::error::operation_aborted || !socket.is_open()) {
+                return;
+            }
+            if (!ec && size >= 2) {
+                const auto length = (static_cast<std::size_t>(buffer[0]) << 8) | buffer[1];
+                if (2 + length <= size) {
+                    std::string channel(reinterpret_cast<const char *>(buffer.data()) + 2, length);
+                    bool subscribed;
+                    {
+                        std::lock_guard lock(mutex);
+                        subscribed = channels.find(channel) != channels.end();
+                    }
+                    if (subscribed) {
+                        receiver(channel, std::string(reinterpret_cast<const char *>(buffer.data()) + 2 + length,
+                                                      size - 2 - length));
+                    }
+                }
+            }
+            receive();
+        });
+    }
+
+    const std::string group;
+    const std::uint16_t port;
+    asio::io_context io_context;
+    udp::socket socket;
+    udp::endpoint destination;
+    udp::endpoint sender;
+    std::vector<unsigned char> buffer = std::vector<unsigned char>(MaxDatagramSize);
+    Receiver receiver;
+    std::mutex mutex;
+    std::unordered_set<std::string> channels;
+    std::thread thread;
+};
+
+UdpMulticastTransport::UdpMulticastTransport(std::string group, std::uint16_t port)
+    : impl_(std::make_unique<Impl>(std::move(group), port))
+{
+}
+
+UdpMulticastTransport::~UdpMulticastTransport()
+{
+    stop();
+}
+
+void UdpMulticastTransport::start(Receiver receiver)
+{
+    const auto address = asio::ip::make_address(impl_->group);
+    if (!address.is_multicast()) {
+        throw std::invalid_argument(fmt::format("{} is not a multicast address", impl_->group));
+    }
+    impl_->receiver = std::move(receiver);
+    impl_->destination = udp::endpoint{address, impl_->port};
+    const udp::endpoint listen{address.is_v4() ? udp::v4() : udp::v6(), impl_->port};
+    impl_->socket.open(listen.protocol());
+    impl_->socket.set_option(udp::socket::reuse_address(true));
+    impl_->socket.bind(listen);
+    // Servers on the same host receive each other's messages through the loopback
+    impl_->socket.set_option(asio::ip::multicast::enable_loopback(true));
+    impl_->socket.set_option(asio::ip::multicast::join_group(address));
+    impl_->receive();
+    impl_->thread = std::thread([this]() { impl_->io_context.run(); });
+}
+
+void UdpMulticastTransport::stop()
+{
+    if (!impl_->thread.joinable()) {
+        return;
+    }
+    impl_->io_context.stop();
+    impl_->thread.join();
+    boost::system::error_code ignored;
+    impl_->socket.close(ignored);
+}
+
+void UdpMulticastTransport::subscribe(const std::string &channel)
+{
+    std::lock_guard lock(impl_->mutex);
+    impl_->channels.insert(channel);
+}
+
+void UdpMulticastTransport::unsubscribe(const std::string &channel)
+{
+    std::lock_guard lock(impl_->mutex);
+    impl_->channels.erase(channel);
+}
+
+void UdpMulticastTransport::publish(const std::string &channel, const std::string &payload)
+{
+    if (channel.size() > 0xFFFF || 2 + channel.size() + payload.size() > MaxDatagramSize) {
+        throw std::length_error(
+            fmt::format("A message of {} bytes on channel {} does not fit in a datagram", payload.size(), channel));
+    }
+    auto datagram = std::make_shared<std::string>();
+    datagram->reserve(2 + channel.size() + payload.size());
+    datagram->push_back(static_cast<char>((channel.size() >> 8) & 0xFF));
+    datagram->push_back(static_cast<char>(channel.size() & 0xFF));
+    *datagram += channel;
+    *datagram += payload;
+    // Sent from the thread of the socket, which is not safe to use from two threads at once
+    asio::post(impl_->io_context, [impl = impl_.get(), datagram]() {
+        boost::system::error_code ignored;
+        impl->socket.send_to(asio::buffer(*datagram), impl->destination, 0, ignored);
+    });
+}
+
+}  // namespace endstone::detail
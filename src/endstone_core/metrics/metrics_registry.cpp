@@ -0,0 +1,200 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/metrics/metrics_registry.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+namespace endstone::detail {
+
+namespace {
+std::string escapeLabelValue(const std::string &value)
+{
+    std::string result;
+    result.reserve(value.size());
+    for (const auto c : value) {
+        switch (c) {
+        case '\\':
+            result += "\\\\";
+            break;
+        case '"':
+            result += "\\\"";
+            break;
+        case '\n':
+            result += "\\n";
+            break;
+        default:
+            result += c;
+        }
+    }
+    return result;
+}
+
+std::string formatLabels(const MetricsRegistry::Labels &labels)
+{
+    std::string result;
+    for (const auto &[key, value] : labels) {
+        result += fmt::format("{}{}=\"{}\"", result.empty() ? "" : ",", key, escapeLabelValue(value));
+    }
+    return result;
+}
+
+std::string formatValue(double value)
+{
+    if (std::isnan(value)) {
+        return "NaN";
+    }
+    if (std::isinf(value)) {
+        return value > 0 ? "+Inf" : "-Inf";
+    }
+    return fmt::format("{}", value);
+}
+
+// Appends a label to the serialized labels of a metric, for the buckets of a histogram
+std::string withLabel(const std::string &labels, const std::string &label)
+{
+    return "{" + labels + (labels.empty() ? "" : ",") + label + "}";
+}
+
+std::string braced(const std::string &labels)
+{
+    return labels.empty() ? "" : "{" + labels + "}";
+}
+}  // namespace
+
+std::uint64_t Counter::value() const noexcept
+{
+    std::uint64_t result = 0;
+    for (const auto &shard : shards_) {
+        result += shard.value.load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+Histogram::Histogram(std::vector<double> bounds) : bounds_(std::move(bounds))
+{
+    if (bounds_.size() > MaxBuckets) {
+        throw std::invalid_argument(fmt::format("A histogram has at most {} buckets.", MaxBuckets));
+    }
+    if (!std::is_sorted(bounds_.begin(), bounds_.end())) {
+        throw std::invalid_argument("The bounds of a histogram must be in ascending order.");
+    }
+}
+
+void Histogram::observe(double value) noexcept
+{
+    auto &shard = shards_[metrics::getShardIndex()];
+    const auto bucket = std::lower_bound(bounds_.begin(), bounds_.end(), value) - bounds_.begin();
+    shard.counts[bucket].fetch_add(1, std::memory_order_relaxed);
+
+    // Only this thread's shard, so the loop rarely retries
+    auto sum = shard.sum.load(std::memory_order_relaxed);
+    while (!shard.sum.compare_exchange_weak(sum, sum + value, std::memory_order_relaxed)) {
+    }
+}
+
+Histogram::Snapshot Histogram::snapshot() const
+{
+    Snapshot result{bounds_, std::vector<std::uint64_t>(bounds_.size() + 1, 0), 0.0};
+    for (const auto &shard : shards_) {
+        for (std::size_t i = 0; i <= bounds_.size(); ++i) {
+            result.counts[i] += shard.counts[i].load(std::memory_order_relaxed);
+        }
+        result.sum += shard.sum.load(std::memory_order_relaxed);
+    }
+    for (std::size_t i = 1; i < result.counts.size(); ++i) {
+        result.counts[i] += result.counts[i - 1];
+    }
+    return result;
+}
+
+MetricsRegistry &MetricsRegistry::getInstance()
+{
+    static MetricsRegistry instance;
+    return instance;
+}
+
+Counter &MetricsRegistry::counter(const std::string &name, const std::string &help, const Labels &labels)
+{
+    return getOrCreate<Counter>(name, help, labels);
+}
+
+Gauge &MetricsRegistry::gauge(const std::string &name, const std::string &help, const Labels &labels)
+{
+    return getOrCreate<Gauge>(name, help, labels);
+}
+
+Histogram &MetricsRegistry::histogram(const std::string &name, const std::string &help, std::vector<double> bounds,
+                                      const Labels &labels)
+{
+    return getOrCreate<Histogram>(name, help, labels, std::move(bounds));
+}
+
+template <typename T, typename... Args>
+T &MetricsRegistry::getOrCreate(const std::string &name, const std::string &help, const Labels &labels,
+                                Args &&...args)
+{
+    std::lock_guard lock{mutex_};
+    const auto type = Metric(std::unique_ptr<T>()).index();
+    auto [family, inserted] = families_.try_emplace(name, Family{help, type, {}});
+    if (!inserted && family->second.type != type) {
+        throw std::invalid_argument(fmt::format("A metric of another type is named {}.", name));
+    }
+
+    auto &metric = family->second.metrics.try_emplace(formatLabels(labels), std::unique_ptr<T>()).first->second;
+    auto *existing = std::get_if<std::unique_ptr<T>>(&metric);
+    if (!*existing) {
+        *existing = std::make_unique<T>(std::forward<Args>(args)...);
+    }
+    return **existing;
+}
+
+std::string MetricsRegistry::serialize() const
+{
+    std::lock_guard lock{mutex_};
+    std::string result;
+    auto out = std::back_inserter(result);
+    for (const auto &[name, family] : families_) {
+        static constexpr const char *Types[] = {"counter", "gauge", "histogram"};
+        fmt::format_to(out, "# HELP {} {}\n# TYPE {} {}\n", name, family.help, name, Types[family.type]);
+        for (const auto &[labels, metric] : family.metrics) {
+            if (const auto *counter = std::get_if<std::unique_ptr<Counter>>(&metric)) {
+                fmt::format_to(out, "{}{} {}\n", name, braced(labels), (*counter)->value());
+            }
+            else if (const auto *gauge = std::get_if<std::unique_ptr<Gauge>>(&metric)) {
+                fmt::format_to(out, "{}{} {}\n", name, braced(labels), formatValue((*gauge)->value()));
+            }
+            else if (const auto *histogram = std::get_if<std::unique_ptr<Histogram>>(&metric)) {
+                const auto snapshot = (*histogram)->snapshot();
+                for (std::size_t i = 0; i < snapshot.bounds.size(); ++i) {
+                    fmt::format_to(out, "{}_bucket{} {}\n", name,
+                                   withLabel(labels, "le=\"" + formatValue(snapshot.bounds[i]) + "\""),
+                                   snapshot.counts[i]);
+                }
+                fmt::format_to(out, "{}_bucket{} {}\n", name, withLabel(labels, "le=\"+Inf\""),
+                               snapshot.counts.back());
+                fmt::format_to(out, "{}_sum{} {}\n", name, braced(labels), formatValue(snapshot.sum));
+                fmt::format_to(out, "{}_count{} {}\n", name, braced(labels), snapshot.counts.back());
+            }
+        }
+    }
+    return result;
+}
+
+}  // namespace endstone::detail
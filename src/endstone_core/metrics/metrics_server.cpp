@@ -0,0 +1,162 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/metrics/metrics_server.h"
+
+#include <chrono>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+
+#include <boost/asio.hpp>
+#include <fmt/format.h>
+
+namespace endstone::detail {
+
+namespace asio = boost::asio;
+using asio::ip::tcp;
+
+namespace {
+constexpr std::chrono::seconds RequestTimeout{5};
+constexpr std::size_t MaxRequestSize = 8192;
+
+/**
+ * One request per connection, the connection is closed once the response is written.
+ */
+class Connection : public std::enable_shared_from_this<Connection> {
+public:
+    Connection(tcp::socket socket, const MetricsRegistry &registry)
+        : socket_(std::move(socket)), timer_(socket_.get_executor()), buffer_(MaxRequestSize), registry_(registry)
+    {
+    }
+
+    void start()
+    {
+        timer_.expires_after(RequestTimeout);
+        timer_.async_wait([self = shared_from_this()](const boost::system::error_code &ec) {
+            if (!ec) {
+                boost::system::error_code ignored;
+                self->socket_.close(ignored);
+            }
+        });
+        asio::async_read_until(socket_, buffer_, "\r\n\r\n",
+                               [self = shared_from_this()](const boost::system::error_code &ec, std::size_t size) {
+                                   if (!ec) {
+                                       self->respond(size);
+                                   }
+                                   else {
+                                       self->timer_.cancel();
+                                   }
+                               });
+    }
+
+private:
+    void respond(std::size_t size)
+    {
+        const std::string_view request{static_cast<const char *>(buffer_.data().data()), size};
+        const auto line = request.substr(0, request.find("\r\n"));
+        if (line.rfind("GET /metrics ", 0) == 0 || line.rfind("GET /metrics?", 0) == 0) {
+            write("200 OK", "text/plain; version=0.0.4; charset=utf-8", registry_.serialize());
+        }
+        else if (line.rfind("GET ", 0) == 0) {
+            write("404 Not Found", "text/plain; charset=utf-8", "Metrics are served at /metrics.\n");
+        }
+        else {
+            write("405 Method Not Allowed", "text/plain; charset=utf-8", "Only GET is allowed.\n");
+        }
+    }
+
+    void write(std::string_view status, std::string_view content_type, const std::string &body)
+    {
+        response_ = fmt::format("HTTP/1.1 {}\r\nContent-Type: {}\r\nContent-Length: {}\r\nConnection: close\r\n\r\n{}",
+                                status, content_type, body.size(), body);
+        asio::async_write(socket_, asio::buffer(response_),
+                          [self = shared_from_this()](const boost::system::error_code &, std::size_t) {
+                              self->timer_.cancel();
+                              boost::system::error_code ignored;
+                              self->socket_.shutdown(tcp::socket::shutdown_both, ignored);
+                          });
+    }
+
+    tcp::socket socket_;
+    asio::steady_timer timer_;
+    asio::streambuf buffer_;
+    std::string response_;
+    const MetricsRegistry &registry_;
+};
+}  // namespace
+
+struct MetricsServer::Impl {
+    Impl(const MetricsRegistry &registry, const std::string &host, std::uint16_t port)
+        : registry(registry), acceptor(io_context)
+    {
+        boost::system::error_code ec;
+        const auto address = asio::ip::make_address(host, ec);
+        if (!ec) {
+            const tcp::endpoint endpoint{address, port};
+            acceptor.open(endpoint.protocol(), ec);
+            if (!ec) {
+                acceptor.set_option(tcp::acceptor::reuse_address(true), ec);
+                acceptor.bind(endpoint, ec);
+            }
+            if (!ec) {
+                acceptor.listen(asio::socket_base::max_listen_connections, ec);
+            }
+        }
+        if (ec) {
+            throw std::runtime_error(fmt::format("Unable to listen on {}:{}: {}", host, port, ec.message()));
+        }
+        accept();
+        thread = std::thread([this]() { io_context.run(); });
+    }
+
+    ~Impl()
+    {
+        io_context.stop();
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+
+    void accept()
+    {
+        acceptor.async_accept([this](const boost::system::error_code &ec, tcp::socket socket) {
+            if (!ec) {
+                std::make_shared<Connection>(std::move(socket), registry)->start();
+            }
+            if (acceptor.is_open()) {
+                accept();
+            }
+        });
+    }
+
+    const MetricsRegistry &registry;
+    asio::io_context io_context;
+    tcp::acceptor acceptor;
+    std::thread thread;
+};
+
+MetricsServer::MetricsServer(const MetricsRegistry &registry, const std::string &host, std::uint16_t port)
+    : impl_(std::make_unique<Impl>(registry, host, port))
+{
+}
+
+MetricsServer::~MetricsServer() = default;
+
+std::uint16_t MetricsServer::getPort() const
+{
+    return impl_->acceptor.local_endpoint().port();
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,161 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/movement_tracker.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace endstone::detail {
+
+std::size_t MovementTracker::addSlot()
+{
+    std::size_t slot;
+    if (!free_slots_.empty()) {
+        slot = free_slots_.back();
+        free_slots_.pop_back();
+    }
+    else {
+        slot = getCapacity();
+        const auto capacity = slot + 1;
+        for (auto *rows : {&x_, &y_, &z_, &speed_, &acceleration_}) {
+            for (auto &row : *rows) {
+                row.resize(capacity);
+            }
+        }
+        vertical_speed_.resize(capacity);
+        peak_speed_.resize(capacity);
+        peak_acceleration_.resize(capacity);
+        samples_.resize(capacity);
+        recorded_.resize(capacity);
+        dimension_.resize(capacity);
+        in_use_.resize(capacity);
+    }
+    in_use_[slot] = 1;
+    reset(slot);
+    return slot;
+}
+
+void MovementTracker::removeSlot(std::size_t slot)
+{
+    in_use_[slot] = 0;
+    reset(slot);
+    free_slots_.push_back(slot);
+}
+
+void MovementTracker::reset(std::size_t slot)
+{
+    samples_[slot] = 0;
+    recorded_[slot] = 0;
+    for (std::size_t row = 0; row < HistoryTicks; row++) {
+        speed_[row][slot] = 0;
+        acceleration_[row][slot] = 0;
+    }
+    vertical_speed_[slot] = 0;
+    peak_speed_[slot] = 0;
+    peak_acceleration_[slot] = 0;
+}
+
+void MovementTracker::record(std::size_t slot, float x, float y, float z, int dimension)
+{
+    if (samples_[slot] > 0 && dimension_[slot] != dimension) {
+        reset(slot);
+    }
+    dimension_[slot] = dimension;
+    x_[head_][slot] = x;
+    y_[head_][slot] = y;
+    z_[head_][slot] = z;
+    recorded_[slot] = 1;
+}
+
+void MovementTracker::advance()
+{
+    const auto capacity = getCapacity();
+    for (std::size_t slot = 0; slot < capacity; slot++) {
+        if (recorded_[slot]) {
+            samples_[slot] = std::min(samples_[slot] + 1, 3U);
+        }
+        else if (samples_[slot] > 0) {
+            reset(slot);
+        }
+    }
+
+    // Branchless over the slots: the speeds a slot has too few positions for are multiplied by zero
+    const auto previous = previousRow();
+    const float *x0 = x_[previous].data();
+    const float *y0 = y_[previous].data();
+    const float *z0 = z_[previous].data();
+    const float *x1 = x_[head_].data();
+    const float *y1 = y_[head_].data();
+    const float *z1 = z_[head_].data();
+    const float *previous_speed = speed_[previous].data();
+    const std::uint32_t *samples = samples_.data();
+    float *speed = speed_[head_].data();
+    float *acceleration = acceleration_[head_].data();
+    float *vertical_speed = vertical_speed_.data();
+    for (std::size_t slot = 0; slot < capacity; slot++) {
+        const auto has_speed = static_cast<float>(samples[slot] >= 2);
+        const auto has_acceleration = static_cast<float>(samples[slot] >= 3);
+        const auto dx = x1[slot] - x0[slot];
+        const auto dz = z1[slot] - z0[slot];
+        const auto horizontal = std::sqrt((dx * dx) + (dz * dz)) * TicksPerSecond * has_speed;
+        speed[slot] = horizontal;
+        vertical_speed[slot] = (y1[slot] - y0[slot]) * TicksPerSecond * has_speed;
+        acceleration[slot] = std::fabs(horizontal - previous_speed[slot]) * TicksPerSecond * has_acceleration;
+    }
+
+    float *peak_speed = peak_speed_.data();
+    float *peak_acceleration = peak_acceleration_.data();
+    std::fill(peak_speed, peak_speed + capacity, 0.0F);
+    std::fill(peak_acceleration, peak_acceleration + capacity, 0.0F);
+    for (std::size_t row = 0; row < HistoryTicks; row++) {
+        const float *row_speed = speed_[row].data();
+        const float *row_acceleration = acceleration_[row].data();
+        for (std::size_t slot = 0; slot < capacity; slot++) {
+            peak_speed[slot] = std::max(peak_speed[slot], row_speed[slot]);
+            peak_acceleration[slot] = std::max(peak_acceleration[slot], row_acceleration[slot]);
+        }
+    }
+
+    std::fill(recorded_.begin(), recorded_.end(), 0);
+    head_ = (head_ + 1) % HistoryTicks;
+}
+
+MovementStats MovementTracker::getStats(std::size_t slot) const
+{
+    return {speed_[previousRow()][slot], vertical_speed_[slot], peak_speed_[slot], peak_acceleration_[slot]};
+}
+
+std::vector<std::size_t> MovementTracker::findAnomalies(float max_speed, float max_acceleration) const
+{
+    std::vector<std::size_t> result;
+    for (std::size_t slot = 0; slot < getCapacity(); slot++) {
+        if (in_use_[slot] && (peak_speed_[slot] > max_speed || peak_acceleration_[slot] > max_acceleration)) {
+            result.push_back(slot);
+        }
+    }
+    return result;
+}
+
+std::size_t MovementTracker::getCapacity() const
+{
+    return in_use_.size();
+}
+
+std::size_t MovementTracker::previousRow() const
+{
+    return (head_ + HistoryTicks - 1) % HistoryTicks;
+}
+
+}  // namespace endstone::detail
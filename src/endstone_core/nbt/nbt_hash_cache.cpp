@@ -0,0 +1,54 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/nbt/nbt_hash_cache.h"
+
+namespace endstone::detail {
+
+std::uint64_t NbtHashCache::hash(const Tag &tag)
+{
+    auto [it, inserted] = hashes_.try_emplace(&tag, 0);
+    if (inserted) {
+        it->second = tag.hash();
+    }
+    return it->second;
+}
+
+bool NbtHashCache::equals(const Tag &lhs, const Tag &rhs)
+{
+    if (&lhs == &rhs) {
+        return true;
+    }
+    if (lhs.getId() != rhs.getId() || hash(lhs) != hash(rhs)) {
+        return false;
+    }
+    return lhs.equals(rhs);
+}
+
+void NbtHashCache::invalidate(const Tag &tag)
+{
+    hashes_.erase(&tag);
+}
+
+void NbtHashCache::clear()
+{
+    hashes_.clear();
+}
+
+std::size_t NbtHashCache::size() const
+{
+    return hashes_.size();
+}
+
+}  // namespace endstone::detail
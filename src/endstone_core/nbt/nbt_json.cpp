@@ -0,0 +1,265 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/nbt/nbt_json.h"
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+
+#include "endstone/detail/base64.h"
+#include "endstone/detail/nbt/nbt_reader.h"
+
+namespace endstone::detail::NbtJson {
+
+void write(JsonWriter &writer, const Tag &tag)  // NOLINT(*-no-recursion)
+{
+    switch (tag.getId()) {
+    case Tag::Type::Byte:
+        writer.value(static_cast<int>(static_cast<const ByteTag &>(tag).data));
+        break;
+    case Tag::Type::Short:
+        writer.value(static_cast<int>(static_cast<const ShortTag &>(tag).data));
+        break;
+    case Tag::Type::Int:
+        writer.value(static_cast<const IntTag &>(tag).data);
+        break;
+    case Tag::Type::Int64:
+        writer.value(static_cast<const Int64Tag &>(tag).data);
+        break;
+    case Tag::Type::Float:
+        writer.value(static_cast<const FloatTag &>(tag).data);
+        break;
+    case Tag::Type::Double:
+        writer.value(static_cast<const DoubleTag &>(tag).data);
+        break;
+    case Tag::Type::ByteArray: {
+        const auto &data = static_cast<const ByteArrayTag &>(tag).data;
+        writer.value(base64_encode<std::string>(data.begin(), data.end()));
+        break;
+    }
+    case Tag::Type::String:
+        writer.value(static_cast<const StringTag &>(tag).data);
+        break;
+    case Tag::Type::List: {
+        const auto &list = static_cast<const ListTag &>(tag);
+        writer.beginArray();
+        for (std::size_t i = 0; i < list.size(); ++i) {
+            write(writer, *list.get(i));
+        }
+        writer.endArray();
+        break;
+    }
+    case Tag::Type::Compound:
+        writer.beginObject();
+        for (const auto &[key, value] : static_cast<const CompoundTag &>(tag)) {
+            writer.key(key);
+            write(writer, *value.get());
+        }
+        writer.endObject();
+        break;
+    case Tag::Type::IntArray:
+        writer.beginArray();
+        for (auto value : static_cast<const IntArrayTag &>(tag).data) {
+            writer.value(value);
+        }
+        writer.endArray();
+        break;
+    case Tag::Type::End:
+    default:
+        writer.null();
+        break;
+    }
+}
+
+std::string toJson(const Tag &tag)
+{
+    std::string out;
+    JsonWriter writer{out};
+    write(writer, tag);
+    return out;
+}
+
+namespace {
+
+// Builds tags straight from the parser events, each container is inserted into its parent before it is filled so
+// that nothing is moved once built
+class TagBuilder : public nlohmann::json_sax<nlohmann::json> {
+public:
+    bool null() override
+    {
+        if (!stack_.empty() && stack_.back().tag->getId() == Tag::Type::Compound) {
+            return true;
+        }
+        return fail("null has no NBT equivalent inside an array");
+    }
+
+    bool boolean(bool value) override
+    {
+        return add(ByteTag(value ? 1 : 0)) != nullptr;
+    }
+
+    bool number_integer(number_integer_t value) override
+    {
+        if (value >= std::numeric_limits<std::int32_t>::min() && value <= std::numeric_limits<std::int32_t>::max()) {
+            return add(IntTag(static_cast<std::int32_t>(value))) != nullptr;
+        }
+        return add(Int64Tag(value)) != nullptr;
+    }
+
+    bool number_unsigned(number_unsigned_t value) override
+    {
+        if (value > static_cast<number_unsigned_t>(std::numeric_limits<std::int64_t>::max())) {
+            return fail(fmt::format("{} does not fit in a TAG_Long", value));
+        }
+        return number_integer(static_cast<number_integer_t>(value));
+    }
+
+    bool number_float(number_float_t value, const string_t &) override
+    {
+        return add(DoubleTag(value)) != nullptr;
+    }
+
+    bool string(string_t &value) override
+    {
+        return add(StringTag(std::move(value))) != nullptr;
+    }
+
+    bool binary(binary_t &) override
+    {
+        return fail("binary values are not supported");
+    }
+
+    bool start_object(std::size_t) override
+    {
+        if (stack_.empty()) {
+            if (root_) {
+                return fail("expected a single object");
+            }
+            root_ = std::make_unique<CompoundTag>();
+            return push(*root_);
+        }
+        auto *tag = add(CompoundTag());
+        return tag && push(*tag);
+    }
+
+    bool key(string_t &value) override
+    {
+        stack_.back().key = std::move(value);
+        return true;
+    }
+
+    bool end_object() override
+    {
+        stack_.pop_back();
+        return true;
+    }
+
+    bool start_array(std::size_t) override
+    {
+        auto *tag = add(ListTag());
+        return tag && push(*tag);
+    }
+
+    bool end_array() override
+    {
+        stack_.pop_back();
+        return true;
+    }
+
+    bool parse_error(std::size_t, const std::string &, const nlohmann::detail::exception &ex) override
+    {
+        return fail(ex.what());
+    }
+
+    std::unique_ptr<CompoundTag> release()
+    {
+        if (!error_.empty()) {
+            throw std::runtime_error(error_);
+        }
+        if (!root_) {
+            throw std::runtime_error("expected a JSON object");
+        }
+        return std::move(root_);
+    }
+
+private:
+    struct Frame {
+        Tag *tag;
+        std::string key;
+    };
+
+    template <typename T>
+    T *add(T &&value)
+    {
+        if (stack_.empty()) {
+            fail("expected a JSON object");
+            return nullptr;
+        }
+
+        auto &parent = stack_.back();
+        if (parent.tag->getId() == Tag::Type::Compound) {
+            auto &compound = static_cast<CompoundTag &>(*parent.tag);
+            return static_cast<T *>(&compound.put(std::move(parent.key), std::forward<T>(value)));
+        }
+
+        auto &list = static_cast<ListTag &>(*parent.tag);
+        if (list.size() > 0 && list.getElementType() != value.getId()) {
+            fail(fmt::format("array mixes {} and {}", Tag::getTagName(list.getElementType()),
+                             Tag::getTagName(value.getId())));
+            return nullptr;
+        }
+        auto tag = std::make_unique<T>(std::forward<T>(value));
+        auto *ptr = tag.get();
+        list.add(std::move(tag));
+        return ptr;
+    }
+
+    bool push(Tag &tag)
+    {
+        if (stack_.size() >= static_cast<std::size_t>(NbtReader::MaxDepth)) {
+            return fail("maximum nesting depth exceeded");
+        }
+        stack_.push_back({&tag, {}});
+        return true;
+    }
+
+    bool fail(std::string message)
+    {
+        if (error_.empty()) {
+            error_ = std::move(message);
+        }
+        return false;
+    }
+
+    std::unique_ptr<CompoundTag> root_;
+    std::vector<Frame> stack_;
+    std::string error_;
+};
+
+}  // namespace
+
+std::unique_ptr<CompoundTag> fromJson(std::string_view json)
+{
+    TagBuilder builder;
+    nlohmann::json::sax_parse(json.begin(), json.end(), &builder);
+    return builder.release();
+}
+
+}  // namespace endstone::detail::NbtJson
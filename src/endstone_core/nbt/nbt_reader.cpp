@@ -0,0 +1,249 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/nbt/nbt_reader.h"
+
+#include <system_error>
+
+namespace endstone::detail {
+
+namespace {
+auto badMessage()
+{
+    return nonstd::make_unexpected(Bedrock::ErrorInfo<std::error_code>{std::make_error_code(std::errc::bad_message)});
+}
+}  // namespace
+
+Bedrock::Result<void> NbtReader::read(NbtVisitor &visitor)
+{
+    auto type = input_.readByteResult();
+    if (!type) {
+        return nonstd::make_unexpected(type.error());
+    }
+    if (static_cast<Tag::Type>(type.value()) == Tag::Type::End) {
+        return {};
+    }
+
+    auto name = input_.readStringResult();
+    if (!name) {
+        return nonstd::make_unexpected(name.error());
+    }
+    visitor.visitKey(name.value());
+    return readPayload(static_cast<Tag::Type>(type.value()), &visitor, 0);
+}
+
+Bedrock::Result<void> NbtReader::readPayload(Tag::Type type, NbtVisitor &visitor)
+{
+    return readPayload(type, &visitor, 0);
+}
+
+// A null visitor means the value is being skipped, it is still read in full to keep the stream in step
+Bedrock::Result<void> NbtReader::readPayload(Tag::Type type, NbtVisitor *visitor, int depth)
+{
+    switch (type) {
+    case Tag::Type::End:
+        return {};
+    case Tag::Type::Byte: {
+        auto result = input_.readByteResult();
+        if (!result) {
+            return nonstd::make_unexpected(result.error());
+        }
+        if (visitor) {
+            visitor->visitByte(result.value());
+        }
+        return {};
+    }
+    case Tag::Type::Short: {
+        auto result = input_.readShortResult();
+        if (!result) {
+            return nonstd::make_unexpected(result.error());
+        }
+        if (visitor) {
+            visitor->visitShort(result.value());
+        }
+        return {};
+    }
+    case Tag::Type::Int: {
+        auto result = input_.readIntResult();
+        if (!result) {
+            return nonstd::make_unexpected(result.error());
+        }
+        if (visitor) {
+            visitor->visitInt(result.value());
+        }
+        return {};
+    }
+    case Tag::Type::Int64: {
+        auto result = input_.readLongLongResult();
+        if (!result) {
+            return nonstd::make_unexpected(result.error());
+        }
+        if (visitor) {
+            visitor->visitInt64(result.value());
+        }
+        return {};
+    }
+    case Tag::Type::Float: {
+        auto result = input_.readFloatResult();
+        if (!result) {
+            return nonstd::make_unexpected(result.error());
+        }
+        if (visitor) {
+            visitor->visitFloat(result.value());
+        }
+        return {};
+    }
+    case Tag::Type::Double: {
+        auto result = input_.readDoubleResult();
+        if (!result) {
+            return nonstd::make_unexpected(result.error());
+        }
+        if (visitor) {
+            visitor->visitDouble(result.value());
+        }
+        return {};
+    }
+    case Tag::Type::ByteArray: {
+        auto size = input_.readIntResult();
+        if (!size) {
+            return nonstd::make_unexpected(size.error());
+        }
+        if (size.value() < 0 || static_cast<std::uint64_t>(size.value()) > input_.numBytesLeft()) {
+            return badMessage();
+        }
+        bytes_.resize(size.value());
+        if (auto result = input_.readBytesResult(bytes_.data(), bytes_.size()); !result) {
+            return nonstd::make_unexpected(result.error());
+        }
+        if (visitor) {
+            visitor->visitByteArray(bytes_);
+        }
+        return {};
+    }
+    case Tag::Type::String: {
+        auto result = input_.readStringResult();
+        if (!result) {
+            return nonstd::make_unexpected(result.error());
+        }
+        if (visitor) {
+            visitor->visitString(result.value());
+        }
+        return {};
+    }
+    case Tag::Type::List:
+        return readList(visitor, depth + 1);
+    case Tag::Type::Compound:
+        return readCompound(visitor, depth + 1);
+    case Tag::Type::IntArray: {
+        auto size = input_.readIntResult();
+        if (!size) {
+            return nonstd::make_unexpected(size.error());
+        }
+        if (size.value() < 0 ||
+            static_cast<std::uint64_t>(size.value()) > input_.numBytesLeft() / sizeof(std::int32_t)) {
+            return badMessage();
+        }
+        ints_.clear();
+        for (auto i = 0; i < size.value(); ++i) {
+            auto result = input_.readIntResult();
+            if (!result) {
+                return nonstd::make_unexpected(result.error());
+            }
+            ints_.push_back(result.value());
+        }
+        if (visitor) {
+            visitor->visitIntArray(ints_);
+        }
+        return {};
+    }
+    case Tag::Type::NumTagTypes:
+    default:
+        return badMessage();
+    }
+}
+
+Bedrock::Result<void> NbtReader::readCompound(NbtVisitor *visitor, int depth)
+{
+    if (depth > MaxDepth) {
+        return badMessage();
+    }
+    if (visitor && !visitor->beginCompound()) {
+        visitor = nullptr;
+    }
+
+    while (true) {
+        auto type = input_.readByteResult();
+        if (!type) {
+            return nonstd::make_unexpected(type.error());
+        }
+        if (static_cast<Tag::Type>(type.value()) == Tag::Type::End) {
+            break;
+        }
+
+        auto name = input_.readStringResult();
+        if (!name) {
+            return nonstd::make_unexpected(name.error());
+        }
+        if (visitor) {
+            visitor->visitKey(name.value());
+        }
+        if (auto result = readPayload(static_cast<Tag::Type>(type.value()), visitor, depth); !result) {
+            return result;
+        }
+    }
+
+    if (visitor) {
+        visitor->endCompound();
+    }
+    return {};
+}
+
+Bedrock::Result<void> NbtReader::readList(NbtVisitor *visitor, int depth)
+{
+    if (depth > MaxDepth) {
+        return badMessage();
+    }
+
+    auto type = input_.readByteResult();
+    if (!type) {
+        return nonstd::make_unexpected(type.error());
+    }
+    if (type.value() >= static_cast<std::uint8_t>(Tag::Type::NumTagTypes)) {
+        return badMessage();
+    }
+    auto element_type = static_cast<Tag::Type>(type.value());
+
+    auto size = input_.readIntResult();
+    if (!size) {
+        return nonstd::make_unexpected(size.error());
+    }
+    if (size.value() < 0 || static_cast<std::uint64_t>(size.value()) > input_.numBytesLeft()) {
+        return badMessage();
+    }
+
+    if (visitor && !visitor->beginList(element_type, size.value())) {
+        visitor = nullptr;
+    }
+    for (auto i = 0; i < size.value(); ++i) {
+        if (auto result = readPayload(element_type, visitor, depth); !result) {
+            return result;
+        }
+    }
+    if (visitor) {
+        visitor->endList();
+    }
+    return {};
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,220 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/nbt/nbt_tree.h"
+
+#include <cstring>
+
+namespace endstone::detail {
+
+NbtArena::NbtArena(std::size_t block_size) : block_size_(block_size) {}
+
+void *NbtArena::allocate(std::size_t size, std::size_t alignment)
+{
+    if (size + alignment > block_size_) {
+        // Oversized payloads get a block of their own, small allocations keep filling the current block
+        auto space = size + alignment;
+        void *ptr = large_blocks_.emplace_back(new std::byte[space]).get();
+        return std::align(alignment, size, ptr, space);
+    }
+
+    void *ptr = cursor_;
+    auto space = static_cast<std::size_t>(end_ - cursor_);
+    if (!cursor_ || !std::align(alignment, size, ptr, space)) {
+        grow();
+        ptr = cursor_;
+        space = block_size_;
+        std::align(alignment, size, ptr, space);
+    }
+    cursor_ = static_cast<std::byte *>(ptr) + size;
+    return ptr;
+}
+
+std::string_view NbtArena::copy(std::string_view value)
+{
+    if (value.empty()) {
+        return {};
+    }
+    auto *data = static_cast<char *>(allocate(value.size(), alignof(char)));
+    std::memcpy(data, value.data(), value.size());
+    return {data, value.size()};
+}
+
+void NbtArena::reset()
+{
+    large_blocks_.clear();
+    if (blocks_.empty()) {
+        return;
+    }
+    blocks_.resize(1);
+    cursor_ = blocks_.front().get();
+    end_ = cursor_ + block_size_;
+}
+
+std::size_t NbtArena::getBlockCount() const
+{
+    return blocks_.size() + large_blocks_.size();
+}
+
+void NbtArena::grow()
+{
+    cursor_ = blocks_.emplace_back(new std::byte[block_size_]).get();
+    end_ = cursor_ + block_size_;
+}
+
+const NbtNode *NbtNode::get(std::string_view key) const
+{
+    if (type != Tag::Type::Compound) {
+        return nullptr;
+    }
+    for (const auto *child = first_child; child; child = child->next_sibling) {
+        if (child->name == key) {
+            return child;
+        }
+    }
+    return nullptr;
+}
+
+const NbtNode *NbtNode::at(std::size_t index) const
+{
+    if (type != Tag::Type::List || index >= size) {
+        return nullptr;
+    }
+    const auto *child = first_child;
+    while (index-- > 0) {
+        child = child->next_sibling;
+    }
+    return child;
+}
+
+const NbtNode *NbtTreeBuilder::getRoot() const
+{
+    return root_;
+}
+
+void NbtTreeBuilder::visitKey(std::string_view name)
+{
+    key_ = arena_.copy(name);
+}
+
+void NbtTreeBuilder::visitByte(std::uint8_t value)
+{
+    append(Tag::Type::Byte).integer = value;
+}
+
+void NbtTreeBuilder::visitShort(std::int16_t value)
+{
+    append(Tag::Type::Short).integer = value;
+}
+
+void NbtTreeBuilder::visitInt(std::int32_t value)
+{
+    append(Tag::Type::Int).integer = value;
+}
+
+void NbtTreeBuilder::visitInt64(std::int64_t value)
+{
+    append(Tag::Type::Int64).integer = value;
+}
+
+void NbtTreeBuilder::visitFloat(float value)
+{
+    append(Tag::Type::Float).real = value;
+}
+
+void NbtTreeBuilder::visitDouble(double value)
+{
+    append(Tag::Type::Double).real = value;
+}
+
+void NbtTreeBuilder::visitString(std::string_view value)
+{
+    auto &node = append(Tag::Type::String);
+    node.bytes = arena_.copy(value);
+    node.size = value.size();
+}
+
+void NbtTreeBuilder::visitByteArray(const std::vector<std::uint8_t> &value)
+{
+    auto &node = append(Tag::Type::ByteArray);
+    node.bytes = arena_.copy(std::string_view{reinterpret_cast<const char *>(value.data()), value.size()});
+    node.size = value.size();
+}
+
+void NbtTreeBuilder::visitIntArray(const std::vector<std::int32_t> &value)
+{
+    auto &node = append(Tag::Type::IntArray);
+    node.ints = arena_.copy(value);
+    node.size = value.size();
+}
+
+bool NbtTreeBuilder::beginCompound()
+{
+    stack_.push_back({&append(Tag::Type::Compound), nullptr});
+    return true;
+}
+
+void NbtTreeBuilder::endCompound()
+{
+    stack_.pop_back();
+}
+
+bool NbtTreeBuilder::beginList(Tag::Type type, std::int32_t size)
+{
+    auto &node = append(Tag::Type::List);
+    node.element_type = type;
+    stack_.push_back({&node, nullptr});
+    return true;
+}
+
+void NbtTreeBuilder::endList()
+{
+    stack_.pop_back();
+}
+
+NbtNode &NbtTreeBuilder::append(Tag::Type type)
+{
+    auto *node = arena_.make<NbtNode>();
+    node->type = type;
+    node->name = key_;
+    key_ = {};
+
+    if (stack_.empty()) {
+        root_ = node;
+        return *node;
+    }
+
+    auto &parent = stack_.back();
+    if (parent.last_child) {
+        parent.last_child->next_sibling = node;
+    }
+    else {
+        parent.node->first_child = node;
+    }
+    parent.last_child = node;
+    parent.node->size++;
+    return *node;
+}
+
+Bedrock::Result<const NbtNode *> readNbtTree(IDataInput &input, NbtArena &arena)
+{
+    NbtTreeBuilder builder{arena};
+    NbtReader reader{input};
+    if (auto result = reader.read(builder); !result) {
+        return nonstd::make_unexpected(result.error());
+    }
+    return builder.getRoot();
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,70 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "bedrock/core/utility/binary_stream.h"
+#include "endstone/detail/network/packet_codec.h"
+#include "endstone/network/boss_event_packet.h"
+
+namespace endstone::detail {
+namespace {
+void writeProperties(BinaryStream &stream, const BossEventPacket &packet, bool darken_sky)
+{
+    if (darken_sky) {
+        // Sent as a 16-bit little endian integer
+        std::uint16_t value = packet.darken_sky ? 1 : 0;
+        stream.writeByte(value & 0xFF);
+        stream.writeByte(value >> 8);
+    }
+    stream.writeUnsignedVarInt(static_cast<std::uint32_t>(packet.color));
+    stream.writeUnsignedVarInt(static_cast<std::uint32_t>(packet.style));
+}
+}  // namespace
+
+template <>
+void PacketCodec::encode(BinaryStream &stream, BossEventPacket &packet)
+{
+    using EventType = BossEventPacket::EventType;
+
+    stream.writeVarInt64(packet.boss_actor_id);
+    stream.writeUnsignedVarInt(static_cast<std::uint32_t>(packet.event_type));
+    switch (packet.event_type) {
+    case EventType::PlayerAdded:
+    case EventType::PlayerRemoved:
+    case EventType::Query:
+        stream.writeVarInt64(packet.player_actor_id);
+        break;
+    case EventType::Add:
+        stream.writeString(packet.title);
+        stream.writeFloat(packet.progress);
+        writeProperties(stream, packet, true);
+        break;
+    case EventType::UpdatePercent:
+        stream.writeFloat(packet.progress);
+        break;
+    case EventType::UpdateName:
+        stream.writeString(packet.title);
+        break;
+    case EventType::UpdateProperties:
+        writeProperties(stream, packet, true);
+        break;
+    case EventType::UpdateStyle:
+        writeProperties(stream, packet, false);
+        break;
+    case EventType::Remove:
+    default:
+        break;
+    }
+}
+
+}  // namespace endstone::detail
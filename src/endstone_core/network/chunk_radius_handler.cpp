@@ -0,0 +1,75 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/network/chunk_radius_handler.h"
+
+#include <entt/entt.hpp>
+
+#include "bedrock/entity/components/user_entity_identifier_component.h"
+#include "bedrock/network/minecraft_packets.h"
+#include "bedrock/network/packet/request_chunk_radius_packet.h"
+#include "bedrock/network/server_network_handler.h"
+#include "endstone/detail/player.h"
+#include "endstone/detail/server.h"
+
+namespace endstone::detail {
+
+ChunkRadiusHandler &ChunkRadiusHandler::getInstance()
+{
+    static ChunkRadiusHandler instance;
+    return instance;
+}
+
+void ChunkRadiusHandler::intercept(const IPacketHandlerDispatcher *&handler)
+{
+    if (handler == nullptr || handler == this) {
+        return;
+    }
+    // Every packet of an id shares the same vanilla handler
+    vanilla_.store(handler, std::memory_order_relaxed);
+    handler = this;
+}
+
+void ChunkRadiusHandler::handle(const NetworkIdentifier &network_id, NetEventCallback &callback,
+                                std::shared_ptr<::Packet> &packet) const
+{
+    auto &pk = static_cast<RequestChunkRadiusPacket &>(*packet);
+    auto &server = entt::locator<EndstoneServer>::value();
+    for (auto *online_player : server.getOnlinePlayers()) {
+        auto &player = static_cast<EndstonePlayer &>(*online_player);
+        const auto *component = player.getHandle().getPersistentComponent<UserEntityIdentifierComponent>();
+        if (component->network_id == network_id && component->sub_client_id == packet->getClientSubId()) {
+            pk.chunk_radius = player.onChunkRadiusRequested(pk.chunk_radius, pk.max_chunk_radius);
+            break;
+        }
+    }
+    vanilla_.load(std::memory_order_relaxed)->handle(network_id, callback, packet);
+}
+
+void ChunkRadiusHandler::refresh(const EndstonePlayer &player) const
+{
+    const auto requested = player.getRequestedChunkRadius();
+    if (!requested || vanilla_.load(std::memory_order_relaxed) == nullptr) {
+        return;  // The client has yet to ask for a radius, the limit applies when it does
+    }
+    auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::RequestChunkRadius);
+    auto &pk = static_cast<RequestChunkRadiusPacket &>(*packet);
+    pk.chunk_radius = requested->first;
+    pk.max_chunk_radius = requested->second;
+    const auto *component = player.getHandle().getPersistentComponent<UserEntityIdentifierComponent>();
+    packet->setClientSubId(component->sub_client_id);
+    handle(component->network_id, entt::locator<EndstoneServer>::value().getServerNetworkHandler(), packet);
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,65 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/network/compression_controller.h"
+
+#include <algorithm>
+
+namespace endstone::detail {
+
+CompressionController::CompressionController(std::size_t threshold, std::optional<float> target_usage)
+    : base_threshold_(std::min(threshold, MaxThreshold)), threshold_(base_threshold_), target_usage_(target_usage)
+{
+}
+
+bool CompressionController::update(std::uint64_t current_tick, float average_usage)
+{
+    if (!target_usage_ || (last_change_ && current_tick - *last_change_ < AdjustInterval)) {
+        return false;
+    }
+
+    if (average_usage > *target_usage_) {
+        const auto next = std::min(std::max(threshold_ * 2, MinAdaptiveThreshold), MaxThreshold);
+        if (next <= threshold_) {
+            return false;
+        }
+        threshold_ = next;
+    }
+    else if (threshold_ > base_threshold_ && average_usage < *target_usage_ - Hysteresis) {
+        const auto next = threshold_ / 2;
+        threshold_ = next < MinAdaptiveThreshold ? base_threshold_ : std::max(next, base_threshold_);
+    }
+    else {
+        return false;
+    }
+    last_change_ = current_tick;
+    return true;
+}
+
+bool CompressionController::isCompressible(std::size_t size) const
+{
+    return size >= threshold_;
+}
+
+std::size_t CompressionController::getThreshold() const
+{
+    return threshold_;
+}
+
+std::optional<float> CompressionController::getTargetUsage() const
+{
+    return target_usage_;
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,45 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+
+#include "bedrock/core/utility/binary_stream.h"
+#include "endstone/detail/network/packet_codec.h"
+#include "endstone/network/move_actor_absolute_packet.h"
+
+namespace endstone::detail {
+namespace {
+std::uint8_t encodeAngle(float degrees)
+{
+    return static_cast<std::uint8_t>(static_cast<int>(std::lround(degrees / (360.0F / 256.0F))) & 0xFF);
+}
+}  // namespace
+
+template <>
+void PacketCodec::encode(BinaryStream &stream, MoveActorAbsolutePacket &packet)
+{
+    std::uint8_t flags = 0;
+    flags |= packet.on_ground ? 0x01 : 0;
+    flags |= packet.teleported ? 0x02 : 0;
+    flags |= packet.force_move ? 0x04 : 0;
+
+    stream.writeUnsignedVarInt64(packet.actor_runtime_id);
+    stream.writeByte(flags);
+    stream.writeVec3({packet.position.getX(), packet.position.getY(), packet.position.getZ()});
+    stream.writeByte(encodeAngle(packet.pitch));
+    stream.writeByte(encodeAngle(packet.yaw));
+    stream.writeByte(encodeAngle(packet.head_yaw));
+}
+
+}  // namespace endstone::detail
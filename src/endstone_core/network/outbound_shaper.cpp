@@ -0,0 +1,139 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/network/outbound_shaper.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace endstone::detail {
+
+void OutboundShaper::submit(PacketPriority priority, Sender sender)
+{
+    if (canSend(priority)) {
+        send(sender);
+        return;
+    }
+    auto &queue = priority == PacketPriority::Bulk ? bulk_ : normal_;
+    queue.push_back(std::move(sender));
+    trim(queue);
+}
+
+bool OutboundShaper::canSend(PacketPriority priority) const
+{
+    switch (priority) {
+    case PacketPriority::Critical:
+        return true;
+    case PacketPriority::Normal:
+        return normal_.empty() && hasTokens();
+    case PacketPriority::Bulk:
+        return normal_.empty() && bulk_.empty() && hasTokens() && !isCongested();
+    }
+    return true;
+}
+
+void OutboundShaper::charge(std::size_t size)
+{
+    if (rate_) {
+        tokens_ -= static_cast<double>(size);
+    }
+}
+
+void OutboundShaper::tick(Clock::time_point now)
+{
+    if (rate_) {
+        const auto elapsed = std::chrono::duration<double>(now - updated_).count();
+        tokens_ = std::min(tokens_ + elapsed * static_cast<double>(*rate_), static_cast<double>(*rate_));
+    }
+    updated_ = now;
+
+    while (!normal_.empty() && hasTokens()) {
+        auto sender = std::move(normal_.front());
+        normal_.pop_front();
+        send(sender);
+    }
+    while (normal_.empty() && !bulk_.empty() && hasTokens() && !isCongested()) {
+        auto sender = std::move(bulk_.front());
+        bulk_.pop_front();
+        send(sender);
+    }
+}
+
+void OutboundShaper::setRate(std::optional<std::size_t> bytes_per_second, Clock::time_point now)
+{
+    rate_ = bytes_per_second;
+    tokens_ = bytes_per_second ? static_cast<double>(*bytes_per_second) : 0;
+    updated_ = now;
+}
+
+std::optional<std::size_t> OutboundShaper::getRate() const
+{
+    return rate_;
+}
+
+void OutboundShaper::setSendQueueSize(std::size_t send_queue_size)
+{
+    send_queue_size_ = send_queue_size;
+}
+
+bool OutboundShaper::hasQueued() const
+{
+    return !normal_.empty() || !bulk_.empty();
+}
+
+std::size_t OutboundShaper::getQueuedCount() const
+{
+    return normal_.size() + bulk_.size();
+}
+
+void OutboundShaper::flush()
+{
+    auto normal = std::move(normal_);
+    auto bulk = std::move(bulk_);
+    normal_.clear();
+    bulk_.clear();
+    for (const auto &sender : normal) {
+        send(sender);
+    }
+    for (const auto &sender : bulk) {
+        send(sender);
+    }
+}
+
+bool OutboundShaper::hasTokens() const
+{
+    return !rate_ || tokens_ > 0;
+}
+
+bool OutboundShaper::isCongested() const
+{
+    return send_queue_size_ >= DeepSendQueue;
+}
+
+void OutboundShaper::send(const Sender &sender)
+{
+    charge(sender());
+}
+
+void OutboundShaper::trim(std::deque<Sender> &queue)
+{
+    // Called by submit with at most one packet over the limit
+    if (queue.size() > MaxQueuedPackets) {
+        auto sender = std::move(queue.front());
+        queue.pop_front();
+        send(sender);
+    }
+}
+
+}  // namespace endstone::detail
@@ -44,7 +44,9 @@ Bedrock::Result<void> PacketAdapter::checkSize(std::uint64_t size, bool flag) co
 
 void PacketAdapter::write(BinaryStream &stream) const
 {
+    const auto start = stream.getView().size();
     PacketCodec::encode(stream, packet_);
+    encoded_size_ = stream.getView().size() - start;
 }
 
 Bedrock::Result<void> PacketAdapter::read(ReadOnlyBinaryStream &stream)
@@ -62,6 +64,11 @@ bool PacketAdapter::isValid() const
     return true;
 }
 
+std::size_t PacketAdapter::getEncodedSize() const
+{
+    return encoded_size_;
+}
+
 Bedrock::Result<void> PacketAdapter::_read(ReadOnlyBinaryStream &)
 {
     throw std::runtime_error("Not implemented");
@@ -0,0 +1,57 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/network/packet_cache.h"
+
+#include "bedrock/core/utility/binary_stream.h"
+
+namespace endstone::detail {
+
+EncodedPacket::EncodedPacket(std::unique_ptr<::Packet> packet) : packet_(std::move(packet)) {}
+
+const PacketInterface &EncodedPacket::getPacket() const
+{
+    return reinterpret_cast<const PacketInterface &>(*packet_);
+}
+
+void EncodedPacket::write(BinaryStream &stream)
+{
+    std::lock_guard lock{mutex_};
+    if (!payload_) {
+        // The server appends the payload to whatever the stream already holds, only the difference is kept
+        auto offset = stream.getView().size();
+        getPacket().write(stream);
+        payload_ = std::string(stream.getView().substr(offset));
+        return;
+    }
+    stream.write(payload_->data(), payload_->size());
+}
+
+std::shared_ptr<EncodedPacket> PacketCache::get(std::size_t key, const Factory &create)
+{
+    std::lock_guard lock{mutex_};
+    auto &packet = packets_[key];
+    if (!packet) {
+        packet = std::make_shared<EncodedPacket>(create());
+    }
+    return packet;
+}
+
+void PacketCache::clear()
+{
+    std::lock_guard lock{mutex_};
+    packets_.clear();
+}
+
+}  // namespace endstone::detail
@@ -18,16 +18,68 @@
 
 #include <fmt/format.h>
 
+#include "endstone/network/boss_event_packet.h"
+#include "endstone/network/move_actor_absolute_packet.h"
+#include "endstone/network/remove_actor_packet.h"
+#include "endstone/network/set_score_packet.h"
+#include "endstone/network/set_title_packet.h"
 #include "endstone/network/spawn_particle_effect_packet.h"
+#include "endstone/network/text_packet.h"
+#include "endstone/network/toast_request_packet.h"
 
 namespace endstone::detail {
 
 void PacketCodec::encode(BinaryStream &stream, Packet &packet)
 {
     switch (packet.getType()) {
+    case PacketType::Text:
+        encode(stream, static_cast<TextPacket &>(packet));
+        break;
+    case PacketType::RemoveActor:
+        encode(stream, static_cast<RemoveActorPacket &>(packet));
+        break;
+    case PacketType::MoveActorAbsolute:
+        encode(stream, static_cast<MoveActorAbsolutePacket &>(packet));
+        break;
+    case PacketType::BossEvent:
+        encode(stream, static_cast<BossEventPacket &>(packet));
+        break;
+    case PacketType::SetTitle:
+        encode(stream, static_cast<SetTitlePacket &>(packet));
+        break;
+    case PacketType::SetScore:
+        encode(stream, static_cast<SetScorePacket &>(packet));
+        break;
     case PacketType::SpawnParticleEffect:
         encode(stream, static_cast<SpawnParticleEffectPacket &>(packet));
         break;
+    case PacketType::ToastRequest:
+        encode(stream, static_cast<ToastRequestPacket &>(packet));
+        break;
+    default:
+        throw std::runtime_error(fmt::format("Packet type {} is not supported.", static_cast<int>(packet.getType())));
+    }
+}
+
+std::unique_ptr<Packet> PacketCodec::clone(const Packet &packet)
+{
+    switch (packet.getType()) {
+    case PacketType::Text:
+        return std::make_unique<TextPacket>(static_cast<const TextPacket &>(packet));
+    case PacketType::RemoveActor:
+        return std::make_unique<RemoveActorPacket>(static_cast<const RemoveActorPacket &>(packet));
+    case PacketType::MoveActorAbsolute:
+        return std::make_unique<MoveActorAbsolutePacket>(static_cast<const MoveActorAbsolutePacket &>(packet));
+    case PacketType::BossEvent:
+        return std::make_unique<BossEventPacket>(static_cast<const BossEventPacket &>(packet));
+    case PacketType::SetTitle:
+        return std::make_unique<SetTitlePacket>(static_cast<const SetTitlePacket &>(packet));
+    case PacketType::SetScore:
+        return std::make_unique<SetScorePacket>(static_cast<const SetScorePacket &>(packet));
+    case PacketType::SpawnParticleEffect:
+        return std::make_unique<SpawnParticleEffectPacket>(static_cast<const SpawnParticleEffectPacket &>(packet));
+    case PacketType::ToastRequest:
+        return std::make_unique<ToastRequestPacket>(static_cast<const ToastRequestPacket &>(packet));
     default:
         throw std::runtime_error(fmt::format("Packet type {} is not supported.", static_cast<int>(packet.getType())));
     }
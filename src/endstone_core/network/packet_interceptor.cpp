@@ -0,0 +1,103 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/network/packet_interceptor.h"
+
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+#include "endstone/plugin/plugin.h"
+
+namespace endstone::detail {
+
+namespace {
+bool isValidPacketId(int packet_id)
+{
+    return packet_id >= 0 && static_cast<std::size_t>(packet_id) < EndstonePacketInterceptor::PacketIdCount;
+}
+}  // namespace
+
+void EndstonePacketInterceptor::addHandler(Plugin &plugin, int packet_id, Handler handler)
+{
+    if (!isValidPacketId(packet_id)) {
+        throw std::invalid_argument("Packet id must be between 0 and 1023");
+    }
+    if (!handler) {
+        throw std::invalid_argument("Packet handler cannot be empty");
+    }
+    std::unique_lock lock(mutex_);
+    handlers_[packet_id].push_back({&plugin, std::move(handler)});
+    active_[packet_id].store(true, std::memory_order_release);
+}
+
+void EndstonePacketInterceptor::removeHandlers(Plugin &plugin, int packet_id)
+{
+    if (!isValidPacketId(packet_id)) {
+        return;
+    }
+    std::unique_lock lock(mutex_);
+    auto &handlers = handlers_[packet_id];
+    handlers.erase(std::remove_if(handlers.begin(), handlers.end(),
+                                  [&](const Entry &entry) { return entry.plugin == &plugin; }),
+                   handlers.end());
+    active_[packet_id].store(!handlers.empty(), std::memory_order_release);
+}
+
+void EndstonePacketInterceptor::unregister(Plugin &plugin)
+{
+    std::unique_lock lock(mutex_);
+    for (std::size_t id = 0; id < PacketIdCount; ++id) {
+        if (!active_[id].load(std::memory_order_relaxed)) {
+            continue;
+        }
+        auto &handlers = handlers_[id];
+        handlers.erase(std::remove_if(handlers.begin(), handlers.end(),
+                                      [&](const Entry &entry) { return entry.plugin == &plugin; }),
+                       handlers.end());
+        active_[id].store(!handlers.empty(), std::memory_order_release);
+    }
+}
+
+bool EndstonePacketInterceptor::hasHandlers(int packet_id) const
+{
+    return isValidPacketId(packet_id) && active_[packet_id].load(std::memory_order_acquire);
+}
+
+bool EndstonePacketInterceptor::intercept(int packet_id, int sub_client_id, char *data, std::size_t size) const
+{
+    if (!hasHandlers(packet_id)) {
+        return true;
+    }
+
+    std::shared_lock lock(mutex_);
+    for (const auto &entry : handlers_[packet_id]) {
+        BinaryStreamReader reader{{data, size}};
+        BinaryStreamWriter writer{data, size};
+        try {
+            if (!entry.handler(sub_client_id, reader, writer)) {
+                return false;
+            }
+        }
+        catch (const std::exception &e) {
+            entry.plugin->getLogger().error("Could not pass packet {} to {}: {}", packet_id, entry.plugin->getName(),
+                                            e.what());
+        }
+    }
+    return true;
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,83 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/network/packet_statistics.h"
+
+#include <algorithm>
+
+namespace endstone::detail {
+
+PacketStatistics &PacketStatistics::getInstance()
+{
+    static PacketStatistics instance;
+    return instance;
+}
+
+void PacketStatistics::recordReceived(int packet_id, std::size_t bytes)
+{
+    auto &counter = received_[static_cast<std::size_t>(packet_id) & MaxPacketId];
+    counter.count.fetch_add(1, std::memory_order_relaxed);
+    counter.bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+std::vector<PacketStatistics::Entry> PacketStatistics::getReceived() const
+{
+    std::vector<Entry> entries;
+    for (std::size_t id = 0; id < received_.size(); ++id) {
+        auto count = received_[id].count.load(std::memory_order_relaxed);
+        if (count > 0) {
+            entries.push_back({static_cast<int>(id), count, received_[id].bytes.load(std::memory_order_relaxed)});
+        }
+    }
+    std::sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) { return a.bytes > b.bytes; });
+    return entries;
+}
+
+void PacketStatistics::recordSent(int packet_id, std::size_t bytes, bool compressed)
+{
+    auto &counter = sent_[static_cast<std::size_t>(packet_id) & MaxPacketId];
+    counter.count.fetch_add(1, std::memory_order_relaxed);
+    counter.bytes.fetch_add(bytes, std::memory_order_relaxed);
+    if (!compressed) {
+        uncompressed_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+std::optional<std::size_t> PacketStatistics::getAverageSentSize(int packet_id) const
+{
+    const auto &counter = sent_[static_cast<std::size_t>(packet_id) & MaxPacketId];
+    const auto count = counter.count.load(std::memory_order_relaxed);
+    if (count == 0) {
+        return std::nullopt;
+    }
+    return static_cast<std::size_t>(counter.bytes.load(std::memory_order_relaxed) / count);
+}
+
+std::uint64_t PacketStatistics::getUncompressedCount() const
+{
+    return uncompressed_.load(std::memory_order_relaxed);
+}
+
+void PacketStatistics::reset()
+{
+    for (auto *counters : {&received_, &sent_}) {
+        for (auto &counter : *counters) {
+            counter.count.store(0, std::memory_order_relaxed);
+            counter.bytes.store(0, std::memory_order_relaxed);
+        }
+    }
+    uncompressed_.store(0, std::memory_order_relaxed);
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,100 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/network/ping_rate_limiter.h"
+
+#include <algorithm>
+
+namespace endstone::detail {
+
+namespace {
+std::size_t hash(const PingRateLimiter::Source &source)
+{
+    auto h = source.high * 0x9E3779B97F4A7C15ULL ^ source.low;
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    return static_cast<std::size_t>(h);
+}
+}  // namespace
+
+PingRateLimiter &PingRateLimiter::getInstance()
+{
+    static PingRateLimiter instance;
+    return instance;
+}
+
+bool PingRateLimiter::tryAcquire(const Source &source, Clock::time_point now)
+{
+    auto ms = static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(now - epoch_).count());
+
+    std::lock_guard lock(mutex_);
+    auto index = hash(source) & (Capacity - 1);
+    Slot *target = nullptr;
+    for (std::size_t i = 0; i < MaxProbes; ++i) {
+        auto &slot = slots_[(index + i) & (Capacity - 1)];
+        if (slot.occupied && slot.source == source) {
+            target = &slot;
+            break;
+        }
+        if (!target || (target->occupied && (!slot.occupied || decay(slot, ms) < decay(*target, ms)))) {
+            target = &slot;
+        }
+    }
+
+    auto level = 0.0F;
+    if (target->occupied && target->source == source) {
+        level = decay(*target, ms);
+    }
+    else {
+        target->source = source;
+        target->occupied = true;
+    }
+    target->updated = ms;
+
+    if (level + 1 > burst_) {
+        target->level = level;
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    target->level = level + 1;
+    served_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void PingRateLimiter::setLimit(double rate, double burst)
+{
+    std::lock_guard lock(mutex_);
+    rate_ = rate;
+    burst_ = burst;
+}
+
+std::uint64_t PingRateLimiter::getServedCount() const
+{
+    return served_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t PingRateLimiter::getDroppedCount() const
+{
+    return dropped_.load(std::memory_order_relaxed);
+}
+
+float PingRateLimiter::decay(const Slot &slot, std::uint32_t now) const
+{
+    // Unsigned subtraction keeps working when the millisecond clock wraps around
+    auto elapsed = static_cast<double>(now - slot.updated) / 1000.0;
+    return static_cast<float>(std::max(0.0, slot.level - elapsed * rate_));
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,51 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "bedrock/core/utility/binary_stream.h"
+#include "endstone/detail/network/packet_codec.h"
+#include "endstone/network/set_score_packet.h"
+
+namespace endstone::detail {
+template <>
+void PacketCodec::encode(BinaryStream &stream, SetScorePacket &packet)
+{
+    using IdentityType = SetScorePacket::IdentityType;
+
+    stream.writeByte(static_cast<std::uint8_t>(packet.action));
+    stream.writeUnsignedVarInt(packet.entries.size());
+    // An entry is typically a few varints, a short objective name and a fake player name
+    stream.reserve(packet.entries.size() * 32);
+    for (const auto &entry : packet.entries) {
+        stream.writeVarInt64(entry.scoreboard_id);
+        stream.writeString(entry.objective_name);
+        // Sent as a 32-bit little endian integer
+        auto score = static_cast<std::uint32_t>(entry.score);
+        for (int shift = 0; shift < 32; shift += 8) {
+            stream.writeByte((score >> shift) & 0xFF);
+        }
+        if (packet.action == SetScorePacket::Action::Remove) {
+            continue;
+        }
+
+        stream.writeByte(static_cast<std::uint8_t>(entry.identity_type));
+        if (entry.identity_type == IdentityType::FakePlayer) {
+            stream.writeString(entry.fake_player_name);
+        }
+        else {
+            stream.writeVarInt64(entry.actor_id);
+        }
+    }
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,33 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "bedrock/core/utility/binary_stream.h"
+#include "endstone/detail/network/packet_codec.h"
+#include "endstone/network/set_title_packet.h"
+
+namespace endstone::detail {
+template <>
+void PacketCodec::encode(BinaryStream &stream, SetTitlePacket &packet)
+{
+    stream.writeVarInt(static_cast<std::int32_t>(packet.title_type));
+    stream.writeString(packet.text);
+    stream.writeVarInt(packet.fade_in_time);
+    stream.writeVarInt(packet.stay_time);
+    stream.writeVarInt(packet.fade_out_time);
+    stream.writeString(packet.xuid);
+    stream.writeString(packet.platform_online_id);
+    stream.writeString(packet.filtered_text);
+}
+
+}  // namespace endstone::detail
@@ -22,9 +22,7 @@ void PacketCodec::encode(BinaryStream &stream, SpawnParticleEffectPacket &packet
 {
     stream.writeUnsignedChar(packet.dimension_id);
     stream.writeVarInt64(packet.actor_id);
-    stream.writeFloat(packet.position.getX());
-    stream.writeFloat(packet.position.getY());
-    stream.writeFloat(packet.position.getZ());
+    stream.writeVec3({packet.position.getX(), packet.position.getY(), packet.position.getZ()});
     stream.writeString(packet.effect_name);
     stream.writeBool(packet.molang_variables_json.has_value());
     if (packet.molang_variables_json.has_value()) {
@@ -0,0 +1,52 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "bedrock/core/utility/binary_stream.h"
+#include "endstone/detail/network/packet_codec.h"
+#include "endstone/network/text_packet.h"
+
+namespace endstone::detail {
+template <>
+void PacketCodec::encode(BinaryStream &stream, TextPacket &packet)
+{
+    using TextType = TextPacket::TextType;
+
+    stream.writeByte(static_cast<std::uint8_t>(packet.text_type));
+    stream.writeBool(packet.needs_translation);
+    switch (packet.text_type) {
+    case TextType::Chat:
+    case TextType::Whisper:
+    case TextType::Announcement:
+        stream.writeString(packet.source_name);
+        stream.writeString(packet.message);
+        break;
+    case TextType::Translation:
+    case TextType::Popup:
+    case TextType::JukeboxPopup:
+        stream.writeString(packet.message);
+        stream.writeUnsignedVarInt(packet.parameters.size());
+        for (const auto &parameter : packet.parameters) {
+            stream.writeString(parameter);
+        }
+        break;
+    default:
+        stream.writeString(packet.message);
+        break;
+    }
+    stream.writeString(packet.xuid);
+    stream.writeString(packet.platform_id);
+    stream.writeString(packet.filtered_message);
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,91 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/os.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#elif __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Unlike the rest of os.h, these live in the core, as the executors of the scheduler use them
+namespace endstone::detail::os {
+
+bool set_thread_affinity(const std::vector<std::size_t> &cpus)
+{
+    if (cpus.empty()) {
+        return false;
+    }
+#ifdef _WIN32
+    DWORD_PTR mask = 0;
+    for (auto cpu : cpus) {
+        if (cpu < sizeof(DWORD_PTR) * 8) {
+            mask |= DWORD_PTR{1} << cpu;
+        }
+    }
+    return mask != 0 && SetThreadAffinityMask(GetCurrentThread(), mask) != 0;
+#elif __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (auto cpu : cpus) {
+        if (cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &set);
+        }
+    }
+    return CPU_COUNT(&set) > 0 && pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+bool set_thread_priority(ThreadPriority priority)
+{
+#ifdef _WIN32
+    int value = THREAD_PRIORITY_NORMAL;
+    switch (priority) {
+    case ThreadPriority::Low:
+        value = THREAD_PRIORITY_BELOW_NORMAL;
+        break;
+    case ThreadPriority::High:
+        value = THREAD_PRIORITY_ABOVE_NORMAL;
+        break;
+    default:
+        break;
+    }
+    return SetThreadPriority(GetCurrentThread(), value) != 0;
+#elif __linux__
+    // Threads of the SCHED_OTHER policy have no priority of their own, the nice value is per thread on Linux
+    int nice = 0;
+    switch (priority) {
+    case ThreadPriority::Low:
+        nice = 10;
+        break;
+    case ThreadPriority::High:
+        nice = -10;
+        break;
+    default:
+        break;
+    }
+    return setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), nice) == 0;
+#else
+    return false;
+#endif
+}
+
+}  // namespace endstone::detail::os
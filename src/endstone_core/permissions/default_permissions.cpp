@@ -48,13 +48,33 @@ void DefaultPermissions::registerCommandPermissions(Permission *parent)
 {
     auto *root = registerPermission(parent->getName() + ".command", parent,
                                     "Gives the user the ability to use all Endstone command");
+    registerPermission(root->getName() + ".backup", root,
+                       "Allows the user to copy the level to a directory while the server is running",
+                       PermissionDefault::Operator);
+    registerPermission(root->getName() + ".dumpdata", root,
+                       "Allows the user to write the block, item and recipe data of the server to files",
+                       PermissionDefault::Operator);
+    registerPermission(root->getName() + ".entities", root,
+                       "Allows the user to view the number of actors of each type and the busiest chunks",
+                       PermissionDefault::Operator);
+    registerPermission(root->getName() + ".netstats", root,
+                       "Allows the user to view the network statistics of players and the server",
+                       PermissionDefault::Operator);
     registerPermission(root->getName() + ".plugins", root,
                        "Allows the user to view the list of plugins running on this server", PermissionDefault::True);
+    registerPermission(root->getName() + ".pregen", root, "Allows the user to pre-generate the chunks of the level",
+                       PermissionDefault::Operator);
+    registerPermission(root->getName() + ".profile", root,
+                       "Allows the user to profile the server thread and write flame graphs",
+                       PermissionDefault::Operator);
     registerPermission(root->getName() + ".reload", root,
                        "Allows the user to reload the configuration and plugins of the server",
                        PermissionDefault::Operator);
     registerPermission(root->getName() + ".status", root, "Allows the user to view the status of the server",
                        PermissionDefault::Operator);
+    registerPermission(root->getName() + ".timings", root,
+                       "Allows the user to record and view the event handler timings of the server",
+                       PermissionDefault::Operator);
     registerPermission(root->getName() + ".version", root, "Allows the user to view the version of the server",
                        PermissionDefault::True);
 
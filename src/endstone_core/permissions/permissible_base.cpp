@@ -14,17 +14,28 @@
 
 #include "endstone/detail/permissions/permissible_base.h"
 
+#include <algorithm>
 #include <memory>
 
 #include <entt/entt.hpp>
 
+#include "endstone/detail/memory_usage.h"
+#include "endstone/detail/plugin/plugin_manager.h"
 #include "endstone/detail/server.h"
 #include "endstone/permissions/permission.h"
 #include "endstone/permissions/permission_attachment_info.h"
 
 namespace endstone::detail {
 
-PermissibleBase::PermissibleBase(Permissible *opable) : opable_(opable), parent_(opable ? *opable : *this) {}
+PermissibleBase::PermissibleBase(Permissible *opable, EndstonePluginManager *plugin_manager)
+    : opable_(opable), plugin_manager_(plugin_manager), parent_(opable ? *opable : *this)
+{
+}
+
+PermissibleBase::~PermissibleBase()
+{
+    releaseEffectivePermissions();
+}
 
 bool PermissibleBase::isOp() const
 {
@@ -43,8 +54,14 @@ void PermissibleBase::setOp(bool value)
 
 bool PermissibleBase::isPermissionSet(std::string name) const
 {
+    recalculateIfDirty();
     std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
-    return permissions_.find(name) != permissions_.end();
+    return isPermissionSet(getPluginManager().findPermissionId(name));
+}
+
+bool PermissibleBase::isPermissionSet(std::size_t id) const
+{
+    return id < permission_set_.size() && permission_set_[id];
 }
 
 bool PermissibleBase::isPermissionSet(const Permission &perm) const
@@ -54,27 +71,31 @@ bool PermissibleBase::isPermissionSet(const Permission &perm) const
 
 bool PermissibleBase::hasPermission(std::string name) const
 {
+    recalculateIfDirty();
     std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
-    if (isPermissionSet(name)) {
-        return permissions_.find(name)->second->getValue();
-    }
+    auto &plugin_manager = getPluginManager();
+    auto id = plugin_manager.findPermissionId(name);
+    auto *perm = plugin_manager.getPermissionById(id);
+    return hasPermission(id, perm != nullptr ? perm->getDefault() : Permission::DefaultPermission);
+}
 
-    auto &server = entt::locator<EndstoneServer>::value();
-    auto *perm = server.getPluginManager().getPermission(name);
-    if (perm != nullptr) {
-        return hasPermission(perm->getDefault(), isOp());
+bool PermissibleBase::hasPermission(const Permission &perm) const
+{
+    recalculateIfDirty();
+    auto &plugin_manager = getPluginManager();
+    auto id = plugin_manager.findPermissionId(perm);
+    if (id == EndstonePluginManager::InvalidPermissionId) {
+        id = plugin_manager.findPermissionId(perm.getName());
     }
-    return hasPermission(Permission::DefaultPermission, isOp());
+    return hasPermission(id, perm.getDefault());
 }
 
-bool PermissibleBase::hasPermission(const Permission &perm) const
+bool PermissibleBase::hasPermission(std::size_t id, PermissionDefault default_value) const
 {
-    auto name = perm.getName();
-    std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
-    if (isPermissionSet(name)) {
-        return permissions_.find(name)->second->getValue();
+    if (isPermissionSet(id)) {
+        return permission_values_[id];
     }
-    return hasPermission(perm.getDefault(), isOp());
+    return hasPermission(default_value, isOp());
 }
 
 bool PermissibleBase::hasPermission(PermissionDefault default_value, bool op)
@@ -98,7 +119,6 @@ PermissionAttachment *PermissibleBase::addAttachment(Plugin &plugin, const std::
     auto *result = addAttachment(plugin);
     if (result) {
         result->setPermission(name, value);
-        recalculatePermissions();
     }
 
     return result;
@@ -113,10 +133,9 @@ PermissionAttachment *PermissibleBase::addAttachment(Plugin &plugin)
         return nullptr;
     }
 
+    // An empty attachment does not change the effective permissions, so there is nothing to recalculate yet
     auto &it = attachments_.emplace_back(std::make_unique<PermissionAttachment>(plugin, parent_));
-    auto *result = it.get();
-    recalculatePermissions();
-    return result;
+    return it.get();
 }
 
 bool PermissibleBase::removeAttachment(PermissionAttachment &attachment)
@@ -142,8 +161,7 @@ bool PermissibleBase::removeAttachment(PermissionAttachment &attachment)
 
 void PermissibleBase::recalculatePermissions()
 {
-    auto &server = entt::locator<EndstoneServer>::value();
-    auto &plugin_manager = server.getPluginManager();
+    auto &plugin_manager = getPluginManager();
 
     clearPermissions();
     auto defaults = plugin_manager.getDefaultPermissions(isOp());
@@ -152,9 +170,9 @@ void PermissibleBase::recalculatePermissions()
     for (auto *perm : defaults) {
         auto name = perm->getName();
         std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
-        permissions_[name] = std::make_unique<PermissionAttachmentInfo>(parent_, name, nullptr, true);
-        plugin_manager.subscribeToPermission(name, parent_);
-        calculateChildPermissions(perm->getChildren(), false, nullptr);
+        auto id = plugin_manager.internPermission(name);
+        setPermission(id, nullptr, true);
+        calculateChildPermissions(id, false, nullptr);
     }
 
     for (const auto &attachment : attachments_) {
@@ -162,34 +180,59 @@ void PermissibleBase::recalculatePermissions()
     }
 }
 
-// NOLINTNEXTLINE(*-no-recursion)
+void PermissibleBase::recalculatePermission(PermissionAttachment &attachment, const std::string &name, bool value)
+{
+    // Attachments are applied in order, so a change can only be applied on top of the current permissions when no
+    // later attachment could override the subtree it expands to
+    if (attachments_.empty() || attachments_.back().get() != &attachment) {
+        recalculatePermissions();
+        return;
+    }
+    calculateChildPermissions({{name, value}}, false, &attachment);
+}
+
 void PermissibleBase::calculateChildPermissions(const std::unordered_map<std::string, bool> &children, bool invert,
                                                 PermissionAttachment *attachment)
 {
-    auto &server = entt::locator<EndstoneServer>::value();
-    auto &plugin_manager = server.getPluginManager();
+    auto &plugin_manager = getPluginManager();
 
     for (const auto &entry : children) {
         auto name = entry.first;
-
-        auto *perm = plugin_manager.getPermission(name);
         std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
+        auto id = plugin_manager.internPermission(name);
         bool value = entry.second ^ invert;
 
-        permissions_[name] = std::make_unique<PermissionAttachmentInfo>(parent_, name, attachment, value);
-        plugin_manager.subscribeToPermission(name, parent_);
+        setPermission(id, attachment, value);
+        calculateChildPermissions(id, !value, attachment);
+    }
+}
 
-        if (perm != nullptr) {
-            calculateChildPermissions(perm->getChildren(), !value, attachment);
-        }
+void PermissibleBase::calculateChildPermissions(std::size_t id, bool invert, PermissionAttachment *attachment)
+{
+    // The expansion is shared by all permissibles, so applying it is a walk over a flat vector
+    for (const auto &[child_id, value] : getPluginManager().getChildPermissions(id)) {
+        setPermission(child_id, attachment, value ^ invert);
     }
 }
 
 std::unordered_set<PermissionAttachmentInfo *> PermissibleBase::getEffectivePermissions() const
 {
+    recalculateIfDirty();
+    if (effective_permissions_.empty() && !effective_ids_.empty()) {
+        auto &plugin_manager = getPluginManager();
+        effective_permissions_.reserve(effective_ids_.size());
+        for (auto id : effective_ids_) {
+            auto it = permission_attachments_.find(id);
+            auto *attachment = it != permission_attachments_.end() ? it->second : nullptr;
+            effective_permissions_.push_back(std::make_unique<PermissionAttachmentInfo>(
+                parent_, plugin_manager.getPermissionName(id), attachment, permission_values_[id]));
+        }
+        MemoryUsage::getInstance().add(MemorySubsystem::Permissions, effective_permissions_.size() * InfoBytes);
+    }
+
     std::unordered_set<PermissionAttachmentInfo *> result;
-    for (const auto &entry : permissions_) {
-        result.insert(entry.second.get());
+    for (const auto &info : effective_permissions_) {
+        result.insert(info.get());
     }
     return result;
 }
@@ -202,18 +245,69 @@ CommandSender *PermissibleBase::asCommandSender() const
     return nullptr;
 }
 
+void PermissibleBase::setPermission(std::size_t id, PermissionAttachment *attachment, bool value)
+{
+    if (id >= permission_set_.size()) {
+        permission_set_.resize(id + 1);
+        permission_values_.resize(id + 1);
+    }
+    if (!permission_set_[id]) {
+        permission_set_[id] = true;
+        effective_ids_.push_back(id);
+        getPluginManager().subscribeToPermission(id, parent_);
+    }
+    permission_values_[id] = value;
+
+    if (attachment != nullptr) {
+        permission_attachments_[id] = attachment;
+    }
+    else if (!permission_attachments_.empty()) {
+        permission_attachments_.erase(id);
+    }
+    releaseEffectivePermissions();
+}
+
+void PermissibleBase::releaseEffectivePermissions() const
+{
+    if (effective_permissions_.empty()) {
+        return;
+    }
+    MemoryUsage::getInstance().remove(MemorySubsystem::Permissions, effective_permissions_.size() * InfoBytes);
+    effective_permissions_.clear();
+}
+
+EndstonePluginManager &PermissibleBase::getPluginManager() const
+{
+    // Resolved on first use, the server may not be located yet when this is constructed
+    if (!plugin_manager_) {
+        auto &server = entt::locator<EndstoneServer>::value();
+        plugin_manager_ = &static_cast<EndstonePluginManager &>(server.getPluginManager());
+    }
+    return *plugin_manager_;
+}
+
+void PermissibleBase::recalculateIfDirty() const
+{
+    auto &plugin_manager = getPluginManager();
+    if (plugin_manager.hasDirtyPermissibles()) {
+        plugin_manager.recalculateDirtyPermissibles();
+    }
+}
+
 void PermissibleBase::clearPermissions()
 {
-    auto &server = entt::locator<EndstoneServer>::value();
-    auto &plugin_manager = server.getPluginManager();
+    auto &plugin_manager = getPluginManager();
 
     // Clear permissions
-    for (const auto &[name, perm] : permissions_) {
-        plugin_manager.unsubscribeFromPermission(name, parent_);
+    for (auto id : effective_ids_) {
+        plugin_manager.unsubscribeFromPermission(id, parent_);
+        permission_set_[id] = false;
     }
     plugin_manager.unsubscribeFromDefaultPerms(false, parent_);
     plugin_manager.unsubscribeFromDefaultPerms(true, parent_);
-    permissions_.clear();
+    effective_ids_.clear();
+    permission_attachments_.clear();
+    releaseEffectivePermissions();
 }
 
 }  // namespace endstone::detail
@@ -0,0 +1,261 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/persistence/player_data_log.h"
+
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#include <zlib.h>
+
+namespace endstone::detail {
+
+namespace {
+void writeU32(std::string &out, std::uint32_t value)
+{
+    for (auto i = 0; i < 4; i++) {
+        out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+std::uint32_t readU32(const std::string &in, std::size_t offset)
+{
+    std::uint32_t value = 0;
+    for (auto i = 0; i < 4; i++) {
+        value |= static_cast<std::uint32_t>(static_cast<unsigned char>(in[offset + i])) << (8 * i);
+    }
+    return value;
+}
+
+std::uint32_t checksum(const std::string &in, std::size_t offset, std::size_t size)
+{
+    auto crc = crc32(0L, Z_NULL, 0);
+    return crc32(crc, reinterpret_cast<const Bytef *>(in.data() + offset), static_cast<uInt>(size));
+}
+}  // namespace
+
+PlayerDataLog::PlayerDataLog(std::filesystem::path path) : path_(std::move(path)) {}
+
+PlayerDataLog::Entries PlayerDataLog::open()
+{
+    if (!std::filesystem::exists(path_)) {
+        if (path_.has_parent_path()) {
+            std::filesystem::create_directories(path_.parent_path());
+        }
+        std::ofstream file(path_, std::ios::binary);
+        std::string header(Magic, sizeof(Magic));
+        writeU32(header, Version);
+        file.write(header.data(), static_cast<std::streamsize>(header.size()));
+        if (!file) {
+            throw std::runtime_error("Unable to create " + path_.string());
+        }
+    }
+
+    auto entries = replay();
+    reopen();
+    return entries;
+}
+
+void PlayerDataLog::append(const std::vector<Write> &batch)
+{
+    std::string buffer;
+    std::vector<std::size_t> record_sizes;
+    record_sizes.reserve(batch.size());
+    for (const auto &write : batch) {
+        auto start = buffer.size();
+        encode(buffer, write.key, write.value);
+        record_sizes.push_back(buffer.size() - start);
+    }
+
+    // The whole batch goes out in a single write
+    out_.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    out_.flush();
+    if (!out_) {
+        // Part of the batch may have reached the file, it is cut off so the next batch does not follow a torn record
+        out_.close();
+        std::error_code ec;
+        std::filesystem::resize_file(path_, size_, ec);
+        reopen();
+        throw std::runtime_error("Unable to write to " + path_.string());
+    }
+    size_ += buffer.size();
+    for (std::size_t i = 0; i < batch.size(); i++) {
+        track(batch[i].key, batch[i].value, record_sizes[i]);
+    }
+}
+
+bool PlayerDataLog::shouldCompact() const
+{
+    return size_ >= MinCompactionSize && size_ > 2 * (live_size_ + HeaderSize);
+}
+
+void PlayerDataLog::compact()
+{
+    out_.close();
+    Entries entries;
+    try {
+        entries = replay();
+    }
+    catch (...) {
+        reopen();
+        throw;
+    }
+
+    std::string buffer(Magic, sizeof(Magic));
+    writeU32(buffer, Version);
+    for (const auto &[key, value] : entries) {
+        encode(buffer, key, value);
+    }
+
+    // The log is replaced in one rename, a crash halfway through leaves either the old or the new file
+    auto temp = path_;
+    temp += ".tmp";
+    {
+        std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+        file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        file.flush();
+        if (!file) {
+            reopen();
+            throw std::runtime_error("Unable to write to " + temp.string());
+        }
+    }
+    try {
+        std::filesystem::rename(temp, path_);
+    }
+    catch (...) {
+        // The old log is still in place and the one to append to
+        reopen();
+        throw;
+    }
+    size_ = buffer.size();
+    reopen();
+}
+
+const std::filesystem::path &PlayerDataLog::getPath() const
+{
+    return path_;
+}
+
+std::uint64_t PlayerDataLog::getSize() const
+{
+    return size_;
+}
+
+std::uint64_t PlayerDataLog::getLiveSize() const
+{
+    return live_size_;
+}
+
+PlayerDataLog::Entries PlayerDataLog::replay()
+{
+    std::string data;
+    {
+        std::ifstream file(path_, std::ios::binary);
+        if (!file) {
+            throw std::runtime_error("Unable to open " + path_.string());
+        }
+        data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    if (data.size() < HeaderSize || std::memcmp(data.data(), Magic, sizeof(Magic)) != 0) {
+        throw std::runtime_error(path_.string() + " is not a player data log");
+    }
+    if (auto version = readU32(data, sizeof(Magic)); version != Version) {
+        throw std::runtime_error(path_.string() + " has an unsupported version " + std::to_string(version));
+    }
+
+    Entries entries;
+    live_size_ = 0;
+    record_sizes_.clear();
+
+    auto offset = HeaderSize;
+    while (data.size() - offset >= 8) {
+        auto key_size = std::size_t{readU32(data, offset)};
+        auto value_size = readU32(data, offset + 4);
+        auto payload = key_size + (value_size == Tombstone ? 0 : std::size_t{value_size});
+        auto record_size = 8 + payload + 4;
+        if (data.size() - offset < record_size ||
+            checksum(data, offset, 8 + payload) != readU32(data, offset + 8 + payload)) {
+            break;
+        }
+
+        auto key = data.substr(offset + 8, key_size);
+        std::optional<std::string> value;
+        if (value_size != Tombstone) {
+            value = data.substr(offset + 8 + key_size, value_size);
+        }
+        track(key, value, record_size);
+        if (value) {
+            entries[std::move(key)] = std::move(*value);
+        }
+        else {
+            entries.erase(key);
+        }
+        offset += record_size;
+    }
+
+    // Whatever follows the last intact record was torn by a crash, it is cut off so new records follow on cleanly
+    if (offset < data.size()) {
+        std::filesystem::resize_file(path_, offset);
+    }
+    size_ = offset;
+    return entries;
+}
+
+void PlayerDataLog::encode(std::string &out, const std::string &key, const std::optional<std::string> &value)
+{
+    auto start = out.size();
+    writeU32(out, static_cast<std::uint32_t>(key.size()));
+    writeU32(out, value ? static_cast<std::uint32_t>(value->size()) : Tombstone);
+    out += key;
+    if (value) {
+        out += *value;
+    }
+    writeU32(out, checksum(out, start, out.size() - start));
+}
+
+void PlayerDataLog::track(const std::string &key, const std::optional<std::string> &value, std::uint64_t record_size)
+{
+    auto it = record_sizes_.find(key);
+    if (it != record_sizes_.end()) {
+        live_size_ -= it->second;
+    }
+    if (!value) {
+        if (it != record_sizes_.end()) {
+            record_sizes_.erase(it);
+        }
+        return;
+    }
+    live_size_ += record_size;
+    if (it != record_sizes_.end()) {
+        it->second = record_size;
+    }
+    else {
+        record_sizes_.emplace(key, record_size);
+    }
+}
+
+void PlayerDataLog::reopen()
+{
+    out_.close();
+    out_.clear();
+    out_.open(path_, std::ios::binary | std::ios::app);
+    if (!out_) {
+        throw std::runtime_error("Unable to open " + path_.string());
+    }
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,222 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/persistence/player_data_store.h"
+
+#include <exception>
+#include <set>
+#include <utility>
+
+#include "endstone/plugin/plugin.h"
+
+namespace endstone::detail {
+
+EndstonePlayerDataStore::EndstonePlayerDataStore(ThreadPoolExecutor &executor, Logger &logger,
+                                                 std::filesystem::path path)
+    : executor_(executor), logger_(logger)
+{
+    // Loading happens once at startup, before any player can join
+    auto log = std::make_shared<PlayerDataLog>(std::move(path));
+    try {
+        entries_ = log->open();
+        log_ = std::move(log);
+    }
+    catch (std::exception &e) {
+        logger_.error("Unable to load the player data, changes will not be saved: {}", e.what());
+    }
+}
+
+EndstonePlayerDataStore::~EndstonePlayerDataStore()
+{
+    close();
+}
+
+std::optional<std::string> EndstonePlayerDataStore::get(const Plugin &plugin, const UUID &player_id,
+                                                        const std::string &key) const
+{
+    auto it = entries_.find(toPrefix(plugin, player_id) + key);
+    if (it == entries_.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void EndstonePlayerDataStore::set(const Plugin &plugin, const UUID &player_id, const std::string &key,
+                                  std::string value)
+{
+    auto full_key = toPrefix(plugin, player_id) + key;
+    pending_[full_key] = value;
+    entries_[std::move(full_key)] = std::move(value);
+}
+
+bool EndstonePlayerDataStore::remove(const Plugin &plugin, const UUID &player_id, const std::string &key)
+{
+    auto it = entries_.find(toPrefix(plugin, player_id) + key);
+    if (it == entries_.end()) {
+        return false;
+    }
+    pending_[it->first] = std::nullopt;
+    entries_.erase(it);
+    return true;
+}
+
+std::vector<std::string> EndstonePlayerDataStore::getKeys(const Plugin &plugin, const UUID &player_id) const
+{
+    auto prefix = toPrefix(plugin, player_id);
+    std::vector<std::string> keys;
+    for (auto it = entries_.lower_bound(prefix); it != entries_.end(); ++it) {
+        if (it->first.compare(0, prefix.size(), prefix) != 0) {
+            break;
+        }
+        keys.push_back(it->first.substr(prefix.size()));
+    }
+    return keys;
+}
+
+std::vector<EndstonePlayerDataStore::PlayerEntry> EndstonePlayerDataStore::getPlayerEntries(
+    const UUID &player_id) const
+{
+    // Keys are ordered by plugin first, so the values of a player are spread over the whole store
+    auto infix = player_id.str();
+    infix.insert(infix.begin(), '\0');
+    infix.push_back('\0');
+    std::vector<PlayerEntry> result;
+    for (const auto &[key, value] : entries_) {
+        const auto pos = key.find(infix);
+        if (pos == std::string::npos || key.find('\0') != pos) {
+            continue;
+        }
+        result.push_back({key.substr(0, pos), key.substr(pos + infix.size()), value});
+    }
+    return result;
+}
+
+void EndstonePlayerDataStore::replacePlayerEntries(const UUID &player_id, const std::vector<PlayerEntry> &entries)
+{
+    std::set<std::string> keys;
+    for (const auto &entry : entries) {
+        keys.insert(toPrefix(entry.plugin, player_id) + entry.key);
+    }
+    for (const auto &entry : getPlayerEntries(player_id)) {
+        auto full_key = toPrefix(entry.plugin, player_id) + entry.key;
+        if (keys.find(full_key) == keys.end()) {
+            pending_[full_key] = std::nullopt;
+            entries_.erase(full_key);
+        }
+    }
+    for (const auto &entry : entries) {
+        auto full_key = toPrefix(entry.plugin, player_id) + entry.key;
+        pending_[full_key] = entry.value;
+        entries_[std::move(full_key)] = entry.value;
+    }
+}
+
+void EndstonePlayerDataStore::flush()
+{
+    if (!log_ || pending_.empty()) {
+        return;
+    }
+
+    // Only one batch is written at a time, the next one keeps growing until the previous one is done
+    if (in_flight_.valid()) {
+        if (in_flight_.wait_for(std::chrono::seconds::zero()) != std::future_status::ready) {
+            return;
+        }
+        collect();
+    }
+
+    auto batch = std::make_shared<std::vector<PlayerDataLog::Write>>();
+    batch->reserve(pending_.size());
+    for (auto &[key, value] : pending_) {
+        batch->push_back({key, std::move(value)});
+    }
+    pending_.clear();
+
+    in_flight_batch_ = batch;
+    in_flight_ = executor_.submit([log = log_, batch]() {
+        log->append(*batch);
+        if (log->shouldCompact()) {
+            log->compact();
+        }
+    });
+}
+
+void EndstonePlayerDataStore::tick(std::uint64_t current_tick)
+{
+    if (current_tick % FlushIntervalTicks == 0) {
+        flush();
+    }
+}
+
+void EndstonePlayerDataStore::close()
+{
+    if (!log_) {
+        return;
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + ShutdownTimeout;
+    for (auto i = 0; i < 2; i++) {
+        // The first round waits for the batch in flight, the second one for the batch of everything left
+        if (in_flight_.valid() && in_flight_.wait_until(deadline) == std::future_status::ready) {
+            collect();
+        }
+        flush();
+    }
+    if (in_flight_.valid() && in_flight_.wait_until(deadline) == std::future_status::ready) {
+        collect();
+    }
+
+    auto unsaved = pending_.size() + (in_flight_batch_ ? in_flight_batch_->size() : 0);
+    if (unsaved > 0) {
+        logger_.error("Timed out saving the player data, {} changes may be lost.", unsaved);
+    }
+    pending_.clear();
+}
+
+std::size_t EndstonePlayerDataStore::getPendingCount() const
+{
+    return pending_.size();
+}
+
+std::string EndstonePlayerDataStore::toPrefix(const Plugin &plugin, const UUID &player_id)
+{
+    return toPrefix(plugin.getName(), player_id);
+}
+
+std::string EndstonePlayerDataStore::toPrefix(const std::string &plugin, const UUID &player_id)
+{
+    // Names and UUIDs never contain a NUL, so keys from different namespaces cannot collide
+    auto prefix = plugin;
+    prefix.push_back('\0');
+    prefix += player_id.str();
+    prefix.push_back('\0');
+    return prefix;
+}
+
+void EndstonePlayerDataStore::collect()
+{
+    auto batch = std::move(in_flight_batch_);
+    try {
+        in_flight_.get();
+    }
+    catch (std::exception &e) {
+        // Requeue the failed writes unless they were superseded in the meantime
+        logger_.error("Unable to save the player data, retrying with the next batch: {}", e.what());
+        for (const auto &write : *batch) {
+            pending_.emplace(write.key, write.value);
+        }
+    }
+}
+
+}  // namespace endstone::detail
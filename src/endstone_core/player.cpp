@@ -14,18 +14,24 @@
 
 #include "endstone/detail/player.h"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
 #include <boost/uuid/string_generator.hpp>
 #include <magic_enum/magic_enum.hpp>
 
-#include "bedrock/deps/jsoncpp/nlohmann_json.h"
 #include "bedrock/deps/raknet/rak_peer_interface.h"
+#include "bedrock/deps/raknet/raknet_statistics.h"
 #include "bedrock/entity/components/abilities_component.h"
 #include "bedrock/entity/components/user_entity_identifier_component.h"
 #include "bedrock/network/minecraft_packets.h"
+#include "bedrock/network/packet/add_actor_base_packet.h"
 #include "bedrock/network/packet/modal_form_request_packet.h"
-#include "bedrock/network/packet/set_title_packet.h"
-#include "bedrock/network/packet/text_packet.h"
-#include "bedrock/network/packet/toast_request_packet.h"
 #include "bedrock/network/packet/transfer_packet.h"
 #include "bedrock/network/packet/update_abilities_packet.h"
 #include "bedrock/network/server_network_handler.h"
@@ -37,10 +43,19 @@
 #include "endstone/color_format.h"
 #include "endstone/detail/base64.h"
 #include "endstone/detail/form/form_codec.h"
+#include "endstone/detail/form/form_response.h"
+#include "endstone/detail/memory_usage.h"
+#include "endstone/detail/network/chunk_radius_handler.h"
 #include "endstone/detail/network/packet_adapter.h"
+#include "endstone/detail/network/packet_codec.h"
+#include "endstone/detail/network/packet_statistics.h"
 #include "endstone/detail/server.h"
 #include "endstone/form/action_form.h"
 #include "endstone/form/message_form.h"
+#include "endstone/network/remove_actor_packet.h"
+#include "endstone/network/set_title_packet.h"
+#include "endstone/network/text_packet.h"
+#include "endstone/network/toast_request_packet.h"
 
 namespace endstone::detail {
 
@@ -71,33 +86,35 @@ EndstonePlayer::EndstonePlayer(EndstoneServer &server, ::Player &player)
         throw std::runtime_error("Unsupported type of NetworkIdentifier");
     }
 
-    server_.players_.emplace(uuid_, this);
+    server_.addPlayer(*this);
+    server_.addPlayerBoard(*this);
+    MemoryUsage::getInstance().add(MemorySubsystem::Players, sizeof(EndstonePlayer));
 }
 
 EndstonePlayer::~EndstonePlayer()
 {
-    server_.players_.erase(uuid_);
+    server_.removePlayer(*this);
     server_.removePlayerBoard(*this);
+    MemoryUsage::getInstance().remove(MemorySubsystem::Players, sizeof(EndstonePlayer));
+    MemoryUsage::getInstance().remove(MemorySubsystem::Forms, forms_.size() * FormBytes);
 }
 
 void EndstonePlayer::sendMessage(const std::string &message) const
 {
-    auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::Text);
-    auto pk = std::static_pointer_cast<TextPacket>(packet);
-    pk->type = TextPacketType::Raw;
-    pk->message = message;
-    getHandle().sendNetworkPacket(*packet);
+    TextPacket packet;
+    packet.text_type = TextPacket::TextType::Raw;
+    packet.message = message;
+    sendNetworkPacket(packet);
 }
 
 void EndstonePlayer::sendMessage(const Translatable &message) const
 {
-    auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::Text);
-    auto pk = std::static_pointer_cast<TextPacket>(packet);
-    pk->type = TextPacketType::Translate;
-    pk->message = message.getTranslationKey();
-    pk->params = message.getParameters();
-    pk->localize = true;
-    getHandle().sendNetworkPacket(*packet);
+    TextPacket packet;
+    packet.text_type = TextPacket::TextType::Translation;
+    packet.needs_translation = true;
+    packet.message = message.getTranslationKey();
+    packet.parameters = message.getParameters();
+    sendNetworkPacket(packet);
 }
 
 void EndstonePlayer::sendErrorMessage(const std::string &message) const
@@ -160,6 +177,11 @@ void EndstonePlayer::recalculatePermissions()
     perm_.recalculatePermissions();
 }
 
+void EndstonePlayer::recalculatePermission(PermissionAttachment &attachment, const std::string &name, bool value)
+{
+    perm_.recalculatePermission(attachment, name, value);
+}
+
 std::unordered_set<PermissionAttachmentInfo *> EndstonePlayer::getEffectivePermissions() const
 {
     return perm_.getEffectivePermissions();
@@ -244,6 +266,11 @@ bool EndstonePlayer::isDead() const
     return EndstoneMob::isDead();
 }
 
+std::string EndstonePlayer::getType() const
+{
+    return EndstoneMob::getType();
+}
+
 bool EndstonePlayer::isGliding() const
 {
     return EndstoneMob::isGliding();
@@ -266,29 +293,26 @@ const SocketAddress &EndstonePlayer::getAddress() const
 
 void EndstonePlayer::sendPopup(std::string message) const
 {
-    auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::Text);
-    auto pk = std::static_pointer_cast<TextPacket>(packet);
-    pk->type = TextPacketType::Popup;
-    pk->message = std::move(message);
-    getHandle().sendNetworkPacket(*packet);
+    TextPacket packet;
+    packet.text_type = TextPacket::TextType::Popup;
+    packet.message = std::move(message);
+    sendNetworkPacket(packet);
 }
 
 void EndstonePlayer::sendTip(std::string message) const
 {
-    auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::Text);
-    auto pk = std::static_pointer_cast<TextPacket>(packet);
-    pk->type = TextPacketType::Tip;
-    pk->message = std::move(message);
-    getHandle().sendNetworkPacket(*packet);
+    TextPacket packet;
+    packet.text_type = TextPacket::TextType::Tip;
+    packet.message = std::move(message);
+    sendNetworkPacket(packet);
 }
 
 void EndstonePlayer::sendToast(std::string title, std::string content) const
 {
-    auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::ToastRequest);
-    auto pk = std::static_pointer_cast<ToastRequestPacket>(packet);
-    pk->title = std::move(title);
-    pk->content = std::move(content);
-    getHandle().sendNetworkPacket(*packet);
+    ToastRequestPacket packet;
+    packet.title = std::move(title);
+    packet.content = std::move(content);
+    sendNetworkPacket(packet);
 }
 
 void EndstonePlayer::kick(std::string message) const
@@ -417,34 +441,25 @@ void EndstonePlayer::sendTitle(std::string title, std::string subtitle) const
 
 void EndstonePlayer::sendTitle(std::string title, std::string subtitle, int fade_in, int stay, int fade_out) const
 {
-    {
-        auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::SetTitle);
-        auto pk = std::static_pointer_cast<SetTitlePacket>(packet);
-        pk->type = SetTitlePacket::TitleType::Title;
-        pk->title_text = std::move(title);
-        pk->fade_in_time = fade_in;
-        pk->stay_time = stay;
-        pk->fade_out_time = fade_out;
-        getHandle().sendNetworkPacket(*packet);
-    }
-    {
-        auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::SetTitle);
-        auto pk = std::static_pointer_cast<SetTitlePacket>(packet);
-        pk->type = SetTitlePacket::TitleType::Subtitle;
-        pk->title_text = std::move(subtitle);
-        pk->fade_in_time = fade_in;
-        pk->stay_time = stay;
-        pk->fade_out_time = fade_out;
-        getHandle().sendNetworkPacket(*packet);
-    }
+    SetTitlePacket packet;
+    packet.title_type = SetTitlePacket::TitleType::Title;
+    packet.text = std::move(title);
+    packet.fade_in_time = fade_in;
+    packet.stay_time = stay;
+    packet.fade_out_time = fade_out;
+    sendNetworkPacket(packet);
+
+    // The same packet is reused for the subtitle, it has been serialized already
+    packet.title_type = SetTitlePacket::TitleType::Subtitle;
+    packet.text = std::move(subtitle);
+    sendNetworkPacket(packet);
 }
 
 void EndstonePlayer::resetTitle() const
 {
-    auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::SetTitle);
-    auto pk = std::static_pointer_cast<SetTitlePacket>(packet);
-    pk->type = SetTitlePacket::TitleType::Reset;
-    getHandle().sendNetworkPacket(*packet);
+    SetTitlePacket packet;
+    packet.title_type = SetTitlePacket::TitleType::Reset;
+    sendNetworkPacket(packet);
 }
 
 std::chrono::milliseconds EndstonePlayer::getPing() const
@@ -455,23 +470,34 @@ std::chrono::milliseconds EndstonePlayer::getPing() const
     return std::chrono::milliseconds(peer->GetAveragePing(guid));
 }
 
-void EndstonePlayer::updateCommands() const
+NetworkStats EndstonePlayer::getNetworkStats() const
 {
-    auto &registry = server_.getMinecraftCommands().getRegistry();
-    AvailableCommandsPacket packet = registry.serializeAvailableCommands();
-
-    auto &command_map = server_.getCommandMap();
-    for (auto it = packet.commands.begin(); it != packet.commands.end();) {
-        auto &name = it->name;
-        auto *command = command_map.getCommand(name);
-        if (command && command->isRegistered() && command->testPermissionSilently(*static_cast<const Player *>(this)) &&
-            it->permission_level <= player_.getCommandPermissionLevel()) {
-            ++it;
-            continue;
-        }
-        it = packet.commands.erase(it);
+    auto *peer = entt::locator<RakNet::RakPeerInterface *>::value();
+    auto *component = getHandle().tryGetComponent<UserEntityIdentifierComponent>();
+    RakNet::RakNetStatistics statistics{};
+    if (peer->GetStatistics(peer->GetSystemAddressFromGuid(component->network_id.guid), &statistics) == nullptr) {
+        return {};
+    }
+
+    NetworkStats stats;
+    stats.bytes_sent = statistics.runningTotal[RakNet::ACTUAL_BYTES_SENT];
+    stats.bytes_received = statistics.runningTotal[RakNet::ACTUAL_BYTES_RECEIVED];
+    stats.bytes_sent_per_second = statistics.valueOverLastSecond[RakNet::ACTUAL_BYTES_SENT];
+    stats.bytes_received_per_second = statistics.valueOverLastSecond[RakNet::ACTUAL_BYTES_RECEIVED];
+    stats.bytes_resent = statistics.runningTotal[RakNet::USER_MESSAGE_BYTES_RESENT];
+    stats.packet_loss = statistics.packetlossLastSecond;
+    stats.packet_loss_total = statistics.packetlossTotal;
+    for (auto messages : statistics.messageInSendBuffer) {
+        stats.send_queue_size += messages;
     }
+    stats.resend_queue_size = statistics.messagesInResendBuffer;
+    return stats;
+}
 
+void EndstonePlayer::updateCommands() const
+{
+    auto &packet = server_.getCommandMap().getAvailableCommands(*static_cast<const Player *>(this),
+                                                                 player_.getCommandPermissionLevel());
     getHandle().sendNetworkPacket(packet);
 }
 
@@ -548,6 +574,186 @@ void EndstonePlayer::transfer(std::string host, int port) const
     getHandle().sendNetworkPacket(*packet);
 }
 
+void EndstonePlayer::transfer(std::string host, int port, const std::string &server_id) const
+{
+    // The handoff is on its way before the client starts connecting to the target
+    server_.handOffPlayer(*this, server_id);
+    transfer(std::move(host), port);
+}
+
+MovementStats EndstonePlayer::getMovementStats() const
+{
+    return server_.movement_tracker_.getStats(movement_slot_);
+}
+
+Player::Snapshot EndstonePlayer::getSnapshot() const
+{
+    return snapshot_.load();
+}
+
+std::optional<int> EndstonePlayer::getViewDistance() const
+{
+    return view_distance_;
+}
+
+void EndstonePlayer::setViewDistance(std::optional<int> distance)
+{
+    if (distance && *distance <= 0) {
+        throw std::invalid_argument("View distance must be positive");
+    }
+    view_distance_ = distance;
+    ChunkRadiusHandler::getInstance().refresh(*this);
+}
+
+int EndstonePlayer::onChunkRadiusRequested(int radius, std::uint8_t max_radius)
+{
+    requested_chunk_radius_ = {radius, max_radius};
+    return limitChunkRadius(radius);
+}
+
+int EndstonePlayer::limitChunkRadius(int radius) const
+{
+    if (view_distance_) {
+        radius = std::min(radius, *view_distance_);
+    }
+    if (const auto cap = server_.getViewDistanceCap()) {
+        radius = std::min(radius, *cap);
+    }
+    return radius;
+}
+
+std::optional<std::pair<int, std::uint8_t>> EndstonePlayer::getRequestedChunkRadius() const
+{
+    return requested_chunk_radius_;
+}
+
+void EndstonePlayer::hideActor(Actor &actor)
+{
+    if (actor.getRuntimeId() == getRuntimeId()) {
+        return;
+    }
+    if (actor_visibility_.hide(actor.getRuntimeId())) {
+        sendRemoveActor(actor);
+    }
+}
+
+void EndstonePlayer::showActor(Actor &actor)
+{
+    if (actor_visibility_.show(actor.getRuntimeId()) && &actor.getDimension() == &getDimension()) {
+        sendAddActor(actor);
+    }
+}
+
+bool EndstonePlayer::canSee(const Actor &actor) const
+{
+    return !actor_visibility_.isHidden(actor.getRuntimeId());
+}
+
+std::optional<float> EndstonePlayer::getActorCullDistance() const
+{
+    return actor_visibility_.getCullDistance();
+}
+
+void EndstonePlayer::setActorCullDistance(std::optional<float> distance)
+{
+    if (distance && *distance <= 0) {
+        throw std::invalid_argument("Actor cull distance must be positive");
+    }
+    actor_visibility_.setCullDistance(distance);
+}
+
+std::optional<int> EndstonePlayer::getBandwidthLimit() const
+{
+    if (auto rate = outbound_shaper_.getRate()) {
+        return static_cast<int>(*rate);
+    }
+    return std::nullopt;
+}
+
+void EndstonePlayer::setBandwidthLimit(std::optional<int> bytes_per_second)
+{
+    if (bytes_per_second && *bytes_per_second <= 0) {
+        throw std::invalid_argument("Bandwidth limit must be positive");
+    }
+    if (!bytes_per_second) {
+        outbound_shaper_.setRate(std::nullopt);
+        return;
+    }
+    outbound_shaper_.setRate(static_cast<std::size_t>(*bytes_per_second));
+}
+
+void EndstonePlayer::tickOutboundShaping(OutboundShaper::Clock::time_point now)
+{
+    if (!outbound_shaper_.getRate() && !outbound_shaper_.hasQueued()) {
+        return;
+    }
+    if (outbound_shaper_.hasQueued()) {
+        outbound_shaper_.setSendQueueSize(getNetworkStats().send_queue_size);
+        send_queue_tick_ = server_.getCurrentTick();
+    }
+    outbound_shaper_.tick(now);
+}
+
+void EndstonePlayer::publishSnapshot(std::uint64_t tick)
+{
+    const auto location = getLocation();
+    Snapshot snapshot;
+    snapshot.tick = tick;
+    snapshot.x = location.getX();
+    snapshot.y = location.getY();
+    snapshot.z = location.getZ();
+    snapshot.pitch = location.getPitch();
+    snapshot.yaw = location.getYaw();
+    snapshot.dimension = static_cast<int>(getDimension().getType());
+    snapshot.game_mode = getGameMode();
+    snapshot.ping = getPing();
+    snapshot_.store(snapshot);
+}
+
+void EndstonePlayer::updateActorVisibility()
+{
+    auto &dimension = getDimension();
+    if (&dimension != visibility_dimension_) {
+        // The client drops every actor when it changes dimension
+        actor_visibility_.reset();
+        visibility_dimension_ = &dimension;
+    }
+    if (!actor_visibility_.isActive()) {
+        return;
+    }
+
+    // Only the actors in the chunks the client is sent are considered, vanilla does not send the others
+    constexpr int DefaultChunkRadius = 16;
+    const auto radius = limitChunkRadius(requested_chunk_radius_ ? requested_chunk_radius_->first : DefaultChunkRadius);
+    const auto location = getLocation();
+    auto actors = dimension.getNearbyActors(location.getX(), location.getY(), location.getZ(),
+                                            static_cast<float>(radius * 16));
+
+    // Released with the other temporaries of the tick
+    auto &arena = server_.getTickArena();
+    ArenaVector<std::uint64_t> runtime_ids{ArenaAllocator<std::uint64_t>(arena)};
+    VectorArray<float> positions;
+    runtime_ids.reserve(actors.size());
+    positions.reserve(actors.size());
+    actors.erase(std::remove_if(actors.begin(), actors.end(),
+                                [&](const Actor *actor) { return actor->getRuntimeId() == getRuntimeId(); }),
+                 actors.end());
+    for (const auto *actor : actors) {
+        runtime_ids.push_back(actor->getRuntimeId());
+        positions.push_back(actor->getLocation());
+    }
+
+    ArenaVector<std::size_t> remove{ArenaAllocator<std::size_t>(arena)};
+    ArenaVector<std::size_t> add{ArenaAllocator<std::size_t>(arena)};
+    actor_visibility_.update(location, runtime_ids, positions, remove, add);
+    for (auto i : remove) {
+        sendRemoveActor(*actors[i]);
+    }
+    for (auto i : add) {
+        sendAddActor(*actors[i]);
+    }
+}
+
 void EndstonePlayer::sendForm(FormVariant form)
 {
     if (isDead()) {
@@ -556,26 +762,141 @@ void EndstonePlayer::sendForm(FormVariant form)
     auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::ShowModalForm);
     std::shared_ptr<ModalFormRequestPacket> pk = std::static_pointer_cast<ModalFormRequestPacket>(packet);
     pk->form_id = ++form_ids_;
-    pk->form_json = std::visit(entt::overloaded{[](auto &&arg) {
-                                   return FormCodec::toJson(arg);
-                               }},
-                               form)
-                        .dump();
-    forms_.emplace(pk->form_id, std::move(form));
-    getHandle().sendNetworkPacket(*packet);
+    std::visit(entt::overloaded{[&](auto &&arg) {
+                   auto *serialized = arg.getSerialized();
+                   if (serialized && !serialized->empty()) {
+                       pk->form_json = *serialized;
+                       return;
+                   }
+                   pk->form_json.clear();
+                   JsonWriter writer(pk->form_json);
+                   FormCodec::write(writer, arg);
+                   if (serialized) {
+                       *serialized = pk->form_json;
+                   }
+               }},
+               form);
+    if (forms_.size() >= MaxOpenForms) {
+        dismissForm(forms_.begin());
+    }
+    if (forms_.emplace(pk->form_id, std::move(form)).second) {
+        MemoryUsage::getInstance().add(MemorySubsystem::Forms, FormBytes);
+    }
+    static_cast<EndstoneServer &>(getServer()).scheduleFormTimeout(*this, pk->form_id);
+    sendNetworkPacket(MinecraftPacketIds::ShowModalForm, packet, pk->form_json.size());
 }
 
 void EndstonePlayer::closeForm()
 {
     auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::ClientboundCloseScreen);
-    getHandle().sendNetworkPacket(*packet);
+    sendNetworkPacket(MinecraftPacketIds::ClientboundCloseScreen, packet, 1);
+    MemoryUsage::getInstance().remove(MemorySubsystem::Forms, forms_.size() * FormBytes);
     forms_.clear();
 }
 
 void EndstonePlayer::sendPacket(Packet &packet)
 {
+    if (batch_depth_ > 0) {
+        // Copied, as the caller is free to reuse the packet before the batch ends
+        batched_packets_.push_back(PacketCodec::clone(packet));
+        return;
+    }
+    sendNetworkPacket(packet);
+}
+
+void EndstonePlayer::sendRemoveActor(const Actor &actor) const
+{
+    RemoveActorPacket packet;
+    packet.actor_unique_id = actor.getId();
+    sendNetworkPacket(packet);
+}
+
+void EndstonePlayer::sendAddActor(Actor &actor) const
+{
+    auto *handle = dynamic_cast<EndstoneActor *>(&actor);
+    if (!handle) {
+        return;
+    }
+    if (auto packet = handle->getActor().tryCreateAddActorPacket()) {
+        getHandle().sendNetworkPacket(*packet);
+    }
+}
+
+void EndstonePlayer::sendNetworkPacket(Packet &packet) const
+{
+    const auto priority = server_.getPacketPriority(static_cast<int>(packet.getType()));
+    if (canSendNow(priority)) {
+        outbound_shaper_.charge(writeNetworkPacket(packet));
+        return;
+    }
+
+    // Copied, as the caller is free to reuse the packet before it is sent
+    std::shared_ptr<Packet> copy = PacketCodec::clone(packet);
+    outbound_shaper_.submit(priority, [this, copy]() { return writeNetworkPacket(*copy); });
+}
+
+std::size_t EndstonePlayer::writeNetworkPacket(Packet &packet) const
+{
+    // Built on the stack and encoded straight into the network stream, without going through the packet factory
+    const auto id = static_cast<int>(packet.getType());
+    const auto compressibility = server_.getCompressibility(id);
     PacketAdapter pk{packet};
+    pk.setCompressibility(compressibility);
     getHandle().sendNetworkPacket(pk);
+    PacketStatistics::getInstance().recordSent(id, pk.getEncodedSize(),
+                                               compressibility == Compressibility::Compressible);
+    return pk.getEncodedSize();
+}
+
+void EndstonePlayer::sendNetworkPacket(MinecraftPacketIds id, std::shared_ptr<::Packet> packet, std::size_t size) const
+{
+    const auto priority = server_.getPacketPriority(static_cast<int>(id));
+    if (canSendNow(priority)) {
+        getHandle().sendNetworkPacket(*packet);
+        outbound_shaper_.charge(size);
+        return;
+    }
+    outbound_shaper_.submit(priority, [this, packet = std::move(packet), size]() {
+        getHandle().sendNetworkPacket(*packet);
+        return size;
+    });
+}
+
+bool EndstonePlayer::canSendNow(PacketPriority priority) const
+{
+    if (priority == PacketPriority::Bulk) {
+        // Reading the statistics of RakNet takes a lock, it is done at most once a tick
+        const auto tick = server_.getCurrentTick();
+        if (send_queue_tick_ != tick) {
+            outbound_shaper_.setSendQueueSize(getNetworkStats().send_queue_size);
+            send_queue_tick_ = tick;
+        }
+    }
+    return outbound_shaper_.canSend(priority);
+}
+
+void EndstonePlayer::beginBatch()
+{
+    ++batch_depth_;
+}
+
+void EndstonePlayer::endBatch()
+{
+    if (batch_depth_ == 0 || --batch_depth_ > 0) {
+        return;
+    }
+
+    auto packets = std::move(batched_packets_);
+    batched_packets_.clear();
+    if (packets.empty()) {
+        return;
+    }
+
+    for (const auto &packet : packets) {
+        sendNetworkPacket(*packet);
+    }
+    const auto *component = getHandle().getPersistentComponent<UserEntityIdentifierComponent>();
+    getHandle().getLevel().getPacketSender()->flush(component->network_id, [] {});
 }
 
 void EndstonePlayer::onFormClose(int form_id, PlayerFormCloseReason /*reason*/)
@@ -584,41 +905,66 @@ void EndstonePlayer::onFormClose(int form_id, PlayerFormCloseReason /*reason*/)
     if (it == forms_.end()) {
         return;  // Could be a form created via the script api, do nothing
     }
+    dismissForm(it);
+}
 
-    if (!isDead()) {
-        try {
-            std::visit(entt::overloaded{[this](auto &&arg) {
-                           auto callback = arg.getOnClose();
-                           if (callback) {
-                               callback(this);
-                           }
-                       }},
-                       it->second);
-        }
-        catch (std::exception &e) {
-            getServer().getLogger().error("Error occurred when calling a on close callback of a form: {}", e.what());
-        }
+void EndstonePlayer::onFormTimeout(int form_id)
+{
+    if (auto it = forms_.find(form_id); it != forms_.end()) {
+        dismissForm(it);
     }
+}
+
+std::size_t EndstonePlayer::getOpenFormCount() const
+{
+    return forms_.size();
+}
+
+void EndstonePlayer::dismissForm(std::map<int, FormVariant>::iterator it)
+{
+    // Erased before the callback runs, which may send another form
+    auto form = std::move(it->second);
     forms_.erase(it);
+    MemoryUsage::getInstance().remove(MemorySubsystem::Forms, FormBytes);
+    if (isDead()) {
+        return;
+    }
+
+    try {
+        std::visit(entt::overloaded{[this](auto &&arg) {
+                       auto callback = arg.getOnClose();
+                       if (callback) {
+                           callback(this);
+                       }
+                   }},
+                   form);
+    }
+    catch (std::exception &e) {
+        getServer().getLogger().error("Error occurred when calling a on close callback of a form: {}", e.what());
+    }
 }
 
-void EndstonePlayer::onFormResponse(int form_id, const nlohmann::json &json)
+void EndstonePlayer::onFormResponse(int form_id, const FormResponse &response)
 {
     auto it = forms_.find(form_id);
     if (it == forms_.end()) {
         return;  // Could be a form created via the script api, do nothing
     }
 
+    // Erased before the callbacks run, which may send another form
+    auto sent_form = std::move(it->second);
+    forms_.erase(it);
+    MemoryUsage::getInstance().remove(MemorySubsystem::Forms, FormBytes);
     if (!isDead()) {
         try {
             std::visit(entt::overloaded{
                            [&](const MessageForm &form) {
                                if (auto callback = form.getOnSubmit()) {
-                                   callback(this, json.get<bool>() ? 0 : 1);
+                                   callback(this, response.asBool() ? 0 : 1);
                                }
                            },
                            [&](const ActionForm &form) {
-                               int selection = json.get<int>();
+                               int selection = response.asInt();
                                if (auto callback = form.getOnSubmit()) {
                                    callback(this, selection);
                                }
@@ -632,56 +978,109 @@ void EndstonePlayer::onFormResponse(int form_id, const nlohmann::json &json)
                            },
                            [&](const ModalForm &form) {
                                if (auto callback = form.getOnSubmit()) {
-                                   callback(this, json.dump());
+                                   callback(this, response.dump());
                                }
                            },
                        },
-                       it->second);
+                       sent_form);
         }
         catch (std::exception &e) {
             getServer().getLogger().error("Error occurred when calling a on submit callback of a form: {}", e.what());
         }
     }
-    forms_.erase(it);
 }
 
-void EndstonePlayer::initFromConnectionRequest(
+struct EndstonePlayer::ConnectionData {
+    std::string locale;
+    std::string device_os;
+    std::string device_id;
+    std::string skin_id;
+    int skin_height;
+    int skin_width;
+    std::string skin_data;  // base64 encoded until decoded
+    std::string cape_id;
+    int cape_height;
+    int cape_width;
+    std::string cape_data;  // base64 encoded until decoded
+
+    // Whoever claims the data first decodes it, so a busy pool never holds the server thread up for long
+    std::atomic<bool> claimed{false};
+    std::promise<void> decoded;
+    std::future<void> result = decoded.get_future();
+
+    void decode()
+    {
+        try {
+            skin_data = base64_decode(skin_data).value_or("");
+            cape_data = base64_decode(cape_data).value_or("");
+            decoded.set_value();
+        }
+        catch (...) {
+            decoded.set_exception(std::current_exception());
+        }
+    }
+};
+
+std::shared_ptr<EndstonePlayer::ConnectionData> EndstonePlayer::readConnectionRequest(
+    ThreadPoolExecutor &executor,
     std::variant<const ::ConnectionRequest *, const ::SubClientConnectionRequest *> request)
 {
+    auto data = std::make_shared<ConnectionData>();
     std::visit(
         [&](auto &&req) {
-            if (auto locale = req->getData("LanguageCode").asString(); !locale.empty()) {
-                locale_ = locale;
-            }
-
+            data->locale = req->getData("LanguageCode").asString();
             if (auto device_os = req->getData("DeviceOS").asInt(); device_os > 0) {
                 auto platform = magic_enum::enum_cast<BuildPlatform>(device_os).value_or(BuildPlatform::Unknown);
-                device_os_ = magic_enum::enum_name(platform);
-            }
-
-            if (auto device_id = req->getData("DeviceId").asString(); !device_id.empty()) {
-                device_id_ = device_id;
-            }
-
-            {
-                auto skin_id = req->getData("SkinId").asString();
-                auto skin_height = req->getData("SkinImageHeight").asInt();
-                auto skin_width = req->getData("SkinImageWidth").asInt();
-                auto skin_data = base64_decode(req->getData("SkinData").asString()).value_or("");
-                auto cape_id = req->getData("CapeId").asString();
-                auto cape_height = req->getData("CapeImageHeight").asInt();
-                auto cape_width = req->getData("CapeImageWidth").asInt();
-                auto cape_data = base64_decode(req->getData("CapeData").asString()).value_or("");
-                skin_ = {skin_id, Skin::ImageData{skin_height, skin_width, skin_data}, cape_id,
-                         Skin::ImageData{cape_height, cape_width, cape_data}};
+                data->device_os = magic_enum::enum_name(platform);
             }
+            data->device_id = req->getData("DeviceId").asString();
+            data->skin_id = req->getData("SkinId").asString();
+            data->skin_height = req->getData("SkinImageHeight").asInt();
+            data->skin_width = req->getData("SkinImageWidth").asInt();
+            data->skin_data = req->getData("SkinData").asString();
+            data->cape_id = req->getData("CapeId").asString();
+            data->cape_height = req->getData("CapeImageHeight").asInt();
+            data->cape_width = req->getData("CapeImageWidth").asInt();
+            data->cape_data = req->getData("CapeData").asString();
         },
         request);
+
+    executor.submit([data]() {
+        if (!data->claimed.exchange(true)) {
+            data->decode();
+        }
+    });
+    return data;
+}
+
+void EndstonePlayer::initFromConnectionRequest(ConnectionData &data)
+{
+    if (!data.claimed.exchange(true)) {
+        data.decode();
+    }
+    data.result.get();
+
+    if (!data.locale.empty()) {
+        locale_ = std::move(data.locale);
+    }
+    if (!data.device_os.empty()) {
+        device_os_ = std::move(data.device_os);
+    }
+    if (!data.device_id.empty()) {
+        device_id_ = std::move(data.device_id);
+    }
+
+    auto &pool = server_.skin_data_pool_;
+    skin_ = {std::move(data.skin_id),
+             Skin::ImageData{data.skin_height, data.skin_width, pool.intern(std::move(data.skin_data))},
+             std::move(data.cape_id),
+             Skin::ImageData{data.cape_height, data.cape_width, pool.intern(std::move(data.cape_data))}};
 }
 
 void EndstonePlayer::disconnect()
 {
     perm_.clearPermissions();
+    inventory_->close();
 }
 
 void EndstonePlayer::updateAbilities() const
@@ -14,6 +14,7 @@
 
 #include "endstone/detail/plugin/cpp_plugin_loader.h"
 
+#include <algorithm>
 #include <filesystem>
 #include <regex>
 namespace fs = std::filesystem;
@@ -24,12 +25,14 @@ namespace fs = std::filesystem;
 
 #ifdef _WIN32
 #include <Windows.h>
+#define LIBRARY_HANDLE                 HMODULE
 #define LOAD_LIBRARY(file)             LoadLibraryA(file)
 #define GET_FUNCTION(module, function) GetProcAddress(module, function)
 #define GET_ERROR()                    GetLastError()
 #define CLOSE_LIBRARY(module)          FreeLibrary(module)
 #elif __linux__
 #include <dlfcn.h>
+#define LIBRARY_HANDLE                 void *
 #define LOAD_LIBRARY(file)             dlopen(file, RTLD_NOW)
 #define GET_FUNCTION(module, function) dlsym(module, function)
 #define GET_ERROR()                    dlerror()
@@ -55,26 +58,29 @@ std::vector<Plugin *> CppPluginLoader::loadPlugins(const std::string &directory)
         return {};
     }
 
+    // Compiled once for the whole directory rather than once per file
+    std::vector<std::regex> filters;
+    for (const auto &pattern : getPluginFileFilters()) {
+        filters.emplace_back(pattern, std::regex::optimize);
+    }
+
     std::vector<Plugin *> loaded_plugins;
 
     for (const auto &entry : fs::directory_iterator(dir)) {
-        fs::path file;
+        if (!entry.is_regular_file()) {
+            continue;
+        }
 
-        if (!is_regular_file(entry.status())) {
+        const auto file = entry.path().string();
+        const auto matches = [&file](const std::regex &filter) { return std::regex_search(file, filter); };
+        if (std::none_of(filters.begin(), filters.end(), matches)) {
             continue;
         }
 
-        file = entry.path();
-
-        for (const auto &pattern : getPluginFileFilters()) {
-            std::regex r(pattern);
-            if (std::regex_search(file.string(), r)) {
-                auto plugin = loadPlugin(file.string());
-                if (plugin) {
-                    loaded_plugins.push_back(plugin.get());
-                    plugins_.push_back(std::move(plugin));
-                }
-            }
+        auto plugin = loadPlugin(file);
+        if (plugin) {
+            loaded_plugins.push_back(plugin.get());
+            plugins_.push_back(std::move(plugin));
         }
     }
 
@@ -120,9 +126,34 @@ std::unique_ptr<Plugin> CppPluginLoader::loadPlugin(const std::string &file)
         return nullptr;
     }
 
+    libraries_[plugin] = {file, module};
     return std::unique_ptr<Plugin>(plugin);
 }
 
+Plugin *CppPluginLoader::reloadPlugin(Plugin &plugin)
+{
+    auto it = std::find_if(plugins_.begin(), plugins_.end(), [&plugin](const auto &p) { return p.get() == &plugin; });
+    auto library = libraries_.find(&plugin);
+    if (it == plugins_.end() || library == libraries_.end()) {
+        return nullptr;
+    }
+
+    // The plugin is destroyed before its library is closed, as its destructor lives in the library
+    auto file = library->second.file;
+    auto *module = static_cast<LIBRARY_HANDLE>(library->second.module);
+    libraries_.erase(library);
+    plugins_.erase(it);
+    CLOSE_LIBRARY(module);
+
+    auto reloaded = loadPlugin(file);
+    if (!reloaded) {
+        return nullptr;
+    }
+    auto *result = reloaded.get();
+    plugins_.push_back(std::move(reloaded));
+    return result;
+}
+
 std::vector<std::string> CppPluginLoader::getPluginFileFilters() const
 {
 #ifdef _WIN32
@@ -134,6 +165,7 @@ std::vector<std::string> CppPluginLoader::getPluginFileFilters() const
 
 }  // namespace endstone::detail
 
+#undef LIBRARY_HANDLE
 #undef LOAD_LIBRARY
 #undef GET_FUNCTION
 #undef GET_ERROR
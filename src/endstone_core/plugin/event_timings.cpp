@@ -0,0 +1,93 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/plugin/event_timings.h"
+
+#include <algorithm>
+#include <mutex>
+
+namespace endstone::detail {
+
+void EventTimings::setEnabled(bool enabled)
+{
+    enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+void EventTimings::record(const EventHandler &handler, std::size_t event_type, std::chrono::nanoseconds elapsed)
+{
+    auto value = static_cast<std::uint64_t>(std::max<std::int64_t>(elapsed.count(), 0));
+    update(handler, event_type, [&](Entry &entry) {
+        entry.count.fetch_add(1, std::memory_order_relaxed);
+        entry.total.fetch_add(value, std::memory_order_relaxed);
+        auto max = entry.max.load(std::memory_order_relaxed);
+        while (value > max && !entry.max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {}
+        entry.histogram.record(value);
+    });
+}
+
+std::vector<EventTiming> EventTimings::getTimings() const
+{
+    std::shared_lock lock(mutex_);
+    std::vector<EventTiming> timings;
+    timings.reserve(entries_.size());
+    for (const auto &[key, entry] : entries_) {
+        auto count = entry->count.load(std::memory_order_relaxed);
+        if (count == 0) {
+            continue;
+        }
+        auto max = entry->max.load(std::memory_order_relaxed);
+        timings.push_back({
+            entry->plugin,
+            entry->event,
+            entry->priority,
+            count,
+            std::chrono::nanoseconds(entry->total.load(std::memory_order_relaxed)),
+            std::chrono::nanoseconds(max),
+            std::chrono::nanoseconds(std::min(entry->histogram.getPercentile(0.99, count), max)),
+        });
+    }
+    return timings;
+}
+
+void EventTimings::reset()
+{
+    std::unique_lock lock(mutex_);
+    entries_.clear();
+}
+
+template <typename Func>
+void EventTimings::update(const EventHandler &handler, std::size_t event_type, Func &&func)
+{
+    Key key{&handler.getPlugin(), event_type, handler.getPriority()};
+    {
+        // Handlers run on worker threads too, entries are only destroyed by reset(), which waits for the lock
+        std::shared_lock lock(mutex_);
+        if (auto it = entries_.find(key); it != entries_.end()) {
+            func(*it->second);
+            return;
+        }
+    }
+
+    std::unique_lock lock(mutex_);
+    auto &entry = entries_[key];
+    if (!entry) {
+        entry = std::make_unique<Entry>();
+        entry->plugin = handler.getPlugin().getName();
+        entry->event = handler.getEventType();
+        entry->priority = handler.getPriority();
+    }
+    func(*entry);
+}
+
+}  // namespace endstone::detail
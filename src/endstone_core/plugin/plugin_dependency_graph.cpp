@@ -0,0 +1,173 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/plugin/plugin_dependency_graph.h"
+
+#include <set>
+#include <unordered_map>
+#include <utility>
+
+#include <fmt/format.h>
+
+namespace endstone::detail {
+
+PluginDependencyGraph::PluginDependencyGraph(const std::vector<const PluginDescription *> &descriptions,
+                                             const std::unordered_set<std::string> &loaded)
+{
+    const auto count = descriptions.size();
+
+    // Real names take precedence over provided ones, and the first plugin providing a name wins
+    std::unordered_map<std::string, std::size_t> names;
+    for (std::size_t i = 0; i < count; i++) {
+        names.emplace(descriptions[i]->getName(), i);
+    }
+    for (std::size_t i = 0; i < count; i++) {
+        for (const auto &provided : descriptions[i]->getProvides()) {
+            names.emplace(provided, i);
+        }
+    }
+
+    std::vector<std::string> reasons(count);  // Empty while the plugin is accepted
+    std::vector<std::vector<std::size_t>> hard(count);
+    std::vector<std::vector<std::size_t>> soft(count);
+    for (std::size_t i = 0; i < count; i++) {
+        const auto &description = *descriptions[i];
+        for (const auto &dependency : description.getDepend()) {
+            if (auto it = names.find(dependency); it != names.end()) {
+                if (it->second != i) {
+                    hard[i].push_back(it->second);
+                }
+            }
+            else if (loaded.find(dependency) == loaded.end() && reasons[i].empty()) {
+                reasons[i] = fmt::format("Unknown dependency '{}'.", dependency);
+            }
+        }
+        for (const auto &dependency : description.getSoftDepend()) {
+            if (auto it = names.find(dependency); it != names.end() && it->second != i) {
+                soft[i].push_back(it->second);
+            }
+        }
+        for (const auto &dependent : description.getLoadBefore()) {
+            if (auto it = names.find(dependent); it != names.end() && it->second != i) {
+                soft[it->second].push_back(i);
+            }
+        }
+    }
+
+    // A plugin cannot load without its dependencies
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (std::size_t i = 0; i < count; i++) {
+            if (!reasons[i].empty()) {
+                continue;
+            }
+            for (auto dependency : hard[i]) {
+                if (!reasons[dependency].empty()) {
+                    reasons[i] =
+                        fmt::format("Dependency '{}' could not be loaded.", descriptions[dependency]->getName());
+                    changed = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    struct Edge {
+        std::size_t to;
+        bool hard;
+    };
+    std::vector<std::vector<Edge>> edges(count);
+    std::vector<std::size_t> hard_in(count, 0);
+    std::vector<std::size_t> soft_in(count, 0);
+    std::size_t remaining = 0;
+    for (std::size_t i = 0; i < count; i++) {
+        if (!reasons[i].empty()) {
+            continue;
+        }
+        ++remaining;
+        for (auto dependency : hard[i]) {
+            edges[dependency].push_back({i, true});
+            ++hard_in[i];
+        }
+        for (auto dependency : soft[i]) {
+            if (reasons[dependency].empty()) {
+                edges[dependency].push_back({i, false});
+                ++soft_in[i];
+            }
+        }
+    }
+
+    // Kahn's algorithm, taking the lowest index that is ready so that the given order is kept where possible
+    std::set<std::size_t> ready;
+    std::vector<bool> queued(count, false);
+    for (std::size_t i = 0; i < count; i++) {
+        if (reasons[i].empty() && hard_in[i] == 0 && soft_in[i] == 0) {
+            ready.insert(i);
+            queued[i] = true;
+        }
+    }
+
+    order_.reserve(remaining);
+    while (remaining > 0) {
+        if (ready.empty()) {
+            // Only cycles are left, break one on the first plugin that waits on soft dependencies alone
+            for (std::size_t i = 0; i < count; i++) {
+                if (reasons[i].empty() && !queued[i] && hard_in[i] == 0) {
+                    ready.insert(i);
+                    queued[i] = true;
+                    break;
+                }
+            }
+            if (ready.empty()) {
+                break;
+            }
+        }
+
+        auto current = *ready.begin();
+        ready.erase(ready.begin());
+        order_.push_back(current);
+        --remaining;
+        for (const auto &edge : edges[current]) {
+            if (queued[edge.to]) {
+                continue;
+            }
+            --(edge.hard ? hard_in : soft_in)[edge.to];
+            if (hard_in[edge.to] == 0 && soft_in[edge.to] == 0) {
+                ready.insert(edge.to);
+                queued[edge.to] = true;
+            }
+        }
+    }
+
+    for (std::size_t i = 0; i < count; i++) {
+        if (reasons[i].empty() && !queued[i]) {
+            reasons[i] = "Circular dependency detected.";
+        }
+        if (!reasons[i].empty()) {
+            rejections_.push_back({i, std::move(reasons[i])});
+        }
+    }
+}
+
+const std::vector<std::size_t> &PluginDependencyGraph::getOrder() const
+{
+    return order_;
+}
+
+const std::vector<PluginDependencyGraph::Rejection> &PluginDependencyGraph::getRejections() const
+{
+    return rejections_;
+}
+
+}  // namespace endstone::detail
@@ -15,25 +15,42 @@
 #include "endstone/detail/plugin/plugin_manager.h"
 
 #include <algorithm>
+#include <cctype>
+#include <chrono>
 #include <filesystem>
 #include <memory>
-#include <regex>
+#include <mutex>
 #include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "endstone/detail/logger_factory.h"
+#include "endstone/detail/memory_usage.h"
+#include "endstone/detail/metrics/metrics_registry.h"
+#include "endstone/detail/plugin/plugin_dependency_graph.h"
+#include "endstone/detail/startup_timings.h"
 #include "endstone/event/event.h"
 #include "endstone/event/event_handler.h"
 #include "endstone/event/handler_list.h"
+#include "endstone/level/dimension.h"
+#include "endstone/level/level.h"
 #include "endstone/plugin/plugin.h"
 #include "endstone/plugin/plugin_loader.h"
+#include "endstone/scheduler/scheduler.h"
 #include "endstone/server.h"
 
 namespace fs = std::filesystem;
 
 namespace endstone::detail {
 
+namespace {
+// A handler with its shared control block, held by the list of its priority and by the baked snapshot
+constexpr std::size_t HandlerBytes = sizeof(EventHandler) + 4 * sizeof(void *) + 2 * sizeof(std::shared_ptr<void>);
+}  // namespace
+
 EndstonePluginManager::EndstonePluginManager(Server &server)
     : server_(server), default_perms_({{true, {}}, {false, {}}})
 {
@@ -83,9 +100,7 @@ bool EndstonePluginManager::isPluginEnabled(Plugin *plugin) const
 
 std::vector<Plugin *> EndstonePluginManager::loadPlugins(const std::string &directory)
 {
-    std::vector<Plugin *> loaded_plugins;
-
-    // TODO(plugin): handling logic for depend, soft_depend, load_before and provides
+    std::vector<std::pair<Plugin *, PluginLoader *>> candidates;
     for (const auto &loader : plugin_loaders_) {
         auto plugins = loader->loadPlugins(directory);
         for (const auto &plugin : plugins) {
@@ -95,8 +110,8 @@ std::vector<Plugin *> EndstonePluginManager::loadPlugins(const std::string &dire
 
             auto name = plugin->getDescription().getName();
 
-            const static std::regex valid_name{"^[a-z0-9_]+$"};
-            if (!std::regex_match(name, valid_name)) {
+            const auto valid_char = [](unsigned char c) { return std::islower(c) || std::isdigit(c) || c == '_'; };
+            if (name.empty() || !std::all_of(name.begin(), name.end(), valid_char)) {
                 server_.getLogger().error("Could not load plugin '{}': Plugin name contains invalid characters.", name);
                 server_.getLogger().error(
                     "A valid plugin name should only contain lowercase letters, numbers and underscores.");
@@ -109,31 +124,95 @@ std::vector<Plugin *> EndstonePluginManager::loadPlugins(const std::string &dire
                 continue;
             }
 
-            initPlugin(*plugin, *loader, fs::path(directory));
-            plugins_.push_back(plugin);
-            lookup_names_[name] = plugin;
-            loaded_plugins.push_back(plugin);
+            candidates.emplace_back(plugin, loader.get());
         }
     }
 
+    // Plugins loaded earlier satisfy the dependencies of the new ones
+    std::unordered_set<std::string> loaded_names;
+    for (const auto &plugin : plugins_) {
+        const auto &description = plugin->getDescription();
+        loaded_names.insert(description.getName());
+        loaded_names.insert(description.getProvides().begin(), description.getProvides().end());
+    }
+
+    std::vector<const PluginDescription *> descriptions;
+    descriptions.reserve(candidates.size());
+    for (const auto &[plugin, loader] : candidates) {
+        descriptions.push_back(&plugin->getDescription());
+    }
+
+    PluginDependencyGraph graph{descriptions, loaded_names};
+    for (const auto &[index, reason] : graph.getRejections()) {
+        server_.getLogger().error("Could not load plugin '{}': {}", descriptions[index]->getName(), reason);
+    }
+
+    // Plugins are registered in dependency order, which is also the order they are enabled in
+    std::vector<Plugin *> loaded_plugins;
+    loaded_plugins.reserve(graph.getOrder().size());
+    for (const auto index : graph.getOrder()) {
+        auto [plugin, loader] = candidates[index];
+        initPlugin(*plugin, *loader, fs::path(directory));
+        plugins_.push_back(plugin);
+        lookup_names_[plugin->getDescription().getName()] = plugin;
+        loaded_plugins.push_back(plugin);
+    }
+
     for (const auto &plugin : loaded_plugins) {
-        plugin->getLogger().info("Loading {}", plugin->getDescription().getFullName());
-        try {
-            plugin->onLoad();
-        }
-        catch (std::exception &e) {
-            plugin->getLogger().error("Error occurred when loading {}", plugin->getDescription().getFullName());
-            plugin->getLogger().error(e.what());
-        }
+        callOnLoad(*plugin);
     }
 
     return loaded_plugins;
 }
 
+Plugin *EndstonePluginManager::reloadPlugin(Plugin &plugin)
+{
+    auto it = std::find(plugins_.begin(), plugins_.end(), &plugin);
+    if (it == plugins_.end()) {
+        return nullptr;
+    }
+
+    const auto name = plugin.getDescription().getName();
+    for (const auto *other : plugins_) {
+        const auto &depend = other->getDescription().getDepend();
+        if (other != &plugin && std::find(depend.begin(), depend.end(), name) != depend.end()) {
+            server_.getLogger().warning("Plugin {} depends on {} and may need to be reloaded as well.",
+                                        other->getDescription().getFullName(), plugin.getDescription().getFullName());
+        }
+    }
+
+    disablePlugin(plugin);
+    unregisterEvents(plugin);
+    server_.getScheduler().cancelTasks(plugin);
+    for (const auto &perm : plugin.getDescription().getPermissions()) {
+        removePermission(perm.getName());
+    }
+
+    auto &loader = plugin.getPluginLoader();
+    auto base_folder = plugin.getDataFolder().parent_path();
+    auto position = plugins_.erase(it) - plugins_.begin();
+    lookup_names_.erase(name);
+
+    // The old instance is destroyed by its loader, nothing may refer to it past this point
+    auto *reloaded = loader.reloadPlugin(plugin);
+    if (!reloaded) {
+        return nullptr;
+    }
+
+    initPlugin(*reloaded, loader, base_folder);
+    plugins_.insert(plugins_.begin() + position, reloaded);
+    lookup_names_[reloaded->getDescription().getName()] = reloaded;
+    callOnLoad(*reloaded);
+    return reloaded;
+}
+
 void EndstonePluginManager::enablePlugin(Plugin &plugin) const
 {
     if (!plugin.isEnabled()) {
+        const auto start = StartupTimings::Clock::now();
         plugin.getPluginLoader().enablePlugin(plugin);
+        StartupTimings::getInstance().recordEnable(plugin.getDescription().getName(),
+                                                   StartupTimings::Clock::now() - start);
     }
 }
 
@@ -149,6 +228,13 @@ void EndstonePluginManager::disablePlugin(Plugin &plugin) const
     if (plugin.isEnabled()) {
         plugin.getPluginLoader().disablePlugin(plugin);
     }
+    server_.getMessenger().unregister(plugin);
+    server_.getPacketInterceptor().unregister(plugin);
+    if (auto *level = server_.getLevel()) {
+        for (auto *dimension : level->getDimensions()) {
+            dimension->removeChunkTickets(plugin);
+        }
+    }
 }
 
 void EndstonePluginManager::disablePlugins() const
@@ -161,16 +247,55 @@ void EndstonePluginManager::disablePlugins() const
 void EndstonePluginManager::clearPlugins()
 {
     disablePlugins();
+    for (const auto &plugin : plugins_) {
+        unregisterEvents(*plugin);
+    }
+    timings_.reset();
     plugins_.clear();
     lookup_names_.clear();
-    // TODO: recreate dependency graph
-    event_handlers_.clear();
     plugin_loaders_.clear();
     permissions_.clear();
+    std::fill(permissions_by_id_.begin(), permissions_by_id_.end(), nullptr);
+    registered_ids_.clear();
+    child_permissions_.clear();
     default_perms_[true].clear();
     default_perms_[false].clear();
 }
 
+/**
+ * Keeps the dispatch scope of the last called handler entered, until a handler with another scope is called.
+ */
+class EndstonePluginManager::ScopeGuard {
+public:
+    explicit ScopeGuard(Event &event) : event_(event) {}
+    ScopeGuard(const ScopeGuard &) = delete;
+    ScopeGuard &operator=(const ScopeGuard &) = delete;
+
+    ~ScopeGuard()
+    {
+        enter(nullptr);
+    }
+
+    void enter(EventDispatchScope *scope)
+    {
+        if (scope == scope_) {
+            return;
+        }
+        if (scope_) {
+            scope_->exit(event_);
+            scope_ = nullptr;
+        }
+        if (scope) {
+            scope->enter(event_);
+            scope_ = scope;
+        }
+    }
+
+private:
+    Event &event_;
+    EventDispatchScope *scope_{nullptr};
+};
+
 void EndstonePluginManager::callEvent(Event &event)
 {
     if (event.isAsynchronous() && server_.isPrimaryThread()) {
@@ -183,24 +308,67 @@ void EndstonePluginManager::callEvent(Event &event)
         return;
     }
 
-    auto &handler_list = event_handlers_.emplace(event.getEventName(), event.getEventName()).first->second;
-    for (const auto &handler : handler_list.getHandlers()) {
-        auto &plugin = handler->getPlugin();
-        if (!plugin.isEnabled()) {
+    auto type = getEventType(event);
+    auto *handler_list = getHandlerList(type);
+    if (!handler_list) {
+        return;
+    }
+
+    auto baked = handler_list->getHandlers();
+    const auto &handlers = baked->handlers;
+    const auto &accepting_cancelled = baked->accepting_cancelled;
+    const bool cancellable = event.isCancellable();
+    static auto &dispatched = MetricsRegistry::getInstance().counter("endstone_events_total", "Events dispatched.");
+    static auto &dispatch_duration = MetricsRegistry::getInstance().histogram(
+        "endstone_event_dispatch_duration_seconds", "Time spent in the handlers of an event.",
+        {0.00001, 0.00005, 0.0001, 0.0005, 0.001, 0.005, 0.01, 0.05});
+    const auto start = std::chrono::steady_clock::now();
+    ScopeGuard scope{event};
+    std::size_t i = 0;
+    while (i < handlers.size()) {
+        if (cancellable && event.isCancelled()) {
+            // Skip straight to the handlers accepting cancelled events until one of them uncancels it
+            auto it = std::lower_bound(accepting_cancelled.begin(), accepting_cancelled.end(), i);
+            for (; it != accepting_cancelled.end() && event.isCancelled(); ++it) {
+                callHandler(*handlers[*it], event, type, scope);
+                i = *it + 1;
+            }
+            if (event.isCancelled()) {
+                break;
+            }
             continue;
         }
+        callHandler(*handlers[i++], event, type, scope);
+    }
+    dispatched.inc();
+    dispatch_duration.observe(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+}
+
+void EndstonePluginManager::callHandler(EventHandler &handler, Event &event, std::size_t type, ScopeGuard &scope)
+{
+    auto &plugin = handler.getPlugin();
+    if (!plugin.isEnabled()) {
+        return;
+    }
 
-        try {
-            handler->callEvent(event);
+    try {
+        scope.enter(handler.getExecutor().getScope());
+        if (timings_.isEnabled()) {
+            auto start = std::chrono::steady_clock::now();
+            handler.callEvent(event);
+            timings_.record(handler, type, std::chrono::steady_clock::now() - start);
         }
-        catch (std::exception &e) {
-            server_.getLogger().error("Could not pass event {} to plugin {}. {}", event.getEventName(),
-                                      plugin.getDescription().getFullName(), e.what());
+        else {
+            handler.callEvent(event);
         }
     }
+    catch (std::exception &e) {
+        server_.getLogger().error("Could not pass event {} to plugin {}. {}", event.getEventName(),
+                                  plugin.getDescription().getFullName(), e.what());
+    }
 }
 
-void EndstonePluginManager::registerEvent(std::string event, std::function<void(Event &)> executor,
+void EndstonePluginManager::registerEvent(std::string event, EventExecutor executor,
                                           EventPriority priority, Plugin &plugin, bool ignore_cancelled)
 {
     if (!plugin.isEnabled()) {
@@ -209,11 +377,126 @@ void EndstonePluginManager::registerEvent(std::string event, std::function<void(
         return;
     }
 
-    auto &handler_list = event_handlers_.emplace(event, event).first->second;
-    if (handler_list.registerHandler(
-            std::make_unique<EventHandler>(event, executor, priority, plugin, ignore_cancelled)) == nullptr) {
-        server_.getLogger().error("Plugin {} failed to register listener for event {}.", event);
+    auto *handler_list = getOrCreateHandlerList(event);
+    if (!handler_list ||
+        handler_list->registerHandler(
+            std::make_unique<EventHandler>(event, std::move(executor), priority, plugin, ignore_cancelled)) == nullptr) {
+        server_.getLogger().error("Plugin {} failed to register listener for event {}.",
+                                  plugin.getDescription().getFullName(), event);
+        return;
+    }
+
+    MemoryUsage::getInstance().add(MemorySubsystem::EventHandlers, HandlerBytes);
+    auto &lists = plugin_handler_lists_[&plugin];
+    if (std::find(lists.begin(), lists.end(), handler_list) == lists.end()) {
+        lists.push_back(handler_list);
+    }
+}
+
+void EndstonePluginManager::unregisterEvents(Plugin &plugin)
+{
+    // Only the lists the plugin registered handlers in are visited, the other event types are left untouched
+    auto it = plugin_handler_lists_.find(&plugin);
+    if (it == plugin_handler_lists_.end()) {
+        return;
+    }
+    for (auto *handler_list : it->second) {
+        const auto count = handler_list->getHandlerCount();
+        handler_list->unregister(plugin);
+        MemoryUsage::getInstance().remove(MemorySubsystem::EventHandlers,
+                                          (count - handler_list->getHandlerCount()) * HandlerBytes);
     }
+    plugin_handler_lists_.erase(it);
+}
+
+namespace {
+std::size_t internEventType(const std::string &name)
+{
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::size_t> types;
+    std::lock_guard lock(mutex);
+    return types.emplace(name, types.size()).first->second;
+}
+
+template <typename Name>
+std::size_t resolveEventType(std::atomic<std::size_t> &slot, Name &&name)
+{
+    auto type = slot.load(std::memory_order_relaxed);
+    if (type == Event::UnresolvedType) {
+        type = internEventType(name());
+        slot.store(type, std::memory_order_relaxed);
+    }
+    return type;
+}
+}  // namespace
+
+std::size_t EndstonePluginManager::getEventType(const Event &event)
+{
+    auto &slot = event.getEventTypeSlot();
+    auto type = slot.load(std::memory_order_relaxed);
+    if (type != Event::UnresolvedType) {
+        return type;
+    }
+
+    // Events without ENDSTONE_EVENT have a slot per instance, so their ids are also cached per dynamic type to take
+    // the intern mutex only once per type instead of on every dispatch
+    thread_local std::unordered_map<std::type_index, std::size_t> types;
+    auto it = types.find(typeid(event));
+    if (it == types.end()) {
+        it = types.emplace(typeid(event), internEventType(event.getEventName())).first;
+    }
+    slot.store(it->second, std::memory_order_relaxed);
+    return it->second;
+}
+
+bool EndstonePluginManager::hasListeners(const std::string &event, std::atomic<std::size_t> &type_slot) const
+{
+    auto *handler_list = getHandlerList(resolveEventType(type_slot, [&]() { return event; }));
+    return handler_list && handler_list->getHandlerCount() > 0;
+}
+
+void EndstonePluginManager::setTimingsEnabled(bool enabled)
+{
+    timings_.setEnabled(enabled);
+}
+
+bool EndstonePluginManager::isTimingsEnabled() const
+{
+    return timings_.isEnabled();
+}
+
+std::vector<EventTiming> EndstonePluginManager::getEventTimings() const
+{
+    return timings_.getTimings();
+}
+
+void EndstonePluginManager::resetTimings()
+{
+    timings_.reset();
+}
+
+HandlerList *EndstonePluginManager::getHandlerList(std::size_t type) const
+{
+    if (type >= MaxEventTypes) {
+        return nullptr;
+    }
+    return event_handlers_[type].load(std::memory_order_acquire);
+}
+
+HandlerList *EndstonePluginManager::getOrCreateHandlerList(const std::string &event)
+{
+    auto type = internEventType(event);
+    if (type >= MaxEventTypes) {
+        server_.getLogger().error("Too many event types registered, cannot register {}.", event);
+        return nullptr;
+    }
+
+    if (auto *handler_list = getHandlerList(type)) {
+        return handler_list;
+    }
+    auto &handler_list = handler_lists_.emplace_back(std::make_unique<HandlerList>(event));
+    event_handlers_[type].store(handler_list.get(), std::memory_order_release);
+    return handler_list.get();
 }
 
 Permission *EndstonePluginManager::getPermission(std::string name) const
@@ -242,6 +525,11 @@ Permission *EndstonePluginManager::addPermission(std::unique_ptr<Permission> per
 
     perm->init(*this);
     auto it = permissions_.emplace(name, std::move(perm)).first;
+    auto id = internPermission(name);
+    permissions_by_id_[id] = it->second.get();
+    registered_ids_.emplace(it->second.get(), id);
+    // The new permission may be a child that other expansions stopped at while it was not registered
+    child_permissions_.clear();
     calculatePermissionDefault(*it->second);
     return it->second.get();
 }
@@ -254,7 +542,98 @@ void EndstonePluginManager::removePermission(Permission &perm)
 void EndstonePluginManager::removePermission(std::string name)
 {
     std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
-    permissions_.erase(name);
+    if (auto id = findPermissionId(name); id != InvalidPermissionId) {
+        registered_ids_.erase(permissions_by_id_[id]);
+        permissions_by_id_[id] = nullptr;
+    }
+    if (auto it = permissions_.find(name); it != permissions_.end()) {
+        for (const bool op : {true, false}) {
+            if (default_perms_[op].erase(it->second.get()) > 0) {
+                dirtyPermissibles(op);
+            }
+        }
+        permissions_.erase(it);
+    }
+    child_permissions_.clear();
+}
+
+std::size_t EndstonePluginManager::internPermission(const std::string &name)
+{
+    auto [it, inserted] = permission_ids_.emplace(name, permissions_by_id_.size());
+    if (inserted) {
+        permissions_by_id_.push_back(nullptr);
+        permission_names_.push_back(&it->first);
+        perm_subs_.emplace_back();
+    }
+    return it->second;
+}
+
+std::size_t EndstonePluginManager::findPermissionId(const std::string &name) const
+{
+    if (auto it = permission_ids_.find(name); it != permission_ids_.end()) {
+        return it->second;
+    }
+    if (std::none_of(name.begin(), name.end(), [](unsigned char c) { return std::isupper(c); })) {
+        return InvalidPermissionId;
+    }
+
+    auto lower = name;
+    std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return std::tolower(c); });
+    return findPermissionId(lower);
+}
+
+std::size_t EndstonePluginManager::findPermissionId(const Permission &perm) const
+{
+    auto it = registered_ids_.find(&perm);
+    if (it == registered_ids_.end()) {
+        return InvalidPermissionId;
+    }
+    return it->second;
+}
+
+Permission *EndstonePluginManager::getPermissionById(std::size_t id) const
+{
+    if (id >= permissions_by_id_.size()) {
+        return nullptr;
+    }
+    return permissions_by_id_[id];
+}
+
+const std::string &EndstonePluginManager::getPermissionName(std::size_t id) const
+{
+    return *permission_names_.at(id);
+}
+
+// NOLINTNEXTLINE(*-no-recursion)
+const std::vector<std::pair<std::size_t, bool>> &EndstonePluginManager::getChildPermissions(std::size_t id)
+{
+    static const std::vector<std::pair<std::size_t, bool>> no_children;
+    auto *perm = getPermissionById(id);
+    if (perm == nullptr) {
+        return no_children;
+    }
+
+    if (auto it = child_permissions_.find(id); it != child_permissions_.end()) {
+        return it->second;
+    }
+
+    // Inserted before expanding, so a cycle in the permission graph ends the expansion instead of recursing forever
+    auto &result = child_permissions_[id];
+    for (const auto &[child, value] : perm->getChildren()) {
+        auto name = child;
+        std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
+        auto child_id = internPermission(name);
+        result.emplace_back(child_id, value);
+
+        const auto &grandchildren = getChildPermissions(child_id);
+        if (&grandchildren == &result) {
+            continue;
+        }
+        for (const auto &[grandchild_id, grandchild_value] : grandchildren) {
+            result.emplace_back(grandchild_id, grandchild_value ^ !value);
+        }
+    }
+    return result;
 }
 
 std::unordered_set<Permission *> EndstonePluginManager::getDefaultPermissions(bool op) const
@@ -264,6 +643,8 @@ std::unordered_set<Permission *> EndstonePluginManager::getDefaultPermissions(bo
 
 void EndstonePluginManager::recalculatePermissionDefaults(Permission &perm)
 {
+    // Called whenever the children or the default of a permission change
+    child_permissions_.clear();
     if (getPermission(perm.getName()) != nullptr) {
         default_perms_.at(true).erase(&perm);
         default_perms_.at(false).erase(&perm);
@@ -286,49 +667,74 @@ void EndstonePluginManager::calculatePermissionDefault(Permission &perm)
 
 void EndstonePluginManager::dirtyPermissibles(bool op) const
 {
-    auto permissibles = getDefaultPermSubscriptions(op);
-    for (auto *p : permissibles) {
-        p->recalculatePermissions();
+    // Only mark them, they are recalculated on their next permission check or at the start of the next tick
+    if (auto it = def_subs_.find(op); it != def_subs_.end()) {
+        for (const auto &[permissible, value] : it->second) {
+            dirty_permissibles_.insert(permissible);
+        }
+    }
+}
+
+bool EndstonePluginManager::hasDirtyPermissibles() const
+{
+    return !dirty_permissibles_.empty();
+}
+
+void EndstonePluginManager::recalculateDirtyPermissibles()
+{
+    // Recalculating unsubscribes from the default permissions, which removes a permissible from the dirty set
+    while (!dirty_permissibles_.empty()) {
+        auto *permissible = *dirty_permissibles_.begin();
+        dirty_permissibles_.erase(dirty_permissibles_.begin());
+        permissible->recalculatePermissions();
     }
 }
 
 void EndstonePluginManager::subscribeToPermission(std::string permission, Permissible &permissible)
 {
-    auto &name = permission;
-    std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
-    auto &map = perm_subs_.emplace(name, std::unordered_map<Permissible *, bool>()).first->second;
-    map[&permissible] = true;
+    std::transform(permission.begin(), permission.end(), permission.begin(),
+                   [](unsigned char c) { return std::tolower(c); });
+    subscribeToPermission(internPermission(permission), permissible);
+}
+
+void EndstonePluginManager::subscribeToPermission(std::size_t id, Permissible &permissible)
+{
+    auto &subs = perm_subs_.at(id);
+    auto it = std::lower_bound(subs.begin(), subs.end(), &permissible);
+    if (it == subs.end() || *it != &permissible) {
+        subs.insert(it, &permissible);
+    }
 }
 
 void EndstonePluginManager::unsubscribeFromPermission(std::string permission, Permissible &permissible)
 {
-    auto &name = permission;
-    std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
-    auto it = perm_subs_.find(name);
-    if (it != perm_subs_.end()) {
-        auto &map = it->second;
-        map.erase(&permissible);
-        if (map.empty()) {
-            perm_subs_.erase(name);
-        }
+    if (auto id = findPermissionId(permission); id != InvalidPermissionId) {
+        unsubscribeFromPermission(id, permissible);
+    }
+}
+
+void EndstonePluginManager::unsubscribeFromPermission(std::size_t id, Permissible &permissible)
+{
+    auto &subs = perm_subs_.at(id);
+    auto it = std::lower_bound(subs.begin(), subs.end(), &permissible);
+    if (it != subs.end() && *it == &permissible) {
+        subs.erase(it);
     }
 }
 
 std::unordered_set<Permissible *> EndstonePluginManager::getPermissionSubscriptions(std::string permission) const
 {
-    auto &name = permission;
-    std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
+    const auto &subs = getPermissionSubscribers(findPermissionId(permission));
+    return {subs.begin(), subs.end()};
+}
 
-    auto it = perm_subs_.find(name);
-    if (it != perm_subs_.end()) {
-        std::unordered_set<Permissible *> subs;
-        const auto &map = it->second;
-        for (const auto &entry : map) {
-            subs.insert(entry.first);
-        }
-        return subs;
+const std::vector<Permissible *> &EndstonePluginManager::getPermissionSubscribers(std::size_t id) const
+{
+    static const std::vector<Permissible *> no_subscribers;
+    if (id >= perm_subs_.size()) {
+        return no_subscribers;
     }
-    return {};
+    return perm_subs_[id];
 }
 
 void EndstonePluginManager::subscribeToDefaultPerms(bool op, Permissible &permissible)
@@ -339,6 +745,7 @@ void EndstonePluginManager::subscribeToDefaultPerms(bool op, Permissible &permis
 
 void EndstonePluginManager::unsubscribeFromDefaultPerms(bool op, Permissible &permissible)
 {
+    dirty_permissibles_.erase(&permissible);
     auto it = def_subs_.find(op);
     if (it != def_subs_.end()) {
         auto &map = it->second;
@@ -372,6 +779,20 @@ std::string toCamelCase(const std::string &input)
 }
 }  // namespace
 
+void EndstonePluginManager::callOnLoad(Plugin &plugin)
+{
+    plugin.getLogger().info("Loading {}", plugin.getDescription().getFullName());
+    const auto start = StartupTimings::Clock::now();
+    try {
+        plugin.onLoad();
+    }
+    catch (std::exception &e) {
+        plugin.getLogger().error("Error occurred when loading {}", plugin.getDescription().getFullName());
+        plugin.getLogger().error(e.what());
+    }
+    StartupTimings::getInstance().recordLoad(plugin.getDescription().getName(), StartupTimings::Clock::now() - start);
+}
+
 void EndstonePluginManager::initPlugin(Plugin &plugin, PluginLoader &loader, const std::filesystem::path &base_folder)
 {
     plugin.loader_ = &loader;
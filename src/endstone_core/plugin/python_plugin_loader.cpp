@@ -14,15 +14,44 @@
 
 #include "endstone/detail/plugin/python_plugin_loader.h"
 
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string_view>
+
 #include <pybind11/embed.h>
+#include <pybind11/stl.h>
 namespace py = pybind11;
+namespace fs = std::filesystem;
 
 #include "endstone/detail/logger_factory.h"
+#include "endstone/detail/startup_timings.h"
 
 namespace endstone::detail {
 
+namespace {
+bool hasEntryPoints(const fs::path &site_dir)
+{
+    std::error_code ec;
+    for (fs::directory_iterator it{site_dir, ec}, end; !ec && it != end; it.increment(ec)) {
+        const auto extension = it->path().extension();
+        if (extension != ".dist-info" && extension != ".egg-info") {
+            continue;
+        }
+        std::ifstream file(it->path() / "entry_points.txt");
+        for (std::string line; std::getline(file, line);) {
+            if (line.rfind("[endstone]", 0) == 0) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+}  // namespace
+
 PythonPluginLoader::PythonPluginLoader(Server &server) : PluginLoader(server)
 {
+    initializeInterpreter(server);
     try {
         py::gil_scoped_acquire gil{};
         auto module = py::module_::import("endstone._internal.plugin_loader");
@@ -57,6 +86,124 @@ void PythonPluginLoader::disablePlugin(Plugin &plugin) const
     pimpl()->disablePlugin(plugin);
 }
 
+Plugin *PythonPluginLoader::reloadPlugin(Plugin &plugin)
+{
+    return pimpl()->reloadPlugin(plugin);
+}
+
+void PythonPluginLoader::setMemoryTracing(bool enabled) const
+{
+    py::gil_scoped_acquire gil{};
+    obj_.attr(enabled ? "start_memory_tracing" : "stop_memory_tracing")();
+}
+
+bool PythonPluginLoader::isMemoryTracing() const
+{
+    py::gil_scoped_acquire gil{};
+    return obj_.attr("is_memory_tracing")().cast<bool>();
+}
+
+std::vector<std::pair<std::string, std::size_t>> PythonPluginLoader::getMemoryUsage() const
+{
+    py::gil_scoped_acquire gil{};
+    return obj_.attr("get_memory_usage")().cast<std::vector<std::pair<std::string, std::size_t>>>();
+}
+
+std::pair<std::size_t, std::optional<std::size_t>> PythonPluginLoader::getHeapUsage() const
+{
+    py::gil_scoped_acquire gil{};
+    auto blocks = py::module_::import("sys").attr("getallocatedblocks")().cast<std::size_t>();
+    auto tracemalloc = py::module_::import("tracemalloc");
+    if (!tracemalloc.attr("is_tracing")().cast<bool>()) {
+        return {blocks, std::nullopt};
+    }
+    auto traced = tracemalloc.attr("get_traced_memory")().cast<std::pair<std::size_t, std::size_t>>();
+    return {blocks, traced.first};
+}
+
+bool PythonPluginLoader::hasPlugins(const std::string &directory)
+{
+    if (const auto *mode = std::getenv("ENDSTONE_PYTHON")) {
+        if (std::string_view(mode) == "on") {
+            return true;
+        }
+        if (std::string_view(mode) == "off") {
+            return false;
+        }
+    }
+
+    std::error_code ec;
+    for (fs::directory_iterator it{directory, ec}, end; !ec && it != end; it.increment(ec)) {
+        if (it->path().extension() == ".whl") {
+            return true;
+        }
+    }
+
+    const auto *python_path = std::getenv("PYTHONPATH");
+    if (python_path == nullptr || *python_path == '\0') {
+        return true;
+    }
+#ifdef _WIN32
+    constexpr char separator = ';';
+#else
+    constexpr char separator = ':';
+#endif
+    // The launcher passes its sys.path, which holds the site-packages the plugins are installed to
+    std::string_view paths{python_path};
+    while (!paths.empty()) {
+        const auto pos = paths.find(separator);
+        const auto path = paths.substr(0, pos);
+        paths = pos == std::string_view::npos ? std::string_view{} : paths.substr(pos + 1);
+        if (!path.empty() && hasEntryPoints(fs::path{std::string(path)})) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool PythonPluginLoader::isInterpreterInitialized()
+{
+    return Py_IsInitialized() != 0;
+}
+
+void PythonPluginLoader::initializeInterpreter(Server &server)
+{
+    if (isInterpreterInitialized()) {
+        return;
+    }
+
+    {
+        StartupTimer timer{"Python interpreter"};
+        // Initialise an isolated Python environment to avoid installing signal handlers
+        // https://docs.python.org/3/c-api/init_config.html#init-isolated-conf
+        PyConfig config;
+        PyConfig_InitIsolatedConfig(&config);
+        config.isolated = 0;
+        config.use_environment = 1;
+        config.install_signal_handlers = 0;
+        py::initialize_interpreter(&config);
+        py::module_::import("threading");  // https://github.com/pybind/pybind11/issues/2197
+    }
+    // NumPy has to be imported on the thread that started the interpreter before any plugin uses it, servers without
+    // such plugins may skip it. https://github.com/numpy/numpy/issues/24833
+    if (const auto *preload = std::getenv("ENDSTONE_PRELOAD_NUMPY"); !preload || std::string_view(preload) != "0") {
+        StartupTimer timer{"NumPy import"};
+        py::module_::import("numpy");
+    }
+#ifdef Py_GIL_DISABLED
+    // An extension module that does not declare itself free-threading safe turns the GIL back on when imported
+    if (py::module_::import("sys").attr("_is_gil_enabled")().cast<bool>()) {
+        server.getLogger().warning(
+            "Python is free-threaded but the GIL has been re-enabled, Python plugins run serially.");
+    }
+    else {
+        server.getLogger().info("Python is free-threaded, Python plugins and async tasks run in parallel.");
+    }
+#endif
+    py::gil_scoped_release release{};
+    release.disarm();
+}
+
 PluginLoader *PythonPluginLoader::pimpl() const
 {
     return obj_.cast<PluginLoader *>();
@@ -0,0 +1,400 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/rcon/rcon_server.h"
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <iterator>
+#include <mutex>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include <boost/asio.hpp>
+#include <fmt/format.h>
+
+namespace endstone::detail {
+
+namespace asio = boost::asio;
+using asio::ip::tcp;
+
+namespace {
+// Packet types of the protocol, the auth response shares its value with the command request
+constexpr std::int32_t ResponseValue = 0;
+constexpr std::int32_t ExecCommand = 2;
+constexpr std::int32_t AuthResponse = 2;
+constexpr std::int32_t Auth = 3;
+
+// The id and type, then the body and the padding, each terminated by a null byte
+constexpr std::int32_t MinPacketSize = 10;
+constexpr std::int32_t MaxPacketSize = 4096 + MinPacketSize;
+// Longer outputs are split over several response packets
+constexpr std::size_t MaxResponseBodySize = 4096;
+
+std::int32_t readInt32(const char *data)
+{
+    std::uint32_t value = 0;
+    for (int i = 3; i >= 0; --i) {
+        value = (value << 8) | static_cast<unsigned char>(data[i]);
+    }
+    return static_cast<std::int32_t>(value);
+}
+
+void writeInt32(std::string &out, std::int32_t value)
+{
+    const auto bits = static_cast<std::uint32_t>(value);
+    for (int i = 0; i < 4; ++i) {
+        out.push_back(static_cast<char>((bits >> (8 * i)) & 0xFF));
+    }
+}
+
+void writePacket(std::string &out, std::int32_t id, std::int32_t type, std::string_view body)
+{
+    writeInt32(out, static_cast<std::int32_t>(body.size()) + MinPacketSize);
+    writeInt32(out, id);
+    writeInt32(out, type);
+    out.append(body.data(), body.size());
+    out.push_back('\0');
+    out.push_back('\0');
+}
+
+// Compares every byte, so the time taken does not tell how much of the input was right
+bool equalsConstantTime(std::string_view input, std::string_view expected)
+{
+    unsigned char difference = input.size() == expected.size() ? 0 : 1;
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        difference |= static_cast<unsigned char>(input[i] ^ expected[i % expected.size()]);
+    }
+    return difference == 0;
+}
+}  // namespace
+
+struct RconServer::Impl {
+    class Connection;
+
+    struct LoginFailures {
+        std::uint32_t count = 0;
+        std::chrono::steady_clock::time_point locked_until;
+    };
+
+    Impl(std::string password, const std::string &host, std::uint16_t port)
+        : password(std::move(password)), acceptor(io_context)
+    {
+        if (this->password.empty()) {
+            throw std::runtime_error("RCON requires a password");
+        }
+        boost::system::error_code ec;
+        const auto address = asio::ip::make_address(host, ec);
+        if (!ec) {
+            const tcp::endpoint endpoint{address, port};
+            acceptor.open(endpoint.protocol(), ec);
+            if (!ec) {
+                acceptor.set_option(tcp::acceptor::reuse_address(true), ec);
+                acceptor.bind(endpoint, ec);
+            }
+            if (!ec) {
+                acceptor.listen(asio::socket_base::max_listen_connections, ec);
+            }
+        }
+        if (ec) {
+            throw std::runtime_error(fmt::format("Unable to listen on {}:{}: {}", host, port, ec.message()));
+        }
+        accept();
+        thread = std::thread([this]() { io_context.run(); });
+    }
+
+    ~Impl()
+    {
+        io_context.stop();
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+
+    void accept();
+
+    void push(RconCommand command)
+    {
+        std::lock_guard lock(mutex);
+        commands.push_back(std::move(command));
+    }
+
+    [[nodiscard]] bool isLockedOut(const std::string &address) const
+    {
+        auto it = login_failures.find(address);
+        return it != login_failures.end() && std::chrono::steady_clock::now() < it->second.locked_until;
+    }
+
+    void recordLogin(const std::string &address, bool success)
+    {
+        if (success) {
+            login_failures.erase(address);
+            return;
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        if (login_failures.size() >= MaxTrackedAddresses && login_failures.find(address) == login_failures.end()) {
+            // The addresses whose lockout ran out long ago are forgiven first, then the one that is free the soonest
+            for (auto it = login_failures.begin(); it != login_failures.end();) {
+                it = now >= it->second.locked_until + MaxLoginBackoff ? login_failures.erase(it) : std::next(it);
+            }
+            if (login_failures.size() >= MaxTrackedAddresses) {
+                login_failures.erase(std::min_element(
+                    login_failures.begin(), login_failures.end(),
+                    [](const auto &a, const auto &b) { return a.second.locked_until < b.second.locked_until; }));
+            }
+        }
+        auto &failures = login_failures[address];
+        const auto doublings = std::min<std::uint32_t>(failures.count++, 16);
+        failures.locked_until = now + std::min<std::chrono::seconds>(LoginBackoff * (1U << doublings), MaxLoginBackoff);
+    }
+
+    const std::string password;
+    std::size_t connections = 0;  // only used on the I/O thread, outlives the connections left in the context
+    std::unordered_map<std::string, LoginFailures> login_failures;  // by remote IP, only used on the I/O thread
+    asio::io_context io_context;
+    tcp::acceptor acceptor;
+    std::mutex mutex;
+    std::deque<RconCommand> commands;
+    std::thread thread;
+};
+
+class RconServer::Impl::Connection : public std::enable_shared_from_this<Connection> {
+public:
+    Connection(tcp::socket socket, Impl &server)
+        : socket_(std::move(socket)), timer_(socket_.get_executor()), server_(server),
+          last_refill_(std::chrono::steady_clock::now())
+    {
+        ++server_.connections;
+        boost::system::error_code ec;
+        auto endpoint = socket_.remote_endpoint(ec);
+        remote_ip_ = ec ? "unknown" : endpoint.address().to_string();
+        remote_address_ = ec ? "unknown" : fmt::format("{}:{}", remote_ip_, endpoint.port());
+    }
+
+    ~Connection()
+    {
+        --server_.connections;
+    }
+
+    void start()
+    {
+        timer_.expires_after(AuthTimeout);
+        timer_.async_wait([self = shared_from_this()](const boost::system::error_code &ec) {
+            if (!ec && !self->authenticated_) {
+                self->close();
+            }
+        });
+        readHeader();
+    }
+
+private:
+    void readHeader()
+    {
+        asio::async_read(socket_, asio::buffer(header_),
+                         [self = shared_from_this()](const boost::system::error_code &ec, std::size_t) {
+                             if (ec) {
+                                 self->close();
+                                 return;
+                             }
+                             const auto size = readInt32(self->header_.data());
+                             if (size < MinPacketSize || size > MaxPacketSize) {
+                                 self->close();
+                                 return;
+                             }
+                             self->body_.resize(static_cast<std::size_t>(size));
+                             self->readBody();
+                         });
+    }
+
+    void readBody()
+    {
+        asio::async_read(socket_, asio::buffer(body_),
+                         [self = shared_from_this()](const boost::system::error_code &ec, std::size_t) {
+                             if (ec) {
+                                 self->close();
+                                 return;
+                             }
+                             if (self->handle()) {
+                                 self->readHeader();
+                             }
+                         });
+    }
+
+    // Returns whether the connection should keep reading
+    bool handle()
+    {
+        const auto id = readInt32(body_.data());
+        const auto type = readInt32(body_.data() + 4);
+        std::string_view payload{body_.data() + 8, body_.size() - 8};
+        payload = payload.substr(0, payload.find('\0'));
+
+        if (type == Auth) {
+            if (!server_.isLockedOut(remote_ip_)) {
+                authenticated_ = equalsConstantTime(payload, server_.password);
+                server_.recordLogin(remote_ip_, authenticated_);
+            }
+            send(authenticated_ ? id : -1, AuthResponse, "");
+            if (!authenticated_) {
+                closing_ = true;
+                return false;
+            }
+            timer_.cancel();
+            return true;
+        }
+        if (!authenticated_ || type != ExecCommand) {
+            close();
+            return false;
+        }
+        if (pending_ >= MaxPendingCommands || !tryAcquire()) {
+            send(id, ResponseValue, "Too many commands, try again later.");
+            return true;
+        }
+
+        ++pending_;
+        auto executor = socket_.get_executor();
+        std::weak_ptr<Connection> weak = shared_from_this();
+        server_.push({std::string(payload), remote_address_, [executor, weak, id](const std::string &output) {
+                          asio::post(executor, [weak, id, output]() {
+                              if (auto self = weak.lock()) {
+                                  --self->pending_;
+                                  self->respond(id, output);
+                              }
+                          });
+                      }});
+        return true;
+    }
+
+    bool tryAcquire()
+    {
+        const auto now = std::chrono::steady_clock::now();
+        const auto elapsed = std::chrono::duration<double>(now - last_refill_).count();
+        last_refill_ = now;
+        tokens_ = std::min(CommandBurst, tokens_ + elapsed * CommandsPerSecond);
+        if (tokens_ < 1.0) {
+            return false;
+        }
+        tokens_ -= 1.0;
+        return true;
+    }
+
+    void respond(std::int32_t id, std::string_view output)
+    {
+        do {
+            const auto body = output.substr(0, MaxResponseBodySize);
+            output.remove_prefix(body.size());
+            send(id, ResponseValue, body);
+        } while (!output.empty());
+    }
+
+    void send(std::int32_t id, std::int32_t type, std::string_view body)
+    {
+        std::string packet;
+        writePacket(packet, id, type, body);
+        const bool idle = queue_.empty();
+        queue_.push_back(std::move(packet));
+        if (idle) {
+            write();
+        }
+    }
+
+    void write()
+    {
+        asio::async_write(socket_, asio::buffer(queue_.front()),
+                          [self = shared_from_this()](const boost::system::error_code &ec, std::size_t) {
+                              if (ec) {
+                                  self->close();
+                                  return;
+                              }
+                              self->queue_.pop_front();
+                              if (!self->queue_.empty()) {
+                                  self->write();
+                              }
+                              else if (self->closing_) {
+                                  self->close();
+                              }
+                          });
+    }
+
+    void close()
+    {
+        timer_.cancel();
+        boost::system::error_code ignored;
+        socket_.shutdown(tcp::socket::shutdown_both, ignored);
+        socket_.close(ignored);
+    }
+
+    tcp::socket socket_;
+    asio::steady_timer timer_;
+    Impl &server_;
+    std::string remote_ip_;
+    std::string remote_address_;
+    std::array<char, 4> header_{};
+    std::string body_;
+    std::deque<std::string> queue_;
+    bool authenticated_ = false;
+    bool closing_ = false;
+    std::size_t pending_ = 0;
+    double tokens_ = CommandBurst;
+    std::chrono::steady_clock::time_point last_refill_;
+};
+
+void RconServer::Impl::accept()
+{
+    acceptor.async_accept([this](const boost::system::error_code &ec, tcp::socket socket) {
+        if (!ec) {
+            if (connections < MaxConnections) {
+                std::make_shared<Connection>(std::move(socket), *this)->start();
+            }
+            else {
+                boost::system::error_code ignored;
+                socket.close(ignored);
+            }
+        }
+        if (acceptor.is_open()) {
+            accept();
+        }
+    });
+}
+
+RconServer::RconServer(std::string password, const std::string &host, std::uint16_t port)
+    : impl_(std::make_unique<Impl>(std::move(password), host, port))
+{
+}
+
+RconServer::~RconServer() = default;
+
+std::vector<RconCommand> RconServer::takeCommands(std::size_t max_count)
+{
+    std::lock_guard lock(impl_->mutex);
+    const auto count = std::min(max_count, impl_->commands.size());
+    std::vector<RconCommand> result;
+    result.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        result.push_back(std::move(impl_->commands.front()));
+        impl_->commands.pop_front();
+    }
+    return result;
+}
+
+std::uint16_t RconServer::getPort() const
+{
+    return impl_->acceptor.local_endpoint().port();
+}
+
+}  // namespace endstone::detail
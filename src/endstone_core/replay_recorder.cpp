@@ -0,0 +1,194 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/replay_recorder.h"
+
+#include <utility>
+
+#include "endstone/network/binary_stream_reader.h"
+
+namespace endstone::detail {
+
+namespace {
+void writeVarInt(std::string &out, std::uint64_t value)
+{
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+void writeString(std::string &out, std::string_view value)
+{
+    writeVarInt(out, value.size());
+    out.append(value);
+}
+
+std::uint64_t toMicroseconds(std::chrono::nanoseconds duration)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+}
+}  // namespace
+
+ReplayRecorder::ReplayRecorder(const std::string &path)
+    : file_(path, std::ios::binary | std::ios::trunc), start_(std::chrono::steady_clock::now())
+{
+    file_.write(Magic.data(), static_cast<std::streamsize>(Magic.size()));
+    file_.put(static_cast<char>(Version));
+    writer_ = std::thread(&ReplayRecorder::run, this);
+}
+
+ReplayRecorder::~ReplayRecorder()
+{
+    {
+        std::lock_guard lock{mutex_};
+        stopping_ = true;
+    }
+    cv_.notify_one();
+    writer_.join();
+}
+
+bool ReplayRecorder::isOpen() const
+{
+    return file_.is_open() && file_.good();
+}
+
+void ReplayRecorder::recordTick(std::uint64_t tick, const TickHistory::Sample &timings)
+{
+    std::string record;
+    record.push_back(static_cast<char>(ReplayRecord::Type::Tick));
+    writeVarInt(record, toMicroseconds(std::chrono::steady_clock::now() - start_));
+    writeVarInt(record, tick);
+    writeVarInt(record, toMicroseconds(timings.scheduler));
+    writeVarInt(record, toMicroseconds(timings.level));
+    writeVarInt(record, toMicroseconds(timings.post_tick));
+    append(record);
+}
+
+void ReplayRecorder::recordPacket(int packet_id, int sub_client_id, std::string_view body)
+{
+    std::string record;
+    record.reserve(body.size() + 16);
+    record.push_back(static_cast<char>(ReplayRecord::Type::Packet));
+    writeVarInt(record, toMicroseconds(std::chrono::steady_clock::now() - start_));
+    writeVarInt(record, static_cast<std::uint64_t>(packet_id));
+    writeVarInt(record, static_cast<std::uint64_t>(sub_client_id));
+    writeString(record, body);
+    append(record);
+}
+
+void ReplayRecorder::recordCommand(std::string_view sender, std::string_view command)
+{
+    std::string record;
+    record.push_back(static_cast<char>(ReplayRecord::Type::Command));
+    writeVarInt(record, toMicroseconds(std::chrono::steady_clock::now() - start_));
+    writeString(record, sender);
+    writeString(record, command);
+    append(record);
+}
+
+void ReplayRecorder::flush()
+{
+    std::unique_lock lock{mutex_};
+    flush_to_ = appended_;
+    cv_.notify_one();
+    flushed_.wait(lock, [&]() { return written_ >= flush_to_ || stopping_; });
+}
+
+std::uint64_t ReplayRecorder::getDroppedCount() const
+{
+    return dropped_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t ReplayRecorder::getWrittenBytes() const
+{
+    std::lock_guard lock{mutex_};
+    return written_;
+}
+
+void ReplayRecorder::append(const std::string &record)
+{
+    std::lock_guard lock{mutex_};
+    if (pending_.size() + record.size() > MaxPendingBytes) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    pending_.append(record);
+    appended_ += record.size();
+}
+
+void ReplayRecorder::run()
+{
+    std::string batch;
+    std::unique_lock lock{mutex_};
+    while (true) {
+        cv_.wait_for(lock, FlushInterval, [&]() { return stopping_ || written_ < flush_to_; });
+        const bool stopping = stopping_;
+        // Written outside of the lock, so recording never waits for the disk
+        batch.swap(pending_);
+        const auto end = appended_;
+        lock.unlock();
+        file_.write(batch.data(), static_cast<std::streamsize>(batch.size()));
+        file_.flush();
+        batch.clear();
+        lock.lock();
+        written_ = end;
+        flushed_.notify_all();
+        if (stopping) {
+            return;
+        }
+    }
+}
+
+std::optional<std::vector<ReplayRecord>> ReplayReader::read(std::string_view data)
+{
+    if (data.size() < ReplayRecorder::Magic.size() + 1 ||
+        data.substr(0, ReplayRecorder::Magic.size()) != ReplayRecorder::Magic ||
+        static_cast<std::uint8_t>(data[ReplayRecorder::Magic.size()]) != ReplayRecorder::Version) {
+        return std::nullopt;
+    }
+
+    BinaryStreamReader reader{data.substr(ReplayRecorder::Magic.size() + 1)};
+    std::vector<ReplayRecord> records;
+    while (reader.getRemaining() > 0) {
+        ReplayRecord record{static_cast<ReplayRecord::Type>(reader.readByte()), reader.readUnsignedVarInt64()};
+        switch (record.type) {
+        case ReplayRecord::Type::Tick:
+            record.tick = reader.readUnsignedVarInt64();
+            record.timings.scheduler = std::chrono::microseconds(reader.readUnsignedVarInt64());
+            record.timings.level = std::chrono::microseconds(reader.readUnsignedVarInt64());
+            record.timings.post_tick = std::chrono::microseconds(reader.readUnsignedVarInt64());
+            break;
+        case ReplayRecord::Type::Packet:
+            record.packet_id = static_cast<int>(reader.readUnsignedVarInt());
+            record.sub_client_id = static_cast<int>(reader.readUnsignedVarInt());
+            record.data = reader.readString();
+            break;
+        case ReplayRecord::Type::Command:
+            record.sender = reader.readString();
+            record.data = reader.readString();
+            break;
+        default:
+            return records;  // Unknown records cannot be skipped, their size is not known
+        }
+        if (reader.hasOverflowed()) {
+            break;
+        }
+        records.push_back(std::move(record));
+    }
+    return records;
+}
+
+}  // namespace endstone::detail
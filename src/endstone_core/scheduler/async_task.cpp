@@ -25,13 +25,13 @@ bool EndstoneAsyncTask::isSync() const
 
 void EndstoneAsyncTask::run()
 {
-    if (isCancelled()) {
-        return;
-    }
-
     auto thread_id = std::this_thread::get_id();
     {
+        // Checked under the lock, so that a worker is either counted or sees the task cancelled
         std::lock_guard lock{mutex_};
+        if (isCancelled()) {
+            return;
+        }
         workers_.push_back({thread_id, getTaskId(), getOwner()});
     }
 
@@ -89,4 +89,14 @@ std::vector<EndstoneAsyncTask::Worker> EndstoneAsyncTask::getWorkers() const
     return workers_;
 }
 
+AsyncExecutor EndstoneAsyncTask::getExecutor() const
+{
+    return executor_;
+}
+
+void EndstoneAsyncTask::setExecutor(AsyncExecutor executor)
+{
+    executor_ = executor;
+}
+
 }  // namespace endstone::detail
@@ -0,0 +1,38 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/scheduler/dimension_task.h"
+
+#include <utility>
+
+namespace endstone::detail {
+
+EndstoneDimensionTask::EndstoneDimensionTask(EndstoneScheduler &scheduler, Plugin &plugin,
+                                             std::function<void(Dimension &)> task, TaskId id, std::uint64_t period)
+    : EndstoneTask(scheduler, plugin, [] {}, id, period), dimension_task_(std::move(task))
+{
+}
+
+void EndstoneDimensionTask::runFor(Dimension &dimension)
+{
+    dimension_task_(dimension);
+}
+
+void EndstoneDimensionTask::release()
+{
+    EndstoneTask::release();
+    dimension_task_ = nullptr;
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,42 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/scheduler/precise_task.h"
+
+#include <utility>
+
+namespace endstone::detail {
+
+EndstonePreciseTask::EndstonePreciseTask(EndstoneScheduler &scheduler, Plugin &plugin, std::function<void()> task,
+                                         TaskId id, std::chrono::microseconds interval)
+    : EndstoneTask(scheduler, plugin, std::move(task), id, 0), interval_(interval)
+{
+}
+
+std::chrono::microseconds EndstonePreciseTask::getInterval() const
+{
+    return interval_;
+}
+
+EndstoneTask::TaskClock::time_point EndstonePreciseTask::getDeadline() const
+{
+    return deadline_;
+}
+
+void EndstonePreciseTask::setDeadline(TaskClock::time_point deadline)
+{
+    deadline_ = deadline;
+}
+
+}  // namespace endstone::detail
@@ -14,11 +14,52 @@
 
 #include "endstone/detail/scheduler/scheduler.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <future>
+#include <thread>
+#include <utility>
+
 #include "endstone/detail/scheduler/async_task.h"
+#include "endstone/level/level.h"
 
 namespace endstone::detail {
 
-EndstoneScheduler::EndstoneScheduler(Server &server) : server_(server) {}
+namespace {
+bool runsLater(const std::shared_ptr<EndstonePreciseTask> &a, const std::shared_ptr<EndstonePreciseTask> &b)
+{
+    return a->getDeadline() > b->getDeadline();
+}
+
+// Records an async run when it goes out of scope, so that a task that throws still leaves the pending count
+class AsyncRunTimer {
+public:
+    AsyncRunTimer(TaskTimings &timings, const Plugin *plugin) : timings_(timings), plugin_(plugin) {}
+    AsyncRunTimer(const AsyncRunTimer &) = delete;
+    AsyncRunTimer &operator=(const AsyncRunTimer &) = delete;
+
+    ~AsyncRunTimer()
+    {
+        timings_.recordAsync(plugin_, std::chrono::steady_clock::now() - start_);
+    }
+
+private:
+    TaskTimings &timings_;
+    const Plugin *plugin_;
+    std::chrono::steady_clock::time_point start_{std::chrono::steady_clock::now()};
+};
+}  // namespace
+
+EndstoneScheduler::EndstoneScheduler(Server &server, ExecutorOptions cpu_options, ExecutorOptions io_options)
+    : server_(server), cpu_executor_(cpu_options.thread_count, std::move(cpu_options.thread)),
+      io_executor_(io_options.thread_count, std::move(io_options.thread)),
+      python_executor_(getDefaultExecutorOptions(AsyncExecutor::Python).thread_count,
+                       getDefaultExecutorOptions(AsyncExecutor::Python).thread),
+      dimension_executor_(DimensionWorkerCount, getDefaultExecutorOptions(AsyncExecutor::Cpu).thread)
+{
+}
 
 std::shared_ptr<Task> EndstoneScheduler::runTask(Plugin &plugin, std::function<void()> task)
 {
@@ -49,6 +90,28 @@ std::shared_ptr<Task> EndstoneScheduler::runTaskTimer(Plugin &plugin, std::funct
     return t;
 }
 
+std::shared_ptr<Task> EndstoneScheduler::runTaskTimerPrecise(Plugin &plugin, std::function<void()> task,
+                                                             std::chrono::microseconds delay,
+                                                             std::chrono::microseconds period)
+{
+    if (!task) {
+        server_.getLogger().error("Plugin {} attempted to register an empty task", plugin.getName());
+        return nullptr;
+    }
+
+    if (!plugin.isEnabled()) {
+        server_.getLogger().error("Plugin {} attempted to register task while disabled", plugin.getName());
+        return nullptr;
+    }
+
+    auto t = std::make_shared<EndstonePreciseTask>(*this, plugin, std::move(task), nextId(),
+                                                   std::max(period, std::chrono::microseconds::zero()));
+    t->setDeadline(EndstoneTask::TaskClock::now() + std::max(delay, std::chrono::microseconds::zero()));
+    t->setNextRun(current_tick_);
+    addTask(t);
+    return t;
+}
+
 std::shared_ptr<Task> EndstoneScheduler::runTaskAsync(Plugin &plugin, std::function<void()> task)
 {
     return runTaskLaterAsync(plugin, task, 0);
@@ -62,6 +125,25 @@ std::shared_ptr<Task> EndstoneScheduler::runTaskLaterAsync(Plugin &plugin, std::
 
 std::shared_ptr<Task> EndstoneScheduler::runTaskTimerAsync(Plugin &plugin, std::function<void()> task,
                                                            std::uint64_t delay, std::uint64_t period)
+{
+    return runTaskTimerAsync(plugin, task, delay, period, AsyncExecutor::Cpu);
+}
+
+std::shared_ptr<Task> EndstoneScheduler::runTaskAsync(Plugin &plugin, std::function<void()> task,
+                                                      AsyncExecutor executor)
+{
+    return runTaskLaterAsync(plugin, task, 0, executor);
+}
+
+std::shared_ptr<Task> EndstoneScheduler::runTaskLaterAsync(Plugin &plugin, std::function<void()> task,
+                                                           std::uint64_t delay, AsyncExecutor executor)
+{
+    return runTaskTimerAsync(plugin, task, delay, 0, executor);
+}
+
+std::shared_ptr<Task> EndstoneScheduler::runTaskTimerAsync(Plugin &plugin, std::function<void()> task,
+                                                           std::uint64_t delay, std::uint64_t period,
+                                                           AsyncExecutor executor)
 {
     if (!task) {
         server_.getLogger().error("Plugin {} attempted to register an empty task", plugin.getName());
@@ -74,53 +156,99 @@ std::shared_ptr<Task> EndstoneScheduler::runTaskTimerAsync(Plugin &plugin, std::
     }
 
     auto t = std::make_shared<EndstoneAsyncTask>(*this, plugin, task, nextId(), period);
+    t->setExecutor(executor);
+    t->setNextRun(current_tick_ + delay);
+    addTask(t);
+    return t;
+}
+
+std::shared_ptr<Task> EndstoneScheduler::runDimensionTaskTimer(Plugin &plugin, std::function<void(Dimension &)> task,
+                                                               std::uint64_t delay, std::uint64_t period)
+{
+    if (!task) {
+        server_.getLogger().error("Plugin {} attempted to register an empty task", plugin.getName());
+        return nullptr;
+    }
+
+    if (!plugin.isEnabled()) {
+        server_.getLogger().error("Plugin {} attempted to register task while disabled", plugin.getName());
+        return nullptr;
+    }
+
+    auto t = std::make_shared<EndstoneDimensionTask>(*this, plugin, std::move(task), nextId(), period);
     t->setNextRun(current_tick_ + delay);
     addTask(t);
     return t;
 }
 
+void EndstoneScheduler::runOnMainThread(Plugin &plugin, std::function<void()> callback)
+{
+    if (!callback) {
+        server_.getLogger().error("Plugin {} attempted to register an empty callback", plugin.getName());
+        return;
+    }
+    completions_.enqueue({&plugin, std::move(callback)});
+}
+
 void EndstoneScheduler::cancelTask(TaskId id)
 {
-    std::lock_guard lock{tasks_mtx_};
-    auto it = tasks_.find(id);
-    if (it == tasks_.end()) {
+    auto task = tasks_.find(id);
+    if (!task) {
         return;
     }
-    auto task = it->second;
     task->doCancel();
     if (task->isSync()) {
-        tasks_.erase(it);
+        tasks_.erase(id);
     }
 }
 
 void EndstoneScheduler::cancelTasks(Plugin &plugin)
 {
-    std::lock_guard lock{tasks_mtx_};
-    for (auto it = tasks_.begin(); it != tasks_.end();) {
-        if (it->second->getOwner() != &plugin) {
-            ++it;
+    for (const auto &task : tasks_.getTasks(plugin)) {
+        task->doCancel();
+        if (task->isSync()) {
+            tasks_.erase(task->getTaskId());
         }
-        else {
-            auto task = it->second;
-            task->doCancel();
-            if (task->isSync()) {
-                it = tasks_.erase(it);
-            }
-            else {
-                ++it;
-            }
+    }
+}
+
+bool EndstoneScheduler::releaseTasks(Plugin &plugin, std::chrono::steady_clock::time_point deadline)
+{
+    // The sync tasks are kept in the registry until the end, so that a later call still finds them
+    const auto tasks = tasks_.getTasks(plugin);
+    for (const auto &task : tasks) {
+        task->doCancel();
+    }
+
+    const auto running = [&]() {
+        return std::any_of(tasks.begin(), tasks.end(), [](const auto &task) {
+            return !task->isSync() && !std::static_pointer_cast<EndstoneAsyncTask>(task)->getWorkers().empty();
+        });
+    };
+    while (running()) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return false;
         }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
     }
+
+    // The wheel and the executor queues may still hold the tasks, so only their callables are destroyed here
+    for (const auto &task : tasks) {
+        if (task->getTaskId() != current_task_) {
+            task->release();
+        }
+        removeTask(task->getTaskId());
+    }
+    runCompletions();  // drops the callbacks of disabled plugins unrun
+    return true;
 }
 
 bool EndstoneScheduler::isRunning(TaskId id)
 {
-    std::lock_guard lock{tasks_mtx_};
-    auto it = tasks_.find(id);
-    if (it == tasks_.end()) {
+    auto task = tasks_.find(id);
+    if (!task) {
         return false;
     }
-    auto &task = it->second;
     if (task->isSync()) {
         return current_task_ == id;
     }
@@ -129,15 +257,13 @@ bool EndstoneScheduler::isRunning(TaskId id)
 
 bool EndstoneScheduler::isQueued(TaskId id)
 {
-    std::lock_guard lock{tasks_mtx_};
-    return tasks_.find(id) != tasks_.end();
+    return tasks_.contains(id);
 }
 
 std::vector<Task *> EndstoneScheduler::getPendingTasks()
 {
     std::vector<Task *> pending;
-    std::lock_guard lock{tasks_mtx_};
-    for (const auto &[id, task] : tasks_) {
+    for (const auto &task : tasks_.getTasks()) {
         if (task->isCancelled()) {
             continue;
         }
@@ -146,6 +272,11 @@ std::vector<Task *> EndstoneScheduler::getPendingTasks()
     return pending;
 }
 
+std::vector<TaskTiming> EndstoneScheduler::getTaskTimings() const
+{
+    return timings_.getTimings();
+}
+
 std::shared_ptr<Task> EndstoneScheduler::runTask(std::function<void()> task)
 {
     if (!task) {
@@ -159,102 +290,354 @@ std::shared_ptr<Task> EndstoneScheduler::runTask(std::function<void()> task)
 
 void EndstoneScheduler::addTask(std::shared_ptr<EndstoneTask> task)
 {
-    pending_.enqueue(task);
-    std::lock_guard lock{tasks_mtx_};
-    tasks_[task->getTaskId()] = task;
+    tasks_.insert(task);
+    pending_.enqueue(std::move(task));
 }
 
 void EndstoneScheduler::mainThreadHeartbeat(std::uint64_t current_tick)
 {
-    // Consume the tasks in the pending queue
-    std::shared_ptr<EndstoneTask> pending_task;
-    while (pending_.try_dequeue(pending_task)) {
-        if (pending_task->isCancelled()) {
+    // Tasks scheduled while this tick runs are delayed relative to it
+    current_tick_ = current_tick;
+
+    // The previous tick, including its post-tick phase, is over
+    if (timings_.isEnabled()) {
+        timings_.endTick();
+    }
+
+    consumePending(current_tick);
+    runCompletions();
+
+    // Precise tasks that came due since the end of the last tick
+    mainThreadRunPrecise();
+
+    const auto threshold = load_shedding_threshold_.load(std::memory_order_relaxed);
+    period_stretch_ = 1.0F;
+    if (threshold > 0.0F) {
+        const auto usage = std::min(1.0F, server_.getAverageTickUsage());
+        if (usage > threshold) {
+            period_stretch_ += (usage - threshold) / (1.0F - threshold) * (MaxPeriodStretch - 1.0F);
+        }
+    }
+
+    const auto budget = tick_budget_.load(std::memory_order_relaxed);
+    const auto deadline = std::chrono::steady_clock::now() + budget;
+    auto exhausted = [&]() {
+        return budget.count() > 0 && std::chrono::steady_clock::now() >= deadline;
+    };
+
+    // Tasks deferred from previous ticks go first, in the order they were deferred
+    while (!deferred_.empty() && !exhausted()) {
+        auto task = std::move(deferred_.front());
+        deferred_.pop_front();
+        runDueTask(task, current_tick);
+    }
+
+    wheel_.advance(current_tick, [&](const std::shared_ptr<EndstoneTask> &task) {
+        if (std::dynamic_pointer_cast<EndstoneDimensionTask>(task)) {
+            dimension_tasks_.push_back(std::static_pointer_cast<EndstoneDimensionTask>(task));
+            return;
+        }
+        if (task->isSync() && task->getPhase() == TaskPhase::PostTick) {
+            post_tick_.push_back(task);
+            return;
+        }
+        if (task->isSync() && task->getPriority() != TaskPriority::Critical && !task->isCancelled() &&
+            (!deferred_.empty() || exhausted())) {
+            deferred_.push_back(task);
+            deferred_count_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        runDueTask(task, current_tick);
+    });
+
+    runDimensionTasks(current_tick);
+}
+
+void EndstoneScheduler::mainThreadPostTick(std::uint64_t current_tick)
+{
+    auto tasks = std::move(post_tick_);
+    post_tick_.clear();
+    for (const auto &task : tasks) {
+        runDueTask(task, current_tick);
+    }
+}
+
+void EndstoneScheduler::mainThreadRunPrecise()
+{
+    // Tasks scheduled since the heartbeat, including by the precise tasks run below
+    consumePending(current_tick_);
+
+    // Only tasks already due are run, the server thread never waits for one
+    const auto now = EndstoneTask::TaskClock::now();
+    while (!precise_.empty() && precise_.front()->getDeadline() <= now) {
+        std::pop_heap(precise_.begin(), precise_.end(), runsLater);
+        auto task = std::move(precise_.back());
+        precise_.pop_back();
+        if (task->isCancelled()) {
+            removeTask(task->getTaskId());
             continue;
         }
 
-        auto tick = std::max(current_tick, pending_task->getNextRun());
-        auto &queue = queue_.emplace(tick, std::vector<std::shared_ptr<EndstoneTask>>{}).first->second;
-        queue.push_back(pending_task);
-        std::push_heap(queue.begin(), queue.end(), cmp_);
+        runSyncTask(*task);
+        consumePending(current_tick_);
+
+        const auto interval = task->getInterval();
+        if (interval.count() == 0 || task->isCancelled()) {
+            removeTask(task->getTaskId());
+            continue;
+        }
+        auto deadline = task->getDeadline() + interval;
+        if (const auto now = EndstoneTask::TaskClock::now(); deadline <= now) {
+            deadline += ((now - deadline) / interval + 1) * interval;
+        }
+        task->setDeadline(deadline);
+        precise_.push_back(std::move(task));
+        std::push_heap(precise_.begin(), precise_.end(), runsLater);
     }
+}
 
-    auto it = queue_.begin();
-    while (it != queue_.end()) {
-        auto tick = it->first;
-        auto &queue = it->second;
+void EndstoneScheduler::setTickBudget(std::chrono::nanoseconds budget)
+{
+    tick_budget_ = budget;
+}
 
-        if (tick > current_tick) {
-            break;
+std::chrono::nanoseconds EndstoneScheduler::getTickBudget() const
+{
+    return tick_budget_;
+}
+
+std::uint64_t EndstoneScheduler::getDeferredTaskCount() const
+{
+    return deferred_count_;
+}
+
+void EndstoneScheduler::setLoadSheddingThreshold(float threshold)
+{
+    load_shedding_threshold_ = std::clamp(threshold, 0.0F, 1.0F);
+}
+
+float EndstoneScheduler::getLoadSheddingThreshold() const
+{
+    return load_shedding_threshold_;
+}
+
+void EndstoneScheduler::setTimingsEnabled(bool enabled)
+{
+    timings_.setEnabled(enabled);
+}
+
+bool EndstoneScheduler::isTimingsEnabled() const
+{
+    return timings_.isEnabled();
+}
+
+void EndstoneScheduler::resetTimings()
+{
+    timings_.reset();
+}
+
+ThreadPoolExecutor &EndstoneScheduler::getExecutor(AsyncExecutor executor)
+{
+    switch (executor) {
+    case AsyncExecutor::Io:
+        return io_executor_;
+    case AsyncExecutor::Python:
+        return python_executor_;
+    default:
+        return cpu_executor_;
+    }
+}
+
+EndstoneScheduler::ExecutorOptions EndstoneScheduler::getDefaultExecutorOptions(AsyncExecutor executor)
+{
+    const std::size_t cores = std::max(std::thread::hardware_concurrency(), 1U);
+    if (executor == AsyncExecutor::Io) {
+        return {std::max<std::size_t>(cores, 4), ThreadOptions::fromEnvironment("IO")};
+    }
+    if (executor == AsyncExecutor::Python) {
+        return {1, ThreadOptions::fromEnvironment("PYTHON")};
+    }
+    return {std::max<std::size_t>(cores - 1, 1), ThreadOptions::fromEnvironment("CPU")};
+}
+
+void EndstoneScheduler::consumePending(std::uint64_t current_tick)
+{
+    std::shared_ptr<EndstoneTask> pending_task;
+    while (pending_.try_dequeue(pending_task)) {
+        if (pending_task->isCancelled()) {
+            continue;
         }
 
-        for (const auto &task : queue) {
-            if (task->isCancelled()) {
-                if (task->isSync()) {
-                    removeTask(task->getTaskId());
-                }
-                continue;
-            }
+        if (auto precise = std::dynamic_pointer_cast<EndstonePreciseTask>(pending_task)) {
+            precise_.push_back(std::move(precise));
+            std::push_heap(precise_.begin(), precise_.end(), runsLater);
+            continue;
+        }
+        auto tick = std::max(current_tick, pending_task->getNextRun());
+        wheel_.schedule(std::move(pending_task), tick);
+    }
+}
 
-            if (task->isSync()) {
-                current_task_ = task->getTaskId();
+void EndstoneScheduler::runCompletions()
+{
+    static constexpr std::size_t BatchSize = 64;
+    completion_buffer_.resize(BatchSize);
+    std::size_t count;
+    while ((count = completions_.try_dequeue_bulk(completion_buffer_.begin(), BatchSize)) > 0) {
+        for (std::size_t i = 0; i < count; ++i) {
+            auto &[plugin, callback] = completion_buffer_[i];
+            if (plugin->isEnabled()) {
                 try {
-                    task->run();
+                    callback();
                 }
                 catch (std::exception &e) {
-                    server_.getLogger().error("Could not execute task with id {}: {}", task->getTaskId(), e.what());
+                    server_.getLogger().error("Could not execute callback of plugin {}: {}", plugin->getName(),
+                                              e.what());
+                }
+                catch (...) {
+                    server_.getLogger().error("Could not execute callback of plugin {}: unknown exception",
+                                              plugin->getName());
                 }
-                current_task_ = 0;
-            }
-            else {
-                executor_.submit([&task]() { task->run(); });
             }
+            callback = nullptr;
+        }
+        if (count < BatchSize) {
+            break;
+        }
+    }
+}
 
-            if (task->getPeriod() > 0) {  // repeating task
-                task->setNextRun(current_tick + task->getPeriod());
-                pending_.enqueue(task);
-                continue;
-            }
+void EndstoneScheduler::runSyncTask(EndstoneTask &task)
+{
+    current_task_ = task.getTaskId();
+    const auto timed = timings_.isEnabled();
+    const auto start = timed ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+    try {
+        task.run();
+    }
+    catch (std::exception &e) {
+        server_.getLogger().error("Could not execute task with id {}: {}", task.getTaskId(), e.what());
+    }
+    if (timed) {
+        timings_.recordSync(task.getOwner(), std::chrono::steady_clock::now() - start);
+    }
+    current_task_ = 0;
+}
+
+void EndstoneScheduler::runDueTask(const std::shared_ptr<EndstoneTask> &task, std::uint64_t current_tick)
+{
+    if (task->isCancelled()) {
+        if (task->isSync()) {
+            removeTask(task->getTaskId());
+        }
+        return;
+    }
+
+    if (task->isSync()) {
+        runSyncTask(*task);
+    }
+    else {
+        auto &executor = getExecutor(static_cast<EndstoneAsyncTask &>(*task).getExecutor());
+        if (timings_.isEnabled()) {
+            timings_.recordAsyncSubmitted(task->getOwner());
+            executor.execute([this, task]() {
+                AsyncRunTimer timer{timings_, task->getOwner()};
+                task->run();
+            });
+        }
+        else {
+            executor.execute([task]() { task->run(); });
+        }
+    }
+
+    finishDueTask(task, current_tick);
+}
 
-            if (task->isSync()) {
-                removeTask(task->getTaskId());
+void EndstoneScheduler::runDimensionTasks(std::uint64_t current_tick)
+{
+    if (dimension_tasks_.empty()) {
+        return;
+    }
+
+    auto tasks = std::move(dimension_tasks_);
+    dimension_tasks_.clear();
+    tasks.erase(std::remove_if(tasks.begin(), tasks.end(),
+                               [&](const auto &task) {
+                                   if (task->isCancelled()) {
+                                       removeTask(task->getTaskId());
+                                       return true;
+                                   }
+                                   return false;
+                               }),
+                tasks.end());
+
+    std::vector<Dimension *> dimensions;
+    if (auto *level = server_.getLevel()) {
+        dimensions = level->getDimensions();
+    }
+
+    const auto run_for = [this, &tasks](Dimension &dimension) {
+        for (const auto &task : tasks) {
+            try {
+                task->runFor(dimension);
+            }
+            catch (std::exception &e) {
+                server_.getLogger().error("Could not execute task with id {}: {}", task->getTaskId(), e.what());
+            }
+            catch (...) {
+                server_.getLogger().error("Could not execute task with id {}: unknown exception", task->getTaskId());
             }
         }
+    };
+
+    // The first dimension runs on this thread and each other one on a worker of its own, so that the level, which
+    // does not tick until all of them are done, never waits behind the async tasks queued on the CPU workers
+    std::vector<std::future<void>> futures;
+    futures.reserve(dimensions.size());
+    for (std::size_t i = 1; i < dimensions.size(); ++i) {
+        futures.push_back(dimension_executor_.submit(run_for, std::ref(*dimensions[i])));
+    }
+    if (!dimensions.empty()) {
+        run_for(*dimensions.front());
+    }
+    for (auto &future : futures) {
+        future.wait();
+    }
 
-        it = queue_.erase(it);
+    for (const auto &task : tasks) {
+        finishDueTask(task, current_tick);
     }
-    current_tick_ = current_tick;
 }
 
-void EndstoneScheduler::removeTask(TaskId id)
+void EndstoneScheduler::finishDueTask(const std::shared_ptr<EndstoneTask> &task, std::uint64_t current_tick)
 {
-    std::lock_guard lock{tasks_mtx_};
-    auto it = tasks_.find(id);
-    if (it == tasks_.end()) {
+    if (task->getPeriod() > 0) {  // repeating task
+        auto period = task->getPeriod();
+        if (period_stretch_ > 1.0F && task->getPriority() == TaskPriority::Normal) {
+            period = static_cast<std::uint64_t>(std::ceil(static_cast<float>(period) * period_stretch_));
+        }
+        task->setNextRun(current_tick + period);
+        wheel_.schedule(task, task->getNextRun());
         return;
     }
-    tasks_.erase(it);
+
+    if (task->isSync()) {
+        removeTask(task->getTaskId());
+    }
+}
+
+void EndstoneScheduler::removeTask(TaskId id)
+{
+    tasks_.erase(id);
 }
 
 TaskId EndstoneScheduler::nextId()
 {
     TaskId id;
-    std::lock_guard lock{tasks_mtx_};
     do {
-        if (ids_ >= std::numeric_limits<std::uint32_t>::max()) {
-            ids_ = 1;
-        }
-        id = ids_++;
-    } while (tasks_.find(id) != tasks_.end());
+        id = ids_.fetch_add(1, std::memory_order_relaxed);
+    } while (id == 0 || tasks_.contains(id));
     return id;
 }
 
-bool EndstoneScheduler::TaskComparator::operator()(const std::shared_ptr<EndstoneTask> &lhs,
-                                                   const std::shared_ptr<EndstoneTask> &rhs)
-{
-    if (lhs->getNextRun() != rhs->getNextRun()) {
-        return lhs->getNextRun() > rhs->getNextRun();
-    }
-    return lhs->getCreatedAt() > rhs->getCreatedAt();
-}
 }  // namespace endstone::detail
@@ -57,6 +57,26 @@ void EndstoneTask::cancel()
     scheduler_.cancelTask(getTaskId());
 }
 
+TaskPriority EndstoneTask::getPriority() const
+{
+    return priority_;
+}
+
+void EndstoneTask::setPriority(TaskPriority priority)
+{
+    priority_ = priority;
+}
+
+TaskPhase EndstoneTask::getPhase() const
+{
+    return phase_;
+}
+
+void EndstoneTask::setPhase(TaskPhase phase)
+{
+    phase_ = phase;
+}
+
 void EndstoneTask::run()
 {
     if (task_) {
@@ -69,6 +89,11 @@ void EndstoneTask::doCancel()
     cancelled_ = true;
 }
 
+void EndstoneTask::release()
+{
+    task_ = nullptr;
+}
+
 EndstoneScheduler &EndstoneTask::getScheduler() const
 {
     return scheduler_;
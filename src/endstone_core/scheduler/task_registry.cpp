@@ -0,0 +1,118 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/scheduler/task_registry.h"
+
+#include <mutex>
+
+#include "endstone/detail/memory_usage.h"
+
+namespace endstone::detail {
+
+TaskRegistry::~TaskRegistry()
+{
+    for (const auto &shard : shards_) {
+        MemoryUsage::getInstance().remove(MemorySubsystem::Tasks, shard.tasks.size() * TaskBytes);
+    }
+}
+
+void TaskRegistry::insert(std::shared_ptr<EndstoneTask> task)
+{
+    const auto id = task->getTaskId();
+    const auto *owner = task->getOwner();
+    auto &shard = getShard(id);
+    std::unique_lock lock{shard.mutex};
+    if (auto [it, inserted] = shard.tasks.try_emplace(id, std::move(task)); inserted) {
+        MemoryUsage::getInstance().add(MemorySubsystem::Tasks, TaskBytes);
+    }
+    else {
+        it->second = std::move(task);
+    }
+    if (owner) {
+        std::lock_guard owners_lock{owners_mutex_};
+        owners_[owner].insert(id);
+    }
+}
+
+std::shared_ptr<EndstoneTask> TaskRegistry::find(TaskId id) const
+{
+    const auto &shard = getShard(id);
+    std::shared_lock lock{shard.mutex};
+    auto it = shard.tasks.find(id);
+    if (it == shard.tasks.end()) {
+        return nullptr;
+    }
+    return it->second;
+}
+
+bool TaskRegistry::contains(TaskId id) const
+{
+    const auto &shard = getShard(id);
+    std::shared_lock lock{shard.mutex};
+    return shard.tasks.find(id) != shard.tasks.end();
+}
+
+void TaskRegistry::erase(TaskId id)
+{
+    auto &shard = getShard(id);
+    std::unique_lock lock{shard.mutex};
+    auto it = shard.tasks.find(id);
+    if (it == shard.tasks.end()) {
+        return;
+    }
+    if (const auto *owner = it->second->getOwner()) {
+        std::lock_guard owners_lock{owners_mutex_};
+        if (auto owned = owners_.find(owner); owned != owners_.end()) {
+            owned->second.erase(id);
+            if (owned->second.empty()) {
+                owners_.erase(owned);
+            }
+        }
+    }
+    shard.tasks.erase(it);
+    MemoryUsage::getInstance().remove(MemorySubsystem::Tasks, TaskBytes);
+}
+
+std::vector<std::shared_ptr<EndstoneTask>> TaskRegistry::getTasks() const
+{
+    std::vector<std::shared_ptr<EndstoneTask>> tasks;
+    for (const auto &shard : shards_) {
+        std::shared_lock lock{shard.mutex};
+        for (const auto &[id, task] : shard.tasks) {
+            tasks.push_back(task);
+        }
+    }
+    return tasks;
+}
+
+std::vector<std::shared_ptr<EndstoneTask>> TaskRegistry::getTasks(const Plugin &owner) const
+{
+    std::vector<TaskId> ids;
+    {
+        std::lock_guard lock{owners_mutex_};
+        if (auto it = owners_.find(&owner); it != owners_.end()) {
+            ids.assign(it->second.begin(), it->second.end());
+        }
+    }
+    std::vector<std::shared_ptr<EndstoneTask>> tasks;
+    tasks.reserve(ids.size());
+    for (auto id : ids) {
+        if (auto task = find(id)) {
+            tasks.push_back(std::move(task));
+        }
+    }
+    return tasks;
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,129 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/scheduler/task_timings.h"
+
+#include <algorithm>
+#include <mutex>
+
+namespace endstone::detail {
+
+namespace {
+std::uint64_t toCount(std::chrono::nanoseconds elapsed)
+{
+    return static_cast<std::uint64_t>(std::max<std::int64_t>(elapsed.count(), 0));
+}
+
+void updateMax(std::atomic<std::uint64_t> &max, std::uint64_t value)
+{
+    auto current = max.load(std::memory_order_relaxed);
+    while (value > current && !max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+}
+}  // namespace
+
+void TaskTimings::setEnabled(bool enabled)
+{
+    enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+void TaskTimings::recordSync(const Plugin *plugin, std::chrono::nanoseconds elapsed)
+{
+    update(plugin, [&](Entry &entry) {
+        auto value = toCount(elapsed);
+        entry.sync_count.fetch_add(1, std::memory_order_relaxed);
+        entry.sync_total.fetch_add(value, std::memory_order_relaxed);
+        updateMax(entry.sync_max, value);
+        if (entry.tick_count++ == 0) {
+            ticked_.push_back(&entry);
+        }
+    });
+}
+
+void TaskTimings::recordAsyncSubmitted(const Plugin *plugin)
+{
+    update(plugin, [](Entry &entry) { entry.async_pending.fetch_add(1, std::memory_order_relaxed); });
+}
+
+void TaskTimings::recordAsync(const Plugin *plugin, std::chrono::nanoseconds elapsed)
+{
+    update(plugin, [&](Entry &entry) {
+        entry.async_count.fetch_add(1, std::memory_order_relaxed);
+        entry.async_total.fetch_add(toCount(elapsed), std::memory_order_relaxed);
+        // The submission may have been recorded before the timings were last reset
+        auto pending = entry.async_pending.load(std::memory_order_relaxed);
+        while (pending > 0 &&
+               !entry.async_pending.compare_exchange_weak(pending, pending - 1, std::memory_order_relaxed)) {}
+    });
+}
+
+void TaskTimings::endTick()
+{
+    for (auto *entry : ticked_) {
+        entry->sync_ticks.fetch_add(1, std::memory_order_relaxed);
+        updateMax(entry->sync_max_per_tick, entry->tick_count);
+        entry->tick_count = 0;
+    }
+    ticked_.clear();
+}
+
+std::vector<TaskTiming> TaskTimings::getTimings() const
+{
+    std::shared_lock lock(mutex_);
+    std::vector<TaskTiming> timings;
+    timings.reserve(entries_.size());
+    for (const auto &[plugin, entry] : entries_) {
+        timings.push_back({
+            entry->plugin,
+            entry->sync_count.load(std::memory_order_relaxed),
+            entry->sync_ticks.load(std::memory_order_relaxed),
+            entry->sync_max_per_tick.load(std::memory_order_relaxed),
+            std::chrono::nanoseconds(entry->sync_total.load(std::memory_order_relaxed)),
+            std::chrono::nanoseconds(entry->sync_max.load(std::memory_order_relaxed)),
+            entry->async_count.load(std::memory_order_relaxed),
+            entry->async_pending.load(std::memory_order_relaxed),
+            std::chrono::nanoseconds(entry->async_total.load(std::memory_order_relaxed)),
+        });
+    }
+    return timings;
+}
+
+void TaskTimings::reset()
+{
+    std::unique_lock lock(mutex_);
+    ticked_.clear();
+    entries_.clear();
+}
+
+template <typename Func>
+void TaskTimings::update(const Plugin *plugin, Func &&func)
+{
+    {
+        // Entries are only destroyed by reset(), which cannot run while the lock is held
+        std::shared_lock lock(mutex_);
+        if (auto it = entries_.find(plugin); it != entries_.end()) {
+            func(*it->second);
+            return;
+        }
+    }
+
+    std::unique_lock lock(mutex_);
+    auto &entry = entries_[plugin];
+    if (!entry) {
+        entry = std::make_unique<Entry>();
+        entry->plugin = plugin ? plugin->getName() : "Endstone";
+    }
+    func(*entry);
+}
+
+}  // namespace endstone::detail
@@ -14,43 +14,157 @@
 
 #include "endstone/detail/scheduler/thread_pool_executor.h"
 
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
 namespace endstone::detail {
 
-ThreadPoolExecutor::ThreadPoolExecutor(size_t thread_count) : done(false)
+namespace {
+thread_local const ThreadPoolExecutor *current_executor = nullptr;
+thread_local std::size_t current_worker = 0;
+}  // namespace
+
+ThreadPoolExecutor::ThreadPoolExecutor(size_t thread_count, ThreadOptions options) : options_(std::move(options))
 {
+    thread_count = std::max<size_t>(thread_count, 1);
+    for (size_t i = 0; i < thread_count; ++i) {
+        workers_.push_back(std::make_unique<Worker>());
+    }
+    // Start the threads only once every deque exists, as workers steal from each other
     for (size_t i = 0; i < thread_count; ++i) {
-        threads.emplace_back(&ThreadPoolExecutor::worker, this);
+        workers_[i]->thread = std::thread(&ThreadPoolExecutor::worker, this, i);
     }
 }
 
 ThreadPoolExecutor::~ThreadPoolExecutor()
 {
-    done = true;
-    condition.notify_all();
-    for (auto &thread : threads) {
-        if (thread.joinable()) {
-            thread.join();
+    done_ = true;
+    {
+        std::lock_guard lock{mutex_};
+        condition_.notify_all();
+    }
+    for (auto &worker : workers_) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+
+    // Process remaining tasks
+    Job *job;
+    while (injected_.try_dequeue(job)) {
+        run(job);
+    }
+    for (auto &worker : workers_) {
+        while ((job = worker->deque.pop()) != nullptr) {
+            run(job);
         }
     }
 }
 
-void ThreadPoolExecutor::worker()
+void ThreadPoolExecutor::execute(std::function<void()> task)
+{
+    auto *job = new Job(std::move(task));
+    queued_.fetch_add(1, std::memory_order_relaxed);
+    if (current_executor == this) {
+        workers_[current_worker]->deque.push(job);
+    }
+    else {
+        injected_.enqueue(job);
+    }
+
+    // Pairs with the fence in park, so either the parking worker sees the job or we see the sleeper
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleepers_.load(std::memory_order_relaxed) > 0) {
+        std::lock_guard lock{mutex_};
+        condition_.notify_one();
+    }
+}
+
+std::size_t ThreadPoolExecutor::getThreadCount() const
+{
+    return workers_.size();
+}
+
+std::size_t ThreadPoolExecutor::getQueueDepth() const
+{
+    return queued_.load(std::memory_order_relaxed);
+}
+
+void ThreadPoolExecutor::worker(std::size_t index)
 {
-    while (!done) {
-        std::function<void()> task;
-        if (tasks.try_dequeue(task)) {
-            task();
+    current_executor = this;
+    current_worker = index;
+    options_.apply();
+
+    int idle = 0;
+    while (true) {
+        if (auto *job = findJob(index)) {
+            run(job);
+            idle = 0;
+            continue;
         }
-        else {
-            std::unique_lock<std::mutex> lock(mutex);
-            condition.wait_for(lock, std::chrono::milliseconds(10));
+        if (done_) {
+            break;
         }
+        if (++idle < SpinCount) {
+            std::this_thread::yield();
+            continue;
+        }
+        park();
+        idle = 0;
     }
+}
 
-    // Process remaining tasks
-    std::function<void()> task;
-    while (tasks.try_dequeue(task)) {
-        task();
+ThreadPoolExecutor::Job *ThreadPoolExecutor::findJob(std::size_t index)
+{
+    if (auto *job = workers_[index]->deque.pop()) {
+        return job;
+    }
+
+    Job *job;
+    if (injected_.try_dequeue(job)) {
+        return job;
     }
+
+    for (std::size_t i = 1; i < workers_.size(); ++i) {
+        if ((job = workers_[(index + i) % workers_.size()]->deque.steal()) != nullptr) {
+            return job;
+        }
+    }
+    return nullptr;
 }
+
+bool ThreadPoolExecutor::hasJobs() const
+{
+    if (injected_.size_approx() > 0) {
+        return true;
+    }
+    return std::any_of(workers_.begin(), workers_.end(), [](const auto &worker) { return !worker->deque.empty(); });
+}
+
+void ThreadPoolExecutor::park()
+{
+    std::unique_lock lock{mutex_};
+    sleepers_.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!done_ && !hasJobs()) {
+        // The timeout only guards against a missed notification, every submission wakes a sleeper
+        condition_.wait_for(lock, std::chrono::milliseconds(10));
+    }
+    sleepers_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void ThreadPoolExecutor::run(Job *job)
+{
+    std::unique_ptr<Job> owned{job};
+    queued_.fetch_sub(1, std::memory_order_relaxed);
+    try {
+        (*owned)();
+    }
+    catch (...) {
+        // Tasks are fire-and-forget here, results and exceptions are delivered by the tasks themselves
+    }
+}
+
 }  // namespace endstone::detail
@@ -16,6 +16,7 @@
 
 #include <optional>
 #include <string>
+#include <vector>
 
 #include <magic_enum/magic_enum.hpp>
 
@@ -78,6 +79,7 @@ Scoreboard &EndstoneObjective::getScoreboard() const
 void EndstoneObjective::unregister() const
 {
     if (checkState()) {
+        scoreboard_.rankings_.erase(name_);
         scoreboard_.board_.removeObjective(&objective_);
     }
 }
@@ -157,11 +159,27 @@ void EndstoneObjective::setRenderType(RenderType render_type)
 std::unique_ptr<Score> EndstoneObjective::getScore(ScoreEntry entry) const
 {
     if (checkState()) {
-        return std::make_unique<EndstoneScore>(copy(), entry);
+        return std::make_unique<EndstoneScore>(*this, entry);
     }
     return nullptr;
 }
 
+std::vector<std::unique_ptr<Score>> EndstoneObjective::getTopScores(std::size_t count) const
+{
+    if (checkState()) {
+        return scoreboard_.getTopScores(objective_, count);
+    }
+    return {};
+}
+
+std::optional<std::size_t> EndstoneObjective::getRank(ScoreEntry entry) const
+{
+    if (checkState()) {
+        return scoreboard_.getRank(objective_, std::move(entry));
+    }
+    return std::nullopt;
+}
+
 bool EndstoneObjective::checkState() const
 {
     if (scoreboard_.board_.getObjective(name_) == nullptr) {
@@ -189,11 +207,6 @@ void EndstoneObjective::forEachDisplayObjective(
     }
 }
 
-std::unique_ptr<EndstoneObjective> EndstoneObjective::copy() const
-{
-    return std::make_unique<EndstoneObjective>(scoreboard_, objective_);
-}
-
 bool EndstoneObjective::operator==(const Objective &other) const
 {
     return &objective_ == &static_cast<const EndstoneObjective &>(other).objective_;
@@ -0,0 +1,212 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/scoreboard/ranked_scores.h"
+
+#include <vector>
+
+namespace endstone::detail {
+
+RankedScores::RankedScores() = default;
+
+RankedScores::~RankedScores()
+{
+    // Released one node at a time, the recursive destruction of a deep treap could overflow the stack
+    std::vector<std::unique_ptr<Node>> nodes;
+    if (root_) {
+        nodes.push_back(std::move(root_));
+    }
+    while (!nodes.empty()) {
+        auto node = std::move(nodes.back());
+        nodes.pop_back();
+        if (node->left) {
+            nodes.push_back(std::move(node->left));
+        }
+        if (node->right) {
+            nodes.push_back(std::move(node->right));
+        }
+    }
+}
+
+RankedScores::RankedScores(RankedScores &&) noexcept = default;
+RankedScores &RankedScores::operator=(RankedScores &&) noexcept = default;
+
+void RankedScores::set(std::int64_t id, int score)
+{
+    auto [it, inserted] = entries_.try_emplace(id, Entry{score, generation_});
+    if (inserted) {
+        insert({score, id});
+        return;
+    }
+    it->second.generation = generation_;
+    if (it->second.score == score) {
+        return;
+    }
+    erase({it->second.score, id});
+    insert({score, id});
+    it->second.score = score;
+}
+
+void RankedScores::remove(std::int64_t id)
+{
+    auto it = entries_.find(id);
+    if (it == entries_.end()) {
+        return;
+    }
+    erase({it->second.score, id});
+    entries_.erase(it);
+}
+
+void RankedScores::beginSync()
+{
+    ++generation_;
+}
+
+void RankedScores::endSync()
+{
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        if (it->second.generation != generation_) {
+            erase({it->second.score, it->first});
+            it = entries_.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+void RankedScores::forEachDescending(const std::function<bool(std::int64_t id, int score)> &callback) const
+{
+    // A reverse in-order walk, the scores are visited without going through the ones below those read
+    std::vector<const Node *> stack;
+    const auto *node = root_.get();
+    while (node || !stack.empty()) {
+        while (node) {
+            stack.push_back(node);
+            node = node->right.get();
+        }
+        node = stack.back();
+        stack.pop_back();
+        if (!callback(node->key.second, node->key.first)) {
+            return;
+        }
+        node = node->left.get();
+    }
+}
+
+std::optional<std::size_t> RankedScores::getRank(std::int64_t id) const
+{
+    auto it = entries_.find(id);
+    if (it == entries_.end()) {
+        return std::nullopt;
+    }
+    const Key key{it->second.score, id};
+    std::size_t greater = 0;
+    const auto *node = root_.get();
+    while (node) {
+        if (key < node->key) {
+            greater += sizeOf(node->right) + 1;
+            node = node->left.get();
+        }
+        else if (node->key < key) {
+            node = node->right.get();
+        }
+        else {
+            greater += sizeOf(node->right);
+            break;
+        }
+    }
+    return greater + 1;
+}
+
+std::size_t RankedScores::size() const
+{
+    return entries_.size();
+}
+
+std::size_t RankedScores::sizeOf(const std::unique_ptr<Node> &node)
+{
+    return node ? node->size : 0;
+}
+
+void RankedScores::update(Node &node)
+{
+    node.size = 1 + sizeOf(node.left) + sizeOf(node.right);
+}
+
+std::pair<std::unique_ptr<RankedScores::Node>, std::unique_ptr<RankedScores::Node>> RankedScores::split(
+    std::unique_ptr<Node> node, const Key &key)
+{
+    // Keys below the given one go to the left
+    if (!node) {
+        return {};
+    }
+    if (node->key < key) {
+        auto [left, right] = split(std::move(node->right), key);
+        node->right = std::move(left);
+        update(*node);
+        return {std::move(node), std::move(right)};
+    }
+    auto [left, right] = split(std::move(node->left), key);
+    node->left = std::move(right);
+    update(*node);
+    return {std::move(left), std::move(node)};
+}
+
+std::unique_ptr<RankedScores::Node> RankedScores::merge(std::unique_ptr<Node> left, std::unique_ptr<Node> right)
+{
+    if (!left) {
+        return right;
+    }
+    if (!right) {
+        return left;
+    }
+    if (left->priority > right->priority) {
+        left->right = merge(std::move(left->right), std::move(right));
+        update(*left);
+        return left;
+    }
+    right->left = merge(std::move(left), std::move(right->left));
+    update(*right);
+    return right;
+}
+
+void RankedScores::insert(const Key &key)
+{
+    auto node = std::make_unique<Node>();
+    node->key = key;
+    node->priority = static_cast<std::uint32_t>(random_());
+    auto [left, right] = split(std::move(root_), key);
+    root_ = merge(merge(std::move(left), std::move(node)), std::move(right));
+}
+
+void RankedScores::erase(const Key &key)
+{
+    erase(root_, key);
+}
+
+void RankedScores::erase(std::unique_ptr<Node> &node, const Key &key)
+{
+    if (!node) {
+        return;
+    }
+    if (node->key == key) {
+        node = merge(std::move(node->left), std::move(node->right));
+        return;
+    }
+    erase(key < node->key ? node->left : node->right, key);
+    update(*node);
+}
+
+}  // namespace endstone::detail
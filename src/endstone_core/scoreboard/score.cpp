@@ -14,6 +14,7 @@
 
 #include "endstone/detail/scoreboard/score.h"
 
+#include <optional>
 #include <utility>
 
 #include <entt/entt.hpp>
@@ -26,7 +27,7 @@
 
 namespace endstone::detail {
 
-EndstoneScore::EndstoneScore(std::unique_ptr<EndstoneObjective> objective, ScoreEntry entry)
+EndstoneScore::EndstoneScore(EndstoneObjective objective, ScoreEntry entry)
     : objective_(std::move(objective)), entry_(std::move(entry))
 {
 }
@@ -38,10 +39,10 @@ ScoreEntry EndstoneScore::getEntry() const
 
 int EndstoneScore::getValue() const
 {
-    if (objective_->checkState()) {
+    if (objective_.checkState()) {
         const auto &id = getScoreboardId();
-        if (id.isValid() && objective_->objective_.hasScore(id)) {
-            return objective_->objective_.getPlayerScore(id).value;
+        if (id.isValid() && objective_.objective_.hasScore(id)) {
+            return objective_.objective_.getPlayerScore(id).value;
         }
     }
     return 0;
@@ -49,59 +50,108 @@ int EndstoneScore::getValue() const
 
 void EndstoneScore::setValue(int score)
 {
-    if (objective_->checkState()) {
+    if (objective_.checkState()) {
         const auto &id = getOrCreateScoreboardId();
         if (!id.isValid()) {
             throw std::runtime_error("Invalid scoreboard id");
         }
 
         auto &server = entt::locator<EndstoneServer>::value();
-        if (!objective_->isModifiable()) {
+        if (!objective_.isModifiable()) {
             server.getLogger().error("Cannot modify read-only score");
             return;
         }
 
-        bool success = false;
-        objective_->scoreboard_.board_.modifyPlayerScore(success, id, objective_->objective_, score,
-                                                         PlayerScoreSetFunction::Set);
-        if (!success) {
+        auto &objective = objective_.objective_;
+        const auto current = objective.getPlayerScore(id);
+        if (current.valid && current.value == score) {
+            return;
+        }
+
+        // The change is queued on the scoreboard and sent to the viewers together with the others made this tick
+        auto *id_ref = objective_.scoreboard_.board_.getScoreboardIdentityRef(id);
+        int result = 0;
+        if (!id_ref || !id_ref->modifyScoreInObjective(result, objective, score, PlayerScoreSetFunction::Set)) {
             server.getLogger().error("Cannot modify score");
             return;
         }
+        objective_.scoreboard_.queueScoreChange(id, objective);
+    }
+}
+
+void EndstoneScore::setViewerValue(Player &viewer, int score)
+{
+    if (objective_.checkState()) {
+        auto *player = getViewer(viewer);
+        if (!player) {
+            return;
+        }
+
+        const auto &id = getOrCreateScoreboardId();
+        if (!id.isValid()) {
+            throw std::runtime_error("Invalid scoreboard id");
+        }
+        objective_.scoreboard_.setViewerScore(*player, id, objective_.objective_, score);
+    }
+}
+
+void EndstoneScore::resetViewerValue(Player &viewer)
+{
+    if (objective_.checkState()) {
+        auto *player = getViewer(viewer);
+        if (!player) {
+            return;
+        }
+
+        const auto &id = getScoreboardId();
+        if (id.isValid()) {
+            objective_.scoreboard_.setViewerScore(*player, id, objective_.objective_, std::nullopt);
+        }
     }
 }
 
 bool EndstoneScore::isScoreSet() const
 {
-    if (objective_->checkState()) {
+    if (objective_.checkState()) {
         const auto &id = getScoreboardId();
-        return id.isValid() && objective_->objective_.hasScore(id);
+        return id.isValid() && objective_.objective_.hasScore(id);
     }
     return false;
 }
 
 Objective &EndstoneScore::getObjective() const
 {
-    return *objective_;
+    return objective_;
 }
 
 Scoreboard &EndstoneScore::getScoreboard() const
 {
-    return objective_->getScoreboard();
+    return objective_.getScoreboard();
 }
 
 const ScoreboardId &EndstoneScore::getScoreboardId() const
 {
-    if (objective_->checkState()) {
-        return objective_->scoreboard_.getScoreboardId(entry_);
+    if (objective_.checkState()) {
+        return objective_.scoreboard_.getScoreboardId(entry_);
     }
     return ScoreboardId::INVALID;
 }
 
+EndstonePlayer *EndstoneScore::getViewer(Player &player) const
+{
+    auto &server = entt::locator<EndstoneServer>::value();
+    auto &viewer = static_cast<EndstonePlayer &>(player);
+    if (&server.getPlayerBoard(viewer) != &objective_.scoreboard_) {
+        server.getLogger().error("{} is not viewing the scoreboard of this score.", player.getName());
+        return nullptr;
+    }
+    return &viewer;
+}
+
 const ScoreboardId &EndstoneScore::getOrCreateScoreboardId()
 {
-    if (objective_->checkState()) {
-        return objective_->scoreboard_.getOrCreateScoreboardId(entry_);
+    if (objective_.checkState()) {
+        return objective_.scoreboard_.getOrCreateScoreboardId(entry_);
     }
     return ScoreboardId::INVALID;
 }
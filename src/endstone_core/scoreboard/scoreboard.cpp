@@ -14,7 +14,12 @@
 
 #include "endstone/detail/scoreboard/scoreboard.h"
 
+#include <cstdint>
+#include <optional>
 #include <stdexcept>
+#include <unordered_map>
+
+#include <magic_enum/magic_enum.hpp>
 
 #include "bedrock/world/actor/actor.h"
 #include "bedrock/world/actor/player/player.h"
@@ -22,22 +27,138 @@
 #include "bedrock/world/scores/scoreboard.h"
 #include "endstone/detail/actor/actor.h"
 #include "endstone/detail/level/level.h"
+#include "endstone/detail/memory_usage.h"
+#include "endstone/detail/network/packet_adapter.h"
 #include "endstone/detail/player.h"
 #include "endstone/detail/scoreboard/objective.h"
 #include "endstone/detail/scoreboard/score.h"
 #include "endstone/detail/server.h"
+#include "endstone/network/set_score_packet.h"
 
 namespace endstone::detail {
 
+namespace {
+bool isDisplayed(const ::Scoreboard &board, const ::Objective &objective)
+{
+    for (const auto &slot : magic_enum::enum_values<DisplaySlot>()) {
+        const auto *display = board.getDisplayObjective(EndstoneScoreboard::getDisplaySlotName(slot));
+        if (display && display->isDisplaying(objective)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool toPacketEntry(const ScoreboardIdentityRef &id_ref, SetScorePacket::Entry &entry)
+{
+    entry.scoreboard_id = id_ref.getScoreboardId().raw_id;
+    switch (id_ref.getIdentityType()) {
+    case IdentityDefinition::Type::Player:
+        entry.identity_type = SetScorePacket::IdentityType::Player;
+        entry.actor_id = id_ref.getPlayerId().actor_unique_id.raw_id;
+        return true;
+    case IdentityDefinition::Type::Entity:
+        entry.identity_type = SetScorePacket::IdentityType::Actor;
+        entry.actor_id = id_ref.getEntityId().raw_id;
+        return true;
+    case IdentityDefinition::Type::FakePlayer:
+        entry.identity_type = SetScorePacket::IdentityType::FakePlayer;
+        entry.fake_player_name = id_ref.getFakePlayerName();
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Finds the players and actors behind identities, indexed on first use rather than searched for each identity
+class IdentityResolver {
+public:
+    explicit IdentityResolver(EndstoneServer &server) : server_(server) {}
+
+    std::optional<ScoreEntry> resolve(const ScoreboardIdentityRef &id_ref)
+    {
+        switch (id_ref.getIdentityType()) {
+        case IdentityDefinition::Type::Player: {
+            if (!players_) {
+                players_.emplace();
+                for (const auto &player : server_.getOnlinePlayers()) {
+                    const auto id = static_cast<EndstonePlayer *>(player)->getHandle().getOrCreateUniqueID();
+                    players_->emplace(id.raw_id, player);
+                }
+            }
+            auto it = players_->find(id_ref.getPlayerId().actor_unique_id.raw_id);
+            if (it == players_->end()) {
+                return std::nullopt;
+            }
+            return it->second;
+        }
+        case IdentityDefinition::Type::Entity: {
+            if (!actors_) {
+                actors_.emplace();
+                for (const auto &actor : server_.getLevel()->getActors()) {
+                    const auto id = static_cast<EndstoneActor *>(actor)->getActor().getOrCreateUniqueID();
+                    actors_->emplace(id.raw_id, actor);
+                }
+            }
+            auto it = actors_->find(id_ref.getEntityId().raw_id);
+            if (it == actors_->end()) {
+                return std::nullopt;
+            }
+            return it->second;
+        }
+        case IdentityDefinition::Type::FakePlayer:
+            return id_ref.getFakePlayerName();
+        default:
+            throw std::runtime_error("Invalid IdentityDefinition::Type");
+        }
+    }
+
+private:
+    EndstoneServer &server_;
+    std::optional<std::unordered_map<std::int64_t, Player *>> players_;
+    std::optional<std::unordered_map<std::int64_t, Actor *>> actors_;
+};
+
+bool overlaps(const std::unordered_map<std::string, std::unordered_map<::ScoreboardId, int>> &scores,
+              const std::unordered_map<std::string, std::unordered_set<::ScoreboardId>> &ids)
+{
+    for (const auto &[name, objective_ids] : ids) {
+        auto it = scores.find(name);
+        if (it == scores.end()) {
+            continue;
+        }
+        for (const auto &id : objective_ids) {
+            if (it->second.find(id) != it->second.end()) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+}  // namespace
+
 EndstoneScoreboard::EndstoneScoreboard(::Scoreboard &board) : board_(board)
 {
     init();
+    MemoryUsage::getInstance().add(MemorySubsystem::Scoreboards, getFootprint());
 }
 
 EndstoneScoreboard::EndstoneScoreboard(std::unique_ptr<::Scoreboard> board) : board_(*board)
 {
     holder_ = std::move(board);
     init();
+    MemoryUsage::getInstance().add(MemorySubsystem::Scoreboards, getFootprint());
+}
+
+EndstoneScoreboard::~EndstoneScoreboard()
+{
+    MemoryUsage::getInstance().remove(MemorySubsystem::Scoreboards, getFootprint());
+}
+
+std::size_t EndstoneScoreboard::getFootprint() const
+{
+    // The vanilla scoreboard is only counted when it was created for this one, e.g. for a per-player board
+    return sizeof(EndstoneScoreboard) + sizeof(ScoreboardPacketSender) + (holder_ ? sizeof(::Scoreboard) : 0);
 }
 
 void EndstoneScoreboard::init()
@@ -108,8 +229,13 @@ std::vector<std::unique_ptr<Objective>> EndstoneScoreboard::getObjectives() cons
 std::vector<std::unique_ptr<Objective>> EndstoneScoreboard::getObjectivesByCriteria(Criteria::Type criteria) const
 {
     std::vector<std::unique_ptr<Objective>> result;
+    // Criteria are registered once per scoreboard, so objectives can be matched by identity instead of by name
+    const auto *cr = board_.getCriteria(getCriteriaName(criteria));
+    if (!cr) {
+        return result;
+    }
     board_.forEachObjective([&](auto &objective) {
-        if (objective.getCriteria().getName() == EndstoneScoreboard::getCriteriaName(criteria)) {
+        if (&objective.getCriteria() == cr) {
             result.push_back(std::make_unique<EndstoneObjective>(const_cast<EndstoneScoreboard &>(*this), objective));
         }
     });
@@ -120,51 +246,47 @@ std::vector<std::unique_ptr<Score>> EndstoneScoreboard::getScores(ScoreEntry ent
 {
     std::vector<std::unique_ptr<Score>> result;
     board_.forEachObjective([&](auto &objective) {
-        auto obj = std::make_unique<EndstoneObjective>(const_cast<EndstoneScoreboard &>(*this), objective);
+        EndstoneObjective obj{const_cast<EndstoneScoreboard &>(*this), objective};
         result.push_back(std::make_unique<EndstoneScore>(std::move(obj), entry));
     });
     return result;
 }
 
+void EndstoneScoreboard::forEachObjective(const std::function<void(Objective &)> &callback) const
+{
+    board_.forEachObjective([&](auto &objective) {
+        EndstoneObjective obj{const_cast<EndstoneScoreboard &>(*this), objective};
+        callback(obj);
+    });
+}
+
+void EndstoneScoreboard::forEachScore(ScoreEntry entry, const std::function<void(Score &)> &callback) const
+{
+    board_.forEachObjective([&](auto &objective) {
+        EndstoneScore score{EndstoneObjective{const_cast<EndstoneScoreboard &>(*this), objective}, entry};
+        callback(score);
+    });
+}
+
 void EndstoneScoreboard::resetScores(ScoreEntry entry)
 {
     const auto &scoreboard_id = getScoreboardId(entry);
-    if (scoreboard_id.isValid()) {
-        board_.resetPlayerScore(getScoreboardId(entry));
+    if (!scoreboard_id.isValid()) {
+        return;
     }
+    for (auto &[name, ranking] : rankings_) {
+        ranking.scores.remove(scoreboard_id.raw_id);
+    }
+    board_.resetPlayerScore(scoreboard_id);
 }
 
 std::vector<ScoreEntry> EndstoneScoreboard::getEntries() const
 {
     std::vector<ScoreEntry> result;
-    auto &server = entt::locator<EndstoneServer>::value();
+    IdentityResolver resolver{entt::locator<EndstoneServer>::value()};
     board_.forEachIdentityRef([&](auto &id_ref) {
-        switch (id_ref.getIdentityType()) {
-        case IdentityDefinition::Type::Player: {
-            auto players = server.getOnlinePlayers();
-            for (const auto &player : players) {
-                if (static_cast<EndstonePlayer *>(player)->getHandle().getOrCreateUniqueID() ==
-                    id_ref.getPlayerId().actor_unique_id) {
-                    result.emplace_back(player);
-                }
-            }
-            break;
-        }
-        case IdentityDefinition::Type::Entity: {
-            auto actors = server.getLevel()->getActors();
-            for (const auto &actor : actors) {
-                if (static_cast<EndstoneActor *>(actor)->getActor().getOrCreateUniqueID() == id_ref.getEntityId()) {
-                    result.emplace_back(actor);
-                }
-            }
-            break;
-        }
-        case IdentityDefinition::Type::FakePlayer: {
-            result.push_back(id_ref.getFakePlayerName());
-            break;
-        }
-        default:
-            throw std::runtime_error("Invalid IdentityDefinition::Type");
+        if (auto entry = resolver.resolve(id_ref)) {
+            result.push_back(std::move(*entry));
         }
     });
     return result;
@@ -239,4 +361,255 @@ const ::ScoreboardId &EndstoneScoreboard::getOrCreateScoreboardId(ScoreEntry ent
     return board_;
 }
 
+ScoreboardPacketSender &EndstoneScoreboard::getPacketSender() const
+{
+    return *packet_sender_;
+}
+
+void EndstoneScoreboard::queueScoreChange(const ::ScoreboardId &id, const ::Objective &objective)
+{
+    pending_scores_[objective.getName()].insert(id);
+    if (auto it = rankings_.find(objective.getName()); it != rankings_.end() && it->second.objective == &objective) {
+        const auto score = objective.getPlayerScore(id);
+        if (score.valid) {
+            it->second.scores.set(id.raw_id, score.value);
+        }
+        else {
+            it->second.scores.remove(id.raw_id);
+        }
+    }
+}
+
+std::vector<std::unique_ptr<Score>> EndstoneScoreboard::getTopScores(::Objective &objective, std::size_t count)
+{
+    std::vector<std::unique_ptr<Score>> result;
+    if (count == 0) {
+        return result;
+    }
+    IdentityResolver resolver{entt::locator<EndstoneServer>::value()};
+    getRanking(objective).forEachDescending([&](auto id, auto) {
+        // Identities that cannot be resolved, such as players who are offline, are left out like in getEntries
+        if (auto *id_ref = board_.getScoreboardIdentityRef(::ScoreboardId{id})) {
+            if (auto entry = resolver.resolve(*id_ref)) {
+                result.push_back(std::make_unique<EndstoneScore>(EndstoneObjective{*this, objective}, *entry));
+            }
+        }
+        return result.size() < count;
+    });
+    return result;
+}
+
+std::optional<std::size_t> EndstoneScoreboard::getRank(const ::Objective &objective, ScoreEntry entry)
+{
+    const auto &scoreboard_id = getScoreboardId(entry);
+    if (!scoreboard_id.isValid()) {
+        return std::nullopt;
+    }
+    return getRanking(objective).getRank(scoreboard_id.raw_id);
+}
+
+RankedScores &EndstoneScoreboard::getRanking(const ::Objective &objective)
+{
+    auto &ranking = rankings_[objective.getName()];
+    const auto now = std::chrono::steady_clock::now();
+    if (ranking.objective == &objective && now - ranking.synced < RankingSyncInterval) {
+        return ranking.scores;
+    }
+    if (ranking.objective != &objective) {
+        ranking.scores = RankedScores{};
+        ranking.objective = &objective;
+    }
+    ranking.scores.beginSync();
+    for (const auto &[id, score] : objective.getScores()) {
+        ranking.scores.set(id.raw_id, score);
+    }
+    ranking.scores.endSync();
+    ranking.synced = now;
+    return ranking.scores;
+}
+
+void EndstoneScoreboard::setViewerScore(const EndstonePlayer &viewer, const ::ScoreboardId &id,
+                                        const ::Objective &objective, std::optional<int> score)
+{
+    const auto &name = objective.getName();
+    if (score.has_value()) {
+        auto &viewer_scores = viewer_scores_[&viewer];
+        auto &scores = viewer_scores.scores[name];
+        if (auto it = scores.find(id); it != scores.end() && it->second == score.value()) {
+            return;
+        }
+        scores[id] = score.value();
+        viewer_scores.reset[name].erase(id);
+        viewer_scores.dirty = true;
+        return;
+    }
+
+    auto it = viewer_scores_.find(&viewer);
+    if (it == viewer_scores_.end()) {
+        return;
+    }
+    auto &viewer_scores = it->second;
+    if (auto scores = viewer_scores.scores.find(name);
+        scores != viewer_scores.scores.end() && scores->second.erase(id) > 0) {
+        viewer_scores.reset[name].insert(id);
+        viewer_scores.dirty = true;
+    }
+}
+
+void EndstoneScoreboard::clearViewerScores(const EndstonePlayer &viewer)
+{
+    viewer_scores_.erase(&viewer);
+}
+
+void EndstoneScoreboard::flushScores()
+{
+    auto pending = std::move(pending_scores_);
+    pending_scores_.clear();
+    if (!pending.empty()) {
+        sendSharedScores(pending);
+    }
+
+    for (auto it = viewer_scores_.begin(); it != viewer_scores_.end();) {
+        auto &[viewer, viewer_scores] = *it;
+        // The shared scores sent to a viewer overwrite its overrides on the client, so those are sent again after them
+        if (viewer_scores.dirty || viewer_scores_stale_ || overlaps(viewer_scores.scores, pending)) {
+            sendViewerScores(*viewer, viewer_scores);
+        }
+        if (viewer_scores.scores.empty()) {
+            it = viewer_scores_.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+    viewer_scores_stale_ = false;
+}
+
+void EndstoneScoreboard::invalidateSentScores()
+{
+    sent_scores_.clear();
+    viewer_scores_stale_ = true;
+}
+
+void EndstoneScoreboard::sendSharedScores(const ScoreSet &pending)
+{
+    SetScorePacket packet;
+    packet.action = SetScorePacket::Action::Change;
+
+    // The vanilla scoreboard still gets notified of every change for its own bookkeeping, but the packet it would
+    // send per change is dropped in favour of the single one built here.
+    packet_sender_->setSuppressed(true);
+    for (auto &[name, ids] : pending) {
+        auto *objective = board_.getObjective(name);
+        if (!objective) {
+            sent_scores_.erase(name);
+            continue;
+        }
+
+        const auto displayed = isDisplayed(board_, *objective);
+        auto &sent = sent_scores_[name];
+        for (const auto &id : ids) {
+            auto *id_ref = board_.getScoreboardIdentityRef(id);
+            const auto score = objective->getPlayerScore(id);
+            if (!id_ref || !score.valid) {
+                sent.erase(id);
+                continue;
+            }
+
+            board_.onScoreChanged(id_ref->getScoreboardId(), *objective);
+            if (!displayed) {
+                sent.erase(id);
+                continue;
+            }
+
+            // Skip the scores that went back to the value the viewers already have
+            auto [it, inserted] = sent.emplace(id, score.value);
+            if (!inserted) {
+                if (it->second == score.value) {
+                    continue;
+                }
+                it->second = score.value;
+            }
+
+            SetScorePacket::Entry entry;
+            if (toPacketEntry(*id_ref, entry)) {
+                entry.objective_name = name;
+                entry.score = score.value;
+                packet.entries.push_back(std::move(entry));
+            }
+        }
+    }
+    packet_sender_->setSuppressed(false);
+
+    if (!packet.entries.empty()) {
+        PacketAdapter adapter{packet};
+        packet_sender_->sendToViewers(adapter);
+    }
+}
+
+void EndstoneScoreboard::sendViewerScores(const EndstonePlayer &viewer, ViewerScores &viewer_scores)
+{
+    SetScorePacket change;
+    change.action = SetScorePacket::Action::Change;
+    SetScorePacket remove;
+    remove.action = SetScorePacket::Action::Remove;
+
+    for (auto it = viewer_scores.scores.begin(); it != viewer_scores.scores.end();) {
+        auto &[name, scores] = *it;
+        auto *objective = board_.getObjective(name);
+        if (!objective || scores.empty()) {
+            it = viewer_scores.scores.erase(it);
+            continue;
+        }
+        ++it;
+
+        if (!isDisplayed(board_, *objective)) {
+            continue;
+        }
+        for (const auto &[id, value] : scores) {
+            auto *id_ref = board_.getScoreboardIdentityRef(id);
+            SetScorePacket::Entry entry;
+            if (id_ref && toPacketEntry(*id_ref, entry)) {
+                entry.objective_name = name;
+                entry.score = value;
+                change.entries.push_back(std::move(entry));
+            }
+        }
+    }
+
+    // Overrides that were removed are replaced by the shared score, or removed if there is none
+    for (const auto &[name, ids] : viewer_scores.reset) {
+        auto *objective = board_.getObjective(name);
+        if (!objective || !isDisplayed(board_, *objective)) {
+            continue;
+        }
+        for (const auto &id : ids) {
+            auto *id_ref = board_.getScoreboardIdentityRef(id);
+            const auto score = objective->getPlayerScore(id);
+            SetScorePacket::Entry entry;
+            if (id_ref && score.valid && toPacketEntry(*id_ref, entry)) {
+                entry.objective_name = name;
+                entry.score = score.value;
+                change.entries.push_back(std::move(entry));
+            }
+            else {
+                entry.scoreboard_id = id.raw_id;
+                entry.objective_name = name;
+                remove.entries.push_back(std::move(entry));
+            }
+        }
+    }
+    viewer_scores.reset.clear();
+    viewer_scores.dirty = false;
+
+    if (!remove.entries.empty()) {
+        PacketAdapter adapter{remove};
+        packet_sender_->sendToViewer(viewer, adapter);
+    }
+    if (!change.entries.empty()) {
+        PacketAdapter adapter{change};
+        packet_sender_->sendToViewer(viewer, adapter);
+    }
+}
+
 }  // namespace endstone::detail
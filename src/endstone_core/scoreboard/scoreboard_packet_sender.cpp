@@ -14,6 +14,7 @@
 
 #include "endstone/detail/scoreboard/scoreboard_packet_sender.h"
 
+#include "endstone/detail/scoreboard/scoreboard.h"
 #include "endstone/detail/server.h"
 
 namespace endstone::detail {
@@ -36,37 +37,24 @@ void ScoreboardPacketSender::sendToServer(::Packet &packet)
 
 void ScoreboardPacketSender::sendToClient(const UserEntityIdentifierComponent *user_identifider, const ::Packet &packet)
 {
-    auto uuid = user_identifider->uuid.toEndstone();
-    auto *player = server_.getPlayer(uuid);
-    if (!player) {
+    if (suppressed_) {
         return;
     }
-
-    if (&player->getScoreboard() != &scoreboard_) {
+    if (viewers_.find({user_identifider->network_id, user_identifider->sub_client_id}) == viewers_.end()) {
         return;
     }
-
+    scoreboard_.invalidateSentScores();
     sender_.sendToClient(user_identifider, packet);
 }
 
 void ScoreboardPacketSender::sendToClient(const NetworkIdentifier &network_identifier, const ::Packet &packet,
                                           SubClientId sub_id)
 {
-    for (const auto &item : server_.getOnlinePlayers()) {
-        auto *player = static_cast<EndstonePlayer *>(item);
-
-        if (&player->getScoreboard() != &scoreboard_) {
-            continue;
-        }
-
-        auto user_identifier = player->getHandle().getPersistentComponent<UserEntityIdentifierComponent>();
-        if (user_identifier->network_id != network_identifier || user_identifier->sub_client_id != sub_id) {
-            continue;
-        }
-
-        sender_.sendToClient(network_identifier, packet, sub_id);
-        break;
+    if (suppressed_ || viewers_.find({network_identifier, sub_id}) == viewers_.end()) {
+        return;
     }
+    scoreboard_.invalidateSentScores();
+    sender_.sendToClient(network_identifier, packet, sub_id);
 }
 
 void ScoreboardPacketSender::sendToClients(
@@ -77,15 +65,29 @@ void ScoreboardPacketSender::sendToClients(
 
 void ScoreboardPacketSender::sendBroadcast(const ::Packet &packet)
 {
-    for (const auto &item : server_.getOnlinePlayers()) {
-        auto *player = static_cast<EndstonePlayer *>(item);
+    if (suppressed_) {
+        return;
+    }
+    scoreboard_.invalidateSentScores();
+    sendToViewers(packet);
+}
 
-        if (&player->getScoreboard() != &scoreboard_) {
-            continue;
-        }
+void ScoreboardPacketSender::sendToViewer(const EndstonePlayer &player, const ::Packet &packet)
+{
+    auto it = viewer_ids_.find(&player);
+    if (it != viewer_ids_.end()) {
+        sender_.sendToClient(it->second.network_identifier, packet, it->second.sub_id);
+    }
+}
 
-        auto user_identifier = player->getHandle().getPersistentComponent<UserEntityIdentifierComponent>();
-        sender_.sendToClient(user_identifier, packet);
+void ScoreboardPacketSender::sendToViewers(const ::Packet &packet)
+{
+    // Sent to all viewers of this scoreboard at once, so the packet is serialized a single time
+    if (!broadcast_targets_.has_value()) {
+        broadcast_targets_.emplace(viewers_.begin(), viewers_.end());
+    }
+    if (!broadcast_targets_->empty()) {
+        sender_.sendToClients(*broadcast_targets_, packet);
     }
 }
 
@@ -99,4 +101,45 @@ void ScoreboardPacketSender::flush(const NetworkIdentifier &network_identifier,
     sender_.flush(network_identifier, std::forward<decltype(callback)>(callback));
 }
 
+void ScoreboardPacketSender::setSuppressed(bool suppressed)
+{
+    suppressed_ = suppressed;
+}
+
+void ScoreboardPacketSender::addViewer(const EndstonePlayer &player)
+{
+    const auto *component = player.getHandle().getPersistentComponent<UserEntityIdentifierComponent>();
+    NetworkIdentifierWithSubId viewer{component->network_id, component->sub_client_id};
+    if (viewer_ids_.emplace(&player, viewer).second) {
+        viewers_.insert(viewer);
+        broadcast_targets_.reset();
+    }
+}
+
+void ScoreboardPacketSender::removeViewer(const EndstonePlayer &player)
+{
+    // Looked up by player, as the player's components may already be gone when it is being destroyed
+    auto it = viewer_ids_.find(&player);
+    if (it == viewer_ids_.end()) {
+        return;
+    }
+    viewers_.erase(it->second);
+    viewer_ids_.erase(it);
+    broadcast_targets_.reset();
+    scoreboard_.clearViewerScores(player);
+}
+
+std::size_t ScoreboardPacketSender::ViewerHash::operator()(const NetworkIdentifierWithSubId &viewer) const
+{
+    // Only RakNet connections carry a guid; others fall through to the equality check
+    return std::hash<std::uint64_t>{}(viewer.network_identifier.guid.g) ^
+           (static_cast<std::size_t>(viewer.sub_id) << 1);
+}
+
+bool ScoreboardPacketSender::ViewerEqual::operator()(const NetworkIdentifierWithSubId &lhs,
+                                                     const NetworkIdentifierWithSubId &rhs) const
+{
+    return lhs.sub_id == rhs.sub_id && lhs.network_identifier == rhs.network_identifier;
+}
+
 }  // namespace endstone::detail
@@ -14,30 +14,60 @@
 
 #include "endstone/detail/server.h"
 
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
 #include <filesystem>
+#include <iterator>
 #include <memory>
+#include <stdexcept>
+#include <thread>
 
 namespace fs = std::filesystem;
 
-#include <boost/algorithm/string.hpp>
-
 #include "bedrock/common/game_version.h"
 #include "bedrock/core/threading.h"
+#include "bedrock/entity/components/user_entity_identifier_component.h"
+#include "bedrock/locale/i18n.h"
+#include "bedrock/network/packet_sender.h"
 #include "bedrock/network/server_network_handler.h"
 #include "bedrock/world/actor/player/player.h"
 #include "bedrock/world/scores/server_scoreboard.h"
 #include "endstone/color_format.h"
 #include "endstone/command/plugin_command.h"
+#include "endstone/detail/block/block.h"
 #include "endstone/detail/boss/boss_bar.h"
 #include "endstone/detail/command/command_map.h"
+#include "endstone/detail/command/command_output_capture.h"
 #include "endstone/detail/command/console_command_sender.h"
+#include "endstone/detail/inventory/player_inventory.h"
+#include "endstone/detail/level/dimension.h"
 #include "endstone/detail/level/level.h"
 #include "endstone/detail/logger_factory.h"
+#include "endstone/detail/memory_usage.h"
+#include "endstone/detail/messaging/player_handoff.h"
+#include "endstone/detail/messaging/udp_multicast_transport.h"
+#include "endstone/detail/metrics/metrics_registry.h"
+#include "endstone/detail/network/chunk_radius_handler.h"
+#include "endstone/detail/network/packet_statistics.h"
+#include "endstone/detail/os.h"
+#include "endstone/detail/network/packet_adapter.h"
 #include "endstone/detail/permissions/default_permissions.h"
 #include "endstone/detail/plugin/cpp_plugin_loader.h"
 #include "endstone/detail/plugin/python_plugin_loader.h"
+#include "endstone/detail/startup_timings.h"
+#include "endstone/event/player/async_player_chat_event.h"
+#include "endstone/event/player/player_batch_move_event.h"
+#include "endstone/event/player/player_move_event.h"
+#include "endstone/event/player/player_region_enter_event.h"
+#include "endstone/event/player/player_region_leave_event.h"
 #include "endstone/event/server/broadcast_message_event.h"
+#include "endstone/event/server/player_handoff_event.h"
 #include "endstone/event/server/server_load_event.h"
+#include "endstone/network/text_packet.h"
 #include "endstone/plugin/plugin.h"
 
 #if !defined(ENDSTONE_VERSION)
@@ -46,11 +76,107 @@ namespace fs = std::filesystem;
 
 namespace endstone::detail {
 
+namespace {
+// Handing all recipients to the packet sender at once lets the network system serialize the packet a single time
+template <typename Players>
+std::vector<NetworkIdentifierWithSubId> getNetworkTargets(const Players &players)
+{
+    std::vector<NetworkIdentifierWithSubId> targets;
+    targets.reserve(players.size());
+    for (const auto *player : players) {
+        const auto *component = static_cast<const EndstonePlayer *>(player)
+                                    ->getHandle()
+                                    .getPersistentComponent<UserEntityIdentifierComponent>();
+        targets.push_back({component->network_id, component->sub_client_id});
+    }
+    return targets;
+}
+
+/**
+ * The metrics of the server. Tick metrics are updated every tick, the others every second.
+ */
+struct ServerMetrics {
+    MetricsRegistry &registry = MetricsRegistry::getInstance();
+    Counter &ticks = registry.counter("endstone_ticks_total", "Ticks run by the server.");
+    Histogram &tick_duration = registry.histogram("endstone_tick_duration_seconds", "Duration of a server tick.",
+                                                  {0.005, 0.01, 0.025, 0.05, 0.075, 0.1, 0.25, 0.5, 1.0, 2.5});
+    Gauge &ticks_per_second = registry.gauge("endstone_ticks_per_second", "Average ticks per second.");
+    Gauge &tick_usage = registry.gauge("endstone_tick_usage_ratio", "Average share of the tick budget used.");
+    Gauge &players = registry.gauge("endstone_players_online", "Players online.");
+    Gauge &open_forms = registry.gauge("endstone_open_forms", "Forms sent to players and not answered yet.");
+    Gauge &deferred_tasks = registry.gauge("endstone_scheduler_deferred_tasks", "Tasks waiting for a later tick.");
+    Gauge &bytes_sent = registry.gauge("endstone_network_sent_bytes_per_second", "Bytes sent to players per second.");
+    Gauge &bytes_received =
+        registry.gauge("endstone_network_received_bytes_per_second", "Bytes received from players per second.");
+    Counter &packets_received = registry.counter("endstone_network_packets_received_total", "Packets received.");
+    Counter &packet_bytes_received =
+        registry.counter("endstone_network_packet_received_bytes_total", "Bytes of the packets received.");
+    Gauge &compression_threshold = registry.gauge("endstone_network_compression_threshold_bytes",
+                                                  "Size under which the packets sent by the API are not compressed.");
+    Counter &packets_uncompressed =
+        registry.counter("endstone_network_packets_sent_uncompressed_total", "Packets sent by the API uncompressed.");
+    Gauge &memory = registry.gauge("endstone_process_resident_memory_bytes", "Physical memory used by the server.");
+    Gauge &idle = registry.gauge("endstone_idle", "Whether the level ticks less often as no player is online.");
+    Counter &idle_skipped_ticks =
+        registry.counter("endstone_idle_skipped_ticks_total", "Ticks on which the level did not tick while idle.");
+    std::uint64_t last_packets_received = 0;  // PacketStatistics keeps totals, the counters are given the increase
+    std::uint64_t last_packet_bytes_received = 0;
+    std::uint64_t last_packets_uncompressed = 0;
+    std::uint64_t last_idle_skipped_ticks = 0;
+
+    static ServerMetrics &getInstance()
+    {
+        static ServerMetrics instance;
+        return instance;
+    }
+};
+
+// A remote console sending commands faster than this has the rest run on the following ticks
+constexpr std::size_t MaxRconCommandsPerTick = 32;
+
+/**
+ * Splits an address such as 0.0.0.0:9464 or [::1]:9464, as given to ENDSTONE_METRICS_ADDRESS, into a host and a port.
+ */
+std::optional<std::pair<std::string, std::uint16_t>> parseAddress(std::string_view address)
+{
+    const auto colon = address.rfind(':');
+    if (colon == std::string_view::npos) {
+        return std::nullopt;
+    }
+    auto host = address.substr(0, colon);
+    if (host.size() >= 2 && host.front() == '[' && host.back() == ']') {
+        host = host.substr(1, host.size() - 2);
+    }
+    const auto port_text = address.substr(colon + 1);
+    std::uint16_t port = 0;
+    auto [end, ec] = std::from_chars(port_text.data(), port_text.data() + port_text.size(), port);
+    if (host.empty() || ec != std::errc() || end != port_text.data() + port_text.size()) {
+        return std::nullopt;
+    }
+    return std::pair{std::string(host), port};
+}
+}  // namespace
+
 EndstoneServer::EndstoneServer(ServerInstance &server_instance)
     : server_instance_(server_instance), logger_(LoggerFactory::getLogger("Server"))
 {
     plugin_manager_ = std::make_unique<EndstonePluginManager>(*this);
     scheduler_ = std::make_unique<EndstoneScheduler>(*this);
+    auto player_data_path = fs::current_path() / "player_data" / "player_data.log";
+    player_data_store_ = std::make_unique<EndstonePlayerDataStore>(scheduler_->getExecutor(AsyncExecutor::Io),
+                                                                   getLogger(), std::move(player_data_path));
+    const auto *server_id = std::getenv("ENDSTONE_SERVER_ID");
+    packet_interceptor_ = std::make_unique<EndstonePacketInterceptor>();
+    packet_priorities_.fill(PacketPriority::Normal);
+    // Movement and removals keep the world in sync, toasts and particles are cosmetic
+    packet_priorities_[static_cast<int>(PacketType::MoveActorAbsolute)] = PacketPriority::Critical;
+    packet_priorities_[static_cast<int>(PacketType::RemoveActor)] = PacketPriority::Critical;
+    packet_priorities_[static_cast<int>(PacketType::ToastRequest)] = PacketPriority::Bulk;
+    packet_priorities_[static_cast<int>(PacketType::SpawnParticleEffect)] = PacketPriority::Bulk;
+    messenger_ = std::make_unique<EndstoneMessenger>(scheduler_->getExecutor(AsyncExecutor::Io), getLogger(),
+                                                     server_id ? server_id : "");
+    messenger_->subscribeServer(PlayerHandoff::getChannel(messenger_->getServerId()),
+                                [this](const auto &, const auto &message) { receivePlayerHandoff(message); });
     start_time_ = std::chrono::system_clock::now();
 }
 
@@ -61,6 +187,106 @@ void EndstoneServer::init()
                      getName(), getVersion(), getMinecraftVersion());
     command_sender_ = std::make_unique<EndstoneConsoleCommandSender>();
     command_sender_->recalculatePermissions();
+
+    // ENDSTONE_CONSOLE=vanilla leaves the standard input to the server, without line editing
+    if (const auto *console = std::getenv("ENDSTONE_CONSOLE"); !console || std::string_view(console) != "vanilla") {
+        console_reader_ = ConsoleReader::forStandardInput(LoggerFactory::getConsoleSink().get());
+    }
+    if (const auto *address = std::getenv("ENDSTONE_METRICS_ADDRESS")) {
+        startMetricsServer(address);
+    }
+    if (const auto *address = std::getenv("ENDSTONE_RCON_ADDRESS")) {
+        startRconServer(address);
+    }
+    if (const auto *address = std::getenv("ENDSTONE_MESSENGER_MULTICAST")) {
+        startMulticastMessaging(address);
+    }
+    if (const auto *path = std::getenv("ENDSTONE_REPLAY_RECORD")) {
+        replay_recorder_ = std::make_unique<ReplayRecorder>(path);
+        if (replay_recorder_->isOpen()) {
+            getLogger().info("Recording the inputs of the server to {}", path);
+        }
+        else {
+            getLogger().error("Unable to open the replay log {}.", path);
+            replay_recorder_.reset();
+        }
+    }
+    if (const auto *clock = std::getenv("ENDSTONE_SCHEDULER_CLOCK")) {
+        wall_clock_timers_ = std::string_view(clock) == "wall";
+    }
+    if (const auto *threshold = std::getenv("ENDSTONE_LOAD_SHEDDING_THRESHOLD")) {
+        scheduler_->setLoadSheddingThreshold(std::strtof(threshold, nullptr));
+    }
+    // The level only ticks once every so many ticks once the server has been empty for ENDSTONE_IDLE_AFTER seconds
+    if (const auto *interval = std::getenv("ENDSTONE_IDLE_TICK_INTERVAL")) {
+        const auto *after = std::getenv("ENDSTONE_IDLE_AFTER");
+        idle_throttle_ = IdleThrottle(static_cast<std::uint32_t>(std::strtoul(interval, nullptr, 10)),
+                                      after ? std::strtoull(after, nullptr, 10) * TargetTicksPerSecond
+                                            : DefaultIdleAfterTicks);
+    }
+    // The target tick usage, from 0 to 1, over which the view distance of the players is lowered
+    if (const auto *target = std::getenv("ENDSTONE_ADAPTIVE_VIEW_DISTANCE")) {
+        view_distance_controller_.emplace(std::strtof(target, nullptr));
+    }
+    // The size in bytes under which the packets sent by the API are not compressed, and the target tick usage over
+    // which it is raised
+    const auto *threshold = std::getenv("ENDSTONE_COMPRESSION_THRESHOLD");
+    const auto *target = std::getenv("ENDSTONE_ADAPTIVE_COMPRESSION");
+    if (threshold || target) {
+        compression_controller_.emplace(threshold ? std::strtoul(threshold, nullptr, 10) : 0,
+                                        target ? std::optional(std::strtof(target, nullptr)) : std::nullopt);
+    }
+}
+
+void EndstoneServer::startMetricsServer(const std::string &address)
+{
+    auto endpoint = parseAddress(address);
+    if (!endpoint) {
+        getLogger().error("Invalid metrics address '{}', expected host:port.", address);
+        return;
+    }
+    try {
+        metrics_server_ =
+            std::make_unique<MetricsServer>(MetricsRegistry::getInstance(), endpoint->first, endpoint->second);
+        getLogger().info("Serving metrics at http://{}/metrics", address);
+    }
+    catch (const std::exception &e) {
+        getLogger().error("Unable to start the metrics server. {}", e.what());
+    }
+}
+
+void EndstoneServer::startRconServer(const std::string &address)
+{
+    auto endpoint = parseAddress(address);
+    if (!endpoint) {
+        getLogger().error("Invalid RCON address '{}', expected host:port.", address);
+        return;
+    }
+    const auto *password = std::getenv("ENDSTONE_RCON_PASSWORD");
+    if (!password || std::string_view(password).empty()) {
+        getLogger().error("RCON is not started, ENDSTONE_RCON_PASSWORD must be set.");
+        return;
+    }
+    try {
+        rcon_server_ = std::make_unique<RconServer>(password, endpoint->first, endpoint->second);
+        getLogger().info("Serving RCON at {}", address);
+    }
+    catch (const std::exception &e) {
+        getLogger().error("Unable to start the RCON server. {}", e.what());
+    }
+}
+
+void EndstoneServer::startMulticastMessaging(const std::string &address)
+{
+    auto endpoint = parseAddress(address);
+    if (!endpoint) {
+        getLogger().error("Invalid multicast address '{}', expected group:port.", address);
+        return;
+    }
+    messenger_->setDefaultTransport([group = endpoint->first, port = endpoint->second]() {
+        return std::make_unique<UdpMulticastTransport>(group, port);
+    });
+    getLogger().info("Exchanging messages with the servers at {} as {}", address, messenger_->getServerId());
 }
 
 std::string EndstoneServer::getName() const
@@ -118,6 +344,9 @@ ConsoleCommandSender &EndstoneServer::getCommandSender() const
 
 bool EndstoneServer::dispatchCommand(CommandSender &sender, std::string command) const
 {
+    if (replay_recorder_) {
+        replay_recorder_->recordCommand(sender.getName(), command);
+    }
     auto origin = CommandOrigin::fromEndstone(sender);
     CommandContext ctx{command, std::move(origin), CommandVersion::CurrentVersion};
     auto result = getMinecraftCommands().executeCommand(ctx, true);
@@ -126,11 +355,17 @@ bool EndstoneServer::dispatchCommand(CommandSender &sender, std::string command)
 
 void EndstoneServer::loadPlugins()
 {
-    plugin_manager_->registerLoader(std::make_unique<CppPluginLoader>(*this));
-    plugin_manager_->registerLoader(std::make_unique<PythonPluginLoader>(*this));
-
     auto plugin_dir = fs::current_path() / "plugins";
 
+    StartupTimer timer{"Plugin loading"};
+    plugin_manager_->registerLoader(std::make_unique<CppPluginLoader>(*this));
+    if (PythonPluginLoader::hasPlugins(plugin_dir.string())) {
+        plugin_manager_->registerLoader(std::make_unique<PythonPluginLoader>(*this));
+    }
+    else {
+        getLogger().debug("No Python plugins found, the Python interpreter is not started.");
+    }
+
     if (exists(plugin_dir)) {
         plugin_manager_->loadPlugins(plugin_dir.string());
     }
@@ -146,6 +381,7 @@ void EndstoneServer::enablePlugins(PluginLoadOrder type)
         DefaultPermissions::registerCorePermissions();
     }
 
+    StartupTimer timer{type == PluginLoadOrder::Startup ? "Plugin enabling (startup)" : "Plugin enabling (postworld)"};
     auto plugins = plugin_manager_->getPlugins();
     for (auto *plugin : plugins) {
         if (!plugin->isEnabled() && plugin->getDescription().getLoad() == type) {
@@ -166,11 +402,20 @@ void EndstoneServer::enablePlugin(Plugin &plugin)
     plugin_manager_->dirtyPermissibles(true);
     plugin_manager_->dirtyPermissibles(false);
     plugin_manager_->enablePlugin(plugin);
+    crafting_data_cache_.clear();
 }
 
 void EndstoneServer::disablePlugins() const
 {
     plugin_manager_->disablePlugins();
+    if (level_) {
+        // Plugins are disabled when the server thread stops, before the level and its chunk sources are destroyed
+        for (auto *dimension : level_->getDimensions()) {
+            static_cast<EndstoneDimension *>(dimension)->onLeaveGame();
+        }
+    }
+    player_data_store_->close();
+    messenger_->close();
 }
 
 Scheduler &EndstoneServer::getScheduler() const
@@ -178,24 +423,55 @@ Scheduler &EndstoneServer::getScheduler() const
     return *scheduler_;
 }
 
+PlayerDataStore &EndstoneServer::getPlayerDataStore() const
+{
+    return *player_data_store_;
+}
+
+Messenger &EndstoneServer::getMessenger() const
+{
+    return *messenger_;
+}
+
+EndstonePacketInterceptor &EndstoneServer::getPacketInterceptor() const
+{
+    return *packet_interceptor_;
+}
+
+PacketPriority EndstoneServer::getPacketPriority(int packet_id) const
+{
+    if (packet_id < 0 || static_cast<std::size_t>(packet_id) >= packet_priorities_.size()) {
+        return PacketPriority::Normal;
+    }
+    return packet_priorities_[packet_id];
+}
+
+void EndstoneServer::setPacketPriority(int packet_id, PacketPriority priority)
+{
+    if (packet_id < 0 || static_cast<std::size_t>(packet_id) >= packet_priorities_.size()) {
+        throw std::invalid_argument("Packet id must be between 0 and 1023");
+    }
+    packet_priorities_[packet_id] = priority;
+}
+
 Level *EndstoneServer::getLevel() const
 {
     return level_.get();
 }
 
+int EndstoneServer::getBlockTypeId(std::string_view type) const
+{
+    return EndstoneBlock::getTypeIds().find(type);
+}
+
 void EndstoneServer::setLevel(std::unique_ptr<EndstoneLevel> level)
 {
     level_ = std::move(level);
 }
 
-std::vector<Player *> EndstoneServer::getOnlinePlayers() const
+const std::vector<Player *> &EndstoneServer::getOnlinePlayers() const
 {
-    std::vector<Player *> result;
-    result.reserve(players_.size());
-    for (const auto &[id, player] : players_) {
-        result.push_back(player);
-    }
-    return result;
+    return online_players_;
 }
 
 int EndstoneServer::getMaxPlayers() const
@@ -229,14 +505,108 @@ Player *EndstoneServer::getPlayer(endstone::UUID id) const
 
 Player *EndstoneServer::getPlayer(std::string name) const
 {
-    for (const auto &[_, player] : players_) {
-        if (boost::iequals(player->getName(), name)) {
-            return player;
-        }
+    auto it = player_names_.find(foldPlayerName(std::move(name)));
+    if (it != player_names_.end()) {
+        return it->second;
     }
     return nullptr;
 }
 
+Player *EndstoneServer::getPlayerByXuid(const std::string &xuid) const
+{
+    auto it = player_xuids_.find(xuid);
+    if (it != player_xuids_.end()) {
+        return it->second;
+    }
+    return nullptr;
+}
+
+Player *EndstoneServer::getPlayerByRuntimeId(std::uint64_t runtime_id) const
+{
+    auto it = player_runtime_ids_.find(runtime_id);
+    if (it != player_runtime_ids_.end()) {
+        return it->second;
+    }
+    return nullptr;
+}
+
+void EndstoneServer::addPlayer(EndstonePlayer &player)
+{
+    players_.emplace(player.getUniqueId(), &player);
+    online_players_.push_back(&player);
+    player_names_.emplace(foldPlayerName(player.getName()), &player);
+    // Players in offline mode have no XUID
+    if (auto xuid = player.getXuid(); !xuid.empty()) {
+        player_xuids_.emplace(std::move(xuid), &player);
+    }
+    player_runtime_ids_.emplace(player.getRuntimeId(), &player);
+    player.movement_slot_ = movement_tracker_.addSlot();
+    movement_players_.resize(movement_tracker_.getCapacity());
+    movement_players_[player.movement_slot_] = &player;
+    // Readers on other threads never see a player without a snapshot
+    player.publishSnapshot(current_tick_);
+}
+
+void EndstoneServer::removePlayer(EndstonePlayer &player)
+{
+    players_.erase(player.getUniqueId());
+    move_origins_.erase(&player);
+    movement_tracker_.removeSlot(player.movement_slot_);
+    movement_players_[player.movement_slot_] = nullptr;
+    region_memberships_.erase(&player);
+    online_players_.erase(std::remove(online_players_.begin(), online_players_.end(), &player), online_players_.end());
+    onActorRemoved(player.getRuntimeId());
+    auto it = player_names_.find(foldPlayerName(player.getName()));
+    if (it != player_names_.end() && it->second == &player) {
+        player_names_.erase(it);
+    }
+    if (auto xuid = player_xuids_.find(player.getXuid()); xuid != player_xuids_.end() && xuid->second == &player) {
+        player_xuids_.erase(xuid);
+    }
+    player_runtime_ids_.erase(player.getRuntimeId());
+}
+
+void EndstoneServer::handOffPlayer(const EndstonePlayer &player, const std::string &server_id)
+{
+    PlayerHandoff handoff;
+    handoff.player_id = player.getUniqueId();
+    handoff.player_name = player.getName();
+    handoff.source_server_id = messenger_->getServerId();
+    handoff.entries = player_data_store_->getPlayerEntries(handoff.player_id);
+    messenger_->publish(PlayerHandoff::getChannel(server_id), handoff.encode());
+}
+
+void EndstoneServer::receivePlayerHandoff(const std::string &message)
+{
+    auto handoff = PlayerHandoff::decode(message);
+    if (!handoff) {
+        getLogger().warning("Ignored a player handoff that could not be read.");
+        return;
+    }
+    // The player may have changed the values here since, they are newer than the ones handed off
+    if (players_.find(handoff->player_id) != players_.end()) {
+        getLogger().warning("The handoff of {} from {} arrived after the player joined, it is ignored.",
+                            handoff->player_name, handoff->source_server_id);
+        return;
+    }
+    player_data_store_->replacePlayerEntries(handoff->player_id, handoff->entries);
+    PlayerHandoffEvent event{handoff->player_id, handoff->player_name, handoff->source_server_id};
+    getPluginManager().callEvent(event);
+}
+
+std::string EndstoneServer::resolveTranslation(const std::string &key, const std::vector<std::string> &params,
+                                               const std::string &locale)
+{
+    auto &i18n = getI18n();
+    return i18n.get(key, params, locale.empty() ? nullptr : i18n.getLocaleFor(locale));
+}
+
+std::string EndstoneServer::foldPlayerName(std::string name)
+{
+    std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
+    return name;
+}
+
 void EndstoneServer::shutdown()
 {
     static_cast<EndstoneScheduler &>(getScheduler()).runTask([this]() {
@@ -257,24 +627,191 @@ void EndstoneServer::reload()
     ServerLoadEvent event{ServerLoadEvent::LoadType::Reload};
     getPluginManager().callEvent(event);
 
-    // sync commands
-    for (const auto &[uuid, player] : players_) {
-        player->updateCommands();
+    // sync commands, spread over the next ticks
+    pending_command_updates_.clear();
+    for (const auto *player : online_players_) {
+        pending_command_updates_.push_back(player->getUniqueId());
+    }
+}
+
+Plugin *EndstoneServer::reloadPlugin(Plugin &plugin)
+{
+    // The callbacks of a backup refer to the plugin and finish on this thread, they cannot be waited for here
+    if (level_ && level_->isBackupRunning()) {
+        logger_.error("Plugin {} cannot be reloaded while a backup is running.", plugin.getName());
+        return nullptr;
+    }
+
+    auto commands = plugin.getDescription().getCommands();
+
+    // Nothing may run the code of the plugin once its library is closed, so its async work is waited for first
+    plugin_manager_->disablePlugin(plugin);
+    const auto deadline = std::chrono::steady_clock::now() + PluginWorkTimeout;
+    if (!scheduler_->releaseTasks(plugin, deadline) || !awaitAsyncChat(deadline)) {
+        logger_.error("Plugin {} still has work running and is left disabled instead of being reloaded.",
+                      plugin.getName());
+        return nullptr;
+    }
+
+    // The commands go first, their executors may live in the library of the plugin
+    command_map_->removePluginCommands(plugin);
+    auto *reloaded = plugin_manager_->reloadPlugin(plugin);
+    if (reloaded) {
+        command_map_->addPluginCommands(*reloaded);
+        enablePlugin(*reloaded);
+        auto new_commands = reloaded->getDescription().getCommands();
+        commands.insert(commands.end(), new_commands.begin(), new_commands.end());
+    }
+
+    if (plugin_manager_->hasDirtyPermissibles()) {
+        plugin_manager_->recalculateDirtyPermissibles();
+    }
+    for (const auto *player : online_players_) {
+        const auto can_use = [player](const Command &command) { return command.testPermissionSilently(*player); };
+        if (std::any_of(commands.begin(), commands.end(), can_use)) {
+            pending_command_updates_.push_back(player->getUniqueId());
+        }
+    }
+    return reloaded;
+}
+
+void EndstoneServer::onPlayerJoin()
+{
+    if (join_storm_.onJoin(current_tick_)) {
+        logger_.warning("{} players joined within {} seconds, command updates are spread over the next ticks.",
+                        join_storm_.getJoinCount(), JoinStormWindowTicks / TargetTicksPerSecond);
+    }
+}
+
+void EndstoneServer::requestCommandUpdate(const EndstonePlayer &player)
+{
+    if (!join_storm_.isActive()) {
+        player.updateCommands();
+        return;
+    }
+    pending_command_updates_.push_back(player.getUniqueId());
+}
+
+void EndstoneServer::submitAsyncChat(const EndstonePlayer &player, std::string message,
+                                     std::function<void(std::string)> deliver)
+{
+    auto id = next_chat_id_++;
+    pending_chats_[id].deliver = std::move(deliver);
+    scheduler_->getExecutor(AsyncExecutor::Cpu)
+        .submit([plugin_manager = plugin_manager_.get(), results = chat_results_, id, player_id = player.getUniqueId(),
+                 player_name = player.getName(), message = std::move(message)]() mutable {
+            AsyncPlayerChatEvent e{player_id, std::move(player_name), std::move(message)};
+            plugin_manager->callEvent(e);
+            results->push({id, e.isCancelled() ? std::nullopt : std::make_optional(e.getMessage())});
+        });
+}
+
+void EndstoneServer::collectAsyncChat()
+{
+    for (auto &result : chat_results_->drain()) {
+        if (auto it = pending_chats_.find(result.id); it != pending_chats_.end()) {
+            it->second.result = std::move(result);
+        }
+    }
+}
+
+bool EndstoneServer::awaitAsyncChat(std::chrono::steady_clock::time_point deadline)
+{
+    const auto filtering = [this]() {
+        collectAsyncChat();
+        return std::any_of(pending_chats_.begin(), pending_chats_.end(),
+                           [](const auto &chat) { return !chat.second.result; });
+    };
+    while (filtering()) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+void EndstoneServer::deliverAsyncChat()
+{
+    collectAsyncChat();
+
+    // A message still being filtered holds back the ones sent after it, so chat keeps its order
+    while (!pending_chats_.empty() && pending_chats_.begin()->second.result) {
+        auto chat = std::move(pending_chats_.begin()->second);
+        pending_chats_.erase(pending_chats_.begin());
+        if (chat.result->message) {
+            chat.deliver(std::move(*chat.result->message));
+        }
+    }
+}
+
+void EndstoneServer::updatePendingCommands()
+{
+    if (join_storm_.tick(current_tick_)) {
+        logger_.info("Join storm over, {} players joined in {} seconds.", join_storm_.getJoinCount(),
+                     (current_tick_ - join_storm_.getStartTick()) / TargetTicksPerSecond);
+    }
+    for (int i = 0; i < CommandUpdatesPerTick && !pending_command_updates_.empty(); ++i) {
+        if (auto *player = getPlayer(pending_command_updates_.front())) {
+            player->updateCommands();
+        }
+        pending_command_updates_.pop_front();
+    }
+}
+
+void EndstoneServer::runDeferredCommands(std::uint64_t current_tick)
+{
+    auto &rate_limiter = command_map_->getRateLimiter();
+    if (current_tick % CommandRateLimiter::ReportIntervalTicks == 0) {
+        for (const auto &violation : rate_limiter.takeViolations()) {
+            getLogger().warning("{} went over its command budget in the last {} ticks: {} deferred, {} dropped",
+                                violation.origin, CommandRateLimiter::ReportIntervalTicks, violation.deferred,
+                                violation.dropped);
+        }
+    }
+    rate_limiter.startTick();
+}
+
+void EndstoneServer::runRconCommands()
+{
+    if (!rcon_server_) {
+        return;
+    }
+    for (const auto &command : rcon_server_->takeCommands(MaxRconCommandsPerTick)) {
+        getLogger().info("{} issued server command over RCON: {}", command.remote_address, command.command);
+        CommandOutputCapture capture;
+        dispatchCommand(getCommandSender(), command.command);
+        command.respond(capture.getOutput());
     }
 }
 
 void EndstoneServer::reloadData()
 {
+    {
+        std::lock_guard lock{translation_mutex_};
+        translation_cache_.clear();
+    }
+    crafting_data_cache_.clear();
     server_instance_.getMinecraft().requestResourceReload();
     level_->getHandle().loadFunctionManager();
 }
 
 void EndstoneServer::broadcast(const std::string &message, const std::string &permission) const
 {
+    if (plugin_manager_->hasDirtyPermissibles()) {
+        plugin_manager_->recalculateDirtyPermissibles();
+    }
+
+    // Checking a registered permission by reference saves copying its name for every subscriber
+    auto id = plugin_manager_->findPermissionId(permission);
+    const auto *perm = plugin_manager_->getPermissionById(id);
     std::unordered_set<const CommandSender *> recipients;
-    for (const auto *permissible : getPluginManager().getPermissionSubscriptions(permission)) {
+    for (const auto *permissible : plugin_manager_->getPermissionSubscribers(id)) {
         const auto *sender = permissible->asCommandSender();
-        if (sender != nullptr && sender->hasPermission(permission)) {
+        if (sender == nullptr) {
+            continue;
+        }
+        if (perm != nullptr ? sender->hasPermission(*perm) : sender->hasPermission(permission)) {
             recipients.insert(sender);
         }
     }
@@ -286,9 +823,25 @@ void EndstoneServer::broadcast(const std::string &message, const std::string &pe
         return;
     }
 
+    // Players share a single text packet serialized once for all of them, other senders get the message one by one
+    std::vector<const Player *> players;
+    players.reserve(recipients.size());
     for (const auto &recipient : recipients) {
-        recipient->sendMessage(event.getMessage());
+        if (const auto *player = recipient->asPlayer()) {
+            players.push_back(player);
+        }
+        else {
+            recipient->sendMessage(event.getMessage());
+        }
     }
+    if (players.empty()) {
+        return;
+    }
+
+    TextPacket packet;
+    packet.message = event.getMessage();
+    PacketAdapter pk{packet};
+    level_->getHandle().getPacketSender()->sendToClients(getNetworkTargets(players), pk);
 }
 
 void EndstoneServer::broadcastMessage(const std::string &message) const
@@ -296,11 +849,80 @@ void EndstoneServer::broadcastMessage(const std::string &message) const
     broadcast(message, BroadcastChannelUser);
 }
 
+void EndstoneServer::broadcastPacket(Packet &packet, const std::vector<Player *> &recipients) const
+{
+    if (recipients.empty()) {
+        return;
+    }
+
+    PacketAdapter pk{packet};
+    level_->getHandle().getPacketSender()->sendToClients(getNetworkTargets(recipients), pk);
+}
+
+void EndstoneServer::broadcastPacket(Packet &packet, const std::function<bool(const Player &)> &predicate) const
+{
+    std::vector<Player *> recipients;
+    recipients.reserve(players_.size());
+    for (const auto &[uuid, player] : players_) {
+        if (!predicate || predicate(*player)) {
+            recipients.push_back(player);
+        }
+    }
+    broadcastPacket(packet, recipients);
+}
+
+std::string EndstoneServer::translate(const Translatable &message, const std::string &locale) const
+{
+    std::lock_guard lock{translation_mutex_};
+    return translation_cache_.translate(message, locale);
+}
+
+void EndstoneServer::sendTranslated(const Translatable &message, const std::vector<Player *> &recipients) const
+{
+    std::unordered_map<std::string, std::vector<Player *>> groups;
+    for (auto *player : recipients) {
+        groups[player->getLocale()].push_back(player);
+    }
+
+    // One packet per locale, serialized once for every player of the group
+    for (const auto &[locale, players] : groups) {
+        TextPacket packet;
+        packet.message = translate(message, locale);
+        PacketAdapter pk{packet};
+        level_->getHandle().getPacketSender()->sendToClients(getNetworkTargets(players), pk);
+    }
+}
+
 bool EndstoneServer::isPrimaryThread() const
 {
     return Bedrock::Threading::getServerThread().isOnThread();
 }
 
+void EndstoneServer::flushScoreboards()
+{
+    if (scoreboard_) {
+        scoreboard_->flushScores();
+    }
+    for (auto it = scoreboards_.begin(); it != scoreboards_.end();) {
+        if (auto board = it->lock()) {
+            board->flushScores();
+            ++it;
+        }
+        else {
+            it = scoreboards_.erase(it);
+        }
+    }
+}
+
+void EndstoneServer::flushBossBars()
+{
+    auto boss_bars = std::move(dirty_boss_bars_);
+    dirty_boss_bars_.clear();
+    for (auto *boss_bar : boss_bars) {
+        boss_bar->flush();
+    }
+}
+
 Scoreboard *EndstoneServer::getScoreboard() const
 {
     return scoreboard_.get();
@@ -351,11 +973,47 @@ float EndstoneServer::getAverageTickUsage()
     return std::accumulate(average_usage_, average_usage_ + TargetTicksPerSecond, 0.0F) / TargetTicksPerSecond;
 }
 
+TickStatistics EndstoneServer::getTickStatistics(TickWindow window) const
+{
+    return tick_percentiles_.getStatistics(std::chrono::steady_clock::now(), window);
+}
+
+std::uint64_t EndstoneServer::getWallClockTick() const
+{
+    return tick_clock_.getTick();
+}
+
 std::chrono::system_clock::time_point EndstoneServer::getStartTime()
 {
     return start_time_;
 }
 
+void EndstoneServer::setTickConsistentActorReads(bool value)
+{
+    tick_consistent_actor_reads_ = value;
+}
+
+bool EndstoneServer::isTickConsistentActorReads() const
+{
+    return tick_consistent_actor_reads_;
+}
+
+void EndstoneServer::setPlayerMoveThresholds(float distance, float rotation)
+{
+    move_distance_threshold_ = std::max(0.0F, distance);
+    move_rotation_threshold_ = std::max(0.0F, rotation);
+}
+
+float EndstoneServer::getPlayerMoveDistanceThreshold() const
+{
+    return move_distance_threshold_;
+}
+
+float EndstoneServer::getPlayerMoveRotationThreshold() const
+{
+    return move_rotation_threshold_;
+}
+
 std::unique_ptr<BossBar> EndstoneServer::createBossBar(std::string title, BarColor color, BarStyle style) const
 {
     return std::make_unique<EndstoneBossBar>(std::move(title), color, style);
@@ -387,9 +1045,11 @@ void EndstoneServer::setPlayerBoard(EndstonePlayer &player, Scoreboard &scoreboa
 
     // remove player from the old board
     getPlayerBoard(player).resetScores(&player);
+    getPlayerBoard(player).getPacketSender().removeViewer(player);
 
     // add player to the new board
     new_board.onPlayerJoined(player.getHandle());
+    static_cast<EndstoneScoreboard &>(scoreboard).getPacketSender().addViewer(player);
 
     // update tracking records
     if (&scoreboard == scoreboard_.get()) {
@@ -400,32 +1060,479 @@ void EndstoneServer::setPlayerBoard(EndstonePlayer &player, Scoreboard &scoreboa
     }
 }
 
+void EndstoneServer::addPlayerBoard(EndstonePlayer &player)
+{
+    getPlayerBoard(player).getPacketSender().addViewer(player);
+}
+
 void EndstoneServer::removePlayerBoard(EndstonePlayer &player)
 {
+    getPlayerBoard(player).getPacketSender().removeViewer(player);
     player_boards_.erase(&player);
 }
 
+void EndstoneServer::addDirtyBossBar(EndstoneBossBar &boss_bar)
+{
+    dirty_boss_bars_.insert(&boss_bar);
+}
+
+void EndstoneServer::removeDirtyBossBar(EndstoneBossBar &boss_bar)
+{
+    dirty_boss_bars_.erase(&boss_bar);
+}
+
+void EndstoneServer::scheduleFormTimeout(const EndstonePlayer &player, int form_id)
+{
+    form_timeouts_.schedule({player.getUniqueId(), form_id}, current_tick_ + EndstonePlayer::FormTimeoutTicks);
+}
+
+std::size_t EndstoneServer::getOpenFormCount() const
+{
+    std::size_t count = 0;
+    for (auto *player : online_players_) {
+        count += static_cast<EndstonePlayer *>(player)->getOpenFormCount();
+    }
+    return count;
+}
+
+void EndstoneServer::expireForms(std::uint64_t current_tick)
+{
+    // Timeouts of forms that were answered in the meantime find nothing to drop
+    form_timeouts_.advance(current_tick, [this](std::pair<UUID, int> &timeout) {
+        if (auto *player = getPlayer(timeout.first); player) {
+            static_cast<EndstonePlayer *>(player)->onFormTimeout(timeout.second);
+        }
+    });
+}
+
 ::ServerNetworkHandler &EndstoneServer::getServerNetworkHandler() const
 {
     return *server_instance_.getMinecraft().getServerNetworkHandler();
 }
 
-void EndstoneServer::tick(std::uint64_t current_tick, const std::function<void()> &tick_function)
+void EndstoneServer::tick(std::uint64_t level_tick, const std::function<void()> &tick_function)
 {
     using namespace std::chrono;
 
     const auto tick_time = steady_clock::now();
+    // The level only advances its tick id when it ticks, which the idle throttle skips, so Endstone counts every call
+    const auto current_tick = current_tick_ == 0 ? level_tick : current_tick_ + 1;
+    current_tick_ = current_tick;
+    const auto wall_clock_tick = tick_clock_.update(current_tick, tick_time);
+    if (plugin_manager_->hasDirtyPermissibles()) {
+        plugin_manager_->recalculateDirtyPermissibles();
+    }
+    // Delays and periods of tasks count wall-clock ticks in this mode, timers keep time while the server lags
+    const auto scheduler_tick = wall_clock_timers_ ? wall_clock_tick : current_tick;
+    scheduler_->mainThreadHeartbeat(scheduler_tick);
+    runDeferredCommands(current_tick);
+    runRconCommands();
+    messenger_->tick();
+    const auto scheduler_time = steady_clock::now();
+    const auto was_idle = idle_throttle_.isIdle();
+    if (idle_throttle_.tick(online_players_.size())) {
+        tick_function();
+    }
+    if (idle_throttle_.isIdle() != was_idle) {
+        getLogger().info(was_idle ? "A player is online, the level ticks on every tick again."
+                                  : "No player is online, the level ticks less often until one joins.");
+    }
+    tick_arena_.reset();
+    const auto level_time = steady_clock::now();
+    dispatchPlayerMoves();
+    tickMovement();
+    dispatchPlayerRegions();
+    if (level_) {
+        level_->tick(current_tick_);
+    }
+    tickPregeneration();
+    tickInventories();
+    tickViewDistance();
+    tickCompression();
+    tickActorVisibility();
+    tickOutboundShaping();
+    deliverAsyncChat();
+    player_data_store_->tick(current_tick);
+    scheduler_->mainThreadPostTick(scheduler_tick);
+    flushScoreboards();
+    flushBossBars();
+    updatePendingCommands();
+    expireForms(current_tick);
+    // Commands packets carry the soft enums as of when they were serialized, they are kept until one changes
+    command_map_->refreshAvailableCommands();
+    publishPlayerSnapshots();
+    const auto end_time = steady_clock::now();
+    const TickHistory::Sample sample{scheduler_time - tick_time, level_time - scheduler_time, end_time - level_time};
+    tick_history_.push(sample);
+    if (replay_recorder_) {
+        replay_recorder_->recordTick(current_tick, sample);
+    }
+    tick_percentiles_.record(end_time, duration_cast<microseconds>(end_time - tick_time));
 
-    scheduler_->mainThreadHeartbeat(current_tick);
-    tick_function();
-
-    current_mspt_ = static_cast<float>(duration_cast<milliseconds>(steady_clock::now() - tick_time).count());
+    current_mspt_ = duration<float, std::milli>(end_time - tick_time).count();
     current_tps_ = std::min(static_cast<float>(TargetTicksPerSecond), 1000.0F / std::max(1.0F, current_mspt_));
     current_usage_ = std::min(1.0F, current_mspt_ / TargetMillisecondsPerTick);
     const auto idx = current_tick % TargetTicksPerSecond;
     average_mspt_[idx] = current_mspt_;
     average_tps_[idx] = current_tps_;
     average_usage_[idx] = current_usage_;
+    updateMetrics(current_tick, end_time - tick_time);
+
+    // Precise tasks that came due while the level ticked run now rather than at the start of the next tick
+    scheduler_->mainThreadRunPrecise();
+}
+
+void EndstoneServer::updateMetrics(std::uint64_t current_tick, std::chrono::steady_clock::duration tick_duration)
+{
+    auto &metrics = ServerMetrics::getInstance();
+    metrics.ticks.inc();
+    metrics.tick_duration.observe(std::chrono::duration<double>(tick_duration).count());
+    if (current_tick % TargetTicksPerSecond != 0) {
+        return;
+    }
+
+    metrics.ticks_per_second.set(getAverageTicksPerSecond());
+    metrics.tick_usage.set(getAverageTickUsage());
+    metrics.players.set(static_cast<double>(online_players_.size()));
+    metrics.open_forms.set(static_cast<double>(getOpenFormCount()));
+    metrics.deferred_tasks.set(static_cast<double>(scheduler_->getDeferredTaskCount()));
+    metrics.idle.set(idle_throttle_.isIdle() ? 1.0 : 0.0);
+    metrics.idle_skipped_ticks.inc(idle_throttle_.getSkippedTicks() -
+                                   std::min(idle_throttle_.getSkippedTicks(), metrics.last_idle_skipped_ticks));
+    metrics.last_idle_skipped_ticks = idle_throttle_.getSkippedTicks();
+    for (auto [type, name] : {std::pair{AsyncExecutor::Cpu, "cpu"}, std::pair{AsyncExecutor::Io, "io"},
+                              std::pair{AsyncExecutor::Python, "python"}}) {
+        const auto &executor = scheduler_->getExecutor(type);
+        metrics.registry.gauge("endstone_scheduler_queued_tasks", "Tasks queued on the workers.", {{"executor", name}})
+            .set(static_cast<double>(executor.getQueueDepth()));
+        metrics.registry.gauge("endstone_scheduler_workers", "Worker threads.", {{"executor", name}})
+            .set(static_cast<double>(executor.getThreadCount()));
+    }
+    for (std::size_t i = 0; i < static_cast<std::size_t>(MemorySubsystem::Count); ++i) {
+        const auto subsystem = static_cast<MemorySubsystem>(i);
+        // "Event handlers" is labelled event_handlers
+        std::string label{MemoryUsage::getName(subsystem)};
+        std::transform(label.begin(), label.end(), label.begin(),
+                       [](unsigned char c) { return c == ' ' ? '_' : static_cast<char>(std::tolower(c)); });
+        metrics.registry
+            .gauge("endstone_memory_estimated_bytes", "Memory held by a subsystem, estimated.", {{"subsystem", label}})
+            .set(static_cast<double>(MemoryUsage::getInstance().get(subsystem)));
+    }
+
+    double bytes_sent = 0;
+    double bytes_received = 0;
+    for (const auto *player : online_players_) {
+        const auto stats = player->getNetworkStats();
+        bytes_sent += stats.bytes_sent_per_second;
+        bytes_received += stats.bytes_received_per_second;
+    }
+    metrics.bytes_sent.set(bytes_sent);
+    metrics.bytes_received.set(bytes_received);
+
+    std::uint64_t packets = 0;
+    std::uint64_t packet_bytes = 0;
+    for (const auto &entry : PacketStatistics::getInstance().getReceived()) {
+        packets += entry.count;
+        packet_bytes += entry.bytes;
+    }
+    metrics.packets_received.inc(packets - std::min(packets, metrics.last_packets_received));
+    metrics.packet_bytes_received.inc(packet_bytes - std::min(packet_bytes, metrics.last_packet_bytes_received));
+    metrics.last_packets_received = packets;
+    metrics.last_packet_bytes_received = packet_bytes;
+    const auto uncompressed = PacketStatistics::getInstance().getUncompressedCount();
+    metrics.packets_uncompressed.inc(uncompressed - std::min(uncompressed, metrics.last_packets_uncompressed));
+    metrics.last_packets_uncompressed = uncompressed;
+    if (compression_controller_) {
+        metrics.compression_threshold.set(static_cast<double>(compression_controller_->getThreshold()));
+    }
+
+    metrics.memory.set(static_cast<double>(os::get_resident_memory()));
+    if (const auto allocator = os::get_allocator_stats()) {
+        metrics.registry
+            .gauge("endstone_allocator_committed_bytes", "Memory the allocator has mapped for its heaps.",
+                   {{"allocator", allocator->name}})
+            .set(static_cast<double>(allocator->committed));
+        if (allocator->allocated > 0) {
+            metrics.registry
+                .gauge("endstone_allocator_allocated_bytes", "Memory allocated from the allocator.",
+                       {{"allocator", allocator->name}})
+                .set(static_cast<double>(allocator->allocated));
+        }
+    }
+}
+
+void EndstoneServer::dispatchPlayerMoves()
+{
+    auto move_listeners = plugin_manager_->hasListeners<PlayerMoveEvent>();
+    auto batch_listeners = plugin_manager_->hasListeners<PlayerBatchMoveEvent>();
+    if (!move_listeners && !batch_listeners) {
+        // Start over from the current locations once someone listens again, rather than from stale ones
+        move_origins_.clear();
+        return;
+    }
+
+    std::vector<PlayerBatchMoveEvent::Movement> movements;
+    // Handlers may disconnect players, which removes them from the list, so index it instead of iterating
+    for (std::size_t i = 0; i < online_players_.size(); i++) {
+        auto *player = online_players_[i];
+        auto to = player->getLocation();
+        auto [it, inserted] = move_origins_.try_emplace(player, to);
+        if (inserted || !hasMoved(it->second, to)) {
+            continue;
+        }
+
+        auto from = std::exchange(it->second, to);
+        if (move_listeners) {
+            PlayerMoveEvent e{*player, from, to};
+            plugin_manager_->callEvent(e);
+            if (e.isCancelled() || e.isToChanged()) {
+                to = e.isCancelled() ? from : e.getTo();
+                player->teleport(to);
+                if (auto origin = move_origins_.find(player); origin != move_origins_.end()) {
+                    origin->second = to;
+                }
+            }
+            if (e.isCancelled()) {
+                continue;
+            }
+        }
+        if (batch_listeners) {
+            movements.push_back({player, from, to});
+        }
+    }
+
+    // Drop players that were disconnected by a handler further down the list
+    movements.erase(std::remove_if(movements.begin(), movements.end(),
+                                   [this](const auto &movement) { return !move_origins_.count(movement.player); }),
+                    movements.end());
+    if (!movements.empty()) {
+        PlayerBatchMoveEvent e{std::move(movements)};
+        plugin_manager_->callEvent(e);
+    }
+}
+
+bool EndstoneServer::hasMoved(const Location &from, const Location &to) const
+{
+    if (from.getDimension() != to.getDimension()) {
+        return true;
+    }
+    auto dx = to.getX() - from.getX();
+    auto dy = to.getY() - from.getY();
+    auto dz = to.getZ() - from.getZ();
+    if (dx * dx + dy * dy + dz * dz > move_distance_threshold_ * move_distance_threshold_) {
+        return true;
+    }
+    auto yaw = std::fmod(std::abs(to.getYaw() - from.getYaw()), 360.0F);
+    return std::abs(to.getPitch() - from.getPitch()) > move_rotation_threshold_ ||
+           std::min(yaw, 360.0F - yaw) > move_rotation_threshold_;
+}
+
+void EndstoneServer::dispatchPlayerRegions()
+{
+    if (!plugin_manager_->hasListeners<PlayerRegionEnterEvent>() &&
+        !plugin_manager_->hasListeners<PlayerRegionLeaveEvent>()) {
+        region_memberships_.clear();
+        return;
+    }
+
+    // Handlers may disconnect players, which removes them from the list, so index it instead of iterating
+    for (std::size_t i = 0; i < online_players_.size(); i++) {
+        auto *player = online_players_[i];
+        auto location = player->getLocation();
+        const auto *dimension = location.getDimension();
+        std::vector<std::string> regions;
+        if (dimension) {
+            regions = dimension->getRegionsAt(location.getX(), location.getY(), location.getZ());
+        }
+
+        auto &membership = region_memberships_.try_emplace(player, RegionMembership{dimension, {}}).first->second;
+        if (membership.dimension == dimension && membership.regions == regions) {
+            continue;
+        }
+
+        // Regions belong to a dimension, so changing dimension leaves all of them even if the names match
+        ArenaVector<std::string> left{ArenaAllocator<std::string>(tick_arena_)};
+        ArenaVector<std::string> entered{ArenaAllocator<std::string>(tick_arena_)};
+        if (membership.dimension != dimension) {
+            left.assign(std::make_move_iterator(membership.regions.begin()),
+                        std::make_move_iterator(membership.regions.end()));
+            entered.assign(regions.begin(), regions.end());
+        }
+        else {
+            std::set_difference(membership.regions.begin(), membership.regions.end(), regions.begin(), regions.end(),
+                                std::back_inserter(left));
+            std::set_difference(regions.begin(), regions.end(), membership.regions.begin(), membership.regions.end(),
+                                std::back_inserter(entered));
+        }
+        membership = {dimension, std::move(regions)};
+
+        for (auto &region : left) {
+            if (!region_memberships_.count(player)) {
+                break;
+            }
+            PlayerRegionLeaveEvent e{*player, std::move(region)};
+            plugin_manager_->callEvent(e);
+        }
+        for (auto &region : entered) {
+            if (!region_memberships_.count(player)) {
+                break;
+            }
+            PlayerRegionEnterEvent e{*player, std::move(region)};
+            plugin_manager_->callEvent(e);
+        }
+    }
+}
+
+void EndstoneServer::tickPregeneration()
+{
+    if (!level_) {
+        return;
+    }
+    // The usage of the last tick, as this one is still running
+    for (auto *dimension : level_->getDimensions()) {
+        static_cast<EndstoneDimension *>(dimension)->tickPregeneration(current_usage_);
+    }
+}
+
+void EndstoneServer::tickInventories()
+{
+    for (auto *player : online_players_) {
+        static_cast<EndstonePlayerInventory &>(player->getInventory()).tick();
+    }
+}
+
+void EndstoneServer::tickActorVisibility()
+{
+    if (current_tick_ % ActorVisibilityIntervalTicks != 0) {
+        return;
+    }
+    for (auto *player : online_players_) {
+        static_cast<EndstonePlayer *>(player)->updateActorVisibility();
+    }
+}
+
+void EndstoneServer::tickOutboundShaping()
+{
+    const auto now = OutboundShaper::Clock::now();
+    for (auto *player : online_players_) {
+        static_cast<EndstonePlayer *>(player)->tickOutboundShaping(now);
+    }
+}
+
+void EndstoneServer::onActorRemoved(std::uint64_t runtime_id)
+{
+    for (auto *player : online_players_) {
+        static_cast<EndstonePlayer *>(player)->actor_visibility_.forget(runtime_id);
+    }
+}
+
+void EndstoneServer::tickMovement()
+{
+    for (const auto *player : online_players_) {
+        const auto location = player->getLocation();
+        movement_tracker_.record(static_cast<const EndstonePlayer *>(player)->movement_slot_, location.getX(),
+                                 location.getY(), location.getZ(), static_cast<int>(player->getDimension().getType()));
+    }
+    movement_tracker_.advance();
+}
+
+void EndstoneServer::publishPlayerSnapshots()
+{
+    for (auto *player : online_players_) {
+        static_cast<EndstonePlayer *>(player)->publishSnapshot(current_tick_);
+    }
+}
+
+void EndstoneServer::resetMovement(const EndstonePlayer &player)
+{
+    movement_tracker_.reset(player.movement_slot_);
+}
+
+std::vector<Player *> EndstoneServer::getMovementAnomalies(float max_speed, float max_acceleration) const
+{
+    std::vector<Player *> result;
+    for (auto slot : movement_tracker_.findAnomalies(max_speed, max_acceleration)) {
+        result.push_back(movement_players_[slot]);
+    }
+    return result;
+}
+
+void EndstoneServer::tickViewDistance()
+{
+    if (!view_distance_controller_) {
+        return;
+    }
+    int highest_requested = 0;
+    for (const auto *player : online_players_) {
+        if (const auto requested = static_cast<const EndstonePlayer *>(player)->getRequestedChunkRadius()) {
+            highest_requested = std::max(highest_requested, requested->first);
+        }
+    }
+    if (!view_distance_controller_->update(current_tick_, getAverageTickUsage(), highest_requested)) {
+        return;
+    }
+    for (const auto *player : online_players_) {
+        ChunkRadiusHandler::getInstance().refresh(static_cast<const EndstonePlayer &>(*player));
+    }
+}
+
+void EndstoneServer::tickCompression()
+{
+    if (!compression_controller_ || !compression_controller_->update(current_tick_, getAverageTickUsage())) {
+        return;
+    }
+    getLogger().debug("Packets under {} bytes are now sent uncompressed.", compression_controller_->getThreshold());
+}
+
+Compressibility EndstoneServer::getCompressibility(int packet_id) const
+{
+    if (!compression_controller_) {
+        return Compressibility::Compressible;
+    }
+    // The size is only known once the packet is written, the packets of a type tend to be of a similar size
+    const auto size = PacketStatistics::getInstance().getAverageSentSize(packet_id);
+    if (!size || compression_controller_->isCompressible(*size)) {
+        return Compressibility::Compressible;
+    }
+    return Compressibility::Incompressible;
+}
+
+const TickHistory &EndstoneServer::getTickHistory() const
+{
+    return tick_history_;
+}
+
+JoinTimings &EndstoneServer::getJoinTimings()
+{
+    return join_timings_;
+}
+
+ReplayRecorder *EndstoneServer::getReplayRecorder() const
+{
+    return replay_recorder_.get();
+}
+
+std::uint64_t EndstoneServer::getCurrentTick() const
+{
+    return current_tick_;
+}
+
+TickArena &EndstoneServer::getTickArena()
+{
+    return tick_arena_;
+}
+
+std::optional<int> EndstoneServer::getViewDistanceCap() const
+{
+    if (view_distance_controller_) {
+        return view_distance_controller_->getCap();
+    }
+    return std::nullopt;
+}
+
+PacketCache &EndstoneServer::getCraftingDataCache()
+{
+    return crafting_data_cache_;
 }
 
 }  // namespace endstone::detail
@@ -0,0 +1,62 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/skin_data_pool.h"
+
+#include <algorithm>
+#include <functional>
+#include <string_view>
+
+namespace endstone::detail {
+
+std::shared_ptr<const std::string> SkinDataPool::intern(std::string data)
+{
+    const auto hash = std::hash<std::string_view>{}(data);
+    std::lock_guard lock(mutex_);
+    auto [begin, end] = buffers_.equal_range(hash);
+    for (auto it = begin; it != end; ++it) {
+        if (auto buffer = it->second.lock(); buffer && *buffer == data) {
+            return buffer;
+        }
+    }
+
+    auto buffer = std::make_shared<const std::string>(std::move(data));
+    buffers_.emplace(hash, buffer);
+    if (buffers_.size() >= purge_threshold_) {
+        purge();
+    }
+    return buffer;
+}
+
+std::size_t SkinDataPool::size() const
+{
+    std::lock_guard lock(mutex_);
+    return std::count_if(buffers_.begin(), buffers_.end(), [](const auto &entry) { return !entry.second.expired(); });
+}
+
+// Drops the entries of skins nobody wears anymore, the threshold doubles with the live count so the sweep is amortised
+void SkinDataPool::purge()
+{
+    for (auto it = buffers_.begin(); it != buffers_.end();) {
+        if (it->second.expired()) {
+            it = buffers_.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+    purge_threshold_ = std::max(MinPurgeThreshold, buffers_.size() * 2);
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,356 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/spdlog/async_log_sink.h"
+
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <string>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "endstone/detail/memory_usage.h"
+#include "endstone/detail/thread_options.h"
+
+namespace endstone::detail {
+
+namespace {
+std::size_t roundUpToPowerOfTwo(std::size_t value)
+{
+    std::size_t result = 2;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+// The bytes a slot buffer holds on the heap, once a message outgrew its inline storage
+std::size_t getHeapBytes(const spdlog::memory_buf_t &buffer)
+{
+    static const std::size_t inline_capacity = spdlog::memory_buf_t{}.capacity();
+    return buffer.capacity() > inline_capacity ? buffer.capacity() : 0;
+}
+}  // namespace
+
+AsyncLogSink::AsyncLogSink(std::vector<spdlog::sink_ptr> sinks, std::size_t capacity, LogOverflowPolicy policy)
+    : sinks_(std::move(sinks)), mask_(roundUpToPowerOfTwo(capacity) - 1), policy_(policy)
+{
+    slots_ = std::make_unique<Slot[]>(mask_ + 1);
+    for (std::size_t i = 0; i <= mask_; ++i) {
+        slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    MemoryUsage::getInstance().add(MemorySubsystem::LogBuffers, (mask_ + 1) * sizeof(Slot));
+    writer_ = std::thread(&AsyncLogSink::run, this);
+}
+
+AsyncLogSink::~AsyncLogSink()
+{
+    {
+        std::lock_guard lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_one();
+    if (writer_.joinable()) {
+        writer_.join();
+    }
+    auto bytes = (mask_ + 1) * sizeof(Slot);
+    for (std::size_t i = 0; i <= mask_; ++i) {
+        bytes += getHeapBytes(slots_[i].buffer);
+    }
+    MemoryUsage::getInstance().remove(MemorySubsystem::LogBuffers, bytes);
+}
+
+void AsyncLogSink::log(const spdlog::details::log_msg &msg)
+{
+    // A sink logging from the writer thread would wait for itself
+    if (std::this_thread::get_id() == writer_.get_id()) {
+        write(msg);
+        return;
+    }
+
+    if (tryPush(msg)) {
+        wakeWriter();
+        return;
+    }
+
+    switch (policy_.load(std::memory_order_relaxed)) {
+    case LogOverflowPolicy::Block:
+        push(msg);
+        break;
+    case LogOverflowPolicy::Sample:
+        if ((overflowed_.fetch_add(1, std::memory_order_relaxed) + 1) % sample_rate_.load(std::memory_order_relaxed) ==
+            0) {
+            push(msg);
+            break;
+        }
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        break;
+    case LogOverflowPolicy::Drop:
+    default:
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        break;
+    }
+}
+
+void AsyncLogSink::flush()
+{
+    if (std::this_thread::get_id() == writer_.get_id()) {
+        return;
+    }
+
+    std::unique_lock lock(mutex_);
+    auto request = ++flush_requested_;
+    wake_.notify_one();
+    flushed_.wait(lock, [this, request] { return flush_completed_ >= request || stopping_; });
+}
+
+bool AsyncLogSink::flushFor(std::chrono::milliseconds timeout)
+{
+    if (std::this_thread::get_id() == writer_.get_id()) {
+        return false;
+    }
+
+    // The lock is only tried, it may be held by a thread that crashed
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    std::unique_lock lock(mutex_, std::defer_lock);
+    while (!lock.try_lock()) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+        std::this_thread::yield();
+    }
+    auto request = ++flush_requested_;
+    wake_.notify_one();
+    return flushed_.wait_until(lock, deadline, [this, request] { return flush_completed_ >= request || stopping_; });
+}
+
+void AsyncLogSink::set_pattern(const std::string &pattern)
+{
+    for (const auto &sink : sinks_) {
+        sink->set_pattern(pattern);
+    }
+}
+
+void AsyncLogSink::set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter)
+{
+    for (const auto &sink : sinks_) {
+        sink->set_formatter(sink_formatter->clone());
+    }
+}
+
+void AsyncLogSink::setOverflowPolicy(LogOverflowPolicy policy)
+{
+    policy_.store(policy, std::memory_order_relaxed);
+}
+
+LogOverflowPolicy AsyncLogSink::getOverflowPolicy() const
+{
+    return policy_.load(std::memory_order_relaxed);
+}
+
+void AsyncLogSink::setSampleRate(std::size_t rate)
+{
+    sample_rate_.store(rate > 0 ? rate : 1, std::memory_order_relaxed);
+}
+
+void AsyncLogSink::setFlushInterval(std::chrono::milliseconds interval)
+{
+    flush_interval_.store(interval, std::memory_order_relaxed);
+}
+
+std::size_t AsyncLogSink::getCapacity() const
+{
+    return mask_ + 1;
+}
+
+std::size_t AsyncLogSink::getDroppedCount() const
+{
+    return dropped_.load(std::memory_order_relaxed);
+}
+
+bool AsyncLogSink::tryPush(const spdlog::details::log_msg &msg)
+{
+    // Bounded MPMC queue (D. Vyukov), each slot's sequence tells producers whether it is free for their position
+    auto pos = enqueue_pos_.load(std::memory_order_relaxed);
+    Slot *slot;
+    while (true) {
+        slot = &slots_[pos & mask_];
+        auto sequence = slot->sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+        if (diff == 0) {
+            if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+        else if (diff < 0) {
+            return false;
+        }
+        else {
+            pos = enqueue_pos_.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->level = msg.level;
+    slot->time = msg.time;
+    slot->thread_id = msg.thread_id;
+    slot->source = msg.source;
+    slot->name_size = msg.logger_name.size();
+    const auto heap_bytes = getHeapBytes(slot->buffer);
+    slot->buffer.clear();
+    slot->buffer.append(msg.logger_name.data(), msg.logger_name.data() + msg.logger_name.size());
+    slot->buffer.append(msg.payload.data(), msg.payload.data() + msg.payload.size());
+    if (const auto grown = getHeapBytes(slot->buffer); grown != heap_bytes) {
+        MemoryUsage::getInstance().add(MemorySubsystem::LogBuffers, grown - heap_bytes);
+    }
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+void AsyncLogSink::push(const spdlog::details::log_msg &msg)
+{
+    while (!tryPush(msg)) {
+        wakeWriter();
+        std::this_thread::yield();
+    }
+    wakeWriter();
+}
+
+std::size_t AsyncLogSink::writeBatch()
+{
+    std::size_t count = 0;
+    while (true) {
+        auto &slot = slots_[dequeue_pos_ & mask_];
+        if (slot.sequence.load(std::memory_order_acquire) != dequeue_pos_ + 1) {
+            return count;
+        }
+
+        spdlog::string_view_t name{slot.buffer.data(), slot.name_size};
+        spdlog::string_view_t payload{slot.buffer.data() + slot.name_size, slot.buffer.size() - slot.name_size};
+        spdlog::details::log_msg msg{slot.time, slot.source, name, slot.level, payload};
+        msg.thread_id = slot.thread_id;
+        write(msg);
+
+        slot.sequence.store(dequeue_pos_ + mask_ + 1, std::memory_order_release);
+        ++dequeue_pos_;
+        ++count;
+    }
+}
+
+void AsyncLogSink::write(const spdlog::details::log_msg &msg)
+{
+    for (const auto &sink : sinks_) {
+        if (!sink->should_log(msg.level)) {
+            continue;
+        }
+        try {
+            sink->log(msg);
+        }
+        catch (const std::exception &e) {
+            std::fprintf(stderr, "[AsyncLogSink] Failed to write a log message: %s\n", e.what());
+        }
+    }
+}
+
+void AsyncLogSink::reportDropped()
+{
+    auto dropped = dropped_.load(std::memory_order_relaxed);
+    if (dropped == reported_dropped_) {
+        return;
+    }
+
+    auto message = fmt::format("{} log messages were dropped because the log queue was full.",
+                               dropped - reported_dropped_);
+    reported_dropped_ = dropped;
+    write(spdlog::details::log_msg{"Logger", spdlog::level::warn, message});
+}
+
+void AsyncLogSink::wakeWriter()
+{
+    // Pairs with the fence in run, so either the writer sees the new message or we see that it is waiting
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiting_.load(std::memory_order_relaxed)) {
+        std::lock_guard lock(mutex_);
+        wake_.notify_one();
+    }
+}
+
+void AsyncLogSink::run()
+{
+    ThreadOptions::fromEnvironment("LOG").apply();
+    auto last_flush = std::chrono::steady_clock::now();
+    bool unflushed = false;
+    while (true) {
+        std::size_t flush_request;
+        {
+            std::lock_guard lock(mutex_);
+            flush_request = flush_requested_;
+        }
+
+        auto written = writeBatch();
+        reportDropped();
+        unflushed = unflushed || written > 0;
+        // Batches written within a flush interval are flushed together, unless a flush was asked for
+        const auto now = std::chrono::steady_clock::now();
+        const auto flush_at = last_flush + flush_interval_.load(std::memory_order_relaxed);
+        if ((unflushed && now >= flush_at) || flush_request != flush_completed_) {
+            for (const auto &sink : sinks_) {
+                sink->flush();
+            }
+            last_flush = now;
+            unflushed = false;
+            {
+                std::lock_guard lock(mutex_);
+                flush_completed_ = flush_request;
+            }
+            flushed_.notify_all();
+        }
+        if (written > 0) {
+            continue;
+        }
+
+        std::unique_lock lock(mutex_);
+        if (stopping_) {
+            break;
+        }
+        if (flush_requested_ != flush_completed_) {
+            continue;
+        }
+
+        waiting_.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto &next = slots_[dequeue_pos_ & mask_];
+        if (next.sequence.load(std::memory_order_acquire) == dequeue_pos_ + 1) {
+            waiting_.store(false, std::memory_order_relaxed);
+            continue;
+        }
+        if (unflushed) {
+            wake_.wait_until(lock, last_flush + flush_interval_.load(std::memory_order_relaxed));
+        }
+        else {
+            wake_.wait_for(lock, std::chrono::milliseconds(100));
+        }
+        waiting_.store(false, std::memory_order_relaxed);
+    }
+
+    // Whatever was logged while stopping
+    writeBatch();
+    for (const auto &sink : sinks_) {
+        sink->flush();
+    }
+    flushed_.notify_all();
+}
+
+}  // namespace endstone::detail
@@ -14,6 +14,8 @@
 
 #include "endstone/detail/spdlog/console_log_sink.h"
 
+#include <utility>
+
 #include <spdlog/pattern_formatter.h>
 #include <spdlog/sinks/base_sink-inl.h>
 
@@ -55,6 +57,18 @@ void ConsoleLogSink::setColorMode(spdlog::color_mode mode)
     }
 }
 
+void ConsoleLogSink::setAutoFlush(bool auto_flush)
+{
+    std::lock_guard lock(mutex_);
+    auto_flush_ = auto_flush;
+}
+
+void ConsoleLogSink::setInputLine(std::function<std::string()> render)
+{
+    std::lock_guard lock(mutex_);
+    input_line_ = std::move(render);
+}
+
 std::string ConsoleLogSink::toString(const spdlog::string_view_t &sv)
 {
     return {sv.data(), sv.size()};
@@ -80,22 +94,63 @@ void ConsoleLogSink::sink_it_(const spdlog::details::log_msg &msg)
     {
         printRange(formatted, 0, formatted.size());
     }
-    fflush(target_file_);
+    if (auto_flush_ || buffer_.size() >= MaxBufferSize) {
+        flush_();
+    }
 }
 
 void ConsoleLogSink::flush_()
 {
+    if (buffer_.size() > 0) {
+        writeBuffer();
+    }
+    fflush(target_file_);
+}
+
+void ConsoleLogSink::redrawInputLine()
+{
+    std::lock_guard lock(mutex_);
+    writeBuffer();
     fflush(target_file_);
 }
 
+void ConsoleLogSink::echo(std::string_view line)
+{
+    std::lock_guard lock(mutex_);
+    buffer_.append(line.data(), line.data() + line.size());
+    buffer_.push_back('\n');
+}
+
+void ConsoleLogSink::writeBuffer()
+{
+    if (!input_line_ && !input_line_drawn_) {
+        fwrite(buffer_.data(), sizeof(char), buffer_.size(), target_file_);
+        buffer_.clear();
+        return;
+    }
+
+    // Erases the line being typed and draws it again below the messages, in a single write
+    spdlog::memory_buf_t output;
+    output.push_back('\r');
+    output.append(clear_line.data(), clear_line.data() + clear_line.size());
+    output.append(buffer_.data(), buffer_.data() + buffer_.size());
+    if (input_line_) {
+        const auto line = input_line_();
+        output.append(line.data(), line.data() + line.size());
+    }
+    input_line_drawn_ = static_cast<bool>(input_line_);
+    fwrite(output.data(), sizeof(char), output.size(), target_file_);
+    buffer_.clear();
+}
+
 void ConsoleLogSink::printColorCode(const spdlog::string_view_t &color_code)
 {
-    fwrite(color_code.data(), sizeof(char), color_code.size(), target_file_);
+    buffer_.append(color_code.data(), color_code.data() + color_code.size());
 }
 
 void ConsoleLogSink::printRange(const spdlog::memory_buf_t &formatted, std::size_t start, std::size_t end)
 {
-    fwrite(formatted.data() + start, sizeof(char), end - start, target_file_);
+    buffer_.append(formatted.data() + start, formatted.data() + end);
 }
 
 }  // namespace endstone::detail
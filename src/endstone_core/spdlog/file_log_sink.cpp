@@ -14,20 +14,26 @@
 
 #include "endstone/detail/spdlog/file_log_sink.h"
 
+#include <cerrno>
+#include <cstdio>
+#include <vector>
+
 #include <fmt/chrono.h>
 #include <fmt/format.h>
 #include <spdlog/details/os.h>
 #include <spdlog/pattern_formatter.h>
+#include <zlib.h>
 
 #include "endstone/detail/spdlog/level_formatter.h"
 #include "endstone/detail/spdlog/text_formatter.h"
+#include "endstone/detail/thread_options.h"
 
 namespace endstone::detail {
 
 FileLogSink::FileLogSink(spdlog::filename_t base_filename, spdlog::filename_t file_pattern, uint16_t max_files,
-                         const spdlog::file_event_handlers &event_handlers)
-    : base_filename_(std::move(base_filename)), file_pattern_(std::move(file_pattern)), max_files_(max_files),
-      file_helper_{event_handlers}
+                         std::size_t max_size, bool compress, const spdlog::file_event_handlers &event_handlers)
+    : base_filename_(std::move(base_filename)), file_pattern_(std::move(file_pattern)), file_helper_{event_handlers},
+      max_files_(max_files), max_size_(max_size), compress_(compress)
 {
     using spdlog::details::os::path_exists;
 
@@ -39,11 +45,30 @@ FileLogSink::FileLogSink(spdlog::filename_t base_filename, spdlog::filename_t fi
         rotate();
     }
     rotation_tp_ = nextRotation();
+    current_size_ = file_helper_.size();
+    rotation_size_ = current_size_ + max_size_;
 
     auto *formatter = dynamic_cast<spdlog::pattern_formatter *>(formatter_.get());
     formatter->add_flag<LevelFormatter>('L');
     formatter->add_flag<TextFormatter>('v', false);
     formatter->set_pattern("%^[%Y-%m-%d %H:%M:%S.%e %L] [%n] %v%$");
+
+    if (compress_) {
+        compressor_ = std::thread(&FileLogSink::runCompression, this);
+    }
+}
+
+FileLogSink::~FileLogSink()
+{
+    // Finishes compressing the files already rotated
+    {
+        std::lock_guard lock(compression_mutex_);
+        stopping_ = true;
+    }
+    compression_cv_.notify_one();
+    if (compressor_.joinable()) {
+        compressor_.join();
+    }
 }
 
 spdlog::filename_t FileLogSink::filename()
@@ -65,15 +90,18 @@ spdlog::filename_t FileLogSink::calcFilename(const spdlog::filename_t &base_file
 
 void FileLogSink::sink_it_(const spdlog::details::log_msg &msg)
 {
-    auto time = msg.time;
-    if (time >= rotation_tp_) {
-        rotate();
+    if (msg.time >= rotation_tp_) {
         rotation_tp_ = nextRotation();
+        rotate();
     }
 
     spdlog::memory_buf_t formatted;
     formatter_->format(msg, formatted);
+    if (max_size_ > 0 && current_size_ > 0 && current_size_ + formatted.size() > rotation_size_) {
+        rotate();
+    }
     file_helper_.write(formatted);
+    current_size_ += formatted.size();
 }
 
 void FileLogSink::flush_()
@@ -84,26 +112,111 @@ void FileLogSink::flush_()
 void FileLogSink::rotate()
 {
     using spdlog::details::os::filename_to_str;
-    using spdlog::details::os::path_exists;
+
+    // The date is part of the name of rotated files, so indices start over every day
+    auto today = localtime(spdlog::log_clock::now()).tm_yday;
+    if (today != next_index_day_) {
+        next_index_ = 1;
+        next_index_day_ = today;
+    }
+
+    auto target = calcFilename(base_filename_, file_pattern_, next_index_);
+    while (next_index_ < max_files_ && isRotatedFile(target)) {
+        target = calcFilename(base_filename_, file_pattern_, ++next_index_);
+    }
 
     file_helper_.close();
-    for (auto i = max_files_; i > 0; --i) {
-        spdlog::filename_t src = calcFilename(base_filename_, file_pattern_, i - 1);
-        if (!path_exists(src)) {
-            continue;
+    auto renamed = rename(base_filename_, target);
+    auto error = errno;
+
+    // Keeps appending to the current file if it could not be renamed, and tries again once it grows by another
+    // max_size bytes or on the next day
+    file_helper_.reopen(renamed);
+    current_size_ = file_helper_.size();
+    rotation_size_ = current_size_ + max_size_;
+    if (!renamed) {
+        spdlog::throw_spdlog_ex("FileLogSink: failed renaming " + filename_to_str(base_filename_) + " to " +
+                                    filename_to_str(target),
+                                error);
+    }
+
+    if (next_index_ < max_files_) {
+        ++next_index_;
+    }
+    if (compress_) {
+        scheduleCompression(target);
+    }
+}
+
+bool FileLogSink::isRotatedFile(const spdlog::filename_t &filename) const
+{
+    using spdlog::details::os::path_exists;
+    return path_exists(filename) || path_exists(filename + SPDLOG_FILENAME_T(".gz"));
+}
+
+void FileLogSink::scheduleCompression(spdlog::filename_t filename)
+{
+    {
+        std::lock_guard lock(compression_mutex_);
+        compression_queue_.push_back(std::move(filename));
+    }
+    compression_cv_.notify_one();
+}
+
+void FileLogSink::runCompression()
+{
+    ThreadOptions::fromEnvironment("LOG").apply();
+    std::unique_lock lock(compression_mutex_);
+    while (true) {
+        compression_cv_.wait(lock, [this] { return stopping_ || !compression_queue_.empty(); });
+        if (compression_queue_.empty()) {
+            return;
         }
-        spdlog::filename_t target = calcFilename(base_filename_, file_pattern_, i);
-
-        if (!rename(src, target)) {
-            // if failed try again after a small delay.
-            spdlog::details::os::sleep_for_millis(100);
-            if (!rename(src, target)) {
-                spdlog::throw_spdlog_ex(
-                    "FileLogSink: failed renaming " + filename_to_str(src) + " to " + filename_to_str(target), errno);
-            }
+
+        auto filename = std::move(compression_queue_.front());
+        compression_queue_.pop_front();
+        lock.unlock();
+        if (!compressFile(filename)) {
+            std::fprintf(stderr, "[FileLogSink] Failed to compress %s\n",
+                         spdlog::details::os::filename_to_str(filename).c_str());
         }
+        lock.lock();
+    }
+}
+
+bool FileLogSink::compressFile(const spdlog::filename_t &filename)
+{
+    auto target_filename = filename + SPDLOG_FILENAME_T(".gz");
+    std::FILE *source = nullptr;
+    if (spdlog::details::os::fopen_s(&source, filename, SPDLOG_FILENAME_T("rb"))) {
+        return false;
+    }
+
+    auto *target = gzopen(spdlog::details::os::filename_to_str(target_filename).c_str(), "wb");
+    if (target == nullptr) {
+        std::fclose(source);
+        return false;
+    }
+
+    std::vector<char> buffer(64 * 1024);
+    auto success = true;
+    std::size_t size;
+    while ((size = std::fread(buffer.data(), 1, buffer.size(), source)) > 0) {
+        if (gzwrite(target, buffer.data(), static_cast<unsigned>(size)) != static_cast<int>(size)) {
+            success = false;
+            break;
+        }
+    }
+    success = std::ferror(source) == 0 && success;
+    std::fclose(source);
+    success = gzclose(target) == Z_OK && success;
+
+    // Keeps the uncompressed file if anything went wrong
+    if (!success) {
+        (void)spdlog::details::os::remove(target_filename);
+        return false;
     }
-    file_helper_.reopen(true);
+    return spdlog::details::os::remove(filename) == 0;
 }
 
 std::tm FileLogSink::localtime(spdlog::log_clock::time_point tp)
@@ -0,0 +1,111 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/spdlog/json_log_formatter.h"
+
+#include <ctime>
+
+#include <fmt/chrono.h>
+#include <fmt/format.h>
+#include <spdlog/details/fmt_helper.h>
+#include <spdlog/details/os.h>
+
+namespace endstone::detail {
+
+JsonLogFormatter::JsonLogFormatter(bool strip_color_codes) : strip_color_codes_(strip_color_codes) {}
+
+void JsonLogFormatter::format(const spdlog::details::log_msg &msg, spdlog::memory_buf_t &dest)
+{
+    using spdlog::details::fmt_helper::append_string_view;
+
+    // Only the milliseconds change between most messages, the rest of the timestamp is formatted once a second
+    auto duration = msg.time.time_since_epoch();
+    auto seconds = std::chrono::duration_cast<std::chrono::seconds>(duration);
+    if (seconds != cached_seconds_) {
+        cached_seconds_ = seconds;
+        cached_time_.clear();
+        auto tm = spdlog::details::os::gmtime(static_cast<std::time_t>(seconds.count()));
+        fmt::format_to(std::back_inserter(cached_time_), "{:%Y-%m-%dT%H:%M:%S}", tm);
+    }
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(duration - seconds).count();
+
+    append_string_view(R"({"time":")", dest);
+    append_string_view({cached_time_.data(), cached_time_.size()}, dest);
+    fmt::format_to(std::back_inserter(dest), ".{:03}Z\",\"level\":\"", millis);
+    append_string_view(spdlog::level::to_string_view(msg.level), dest);
+    append_string_view(R"(","logger":)", dest);
+    appendString(msg.logger_name, dest);
+    fmt::format_to(std::back_inserter(dest), ",\"thread\":{}", msg.thread_id);
+    if (!msg.source.empty()) {
+        append_string_view(R"(,"file":)", dest);
+        appendString(msg.source.filename, dest);
+        fmt::format_to(std::back_inserter(dest), ",\"line\":{}", msg.source.line);
+    }
+    append_string_view(R"(,"message":)", dest);
+    appendString(msg.payload, dest);
+    append_string_view("}", dest);
+    append_string_view(spdlog::details::os::default_eol, dest);
+}
+
+std::unique_ptr<spdlog::formatter> JsonLogFormatter::clone() const
+{
+    return spdlog::details::make_unique<JsonLogFormatter>(strip_color_codes_);
+}
+
+void JsonLogFormatter::appendString(spdlog::string_view_t input, spdlog::memory_buf_t &dest) const
+{
+    using spdlog::details::fmt_helper::append_string_view;
+
+    // Copies runs of characters that need no escaping in one go
+    dest.push_back('"');
+    std::size_t start = 0;
+    for (std::size_t i = 0; i < input.size(); i++) {
+        auto c = static_cast<unsigned char>(input[i]);
+        if (c >= 0x20 && c != '"' && c != '\\' && c != 0xC2) {
+            continue;
+        }
+
+        // Color codes are § (0xC2A7 in UTF-8) followed by the code character
+        auto is_color_code = c == 0xC2 && i + 2 < input.size() && static_cast<unsigned char>(input[i + 1]) == 0xA7;
+        if (c == 0xC2 && (!is_color_code || !strip_color_codes_)) {
+            continue;
+        }
+
+        append_string_view({input.data() + start, i - start}, dest);
+        if (is_color_code) {
+            i += 2;
+        }
+        else if (c == '"' || c == '\\') {
+            dest.push_back('\\');
+            dest.push_back(static_cast<char>(c));
+        }
+        else if (c == '\n') {
+            append_string_view("\\n", dest);
+        }
+        else if (c == '\r') {
+            append_string_view("\\r", dest);
+        }
+        else if (c == '\t') {
+            append_string_view("\\t", dest);
+        }
+        else {
+            fmt::format_to(std::back_inserter(dest), "\\u{:04x}", c);
+        }
+        start = i + 1;
+    }
+    append_string_view({input.data() + start, input.size() - start}, dest);
+    dest.push_back('"');
+}
+
+}  // namespace endstone::detail
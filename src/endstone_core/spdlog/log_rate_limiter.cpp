@@ -0,0 +1,83 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/spdlog/log_rate_limiter.h"
+
+#include <algorithm>
+#include <functional>
+
+namespace endstone::detail {
+
+void LogRateLimiter::setLimit(const LogRateLimit &limit)
+{
+    std::lock_guard lock(mutex_);
+    limit_ = limit;
+    tokens_ = 0;
+    refilled_ = {};
+    repeats_.clear();
+    enabled_.store(limit.messages_per_second > 0 || limit.repeat_first > 0, std::memory_order_relaxed);
+}
+
+LogRateLimiter::Decision LogRateLimiter::check(std::string_view message, Clock::time_point now)
+{
+    std::lock_guard lock(mutex_);
+    std::size_t repeats = 0;
+
+    if (limit_.repeat_first > 0) {
+        auto key = std::hash<std::string_view>{}(message);
+        if (repeats_.size() >= MaxTrackedMessages && repeats_.find(key) == repeats_.end()) {
+            repeats_.clear();
+        }
+
+        auto &repeat = repeats_[key];
+        if (repeat.count == 0 || now - repeat.since >= limit_.repeat_interval) {
+            repeat.count = 0;
+            repeat.since = now;
+        }
+        auto count = ++repeat.count;
+        auto sampled = limit_.repeat_every > 0 && (count - limit_.repeat_first) % limit_.repeat_every == 0;
+        if (count > limit_.repeat_first && !sampled) {
+            ++repeat.suppressed;
+            return {false, 0, 0};
+        }
+        repeats = repeat.suppressed;
+        repeat.suppressed = 0;
+    }
+
+    if (limit_.messages_per_second > 0) {
+        auto capacity =
+            limit_.burst > 0 ? static_cast<double>(limit_.burst) : std::max(1.0, limit_.messages_per_second);
+        if (refilled_ == Clock::time_point{}) {
+            tokens_ = capacity;
+        }
+        else {
+            auto elapsed = std::chrono::duration<double>(now - refilled_).count();
+            tokens_ = std::min(capacity, tokens_ + elapsed * limit_.messages_per_second);
+        }
+        refilled_ = now;
+
+        if (tokens_ < 1) {
+            // Repeats held back for this message are reported as suppressed by the rate instead
+            suppressed_ += 1 + repeats;
+            return {false, 0, 0};
+        }
+        tokens_ -= 1;
+    }
+
+    auto suppressed = suppressed_;
+    suppressed_ = 0;
+    return {true, repeats, suppressed};
+}
+
+}  // namespace endstone::detail
@@ -16,13 +16,40 @@
 
 namespace endstone::detail {
 
-SpdLogAdapter::SpdLogAdapter(std::shared_ptr<spdlog::logger> logger) : logger_(std::move(logger)) {}
+SpdLogAdapter::SpdLogAdapter(std::shared_ptr<spdlog::logger> logger)
+    : logger_(std::move(logger)), rate_limiter_(std::make_unique<LogRateLimiter>())
+{
+}
 
 void SpdLogAdapter::log(Logger::Level level, const std::string &message) const
 {
-    if (isEnabledFor(level)) {
-        logger_->log(static_cast<spdlog::level::level_enum>(level), message);
+    if (!isEnabledFor(level)) {
+        return;
+    }
+
+    auto spdlog_level = static_cast<spdlog::level::level_enum>(level);
+    if (!rate_limiter_->isEnabled()) {
+        logger_->log(spdlog_level, message);
+        return;
+    }
+
+    auto decision = rate_limiter_->check(message);
+    if (!decision.allowed) {
+        return;
     }
+    if (decision.suppressed > 0) {
+        logger_->log(spdlog::level::warn, "{} messages were suppressed by rate limiting.", decision.suppressed);
+    }
+    if (decision.repeats > 0) {
+        logger_->log(spdlog_level, "{} (message repeated {} times)", message, decision.repeats);
+        return;
+    }
+    logger_->log(spdlog_level, message);
+}
+
+void SpdLogAdapter::setRateLimit(const LogRateLimit &limit)
+{
+    rate_limiter_->setLimit(limit);
 }
 
 void SpdLogAdapter::setLevel(Logger::Level level)
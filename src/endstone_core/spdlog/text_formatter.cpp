@@ -14,37 +14,93 @@
 
 #include "endstone/detail/spdlog/text_formatter.h"
 
+#include <cstring>
+#include <string>
+#include <utility>
+
 #include <spdlog/details/fmt_helper.h>
 
 namespace endstone::detail {
 
+TextFormatter::TextFormatter(bool should_do_colors) : should_do_colors_(should_do_colors)
+{
+    const std::pair<const std::string &, spdlog::string_view_t> codes[] = {
+        // References: https://minecraft.wiki/w/Formatting_codes
+
+        // Color codes
+        {ColorFormat::Black, "\x1b[30m"},
+        {ColorFormat::DarkBlue, "\x1b[34m"},
+        {ColorFormat::DarkGreen, "\x1b[32m"},
+        {ColorFormat::DarkAqua, "\x1b[36m"},
+        {ColorFormat::DarkRed, "\x1b[31m"},
+        {ColorFormat::DarkPurple, "\x1b[35m"},
+        {ColorFormat::Gold, "\x1b[33m"},
+        {ColorFormat::Gray, "\x1b[37m"},
+        {ColorFormat::DarkGray, "\x1b[90m"},
+        {ColorFormat::Blue, "\x1b[94m"},
+        {ColorFormat::Green, "\x1b[92m"},
+        {ColorFormat::Aqua, "\x1b[96m"},
+        {ColorFormat::Red, "\x1b[91m"},
+        {ColorFormat::LightPurple, "\x1b[95m"},
+        {ColorFormat::Yellow, "\x1b[93m"},
+        {ColorFormat::White, "\x1b[97m"},
+        {ColorFormat::MinecoinGold, "\x1b[38;2;221;214;5m"},
+        {ColorFormat::MaterialQuartz, "\x1b[38;2;227;212;209m"},
+        {ColorFormat::MaterialIron, "\x1b[38;2;206;202;202m"},
+        {ColorFormat::MaterialNetherite, "\x1b[38;2;68;58;59m"},
+        {ColorFormat::MaterialRedstone, "\x1b[38;2;151;22;7m"},
+        {ColorFormat::MaterialCopper, "\x1b[38;2;180;104;77m"},
+        {ColorFormat::MaterialGold, "\x1b[38;2;222;177;45m"},
+        {ColorFormat::MaterialEmerald, "\x1b[38;2;17;160;54m"},
+        {ColorFormat::MaterialDiamond, "\x1b[38;2;44;186;168m"},
+        {ColorFormat::MaterialLapis, "\x1b[38;2;33;73;123m"},
+        {ColorFormat::MaterialAmethyst, "\x1b[38;2;154;92;198m"},
+
+        // Formatting codes
+        {ColorFormat::Obfuscated, "\x1b[8m"},
+        {ColorFormat::Bold, "\x1b[1m"},
+        {ColorFormat::Italic, "\x1b[3m"},
+        {ColorFormat::Reset, "\x1b[0m"},
+    };
+    for (const auto &[code, ansi] : codes) {
+        ansi_codes_[static_cast<unsigned char>(code.back())] = ansi;
+    }
+}
+
 void TextFormatter::format(const spdlog::details::log_msg &msg, const tm &, spdlog::memory_buf_t &dest)
 {
+    using spdlog::details::fmt_helper::append_string_view;
 
-    const auto &input = msg.payload;
-    for (std::size_t i = 0; i < input.size(); i++) {
-        // Check for the § character in UTF-8 (0xC2A7) and ensure there's a following character
-        if (i + 2 < input.size() && static_cast<unsigned char>(input[i]) == 0xC2 &&
-            static_cast<unsigned char>(input[i + 1]) == 0xA7) {
-            i += 2;                  // Skip §
-            if (i < input.size()) {  // if there's a color code character to after §
-                if (should_do_colors_) {
-                    auto format_code = static_cast<unsigned char>(input[i]);
-                    auto it = ansi_codes.find(format_code);
-                    if (it != ansi_codes.end()) {
-                        spdlog::details::fmt_helper::append_string_view(it->second, dest);
-                    }
-                    else {
-                        fmt::format_to(std::back_inserter(dest), "{}", input[i]);
-                    }
-                }
-            }
+    // The text between color codes is copied in runs, found by searching for the first byte of § (0xC2A7 in UTF-8)
+    const auto *data = msg.payload.data();
+    const auto size = msg.payload.size();
+    std::size_t start = 0;
+    while (start < size) {
+        const auto *found = static_cast<const char *>(std::memchr(data + start, 0xC2, size - start));
+        if (found == nullptr) {
+            break;
+        }
+        auto i = static_cast<std::size_t>(found - data);
+        // Ensure it is § and there's a following character, otherwise the byte is part of the text
+        if (i + 2 >= size || static_cast<unsigned char>(data[i + 1]) != 0xA7) {
+            append_string_view({data + start, i + 1 - start}, dest);
+            start = i + 1;
+            continue;
         }
-        else {
-            // Append the current character to the result if it's not part of a color code
-            fmt::format_to(std::back_inserter(dest), "{}", input[i]);
+
+        append_string_view({data + start, i - start}, dest);
+        if (should_do_colors_) {
+            const auto &ansi = ansi_codes_[static_cast<unsigned char>(data[i + 2])];
+            if (ansi.size() != 0) {
+                append_string_view(ansi, dest);
+            }
+            else {
+                dest.push_back(data[i + 2]);
+            }
         }
+        start = i + 3;
     }
+    append_string_view({data + start, size - start}, dest);
 }
 
 std::unique_ptr<spdlog::custom_flag_formatter> TextFormatter::clone() const
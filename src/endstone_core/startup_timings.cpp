@@ -0,0 +1,118 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/startup_timings.h"
+
+#include <algorithm>
+
+namespace endstone::detail {
+
+namespace {
+double toMilliseconds(StartupTimings::Clock::duration elapsed)
+{
+    return std::chrono::duration<double, std::milli>(elapsed).count();
+}
+}  // namespace
+
+StartupTimings &StartupTimings::getInstance()
+{
+    static StartupTimings instance;
+    return instance;
+}
+
+void StartupTimings::record(std::string name, Clock::duration elapsed)
+{
+    std::lock_guard lock{mutex_};
+    if (!reported_) {
+        phases_.push_back({std::move(name), elapsed});
+    }
+}
+
+void StartupTimings::recordLoad(const std::string &plugin, Clock::duration elapsed)
+{
+    std::lock_guard lock{mutex_};
+    if (!reported_) {
+        getPlugin(plugin).load += elapsed;
+    }
+}
+
+void StartupTimings::recordEnable(const std::string &plugin, Clock::duration elapsed)
+{
+    std::lock_guard lock{mutex_};
+    if (!reported_) {
+        getPlugin(plugin).enable += elapsed;
+    }
+}
+
+std::vector<StartupTimings::Phase> StartupTimings::getPhases() const
+{
+    std::lock_guard lock{mutex_};
+    return phases_;
+}
+
+std::vector<StartupTimings::PluginTiming> StartupTimings::getPlugins() const
+{
+    std::lock_guard lock{mutex_};
+    return plugins_;
+}
+
+StartupTimings::Clock::duration StartupTimings::getElapsed() const
+{
+    return Clock::now() - start_;
+}
+
+void StartupTimings::report(const Logger &logger)
+{
+    const auto elapsed = getElapsed();
+    std::vector<Phase> phases;
+    std::vector<PluginTiming> plugins;
+    {
+        std::lock_guard lock{mutex_};
+        if (reported_) {
+            return;
+        }
+        reported_ = true;
+        phases = std::move(phases_);
+        plugins = std::move(plugins_);
+    }
+
+    logger.info("Startup took {:.1f}ms:", toMilliseconds(elapsed));
+    for (const auto &phase : phases) {
+        logger.info("  {:<32} {:>10.1f}ms", phase.name, toMilliseconds(phase.elapsed));
+    }
+    if (plugins.empty()) {
+        return;
+    }
+
+    // The slowest plugins first, they are the ones worth looking at
+    std::stable_sort(plugins.begin(), plugins.end(), [](const auto &lhs, const auto &rhs) {
+        return lhs.load + lhs.enable > rhs.load + rhs.enable;
+    });
+    logger.info("  {:<32} {:>12} {:>12}", "Plugin", "onLoad", "onEnable");
+    for (const auto &plugin : plugins) {
+        logger.info("  {:<32} {:>10.1f}ms {:>10.1f}ms", plugin.name, toMilliseconds(plugin.load),
+                    toMilliseconds(plugin.enable));
+    }
+}
+
+StartupTimings::PluginTiming &StartupTimings::getPlugin(const std::string &plugin)
+{
+    auto it = std::find_if(plugins_.begin(), plugins_.end(), [&](const auto &entry) { return entry.name == plugin; });
+    if (it != plugins_.end()) {
+        return *it;
+    }
+    return plugins_.emplace_back(PluginTiming{plugin, Clock::duration::zero(), Clock::duration::zero()});
+}
+
+}  // namespace endstone::detail
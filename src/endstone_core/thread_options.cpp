@@ -0,0 +1,101 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/thread_options.h"
+
+#include <charconv>
+#include <cstdlib>
+
+namespace endstone::detail {
+
+namespace {
+constexpr std::size_t MaxCpu = 1023;
+
+bool parseCpu(std::string_view text, std::size_t &cpu)
+{
+    auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), cpu);
+    return !text.empty() && ec == std::errc() && end == text.data() + text.size() && cpu <= MaxCpu;
+}
+}  // namespace
+
+bool ThreadOptions::apply() const
+{
+    bool result = true;
+    if (!affinity.empty()) {
+        result = os::set_thread_affinity(affinity) && result;
+    }
+    if (priority) {
+        result = os::set_thread_priority(*priority) && result;
+    }
+    return result;
+}
+
+ThreadOptions ThreadOptions::fromEnvironment(const std::string &group)
+{
+    ThreadOptions options;
+    if (const auto *value = std::getenv(("ENDSTONE_" + group + "_THREAD_AFFINITY").c_str())) {
+        options.affinity = parseAffinity(value).value_or(std::vector<std::size_t>{});
+    }
+    if (const auto *value = std::getenv(("ENDSTONE_" + group + "_THREAD_PRIORITY").c_str())) {
+        options.priority = parsePriority(value);
+    }
+    return options;
+}
+
+std::optional<std::vector<std::size_t>> ThreadOptions::parseAffinity(std::string_view value)
+{
+    std::vector<std::size_t> cpus;
+    while (!value.empty()) {
+        const auto comma = value.find(',');
+        const auto item = value.substr(0, comma);
+        value = comma == std::string_view::npos ? std::string_view{} : value.substr(comma + 1);
+
+        std::size_t first = 0;
+        std::size_t last = 0;
+        if (const auto dash = item.find('-'); dash != std::string_view::npos) {
+            if (!parseCpu(item.substr(0, dash), first) || !parseCpu(item.substr(dash + 1), last) || first > last) {
+                return std::nullopt;
+            }
+        }
+        else if (!parseCpu(item, first)) {
+            return std::nullopt;
+        }
+        else {
+            last = first;
+        }
+        for (auto cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+    if (cpus.empty()) {
+        return std::nullopt;
+    }
+    return cpus;
+}
+
+std::optional<os::ThreadPriority> ThreadOptions::parsePriority(std::string_view value)
+{
+    if (value == "low") {
+        return os::ThreadPriority::Low;
+    }
+    if (value == "normal") {
+        return os::ThreadPriority::Normal;
+    }
+    if (value == "high") {
+        return os::ThreadPriority::High;
+    }
+    return std::nullopt;
+}
+
+}  // namespace endstone::detail
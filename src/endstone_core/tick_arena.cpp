@@ -0,0 +1,78 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/tick_arena.h"
+
+namespace endstone::detail {
+
+TickArena::TickArena(std::size_t block_size) : block_size_(block_size) {}
+
+void *TickArena::allocate(std::size_t size, std::size_t alignment)
+{
+    allocated_ += size;
+    if (size + alignment > block_size_) {
+        // Oversized allocations get a block of their own for this tick, small ones keep filling the current block
+        auto space = size + alignment;
+        void *ptr = large_blocks_.emplace_back(new std::byte[space]).get();
+        return std::align(alignment, size, ptr, space);
+    }
+
+    void *ptr = cursor_;
+    auto space = static_cast<std::size_t>(end_ - cursor_);
+    if (!cursor_ || !std::align(alignment, size, ptr, space)) {
+        nextBlock();
+        ptr = cursor_;
+        space = block_size_;
+        std::align(alignment, size, ptr, space);
+    }
+    cursor_ = static_cast<std::byte *>(ptr) + size;
+    return ptr;
+}
+
+void TickArena::reset()
+{
+    large_blocks_.clear();
+    allocated_ = 0;
+    block_ = 0;
+    if (blocks_.empty()) {
+        return;
+    }
+    cursor_ = blocks_.front().get();
+    end_ = cursor_ + block_size_;
+}
+
+std::size_t TickArena::getAllocatedBytes() const
+{
+    return allocated_;
+}
+
+std::size_t TickArena::getBlockCount() const
+{
+    return blocks_.size() + large_blocks_.size();
+}
+
+void TickArena::nextBlock()
+{
+    // Blocks filled in an earlier tick are reused before new ones are allocated
+    if (cursor_) {
+        ++block_;
+    }
+    if (block_ == blocks_.size()) {
+        blocks_.emplace_back(new std::byte[block_size_]);
+    }
+    cursor_ = blocks_[block_].get();
+    end_ = cursor_ + block_size_;
+}
+
+}  // namespace endstone::detail
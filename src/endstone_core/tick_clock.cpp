@@ -0,0 +1,39 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/tick_clock.h"
+
+#include <algorithm>
+
+namespace endstone::detail {
+
+std::uint64_t TickClock::update(std::uint64_t current_tick, Clock::time_point now)
+{
+    if (!start_time_) {
+        start_time_ = now;
+        start_tick_ = current_tick;
+        tick_ = current_tick;
+        return tick_;
+    }
+    const auto elapsed = std::max(Clock::duration::zero(), now - *start_time_);
+    tick_ = std::max(tick_, start_tick_ + static_cast<std::uint64_t>(elapsed / TickDuration));
+    return tick_;
+}
+
+std::uint64_t TickClock::getTick() const
+{
+    return tick_;
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,77 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/tick_history.h"
+
+#include <algorithm>
+
+namespace endstone::detail {
+
+void TickHistory::push(const Sample &sample)
+{
+    samples_[next_] = sample;
+    next_ = (next_ + 1) % Capacity;
+    size_ = std::min(size_ + 1, Capacity);
+}
+
+std::size_t TickHistory::size() const
+{
+    return size_;
+}
+
+TickHistory::Sample TickHistory::getAverage(std::size_t count) const
+{
+    count = std::min(count, size_);
+    Sample average;
+    if (count == 0) {
+        return average;
+    }
+    for (std::size_t i = 1; i <= count; ++i) {
+        const auto &sample = samples_[(next_ + Capacity - i) % Capacity];
+        average.scheduler += sample.scheduler;
+        average.level += sample.level;
+        average.post_tick += sample.post_tick;
+    }
+    const auto n = static_cast<std::chrono::nanoseconds::rep>(count);
+    average.scheduler /= n;
+    average.level /= n;
+    average.post_tick /= n;
+    return average;
+}
+
+TickHistory::Sample TickHistory::getMax(std::size_t count) const
+{
+    count = std::min(count, size_);
+    Sample max;
+    for (std::size_t i = 1; i <= count; ++i) {
+        const auto &sample = samples_[(next_ + Capacity - i) % Capacity];
+        if (sample.getTotal() > max.getTotal()) {
+            max = sample;
+        }
+    }
+    return max;
+}
+
+std::vector<TickHistory::Sample> TickHistory::getSamples(std::size_t count) const
+{
+    count = std::min(count, size_);
+    std::vector<Sample> samples;
+    samples.reserve(count);
+    for (std::size_t i = count; i > 0; --i) {
+        samples.push_back(samples_[(next_ + Capacity - i) % Capacity]);
+    }
+    return samples;
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,134 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/tick_percentiles.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace endstone::detail {
+
+namespace {
+int log2Floor(std::uint64_t value)
+{
+    int result = 0;
+    while (value >>= 1) {
+        ++result;
+    }
+    return result;
+}
+}  // namespace
+
+void TickPercentiles::Slot::add(std::uint64_t value)
+{
+    ++buckets[getBucket(value)];
+    ++count;
+    max = std::max(max, value);
+}
+
+void TickPercentiles::record(Clock::time_point now, std::chrono::microseconds duration)
+{
+    const auto second = std::chrono::duration_cast<std::chrono::seconds>(now.time_since_epoch()).count();
+    const auto minute = second / 60;
+    const auto value = static_cast<std::uint64_t>(std::max<std::int64_t>(0, duration.count()));
+    for (auto [slot, id] : {std::pair{&seconds_[second % seconds_.size()], second},
+                            std::pair{&minutes_[minute % minutes_.size()], minute}}) {
+        if (slot->id != id) {
+            *slot = Slot{};
+            slot->id = id;
+        }
+        slot->add(value);
+    }
+}
+
+TickStatistics TickPercentiles::getStatistics(Clock::time_point now, TickWindow window) const
+{
+    const auto second = std::chrono::duration_cast<std::chrono::seconds>(now.time_since_epoch()).count();
+    const auto minute = second / 60;
+    Slot merged;
+    switch (window) {
+    case TickWindow::OneSecond:
+        merge(seconds_, second - 1, second, merged);
+        break;
+    case TickWindow::OneMinute:
+        merge(seconds_, second - 60, second, merged);
+        break;
+    case TickWindow::FiveMinutes:
+        merge(minutes_, minute - 5, minute, merged);
+        break;
+    case TickWindow::FifteenMinutes:
+        merge(minutes_, minute - 15, minute, merged);
+        break;
+    }
+
+    TickStatistics result;
+    result.count = merged.count;
+    result.max = std::chrono::microseconds(merged.max);
+    if (merged.count == 0) {
+        return result;
+    }
+
+    std::chrono::microseconds *targets[] = {&result.p50, &result.p95, &result.p99};
+    const double percentiles[] = {0.50, 0.95, 0.99};
+    std::size_t next = 0;
+    std::uint64_t seen = 0;
+    for (std::size_t bucket = 0; bucket < NumBuckets && next < 3; ++bucket) {
+        seen += merged.buckets[bucket];
+        while (next < 3 && static_cast<double>(seen) >= std::ceil(percentiles[next] * merged.count)) {
+            *targets[next++] = std::chrono::microseconds(std::min(getUpperBound(bucket), merged.max));
+        }
+    }
+    return result;
+}
+
+std::size_t TickPercentiles::getBucket(std::uint64_t value)
+{
+    if (value < SubBuckets) {
+        return value;
+    }
+    const auto exponent = log2Floor(value);
+    if (exponent > static_cast<int>(MaxExponent)) {
+        return NumBuckets - 1;
+    }
+    const auto shift = exponent - static_cast<int>(SubBucketBits);
+    return (shift + 1) * SubBuckets + ((value >> shift) - SubBuckets);
+}
+
+std::uint64_t TickPercentiles::getUpperBound(std::size_t bucket)
+{
+    if (bucket < SubBuckets) {
+        return bucket;
+    }
+    const auto shift = bucket / SubBuckets - 1;
+    const auto lower = (SubBuckets + bucket % SubBuckets) << shift;
+    return lower + (std::uint64_t{1} << shift) - 1;
+}
+
+template <std::size_t N>
+void TickPercentiles::merge(const std::array<Slot, N> &slots, std::int64_t first, std::int64_t last, Slot &result)
+{
+    for (const auto &slot : slots) {
+        if (slot.id < first || slot.id > last) {
+            continue;
+        }
+        for (std::size_t i = 0; i < NumBuckets; ++i) {
+            result.buckets[i] += slot.buckets[i];
+        }
+        result.count += slot.count;
+        result.max = std::max(result.max, slot.max);
+    }
+}
+
+}  // namespace endstone::detail
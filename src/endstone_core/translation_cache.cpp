@@ -0,0 +1,124 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/translation_cache.h"
+
+#include <utility>
+
+namespace endstone::detail {
+
+namespace {
+constexpr char MarkerPrefix = '\x1f';
+constexpr char FirstMarker = 'A';
+}  // namespace
+
+TranslationTemplate::TranslationTemplate(std::string_view text)
+{
+    std::string literal;
+    for (std::size_t i = 0; i < text.size(); i++) {
+        if (text[i] == MarkerPrefix && i + 1 < text.size()) {
+            auto param = static_cast<std::size_t>(text[i + 1] - FirstMarker);
+            if (param < TranslationCache::MaxParameters) {
+                if (!literal.empty()) {
+                    literal_size_ += literal.size();
+                    segments_.push_back({std::move(literal), NoParam});
+                    literal.clear();
+                }
+                segments_.push_back({{}, param});
+                i++;
+                continue;
+            }
+        }
+        literal.push_back(text[i]);
+    }
+    if (!literal.empty()) {
+        literal_size_ += literal.size();
+        segments_.push_back({std::move(literal), NoParam});
+    }
+}
+
+std::string TranslationTemplate::format(const std::vector<std::string> &params) const
+{
+    auto size = literal_size_;
+    for (const auto &segment : segments_) {
+        if (segment.param != NoParam && segment.param < params.size()) {
+            size += params[segment.param].size();
+        }
+    }
+
+    std::string result;
+    result.reserve(size);
+    for (const auto &segment : segments_) {
+        if (segment.param == NoParam) {
+            result += segment.text;
+        }
+        else if (segment.param < params.size()) {
+            result += params[segment.param];
+        }
+    }
+    return result;
+}
+
+TranslationCache::TranslationCache(Resolver resolver) : resolver_(std::move(resolver))
+{
+    markers_.reserve(MaxParameters);
+    for (std::size_t i = 0; i < MaxParameters; i++) {
+        markers_.push_back(getMarker(i));
+    }
+}
+
+std::string TranslationCache::translate(const Translatable &message, const std::string &locale)
+{
+    const auto &params = message.getParameters();
+    std::vector<std::string> resolved;
+    resolved.reserve(params.size());
+    for (const auto &param : params) {
+        if (param.size() > 1 && param[0] == '%') {
+            resolved.push_back(compile(param.substr(1), locale).format({}));
+        }
+        else {
+            resolved.push_back(param);
+        }
+    }
+    return compile(message.getTranslationKey(), locale).format(resolved);
+}
+
+void TranslationCache::clear()
+{
+    templates_.clear();
+}
+
+std::size_t TranslationCache::size() const
+{
+    return templates_.size();
+}
+
+std::string TranslationCache::getMarker(std::size_t param)
+{
+    return {MarkerPrefix, static_cast<char>(FirstMarker + param)};
+}
+
+const TranslationTemplate &TranslationCache::compile(const std::string &key, const std::string &locale)
+{
+    auto cache_key = locale;
+    cache_key.push_back('\0');
+    cache_key += key;
+    if (auto it = templates_.find(cache_key); it != templates_.end()) {
+        return it->second;
+    }
+    auto text = resolver_(key, markers_, locale);
+    return templates_.emplace(std::move(cache_key), TranslationTemplate(text)).first->second;
+}
+
+}  // namespace endstone::detail
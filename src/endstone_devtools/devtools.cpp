@@ -20,8 +20,10 @@
 #include <imgui_impl_opengl3.h>
 #include <imgui_internal.h>
 
+#include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <memory>
 #include <mutex>
 #include <utility>
 #include <zstr.hpp>
@@ -30,7 +32,6 @@
 #include <GLFW/glfw3.h>
 #include <entt/entt.hpp>
 
-#include "bedrock/common/util/bytes_data_output.h"
 #include "bedrock/nbt/nbt_io.h"
 #include "endstone/color_format.h"
 #include "endstone/detail/devtools/imgui/imgui_json.h"
@@ -43,9 +44,57 @@ namespace fs = std::filesystem;
 namespace endstone::detail::devtools {
 
 namespace {
+// Large objects and arrays are shown and saved a slice at a time to keep the window responsive
+constexpr std::size_t PageSize = 100;
+constexpr std::chrono::milliseconds ExportBudget{4};
+
+/**
+ * Writes a JSON file over several frames, a slice of its top-level entries each time.
+ *
+ * The file is the same as the one written by dumping the whole document at once.
+ */
+class JsonExport {
+public:
+    JsonExport(nlohmann::json json, const fs::path &path) : json_(std::move(json)), file_(path), it_(json_.cbegin()) {}
+
+    bool write(std::chrono::nanoseconds budget)
+    {
+        if (!json_.is_structured()) {
+            file_ << json_;
+            return true;
+        }
+
+        const auto deadline = std::chrono::steady_clock::now() + budget;
+        if (it_ == json_.cbegin()) {
+            file_ << (json_.is_array() ? '[' : '{');
+        }
+        while (it_ != json_.cend()) {
+            if (it_ != json_.cbegin()) {
+                file_ << ',';
+            }
+            if (json_.is_object()) {
+                file_ << nlohmann::json(it_.key()).dump() << ':';
+            }
+            file_ << it_.value().dump();
+            ++it_;
+            if (std::chrono::steady_clock::now() >= deadline) {
+                return false;
+            }
+        }
+        file_ << (json_.is_array() ? ']' : '}');
+        return true;
+    }
+
+private:
+    nlohmann::json json_;
+    std::ofstream file_;
+    nlohmann::json::const_iterator it_;
+};
+
 auto &gLogger = LoggerFactory::getLogger("DevTools");
 GLFWwindow *gWindow = nullptr;
 ImGui::FileBrowser *gFileBrowser = nullptr;
+std::unique_ptr<JsonExport> gJsonExport;
 
 void onError(int error, const char *description)
 {
@@ -169,7 +218,7 @@ void render()
             if (ImGui::BeginMenu("File")) {
                 ImGui::SeparatorText("Export");
                 auto *data = VanillaData::get();
-                if (ImGui::BeginMenu("JSON files", data != nullptr)) {
+                if (ImGui::BeginMenu("JSON files", data != nullptr && !gJsonExport)) {
                     if (ImGui::MenuItem("Block Types")) {
                         file_to_save = data->block_types;
                         openFileBrowser("Save Block Types", "block_types.json");
@@ -195,21 +244,7 @@ void render()
                         openFileBrowser("Save Item Tags", "item_tags.json");
                     }
                     if (ImGui::MenuItem("Recipes")) {
-                        file_to_save = nlohmann::json{
-                            {"shapeless", data->recipes.shapeless},
-                            {"shaped", data->recipes.shaped},
-                            {"furnace", data->recipes.furnace},
-                            {"furnaceAux", data->recipes.furnace_aux},
-                            {"multi", data->recipes.multi},
-                            {"shulkerBox", data->recipes.shulker_box},
-                            {"shapelessChemistry", data->recipes.shapeless_chemistry},
-                            {"shapedChemistry", data->recipes.shaped_chemistry},
-                            {"smithingTransform", data->recipes.smithing_transform},
-                            {"smithingTrim", data->recipes.smithing_trim},
-                            {"potionMixes", data->recipes.potion_mixes},
-                            {"containerMixes", data->recipes.container_mixes},
-                            {"materialReducer", data->recipes.material_reducer},
-                        };
+                        file_to_save = data->getRecipes();
                         openFileBrowser("Save Recipes", "recipes.json");
                     }
                     ImGui::EndMenu();
@@ -256,6 +291,10 @@ void render()
             showRecipeWindow(&show_recipe_window);
         }
 
+        if (gJsonExport && gJsonExport->write(ExportBudget)) {
+            gJsonExport.reset();
+        }
+
         // Handle file browser
         gFileBrowser->Display();
         if (gFileBrowser->HasSelected()) {
@@ -263,14 +302,13 @@ void render()
             std::visit(
                 entt::overloaded{[&](std::monostate) { gLogger.error("Unable to save to {}: Empty.", path.string()); },
                                  [&](const nlohmann::json &arg) {
-                                     std::ofstream file(path);
-                                     file << arg;
+                                     gJsonExport = std::make_unique<JsonExport>(arg, path);
                                  },
                                  [&](const CompoundTag &arg) {
-                                     BigEndianStringByteOutput output;
-                                     NbtIo::writeNamedTag("", arg, output);
+                                     std::string nbt;
+                                     NbtIo::writeNamedTag("", arg, nbt, NbtIo::Encoding::BigEndian);
                                      zstr::ofstream file(path.string(), std::ios::out | std::ios::binary);
-                                     file << output.buffer;
+                                     file << nbt;
                                  }},
                 file_to_save);
             file_to_save = std::monostate();
@@ -350,19 +388,19 @@ void showBlockWindow(bool *open)
     }
 
     if (ImGui::CollapsingHeader(fmt::format("{} Block Types", data->block_types.size()).c_str())) {
-        ImGui::Json(data->block_types);
+        ImGui::Json(data->block_types, PageSize);
     }
 
     if (ImGui::CollapsingHeader(fmt::format("{} Block States", data->block_states.size()).c_str())) {
-        ImGui::Json(data->block_states);
+        ImGui::Json(data->block_states, PageSize);
     }
 
     if (ImGui::CollapsingHeader(fmt::format("{} Block Tags", data->block_tags.size()).c_str())) {
-        ImGui::Json(data->block_tags);
+        ImGui::Json(data->block_tags, PageSize);
     }
 
     if (ImGui::CollapsingHeader(fmt::format("{} Materials", data->materials.size()).c_str())) {
-        ImGui::Json(data->materials);
+        ImGui::Json(data->materials, PageSize);
     }
     ImGui::End();
 }
@@ -382,15 +420,16 @@ void showItemWindow(bool *open)
     }
 
     if (ImGui::CollapsingHeader(fmt::format("{} Items", data->items.size()).c_str())) {
-        ImGui::Json(data->items);
+        ImGui::Json(data->items, PageSize);
     }
 
     if (ImGui::CollapsingHeader(fmt::format("{} Creative Items", data->creative_items.size()).c_str())) {
-        ImGui::Json(toJson(data->creative_items));
+        static const auto creative_items = toJson(data->creative_items);
+        ImGui::Json(creative_items, PageSize);
     }
 
     if (ImGui::CollapsingHeader(fmt::format("{} Item Tags", data->item_tags.size()).c_str())) {
-        ImGui::Json(data->item_tags);
+        ImGui::Json(data->item_tags, PageSize);
     }
     ImGui::End();
 }
@@ -410,48 +449,48 @@ void showRecipeWindow(bool *open)
     }
 
     if (ImGui::CollapsingHeader(fmt::format("{} Shapeless Recipes", data->recipes.shapeless.size()).c_str())) {
-        ImGui::Json(data->recipes.shapeless);
+        ImGui::Json(data->recipes.shapeless, PageSize);
     }
     if (ImGui::CollapsingHeader(fmt::format("{} Shaped Recipes", data->recipes.shaped.size()).c_str())) {
-        ImGui::Json(data->recipes.shaped);
+        ImGui::Json(data->recipes.shaped, PageSize);
     }
     if (ImGui::CollapsingHeader(fmt::format("{} Furnace Recipes", data->recipes.furnace.size()).c_str())) {
-        ImGui::Json(data->recipes.furnace);
+        ImGui::Json(data->recipes.furnace, PageSize);
     }
     if (ImGui::CollapsingHeader(fmt::format("{} Furnace Aux Recipes", data->recipes.furnace_aux.size()).c_str())) {
-        ImGui::Json(data->recipes.furnace_aux);
+        ImGui::Json(data->recipes.furnace_aux, PageSize);
     }
     if (ImGui::CollapsingHeader(fmt::format("{} Multi Recipes", data->recipes.multi.size()).c_str())) {
-        ImGui::Json(data->recipes.multi);
+        ImGui::Json(data->recipes.multi, PageSize);
     }
     if (ImGui::CollapsingHeader(fmt::format("{} Shulker Box Recipes", data->recipes.shulker_box.size()).c_str())) {
-        ImGui::Json(data->recipes.shulker_box);
+        ImGui::Json(data->recipes.shulker_box, PageSize);
     }
     if (ImGui::CollapsingHeader(
             fmt::format("{} Shapeless Chemistry Recipes", data->recipes.shapeless_chemistry.size()).c_str())) {
-        ImGui::Json(data->recipes.shapeless_chemistry);
+        ImGui::Json(data->recipes.shapeless_chemistry, PageSize);
     }
     if (ImGui::CollapsingHeader(
             fmt::format("{} Shaped Chemistry Recipes", data->recipes.shaped_chemistry.size()).c_str())) {
-        ImGui::Json(data->recipes.shaped_chemistry);
+        ImGui::Json(data->recipes.shaped_chemistry, PageSize);
     }
     if (ImGui::CollapsingHeader(
             fmt::format("{} Smithing Transform Recipes", data->recipes.smithing_transform.size()).c_str())) {
-        ImGui::Json(data->recipes.smithing_transform);
+        ImGui::Json(data->recipes.smithing_transform, PageSize);
     }
     if (ImGui::CollapsingHeader(fmt::format("{} Smithing Trim Recipes", data->recipes.smithing_trim.size()).c_str())) {
-        ImGui::Json(data->recipes.smithing_trim);
+        ImGui::Json(data->recipes.smithing_trim, PageSize);
     }
     if (ImGui::CollapsingHeader(fmt::format("{} Potion Mix Recipes", data->recipes.potion_mixes.size()).c_str())) {
-        ImGui::Json(data->recipes.potion_mixes);
+        ImGui::Json(data->recipes.potion_mixes, PageSize);
     }
     if (ImGui::CollapsingHeader(
             fmt::format("{} Container Mix Recipes", data->recipes.container_mixes.size()).c_str())) {
-        ImGui::Json(data->recipes.container_mixes);
+        ImGui::Json(data->recipes.container_mixes, PageSize);
     }
     if (ImGui::CollapsingHeader(
             fmt::format("{} Material Reducer Recipes", data->recipes.material_reducer.size()).c_str())) {
-        ImGui::Json(data->recipes.material_reducer);
+        ImGui::Json(data->recipes.material_reducer, PageSize);
     }
 
     ImGui::End();
@@ -16,7 +16,10 @@
 
 #include <imgui.h>
 
+#include <algorithm>
+#include <iterator>
 #include <regex>
+#include <string>
 
 #include "bedrock/core/math/color.h"
 
@@ -26,6 +29,19 @@ bool isColor(const std::string &str)
     static std::regex pattern("^#([A-Fa-f0-9]{8})$");
     return std::regex_match(str, pattern);
 }
+
+void showEntry(const std::string &key, const nlohmann::json &value)  // NOLINT(*-no-recursion)
+{
+    if (value.is_primitive()) {
+        ImGui::Text("%s: ", key.c_str());
+        ImGui::SameLine();
+        ImGui::Json(value);
+    }
+    else if (ImGui::TreeNode(key.c_str())) {
+        ImGui::Json(value);
+        ImGui::TreePop();
+    }
+}
 }  // namespace
 
 void ImGui::Json(const nlohmann::json &json)  // NOLINT(*-no-recursion)
@@ -33,31 +49,14 @@ void ImGui::Json(const nlohmann::json &json)  // NOLINT(*-no-recursion)
     switch (json.type()) {
     case nlohmann::json::value_t::object: {
         for (const auto &el : json.items()) {
-            if (el.value().is_primitive()) {
-                ImGui::Text("%s: ", el.key().c_str());
-                ImGui::SameLine();
-                ImGui::Json(el.value());
-            }
-            else if (ImGui::TreeNode(el.key().c_str())) {
-                ImGui::Json(el.value());
-                ImGui::TreePop();
-            }
+            showEntry(el.key(), el.value());
         }
         break;
     }
     case nlohmann::json::value_t::array: {
         int index = 0;
         for (const auto &el : json) {
-            auto key = std::to_string(index);
-            if (el.is_primitive()) {
-                ImGui::Text("%s: ", key.c_str());
-                ImGui::SameLine();
-                ImGui::Json(el);
-            }
-            else if (ImGui::TreeNode(key.c_str())) {
-                ImGui::Json(el);
-                ImGui::TreePop();
-            }
+            showEntry(std::to_string(index), el);
             ++index;
         }
         break;
@@ -76,3 +75,35 @@ void ImGui::Json(const nlohmann::json &json)  // NOLINT(*-no-recursion)
     }
     }
 }
+
+void ImGui::Json(const nlohmann::json &json, std::size_t page_size)
+{
+    if (!json.is_structured() || page_size == 0 || json.size() <= page_size) {
+        ImGui::Json(json);
+        return;
+    }
+
+    // Only one page of a large object or array is laid out each frame, the page is kept in the state storage
+    ImGui::PushID(&json);
+    auto *storage = ImGui::GetStateStorage();
+    const auto id = ImGui::GetID("page");
+    const auto pages = static_cast<int>((json.size() + page_size - 1) / page_size);
+    auto page = std::clamp(storage->GetInt(id, 0), 0, pages - 1);
+    ImGui::SliderInt("Page", &page, 0, pages - 1, "%d", ImGuiSliderFlags_AlwaysClamp);
+    storage->SetInt(id, page);
+
+    const auto first = static_cast<std::size_t>(page) * page_size;
+    const auto last = std::min(first + page_size, json.size());
+    if (json.is_array()) {
+        for (auto i = first; i < last; ++i) {
+            showEntry(std::to_string(i), json[i]);
+        }
+    }
+    else {
+        auto it = std::next(json.begin(), static_cast<std::ptrdiff_t>(first));
+        for (auto i = first; i < last; ++i, ++it) {
+            showEntry(it.key(), it.value());
+        }
+    }
+    ImGui::PopID();
+}
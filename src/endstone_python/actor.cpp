@@ -43,7 +43,8 @@ void init_actor(py::module_ &m, py::class_<Actor, CommandSender> &actor, py::cla
         .def("teleport", py::overload_cast<Actor &>(&Actor::teleport), "Teleports this actor to the target Actor.",
              py::arg("target"))
         .def_property_readonly("id", &Actor::getId, "Returns a unique id for this actor.")
-        .def_property_readonly("is_dead", &Actor::isDead, "Returns true if this actor has been marked for removal.");
+        .def_property_readonly("is_dead", &Actor::isDead, "Returns true if this actor has been marked for removal.")
+        .def_property_readonly("type", &Actor::getType, "Gets the type of this actor, e.g. minecraft:zombie.");
 
     mob.def_property_readonly("is_gliding", &Mob::isGliding,
                               "Checks to see if an actor is gliding, such as using an Elytra.");
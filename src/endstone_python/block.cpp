@@ -34,6 +34,7 @@ void init_block(py::module_ &m, py::class_<Block> &block)
         .value("EAST", BlockFace::East);
 
     block.def_property_readonly("type", &Block::getType, "Get the type of the block.")
+        .def_property_readonly("type_id", &Block::getTypeId, "Get the numeric id of the type of the block.")
         .def("get_relative", py::overload_cast<int, int, int>(&Block::getRelative), py::arg("offset_x"),
              py::arg("offset_y"), py::arg("offset_z"), "Gets the block at the given offsets")
         .def("get_relative", py::overload_cast<BlockFace, int>(&Block::getRelative), py::arg("face"),
@@ -12,7 +12,13 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include <pybind11/chrono.h>
 #include <pybind11/numpy.h>
@@ -32,6 +38,7 @@
 #include "endstone/permissions/permission_default.h"
 #include "endstone/scheduler/scheduler.h"
 #include "endstone/server.h"
+#include "endstone/tick_statistics.h"
 
 namespace py = pybind11;
 
@@ -47,18 +54,27 @@ void init_game_mode(py::module_ &);
 void init_inventory(py::module_ &);
 void init_level(py::module_ &);
 void init_logger(py::module_ &);
+void init_messaging(py::module_ &);
 void init_network(py::module_ &);
 void init_permissions(py::module_ &, py::class_<Permissible> &permissible, py::class_<Permission> &permission,
                       py::enum_<PermissionDefault> &permission_default);
+void init_persistence(py::module_ &);
 void init_player(py::module_ &, py::class_<Player, Mob> &player);
 void init_plugin(py::module_ &);
 void init_scheduler(py::module_ &);
 void init_scoreboard(py::module_ &);
 void init_server(py::class_<Server> &server);
+void init_tick_statistics(py::module_ &);
 void init_translatable(py::module_ &);
 void init_util(py::module_ &);
 
+// The bindings share server state with the server thread and have not been audited for use without the GIL, so a
+// free-threaded interpreter keeps the GIL enabled unless the build opts in with ENDSTONE_PYTHON_FREE_THREADING
+#ifdef ENDSTONE_PYTHON_FREE_THREADING
+PYBIND11_MODULE(endstone_python, m, py::mod_gil_not_used())  // NOLINT(*-use-anonymous-namespace)
+#else
 PYBIND11_MODULE(endstone_python, m)  // NOLINT(*-use-anonymous-namespace)
+#endif
 {
     py::options options;
     options.disable_enum_members_docstring();
@@ -86,6 +102,7 @@ PYBIND11_MODULE(endstone_python, m)  // NOLINT(*-use-anonymous-namespace)
 
     init_color_format(m);
     init_game_mode(m);
+    init_tick_statistics(m);
     init_logger(m);
     init_translatable(m);
     init_form(m);
@@ -101,6 +118,8 @@ PYBIND11_MODULE(endstone_python, m)  // NOLINT(*-use-anonymous-namespace)
     init_command(m, command_sender);
     init_plugin(m);
     init_scheduler(m);
+    init_persistence(m);
+    init_messaging(m);
     init_permissions(m, permissible, permission, permission_default);
     init_server(server);
     init_event(m, event, event_priority);
@@ -156,6 +175,24 @@ void init_game_mode(py::module_ &m)
         .value("SPECTATOR", GameMode::Spectator);
 }
 
+void init_tick_statistics(py::module_ &m)
+{
+    py::enum_<TickWindow>(m, "TickWindow", "The window of recent ticks that TickStatistics are computed over.")
+        .value("ONE_SECOND", TickWindow::OneSecond)
+        .value("ONE_MINUTE", TickWindow::OneMinute)
+        .value("FIVE_MINUTES", TickWindow::FiveMinutes)
+        .value("FIFTEEN_MINUTES", TickWindow::FifteenMinutes);
+
+    py::class_<TickStatistics>(m, "TickStatistics", "Percentiles of the durations of the server ticks in a window.")
+        .def_readonly("count", &TickStatistics::count, "Number of ticks in the window.")
+        .def_readonly("p50", &TickStatistics::p50, "Median tick duration.")
+        .def_readonly("p95", &TickStatistics::p95,
+                      "Tick duration that 95% of the ticks were faster than or equal to.")
+        .def_readonly("p99", &TickStatistics::p99,
+                      "Tick duration that 99% of the ticks were faster than or equal to.")
+        .def_readonly("max", &TickStatistics::max, "Duration of the slowest tick.");
+}
+
 void init_logger(py::module &m)
 {
     auto logger = py::class_<Logger>(m, "Logger", "Logger class which can format and output varies levels of logs.");
@@ -223,10 +260,29 @@ void init_server(py::class_<Server> &server)
              "Dispatches a command on this server, and executes it if found.")
         .def_property_readonly("scheduler", &Server::getScheduler, py::return_value_policy::reference,
                                "Gets the scheduler for managing scheduled events.")
+        .def_property_readonly("player_data_store", &Server::getPlayerDataStore, py::return_value_policy::reference,
+                               "Gets the store for the data plugins keep per player.")
+        .def_property_readonly("messenger", &Server::getMessenger, py::return_value_policy::reference,
+                               "Gets the messenger plugins exchange messages with the other servers of the network "
+                               "through.")
         .def_property_readonly("level", &Server::getLevel, py::return_value_policy::reference_internal,
                                "Gets the server level.")
+        .def("get_block_type_id", &Server::getBlockTypeId, py::arg("type"),
+             "Gets the numeric id of a block type, or -1 if there is no block type with this name.")
         .def_property_readonly("online_players", &Server::getOnlinePlayers, py::return_value_policy::reference_internal,
                                "Gets a list of all currently online players.")
+        .def(
+            "player_pings",
+            [](const Server &self) {
+                const auto &players = self.getOnlinePlayers();
+                py::array_t<std::int32_t> array(static_cast<py::ssize_t>(players.size()));
+                auto *pings = array.mutable_data();
+                for (const auto *player : players) {
+                    *pings++ = static_cast<std::int32_t>(player->getPing().count());
+                }
+                return array;
+            },
+            "Gets the ping of every online player in milliseconds as an int32 array, in the order of online_players")
         .def_property("max_players", &Server::getMaxPlayers, &Server::setMaxPlayers,
                       "The maximum amount of players which can login to this server.")
         .def("get_player", py::overload_cast<std::string>(&Server::getPlayer, py::const_), py::arg("name").noconvert(),
@@ -234,6 +290,17 @@ void init_server(py::class_<Server> &server)
         .def("get_player", py::overload_cast<endstone::UUID>(&Server::getPlayer, py::const_),
              py::arg("unique_id").noconvert(), py::return_value_policy::reference,
              "Gets the player with the given UUID.")
+        .def("get_player_by_xuid", &Server::getPlayerByXuid, py::arg("xuid"), py::return_value_policy::reference,
+             "Gets the player with the given Xbox User ID (XUID).")
+        .def("get_player_by_runtime_id", &Server::getPlayerByRuntimeId, py::arg("runtime_id"),
+             py::return_value_policy::reference, "Gets the player with the given runtime id, as used in packets.")
+        .def("get_movement_anomalies", &Server::getMovementAnomalies, py::arg("max_speed"),
+             py::arg("max_acceleration"), py::return_value_policy::reference,
+             "Gets the players whose movement over the last second exceeded the given speed or acceleration.")
+        .def("get_packet_priority", &Server::getPacketPriority, py::arg("packet_id"),
+             "Gets the priority of the packets with the given id sent through the API.")
+        .def("set_packet_priority", &Server::setPacketPriority, py::arg("packet_id"), py::arg("priority"),
+             "Sets the priority of the packets with the given id sent through the API.")
         .def("shutdown", &Server::shutdown, "Shutdowns the server, stopping everything.")
         .def("reload", &Server::reload, "Reloads the server configuration, functions, scripts and plugins.")
         .def("reload_data", &Server::reloadData, "Reload only the Minecraft data for the server.")
@@ -244,6 +311,22 @@ void init_server(py::class_<Server> &server)
             [](const Server &server, const std::string &message) { server.broadcastMessage(message); },
             py::arg("message"),
             "Broadcasts the specified message to every user with permission endstone.broadcast.user")
+        .def(
+            "broadcast_packet",
+            [](const Server &server, Packet &packet, const std::optional<std::vector<Player *>> &recipients) {
+                if (recipients.has_value()) {
+                    server.broadcastPacket(packet, recipients.value());
+                }
+                else {
+                    server.broadcastPacket(packet, std::function<bool(const Player &)>{});
+                }
+            },
+            py::arg("packet"), py::arg("recipients") = std::nullopt,
+            "Sends a packet to the given players, or every online player, serializing it once for all of them.")
+        .def("translate", &Server::translate, py::arg("message"), py::arg("locale") = "",
+             "Translates a message on the server, for the given locale or the language of the server if empty.")
+        .def("send_translated", &Server::sendTranslated, py::arg("message"), py::arg("recipients"),
+             "Sends a message translated on the server to the given players, one packet per locale.")
         .def_property_readonly("scoreboard", &Server::getScoreboard,
                                "Gets the primary Scoreboard controlled by the server.",
                                py::return_value_policy::reference)
@@ -261,7 +344,20 @@ void init_server(py::class_<Server> &server)
                                "Gets the current tick usage of the server.")
         .def_property_readonly("average_tick_usage", &Server::getAverageTickUsage,
                                "Gets the average tick usage of the server.")
+        .def("get_tick_statistics", &Server::getTickStatistics, py::arg("window") = TickWindow::OneMinute,
+             "Gets the percentiles of the tick durations over a window of recent ticks.")
+        .def_property_readonly("wall_clock_tick", &Server::getWallClockTick,
+                               "Gets the tick the server would be at had every tick run on time.")
         .def_property_readonly("start_time", &Server::getStartTime, "Gets the start time of the server.")
+        .def_property("tick_consistent_actor_reads", &Server::isTickConsistentActorReads,
+                      &Server::setTickConsistentActorReads,
+                      "Whether actor state is read once per tick and reused by later reads in the same tick.")
+        .def("set_player_move_thresholds", &Server::setPlayerMoveThresholds, py::arg("distance"), py::arg("rotation"),
+             "Sets how far a player has to move, in blocks, or turn, in degrees, before a PlayerMoveEvent is fired.")
+        .def_property_readonly("player_move_distance_threshold", &Server::getPlayerMoveDistanceThreshold,
+                               "Gets how far a player has to move before a PlayerMoveEvent is fired.")
+        .def_property_readonly("player_move_rotation_threshold", &Server::getPlayerMoveRotationThreshold,
+                               "Gets how far a player has to turn before a PlayerMoveEvent is fired.")
         .def(
             "create_boss_bar",
             [](const Server &self, std::string title, BarColor color, BarStyle style,
@@ -272,8 +368,60 @@ void init_server(py::class_<Server> &server)
             "Creates a boss bar instance to display to players. The progress defaults to 1.0.");
 }
 
+namespace {
+// Wraps the shared pixel buffer in a read-only array that keeps the buffer alive, the pixels are never copied
+py::array_t<std::uint8_t> toImageArray(const Skin::ImageData &image)
+{
+    auto buffer = image.getBuffer();
+    auto height = static_cast<std::size_t>(std::max(image.height, 0));
+    auto width = static_cast<std::size_t>(std::max(image.width, 0));
+    if (!buffer || buffer->size() < height * width * 4) {
+        // The size comes from the client, never expose more than the buffer holds
+        buffer = std::make_shared<const std::string>();
+        height = width = 0;
+    }
+    const auto *data = reinterpret_cast<const std::uint8_t *>(buffer->data());
+    py::capsule owner(new std::shared_ptr<const std::string>(std::move(buffer)),
+                      [](void *p) { delete static_cast<std::shared_ptr<const std::string> *>(p); });
+    py::array_t<std::uint8_t> array({height, width, std::size_t{4}},
+                                    {sizeof(std::uint8_t) * width * 4, sizeof(std::uint8_t) * 4, sizeof(std::uint8_t)},
+                                    data, owner);
+    array.attr("setflags")(py::arg("write") = false);
+    return array;
+}
+}  // namespace
+
 void init_player(py::module_ &m, py::class_<Player, Mob> &player)
 {
+    py::class_<NetworkStats>(m, "NetworkStats", "Represents the network statistics of a player's connection.")
+        .def_readonly("bytes_sent", &NetworkStats::bytes_sent)
+        .def_readonly("bytes_received", &NetworkStats::bytes_received)
+        .def_readonly("bytes_sent_per_second", &NetworkStats::bytes_sent_per_second)
+        .def_readonly("bytes_received_per_second", &NetworkStats::bytes_received_per_second)
+        .def_readonly("bytes_resent", &NetworkStats::bytes_resent)
+        .def_readonly("packet_loss", &NetworkStats::packet_loss)
+        .def_readonly("packet_loss_total", &NetworkStats::packet_loss_total)
+        .def_readonly("send_queue_size", &NetworkStats::send_queue_size)
+        .def_readonly("resend_queue_size", &NetworkStats::resend_queue_size);
+
+    py::class_<MovementStats>(m, "MovementStats", "Represents the movement statistics of a player.")
+        .def_readonly("horizontal_speed", &MovementStats::horizontal_speed)
+        .def_readonly("vertical_speed", &MovementStats::vertical_speed)
+        .def_readonly("peak_horizontal_speed", &MovementStats::peak_horizontal_speed)
+        .def_readonly("peak_horizontal_acceleration", &MovementStats::peak_horizontal_acceleration);
+
+    py::class_<Player::Snapshot>(player, "Snapshot", "The state of a player as of the end of a server tick.")
+        .def_readonly("tick", &Player::Snapshot::tick)
+        .def_readonly("x", &Player::Snapshot::x)
+        .def_readonly("y", &Player::Snapshot::y)
+        .def_readonly("z", &Player::Snapshot::z)
+        .def_readonly("pitch", &Player::Snapshot::pitch)
+        .def_readonly("yaw", &Player::Snapshot::yaw)
+        .def_property_readonly(
+            "dimension", [](const Player::Snapshot &self) { return static_cast<Dimension::Type>(self.dimension); })
+        .def_readonly("game_mode", &Player::Snapshot::game_mode)
+        .def_property_readonly("ping", [](const Player::Snapshot &self) { return self.ping.count(); });
+
     py::class_<Skin>(m, "Skin")
         .def(py::init([](std::string skin_id, const py::array_t<std::uint8_t> &skin_data,
                          std::optional<std::string> cape_id, std::optional<py::array_t<std::uint8_t>> cape_data) {
@@ -300,13 +448,7 @@ void init_player(py::module_ &m, py::class_<Player, Mob> &player)
         .def_property_readonly("skin_id", &Skin::getSkinId, "Get the Skin ID.")
         .def_property_readonly(
             "skin_data",
-            [](const Skin &self) {
-                const auto &data = self.getSkinData();
-                return py::array_t<std::uint8_t>(py::buffer_info(
-                    const_cast<char *>(data.data.data()), sizeof(std::uint8_t),
-                    py::format_descriptor<std::uint8_t>::format(), 3, {data.height, data.width, 4},
-                    {sizeof(std::uint8_t) * data.width * 4, sizeof(std::uint8_t) * 4, sizeof(std::uint8_t)}));
-            },
+            [](const Skin &self) { return toImageArray(self.getSkinData()); },
             "Get the Skin data.")
         .def_property_readonly("cape_id", &Skin::getCapeId, "Get the Cape ID.")
         .def_property_readonly(
@@ -315,11 +457,7 @@ void init_player(py::module_ &m, py::class_<Player, Mob> &player)
                 if (!self.getCapeData().has_value()) {
                     return std::nullopt;
                 }
-                const auto &data = self.getCapeData().value();
-                return py::array_t<std::uint8_t>(py::buffer_info(
-                    const_cast<char *>(data.data.data()), sizeof(std::uint8_t),
-                    py::format_descriptor<std::uint8_t>::format(), 3, {data.height, data.width, 4},
-                    {sizeof(std::uint8_t) * data.width * 4, sizeof(std::uint8_t) * 4, sizeof(std::uint8_t)}));
+                return toImageArray(self.getCapeData().value());
             },
             "Get the Cape data.");
 
@@ -359,6 +497,12 @@ void init_player(py::module_ &m, py::class_<Player, Mob> &player)
         .def_property_readonly(
             "ping", [](const Player &self) { return self.getPing().count(); },
             "Gets the player's average ping in milliseconds.")
+        .def_property_readonly("network_stats", &Player::getNetworkStats,
+                               "Gets the statistics of the player's network connection.")
+        .def_property_readonly("movement_stats", &Player::getMovementStats,
+                               "Gets the statistics of the player's movement over the last second.")
+        .def_property_readonly("snapshot", &Player::getSnapshot,
+                               "Gets the state of the player as of the end of the last tick, from any thread.")
         .def("update_commands", &Player::updateCommands, "Send the list of commands to the client.")
         .def("perform_command", &Player::performCommand, py::arg("command"),
              "Makes the player perform the given command.")
@@ -370,11 +514,27 @@ void init_player(py::module_ &m, py::class_<Player, Mob> &player)
                                "Get the player's current device's operation system (OS).")
         .def_property_readonly("device_id", &Player::getDeviceId, "Get the player's current device id.")
         .def_property_readonly("skin", &Player::getSkin, "Get the player's skin.")
-        .def("transfer", &Player::transfer, "Transfers the player to another server.", py::arg("host"),
-             py::arg("port") = 19132)
+        .def_property("view_distance", &Player::getViewDistance, &Player::setViewDistance,
+                      "Gets or sets the maximum view distance of this player in chunks, or None if there is none.")
+        .def("hide_actor", &Player::hideActor, py::arg("actor"), "Hides an actor from this player.")
+        .def("show_actor", &Player::showActor, py::arg("actor"), "Shows an actor to this player that was hidden.")
+        .def("can_see", &Player::canSee, py::arg("actor"), "Checks whether this player can see an actor.")
+        .def_property("actor_cull_distance", &Player::getActorCullDistance, &Player::setActorCullDistance,
+                      "Gets or sets the distance in blocks beyond which actors are not shown to this player, or None.")
+        .def_property("bandwidth_limit", &Player::getBandwidthLimit, &Player::setBandwidthLimit,
+                      "Gets or sets the bandwidth limit in bytes per second of the packets sent to this player, or None.")
+        .def("transfer", py::overload_cast<std::string, int>(&Player::transfer, py::const_),
+             "Transfers the player to another server.", py::arg("host"), py::arg("port") = 19132)
+        .def("transfer", py::overload_cast<std::string, int, const std::string &>(&Player::transfer, py::const_),
+             "Transfers the player to another server of the network, handing off the data plugins store for the "
+             "player ahead of the connection.",
+             py::arg("host"), py::arg("port"), py::arg("server_id"))
         .def("send_form", &Player::sendForm, "Sends a form to the player.", py::arg("form"))
         .def("close_form", &Player::closeForm, "Closes the forms that are currently open for the player.")
-        .def("send_packet", &Player::sendPacket, py::arg("packet"), "Sends a packet to the player.");
+        .def("send_packet", &Player::sendPacket, py::arg("packet"), "Sends a packet to the player.")
+        .def("begin_batch", &Player::beginBatch, "Starts batching the packets sent to the player.")
+        .def("end_batch", &Player::endBatch,
+             "Ends a batch, sending the held packets and flushing them to the client in one network batch.");
 }
 
 }  // namespace endstone::detail
@@ -17,6 +17,7 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include "endstone/detail/pybind_type_caster.h"
 #include "endstone/event/actor/actor_death_event.h"
 #include "endstone/event/actor/actor_event.h"
 #include "endstone/event/actor/actor_remove_event.h"
@@ -26,6 +27,8 @@
 #include "endstone/event/block/block_event.h"
 #include "endstone/event/block/block_place_event.h"
 #include "endstone/event/event_priority.h"
+#include "endstone/event/player/async_player_chat_event.h"
+#include "endstone/event/player/player_batch_move_event.h"
 #include "endstone/event/player/player_chat_event.h"
 #include "endstone/event/player/player_command_event.h"
 #include "endstone/event/player/player_death_event.h"
@@ -34,9 +37,14 @@
 #include "endstone/event/player/player_interact_event.h"
 #include "endstone/event/player/player_join_event.h"
 #include "endstone/event/player/player_login_event.h"
+#include "endstone/event/player/player_move_event.h"
 #include "endstone/event/player/player_quit_event.h"
+#include "endstone/event/player/player_region_enter_event.h"
+#include "endstone/event/player/player_region_leave_event.h"
 #include "endstone/event/player/player_teleport_event.h"
 #include "endstone/event/server/broadcast_message_event.h"
+#include "endstone/event/server/packet_receive_event.h"
+#include "endstone/event/server/player_handoff_event.h"
 #include "endstone/event/server/plugin_disable_event.h"
 #include "endstone/event/server/plugin_enable_event.h"
 #include "endstone/event/server/server_command_event.h"
@@ -106,6 +114,15 @@ void init_event(py::module_ &m, py::class_<Event> &event, py::enum_<EventPriorit
     py::class_<PlayerChatEvent, PlayerEvent>(m, "PlayerChatEvent", "Called when a player sends a chat message.")
         .def_property("message", &PlayerChatEvent::getMessage, &PlayerChatEvent::setMessage,
                       "Gets or sets the message that the player will send.");
+    py::class_<AsyncPlayerChatEvent, Event>(m, "AsyncPlayerChatEvent",
+                                            "Called on the CPU workers when a player sends a chat message, after "
+                                            "PlayerChatEvent.")
+        .def_property_readonly("player_id", &AsyncPlayerChatEvent::getPlayerId,
+                               "Gets the UUID of the player that sent the message.")
+        .def_property_readonly("player_name", &AsyncPlayerChatEvent::getPlayerName,
+                               "Gets the name of the player that sent the message.")
+        .def_property("message", &AsyncPlayerChatEvent::getMessage, &AsyncPlayerChatEvent::setMessage,
+                      "Gets or sets the message that the player will send.");
     py::class_<PlayerCommandEvent, PlayerEvent>(m, "PlayerCommandEvent", "Called whenever a player runs a command.")
         .def_property("command", &PlayerCommandEvent::getCommand, &PlayerCommandEvent::setCommand,
                       "Gets or sets the command that the player will send.");
@@ -140,6 +157,32 @@ void init_event(py::module_ &m, py::class_<Event> &event, py::enum_<EventPriorit
         .def_property("to_location", &PlayerTeleportEvent::getTo, &PlayerTeleportEvent::setTo,
                       "Gets or sets the location that this player moved to.");
 
+    py::class_<PlayerMoveEvent, PlayerEvent>(
+        m, "PlayerMoveEvent", "Called when a player moves or turns further than the player movement thresholds.")
+        .def_property_readonly("from_location", &PlayerMoveEvent::getFrom, "Gets the location this player moved from.")
+        .def_property("to_location", &PlayerMoveEvent::getTo, &PlayerMoveEvent::setTo,
+                      "Gets or sets the location this player moved to.");
+
+    auto batch_move_event = py::class_<PlayerBatchMoveEvent, Event>(
+        m, "PlayerBatchMoveEvent", "Called once per tick with every player that moved further than the thresholds.");
+    py::class_<PlayerBatchMoveEvent::Movement>(batch_move_event, "Movement",
+                                               "Describes the movement of a single player.")
+        .def_readonly("player", &PlayerBatchMoveEvent::Movement::player, py::return_value_policy::reference)
+        .def_readonly("from_location", &PlayerBatchMoveEvent::Movement::from)
+        .def_readonly("to_location", &PlayerBatchMoveEvent::Movement::to);
+    batch_move_event.def_property_readonly("movements", &PlayerBatchMoveEvent::getMovements,
+                                           py::return_value_policy::reference_internal,
+                                           "Gets the movements of all players that moved this tick.");
+
+    py::class_<PlayerRegionEnterEvent, PlayerEvent>(m, "PlayerRegionEnterEvent",
+                                                    "Called when a player enters a region added with add_region.")
+        .def_property_readonly("region", &PlayerRegionEnterEvent::getRegion,
+                               "Gets the name of the region the player enters.");
+    py::class_<PlayerRegionLeaveEvent, PlayerEvent>(m, "PlayerRegionLeaveEvent",
+                                                    "Called when a player leaves a region added with add_region.")
+        .def_property_readonly("region", &PlayerRegionLeaveEvent::getRegion,
+                               "Gets the name of the region the player leaves.");
+
     py::class_<BroadcastMessageEvent, Event>(
         m, "BroadcastMessageEvent", "Event triggered for server broadcast messages such as from Server.broadcast")
         .def_property("message", &BroadcastMessageEvent::getMessage, &BroadcastMessageEvent::setMessage,
@@ -154,6 +197,25 @@ void init_event(py::module_ &m, py::class_<Event> &event, py::enum_<EventPriorit
     py::class_<PluginDisableEvent, Event>(m, "PluginDisableEvent", "Called when a plugin is disabled.")
         .def_property_readonly("plugin", &PluginDisableEvent::getPlugin, py::return_value_policy::reference);
 
+    py::class_<PacketReceiveEvent, Event>(m, "PacketReceiveEvent",
+                                          "Called when a packet is received from a client, before it is deserialized.")
+        .def_property_readonly("packet_id", &PacketReceiveEvent::getPacketId, "Gets the id of the packet received.")
+        .def_property_readonly("sub_client_id", &PacketReceiveEvent::getSubClientId,
+                               "Gets the id of the sub client that sent the packet.")
+        .def_property_readonly(
+            "payload", [](const PacketReceiveEvent &self) { return py::bytes(self.getPayload()); },
+            "Gets the serialized packet body following the packet header.");
+
+    py::class_<PlayerHandoffEvent, Event>(
+        m, "PlayerHandoffEvent",
+        "Called when another server of the network hands off a player it transfers to this server.")
+        .def_property_readonly("unique_id", &PlayerHandoffEvent::getUniqueId,
+                               "Gets the unique ID of the player being transferred.")
+        .def_property_readonly("player_name", &PlayerHandoffEvent::getPlayerName,
+                               "Gets the name of the player being transferred.")
+        .def_property_readonly("source_server_id", &PlayerHandoffEvent::getSourceServerId,
+                               "Gets the ID of the server the player is transferred from.");
+
     py::class_<ServerCommandEvent, Event>(m, "ServerCommandEvent",
                                           "Called when the console runs a command, early in the process.")
         .def_property_readonly("sender", &ServerCommandEvent::getSender, "Get the command sender.")
@@ -114,6 +114,9 @@ void init_form(py::module_ &m)
                       py::return_value_policy::reference)
         .def_property("on_submit", &MessageForm::getOnSubmit, &MessageForm::setOnSubmit,
                       "Gets or sets the on submit callback.", py::return_value_policy::reference)
+        .def_property("is_static", &MessageForm::isStatic, &MessageForm::setStatic,
+                      "Gets or sets whether the form is static, its JSON is then serialized once and reused.",
+                      py::return_value_policy::reference)
         .def_property("on_close", &MessageForm::getOnClose, &MessageForm::setOnClose,
                       "Gets or sets the on close callback.", py::return_value_policy::reference)
         .def_property("content", &MessageForm::getContent, &MessageForm::setContent,
@@ -153,6 +156,9 @@ void init_form(py::module_ &m)
                       py::return_value_policy::reference)
         .def_property("on_submit", &ActionForm::getOnSubmit, &ActionForm::setOnSubmit,
                       "Gets or sets the on submit callback.", py::return_value_policy::reference)
+        .def_property("is_static", &ActionForm::isStatic, &ActionForm::setStatic,
+                      "Gets or sets whether the form is static, its JSON is then serialized once and reused.",
+                      py::return_value_policy::reference)
         .def_property("on_close", &ActionForm::getOnClose, &ActionForm::setOnClose,
                       "Gets or sets the on close callback.", py::return_value_policy::reference)
         .def_property("content", &ActionForm::getContent, &ActionForm::setContent,
@@ -183,6 +189,9 @@ void init_form(py::module_ &m)
                       py::return_value_policy::reference)
         .def_property("on_submit", &ModalForm::getOnSubmit, &ModalForm::setOnSubmit,
                       "Gets or sets the on submit callback.", py::return_value_policy::reference)
+        .def_property("is_static", &ModalForm::isStatic, &ModalForm::setStatic,
+                      "Gets or sets whether the form is static, its JSON is then serialized once and reused.",
+                      py::return_value_policy::reference)
         .def_property("on_close", &ModalForm::getOnClose, &ModalForm::setOnClose, "Gets or sets the on close callback.",
                       py::return_value_policy::reference)
         .def_property("controls", &ModalForm::getControls, &ModalForm::setControls,
@@ -15,8 +15,10 @@
 #include "endstone/inventory/inventory.h"
 
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
 #include "endstone/inventory/item_stack.h"
+#include "endstone/inventory/item_stack_view.h"
 #include "endstone/inventory/player_inventory.h"
 
 namespace py = pybind11;
@@ -25,22 +27,36 @@ namespace endstone::detail {
 
 void init_inventory(py::module_ &m)
 {
+    py::class_<ItemStackView>(m, "ItemStackView", "A lightweight, non-owning snapshot of a stack of items.")
+        .def_property_readonly("type", &ItemStackView::getType, "Gets the type of this item.")
+        .def_property_readonly("amount", &ItemStackView::getAmount, "Gets the amount of items in this stack.")
+        .def_property_readonly("is_empty", &ItemStackView::isEmpty, "Checks whether this stack holds no items.");
+
     py::class_<ItemStack>(m, "ItemStack", "Represents a stack of items.")
         .def(py::init<std::string, int>(), py::arg("type") = "minecraft:air", py::arg("amount") = 1)
+        .def(py::init<const ItemStackView &>(), py::arg("view"))
 
         .def_property("type", &ItemStack::getType, &ItemStack::setType, "Gets or sets the type of this item.")
 
         .def_property("amount", &ItemStack::getAmount, &ItemStack::setAmount,
-                      "Gets or sets the amount of items in this stack.");
+                      "Gets or sets the amount of items in this stack.")
+
+        .def("view", &ItemStack::view, py::keep_alive<0, 1>(), "Gets a non-owning view of this item stack.");
 
     py::class_<Inventory>(m, "Inventory", "Interface to the various inventories.")
         .def_property_readonly("size", &Inventory::getSize, "Returns the size of the inventory")
         .def_property_readonly("max_stack_size", &Inventory::getMaxStackSize,
-                               "Returns the maximum stack size for an ItemStack in this inventory.");
+                               "Returns the maximum stack size for an ItemStack in this inventory.")
+        .def("get_item", &Inventory::getItem, py::arg("index"),
+             "Gets a view of the ItemStack found in the slot at the given index")
+        .def_property_readonly("contents", &Inventory::getContents,
+                               "Gets a view of every ItemStack in this inventory, in slot order");
 
     py::class_<PlayerInventory, Inventory>(
         m, "PlayerInventory",
-        "Interface to the inventory of a Player, including the four armor slots and any extra slots.");
+        "Interface to the inventory of a Player, including the four armor slots and any extra slots.")
+        .def_property_readonly("changed_slots", &PlayerInventory::getChangedSlots,
+                               "Gets the slots whose contents changed during the last tick, in ascending order");
 }
 
 }  // namespace endstone::detail
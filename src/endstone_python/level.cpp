@@ -14,12 +14,23 @@
 
 #include "endstone/level/level.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <pybind11/chrono.h>
+#include <pybind11/functional.h>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
 #include "endstone/level/dimension.h"
 #include "endstone/level/location.h"
 #include "endstone/level/position.h"
+#include "endstone/level/region_snapshot.h"
+#include "endstone/player.h"
+#include "endstone/plugin/plugin.h"
 
 namespace py = pybind11;
 
@@ -57,6 +68,45 @@ void init_level(py::module_ &m)
         .def("__repr__", location_to_string)
         .def("__str__", location_to_string);
 
+    py::class_<RegionSnapshot>(m, "RegionSnapshot",
+                               "A palette compressed copy of the blocks in a cuboid region of a Dimension.")
+        .def_readonly_static("MISSING", &RegionSnapshot::Missing)
+        .def_property_readonly("min_x", &RegionSnapshot::getMinX)
+        .def_property_readonly("min_y", &RegionSnapshot::getMinY)
+        .def_property_readonly("min_z", &RegionSnapshot::getMinZ)
+        .def_property_readonly("size_x", &RegionSnapshot::getSizeX)
+        .def_property_readonly("size_y", &RegionSnapshot::getSizeY)
+        .def_property_readonly("size_z", &RegionSnapshot::getSizeZ)
+        .def_property_readonly("palette", &RegionSnapshot::getPalette, "The block states used by the region")
+        .def_property_readonly("indices", &RegionSnapshot::getIndices,
+                               "Palette index of each block, with z varying fastest, then y, then x")
+        .def_property_readonly(
+            "index_array",
+            [](const py::object &self) {
+                const auto &snapshot = self.cast<const RegionSnapshot &>();
+                const auto &indices = snapshot.getIndices();
+                auto size_x = static_cast<std::size_t>(std::max(snapshot.getSizeX(), 0));
+                auto size_y = static_cast<std::size_t>(std::max(snapshot.getSizeY(), 0));
+                auto size_z = static_cast<std::size_t>(std::max(snapshot.getSizeZ(), 0));
+                if (indices.size() != size_x * size_y * size_z) {
+                    size_x = size_y = size_z = 0;
+                }
+                // Shares the indices of the snapshot, which the array keeps alive through its base
+                constexpr auto item = sizeof(std::uint16_t);
+                py::array_t<std::uint16_t> array({size_x, size_y, size_z},
+                                                 {size_y * size_z * item, size_z * item, item}, indices.data(), self);
+                array.attr("setflags")(py::arg("write") = false);
+                return array;
+            },
+            "Palette index of each block as a read-only uint16 array of shape (size_x, size_y, size_z), without "
+            "copying the snapshot")
+        .def(
+            "serialize", [](const RegionSnapshot &self) { return py::bytes(self.serialize()); },
+            "Encodes this snapshot into a compact binary form, e.g. to be saved to disk.")
+        .def_static(
+            "deserialize", [](const py::bytes &data) { return RegionSnapshot::deserialize(std::string(data)); },
+            py::arg("data"), "Decodes a snapshot produced by serialize(), returns None if the data is malformed.");
+
     py::enum_<Dimension::Type>(dimension, "Type", "Represents various dimension types.")
         .value("OVERWORLD", Dimension::Type::Overworld)
         .value("NETHER", Dimension::Type::Nether)
@@ -64,6 +114,26 @@ void init_level(py::module_ &m)
         .value("CUSTOM", Dimension::Type::Custom)
         .export_values();
 
+    py::class_<Dimension::ParticleEffect>(dimension, "ParticleEffect", "A particle effect to spawn with spawn_particles.")
+        .def(py::init([](std::string effect_name, Vector<float> position,
+                         std::optional<std::string> molang_variables_json) {
+                 return Dimension::ParticleEffect{std::move(effect_name), position, std::move(molang_variables_json)};
+             }),
+             py::arg("effect_name"), py::arg("position"), py::arg("molang_variables_json") = py::none())
+        .def_readwrite("effect_name", &Dimension::ParticleEffect::effect_name)
+        .def_readwrite("position", &Dimension::ParticleEffect::position)
+        .def_readwrite("molang_variables_json", &Dimension::ParticleEffect::molang_variables_json);
+
+    py::class_<Dimension::PregenerationProgress>(dimension, "PregenerationProgress",
+                                                 "Describes how far a chunk pre-generation run has got.")
+        .def_readonly("center_x", &Dimension::PregenerationProgress::center_x)
+        .def_readonly("center_z", &Dimension::PregenerationProgress::center_z)
+        .def_readonly("radius", &Dimension::PregenerationProgress::radius)
+        .def_readonly("completed", &Dimension::PregenerationProgress::completed)
+        .def_readonly("total", &Dimension::PregenerationProgress::total)
+        .def_readonly("chunks_per_second", &Dimension::PregenerationProgress::chunks_per_second)
+        .def_readonly("eta", &Dimension::PregenerationProgress::eta);
+
     dimension.def_property_readonly("name", &Dimension::getName, "Gets the name of this dimension")
         .def_property_readonly("type", &Dimension::getType, "Gets the type of this dimension")
         .def_property_readonly("level", &Dimension::getLevel, "Gets the level to which this dimension belongs",
@@ -71,16 +141,112 @@ void init_level(py::module_ &m)
         .def("get_block_at", py::overload_cast<int, int, int>(&Dimension::getBlockAt), py::arg("x"), py::arg("y"),
              py::arg("z"), "Gets the Block at the given coordinates")
         .def("get_block_at", py::overload_cast<Location>(&Dimension::getBlockAt), py::arg("location"),
-             "Gets the Block at the given Location");
+             "Gets the Block at the given Location")
+        .def("get_blocks", &Dimension::getBlocks, py::arg("x1"), py::arg("y1"), py::arg("z1"), py::arg("x2"),
+             py::arg("y2"), py::arg("z2"),
+             "Gets all the Blocks in the region between two corners, skipping chunks that are not loaded")
+        .def(
+            "set_blocks",
+            [](Dimension &self, int x1, int y1, int z1, int x2, int y2, int z2, const std::vector<std::string> &palette,
+               const py::array_t<std::uint16_t, py::array::c_style> &indices, bool apply_physics) {
+                std::vector<std::uint16_t> values(indices.data(), indices.data() + indices.size());
+                return self.setBlocks(x1, y1, z1, x2, y2, z2, palette, values, apply_physics);
+            },
+            py::arg("x1"), py::arg("y1"), py::arg("z1"), py::arg("x2"), py::arg("y2"), py::arg("z2"),
+            py::arg("palette"), py::arg("indices").noconvert(), py::arg("apply_physics") = true,
+            "Sets every Block in the region between two corners from a palette, indexed by a contiguous uint16 array "
+            "with z varying fastest, then y, then x. Returns the number of blocks changed, or -1 if the palette or "
+            "indices are invalid")
+        .def("set_blocks", &Dimension::setBlocks, py::arg("x1"), py::arg("y1"), py::arg("z1"), py::arg("x2"),
+             py::arg("y2"), py::arg("z2"), py::arg("palette"), py::arg("indices"), py::arg("apply_physics") = true,
+             "Sets every Block in the region between two corners from a palette, indexed with z varying fastest, "
+             "then y, then x. Returns the number of blocks changed, or -1 if the palette or indices are invalid")
+        .def("snapshot_region", &Dimension::snapshotRegion, py::arg("x1"), py::arg("y1"), py::arg("z1"), py::arg("x2"),
+             py::arg("y2"), py::arg("z2"), "Takes a snapshot of every Block in the region between two corners")
+        .def("restore_region", &Dimension::restoreRegion, py::arg("snapshot"),
+             "Restores a region to a snapshot, changing only the blocks that differ. Returns the number of blocks "
+             "changed, or -1 if the snapshot is invalid")
+        .def("get_nearby_actors",
+             py::overload_cast<float, float, float, float>(&Dimension::getNearbyActors, py::const_), py::arg("x"),
+             py::arg("y"), py::arg("z"), py::arg("radius"),
+             "Gets all the Actors within a radius of the given coordinates", py::return_value_policy::reference)
+        .def("add_region", &Dimension::addRegion, py::arg("name"), py::arg("x1"), py::arg("y1"), py::arg("z1"),
+             py::arg("x2"), py::arg("y2"), py::arg("z2"),
+             "Adds a named region covering the blocks between two corners. Returns False if the name is taken")
+        .def("remove_region", &Dimension::removeRegion, py::arg("name"),
+             "Removes a named region. Returns True if the region existed")
+        .def("get_regions_at", &Dimension::getRegionsAt, py::arg("x"), py::arg("y"), py::arg("z"),
+             "Gets the names of the regions containing the given coordinates")
+        .def("get_regions", &Dimension::getRegions, py::arg("x1"), py::arg("y1"), py::arg("z1"), py::arg("x2"),
+             py::arg("y2"), py::arg("z2"), "Gets the names of the regions overlapping the blocks between two corners")
+        .def("is_chunk_loaded", &Dimension::isChunkLoaded, py::arg("x"), py::arg("z"),
+             "Checks whether the chunk at the given chunk coordinates is loaded")
+        .def("add_chunk_ticket", &Dimension::addChunkTicket, py::arg("x"), py::arg("z"), py::arg("plugin"),
+             "Adds a ticket that keeps the chunk at the given chunk coordinates loaded until it is removed")
+        .def("remove_chunk_ticket", &Dimension::removeChunkTicket, py::arg("x"), py::arg("z"), py::arg("plugin"),
+             "Removes the ticket a plugin holds on the chunk at the given chunk coordinates")
+        .def("remove_chunk_tickets", &Dimension::removeChunkTickets, py::arg("plugin"),
+             "Removes all the tickets a plugin holds in this dimension")
+        .def("get_chunk_tickets", &Dimension::getChunkTickets, py::arg("plugin"),
+             "Gets the coordinates of the chunks a plugin holds tickets on in this dimension")
+        .def("start_pregeneration", &Dimension::startPregeneration, py::arg("center_x"), py::arg("center_z"),
+             py::arg("radius"), py::arg("target_usage") = 0.8,
+             "Starts generating every chunk in a square around a center chunk, throttled to a target tick usage")
+        .def("stop_pregeneration", &Dimension::stopPregeneration,
+             "Stops the chunk pre-generation run of this dimension and discards its checkpoint")
+        .def_property_readonly("pregeneration_progress", &Dimension::getPregenerationProgress,
+                               "Gets the progress of the chunk pre-generation run of this dimension, if any")
+        .def("set_actor_limit", py::overload_cast<const std::string &, int, int>(&Dimension::setActorLimit),
+             py::arg("type"), py::arg("per_chunk"), py::arg("per_dimension"),
+             "Caps the number of actors of a type in each chunk and in the whole dimension, negative for no cap")
+        .def("get_actor_count", &Dimension::getActorCount, py::arg("type"),
+             "Gets the number of actors of a type in this dimension, players excluded")
+        .def_property_readonly("actor_counts", &Dimension::getActorCounts,
+                               "Gets the number of actors of each type in this dimension as (type, count) tuples")
+        .def("spawn_particles", &Dimension::spawnParticles, py::arg("particles"),
+             py::arg("viewers") = std::vector<Player *>{}, py::arg("radius") = 64.0F,
+             "Spawns a batch of particle effects, each sent only to the viewers within the radius of it. Every player "
+             "in this dimension is a viewer if none are given");
 
     level.def_property_readonly("name", &Level::getName, "Gets the unique name of this level")
         .def_property_readonly("actors", &Level::getActors, "Get a list of all actors in this level",
                                py::return_value_policy::reference_internal)
+        .def(
+            "actor_positions",
+            [](const Level &self) {
+                std::vector<float> positions;
+                self.forEachActor([&positions](Actor &actor) {
+                    const auto location = actor.getLocation();
+                    positions.insert(positions.end(), {location.getX(), location.getY(), location.getZ()});
+                    return true;
+                });
+                py::array_t<float> array({positions.size() / 3, std::size_t{3}});
+                std::copy(positions.begin(), positions.end(), array.mutable_data());
+                return array;
+            },
+            "Gets the position of every actor in this level as an N x 3 float32 array, in the same order as "
+            "actor_runtime_ids() within a tick")
+        .def(
+            "actor_runtime_ids",
+            [](const Level &self) {
+                std::vector<std::uint64_t> ids;
+                self.forEachActor([&ids](Actor &actor) {
+                    ids.push_back(actor.getRuntimeId());
+                    return true;
+                });
+                py::array_t<std::uint64_t> array(static_cast<py::ssize_t>(ids.size()));
+                std::copy(ids.begin(), ids.end(), array.mutable_data());
+                return array;
+            },
+            "Gets the runtime id of every actor in this level as a uint64 array, in the same order as "
+            "actor_positions() within a tick")
         .def_property("time", &Level::getTime, &Level::setTime, "Gets and sets the relative in-game time on the server")
         .def_property_readonly("dimensions", &Level::getDimensions, "Gets a list of all dimensions within this level.",
                                py::return_value_policy::reference_internal)
         .def("get_dimension", &Level::getDimension, py::arg("name"), "Gets the dimension with the given name.",
-             py::return_value_policy::reference);
+             py::return_value_policy::reference)
+        .def("backup", &Level::backup, py::arg("plugin"), py::arg("destination"), py::arg("callback"),
+             "Copies the level to a directory while the server keeps running.");
 }
 
 }  // namespace endstone::detail
@@ -0,0 +1,58 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/messaging/messenger.h"
+
+#include <pybind11/functional.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include "endstone/plugin/plugin.h"
+
+namespace py = pybind11;
+
+namespace endstone::detail {
+
+void init_messaging(py::module_ &m)
+{
+    py::class_<Messenger>(m, "Messenger",
+                          "Publishes messages to, and receives them from, the other servers of a network on named "
+                          "channels.")
+        .def(
+            "publish",
+            [](Messenger &self, const std::string &channel, const py::bytes &message) {
+                self.publish(channel, std::string(message));
+            },
+            py::arg("channel"), py::arg("message"), "Sends a message to the other servers subscribed to the channel.")
+        .def(
+            "subscribe",
+            [](Messenger &self, Plugin &plugin, const std::string &channel,
+               const std::function<void(const std::string &, const py::bytes &)> &handler) {
+                self.subscribe(plugin, channel, [handler](const std::string &channel, const std::string &message) {
+                    py::gil_scoped_acquire gil{};
+                    handler(channel, py::bytes(message));
+                });
+            },
+            py::arg("plugin"), py::arg("channel"), py::arg("handler"),
+            "Subscribes a plugin to a channel, replacing its previous handler for it. The handler is called with the "
+            "channel and the message on the server thread.")
+        .def("unsubscribe", &Messenger::unsubscribe, py::arg("plugin"), py::arg("channel"),
+             "Unsubscribes a plugin from a channel.")
+        .def("unregister", &Messenger::unregister, py::arg("plugin"),
+             "Unsubscribes a plugin from every channel, and removes the transport it set.")
+        .def_property_readonly("server_id", &Messenger::getServerId,
+                               "Gets the ID this server publishes its messages with.");
+}
+
+}  // namespace endstone::detail
@@ -16,9 +16,17 @@
 #include <pybind11/stl.h>
 
 // must be included after pybind11
+#include "endstone/network/boss_event_packet.h"
+#include "endstone/network/move_actor_absolute_packet.h"
 #include "endstone/network/packet.h"
+#include "endstone/network/packet_priority.h"
 #include "endstone/network/packet_type.h"
+#include "endstone/network/remove_actor_packet.h"
+#include "endstone/network/set_score_packet.h"
+#include "endstone/network/set_title_packet.h"
 #include "endstone/network/spawn_particle_effect_packet.h"
+#include "endstone/network/text_packet.h"
+#include "endstone/network/toast_request_packet.h"
 
 namespace py = pybind11;
 
@@ -27,7 +35,19 @@ namespace endstone::detail {
 void init_network(py::module_ &m)
 {
     py::enum_<PacketType>(m, "PacketType", "Represents the types of packets.")
-        .value("SPAWN_PARTICLE_EFFECT", PacketType::SpawnParticleEffect);
+        .value("TEXT", PacketType::Text)
+        .value("REMOVE_ACTOR", PacketType::RemoveActor)
+        .value("MOVE_ACTOR_ABSOLUTE", PacketType::MoveActorAbsolute)
+        .value("BOSS_EVENT", PacketType::BossEvent)
+        .value("SET_TITLE", PacketType::SetTitle)
+        .value("SET_SCORE", PacketType::SetScore)
+        .value("SPAWN_PARTICLE_EFFECT", PacketType::SpawnParticleEffect)
+        .value("TOAST_REQUEST", PacketType::ToastRequest);
+
+    py::enum_<PacketPriority>(m, "PacketPriority", "Represents the priorities of the packets sent to a player.")
+        .value("CRITICAL", PacketPriority::Critical)
+        .value("NORMAL", PacketPriority::Normal)
+        .value("BULK", PacketPriority::Bulk);
 
     py::class_<Packet>(m, "Packet", "Represents a packet.")
         .def_property_readonly("type", &Packet::getType, "Gets the type of the packet.");
@@ -40,6 +60,119 @@ void init_network(py::module_ &m)
         .def_readwrite("position", &SpawnParticleEffectPacket::position)
         .def_readwrite("effect_name", &SpawnParticleEffectPacket::effect_name)
         .def_readwrite("molang_variables_json", &SpawnParticleEffectPacket::molang_variables_json);
+
+    auto text_packet =
+        py::class_<TextPacket, Packet>(m, "TextPacket", "Represents a packet for sending a chat message.");
+    py::enum_<TextPacket::TextType>(text_packet, "TextType")
+        .value("RAW", TextPacket::TextType::Raw)
+        .value("CHAT", TextPacket::TextType::Chat)
+        .value("TRANSLATION", TextPacket::TextType::Translation)
+        .value("POPUP", TextPacket::TextType::Popup)
+        .value("JUKEBOX_POPUP", TextPacket::TextType::JukeboxPopup)
+        .value("TIP", TextPacket::TextType::Tip)
+        .value("SYSTEM", TextPacket::TextType::System)
+        .value("WHISPER", TextPacket::TextType::Whisper)
+        .value("ANNOUNCEMENT", TextPacket::TextType::Announcement)
+        .value("OBJECT_WHISPER", TextPacket::TextType::ObjectWhisper)
+        .value("OBJECT", TextPacket::TextType::Object)
+        .value("OBJECT_ANNOUNCEMENT", TextPacket::TextType::ObjectAnnouncement);
+    text_packet.def(py::init<>())
+        .def_readwrite("text_type", &TextPacket::text_type)
+        .def_readwrite("needs_translation", &TextPacket::needs_translation)
+        .def_readwrite("source_name", &TextPacket::source_name)
+        .def_readwrite("message", &TextPacket::message)
+        .def_readwrite("parameters", &TextPacket::parameters)
+        .def_readwrite("xuid", &TextPacket::xuid)
+        .def_readwrite("platform_id", &TextPacket::platform_id)
+        .def_readwrite("filtered_message", &TextPacket::filtered_message);
+
+    auto set_title_packet =
+        py::class_<SetTitlePacket, Packet>(m, "SetTitlePacket", "Represents a packet for showing titles.");
+    py::enum_<SetTitlePacket::TitleType>(set_title_packet, "TitleType")
+        .value("CLEAR", SetTitlePacket::TitleType::Clear)
+        .value("RESET", SetTitlePacket::TitleType::Reset)
+        .value("TITLE", SetTitlePacket::TitleType::Title)
+        .value("SUBTITLE", SetTitlePacket::TitleType::Subtitle)
+        .value("ACTION_BAR", SetTitlePacket::TitleType::ActionBar)
+        .value("TIMES", SetTitlePacket::TitleType::Times)
+        .value("TITLE_TEXT_OBJECT", SetTitlePacket::TitleType::TitleTextObject)
+        .value("SUBTITLE_TEXT_OBJECT", SetTitlePacket::TitleType::SubtitleTextObject)
+        .value("ACTION_BAR_TEXT_OBJECT", SetTitlePacket::TitleType::ActionBarTextObject);
+    set_title_packet.def(py::init<>())
+        .def_readwrite("title_type", &SetTitlePacket::title_type)
+        .def_readwrite("text", &SetTitlePacket::text)
+        .def_readwrite("fade_in_time", &SetTitlePacket::fade_in_time)
+        .def_readwrite("stay_time", &SetTitlePacket::stay_time)
+        .def_readwrite("fade_out_time", &SetTitlePacket::fade_out_time)
+        .def_readwrite("xuid", &SetTitlePacket::xuid)
+        .def_readwrite("platform_online_id", &SetTitlePacket::platform_online_id)
+        .def_readwrite("filtered_text", &SetTitlePacket::filtered_text);
+
+    py::class_<ToastRequestPacket, Packet>(m, "ToastRequestPacket",
+                                           "Represents a packet for showing a toast notification.")
+        .def(py::init<>())
+        .def_readwrite("title", &ToastRequestPacket::title)
+        .def_readwrite("content", &ToastRequestPacket::content);
+
+    py::class_<RemoveActorPacket, Packet>(m, "RemoveActorPacket",
+                                          "Represents a packet for removing an actor from the client.")
+        .def(py::init<>())
+        .def_readwrite("actor_unique_id", &RemoveActorPacket::actor_unique_id);
+
+    py::class_<MoveActorAbsolutePacket, Packet>(m, "MoveActorAbsolutePacket",
+                                                "Represents a packet for moving an actor to an absolute position.")
+        .def(py::init<>())
+        .def_readwrite("actor_runtime_id", &MoveActorAbsolutePacket::actor_runtime_id)
+        .def_readwrite("position", &MoveActorAbsolutePacket::position)
+        .def_readwrite("pitch", &MoveActorAbsolutePacket::pitch)
+        .def_readwrite("yaw", &MoveActorAbsolutePacket::yaw)
+        .def_readwrite("head_yaw", &MoveActorAbsolutePacket::head_yaw)
+        .def_readwrite("on_ground", &MoveActorAbsolutePacket::on_ground)
+        .def_readwrite("teleported", &MoveActorAbsolutePacket::teleported)
+        .def_readwrite("force_move", &MoveActorAbsolutePacket::force_move);
+
+    auto boss_event_packet =
+        py::class_<BossEventPacket, Packet>(m, "BossEventPacket", "Represents a packet for updating a boss bar.");
+    py::enum_<BossEventPacket::EventType>(boss_event_packet, "EventType")
+        .value("ADD", BossEventPacket::EventType::Add)
+        .value("PLAYER_ADDED", BossEventPacket::EventType::PlayerAdded)
+        .value("REMOVE", BossEventPacket::EventType::Remove)
+        .value("PLAYER_REMOVED", BossEventPacket::EventType::PlayerRemoved)
+        .value("UPDATE_PERCENT", BossEventPacket::EventType::UpdatePercent)
+        .value("UPDATE_NAME", BossEventPacket::EventType::UpdateName)
+        .value("UPDATE_PROPERTIES", BossEventPacket::EventType::UpdateProperties)
+        .value("UPDATE_STYLE", BossEventPacket::EventType::UpdateStyle)
+        .value("QUERY", BossEventPacket::EventType::Query);
+    boss_event_packet.def(py::init<>())
+        .def_readwrite("boss_actor_id", &BossEventPacket::boss_actor_id)
+        .def_readwrite("event_type", &BossEventPacket::event_type)
+        .def_readwrite("player_actor_id", &BossEventPacket::player_actor_id)
+        .def_readwrite("title", &BossEventPacket::title)
+        .def_readwrite("progress", &BossEventPacket::progress)
+        .def_readwrite("darken_sky", &BossEventPacket::darken_sky)
+        .def_readwrite("color", &BossEventPacket::color)
+        .def_readwrite("style", &BossEventPacket::style);
+
+    auto set_score_packet =
+        py::class_<SetScorePacket, Packet>(m, "SetScorePacket", "Represents a packet for changing or removing scores.");
+    py::enum_<SetScorePacket::Action>(set_score_packet, "Action")
+        .value("CHANGE", SetScorePacket::Action::Change)
+        .value("REMOVE", SetScorePacket::Action::Remove);
+    py::enum_<SetScorePacket::IdentityType>(set_score_packet, "IdentityType")
+        .value("PLAYER", SetScorePacket::IdentityType::Player)
+        .value("ACTOR", SetScorePacket::IdentityType::Actor)
+        .value("FAKE_PLAYER", SetScorePacket::IdentityType::FakePlayer);
+    py::class_<SetScorePacket::Entry>(set_score_packet, "Entry", "Represents a single score entry.")
+        .def(py::init<>())
+        .def_readwrite("scoreboard_id", &SetScorePacket::Entry::scoreboard_id)
+        .def_readwrite("objective_name", &SetScorePacket::Entry::objective_name)
+        .def_readwrite("score", &SetScorePacket::Entry::score)
+        .def_readwrite("identity_type", &SetScorePacket::Entry::identity_type)
+        .def_readwrite("actor_id", &SetScorePacket::Entry::actor_id)
+        .def_readwrite("fake_player_name", &SetScorePacket::Entry::fake_player_name);
+    set_score_packet.def(py::init<>())
+        .def_readwrite("action", &SetScorePacket::action)
+        .def_readwrite("entries", &SetScorePacket::entries);
 }
 
 }  // namespace endstone::detail
@@ -0,0 +1,57 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/persistence/player_data_store.h"
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include "endstone/detail/pybind_type_caster.h"
+#include "endstone/plugin/plugin.h"
+
+namespace py = pybind11;
+
+namespace endstone::detail {
+
+void init_persistence(py::module_ &m)
+{
+    py::class_<PlayerDataStore>(m, "PlayerDataStore",
+                                "Stores blobs of data per player, in a namespace per plugin, and persists them in the "
+                                "background.")
+        .def(
+            "get",
+            [](const PlayerDataStore &self, const Plugin &plugin, const UUID &player_id,
+               const std::string &key) -> std::optional<py::bytes> {
+                auto value = self.get(plugin, player_id, key);
+                if (!value) {
+                    return std::nullopt;
+                }
+                return py::bytes(*value);
+            },
+            py::arg("plugin"), py::arg("player_id"), py::arg("key"), "Gets a value stored for a player.")
+        .def(
+            "set",
+            [](PlayerDataStore &self, const Plugin &plugin, const UUID &player_id, const std::string &key,
+               const py::bytes &value) { self.set(plugin, player_id, key, std::string(value)); },
+            py::arg("plugin"), py::arg("player_id"), py::arg("key"), py::arg("value"),
+            "Stores a value for a player, replacing the previous one.")
+        .def("remove", &PlayerDataStore::remove, py::arg("plugin"), py::arg("player_id"), py::arg("key"),
+             "Removes a value stored for a player.")
+        .def("get_keys", &PlayerDataStore::getKeys, py::arg("plugin"), py::arg("player_id"),
+             "Gets the keys of all the values a plugin stores for a player.")
+        .def("flush", &PlayerDataStore::flush,
+             "Hands the queued writes to the I/O workers now rather than with the next batch.");
+}
+
+}  // namespace endstone::detail
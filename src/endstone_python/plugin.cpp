@@ -14,7 +14,12 @@
 
 #include "endstone/plugin/plugin.h"
 
+#include <array>
+#include <atomic>
+#include <memory>
+#include <typeinfo>
 #include <utility>
+#include <vector>
 
 #include <pybind11/functional.h>
 #include <pybind11/pybind11.h>
@@ -88,6 +93,23 @@ public:
             return {};
         }
     }
+
+    void disablePlugin(Plugin &plugin) const override
+    {
+        PYBIND11_OVERRIDE_NAME(void, PluginLoader, "disable_plugin", disablePlugin, std::ref(plugin));
+    }
+
+    Plugin *reloadPlugin(Plugin &plugin) override
+    {
+        try {
+            PYBIND11_OVERRIDE_NAME(Plugin *, PluginLoader, "reload_plugin", reloadPlugin, std::ref(plugin));
+        }
+        catch (std::exception &e) {
+            server_.getLogger().error("Error occurred when trying to reload plugin '{}': {}", plugin.getName(),
+                                      e.what());
+            return nullptr;
+        }
+    }
 };
 
 namespace {
@@ -117,6 +139,123 @@ PluginDescription createPluginDescription(
             commands.value_or(std::vector<Command>{}),
             permissions.value_or(std::vector<Permission>{})};
 }
+
+/**
+ * Casts an event to Python through the registered type of its class, which is looked up once per event type rather
+ * than through the polymorphic type lookup of pybind11 on every dispatch.
+ */
+py::object castEvent(Event &event)
+{
+    static constexpr std::size_t CacheSize = 256;
+    static std::array<std::atomic<const py::detail::type_info *>, CacheSize> types;
+
+    const auto id = event.getEventTypeSlot().load(std::memory_order_relaxed);
+    if (id >= CacheSize) {
+        return py::cast(&event, py::return_value_policy::reference);
+    }
+
+    const auto &event_type = typeid(event);
+    const auto *type = types[id].load(std::memory_order_acquire);
+    if (type == nullptr || *type->cpptype != event_type) {
+        type = py::detail::get_type_info(event_type);
+        if (type == nullptr) {
+            // Not bound to Python as its own class, pybind11 falls back to the closest bound base
+            return py::cast(&event, py::return_value_policy::reference);
+        }
+        types[id].store(type, std::memory_order_release);
+    }
+    return py::reinterpret_steal<py::object>(py::detail::type_caster_generic::cast(
+        dynamic_cast<const void *>(&event), py::return_value_policy::reference, py::handle(), type, nullptr, nullptr));
+}
+
+/**
+ * Holds the GIL and the Python object of the event while consecutive Python handlers are called.
+ */
+class PythonDispatchScope : public EventDispatchScope {
+public:
+    struct Frame {
+        Event *event;
+        py::gil_scoped_acquire gil;
+        py::object object;
+    };
+
+    void enter(Event &event) override
+    {
+        // The frame is only pushed once complete, a failed cast releases the GIL again and leaves the stack as is
+        auto frame = std::make_unique<Frame>();
+        frame->event = &event;
+        frame->object = castEvent(event);
+        frames().push_back(std::move(frame));
+    }
+
+    void exit(Event & /*event*/) noexcept override
+    {
+        frames().pop_back();
+    }
+
+    /**
+     * Gets the entered frame of the given event on this thread, if any
+     */
+    static Frame *current(Event &event)
+    {
+        auto &frames = PythonDispatchScope::frames();
+        if (frames.empty() || frames.back()->event != &event) {
+            return nullptr;
+        }
+        return frames.back().get();
+    }
+
+    static const std::shared_ptr<EventDispatchScope> &get()
+    {
+        static const std::shared_ptr<EventDispatchScope> scope = std::make_shared<PythonDispatchScope>();
+        return scope;
+    }
+
+private:
+    // Events may be dispatched from within a Python handler, so entered frames are kept as a stack
+    static std::vector<std::unique_ptr<Frame>> &frames()
+    {
+        thread_local std::vector<std::unique_ptr<Frame>> frames;
+        return frames;
+    }
+};
+
+/**
+ * Calls a Python handler, reusing the GIL and the event object of the entered PythonDispatchScope.
+ */
+class PythonEventExecutor {
+public:
+    explicit PythonEventExecutor(py::function func) : func_(std::move(func)) {}
+
+    PythonEventExecutor(const PythonEventExecutor &other)
+    {
+        py::gil_scoped_acquire gil{};
+        func_ = other.func_;
+    }
+
+    PythonEventExecutor(PythonEventExecutor &&other) noexcept = default;
+
+    ~PythonEventExecutor()
+    {
+        if (func_) {
+            py::gil_scoped_acquire gil{};
+            func_ = py::function();
+        }
+    }
+
+    void operator()(Event &event) const
+    {
+        if (auto *frame = PythonDispatchScope::current(event)) {
+            func_(frame->object);
+            return;
+        }
+        py::gil_scoped_acquire gil{};
+        func_(castEvent(event));
+    }
+
+private:
+    py::function func_;
+};
 }  // namespace
 
 void init_plugin(py::module &m)
@@ -199,7 +338,9 @@ void init_plugin(py::module &m)
         .def("load_plugins", &PluginLoader::loadPlugins, py::arg("directory"),
              py::return_value_policy::reference_internal, "Loads the plugin contained within the specified directory")
         .def("enable_plugin", &PluginLoader::enablePlugin, py::arg("plugin"), "Enables the specified plugin")
-        .def("disable_plugin", &PluginLoader::enablePlugin, py::arg("plugin"), "Disables the specified plugin")
+        .def("disable_plugin", &PluginLoader::disablePlugin, py::arg("plugin"), "Disables the specified plugin")
+        .def("reload_plugin", &PluginLoader::reloadPlugin, py::arg("plugin"), py::return_value_policy::reference,
+             "Unloads the specified plugin and loads it again from the same source")
         .def_property_readonly("server", &PluginLoader::getServer, py::return_value_policy::reference,
                                "Retrieves the Server object associated with the PluginLoader.");
 
@@ -223,10 +364,11 @@ void init_plugin(py::module &m)
              "Calls an event which will be passed to plugins.")
         .def(
             "register_event",
-            [](PluginManager &self, std::string event, const std::function<void(Event *)> &executor,
-               EventPriority priority, Plugin &plugin, bool ignore_cancelled) {
-                self.registerEvent(
-                    std::move(event), [executor](Event &e) { executor(&e); }, priority, plugin, ignore_cancelled);
+            [](PluginManager &self, std::string event, py::function executor, EventPriority priority, Plugin &plugin,
+               bool ignore_cancelled) {
+                EventExecutor handler{PythonEventExecutor(std::move(executor))};
+                handler.setScope(PythonDispatchScope::get());
+                self.registerEvent(std::move(event), std::move(handler), priority, plugin, ignore_cancelled);
             },
             py::arg("name"), py::arg("executor"), py::arg("priority"), py::arg("plugin"), py::arg("ignore_cancelled"),
             "Registers the given event")
@@ -262,6 +404,8 @@ void init_plugin(py::module &m)
         .def_property("executor", &PluginCommand::getExecutor,
                       py::cpp_function(&PluginCommand::setExecutor, py::keep_alive<1, 2>()),
                       py::return_value_policy::reference, "The CommandExecutor to run when parsing this command")
+        .def_property("is_async", &PluginCommand::isAsync, &PluginCommand::setAsync,
+                      "Whether the executor of this command runs on the I/O workers of the scheduler")
         .def_property_readonly("plugin", &PluginCommand::getPlugin, "The owner of this PluginCommand");
 }
 
@@ -14,6 +14,10 @@
 
 #include "endstone/scheduler/scheduler.h"
 
+#include <optional>
+#include <utility>
+
+#include <pybind11/chrono.h>
 #include <pybind11/functional.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
@@ -24,20 +28,68 @@ namespace py = pybind11;
 
 namespace endstone::detail {
 
+namespace {
+// Tasks that hold the GIL only take turns on a pool, so they get a worker of their own unless the GIL is disabled
+AsyncExecutor getDefaultPythonExecutor()
+{
+#ifdef Py_GIL_DISABLED
+    if (!py::module_::import("sys").attr("_is_gil_enabled")().cast<bool>()) {
+        return AsyncExecutor::Cpu;
+    }
+#endif
+    return AsyncExecutor::Python;
+}
+}  // namespace
+
 void init_scheduler(py::module &m)
 {
+    py::enum_<TaskPriority>(m, "TaskPriority",
+                            "Represents how a sync task is treated once the scheduler has spent its time budget for a "
+                            "tick.")
+        .value("NORMAL", TaskPriority::Normal, "The task may be deferred to the following tick.")
+        .value("CRITICAL", TaskPriority::Critical, "The task always runs on the tick it is due.");
+
+    py::enum_<AsyncExecutor>(m, "AsyncExecutor", "Represents the pool of worker threads an async task is run on.")
+        .value("CPU", AsyncExecutor::Cpu, "Workers for CPU-bound tasks, sized to leave a core for the server thread.")
+        .value("IO", AsyncExecutor::Io, "Workers for tasks that block on I/O, such as database queries.")
+        .value("PYTHON", AsyncExecutor::Python,
+               "A single worker for Python tasks, so they do not contend for the GIL.");
+
+    py::enum_<TaskPhase>(m, "TaskPhase", "Represents when a sync task runs within the server tick it is due.")
+        .value("PRE_TICK", TaskPhase::PreTick, "The task runs before the level is ticked.")
+        .value("POST_TICK", TaskPhase::PostTick, "The task runs after the level is ticked, on the same server tick.");
+
     py::class_<Task, std::shared_ptr<Task>>(m, "Task", "Represents a task being executed by the scheduler")
         .def_property_readonly("task_id", &Task::getTaskId, "Returns the task id.")
         .def_property_readonly("owner", &Task::getOwner, py::return_value_policy::reference,
                                "Returns the Plugin that owns the task.")
         .def_property_readonly("is_sync", &Task::isSync, "Returns true if the task is run by server thread.")
         .def_property_readonly("is_cancelled", &Task::isCancelled, "Returns true if the task has been cancelled.")
-        .def("cancel", &Task::cancel, "Attempts to cancel this task.");
+        .def("cancel", &Task::cancel, "Attempts to cancel this task.")
+        .def_property("priority", &Task::getPriority, &Task::setPriority, "Gets or sets the priority of this task.")
+        .def_property("phase", &Task::getPhase, &Task::setPhase,
+                      "Gets or sets the phase of the server tick this task runs in.");
 
     py::class_<Scheduler>(m, "Scheduler", "Represents a scheduler that executes various tasks")
         .def("run_task", &Scheduler::runTaskTimer, py::arg("plugin"), py::arg("task"), py::arg("delay") = 0,
              py::arg("period") = 0, "Returns a task that will be executed synchronously",
              py::return_value_policy::reference)
+        .def("run_task_precise", &Scheduler::runTaskTimerPrecise, py::arg("plugin"), py::arg("task"),
+             py::arg("delay") = std::chrono::microseconds::zero(),
+             py::arg("period") = std::chrono::microseconds::zero(),
+             "Returns a task that will be executed synchronously after a delay timed by the clock rather than by ticks",
+             py::return_value_policy::reference)
+        .def(
+            "run_task_async",
+            [](Scheduler &self, Plugin &plugin, std::function<void()> task, std::uint64_t delay, std::uint64_t period,
+               std::optional<AsyncExecutor> executor) {
+                return self.runTaskTimerAsync(plugin, std::move(task), delay, period,
+                                              executor.value_or(getDefaultPythonExecutor()));
+            },
+            py::arg("plugin"), py::arg("task"), py::arg("delay") = 0, py::arg("period") = 0,
+            py::arg("executor") = py::none(),
+            "Returns a task that will be executed asynchronously, by the Python worker unless another is given",
+            py::return_value_policy::reference)
         .def("cancel_task", &Scheduler::cancelTask, py::arg("id"), "Removes task from scheduler.")
         .def("cancel_tasks", &Scheduler::cancelTasks, py::arg("plugin"),
              "Removes all tasks associated with a particular plugin from the scheduler.")
@@ -63,6 +63,11 @@ void init_scoreboard(py::module_ &m)
         .def_property_readonly("entry", &Score::getEntry, "Gets the entry being tracked by this Score",
                                py::return_value_policy::reference_internal)
         .def_property("value", &Score::getValue, &Score::setValue, "Gets or sets the current score.")
+        .def("set_viewer_value", &Score::setViewerValue,
+             "Sets the score shown to a single viewer of the scoreboard, without changing it for the other viewers.",
+             py::arg("viewer"), py::arg("score"))
+        .def("reset_viewer_value", &Score::resetViewerValue,
+             "Removes the score override of a viewer, so that it is shown the shared score again.", py::arg("viewer"))
         .def_property_readonly("is_score_set", &Score::isScoreSet,
                                "Shows if this score has been set at any point in time.")
         .def_property_readonly("objective", &Score::getObjective, "Gets the Objective being tracked by this Score.",
@@ -94,6 +99,11 @@ void init_scoreboard(py::module_ &m)
         .def_property("render_type", &Objective::getRenderType, &Objective::setRenderType,
                       "Gets and sets the manner in which this objective will be rendered.")
         .def("get_score", &Objective::getScore, "Gets an entry's Score for this objective", py::arg("entry"))
+        .def("get_top_scores", &Objective::getTopScores,
+             "Gets the highest scores of this objective, from the highest to the lowest", py::arg("count"))
+        .def("get_rank", &Objective::getRank,
+             "Gets the rank of an entry in this objective, 1 being the highest score, or None if it has no score",
+             py::arg("entry"))
         .def(py::self == py::self)
         .def(py::self != py::self);
 
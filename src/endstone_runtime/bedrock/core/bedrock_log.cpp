@@ -14,8 +14,12 @@
 
 #include "bedrock/core/bedrock_log.h"
 
+#include <array>
+#include <atomic>
 #include <cctype>
 #include <cstdio>
+#include <string>
+#include <string_view>
 #include <unordered_map>
 
 #include <magic_enum/magic_enum.hpp>
@@ -23,12 +27,32 @@
 #include "endstone/detail/logger_factory.h"
 #include "endstone/logger.h"
 
+namespace {
+endstone::Logger &getLogger(LogAreaID area)
+{
+    // Loggers from the factory are never destroyed, so once an area is resolved its lookup is an array index
+    static std::array<std::atomic<endstone::Logger *>, magic_enum::enum_count<LogAreaID>()> loggers{};
+
+    auto index = magic_enum::enum_index(area);
+    if (!index.has_value()) {
+        return endstone::detail::LoggerFactory::getLogger(std::string(magic_enum::enum_name(area)));
+    }
+
+    auto &slot = loggers[index.value()];
+    auto *logger = slot.load(std::memory_order_acquire);
+    if (logger == nullptr) {
+        logger = &endstone::detail::LoggerFactory::getLogger(std::string(magic_enum::enum_name(area)));
+        slot.store(logger, std::memory_order_release);
+    }
+    return *logger;
+}
+}  // namespace
+
 void BedrockLog::log_va(BedrockLog::LogCategory /*category*/, std::bitset<3> /*channel_mask*/,
                         BedrockLog::LogRule /*rule*/, LogAreaID area, std::uint32_t priority, const char * /*function*/,
                         int /*line*/, const char *format, va_list args)
 {
-    auto name = magic_enum::enum_name(area);
-    auto &logger = endstone::detail::LoggerFactory::getLogger(std::string(name));
+    auto &logger = getLogger(area);
     endstone::Logger::Level log_level;
     switch (priority) {
     case 1:
@@ -48,25 +72,42 @@ void BedrockLog::log_va(BedrockLog::LogCategory /*category*/, std::bitset<3> /*c
         break;
     }
 
+    if (!logger.isEnabledFor(log_level)) {
+        return;
+    }
+
+    // Formatted in a single pass into a per-thread buffer that keeps its capacity, long messages grow it once
+    thread_local std::string buffer(1024, '\0');
+    thread_local std::string line;
+
     std::va_list args_copy;
     va_copy(args_copy, args);
-    std::vector<char> buf(1 + std::vsnprintf(nullptr, 0, format, args));
-    va_end(args);
-    std::size_t len = std::vsnprintf(buf.data(), buf.size(), format, args_copy);
+    auto result = std::vsnprintf(buffer.data(), buffer.size() + 1, format, args_copy);
     va_end(args_copy);
+    if (result < 0) {
+        return;
+    }
+
+    auto len = static_cast<std::size_t>(result);
+    if (len > buffer.size()) {
+        buffer.resize(len);
+        std::vsnprintf(buffer.data(), buffer.size() + 1, format, args);
+    }
 
-    std::string message(buf.data(), len);
-    message.erase(message.find_last_not_of(" \t\n\r\f\v") + 1);
+    std::string_view message(buffer.data(), len);
+    message = message.substr(0, message.find_last_not_of(" \t\n\r\f\v") + 1);
 
     std::size_t start = 0;
     std::size_t end;
 
-    while ((end = message.find('\n', start)) != std::string::npos) {
-        logger.log(log_level, message.substr(start, end - start));
+    while ((end = message.find('\n', start)) != std::string_view::npos) {
+        line.assign(message.substr(start, end - start));
+        logger.log(log_level, line);
         start = end + 1;
     }
 
     if (start < message.length()) {
-        logger.log(log_level, message.substr(start));
+        line.assign(message.substr(start));
+        logger.log(log_level, line);
     }
 }
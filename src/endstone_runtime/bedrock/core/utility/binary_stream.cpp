@@ -16,6 +16,33 @@
 
 #include <fmt/core.h>
 
+namespace {
+template <typename T>
+std::size_t encodeUnsignedVarInt(std::uint8_t *out, T value)
+{
+    std::size_t size = 0;
+    while (value >= 0x80) {
+        out[size++] = static_cast<std::uint8_t>(value | 0x80);
+        value >>= 7;
+    }
+    out[size++] = static_cast<std::uint8_t>(value);
+    return size;
+}
+}  // namespace
+
+void BinaryStream::reserve(std::size_t size)
+{
+    buffer_->reserve(buffer_->size() + size);
+}
+
+// Grows the buffer by size bytes and hands them to the caller to fill, for writers that know their exact size
+char *BinaryStream::extend(std::size_t size)
+{
+    auto offset = buffer_->size();
+    buffer_->resize(offset + size);
+    return buffer_->data() + offset;
+}
+
 void BinaryStream::write(const void *data, std::size_t size)
 {
     if (size > 0) {
@@ -50,30 +77,15 @@ void BinaryStream::writeVarInt64(std::int64_t value)
 
 void BinaryStream::writeUnsignedVarInt(std::uint32_t value)
 {
-    do {
-        std::uint8_t byte = value & 0xFF;
-        value >>= 7;
-        if (value) {
-            writeByte(byte | 0x80);
-        }
-        else {
-            writeByte(byte & 0x7F);
-        }
-    } while (value);
+    // Encode into a stack buffer and append once rather than growing the buffer byte by byte
+    std::uint8_t bytes[5];
+    write(bytes, encodeUnsignedVarInt(bytes, value));
 }
 
 void BinaryStream::writeUnsignedVarInt64(std::uint64_t value)
 {
-    do {
-        std::uint8_t byte = value & 0xFF;
-        value >>= 7;
-        if (value) {
-            writeByte(byte | 0x80);
-        }
-        else {
-            writeByte(byte & 0x7F);
-        }
-    } while (value);
+    std::uint8_t bytes[10];
+    write(bytes, encodeUnsignedVarInt(bytes, value));
 }
 
 void BinaryStream::writeString(std::string_view value)
@@ -86,3 +98,14 @@ void BinaryStream::writeFloat(float value)
 {
     write(&value, sizeof(float));
 }
+
+void BinaryStream::writeFloats(const float *values, std::size_t count)
+{
+    write(values, count * sizeof(float));
+}
+
+void BinaryStream::writeVec3(const Vec3 &value)
+{
+    const float values[3] = {value.x, value.y, value.z};
+    writeFloats(values, 3);
+}
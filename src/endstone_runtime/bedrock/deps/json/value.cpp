@@ -55,6 +55,8 @@ const Value &Value::null = reinterpret_cast<const Value &>(kNullRef);
 
 Value::CZString::CZString(const char *cstr) : cstr_(duplicateStringValue(cstr)) {}
 
+Value::CZString::CZString(const char *cstr, Borrow) : cstr_(cstr) {}
+
 Value::CZString::CZString(const CZString &other)
     : cstr_(other.cstr_ != nullptr ? duplicateStringValue(other.cstr_) : other.cstr_)
 {
@@ -88,6 +90,11 @@ const char *Value::CZString::c_str() const
     return cstr_;
 }
 
+void Value::CZString::release()
+{
+    cstr_ = nullptr;
+}
+
 Json::Value::Value(Json::ValueType type)
 {
     initBasic(type);
@@ -209,8 +216,10 @@ const Value &Value::operator[](const char *key) const
         return null;
     }
 
-    CZString actual_key(key);
+    // The map only compares the key, it is not worth a copy
+    CZString actual_key(key, CZString::Borrow{});
     ObjectValues::const_iterator it = value_.map_->find(actual_key);
+    actual_key.release();
     if (it == value_.map_->end()) {
         return null;
     }
@@ -264,6 +273,14 @@ std::string Value::asString() const
     }
 }
 
+std::string_view Value::asStringView() const
+{
+    if (type_ == stringValue && value_.string_) {
+        return value_.string_->c_str();
+    }
+    return {};
+}
+
 int Value::asInt() const
 {
     switch (type_) {
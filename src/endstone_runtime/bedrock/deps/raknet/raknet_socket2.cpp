@@ -14,7 +14,11 @@
 
 #include "bedrock/deps/raknet/raknet_socket2.h"
 
+#include <cstring>
 #include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include <entt/entt.hpp>
 
@@ -23,6 +27,7 @@
 #include "bedrock/deps/raknet/raknet_defines.h"
 #include "bedrock/deps/raknet/socket_defines.h"
 #include "endstone/detail/hook.h"
+#include "endstone/detail/network/ping_rate_limiter.h"
 #include "endstone/detail/server.h"
 #include "endstone/event/server/server_list_ping_event.h"
 #include "endstone/plugin/plugin_manager.h"
@@ -31,45 +36,100 @@ using endstone::detail::EndstoneServer;
 
 namespace RakNet {
 
+namespace {
+constexpr int PongHeadSize = sizeof(char) + sizeof(std::uint64_t) + sizeof(std::uint64_t) + 16;
+
+void writePongPacket(std::vector<char> &packet, const char *data, std::string_view ping_response)
+{
+    auto strlen = ping_response.length();
+    packet.clear();
+    packet.insert(packet.end(), data, data + PongHeadSize);
+    packet.push_back(static_cast<char>((strlen >> 8) & 0xFF));
+    packet.push_back(static_cast<char>(strlen & 0xFF));
+    packet.insert(packet.end(), ping_response.begin(), ping_response.end());
+}
+
+endstone::detail::PingRateLimiter::Source getPingSource(const SystemAddress &address)
+{
+    endstone::detail::PingRateLimiter::Source source{0, 0};
+    if (address.address.addr4.sin_family == AF_INET) {
+        // Maps to ::ffff:a.b.c.d, so both families share the table
+        std::uint32_t ipv4;
+        std::memcpy(&ipv4, &address.address.addr4.sin_addr, sizeof(ipv4));
+        source.low = 0xFFFF00000000ULL | ipv4;
+    }
+    else {
+        std::memcpy(&source, &address.address.addr6.sin6_addr, sizeof(source));
+    }
+    return source;
+}
+}  // namespace
+
 RNS2SendResult RNS2_Windows_Linux_360::Send_Windows_Linux_360NoVDP(RNS2Socket socket,
                                                                    RNS2_SendParameters *send_parameters,
                                                                    const char *file, unsigned int line)
 {
+    ENDSTONE_HOOK_TIMING(&RNS2_Windows_Linux_360::Send_Windows_Linux_360NoVDP);
     if (send_parameters->data[0] != MessageIdentifiers::UnconnectedPong) {
         return ENDSTONE_HOOK_CALL_ORIGINAL(&RNS2_Windows_Linux_360::Send_Windows_Linux_360NoVDP, socket,
                                            send_parameters, file, line);
     }
 
-    constexpr static int head_size = sizeof(char) + sizeof(std::uint64_t) + sizeof(std::uint64_t) + 16;
     const char *data = send_parameters->data;
-    std::size_t strlen = data[head_size] << 8 | data[head_size + 1];
+    std::size_t strlen = data[PongHeadSize] << 8 | data[PongHeadSize + 1];
     if (strlen == 0) {
         return ENDSTONE_HOOK_CALL_ORIGINAL(&RNS2_Windows_Linux_360::Send_Windows_Linux_360NoVDP, socket,
                                            send_parameters, file, line);
     }
 
-    std::string ping_response{data + head_size + 2, strlen};
-    auto &server = entt::locator<EndstoneServer>::value();
-    char buffer[64];
-    send_parameters->system_address.ToString(false, buffer);
-    endstone::ServerListPingEvent event(std::string(buffer), send_parameters->system_address.GetPort(), ping_response);
-    if (!event.deserialize()) {
-        server.getLogger().error("Unable to parse ping response: {}", ping_response);
-        return ENDSTONE_HOOK_CALL_ORIGINAL(&RNS2_Windows_Linux_360::Send_Windows_Linux_360NoVDP, socket,
-                                           send_parameters, file, line);
+    // Sources over their limit get no answer, which is reported as sent so RakNet carries on
+    auto source = getPingSource(send_parameters->system_address);
+    if (!endstone::detail::PingRateLimiter::getInstance().tryAcquire(source)) {
+        return send_parameters->length;
     }
 
-    server.getPluginManager().callEvent(event);
+    // Pong packets are rebuilt in a buffer reused by each RakNet thread
+    thread_local std::vector<char> packet;
+    auto &server = entt::locator<EndstoneServer>::value();
+    std::string_view vanilla_response{data + PongHeadSize + 2, strlen};
 
-    std::vector<char> packet;
-    packet.reserve(256);
-    packet.insert(packet.end(), data, data + head_size);
+    if (!server.getPluginManager().hasListeners<endstone::ServerListPingEvent>()) {
+        // Without listeners the response only changes when vanilla's does, so it is serialized once per change
+        thread_local std::string cached_vanilla_response;
+        thread_local std::string cached_response;
+        thread_local bool cached_valid = false;
+        if (vanilla_response != cached_vanilla_response) {
+            cached_vanilla_response = vanilla_response;
+            endstone::ServerListPingEvent event("", 0, cached_vanilla_response);
+            cached_valid = event.deserialize();
+            if (cached_valid) {
+                cached_response = event.serialize();
+            }
+            else {
+                server.getLogger().error("Unable to parse ping response: {}", cached_vanilla_response);
+            }
+        }
+        if (!cached_valid) {
+            return ENDSTONE_HOOK_CALL_ORIGINAL(&RNS2_Windows_Linux_360::Send_Windows_Linux_360NoVDP, socket,
+                                               send_parameters, file, line);
+        }
+        writePongPacket(packet, data, cached_response);
+    }
+    else {
+        std::string ping_response{vanilla_response};
+        char buffer[64];
+        send_parameters->system_address.ToString(false, buffer);
+        endstone::ServerListPingEvent event(std::string(buffer), send_parameters->system_address.GetPort(),
+                                            ping_response);
+        if (!event.deserialize()) {
+            server.getLogger().error("Unable to parse ping response: {}", ping_response);
+            return ENDSTONE_HOOK_CALL_ORIGINAL(&RNS2_Windows_Linux_360::Send_Windows_Linux_360NoVDP, socket,
+                                               send_parameters, file, line);
+        }
 
-    ping_response = event.serialize();
-    strlen = ping_response.length();
-    packet.push_back(static_cast<char>((strlen >> 8) & 0xFF));
-    packet.push_back(static_cast<char>(strlen & 0xFF));
-    packet.insert(packet.end(), ping_response.begin(), ping_response.end());
+        server.getPluginManager().callEvent(event);
+        writePongPacket(packet, data, event.serialize());
+    }
 
     send_parameters->data = packet.data();
     send_parameters->length = static_cast<int>(packet.size());
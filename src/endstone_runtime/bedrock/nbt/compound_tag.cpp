@@ -28,8 +28,32 @@ void CompoundTag::write(IDataOutput &output) const
 
 Bedrock::Result<void> CompoundTag::load(IDataInput &input)
 {
-    // TODO(nbt): fixme
-    throw std::runtime_error("Not implemented");
+    tags_.clear();
+    while (true) {
+        auto type = input.readByteResult();
+        if (!type) {
+            return nonstd::make_unexpected(type.error());
+        }
+        if (static_cast<Tag::Type>(type.value()) == Tag::Type::End) {
+            return {};
+        }
+
+        auto name = input.readStringResult();
+        if (!name) {
+            return nonstd::make_unexpected(name.error());
+        }
+
+        // Children are constructed in place inside the map node, a nested compound costs no extra allocation
+        auto [it, inserted] = tags_.try_emplace(std::move(name.value()));
+        auto *tag = it->second.emplace(static_cast<Tag::Type>(type.value()));
+        if (!tag) {
+            return nonstd::make_unexpected(
+                Bedrock::ErrorInfo<std::error_code>{std::make_error_code(std::errc::bad_message)});
+        }
+        if (auto result = tag->load(input); !result) {
+            return nonstd::make_unexpected(result.error());
+        }
+    }
 }
 
 std::string CompoundTag::toString() const
@@ -49,6 +73,9 @@ bool CompoundTag::equals(const Tag &other) const
     }
 
     const auto &other_tag = static_cast<const CompoundTag &>(other);
+    if (tags_.size() != other_tag.tags_.size()) {
+        return false;
+    }
     return std::all_of(tags_.begin(), tags_.end(), [&](const auto &kv) {
         const auto *tag = other_tag.get(kv.first);
         return tag && kv.second.get()->equals(*tag);
@@ -250,3 +277,35 @@ Tag &CompoundTagVariant::emplace(Tag &&tag)
         return std::get<EndTag>(tag_storage_);
     }
 }
+
+Tag *CompoundTagVariant::emplace(Tag::Type type)
+{
+    switch (type) {
+    case Tag::Type::Byte:
+        return &tag_storage_.emplace<ByteTag>();
+    case Tag::Type::Short:
+        return &tag_storage_.emplace<ShortTag>();
+    case Tag::Type::Int:
+        return &tag_storage_.emplace<IntTag>();
+    case Tag::Type::Int64:
+        return &tag_storage_.emplace<Int64Tag>();
+    case Tag::Type::Float:
+        return &tag_storage_.emplace<FloatTag>();
+    case Tag::Type::Double:
+        return &tag_storage_.emplace<DoubleTag>();
+    case Tag::Type::ByteArray:
+        return &tag_storage_.emplace<ByteArrayTag>();
+    case Tag::Type::String:
+        return &tag_storage_.emplace<StringTag>();
+    case Tag::Type::List:
+        return &tag_storage_.emplace<ListTag>();
+    case Tag::Type::Compound:
+        return &tag_storage_.emplace<CompoundTag>();
+    case Tag::Type::IntArray:
+        return &tag_storage_.emplace<IntArrayTag>();
+    case Tag::Type::End:
+    case Tag::Type::NumTagTypes:
+    default:
+        return nullptr;
+    }
+}
@@ -14,6 +14,13 @@
 
 #include "bedrock/nbt/nbt_io.h"
 
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <iterator>
+
+#include "bedrock/nbt/compound_tag.h"
+
 void NbtIo::writeNamedTag(const std::string &name, const Tag &tag, IDataOutput &output)
 {
     auto type = tag.getId();
@@ -23,3 +30,300 @@ void NbtIo::writeNamedTag(const std::string &name, const Tag &tag, IDataOutput &
         tag.write(output);
     }
 }
+
+namespace {
+
+// Serializes tags by switching on their type rather than going through Tag::write, so that every value is a direct
+// store into the output buffer instead of a virtual call on IDataOutput
+template <NbtIo::Encoding E>
+class TagWriter {
+public:
+    explicit TagWriter(char *out) : out_(out) {}
+
+    static std::size_t getNamedSize(std::string_view name, const Tag &tag)
+    {
+        if (tag.getId() == Tag::Type::End) {
+            return 1;
+        }
+        return 1 + getStringSize(name) + getPayloadSize(tag);
+    }
+
+    static std::size_t getPayloadSize(const Tag &tag)
+    {
+        switch (tag.getId()) {
+        case Tag::Type::Byte:
+            return 1;
+        case Tag::Type::Short:
+            return 2;
+        case Tag::Type::Int:
+            return getIntSize(static_cast<const IntTag &>(tag).data);
+        case Tag::Type::Int64:
+            if constexpr (E == NbtIo::Encoding::Network) {
+                return getUnsignedVarIntSize(zigzag(static_cast<const Int64Tag &>(tag).data));
+            }
+            return 8;
+        case Tag::Type::Float:
+            return 4;
+        case Tag::Type::Double:
+            return 8;
+        case Tag::Type::ByteArray: {
+            const auto &data = static_cast<const ByteArrayTag &>(tag).data;
+            return getIntSize(static_cast<std::int32_t>(data.size())) + data.size();
+        }
+        case Tag::Type::String:
+            return getStringSize(static_cast<const StringTag &>(tag).data);
+        case Tag::Type::List: {
+            const auto &list = static_cast<const ListTag &>(tag);
+            auto size = 1 + getIntSize(static_cast<std::int32_t>(list.size()));
+            for (std::size_t i = 0; i < list.size(); ++i) {
+                size += getPayloadSize(*list.get(i));
+            }
+            return size;
+        }
+        case Tag::Type::Compound: {
+            std::size_t size = 1;
+            for (const auto &[key, value] : static_cast<const CompoundTag &>(tag)) {
+                size += getNamedSize(key, *value.get());
+            }
+            return size;
+        }
+        case Tag::Type::IntArray: {
+            const auto &data = static_cast<const IntArrayTag &>(tag).data;
+            auto size = getIntSize(static_cast<std::int32_t>(data.size()));
+            for (auto value : data) {
+                size += getIntSize(value);
+            }
+            return size;
+        }
+        case Tag::Type::End:
+        default:
+            return 0;
+        }
+    }
+
+    void writeNamed(std::string_view name, const Tag &tag)
+    {
+        auto type = tag.getId();
+        writeByte(static_cast<std::uint8_t>(type));
+        if (type != Tag::Type::End) {
+            writeString(name);
+            writePayload(tag);
+        }
+    }
+
+    void writePayload(const Tag &tag)
+    {
+        switch (tag.getId()) {
+        case Tag::Type::Byte:
+            writeByte(static_cast<const ByteTag &>(tag).data);
+            break;
+        case Tag::Type::Short:
+            writeFixed(static_cast<const ShortTag &>(tag).data);
+            break;
+        case Tag::Type::Int:
+            writeInt(static_cast<const IntTag &>(tag).data);
+            break;
+        case Tag::Type::Int64:
+            if constexpr (E == NbtIo::Encoding::Network) {
+                writeUnsignedVarInt(zigzag(static_cast<const Int64Tag &>(tag).data));
+            }
+            else {
+                writeFixed(static_cast<const Int64Tag &>(tag).data);
+            }
+            break;
+        case Tag::Type::Float:
+            writeFixed(static_cast<const FloatTag &>(tag).data);
+            break;
+        case Tag::Type::Double:
+            writeFixed(static_cast<const DoubleTag &>(tag).data);
+            break;
+        case Tag::Type::ByteArray: {
+            const auto &data = static_cast<const ByteArrayTag &>(tag).data;
+            writeInt(static_cast<std::int32_t>(data.size()));
+            writeBytes(data.data(), data.size());
+            break;
+        }
+        case Tag::Type::String:
+            writeString(static_cast<const StringTag &>(tag).data);
+            break;
+        case Tag::Type::List: {
+            const auto &list = static_cast<const ListTag &>(tag);
+            writeByte(static_cast<std::uint8_t>(list.getElementType()));
+            writeInt(static_cast<std::int32_t>(list.size()));
+            for (std::size_t i = 0; i < list.size(); ++i) {
+                writePayload(*list.get(i));
+            }
+            break;
+        }
+        case Tag::Type::Compound:
+            for (const auto &[key, value] : static_cast<const CompoundTag &>(tag)) {
+                writeNamed(key, *value.get());
+            }
+            writeByte(static_cast<std::uint8_t>(Tag::Type::End));
+            break;
+        case Tag::Type::IntArray: {
+            const auto &data = static_cast<const IntArrayTag &>(tag).data;
+            writeInt(static_cast<std::int32_t>(data.size()));
+            for (auto value : data) {
+                writeInt(value);
+            }
+            break;
+        }
+        case Tag::Type::End:
+        default:
+            break;
+        }
+    }
+
+    [[nodiscard]] char *getPosition() const
+    {
+        return out_;
+    }
+
+private:
+    static std::uint64_t zigzag(std::int64_t value)
+    {
+        return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+    }
+
+    static std::size_t getUnsignedVarIntSize(std::uint64_t value)
+    {
+        std::size_t size = 1;
+        while (value >= 0x80) {
+            value >>= 7;
+            ++size;
+        }
+        return size;
+    }
+
+    static std::size_t getIntSize(std::int32_t value)
+    {
+        if constexpr (E == NbtIo::Encoding::Network) {
+            return getUnsignedVarIntSize(zigzag(value));
+        }
+        return 4;
+    }
+
+    static std::size_t getStringSize(std::string_view value)
+    {
+        if constexpr (E == NbtIo::Encoding::Network) {
+            return getUnsignedVarIntSize(value.size()) + value.size();
+        }
+        // BytesDataOutput truncates strings to 32767 bytes
+        return 2 + (value.size() & 0x7fff);
+    }
+
+    void writeByte(std::uint8_t value)
+    {
+        *out_++ = static_cast<char>(value);
+    }
+
+    void writeBytes(const void *data, std::size_t size)
+    {
+        if (size > 0) {
+            std::memcpy(out_, data, size);
+            out_ += size;
+        }
+    }
+
+    template <typename T>
+    void writeFixed(T value)
+    {
+        if constexpr (E == NbtIo::Encoding::BigEndian) {
+            unsigned char bytes[sizeof(T)];
+            std::memcpy(bytes, &value, sizeof(T));
+            std::reverse(std::begin(bytes), std::end(bytes));
+            writeBytes(bytes, sizeof(T));
+        }
+        else {
+            writeBytes(&value, sizeof(T));
+        }
+    }
+
+    void writeUnsignedVarInt(std::uint64_t value)
+    {
+        while (value >= 0x80) {
+            writeByte(static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        writeByte(static_cast<std::uint8_t>(value));
+    }
+
+    void writeInt(std::int32_t value)
+    {
+        if constexpr (E == NbtIo::Encoding::Network) {
+            writeUnsignedVarInt(zigzag(value));
+        }
+        else {
+            writeFixed(value);
+        }
+    }
+
+    void writeString(std::string_view value)
+    {
+        if constexpr (E == NbtIo::Encoding::Network) {
+            writeUnsignedVarInt(value.size());
+            writeBytes(value.data(), value.size());
+        }
+        else {
+            auto size = value.size() & 0x7fff;
+            writeFixed(static_cast<std::int16_t>(size));
+            writeBytes(value.data(), size);
+        }
+    }
+
+    char *out_;
+};
+
+template <NbtIo::Encoding E>
+void writeNamedTagTo(std::string_view name, const Tag &tag, char *out, std::size_t size)
+{
+    TagWriter<E> writer{out};
+    writer.writeNamed(name, tag);
+    assert(writer.getPosition() == out + size);
+}
+
+void writeNamedTagTo(std::string_view name, const Tag &tag, NbtIo::Encoding encoding, char *out, std::size_t size)
+{
+    switch (encoding) {
+    case NbtIo::Encoding::BigEndian:
+        writeNamedTagTo<NbtIo::Encoding::BigEndian>(name, tag, out, size);
+        break;
+    case NbtIo::Encoding::Network:
+        writeNamedTagTo<NbtIo::Encoding::Network>(name, tag, out, size);
+        break;
+    case NbtIo::Encoding::LittleEndian:
+    default:
+        writeNamedTagTo<NbtIo::Encoding::LittleEndian>(name, tag, out, size);
+        break;
+    }
+}
+
+}  // namespace
+
+std::size_t NbtIo::getNamedTagSize(std::string_view name, const Tag &tag, Encoding encoding)
+{
+    switch (encoding) {
+    case Encoding::BigEndian:
+        return TagWriter<Encoding::BigEndian>::getNamedSize(name, tag);
+    case Encoding::Network:
+        return TagWriter<Encoding::Network>::getNamedSize(name, tag);
+    case Encoding::LittleEndian:
+    default:
+        return TagWriter<Encoding::LittleEndian>::getNamedSize(name, tag);
+    }
+}
+
+void NbtIo::writeNamedTag(std::string_view name, const Tag &tag, std::string &buffer, Encoding encoding)
+{
+    auto size = getNamedTagSize(name, tag, encoding);
+    auto offset = buffer.size();
+    buffer.resize(offset + size);
+    writeNamedTagTo(name, tag, encoding, buffer.data() + offset, size);
+}
+
+void NbtIo::writeNamedTag(std::string_view name, const Tag &tag, BinaryStream &stream, Encoding encoding)
+{
+    auto size = getNamedTagSize(name, tag, encoding);
+    writeNamedTagTo(name, tag, encoding, stream.extend(size), size);
+}
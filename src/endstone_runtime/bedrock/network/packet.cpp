@@ -0,0 +1,94 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "bedrock/network/packet.h"
+
+#include <entt/entt.hpp>
+
+#include "bedrock/core/utility/binary_stream.h"
+#include "endstone/detail/hook.h"
+#include "endstone/detail/network/chunk_radius_handler.h"
+#include "endstone/detail/network/packet_statistics.h"
+#include "endstone/detail/server.h"
+#include "endstone/event/server/packet_receive_event.h"
+#include "endstone/network/binary_stream_reader.h"
+#include "endstone/plugin/plugin_manager.h"
+
+using endstone::detail::EndstoneServer;
+
+namespace {
+class DroppedPacketHandler : public IPacketHandlerDispatcher {
+public:
+    void handle(const NetworkIdentifier &, NetEventCallback &, std::shared_ptr<Packet> &) const override {}
+};
+
+constexpr std::uint32_t PacketIdMask = 0x3FF;
+}  // namespace
+
+Bedrock::Result<void> Packet::readNoHeader(ReadOnlyBinaryStream &stream, const SubClientId &sub_id)
+{
+    if (!endstone::detail::hook::is_installed<&Packet::readNoHeader>()) {
+        // Without a symbol for this build the detour is not installed and there is no original to read the packet
+        return nonstd::make_unexpected(Bedrock::ErrorInfo<>{std::make_error_code(std::errc::function_not_supported)});
+    }
+
+    Bedrock::Result<void> result;
+
+    // Each packet in a batch is read from its own stream, which starts with the header the network system just read
+    const auto data = stream.getView();
+    endstone::BinaryStreamReader reader{data};
+    const auto header = reader.readUnsignedVarInt();
+    if (reader.hasOverflowed() || reader.getPosition() != stream.getReadPointer()) {
+        ENDSTONE_HOOK_CALL_ORIGINAL_RVO(&Packet::readNoHeader, result, this, stream, sub_id);
+        return result;
+    }
+
+    const auto packet_id = static_cast<int>(header & PacketIdMask);
+    endstone::detail::PacketStatistics::getInstance().recordReceived(packet_id, data.size());
+
+    auto &server = entt::locator<EndstoneServer>::value();
+    const auto drop = [this]() {
+        // Left unread and routed to a handler that ignores it, so vanilla never acts on the packet
+        static const DroppedPacketHandler dropped_packet_handler;
+        handler_ = &dropped_packet_handler;
+    };
+
+    // Handlers overwrite the body in place, vanilla reads the same bytes afterwards
+    const auto body = reader.getPosition();
+    if (auto *recorder = server.getReplayRecorder()) {
+        // As the client sent it, a replay goes through the same handlers again
+        recorder->recordPacket(packet_id, static_cast<int>(sub_id), data.substr(body));
+    }
+    if (!server.getPacketInterceptor().intercept(packet_id, static_cast<int>(sub_id), stream.getMutableData() + body,
+                                                 data.size() - body)) {
+        drop();
+        return result;
+    }
+
+    if (server.getPluginManager().hasListeners<endstone::PacketReceiveEvent>()) {
+        endstone::PacketReceiveEvent event{packet_id, static_cast<int>(sub_id), data.substr(body)};
+        server.getPluginManager().callEvent(event);
+        if (event.isCancelled()) {
+            drop();
+            return result;
+        }
+    }
+
+    ENDSTONE_HOOK_CALL_ORIGINAL_RVO(&Packet::readNoHeader, result, this, stream, sub_id);
+    if (packet_id == static_cast<int>(MinecraftPacketIds::RequestChunkRadius)) {
+        // The requested radius is limited to the view distance of the player before vanilla handles it
+        endstone::detail::ChunkRadiusHandler::getInstance().intercept(handler_);
+    }
+    return result;
+}
@@ -14,12 +14,29 @@
 
 #include "bedrock/network/packet/crafting_data_packet.h"
 
+#include <entt/entt.hpp>
+
 #include "endstone/detail/hook.h"
+#include "endstone/detail/network/packet_cache.h"
+#include "endstone/detail/server.h"
+
+using endstone::detail::CachedPacket;
+using endstone::detail::EndstoneServer;
 
 std::unique_ptr<CraftingDataPacket> CraftingDataPacket::prepareFromRecipes(const Recipes &recipe,
                                                                            bool only_crafting_recipes)
 {
-    std::unique_ptr<CraftingDataPacket> result;
-    ENDSTONE_HOOK_CALL_ORIGINAL_RVO(&CraftingDataPacket::prepareFromRecipes, result, recipe, only_crafting_recipes);
-    return result;
+    auto create = [&]() {
+        std::unique_ptr<CraftingDataPacket> result;
+        ENDSTONE_HOOK_CALL_ORIGINAL_RVO(&CraftingDataPacket::prepareFromRecipes, result, recipe, only_crafting_recipes);
+        return result;
+    };
+    if (!entt::locator<EndstoneServer>::has_value()) {
+        return create();
+    }
+
+    // The packet is the same for every player joining, it is serialised once until the recipes change
+    auto &server = entt::locator<EndstoneServer>::value();
+    auto encoded = server.getCraftingDataCache().get(only_crafting_recipes ? 1 : 0, create);
+    return std::make_unique<CachedPacket<CraftingDataPacket>>(std::move(encoded));
 }
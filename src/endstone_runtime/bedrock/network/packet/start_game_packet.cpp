@@ -35,5 +35,7 @@ void StartGamePacket::write(BinaryStream &stream) const
         settings_.setRandomSeed({0});
     }
 
+    // Unlike the crafting data, the packet is written whole for every player: its layout is only known up to
+    // settings_, and the level time that follows it changes between joins, so the palettes can't be spliced in.
     ENDSTONE_HOOK_CALL_ORIGINAL_NAME(&StartGamePacket::write, __FUNCDNAME__, this, stream);
 }
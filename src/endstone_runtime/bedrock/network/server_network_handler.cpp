@@ -14,6 +14,7 @@
 
 #include "bedrock/network/server_network_handler.h"
 
+#include <chrono>
 #include <variant>
 
 #include <entt/entt.hpp>
@@ -21,11 +22,18 @@
 
 #include "bedrock/entity/components/user_entity_identifier_component.h"
 #include "endstone/detail/hook.h"
+#include "endstone/detail/join_timings.h"
+#include "endstone/detail/scheduler/scheduler.h"
 #include "endstone/detail/server.h"
+#include "endstone/event/player/async_player_chat_event.h"
 #include "endstone/event/player/player_chat_event.h"
 #include "endstone/event/player/player_login_event.h"
 
+using endstone::detail::EndstonePlayer;
+using endstone::detail::EndstoneScheduler;
 using endstone::detail::EndstoneServer;
+using endstone::detail::JoinPhase;
+using endstone::detail::JoinTimer;
 
 void ServerNetworkHandler::disconnectClient(const NetworkIdentifier &network_id, SubClientId sub_client_id,
                                             Connection::DisconnectFailReason reason, const std::string &message,
@@ -40,20 +48,51 @@ void ServerNetworkHandler::updateServerAnnouncement()
     ENDSTONE_HOOK_CALL_ORIGINAL(&ServerNetworkHandler::updateServerAnnouncement, this);
 }
 
-bool ServerNetworkHandler::trytLoadPlayer(ServerPlayer &server_player, const ConnectionRequest &connection_request)
+namespace {
+template <typename Request, typename Load>
+ServerPlayer &loginPlayer(const Request &request, Load &&load)
 {
-    auto new_player =
-        ENDSTONE_HOOK_CALL_ORIGINAL(&ServerNetworkHandler::trytLoadPlayer, this, server_player, connection_request);
+    using namespace std::chrono;
     auto &server = entt::locator<EndstoneServer>::value();
+    auto &timings = server.getJoinTimings();
+
+    // The skin images are decoded on the CPU workers while the server thread loads the player data
+    auto start = steady_clock::now();
+    auto &executor = static_cast<EndstoneScheduler &>(server.getScheduler()).getExecutor(endstone::AsyncExecutor::Cpu);
+    auto connection_data = EndstonePlayer::readConnectionRequest(executor, &request);
+    auto read_time = steady_clock::now() - start;
+
+    auto &server_player = [&]() -> ServerPlayer & {
+        JoinTimer timer(timings, JoinPhase::LoadPlayer);
+        return load();
+    }();
+
     auto &endstone_player = server_player.getEndstonePlayer();
-    endstone_player.initFromConnectionRequest(&connection_request);
+    start = steady_clock::now();
+    endstone_player.initFromConnectionRequest(*connection_data);
+    timings.record(JoinPhase::ConnectionRequest, read_time + (steady_clock::now() - start));
 
     endstone::PlayerLoginEvent e{endstone_player};
-    server.getPluginManager().callEvent(e);
+    {
+        JoinTimer timer(timings, JoinPhase::LoginEvent);
+        server.getPluginManager().callEvent(e);
+    }
 
     if (e.isCancelled()) {
         endstone_player.kick(e.getKickMessage());
     }
+    return server_player;
+}
+}  // namespace
+
+bool ServerNetworkHandler::trytLoadPlayer(ServerPlayer &server_player, const ConnectionRequest &connection_request)
+{
+    bool new_player = false;
+    loginPlayer(connection_request, [&]() -> ServerPlayer & {
+        new_player = ENDSTONE_HOOK_CALL_ORIGINAL(&ServerNetworkHandler::trytLoadPlayer, this, server_player,
+                                                 connection_request);
+        return server_player;
+    });
     return new_player;
 }
 
@@ -61,19 +100,10 @@ ServerPlayer &ServerNetworkHandler::_createNewPlayer(const NetworkIdentifier &ne
                                                      const SubClientConnectionRequest &sub_client_connection_request,
                                                      SubClientId sub_client_id)
 {
-    auto &server_player = ENDSTONE_HOOK_CALL_ORIGINAL(&ServerNetworkHandler::_createNewPlayer, this, network_id,
-                                                      sub_client_connection_request, sub_client_id);
-    auto &server = entt::locator<EndstoneServer>::value();
-    auto &endstone_player = server_player.getEndstonePlayer();
-    endstone_player.initFromConnectionRequest(&sub_client_connection_request);
-
-    endstone::PlayerLoginEvent e{endstone_player};
-    server.getPluginManager().callEvent(e);
-
-    if (e.isCancelled()) {
-        endstone_player.kick(e.getKickMessage());
-    }
-    return server_player;
+    return loginPlayer(sub_client_connection_request, [&]() -> ServerPlayer & {
+        return ENDSTONE_HOOK_CALL_ORIGINAL(&ServerNetworkHandler::_createNewPlayer, this, network_id,
+                                           sub_client_connection_request, sub_client_id);
+    });
 }
 
 void ServerNetworkHandler::_displayGameMessage(const Player &player, ChatEvent &event)
@@ -87,9 +117,25 @@ void ServerNetworkHandler::_displayGameMessage(const Player &player, ChatEvent &
     }
 
     event.message = std::move(e.getMessage());
-    server.getLogger().info("<{}> {}", e.getPlayer().getName(), e.getMessage());
+    if (!server.getPluginManager().hasListeners<endstone::AsyncPlayerChatEvent>()) {
+        server.getLogger().info("<{}> {}", e.getPlayer().getName(), event.message);
+        ENDSTONE_HOOK_CALL_ORIGINAL(&ServerNetworkHandler::_displayGameMessage, this, player, event);
+        return;
+    }
 
-    ENDSTONE_HOOK_CALL_ORIGINAL(&ServerNetworkHandler::_displayGameMessage, this, player, event);
+    // The chat event is copied here and only touched again on the server thread, once the async handlers are done
+    auto &endstone_player = player.getEndstonePlayer();
+    auto deliver = [this, chat = event, player_id = endstone_player.getUniqueId()](std::string message) mutable {
+        auto &server = entt::locator<EndstoneServer>::value();
+        auto *sender = static_cast<EndstonePlayer *>(server.getPlayer(player_id));
+        if (!sender) {
+            return;
+        }
+        chat.message = std::move(message);
+        server.getLogger().info("<{}> {}", sender->getName(), chat.message);
+        ENDSTONE_HOOK_CALL_ORIGINAL(&ServerNetworkHandler::_displayGameMessage, this, sender->getHandle(), chat);
+    };
+    server.submitAsyncChat(endstone_player, event.message, std::move(deliver));
 }
 
 const Bedrock::NonOwnerPointer<ILevel> &ServerNetworkHandler::getLevel() const
@@ -14,12 +14,31 @@
 
 #include "bedrock/server/commands/command_output.h"
 
+#include <string>
+#include <vector>
+
+#include <entt/entt.hpp>
+
+#include "endstone/detail/command/command_output_capture.h"
 #include "endstone/detail/hook.h"
+#include "endstone/detail/server.h"
+
+using endstone::detail::CommandOutputCapture;
+using endstone::detail::EndstoneServer;
 
 void CommandOutput::addMessage(const std::string &message_id, const std::vector<CommandOutputParameter> &params,
                                enum CommandOutputMessageType type)
 {
     ENDSTONE_HOOK_CALL_ORIGINAL(&CommandOutput::addMessage, this, message_id, params, type);
+    // The output of vanilla commands run for a remote console is copied to its capture
+    if (auto *capture = CommandOutputCapture::current()) {
+        std::vector<std::string> with;
+        with.reserve(params.size());
+        for (const auto &param : params) {
+            with.push_back(param.string);
+        }
+        capture->append(entt::locator<EndstoneServer>::value().translate({message_id, std::move(with)}, ""));
+    }
 }
 
 void CommandOutput::forceOutput(const std::string &message_id, const std::vector<CommandOutputParameter> &params)
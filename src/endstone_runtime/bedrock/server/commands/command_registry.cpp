@@ -43,7 +43,7 @@ const CommandRegistry::Signature *CommandRegistry::findCommand(const std::string
 
 std::string CommandRegistry::describe(const CommandParameterData &param) const
 {
-    std::string (CommandRegistry::*fp)(const CommandParameterData &param) const = &CommandRegistry::describe;
+    constexpr std::string (CommandRegistry::*fp)(const CommandParameterData &param) const = &CommandRegistry::describe;
     std::string result;
     ENDSTONE_HOOK_CALL_ORIGINAL_RVO(fp, result, this, param);
     return result;
@@ -53,9 +53,9 @@ std::string CommandRegistry::describe(const CommandRegistry::Signature &signatur
                                       const CommandRegistry::Overload &overload, unsigned int a4, unsigned int *a5,
                                       unsigned int *a6) const
 {
-    std::string (CommandRegistry::*fp)(const CommandRegistry::Signature &, const std::string &,
-                                       const CommandRegistry::Overload &, unsigned int, unsigned int *, unsigned int *)
-        const = &CommandRegistry::describe;
+    constexpr std::string (CommandRegistry::*fp)(const CommandRegistry::Signature &, const std::string &,
+                                                 const CommandRegistry::Overload &, unsigned int, unsigned int *,
+                                                 unsigned int *) const = &CommandRegistry::describe;
     std::string result;
     ENDSTONE_HOOK_CALL_ORIGINAL_RVO(fp, result, this, signature, name, overload, a4, a5, a6);
     return result;
@@ -14,8 +14,17 @@
 
 #include "bedrock/server/commands/minecraft_commands.h"
 
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
 #include <entt/entt.hpp>
+#include <fmt/format.h>
+#include <magic_enum/magic_enum.hpp>
 
+#include "bedrock/server/commands/command_version.h"
 #include "bedrock/world/actor/actor.h"
 #include "bedrock/world/actor/player/player.h"
 #include "endstone/detail/hook.h"
@@ -23,19 +32,72 @@
 #include "endstone/event/player/player_command_event.h"
 #include "endstone/event/server/server_command_event.h"
 
+using endstone::detail::CommandRateLimiter;
+using endstone::detail::CommandTimings;
 using endstone::detail::EndstoneServer;
 
+namespace {
+std::optional<CommandRateLimiter::Origin> getRateLimitedOrigin(const CommandOrigin &origin)
+{
+    auto type = origin.getOriginType();
+    if (type == CommandOriginType::DedicatedServer || type == CommandOriginType::DevConsole) {
+        return std::nullopt;
+    }
+
+    CommandRateLimiter::Origin key{static_cast<std::uint8_t>(type), 0, 0, 0, 0};
+    if (type == CommandOriginType::CommandBlock) {
+        auto pos = origin.getBlockPosition();
+        key.object = reinterpret_cast<std::uintptr_t>(origin.getDimension());
+        key.x = pos.x;
+        key.y = pos.y;
+        key.z = pos.z;
+    }
+    else if (auto *entity = origin.getEntity(); entity) {
+        key.object = reinterpret_cast<std::uintptr_t>(entity);
+    }
+    else {
+        key.object = std::hash<std::string>{}(origin.getName());
+    }
+    return key;
+}
+
+std::string describeOrigin(const CommandOrigin &origin)
+{
+    auto type = magic_enum::enum_name(origin.getOriginType());
+    if (origin.getOriginType() == CommandOriginType::CommandBlock) {
+        auto pos = origin.getBlockPosition();
+        return fmt::format("{} at {}, {}, {}", type, pos.x, pos.y, pos.z);
+    }
+    return fmt::format("{} {}", type, origin.getName());
+}
+}  // namespace
+
 MCRESULT MinecraftCommands::executeCommand(CommandContext &ctx, bool suppress_output) const
 {
     auto &server = entt::locator<EndstoneServer>::value();
+    if (auto origin = getRateLimitedOrigin(ctx.getOrigin()); origin) {
+        auto &rate_limiter = server.getCommandMap().getRateLimiter();
+        if (!rate_limiter.tryAcquire(*origin)) {
+            std::shared_ptr<CommandOrigin> clone = ctx.getOrigin().clone();
+            rate_limiter.reject(
+                *origin, [&]() { return describeOrigin(ctx.getOrigin()); },
+                [this, command = ctx.getCommand(), clone, suppress_output]() {
+                    CommandContext deferred{command, clone->clone(), CommandVersion::CurrentVersion};
+                    executeCommand(deferred, suppress_output);
+                });
+            return MCRESULT_CommandsDisabled;
+        }
+    }
 
-    auto command_line = ctx.getCommand();
+    auto start = std::chrono::steady_clock::now();
+
+    std::string_view command_line = ctx.getCommand();
     if (!command_line.empty() && command_line[0] == '/') {
-        command_line = command_line.substr(1);
+        command_line.remove_prefix(1);
     }
 
     auto command_name = command_line.substr(0, command_line.find_first_of(' '));
-    auto *command = server.getCommandMap().getCommand(std::string(command_name));
+    auto *command = server.getCommandMap().findCommand(command_name);
     auto *sender = ctx.getOrigin().toEndstone();
     if (command && sender) {
         if (!command->testPermission(*sender)) {
@@ -69,5 +131,18 @@ MCRESULT MinecraftCommands::executeCommand(CommandContext &ctx, bool suppress_ou
 #else
     result = ENDSTONE_HOOK_CALL_ORIGINAL(&MinecraftCommands::executeCommand, this, ctx, suppress_output);
 #endif
+
+    if (command) {
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        auto &timings = server.getCommandMap().getTimings();
+        if (timings.isEnabled()) {
+            timings.record(*command, elapsed);
+        }
+        if (elapsed >= CommandTimings::SlowCommandThreshold) {
+            server.getLogger().warning("Command '{}' issued by {} took {:.2f}ms", ctx.getCommand(),
+                                       sender ? sender->getName() : ctx.getOrigin().getName(),
+                                       std::chrono::duration<double, std::milli>(elapsed).count());
+        }
+    }
     return result;
 }
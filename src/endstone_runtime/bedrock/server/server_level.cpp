@@ -15,9 +15,11 @@
 #include "bedrock/server/server_level.h"
 
 #include "endstone/detail/hook.h"
+#include "endstone/detail/level/dimension.h"
 #include "endstone/detail/server.h"
 #include "endstone/event/actor/actor_spawn_event.h"
 
+using endstone::detail::EndstoneDimension;
 using endstone::detail::EndstoneServer;
 
 void ServerLevel::_postReloadActorAdded(Actor &actor)
@@ -28,11 +30,22 @@ void ServerLevel::_postReloadActorAdded(Actor &actor)
         return;
     }
 
+    // Checked before the event so that capped spawns are rejected without any plugin seeing them
+    auto &dimension = static_cast<EndstoneDimension &>(actor.getDimension().getEndstoneDimension());
+    if (!dimension.canAddActor(actor)) {
+        actor.despawn();
+        return;
+    }
+
     auto &server = entt::locator<EndstoneServer>::value();
-    endstone::ActorSpawnEvent e{actor.getEndstoneActor()};
-    server.getPluginManager().callEvent(e);
+    if (server.getPluginManager().hasListeners<endstone::ActorSpawnEvent>()) {
+        endstone::ActorSpawnEvent e{actor.getEndstoneActor()};
+        server.getPluginManager().callEvent(e);
 
-    if (e.isCancelled()) {
-        actor.despawn();
+        if (e.isCancelled()) {
+            actor.despawn();
+            return;
+        }
     }
+    dimension.onActorAdded(actor);
 }
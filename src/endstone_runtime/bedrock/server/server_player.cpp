@@ -16,12 +16,15 @@
 
 #include "bedrock/locale/i18n.h"
 #include "endstone/detail/hook.h"
+#include "endstone/detail/join_timings.h"
 #include "endstone/detail/server.h"
 #include "endstone/event/player/player_death_event.h"
 #include "endstone/event/player/player_join_event.h"
 #include "endstone/event/player/player_quit_event.h"
 
 using endstone::detail::EndstoneServer;
+using endstone::detail::JoinPhase;
+using endstone::detail::JoinTimer;
 
 void ServerPlayer::die(const ActorDamageSource &source)
 {
@@ -59,10 +62,21 @@ void ServerPlayer::setLocalPlayerAsInitialized()
     ENDSTONE_HOOK_CALL_ORIGINAL(&ServerPlayer::setLocalPlayerAsInitialized, this);
     auto &server = entt::locator<EndstoneServer>::value();
     auto &endstone_player = getEndstonePlayer();
+    server.onPlayerJoin();
+    auto &timings = server.getJoinTimings();
     endstone::PlayerJoinEvent e{endstone_player};
-    server.getPluginManager().callEvent(e);
-    endstone_player.recalculatePermissions();
-    endstone_player.updateCommands();
+    {
+        JoinTimer timer(timings, JoinPhase::JoinEvent);
+        server.getPluginManager().callEvent(e);
+    }
+    {
+        JoinTimer timer(timings, JoinPhase::Permissions);
+        endstone_player.recalculatePermissions();
+    }
+    {
+        JoinTimer timer(timings, JoinPhase::Commands);
+        server.requestCommandUpdate(endstone_player);
+    }
 }
 
 void ServerPlayer::disconnect()
@@ -29,19 +29,25 @@
 #include "bedrock/world/level/level.h"
 #include "endstone/detail/actor/actor.h"
 #include "endstone/detail/hook.h"
+#include "endstone/detail/level/dimension.h"
 #include "endstone/detail/player.h"
 #include "endstone/detail/server.h"
 #include "endstone/event/actor/actor_remove_event.h"
 #include "endstone/event/actor/actor_teleport_event.h"
 
+using endstone::detail::EndstoneDimension;
 using endstone::detail::EndstoneServer;
 
 void Actor::remove()
 {
+    auto &server = entt::locator<EndstoneServer>::value();
     if (!isPlayer()) {
-        auto &server = entt::locator<EndstoneServer>::value();
-        endstone::ActorRemoveEvent e{getEndstoneActor()};
-        server.getPluginManager().callEvent(e);
+        if (server.getPluginManager().hasListeners<endstone::ActorRemoveEvent>()) {
+            endstone::ActorRemoveEvent e{getEndstoneActor()};
+            server.getPluginManager().callEvent(e);
+        }
+        static_cast<EndstoneDimension &>(getDimension().getEndstoneDimension()).onActorRemoved(*this);
+        server.onActorRemoved(getRuntimeID().raw_id);
     }
 
     ENDSTONE_HOOK_CALL_ORIGINAL_NAME(&Actor::remove, __FUNCDNAME__, this);
@@ -49,12 +55,13 @@ void Actor::remove()
 
 void Actor::teleportTo(const Vec3 &pos, bool should_stop_riding, int cause, int entity_type, bool keep_velocity)
 {
+    ENDSTONE_HOOK_TIMING_NAME(__FUNCDNAME__);
     Vec3 position = pos;
-    if (!isPlayer()) {
-        auto &server = entt::locator<EndstoneServer>::value();
+    auto &server = entt::locator<EndstoneServer>::value();
+    if (!isPlayer() && server.getPluginManager().hasListeners<endstone::ActorTeleportEvent>()) {
         auto &actor = getEndstoneActor();
         endstone::Location to{&actor.getDimension(), pos.x, pos.y, pos.z, getRotation().x, getRotation().y};
-        endstone::ActorTeleportEvent e{actor, actor.getLocation(), to};
+        endstone::ActorTeleportEvent e{actor, to};
         server.getPluginManager().callEvent(e);
 
         if (e.isCancelled()) {
@@ -84,6 +91,12 @@ bool Actor::hasType(ActorType type) const
     return !!(component->type & type);
 }
 
+ActorType Actor::getEntityTypeId() const
+{
+    auto component = getPersistentComponent<ActorTypeComponent>();
+    return component->type;
+}
+
 bool Actor::isPlayer() const
 {
     return hasComponent<PlayerComponent>();
@@ -183,6 +196,11 @@ bool Actor::hasCategory(ActorCategory category) const
     return !!(categories_ & category);
 }
 
+ActorCategory Actor::getCategories() const
+{
+    return categories_;
+}
+
 Actor *Actor::tryGetFromEntity(EntityContext const &ctx, bool include_removed)
 {
     auto *component = ctx.tryGetComponent<ActorOwnerComponent>();
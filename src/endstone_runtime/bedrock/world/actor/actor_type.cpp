@@ -0,0 +1,301 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "bedrock/world/actor/actor_type.h"
+
+namespace {
+const char *getEntityTypeName(ActorType type)
+{
+    switch (type) {
+    case ActorType::Chicken:
+        return "chicken";
+    case ActorType::Cow:
+        return "cow";
+    case ActorType::Pig:
+        return "pig";
+    case ActorType::Sheep:
+        return "sheep";
+    case ActorType::Wolf:
+        return "wolf";
+    case ActorType::Villager:
+        return "villager";
+    case ActorType::MushroomCow:
+        return "mooshroom";
+    case ActorType::Squid:
+        return "squid";
+    case ActorType::Rabbit:
+        return "rabbit";
+    case ActorType::Bat:
+        return "bat";
+    case ActorType::IronGolem:
+        return "iron_golem";
+    case ActorType::SnowGolem:
+        return "snow_golem";
+    case ActorType::Ocelot:
+        return "ocelot";
+    case ActorType::Horse:
+        return "horse";
+    case ActorType::Donkey:
+        return "donkey";
+    case ActorType::Mule:
+        return "mule";
+    case ActorType::SkeletonHorse:
+        return "skeleton_horse";
+    case ActorType::ZombieHorse:
+        return "zombie_horse";
+    case ActorType::PolarBear:
+        return "polar_bear";
+    case ActorType::Llama:
+        return "llama";
+    case ActorType::Parrot:
+        return "parrot";
+    case ActorType::Dolphin:
+        return "dolphin";
+    case ActorType::Zombie:
+        return "zombie";
+    case ActorType::Creeper:
+        return "creeper";
+    case ActorType::Skeleton:
+        return "skeleton";
+    case ActorType::Spider:
+        return "spider";
+    case ActorType::PigZombie:
+        return "zombie_pigman";
+    case ActorType::Slime:
+        return "slime";
+    case ActorType::EnderMan:
+        return "enderman";
+    case ActorType::Silverfish:
+        return "silverfish";
+    case ActorType::CaveSpider:
+        return "cave_spider";
+    case ActorType::Ghast:
+        return "ghast";
+    case ActorType::LavaSlime:
+        return "magma_cube";
+    case ActorType::Blaze:
+        return "blaze";
+    case ActorType::ZombieVillager:
+        return "zombie_villager";
+    case ActorType::Witch:
+        return "witch";
+    case ActorType::Stray:
+        return "stray";
+    case ActorType::Husk:
+        return "husk";
+    case ActorType::WitherSkeleton:
+        return "wither_skeleton";
+    case ActorType::Guardian:
+        return "guardian";
+    case ActorType::ElderGuardian:
+        return "elder_guardian";
+    case ActorType::Npc:
+        return "npc";
+    case ActorType::WitherBoss:
+        return "wither";
+    case ActorType::Dragon:
+        return "ender_dragon";
+    case ActorType::Shulker:
+        return "shulker";
+    case ActorType::Endermite:
+        return "endermite";
+    case ActorType::Agent:
+        return "agent";
+    case ActorType::Vindicator:
+        return "vindicator";
+    case ActorType::Phantom:
+        return "phantom";
+    case ActorType::IllagerBeast:
+        return "ravager";
+    case ActorType::ArmorStand:
+        return "armor_stand";
+    case ActorType::TripodCamera:
+        return "tripod_camera";
+    case ActorType::Player:
+        return "player";
+    case ActorType::ItemEntity:
+        return "item";
+    case ActorType::PrimedTnt:
+        return "tnt";
+    case ActorType::FallingBlock:
+        return "falling_block";
+    case ActorType::MovingBlock:
+        return "moving_block";
+    case ActorType::ExperiencePotion:
+        return "xp_bottle";
+    case ActorType::Experience:
+        return "xp_orb";
+    case ActorType::EyeOfEnder:
+        return "eye_of_ender_signal";
+    case ActorType::EnderCrystal:
+        return "ender_crystal";
+    case ActorType::FireworksRocket:
+        return "fireworks_rocket";
+    case ActorType::Trident:
+        return "thrown_trident";
+    case ActorType::Turtle:
+        return "turtle";
+    case ActorType::Cat:
+        return "cat";
+    case ActorType::ShulkerBullet:
+        return "shulker_bullet";
+    case ActorType::FishingHook:
+        return "fishing_hook";
+    case ActorType::Chalkboard:
+        return "chalkboard";
+    case ActorType::DragonFireball:
+        return "dragon_fireball";
+    case ActorType::Arrow:
+        return "arrow";
+    case ActorType::Snowball:
+        return "snowball";
+    case ActorType::ThrownEgg:
+        return "egg";
+    case ActorType::Painting:
+        return "painting";
+    case ActorType::MinecartRideable:
+        return "minecart";
+    case ActorType::LargeFireball:
+        return "fireball";
+    case ActorType::ThrownPotion:
+        return "splash_potion";
+    case ActorType::Enderpearl:
+        return "ender_pearl";
+    case ActorType::LeashKnot:
+        return "leash_knot";
+    case ActorType::WitherSkull:
+        return "wither_skull";
+    case ActorType::BoatRideable:
+        return "boat";
+    case ActorType::WitherSkullDangerous:
+        return "wither_skull_dangerous";
+    case ActorType::LightningBolt:
+        return "lightning_bolt";
+    case ActorType::SmallFireball:
+        return "small_fireball";
+    case ActorType::AreaEffectCloud:
+        return "area_effect_cloud";
+    case ActorType::MinecartHopper:
+        return "hopper_minecart";
+    case ActorType::MinecartTNT:
+        return "tnt_minecart";
+    case ActorType::MinecartChest:
+        return "chest_minecart";
+    case ActorType::MinecartFurnace:
+        return "furnace_minecart";
+    case ActorType::MinecartCommandBlock:
+        return "command_block_minecart";
+    case ActorType::LingeringPotion:
+        return "lingering_potion";
+    case ActorType::LlamaSpit:
+        return "llama_spit";
+    case ActorType::EvocationFang:
+        return "evocation_fang";
+    case ActorType::EvocationIllager:
+        return "evocation_illager";
+    case ActorType::Vex:
+        return "vex";
+    case ActorType::IceBomb:
+        return "ice_bomb";
+    case ActorType::Balloon:
+        return "balloon";
+    case ActorType::Pufferfish:
+        return "pufferfish";
+    case ActorType::Salmon:
+        return "salmon";
+    case ActorType::Drowned:
+        return "drowned";
+    case ActorType::Tropicalfish:
+        return "tropicalfish";
+    case ActorType::Fish:
+        return "cod";
+    case ActorType::Panda:
+        return "panda";
+    case ActorType::Pillager:
+        return "pillager";
+    case ActorType::VillagerV2:
+        return "villager_v2";
+    case ActorType::ZombieVillagerV2:
+        return "zombie_villager_v2";
+    case ActorType::Shield:
+        return "shield";
+    case ActorType::WanderingTrader:
+        return "wandering_trader";
+    case ActorType::Lectern:
+        return "lectern";
+    case ActorType::ElderGuardianGhost:
+        return "elder_guardian_ghost";
+    case ActorType::Fox:
+        return "fox";
+    case ActorType::Bee:
+        return "bee";
+    case ActorType::Piglin:
+        return "piglin";
+    case ActorType::Hoglin:
+        return "hoglin";
+    case ActorType::Strider:
+        return "strider";
+    case ActorType::Zoglin:
+        return "zoglin";
+    case ActorType::PiglinBrute:
+        return "piglin_brute";
+    case ActorType::Goat:
+        return "goat";
+    case ActorType::GlowSquid:
+        return "glow_squid";
+    case ActorType::Axolotl:
+        return "axolotl";
+    case ActorType::Warden:
+        return "warden";
+    case ActorType::Frog:
+        return "frog";
+    case ActorType::Tadpole:
+        return "tadpole";
+    case ActorType::Allay:
+        return "allay";
+    case ActorType::ChestBoatRideable:
+        return "chest_boat";
+    case ActorType::TraderLlama:
+        return "trader_llama";
+    case ActorType::Camel:
+        return "camel";
+    case ActorType::Sniffer:
+        return "sniffer";
+    case ActorType::Breeze:
+        return "breeze";
+    case ActorType::BreezeWindChargeProjectile:
+        return "breeze_wind_charge_projectile";
+    case ActorType::Armadillo:
+        return "armadillo";
+    case ActorType::WindChargeProjectile:
+        return "wind_charge_projectile";
+    case ActorType::Bogged:
+        return "bogged";
+    case ActorType::OminousItemSpawner:
+        return "ominous_item_spawner";
+    default:
+        return "unknown";
+    }
+}
+}  // namespace
+
+std::string EntityTypeToString(ActorType type, ActorTypeNamespaceRules namespace_rules)
+{
+    // Looked up by Endstone, the vanilla function has no symbol to call through
+    std::string name = getEntityTypeName(type);
+    if (namespace_rules == ActorTypeNamespaceRules::ReturnWithNamespace) {
+        return "minecraft:" + name;
+    }
+    return name;
+}
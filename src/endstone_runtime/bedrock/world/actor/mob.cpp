@@ -24,8 +24,8 @@ using endstone::detail::EndstoneServer;
 
 void Mob::die(const ActorDamageSource &source)
 {
-    if (!isPlayer()) {
-        auto &server = entt::locator<EndstoneServer>::value();
+    auto &server = entt::locator<EndstoneServer>::value();
+    if (!isPlayer() && server.getPluginManager().hasListeners<endstone::ActorDeathEvent>()) {
         endstone::ActorDeathEvent e{getEndstoneActor()};
         server.getPluginManager().callEvent(e);
     }
@@ -29,19 +29,23 @@ using endstone::detail::EndstoneServer;
 
 void Player::teleportTo(const Vec3 &pos, bool should_stop_riding, int cause, int entity_type, bool keep_velocity)
 {
+    ENDSTONE_HOOK_TIMING_NAME(__FUNCDNAME__);
     Vec3 position = pos;
     auto &server = entt::locator<EndstoneServer>::value();
-    auto &player = getEndstonePlayer();
-    endstone::Location to{&player.getDimension(), pos.x, pos.y, pos.z, getRotation().x, getRotation().y};
-    endstone::PlayerTeleportEvent e{player, player.getLocation(), to};
-    server.getPluginManager().callEvent(e);
-
-    if (e.isCancelled()) {
-        return;
+    if (server.getPluginManager().hasListeners<endstone::PlayerTeleportEvent>()) {
+        auto &player = getEndstonePlayer();
+        endstone::Location to{&player.getDimension(), pos.x, pos.y, pos.z, getRotation().x, getRotation().y};
+        endstone::PlayerTeleportEvent e{player, to};
+        server.getPluginManager().callEvent(e);
+
+        if (e.isCancelled()) {
+            return;
+        }
+        position = {e.getTo().getX(), e.getTo().getY(), e.getTo().getZ()};
     }
-    position = {e.getTo().getX(), e.getTo().getY(), e.getTo().getZ()};
     ENDSTONE_HOOK_CALL_ORIGINAL_NAME(&Player::teleportTo, __FUNCDNAME__, this, position, should_stop_riding, cause,
                                      entity_type, keep_velocity);
+    server.resetMovement(getEndstonePlayer());
 }
 
 Container &Player::getInventory()
@@ -59,7 +63,7 @@ void Player::setPermissions(CommandPermissionLevel level)
     ENDSTONE_HOOK_CALL_ORIGINAL(&Player::setPermissions, this, level);
     auto &player = getEndstonePlayer();
     player.recalculatePermissions();
-    player.updateCommands();
+    entt::locator<EndstoneServer>::value().requestCommandUpdate(player);
 }
 
 endstone::detail::EndstonePlayer &Player::getEndstonePlayer() const
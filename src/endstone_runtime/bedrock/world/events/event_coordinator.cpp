@@ -14,20 +14,27 @@
 
 #include "bedrock/world/events/event_coordinator.h"
 
+#include <optional>
+
 #include <entt/entt.hpp>
 #include <pybind11/pybind11.h>
 #include <spdlog/spdlog.h>
 
-#include "bedrock/deps/jsoncpp/nlohmann_json.h"
 #include "bedrock/server/server_instance.h"
 #include "bedrock/world/level/level.h"
 #include "endstone/color_format.h"
+#include "endstone/detail/form/form_response.h"
+#include "endstone/detail/gameplay_event_visitor.h"
 #include "endstone/detail/hook.h"
 #include "endstone/detail/level/level.h"
 #include "endstone/detail/plugin/python_plugin_loader.h"
+#include "endstone/detail/profiler.h"
 #include "endstone/detail/scoreboard/scoreboard.h"
 #include "endstone/detail/server.h"
 #include "endstone/detail/signal_handler.h"
+#include "endstone/detail/startup_timings.h"
+#include "endstone/detail/thread_options.h"
+#include "endstone/detail/watchdog.h"
 #include "endstone/event/server/server_load_event.h"
 #include "endstone/plugin/plugin_load_order.h"
 
@@ -39,7 +46,17 @@ using endstone::ServerLoadEvent;
 using endstone::detail::EndstoneLevel;
 using endstone::detail::EndstoneScoreboard;
 using endstone::detail::EndstoneServer;
+using endstone::detail::GameplayEventVisitor;
+using endstone::detail::Profiler;
 using endstone::detail::PythonPluginLoader;
+using endstone::detail::StartupTimings;
+using endstone::detail::ThreadOptions;
+using endstone::detail::Watchdog;
+
+namespace {
+// The world is loaded between the start of the server initialisation and the start of the server thread
+StartupTimings::Clock::time_point gWorldStart;
+}  // namespace
 
 // void ActorEventCoordinator::sendEvent(const EventRef<ActorGameplayEvent<void>> &ref)
 //{
@@ -101,9 +118,10 @@ LevelGameplayHandler &LevelEventCoordinator::getLevelGameplayHandler()
 
 void PlayerEventCoordinator::sendEvent(const EventRef<PlayerGameplayEvent<void>> &ref)
 {
-    void (PlayerEventCoordinator::*fp)(const EventRef<PlayerGameplayEvent<void>> &) =
+    constexpr void (PlayerEventCoordinator::*fp)(const EventRef<PlayerGameplayEvent<void>> &) =
         &PlayerEventCoordinator::sendEvent;
-    auto visitor = entt::overloaded{
+    // Only the form events are handled, the other player events are not visited
+    static const GameplayEventVisitor visitor{
         [](const Details::ValueOrRef<PlayerFormCloseEvent const> &value) {
             const auto event = value.asValue();
             const auto &weak_ref = event.player;
@@ -115,18 +133,22 @@ void PlayerEventCoordinator::sendEvent(const EventRef<PlayerGameplayEvent<void>>
             }
         },
         [](const Details::ValueOrRef<PlayerFormResponseEvent const> &value) {
-            const auto event = value.asValue();
-            const auto &weak_ref = event.player;
+            // Read in place, a copy of the event would copy the whole response
+            const auto *event = value.tryGet();
+            if (!event) {
+                return;
+            }
+            const auto &weak_ref = event->player;
             EntityContext ctx{*weak_ref.storage.registry, weak_ref.storage.entity_id};
             auto *player = static_cast<Player *>(Actor::tryGetFromEntity(ctx, false));
             if (player) {
                 // Players can be null if they are dead when we receive the event
-                player->getEndstonePlayer().onFormResponse(event.form_id, Json::to_nlohmann(event.form_response));
+                player->getEndstonePlayer().onFormResponse(event->form_id,
+                                                           endstone::detail::FormResponse(event->form_response));
             }
         },
-        [](auto &&ignored) {},
     };
-    std::visit(visitor, ref.variant.variant.variant);
+    visitor(ref.variant.variant.variant);
     ENDSTONE_HOOK_CALL_ORIGINAL(fp, this, ref);
 }
 
@@ -149,21 +171,33 @@ void ServerInstanceEventCoordinator::sendServerInitializeStart(ServerInstance &i
     server.loadPlugins();
     server.enablePlugins(PluginLoadOrder::Startup);
     ENDSTONE_HOOK_CALL_ORIGINAL(&ServerInstanceEventCoordinator::sendServerInitializeStart, this, instance);
+    gWorldStart = StartupTimings::Clock::now();
 }
 
 void ServerInstanceEventCoordinator::sendServerThreadStarted(ServerInstance &instance)
 {
     auto &server = entt::locator<EndstoneServer>::value();
+    if (!ThreadOptions::fromEnvironment("SERVER").apply()) {
+        server.getLogger().warning("Unable to set the affinity or the priority of the server thread.");
+    }
+    StartupTimings::getInstance().record("World initialisation", StartupTimings::Clock::now() - gWorldStart);
     server.setCommandMap(std::make_unique<endstone::detail::EndstoneCommandMap>(server));
     server.enablePlugins(PluginLoadOrder::PostWorld);
     ServerLoadEvent event{ServerLoadEvent::LoadType::Startup};
     server.getPluginManager().callEvent(event);
+    StartupTimings::getInstance().report(server.getLogger());
+    Watchdog::getInstance().start();
     ENDSTONE_HOOK_CALL_ORIGINAL(&ServerInstanceEventCoordinator::sendServerThreadStarted, this, instance);
 }
 
 void ServerInstanceEventCoordinator::sendServerThreadStopped(ServerInstance &instance)
 {
-    py::gil_scoped_acquire acquire{};
+    Watchdog::getInstance().stop();
+    Profiler::getInstance().shutdown();
+    std::optional<py::gil_scoped_acquire> acquire;
+    if (PythonPluginLoader::isInterpreterInitialized()) {
+        acquire.emplace();
+    }
     entt::locator<EndstoneServer>::value().disablePlugins();
     entt::locator<EndstoneServer>::reset();  // we explicitly acquire GIL and destroy the server instance as the command
                                              // map and the plugin manager hold shared_ptrs to python objects
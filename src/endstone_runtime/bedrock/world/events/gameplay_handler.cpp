@@ -26,26 +26,42 @@
 
 using endstone::detail::EndstoneLevel;
 using endstone::detail::EndstoneServer;
+using endstone::detail::LevelSync;
 
 GameplayHandlerResult<CoordinatorResult> ScriptLevelGameplayHandler::handleEvent(LevelWeatherChangedEvent &event)
 {
     auto &server = entt::locator<EndstoneServer>::value();
     auto &level = *server.getLevel();
+    auto &sync = static_cast<EndstoneLevel &>(level).getSync();
+    auto current_tick = server.getCurrentTick();
 
+    // A change that plugins just cancelled is cancelled again without asking them, until the weather interval passed
     if (event.from_rain != event.to_rain) {
-        endstone::WeatherChangeEvent e(level, event.to_rain);
-        server.getPluginManager().callEvent(e);
-        if (e.isCancelled()) {
+        if (sync.isSuppressed(LevelSync::Weather::Rain, event.to_rain, current_tick)) {
             event.to_rain = event.from_rain;
         }
+        else {
+            endstone::WeatherChangeEvent e(level, event.to_rain);
+            server.getPluginManager().callEvent(e);
+            if (e.isCancelled()) {
+                sync.recordCancelled(LevelSync::Weather::Rain, event.to_rain, current_tick);
+                event.to_rain = event.from_rain;
+            }
+        }
     }
 
     if (event.from_lightning != event.to_lightning) {
-        endstone::ThunderChangeEvent e(level, event.to_lightning);
-        server.getPluginManager().callEvent(e);
-        if (e.isCancelled()) {
+        if (sync.isSuppressed(LevelSync::Weather::Lightning, event.to_lightning, current_tick)) {
             event.to_lightning = event.from_lightning;
         }
+        else {
+            endstone::ThunderChangeEvent e(level, event.to_lightning);
+            server.getPluginManager().callEvent(e);
+            if (e.isCancelled()) {
+                sync.recordCancelled(LevelSync::Weather::Lightning, event.to_lightning, current_tick);
+                event.to_lightning = event.from_lightning;
+            }
+        }
     }
 
     GameplayHandlerResult<CoordinatorResult> result;
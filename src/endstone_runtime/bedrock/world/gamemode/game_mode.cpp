@@ -32,12 +32,14 @@ using endstone::detail::EndstoneServer;
 bool GameMode::destroyBlock(BlockPos const &pos, FacingID face)
 {
     const auto &server = entt::locator<EndstoneServer>::value();
-    auto &player = player_->getEndstonePlayer();
-    const auto block = EndstoneBlock::at(player.getHandle().getDimension().getBlockSourceFromMainChunkSource(), pos);
-    endstone::BlockBreakEvent e{*block, player};
-    server.getPluginManager().callEvent(e);
-    if (e.isCancelled()) {
-        return false;
+    if (server.getPluginManager().hasListeners<endstone::BlockBreakEvent>()) {
+        auto &player = player_->getEndstonePlayer();
+        auto block = EndstoneBlock::view(player.getHandle().getDimension().getBlockSourceFromMainChunkSource(), pos);
+        endstone::BlockBreakEvent e{block, player};
+        server.getPluginManager().callEvent(e);
+        if (e.isCancelled()) {
+            return false;
+        }
     }
     return ENDSTONE_HOOK_CALL_ORIGINAL_NAME(&GameMode::destroyBlock, __FUNCDNAME__, this, pos, face);
 }
@@ -48,18 +50,18 @@ InteractionResult GameMode::useItemOn(ItemStack &item, BlockPos const &at, Facin
     InteractionResult result = {0};
 
     const auto &server = entt::locator<EndstoneServer>::value();
-    auto &player = player_->getEndstonePlayer();
-    auto block = EndstoneBlock::at(player.getHandle().getDimension().getBlockSourceFromMainChunkSource(), at);
-    endstone::PlayerInteractEvent e{
-        player,
-        std::make_unique<EndstoneItemStack>(item),
-        std::move(block),
-        static_cast<endstone::BlockFace>(face),
-        {hit.x, hit.y, hit.z},
-    };
-    server.getPluginManager().callEvent(e);
-    if (e.isCancelled()) {
-        return result;
+    if (server.getPluginManager().hasListeners<endstone::PlayerInteractEvent>()) {
+        auto &player = player_->getEndstonePlayer();
+        // The wrappers only need to outlive the dispatch, so keep them on the stack
+        auto block = EndstoneBlock::view(player.getHandle().getDimension().getBlockSourceFromMainChunkSource(), at);
+        EndstoneItemStack item_stack{item};
+        endstone::PlayerInteractEvent e{
+            player, &item_stack, &block, static_cast<endstone::BlockFace>(face), {hit.x, hit.y, hit.z},
+        };
+        server.getPluginManager().callEvent(e);
+        if (e.isCancelled()) {
+            return result;
+        }
     }
 
 #if _WIN32
@@ -75,11 +77,13 @@ InteractionResult GameMode::useItemOn(ItemStack &item, BlockPos const &at, Facin
 bool GameMode::interact(Actor &actor, Vec3 const &location)
 {
     const auto &server = entt::locator<EndstoneServer>::value();
-    auto &player = player_->getEndstonePlayer();
-    endstone::PlayerInteractActorEvent e{player, actor.getEndstoneActor()};
-    server.getPluginManager().callEvent(e);
-    if (e.isCancelled()) {
-        return false;
+    if (server.getPluginManager().hasListeners<endstone::PlayerInteractActorEvent>()) {
+        auto &player = player_->getEndstonePlayer();
+        endstone::PlayerInteractActorEvent e{player, actor.getEndstoneActor()};
+        server.getPluginManager().callEvent(e);
+        if (e.isCancelled()) {
+            return false;
+        }
     }
     return ENDSTONE_HOOK_CALL_ORIGINAL_NAME(&GameMode::interact, __FUNCDNAME__, this, actor, location);
 }
@@ -33,12 +33,15 @@ CoordinatorResult Item::_sendTryPlaceBlockEvent(Block const &placement_block, Bl
 {
     const auto &server = entt::locator<EndstoneServer>::value();
 
-    if (actor.isPlayer()) {
+    if (actor.isPlayer() && server.getPluginManager().hasListeners<endstone::BlockPlaceEvent>()) {
         auto &player = static_cast<const Player &>(actor).getEndstonePlayer();
-        const auto block_replaced = EndstoneBlock::at(const_cast<BlockSource &>(block_source), pos);
-        const auto block_face = static_cast<endstone::BlockFace>(face);
-        const auto block_against = block_replaced->getRelative(EndstoneBlockFace::getOpposite(block_face));
-        endstone::BlockPlaceEvent e{*block_replaced, *block_against, player};
+        auto &source = const_cast<BlockSource &>(block_source);
+        const auto opposite = EndstoneBlockFace::getOpposite(static_cast<endstone::BlockFace>(face));
+        auto block_replaced = EndstoneBlock::view(source, pos);
+        auto block_against = EndstoneBlock::view(source, {pos.x + EndstoneBlockFace::getOffsetX(opposite),
+                                                          pos.y + EndstoneBlockFace::getOffsetY(opposite),
+                                                          pos.z + EndstoneBlockFace::getOffsetZ(opposite)});
+        endstone::BlockPlaceEvent e{block_replaced, block_against, player};
         server.getPluginManager().callEvent(e);
         if (e.isCancelled()) {
             return CoordinatorResult::Deny;
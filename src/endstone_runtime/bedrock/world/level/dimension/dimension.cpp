@@ -14,6 +14,7 @@
 
 #include "bedrock/world/level/dimension/dimension.h"
 
+#include "endstone/detail/level/level.h"
 #include "endstone/detail/server.h"
 
 Level &Dimension::getLevel() const
@@ -28,9 +29,10 @@ const std::string &Dimension::getName() const
 
 endstone::Dimension &Dimension::getEndstoneDimension() const
 {
+    using endstone::detail::EndstoneLevel;
     using endstone::detail::EndstoneServer;
     auto &server = entt::locator<EndstoneServer>::value();
-    return *server.getLevel()->getDimension(getName());
+    return *static_cast<EndstoneLevel *>(server.getLevel())->getDimension(*this);
 }
 
 BlockSource &Dimension::getBlockSourceFromMainChunkSource() const
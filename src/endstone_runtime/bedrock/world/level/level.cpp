@@ -19,14 +19,18 @@
 #include "endstone/detail/hook.h"
 #include "endstone/detail/scheduler/scheduler.h"
 #include "endstone/detail/server.h"
+#include "endstone/detail/watchdog.h"
 
 using endstone::detail::EndstoneScheduler;
 using endstone::detail::EndstoneServer;
+using endstone::detail::Watchdog;
 
 void Level::tick()
 {
     static std::string function_decorated_name = __FUNCDNAME__;
+    ENDSTONE_HOOK_TIMING_NAME(function_decorated_name);
     auto &server = entt::locator<EndstoneServer>::value();
+    Watchdog::getInstance().heartbeat(getCurrentServerTick().tick_id);
     server.tick(getCurrentServerTick().tick_id,
                 [&]() { ENDSTONE_HOOK_CALL_ORIGINAL_NAME(&Level::tick, function_decorated_name, this); });
 }
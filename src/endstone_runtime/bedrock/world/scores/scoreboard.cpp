@@ -14,6 +14,8 @@
 
 #include "bedrock/world/scores/scoreboard.h"
 
+#include <charconv>
+
 #include "bedrock/world/actor/player/player.h"
 #include "endstone/detail/hook.h"
 
@@ -96,14 +98,13 @@ const ScoreboardId &Scoreboard::getScoreboardId(const std::string &fake) const
     if (id.isValid()) {
         return id;
     }
-    try {
-        ActorUniqueID actor_unique_id;
-        actor_unique_id.raw_id = std::stoll(fake);
-        return identity_dictionary_.getScoreboardId(actor_unique_id);
-    }
-    catch (std::exception &) {
+    // Names that are not numbers are the common case, so they are told apart without throwing like std::stoll would
+    ActorUniqueID actor_unique_id;
+    auto [ptr, ec] = std::from_chars(fake.data(), fake.data() + fake.size(), actor_unique_id.raw_id);
+    if (ec != std::errc()) {
         return id;
     }
+    return identity_dictionary_.getScoreboardId(actor_unique_id);
 }
 
 bool Scoreboard::hasIdentityFor(const ScoreboardId &id) const
@@ -152,7 +153,7 @@ void Scoreboard::resetPlayerScore(const ScoreboardId &id)
 
 bool Scoreboard::resetPlayerScore(const ScoreboardId &id, Objective &objective)
 {
-    bool (Scoreboard::*func)(const ScoreboardId &, Objective &) = &Scoreboard::resetPlayerScore;
+    constexpr bool (Scoreboard::*func)(const ScoreboardId &, Objective &) = &Scoreboard::resetPlayerScore;
     return ENDSTONE_HOOK_CALL_ORIGINAL(func, this, id, objective);
 }
 
@@ -14,18 +14,69 @@
 
 #include "endstone/detail/hook.h"
 
+#include <chrono>
+#include <filesystem>
+#include <optional>
 #include <string>
 #include <system_error>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
+#include <cpptrace/cpptrace.hpp>
 #include <funchook/funchook.h>
 #include <spdlog/spdlog.h>
 
+#include "endstone/detail/os.h"
+#include "endstone/detail/startup_timings.h"
+#include "endstone/detail/symbol_cache.h"
+
 namespace endstone::detail::hook {
 
 namespace {
 std::unordered_map<void *, void *> gOriginalsByDetour;
 std::unordered_map<std::string, void *> gOriginalsByName;
+bool gInstalled = false;
+funchook_t *gHook = nullptr;  // kept for the lifetime of the process, destroying it would uninstall the hooks
+
+std::vector<std::pair<void *, void **>> &get_original_slots()
+{
+    // Slots register themselves during static initialisation, possibly before this translation unit's globals
+    static std::vector<std::pair<void *, void **>> slots;
+    return slots;
+}
+
+const SymbolTable &get_symbol_table()
+{
+    static const SymbolTable table = []() {
+        auto start = std::chrono::steady_clock::now();
+        const auto module_path = std::filesystem::path{os::get_module_pathname()};
+        const auto cache_path = module_path.parent_path() / "symbols.cache";
+        const auto key = get_symbol_cache_key(
+            {os::get_executable_pathname(), module_path, module_path.parent_path() / "symbols.toml"});
+
+        if (auto cached = load_symbol_cache(cache_path, key)) {
+            spdlog::debug("Loaded {} detours and {} targets from {} in {:.1f}ms", cached->detours.size(),
+                          cached->targets.size(), cache_path.string(),
+                          std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+            return std::move(cached.value());
+        }
+
+        SymbolTable result;
+        result.targets = read_targets();
+        result.detours = read_detours(result.targets);
+        spdlog::debug("Read {} detours and {} targets in {:.1f}ms", result.detours.size(), result.targets.size(),
+                      std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        try {
+            save_symbol_cache(cache_path, key, result);
+        }
+        catch (const std::exception &e) {
+            spdlog::warn("Unable to write symbol cache {}: {}", cache_path.string(), e.what());
+        }
+        return result;
+    }();
+    return table;
+}
 }  // namespace
 
 void *get_original(void *detour)
@@ -46,39 +97,127 @@ void *get_original(const std::string &name)
     return it->second;
 }
 
+bool register_original(void *detour, void **slot)
+{
+    get_original_slots().emplace_back(detour, slot);
+    if (gInstalled) {
+        if (auto it = gOriginalsByDetour.find(detour); it != gOriginalsByDetour.end()) {
+            *slot = it->second;
+        }
+    }
+    return true;
+}
+
+const std::unordered_map<std::string, void *> &get_detours()
+{
+    static const auto detours = []() {
+        auto *module_base = static_cast<char *>(os::get_module_base());
+        std::unordered_map<std::string, void *> result;
+        result.reserve(get_symbol_table().detours.size());
+        for (const auto &[name, offset] : get_symbol_table().detours) {
+            result.emplace(name, module_base + offset);
+        }
+        return result;
+    }();
+    return detours;
+}
+
+const std::unordered_map<std::string, void *> &get_targets()
+{
+    static const auto targets = []() {
+        auto *executable_base = static_cast<char *>(os::get_executable_base());
+        std::unordered_map<std::string, void *> result;
+        result.reserve(get_symbol_table().targets.size());
+        for (const auto &[name, offset] : get_symbol_table().targets) {
+            result.emplace(name, executable_base + offset);
+        }
+        return result;
+    }();
+    return targets;
+}
+
+HookTimings::Entry &get_timings(void *detour)
+{
+    for (const auto &[name, address] : get_detours()) {
+        if (address == detour) {
+            return get_timings(name);
+        }
+    }
+    return HookTimings::getInstance().getEntry(fmt::format("{}", detour));
+}
+
+HookTimings::Entry &get_timings(const std::string &name)
+{
+    return HookTimings::getInstance().getEntry(cpptrace::demangle(name));
+}
+
 void install()
 {
+    // The symbol table is read on first use, then replaced by the hooks in the startup timings
+    std::optional<StartupTimer> timer{"Symbol table"};
     const auto &detours = get_detours();
     const auto &targets = get_targets();
+    timer.emplace("Hook installation");
+
+    // Prepare every detour into a single funchook instance so that they are all written in one pass
+    auto start = std::chrono::steady_clock::now();
+    gHook = funchook_create();
+    if (gHook == nullptr) {
+        throw std::system_error(FUNCHOOK_ERROR_OUT_OF_MEMORY, hook_error_category());
+    }
 
     for (const auto &[name, detour] : detours) {
-        if (auto it = targets.find(name); it != targets.end()) {
-            void *target = it->second;
-            void *original = target;
-
-            funchook_t *hook = funchook_create();
-            int status = funchook_prepare(hook, &original, detour);
-            if (status != 0) {
-                throw std::system_error(status, hook_error_category());
-            }
+        auto it = targets.find(name);
+        if (it == targets.end()) {
+            funchook_destroy(gHook);
+            gHook = nullptr;
+            throw std::runtime_error(fmt::format("Unable to find target function for detour: {}.", name));
+        }
 
-            status = funchook_install(hook, 0);
-            if (status != 0) {
-                throw std::system_error(status, hook_error_category());
-            }
+        void *target = it->second;
+        void *original = target;
 
-            spdlog::debug("{}: {} -> {} -> {}", name, target, detour, original);
-            gOriginalsByDetour.emplace(detour, original);
-            gOriginalsByName.emplace(name, original);
-        }
-        else {
-            throw std::runtime_error(fmt::format("Unable to find target function for detour: {}.", name));
+        auto prepare_start = std::chrono::steady_clock::now();
+        int status = funchook_prepare(gHook, &original, detour);
+        if (status != 0) {
+            funchook_destroy(gHook);
+            gHook = nullptr;
+            throw std::system_error(status, hook_error_category());
         }
+        auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - prepare_start);
+
+        spdlog::debug("{}: {} -> {} -> {} ({:.1f}us)", name, target, detour, original, elapsed.count());
+        gOriginalsByDetour.emplace(detour, original);
+        gOriginalsByName.emplace(name, original);
     }
 
+    auto install_start = std::chrono::steady_clock::now();
+    int status = funchook_install(gHook, 0);
+    if (status != 0) {
+        funchook_destroy(gHook);
+        gHook = nullptr;
+        throw std::system_error(status, hook_error_category());
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    spdlog::debug("Installed {} hooks in {:.1f}ms ({:.1f}ms writing)", detours.size(),
+                  std::chrono::duration<double, std::milli>(end - start).count(),
+                  std::chrono::duration<double, std::milli>(end - install_start).count());
+
     for (const auto &[name, target] : targets) {
         gOriginalsByName.emplace(name, target);
     }
+
+    // A detour without a symbol for this build is never installed, its slot is left null so the server still starts
+    for (const auto &[detour, slot] : get_original_slots()) {
+        auto it = gOriginalsByDetour.find(detour);
+        if (it == gOriginalsByDetour.end()) {
+            spdlog::warn("Detour {} has no symbol for this build and is not installed.", detour);
+            continue;
+        }
+        *slot = it->second;
+    }
+    gInstalled = true;
 }
 
 const std::error_category &hook_error_category()
@@ -21,17 +21,34 @@
 #include <libelf.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <exception>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include <spdlog/spdlog.h>
 #include <toml++/toml.h>
 
 #include "endstone/detail/os.h"
+#include "endstone/detail/symbol_cache.h"
 
 namespace {
-void read_elf(const std::string &module_pathname, uint32_t section_type,
-              const std::function<void(Elf *, GElf_Shdr &, GElf_Sym &)> &sym_handler)
+/**
+ * A symbol table section together with the string table holding its names.
+ */
+struct SymbolSection {
+    Elf_Data *data;
+    std::size_t count;
+    std::string_view strtab;
+};
+
+template <typename Handler>
+void read_elf(const std::string &module_pathname, uint32_t section_type, Handler &&section_handler)
 {
     if (elf_version(EV_CURRENT) == EV_NONE) {
         throw std::runtime_error("ELF library initialization failed");
@@ -44,88 +61,148 @@ void read_elf(const std::string &module_pathname, uint32_t section_type,
 
     Elf *elf = elf_begin(fd, ELF_C_READ, nullptr);
     if (!elf) {
+        close(fd);
         throw std::runtime_error("elf_begin() failed.");
     }
 
-    Elf_Scn *scn = nullptr;
-    while ((scn = elf_nextscn(elf, scn)) != nullptr) {
-        GElf_Shdr shdr;
-        if (gelf_getshdr(scn, &shdr) != &shdr) {
-            throw std::runtime_error("gelf_getshdr() failed.");
-        }
-
-        if (shdr.sh_type == section_type) {
-            // Found the dynamic symbol table. Read it.
-            Elf_Data *data = elf_getdata(scn, nullptr);
-            const auto symbol_count = shdr.sh_size / shdr.sh_entsize;
+    try {
+        Elf_Scn *scn = nullptr;
+        while ((scn = elf_nextscn(elf, scn)) != nullptr) {
+            GElf_Shdr shdr;
+            if (gelf_getshdr(scn, &shdr) != &shdr) {
+                throw std::runtime_error("gelf_getshdr() failed.");
+            }
 
-            for (auto i = 0; i < symbol_count; ++i) {
-                GElf_Sym sym;
-                if (gelf_getsym(data, i, &sym) != &sym) {
-                    throw std::runtime_error("gelf_getsym() failed.");
+            if (shdr.sh_type == section_type) {
+                // Found the symbol table. Load it and its string table once so it can be read from several threads.
+                Elf_Data *data = elf_getdata(scn, nullptr);
+                Elf_Data *strtab = elf_getdata(elf_getscn(elf, shdr.sh_link), nullptr);
+                if (data == nullptr || strtab == nullptr) {
+                    throw std::runtime_error("elf_getdata() failed.");
                 }
 
-                sym_handler(elf, shdr, sym);
+                section_handler(SymbolSection{data, shdr.sh_size / shdr.sh_entsize,
+                                              {static_cast<const char *>(strtab->d_buf), strtab->d_size}});
+                break;  // No need to check further sections
             }
-
-            break;  // No need to check further sections
         }
     }
+    catch (...) {
+        elf_end(elf);
+        close(fd);
+        throw;
+    }
 
     elf_end(elf);
     close(fd);
 }
+
+// Below this many symbols, starting threads costs more than scanning the table
+constexpr std::size_t ParallelSymbolThreshold = 16384;
+
+/**
+ * Find the defined global functions whose name is wanted in a range of a symbol table.
+ */
+void find_functions(const SymbolSection &section, std::size_t begin, std::size_t end,
+                    const std::unordered_set<std::string_view> &wanted,
+                    std::vector<std::pair<std::string_view, std::size_t>> &found,
+                    std::vector<std::string_view> &unwanted)
+{
+    for (auto i = begin; i < end; ++i) {
+        GElf_Sym sym;
+        if (gelf_getsym(section.data, static_cast<int>(i), &sym) != &sym) {
+            throw std::runtime_error("gelf_getsym() failed.");
+        }
+
+        if (sym.st_shndx == SHN_UNDEF || GELF_ST_TYPE(sym.st_info) != STT_FUNC ||
+            GELF_ST_BIND(sym.st_info) != STB_GLOBAL || sym.st_name >= section.strtab.size()) {
+            continue;
+        }
+
+        auto name = std::string_view(section.strtab.data() + sym.st_name);
+        if (wanted.find(name) != wanted.end()) {
+            found.emplace_back(name, sym.st_value);
+        }
+        else {
+            unwanted.push_back(name);
+        }
+    }
+}
 }  // namespace
 
 namespace endstone::detail::hook {
 
-const std::unordered_map<std::string, void *> &get_detours()
+std::unordered_map<std::string, std::size_t> read_detours(const std::unordered_map<std::string, std::size_t> &targets)
 {
-    static std::unordered_map<std::string, void *> detours;
-    if (!detours.empty()) {
-        return detours;
+    std::unordered_set<std::string_view> wanted;
+    wanted.reserve(targets.size());
+    for (const auto &[name, offset] : targets) {
+        wanted.emplace(name);
     }
 
-    auto *module_base = os::get_module_base();
-    auto module_pathname = os::get_module_pathname();
-    const auto &targets = get_targets();
-
-    read_elf(module_pathname, SHT_DYNSYM, [&](auto *elf, auto &shdr, auto &sym) {
-        if (sym.st_shndx == SHN_UNDEF || GELF_ST_TYPE(sym.st_info) != STT_FUNC ||
-            GELF_ST_BIND(sym.st_info) != STB_GLOBAL) {
-            return;
+    std::unordered_map<std::string, std::size_t> detours;
+    read_elf(os::get_module_pathname(), SHT_DYNSYM, [&](const SymbolSection &section) {
+        // Split large tables into one range per worker, each collecting its own results
+        std::size_t workers = 1;
+        if (section.count >= ParallelSymbolThreshold) {
+            workers = std::clamp<std::size_t>(std::thread::hardware_concurrency(), 1, 8);
         }
-
-        char *name = elf_strptr(elf, shdr.sh_link, sym.st_name);
-        if (name == nullptr) {
-            return;
+        std::vector<std::vector<std::pair<std::string_view, std::size_t>>> found(workers);
+        std::vector<std::vector<std::string_view>> unwanted(workers);
+        std::vector<std::exception_ptr> errors(workers);
+        std::vector<std::thread> threads;
+
+        const auto range = (section.count + workers - 1) / workers;
+        for (std::size_t w = 0; w < workers; ++w) {
+            auto scan = [&, w]() {
+                try {
+                    find_functions(section, w * range, std::min(section.count, (w + 1) * range), wanted, found[w],
+                                   unwanted[w]);
+                }
+                catch (...) {
+                    errors[w] = std::current_exception();
+                }
+            };
+            if (w + 1 == workers) {
+                scan();
+            }
+            else {
+                threads.emplace_back(scan);
+            }
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        for (const auto &error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
         }
 
-        auto offset = sym.st_value;
-        spdlog::debug("D: {} -> 0x{:x}", name, offset);
-        auto *detour = static_cast<char *>(module_base) + offset;
-        detours.emplace(name, detour);
+        for (std::size_t w = 0; w < workers; ++w) {
+            for (const auto &[name, offset] : found[w]) {
+                spdlog::debug("D: {} -> 0x{:x}", name, offset);
+                detours.emplace(name, offset);
+            }
+            for (const auto &name : unwanted[w]) {
+                spdlog::warn("Detour {} has no target in symbols.toml and will not be installed.", name);
+            }
+        }
     });
     return detours;
 }
 
-const std::unordered_map<std::string, void *> &get_targets()
+std::unordered_map<std::string, std::size_t> read_targets()
 {
-    static std::unordered_map<std::string, void *> targets;
-    if (!targets.empty()) {
-        return targets;
-    }
-
-    auto *executable_base = os::get_executable_base();
+    std::unordered_map<std::string, std::size_t> targets;
     const auto module_pathname = os::get_module_pathname();
     auto symbol_path = std::filesystem::path{module_pathname}.parent_path() / "symbols.toml";
     auto tbl = toml::parse_file(symbol_path.string());
-    tbl["linux"].as_table()->for_each([executable_base](const toml::key &key, auto &&val) {
+    tbl["linux"].as_table()->for_each([&targets](const toml::key &key, auto &&val) {
         if constexpr (toml::is_integer<decltype(val)>) {
             auto offset = val.get();
             spdlog::debug("T: {} -> 0x{:x}", key.data(), offset);
-            auto *target = static_cast<char *>(executable_base) + offset;
-            targets.emplace(key.data(), target);
+            targets.emplace(key.data(), offset);
         }
     });
 
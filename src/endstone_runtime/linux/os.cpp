@@ -16,7 +16,11 @@
 
 #include "endstone/detail/os.h"
 
+#include <dlfcn.h>
+#include <unistd.h>
+
 #include <climits>
+#include <cstdint>
 #include <fstream>
 
 #include <fmt/format.h>
@@ -98,6 +102,46 @@ std::string get_name()
     return "Linux";
 }
 
+std::size_t get_resident_memory()
+{
+    std::ifstream file("/proc/self/statm");
+    std::size_t size = 0;
+    std::size_t resident = 0;
+    if (!(file >> size >> resident)) {
+        return 0;
+    }
+    return resident * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+}
+
+std::optional<AllocatorStats> get_allocator_stats()
+{
+    // Either is only found when preloaded by the bootstrap, see ENDSTONE_ALLOCATOR
+    using Mallctl = int (*)(const char *, void *, std::size_t *, void *, std::size_t);
+    static auto *mallctl = reinterpret_cast<Mallctl>(dlsym(RTLD_DEFAULT, "mallctl"));
+    if (mallctl) {
+        // jemalloc caches its statistics until the epoch is advanced
+        std::uint64_t epoch = 1;
+        std::size_t size = sizeof(epoch);
+        mallctl("epoch", &epoch, &size, &epoch, size);
+        AllocatorStats stats{"jemalloc", 0, 0};
+        size = sizeof(std::size_t);
+        mallctl("stats.allocated", &stats.allocated, &size, nullptr, 0);
+        size = sizeof(std::size_t);
+        mallctl("stats.mapped", &stats.committed, &size, nullptr, 0);
+        return stats;
+    }
+
+    using ProcessInfo = void (*)(std::size_t *, std::size_t *, std::size_t *, std::size_t *, std::size_t *,
+                                 std::size_t *, std::size_t *, std::size_t *);
+    static auto *process_info = reinterpret_cast<ProcessInfo>(dlsym(RTLD_DEFAULT, "mi_process_info"));
+    if (process_info) {
+        std::size_t elapsed = 0, user = 0, system = 0, rss = 0, peak_rss = 0, commit = 0, peak_commit = 0, faults = 0;
+        process_info(&elapsed, &user, &system, &rss, &peak_rss, &commit, &peak_commit, &faults);
+        return AllocatorStats{"mimalloc", 0, commit};
+    }
+    return std::nullopt;
+}
+
 }  // namespace endstone::detail::os
 
 #endif
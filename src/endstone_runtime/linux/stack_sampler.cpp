@@ -0,0 +1,108 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifdef __linux__
+
+#include <pthread.h>
+#include <semaphore.h>
+
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <mutex>
+
+#include <cpptrace/cpptrace.hpp>
+
+#include "endstone/detail/stack_sampler.h"
+
+namespace endstone::detail {
+
+namespace {
+
+// Real-time signals are queued rather than merged, and the lower ones are often taken by the C library or debuggers
+const int SampleSignal = SIGRTMIN + 4;
+
+// Shared by all samplers, they take one sample at a time
+std::mutex g_mutex;
+cpptrace::frame_ptr g_frames[StackSampler::MaxFrames];
+volatile std::size_t g_depth = 0;
+sem_t g_sampled;
+
+void sample_handler(int signum, siginfo_t *info, void *ctx)
+{
+    const auto saved_errno = errno;
+    // Skips this handler, the signal trampoline is dropped later as it has no symbol of interest
+    g_depth = cpptrace::safe_generate_raw_trace(g_frames, StackSampler::MaxFrames, 1);
+    sem_post(&g_sampled);
+    errno = saved_errno;
+}
+
+void install_handler()
+{
+    static const bool installed = []() {
+        sem_init(&g_sampled, 0, 0);
+
+        struct sigaction action;
+        memset(&action, 0, sizeof action);
+        action.sa_flags = static_cast<int>(SA_SIGINFO | SA_RESTART);
+        sigemptyset(&action.sa_mask);
+        action.sa_sigaction = &sample_handler;
+        if (sigaction(SampleSignal, &action, nullptr) < 0) {
+            printf("WARN: sigaction failed: %d\n", SampleSignal);
+            return false;
+        }
+        return true;
+    }();
+    (void)installed;
+}
+
+}  // namespace
+
+StackSampler::StackSampler() : thread_(static_cast<std::uintptr_t>(pthread_self()))
+{
+    install_handler();
+}
+
+// The handler stays installed, other samplers may still be bound
+StackSampler::~StackSampler() = default;
+
+std::vector<cpptrace::frame_ptr> StackSampler::sample() const
+{
+    std::lock_guard lock{g_mutex};
+
+    // Drops the post of a sample that timed out earlier
+    while (sem_trywait(&g_sampled) == 0) {
+    }
+
+    if (pthread_kill(static_cast<pthread_t>(thread_), SampleSignal) != 0) {
+        return {};
+    }
+
+    timespec deadline{};
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += 1;
+    int r;
+    while ((r = sem_timedwait(&g_sampled, &deadline)) != 0 && errno == EINTR) {
+    }
+    if (r != 0) {
+        return {};
+    }
+    return {g_frames, g_frames + g_depth};
+}
+
+}  // namespace endstone::detail
+
+#endif
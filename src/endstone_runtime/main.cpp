@@ -13,15 +13,18 @@
 // limitations under the License.
 
 #include <chrono>
+#include <cstdlib>
 #include <exception>
+#include <string_view>
 #include <thread>
 
-#include <pybind11/embed.h>
 #include <spdlog/spdlog.h>
 
 #include "endstone/detail/devtools/devtools.h"
 #include "endstone/detail/hook.h"
 #include "endstone/detail/logger_factory.h"
+#include "endstone/detail/startup_timings.h"
+#include "endstone/detail/thread_options.h"
 
 #if __GNUC__
 #define ENDSTONE_RUNTIME_CTOR __attribute__((constructor))
@@ -29,34 +32,33 @@
 #define ENDSTONE_RUNTIME_CTOR
 #endif
 
-namespace py = pybind11;
-
 ENDSTONE_RUNTIME_CTOR int main()
 {
+    // Anchors the startup timings as early as we can
+    endstone::detail::StartupTimings::getInstance();
     spdlog::flush_every(std::chrono::seconds(5));
     auto &logger = endstone::detail::LoggerFactory::getLogger("EndstoneRuntime");
     try {
         logger.info("Initialising...");
 
-        // Initialise an isolated Python environment to avoid installing signal handlers
-        // https://docs.python.org/3/c-api/init_config.html#init-isolated-conf
-        PyConfig config;
-        PyConfig_InitIsolatedConfig(&config);
-        config.isolated = 0;
-        config.use_environment = 1;
-        config.install_signal_handlers = 0;
-        py::initialize_interpreter(&config);
-        py::module_::import("threading");  // https://github.com/pybind/pybind11/issues/2197
-        py::module_::import("numpy");      // https://github.com/numpy/numpy/issues/24833
-        py::gil_scoped_release release{};
-        release.disarm();
+        // The Python interpreter is started by the PythonPluginLoader, only on servers with Python plugins
 
         // Install hooks
         endstone::detail::hook::install();
 
+        // Set by `endstone --prepare`, which only needs the symbol cache written by the install above
+        if (const auto *prepare = std::getenv("ENDSTONE_PREPARE"); prepare && std::string_view(prepare) == "1") {
+            logger.info("Symbol cache is ready, exiting.");
+            spdlog::shutdown();
+            std::_Exit(0);
+        }
+
 #ifdef ENDSTONE_DEVTOOLS
         // Create devtools window
-        auto thread = std::thread(&endstone::detail::devtools::render);
+        auto thread = std::thread([]() {
+            endstone::detail::ThreadOptions::fromEnvironment("DEVTOOLS").apply();
+            endstone::detail::devtools::render();
+        });
         thread.detach();
 #endif
         return 0;
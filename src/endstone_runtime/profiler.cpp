@@ -0,0 +1,297 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/profiler.h"
+
+#include <algorithm>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include <cpptrace/cpptrace.hpp>
+#include <fmt/chrono.h>
+#include <fmt/format.h>
+
+#include "endstone/detail/hook.h"
+#include "endstone/detail/logger_factory.h"
+#include "endstone/detail/os.h"
+#include "endstone/detail/stack_sampler.h"
+
+namespace fs = std::filesystem;
+
+namespace endstone::detail {
+
+namespace {
+// The server is stripped, a frame further than this from the nearest symbol in symbols.toml is left unnamed
+constexpr std::uintptr_t MaxSymbolDistance = 0x10000;
+
+/**
+ * The names of the frames at an address, innermost first, as inlined calls are expanded, and who the address is
+ * attributed to, if anyone.
+ */
+struct ResolvedAddress {
+    std::vector<std::string> names;
+    std::string owner;
+    bool hook = false;
+};
+
+class AddressResolver {
+public:
+    AddressResolver()
+        : plugin_dir_((fs::current_path() / "plugins").string()), runtime_(os::get_module_pathname()),
+          executable_(os::get_executable_pathname())
+    {
+        for (const auto &[name, address] : hook::get_targets()) {
+            targets_.emplace_back(reinterpret_cast<std::uintptr_t>(address), cpptrace::demangle(name));
+        }
+        std::sort(targets_.begin(), targets_.end());
+        for (const auto &[name, address] : hook::get_detours()) {
+            detours_.insert(cpptrace::demangle(name));
+        }
+    }
+
+    std::unordered_map<std::uintptr_t, ResolvedAddress> resolve(const Profiler::Stacks &stacks) const
+    {
+        std::unordered_set<std::uintptr_t> unique;
+        for (const auto &[frames, count] : stacks) {
+            unique.insert(frames.begin(), frames.end());
+        }
+        cpptrace::raw_trace raw{std::vector<cpptrace::frame_ptr>(unique.begin(), unique.end())};
+
+        std::unordered_map<std::uintptr_t, cpptrace::object_frame> objects;
+        for (auto &frame : raw.resolve_object_trace().frames) {
+            objects.emplace(frame.raw_address, std::move(frame));
+        }
+
+        std::unordered_map<std::uintptr_t, ResolvedAddress> result;
+        for (const auto &frame : raw.resolve().frames) {
+            const auto &object = objects[frame.raw_address];
+            auto &resolved = result[frame.raw_address];
+            resolved.names.push_back(name(frame, object));
+            if (!resolved.owner.empty() && !resolved.hook) {
+                continue;
+            }
+            if (object.object_path.rfind(plugin_dir_, 0) == 0) {
+                resolved.owner = "plugin " + fs::path(object.object_path).filename().string();
+                resolved.hook = false;
+            }
+            else if (frame.symbol.find("_PyEval_EvalFrame") != std::string::npos) {
+                resolved.owner = "Python code";
+                resolved.hook = false;
+            }
+            else if (resolved.owner.empty() && object.object_path == runtime_ && detours_.count(frame.symbol) > 0) {
+                resolved.owner = "hook " + frame.symbol;
+                resolved.hook = true;
+            }
+        }
+        return result;
+    }
+
+private:
+    std::string name(const cpptrace::stacktrace_frame &frame, const cpptrace::object_frame &object) const
+    {
+        std::string result;
+        if (!frame.symbol.empty()) {
+            result = frame.symbol;
+        }
+        else if (auto target = findTarget(frame.raw_address); !target.empty() && object.object_path == executable_) {
+            result = target;
+        }
+        else if (!object.object_path.empty()) {
+            result = fmt::format("{}+0x{:x}", fs::path(object.object_path).filename().string(), object.object_address);
+        }
+        else {
+            result = fmt::format("0x{:x}", frame.raw_address);
+        }
+
+        if (object.object_path.rfind(plugin_dir_, 0) == 0) {
+            result += fmt::format(" [{}]", fs::path(object.object_path).filename().string());
+        }
+        std::replace(result.begin(), result.end(), ';', ',');  // ';' separates the frames of a folded stack
+        return result;
+    }
+
+    std::string findTarget(std::uintptr_t address) const
+    {
+        auto it = std::upper_bound(targets_.begin(), targets_.end(), address,
+                                   [](auto address, const auto &target) { return address < target.first; });
+        if (it == targets_.begin()) {
+            return {};
+        }
+        --it;
+        if (address - it->first > MaxSymbolDistance) {
+            return {};
+        }
+        return fmt::format("{}+0x{:x}", it->second, address - it->first);
+    }
+
+    std::string plugin_dir_;
+    std::string runtime_;
+    std::string executable_;
+    std::vector<std::pair<std::uintptr_t, std::string>> targets_;
+    std::unordered_set<std::string> detours_;
+};
+
+void writeProfile(const Profiler::Stacks &stacks, std::size_t total, Profiler::Clock::duration elapsed)
+{
+    auto &logger = LoggerFactory::getLogger("Profiler");
+    if (stacks.empty()) {
+        logger.warning("No samples were taken, the server thread could not be sampled.");
+        return;
+    }
+
+    const auto addresses = AddressResolver().resolve(stacks);
+    std::unordered_map<std::string, std::size_t> owners;
+    std::error_code ec;
+    fs::create_directories("profiles", ec);
+    const auto path =
+        fs::path("profiles") / fmt::format("profile-{:%Y%m%d-%H%M%S}.folded", fmt::localtime(std::time(nullptr)));
+    std::ofstream file{path};
+    if (!file) {
+        logger.error("Could not write the profile to {}.", path.string());
+        return;
+    }
+
+    for (const auto &[frames, count] : stacks) {
+        const ResolvedAddress *owner = nullptr;
+        std::vector<std::string> names;
+        for (const auto address : frames) {
+            auto it = addresses.find(address);
+            if (it == addresses.end()) {
+                names.push_back(fmt::format("0x{:x}", address));
+                continue;
+            }
+            const auto &resolved = it->second;
+            names.insert(names.end(), resolved.names.begin(), resolved.names.end());
+            if (!resolved.owner.empty() && (!owner || (owner->hook && !resolved.hook))) {
+                owner = &resolved;
+            }
+        }
+        owners[owner ? owner->owner : "the server"] += count;
+
+        // Folded stacks start from the root
+        std::reverse(names.begin(), names.end());
+        file << fmt::format("{} {}\n", fmt::join(names, ";"), count);
+    }
+
+    logger.info("Wrote {} samples taken over {:.1f}s to {}.", total,
+                std::chrono::duration<double>(elapsed).count(), path.string());
+    std::vector<std::pair<std::string, std::size_t>> sorted{owners.begin(), owners.end()};
+    std::sort(sorted.begin(), sorted.end(), [](const auto &a, const auto &b) { return a.second > b.second; });
+    for (std::size_t i = 0; i < std::min(sorted.size(), Profiler::MaxReportEntries); ++i) {
+        logger.info("{:5.1f}% {}", 100.0 * static_cast<double>(sorted[i].second) / static_cast<double>(total),
+                    sorted[i].first);
+    }
+}
+}  // namespace
+
+Profiler &Profiler::getInstance()
+{
+    static Profiler instance;
+    return instance;
+}
+
+Profiler::~Profiler()
+{
+    shutdown();
+}
+
+bool Profiler::start(std::chrono::milliseconds interval)
+{
+    std::lock_guard lock{mutex_};
+    if (running_ || writing_) {
+        return false;
+    }
+    if (thread_.joinable()) {
+        thread_.join();  // the previous profile has been written
+    }
+
+    sampler_ = std::make_unique<StackSampler>();
+    stopping_ = false;
+    running_ = true;
+    writing_ = true;
+    samples_ = 0;
+    started_ = Clock::now();
+    thread_ = std::thread(&Profiler::run, this, interval);
+    return true;
+}
+
+bool Profiler::stop()
+{
+    {
+        std::lock_guard lock{mutex_};
+        if (!running_) {
+            return false;
+        }
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    return true;
+}
+
+void Profiler::shutdown()
+{
+    stop();
+    std::thread thread;
+    {
+        std::lock_guard lock{mutex_};
+        thread = std::move(thread_);
+    }
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+bool Profiler::isRunning() const
+{
+    return running_;
+}
+
+std::size_t Profiler::getSampleCount() const
+{
+    return samples_;
+}
+
+Profiler::Clock::duration Profiler::getElapsed() const
+{
+    std::lock_guard lock{mutex_};
+    return running_ ? Clock::now() - started_ : Clock::duration::zero();
+}
+
+void Profiler::run(std::chrono::milliseconds interval)
+{
+    Stacks stacks;
+    std::unique_lock lock{mutex_};
+    while (!cv_.wait_for(lock, interval, [this] { return stopping_; })) {
+        lock.unlock();
+        auto frames = sampler_->sample();
+        if (!frames.empty()) {
+            ++stacks[{frames.begin(), frames.end()}];
+            ++samples_;
+        }
+        lock.lock();
+    }
+    const auto elapsed = Clock::now() - started_;
+    running_ = false;
+    lock.unlock();
+
+    writeProfile(stacks, samples_, elapsed);
+    writing_ = false;
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,263 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/symbol_cache.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#elif __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cstring>
+#include <fstream>
+#include <string_view>
+#include <system_error>
+
+#include <fmt/format.h>
+
+namespace endstone::detail::hook {
+
+namespace {
+constexpr char CacheMagic[8] = {'E', 'S', 'S', 'Y', 'M', 'C', 'H', 'E'};
+constexpr std::uint32_t CacheVersion = 1;
+
+/**
+ * Layout: Header, then detour_count + target_count entries of {uint64 offset, uint32 size, char name[size]}.
+ */
+struct CacheHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t detour_count;
+    std::uint64_t key;
+    std::uint32_t target_count;
+    std::uint32_t reserved;
+};
+
+/**
+ * Read-only view of a whole file mapped in memory.
+ */
+class MappedFile {
+public:
+    explicit MappedFile(const std::filesystem::path &path)
+    {
+#ifdef _WIN32
+        file_ = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                            nullptr);
+        if (file_ == INVALID_HANDLE_VALUE) {
+            return;
+        }
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file_, &size) || size.QuadPart == 0) {
+            return;
+        }
+        mapping_ = CreateFileMappingW(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping_ == nullptr) {
+            return;
+        }
+        data_ = static_cast<const char *>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+        if (data_ != nullptr) {
+            size_ = static_cast<std::size_t>(size.QuadPart);
+        }
+#elif __linux__
+        int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return;
+        }
+        struct stat st {};
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED) {
+                data_ = static_cast<const char *>(data);
+                size_ = st.st_size;
+            }
+        }
+        close(fd);
+#endif
+    }
+
+    ~MappedFile()
+    {
+#ifdef _WIN32
+        if (data_ != nullptr) {
+            UnmapViewOfFile(data_);
+        }
+        if (mapping_ != nullptr) {
+            CloseHandle(mapping_);
+        }
+        if (file_ != INVALID_HANDLE_VALUE) {
+            CloseHandle(file_);
+        }
+#elif __linux__
+        if (data_ != nullptr) {
+            munmap(const_cast<char *>(data_), size_);
+        }
+#endif
+    }
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    [[nodiscard]] const char *data() const
+    {
+        return data_;
+    }
+
+    [[nodiscard]] std::size_t size() const
+    {
+        return size_;
+    }
+
+private:
+#ifdef _WIN32
+    HANDLE file_{INVALID_HANDLE_VALUE};
+    HANDLE mapping_{nullptr};
+#endif
+    const char *data_{nullptr};
+    std::size_t size_{0};
+};
+
+/**
+ * Bounds-checked reader over the mapped cache.
+ */
+class CacheReader {
+public:
+    CacheReader(const char *data, std::size_t size) : data_(data), size_(size) {}
+
+    template <typename T>
+    bool read(T &value)
+    {
+        if (size_ - pos_ < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, data_ + pos_, sizeof(T));
+        pos_ += sizeof(T);
+        return true;
+    }
+
+    bool readEntries(std::uint32_t count, std::unordered_map<std::string, std::size_t> &entries)
+    {
+        entries.reserve(count);
+        for (std::uint32_t i = 0; i < count; ++i) {
+            std::uint64_t offset;
+            std::uint32_t name_size;
+            if (!read(offset) || !read(name_size) || size_ - pos_ < name_size) {
+                return false;
+            }
+            entries.emplace(std::string_view(data_ + pos_, name_size), static_cast<std::size_t>(offset));
+            pos_ += name_size;
+        }
+        return true;
+    }
+
+    [[nodiscard]] bool atEnd() const
+    {
+        return pos_ == size_;
+    }
+
+private:
+    const char *data_;
+    std::size_t size_;
+    std::size_t pos_{0};
+};
+
+void write_entries(std::ofstream &out, const std::unordered_map<std::string, std::size_t> &entries)
+{
+    for (const auto &[name, offset] : entries) {
+        auto value = static_cast<std::uint64_t>(offset);
+        auto name_size = static_cast<std::uint32_t>(name.size());
+        out.write(reinterpret_cast<const char *>(&value), sizeof(value));
+        out.write(reinterpret_cast<const char *>(&name_size), sizeof(name_size));
+        out.write(name.data(), static_cast<std::streamsize>(name.size()));
+    }
+}
+
+void hash(std::uint64_t &h, const void *data, std::size_t size)
+{
+    // FNV-1a
+    const auto *bytes = static_cast<const unsigned char *>(data);
+    for (std::size_t i = 0; i < size; ++i) {
+        h ^= bytes[i];
+        h *= 0x100000001b3ULL;
+    }
+}
+}  // namespace
+
+std::uint64_t get_symbol_cache_key(const std::vector<std::filesystem::path> &files)
+{
+    std::uint64_t h = 0xcbf29ce484222325ULL;
+    hash(h, &CacheVersion, sizeof(CacheVersion));
+    for (const auto &file : files) {
+        auto path = file.u8string();
+        std::uint64_t size = std::filesystem::file_size(file);
+        std::int64_t mtime = std::filesystem::last_write_time(file).time_since_epoch().count();
+        hash(h, path.data(), path.size());
+        hash(h, &size, sizeof(size));
+        hash(h, &mtime, sizeof(mtime));
+    }
+    return h;
+}
+
+std::optional<SymbolTable> load_symbol_cache(const std::filesystem::path &path, std::uint64_t key)
+{
+    MappedFile file(path);
+    if (file.data() == nullptr) {
+        return std::nullopt;
+    }
+
+    CacheReader reader(file.data(), file.size());
+    CacheHeader header{};
+    if (!reader.read(header) || std::memcmp(header.magic, CacheMagic, sizeof(CacheMagic)) != 0 ||
+        header.version != CacheVersion || header.key != key) {
+        return std::nullopt;
+    }
+
+    SymbolTable table;
+    if (!reader.readEntries(header.detour_count, table.detours) ||
+        !reader.readEntries(header.target_count, table.targets) || !reader.atEnd()) {
+        return std::nullopt;
+    }
+    return table;
+}
+
+void save_symbol_cache(const std::filesystem::path &path, std::uint64_t key, const SymbolTable &table)
+{
+    auto temp_path = path;
+    temp_path += ".tmp";
+    {
+        std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            throw std::runtime_error(fmt::format("Failed to open file: {}", temp_path.string()));
+        }
+
+        CacheHeader header{};
+        std::memcpy(header.magic, CacheMagic, sizeof(CacheMagic));
+        header.version = CacheVersion;
+        header.detour_count = static_cast<std::uint32_t>(table.detours.size());
+        header.key = key;
+        header.target_count = static_cast<std::uint32_t>(table.targets.size());
+        out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        write_entries(out, table.detours);
+        write_entries(out, table.targets);
+        if (!out) {
+            throw std::runtime_error(fmt::format("Failed to write file: {}", temp_path.string()));
+        }
+    }
+    std::filesystem::rename(temp_path, path);
+}
+
+}  // namespace endstone::detail::hook
@@ -0,0 +1,235 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/watchdog.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
+
+#include <fmt/chrono.h>
+#include <fmt/format.h>
+
+#include "endstone/detail/logger_factory.h"
+#include "endstone/detail/os.h"
+#include "endstone/detail/signal_handler.h"
+
+namespace fs = std::filesystem;
+
+namespace endstone::detail {
+
+namespace {
+std::string describe(const cpptrace::stacktrace_frame &frame)
+{
+    if (!frame.symbol.empty()) {
+        return frame.symbol;
+    }
+    return fmt::format("0x{:x}", frame.raw_address);
+}
+
+/**
+ * Tells what a sampled stack is stuck in: the innermost frame in a plugin library, in Python code or in Endstone,
+ * which includes the hooks. Frames of the server and the system libraries are skipped, as they are always there.
+ */
+std::string locate(const cpptrace::stacktrace &trace,
+                   const std::unordered_map<cpptrace::frame_ptr, std::string> &objects)
+{
+    static const auto plugin_dir = (fs::current_path() / "plugins").string();
+    static const auto runtime = os::get_module_pathname();
+    for (const auto &frame : trace.frames) {
+        auto it = objects.find(frame.raw_address);
+        const auto object = it != objects.end() ? it->second : std::string{};
+        if (!object.empty() && object.rfind(plugin_dir, 0) == 0) {
+            return fmt::format("plugin {} in {}", fs::path(object).filename().string(), describe(frame));
+        }
+        if (frame.symbol.find("_PyEval_EvalFrame") != std::string::npos) {
+            return "Python code";
+        }
+        if (!object.empty() && object == runtime) {
+            return fmt::format("Endstone in {}", describe(frame));
+        }
+    }
+    return trace.frames.empty() ? "an unknown location" : describe(trace.frames.front());
+}
+}  // namespace
+
+Watchdog &Watchdog::getInstance()
+{
+    static Watchdog instance;
+    return instance;
+}
+
+void Watchdog::start()
+{
+    if (thread_.joinable()) {
+        return;
+    }
+    if (const auto *value = std::getenv("ENDSTONE_WATCHDOG_THRESHOLD_MS")) {
+        threshold_ = std::chrono::milliseconds(std::strtoll(value, nullptr, 10));
+    }
+    if (threshold_.count() <= 0) {
+        return;
+    }
+    if (const auto *value = std::getenv("ENDSTONE_WATCHDOG_REPORT_DIR")) {
+        report_dir_ = value;
+    }
+
+    sampler_ = std::make_unique<StackSampler>();
+    stopping_ = false;
+    thread_ = std::thread(&Watchdog::run, this);
+}
+
+void Watchdog::stop()
+{
+    {
+        std::lock_guard lock{mutex_};
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    sampler_.reset();
+    last_heartbeat_.store(0, std::memory_order_relaxed);
+}
+
+void Watchdog::run()
+{
+    using std::chrono::duration_cast;
+    using std::chrono::milliseconds;
+
+    auto &logger = LoggerFactory::getLogger("Watchdog");
+    std::optional<Stall> stall;
+    std::unique_lock lock{mutex_};
+    while (!cv_.wait_for(lock, SampleInterval, [this] { return stopping_; })) {
+        const auto heartbeat = last_heartbeat_.load(std::memory_order_acquire);
+        if (heartbeat == 0) {
+            continue;  // No tick has started yet
+        }
+
+        if (stall && stall->since != heartbeat) {
+            finish(*stall, duration_cast<milliseconds>(Clock::duration(heartbeat - stall->since)));
+            stall.reset();
+        }
+
+        const auto elapsed =
+            duration_cast<milliseconds>(Clock::duration(Clock::now().time_since_epoch().count() - heartbeat));
+        if (elapsed < threshold_) {
+            continue;
+        }
+        if (!stall) {
+            stall = Stall{last_tick_.load(std::memory_order_relaxed), heartbeat, {}, false};
+        }
+        if (stall->samples.size() >= MaxSamples) {
+            continue;
+        }
+
+        const auto &sample = stall->samples.emplace_back(this->sample(elapsed));
+        if (stall->samples.size() == 1) {
+            logger.warning("Tick {} started {}ms ago and the next one has not started yet. The server thread is in {}:",
+                           stall->tick, elapsed.count(), sample.location);
+            for (std::size_t i = 0; i < std::min(sample.frames.size(), MaxLoggedFrames); ++i) {
+                logger.warning("{}", sample.frames[i]);
+            }
+        }
+        else {
+            logger.warning("The server thread is still in {} after {}ms.", sample.location, elapsed.count());
+        }
+
+        // A deadlocked server never finishes the tick, so the report is written once enough samples are taken
+        if (stall->samples.size() == MaxSamples && !report_dir_.empty()) {
+            writeReport(*stall);
+            stall->reported = true;
+        }
+    }
+}
+
+Watchdog::Sample Watchdog::sample(std::chrono::milliseconds elapsed) const
+{
+    Sample result{elapsed, "an unknown location, the stack could not be sampled", {}};
+    cpptrace::raw_trace raw{sampler_->sample()};
+    if (raw.frames.empty()) {
+        return result;
+    }
+
+    std::unordered_map<cpptrace::frame_ptr, std::string> objects;
+    for (auto &frame : raw.resolve_object_trace().frames) {
+        objects.emplace(frame.raw_address, std::move(frame.object_path));
+    }
+    auto trace = raw.resolve();
+    result.location = locate(trace, objects);
+
+    const auto frame_number_width = std::to_string(trace.frames.size()).length();
+    for (std::size_t i = 0; i < trace.frames.size(); ++i) {
+        std::ostringstream line;
+        print_frame(line, false, frame_number_width, i, trace.frames[i]);
+        result.frames.push_back(line.str());
+    }
+    return result;
+}
+
+void Watchdog::finish(Stall &stall, std::chrono::milliseconds duration) const
+{
+    std::map<std::string, std::size_t> locations;
+    for (const auto &sample : stall.samples) {
+        ++locations[sample.location];
+    }
+    const auto top = std::max_element(locations.begin(), locations.end(),
+                                      [](const auto &a, const auto &b) { return a.second < b.second; });
+
+    auto &logger = LoggerFactory::getLogger("Watchdog");
+    logger.warning("The server thread resumed after {}ms. It was mostly in {} ({} of {} samples).", duration.count(),
+                   top->first, top->second, stall.samples.size());
+    if (!stall.reported && !report_dir_.empty()) {
+        writeReport(stall);
+        stall.reported = true;
+    }
+}
+
+void Watchdog::writeReport(const Stall &stall) const
+{
+    auto &logger = LoggerFactory::getLogger("Watchdog");
+    std::error_code ec;
+    fs::create_directories(report_dir_, ec);
+    const auto path = fs::path(report_dir_) /
+                      fmt::format("watchdog-{:%Y%m%d-%H%M%S}-{}.txt", fmt::localtime(std::time(nullptr)), stall.tick);
+    std::ofstream file{path};
+    if (!file) {
+        logger.error("Could not write the watchdog report to {}.", path.string());
+        return;
+    }
+
+    file << "Operation system: " << os::get_name() << '\n';
+    file << "Endstone version: " << ENDSTONE_VERSION << '\n';
+    file << "Api version     : " << ENDSTONE_API_VERSION << '\n';
+    file << "Overdue tick    : " << stall.tick << '\n';
+    for (std::size_t i = 0; i < stall.samples.size(); ++i) {
+        const auto &sample = stall.samples[i];
+        file << '\n' << fmt::format("Sample {} after {}ms, in {}:", i + 1, sample.elapsed.count(), sample.location);
+        for (const auto &frame : sample.frames) {
+            file << '\n' << frame;
+        }
+        file << '\n';
+    }
+    logger.warning("Watchdog report written to {}.", path.string());
+}
+
+}  // namespace endstone::detail
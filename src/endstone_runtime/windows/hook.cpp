@@ -17,118 +17,72 @@
 #include "endstone/detail/hook.h"
 
 #include <Windows.h>
-// DbgHelp.h must be included after Windows.h
-#include <DbgHelp.h>
 
-#include <chrono>
 #include <filesystem>
-#include <iostream>
 #include <string>
-#include <system_error>
+#include <string_view>
 #include <unordered_map>
+#include <unordered_set>
 
 #include <spdlog/spdlog.h>
 #include <toml++/toml.h>
 
 #include "endstone/detail/os.h"
+#include "endstone/detail/symbol_cache.h"
 
 namespace endstone::detail::hook {
 
-enum SymTagEnum {
-    SymTagPublicSymbol = 10,
-};
-
-namespace {
-void enumerate_symbols(const char *path, std::function<bool(const std::string &, std::size_t, std::uint32_t)> callback,
-                       bool load_symbol)
+std::unordered_map<std::string, std::size_t> read_detours(const std::unordered_map<std::string, std::size_t> &targets)
 {
-    auto start = std::chrono::high_resolution_clock::now();
-
-    HANDLE current_process = GetCurrentProcess();
-    HANDLE handle;
-    if (!DuplicateHandle(current_process, current_process, current_process, &handle, 0, FALSE, DUPLICATE_SAME_ACCESS)) {
-        throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), "DuplicateHandle failed");
+    std::unordered_set<std::string_view> wanted;
+    wanted.reserve(targets.size());
+    for (const auto &[name, offset] : targets) {
+        wanted.emplace(name);
     }
 
-    if (!SymInitialize(handle, nullptr, FALSE)) {
-        throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), "SymInitialize failed");
+    // Walk the export directory of the loaded module instead of loading its symbols through DbgHelp
+    std::unordered_map<std::string, std::size_t> detours;
+    const auto *base = static_cast<const char *>(os::get_module_base());
+    const auto *dos_header = reinterpret_cast<const IMAGE_DOS_HEADER *>(base);
+    const auto *nt_headers = reinterpret_cast<const IMAGE_NT_HEADERS *>(base + dos_header->e_lfanew);
+    const auto &directory = nt_headers->OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXPORT];
+    if (directory.Size == 0) {
+        return detours;
     }
 
-    SymSetOptions(NULL);  // do not undecorate symbols by default
-
-    auto module_base =
-        SymLoadModuleEx(handle, nullptr, path, nullptr, 0, 0, nullptr, load_symbol ? 0 : SLMFLAG_NO_SYMBOLS);
-    if (!module_base) {
-        throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), "SymLoadModuleEx failed");
-    }
+    const auto *exports = reinterpret_cast<const IMAGE_EXPORT_DIRECTORY *>(base + directory.VirtualAddress);
+    const auto *names = reinterpret_cast<const DWORD *>(base + exports->AddressOfNames);
+    const auto *ordinals = reinterpret_cast<const WORD *>(base + exports->AddressOfNameOrdinals);
+    const auto *functions = reinterpret_cast<const DWORD *>(base + exports->AddressOfFunctions);
+    for (DWORD i = 0; i < exports->NumberOfNames; ++i) {
+        const auto offset = functions[ordinals[i]];
+        if (offset >= directory.VirtualAddress && offset < directory.VirtualAddress + directory.Size) {
+            continue;  // forwarded to another module
+        }
 
-    struct UserContext {
-        std::size_t module_base;
-        std::function<bool(const std::string &, std::size_t, std::uint32_t)> callback;
-    };
-    auto user_context = UserContext{module_base, std::move(callback)};
-
-    SymSearch(
-        handle, module_base, 0, SymTagPublicSymbol, "*", 0,
-        [](PSYMBOL_INFO info /*pSymInfo*/, ULONG /*SymbolSize*/, PVOID user_context /*UserContext*/) -> BOOL {
-            auto *ctx = static_cast<UserContext *>(user_context);
-            if (!(ctx->callback)(info->Name, info->Address - ctx->module_base, info->Flags)) {
-                return FALSE;
-            }
-            return TRUE;
-        },
-        &user_context, SYMSEARCH_GLOBALSONLY);
-
-    SymCleanup(handle);
-
-    auto end = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
-    spdlog::debug("enumerate_symbols(): time elapsed: {}ms", duration.count());
-}
-}  // namespace
+        const auto name = std::string_view(base + names[i]);
+        if (wanted.find(name) == wanted.end()) {
+            spdlog::warn("Detour {} has no target in symbols.toml and will not be installed.", name);
+            continue;
+        }
 
-const std::unordered_map<std::string, void *> &get_detours()
-{
-    static std::unordered_map<std::string, void *> detours;
-    if (!detours.empty()) {
-        return detours;
+        spdlog::debug("D: {} -> 0x{:x}", name, offset);
+        detours.emplace(name, offset);
     }
-
-    auto *module_base = os::get_module_base();
-    const auto module_pathname = os::get_module_pathname();
-    const auto &targets = get_targets();
-
-    enumerate_symbols(  //
-        module_pathname.c_str(),
-        [&](const std::string &name, std::size_t offset, std::uint32_t flags) -> bool {
-            if (flags & SYMFLAG_EXPORT) {
-                spdlog::debug("D: {} -> 0x{:x}", name, offset);
-                auto *detour = static_cast<char *>(module_base) + offset;
-                detours.emplace(name, detour);
-            }
-            return true;
-        },
-        false);  // set load_symbol to false so symbols are limited to the export table
     return detours;
 }
 
-const std::unordered_map<std::string, void *> &get_targets()
+std::unordered_map<std::string, std::size_t> read_targets()
 {
-    static std::unordered_map<std::string, void *> targets;
-    if (!targets.empty()) {
-        return targets;
-    }
-
-    auto *executable_base = os::get_executable_base();
+    std::unordered_map<std::string, std::size_t> targets;
     const auto module_pathname = os::get_module_pathname();
     auto symbol_path = std::filesystem::path{module_pathname}.parent_path() / "symbols.toml";
     auto tbl = toml::parse_file(symbol_path.string());
-    tbl["windows"].as_table()->for_each([executable_base](const toml::key &key, auto &&val) {
+    tbl["windows"].as_table()->for_each([&targets](const toml::key &key, auto &&val) {
         if constexpr (toml::is_integer<decltype(val)>) {
             auto offset = val.get();
             spdlog::debug("T: {} -> 0x{:x}", key.data(), offset);
-            auto *target = static_cast<char *>(executable_base) + offset;
-            targets.emplace(key.data(), target);
+            targets.emplace(key.data(), offset);
         }
     });
 
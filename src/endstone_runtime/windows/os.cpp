@@ -83,6 +83,33 @@ std::string get_name()
 {
     return "Windows";
 }
+
+std::size_t get_resident_memory()
+{
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return 0;
+    }
+    return counters.WorkingSetSize;
+}
+
+std::optional<AllocatorStats> get_allocator_stats()
+{
+    // Only found when the server was started with mimalloc redirecting the heap of the CRT
+    auto *module = GetModuleHandleA("mimalloc-override.dll");
+    if (!module) {
+        return std::nullopt;
+    }
+    using ProcessInfo = void (*)(std::size_t *, std::size_t *, std::size_t *, std::size_t *, std::size_t *,
+                                 std::size_t *, std::size_t *, std::size_t *);
+    auto *process_info = reinterpret_cast<ProcessInfo>(GetProcAddress(module, "mi_process_info"));
+    if (!process_info) {
+        return std::nullopt;
+    }
+    std::size_t elapsed = 0, user = 0, system = 0, rss = 0, peak_rss = 0, commit = 0, peak_commit = 0, faults = 0;
+    process_info(&elapsed, &user, &system, &rss, &peak_rss, &commit, &peak_commit, &faults);
+    return AllocatorStats{"mimalloc", 0, commit};
+}
 }  // namespace endstone::detail::os
 
 #endif
@@ -0,0 +1,83 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifdef _WIN32
+
+#include <Windows.h>
+
+#include <cpptrace/cpptrace.hpp>
+
+#include "endstone/detail/stack_sampler.h"
+
+namespace endstone::detail {
+
+StackSampler::StackSampler() : thread_(0)
+{
+    HANDLE thread = nullptr;
+    DuplicateHandle(GetCurrentProcess(), GetCurrentThread(), GetCurrentProcess(), &thread,
+                    THREAD_SUSPEND_RESUME | THREAD_GET_CONTEXT | THREAD_QUERY_INFORMATION, FALSE, 0);
+    thread_ = reinterpret_cast<std::uintptr_t>(thread);
+}
+
+StackSampler::~StackSampler()
+{
+    if (thread_) {
+        CloseHandle(reinterpret_cast<HANDLE>(thread_));
+    }
+}
+
+std::vector<cpptrace::frame_ptr> StackSampler::sample() const
+{
+    auto *thread = reinterpret_cast<HANDLE>(thread_);
+    if (!thread) {
+        return {};
+    }
+
+    // Nothing may be allocated while the thread is suspended, it could be holding the heap lock
+    std::vector<cpptrace::frame_ptr> frames;
+    frames.reserve(MaxFrames);
+
+    if (SuspendThread(thread) == static_cast<DWORD>(-1)) {
+        return {};
+    }
+
+    CONTEXT context{};
+    context.ContextFlags = CONTEXT_FULL;
+    if (GetThreadContext(thread, &context)) {
+        while (context.Rip != 0 && frames.size() < MaxFrames) {
+            frames.push_back(static_cast<cpptrace::frame_ptr>(context.Rip));
+
+            DWORD64 image_base = 0;
+            auto *function = RtlLookupFunctionEntry(context.Rip, &image_base, nullptr);
+            if (function) {
+                PVOID handler_data = nullptr;
+                DWORD64 establisher_frame = 0;
+                RtlVirtualUnwind(UNW_FLAG_NHANDLER, image_base, context.Rip, function, &context, &handler_data,
+                                 &establisher_frame, nullptr);
+            }
+            else {
+                // A leaf function, the return address is on top of the stack
+                context.Rip = *reinterpret_cast<DWORD64 *>(context.Rsp);
+                context.Rsp += sizeof(DWORD64);
+            }
+        }
+    }
+
+    ResumeThread(thread);
+    return frames;
+}
+
+}  // namespace endstone::detail
+
+#endif
@@ -0,0 +1,135 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/actor/actor_visibility.h"
+
+using endstone::Vector;
+using endstone::VectorArray;
+using endstone::detail::ActorVisibility;
+using endstone::detail::ArenaVector;
+using endstone::detail::RuntimeIdSet;
+
+TEST(RuntimeIdSetTest, InsertsAndErasesAcrossPages)
+{
+    RuntimeIdSet set;
+    EXPECT_TRUE(set.insert(1));
+    EXPECT_FALSE(set.insert(1));
+    EXPECT_TRUE(set.insert(1000000));
+    EXPECT_TRUE(set.contains(1));
+    EXPECT_TRUE(set.contains(1000000));
+    EXPECT_FALSE(set.contains(2));
+    EXPECT_EQ(set.size(), 2);
+
+    EXPECT_TRUE(set.erase(1));
+    EXPECT_FALSE(set.erase(1));
+    EXPECT_FALSE(set.contains(1));
+    EXPECT_FALSE(set.erase(5000000));
+    set.clear();
+    EXPECT_TRUE(set.empty());
+}
+
+class ActorVisibilityTest : public ::testing::Test {
+protected:
+    void update(ActorVisibility &visibility)
+    {
+        remove_.clear();
+        add_.clear();
+        visibility.update({0, 0, 0}, ids_, positions_, remove_, add_);
+    }
+
+    // Actors 10, 11 and 12, at 5, 50 and 500 blocks from the player
+    ArenaVector<std::uint64_t> ids_{10, 11, 12};
+    VectorArray<float> positions_{};
+    ArenaVector<std::size_t> remove_;
+    ArenaVector<std::size_t> add_;
+
+    void SetUp() override
+    {
+        positions_.push_back({5, 0, 0});
+        positions_.push_back({0, 50, 0});
+        positions_.push_back({0, 0, 500});
+    }
+};
+
+TEST_F(ActorVisibilityTest, InactiveByDefault)
+{
+    ActorVisibility visibility;
+    EXPECT_FALSE(visibility.isActive());
+    update(visibility);
+    EXPECT_TRUE(remove_.empty());
+    EXPECT_TRUE(add_.empty());
+}
+
+TEST_F(ActorVisibilityTest, HiddenActorsStayRemoved)
+{
+    ActorVisibility visibility;
+    EXPECT_TRUE(visibility.hide(11));
+    EXPECT_FALSE(visibility.hide(11));
+    EXPECT_TRUE(visibility.isHidden(11));
+    EXPECT_TRUE(visibility.isActive());
+
+    update(visibility);
+    EXPECT_EQ(remove_, ArenaVector<std::size_t>{1});
+    EXPECT_TRUE(add_.empty());
+
+    EXPECT_TRUE(visibility.show(11));
+    EXPECT_FALSE(visibility.isHidden(11));
+    update(visibility);
+    EXPECT_TRUE(remove_.empty());
+    EXPECT_TRUE(add_.empty());
+    EXPECT_FALSE(visibility.isActive());
+}
+
+TEST_F(ActorVisibilityTest, CullsBeyondDistance)
+{
+    ActorVisibility visibility;
+    visibility.setCullDistance(64.0F);
+    update(visibility);
+    EXPECT_EQ(remove_, ArenaVector<std::size_t>{2});
+
+    // A culled actor is not added back when a plugin stops hiding it
+    visibility.hide(12);
+    EXPECT_FALSE(visibility.show(12));
+
+    // Added back once it is in range
+    positions_.set(2, {0, 0, 10});
+    update(visibility);
+    EXPECT_TRUE(remove_.empty());
+    EXPECT_EQ(add_, ArenaVector<std::size_t>{2});
+}
+
+TEST_F(ActorVisibilityTest, ActorsOutOfRangeAreForgotten)
+{
+    ActorVisibility visibility;
+    visibility.hide(11);
+    update(visibility);
+
+    // Actor 11 left the range, vanilla removes it and adds it again when it is back
+    ids_.pop_back();
+    ids_.pop_back();
+    positions_.clear();
+    positions_.push_back({5, 0, 0});
+    update(visibility);
+    EXPECT_TRUE(remove_.empty());
+    // Not on the client any more, there is nothing to add back
+    EXPECT_FALSE(visibility.show(11));
+
+    visibility.hide(10);
+    visibility.forget(10);
+    EXPECT_FALSE(visibility.isHidden(10));
+}
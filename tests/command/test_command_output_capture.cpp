@@ -0,0 +1,37 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/command/command_output_capture.h"
+
+namespace endstone::detail {
+
+TEST(CommandOutputCaptureTest, InnermostCaptureReceivesTheOutput)
+{
+    ASSERT_EQ(CommandOutputCapture::current(), nullptr);
+    CommandOutputCapture outer;
+    outer.append("first");
+    {
+        CommandOutputCapture inner;
+        ASSERT_EQ(CommandOutputCapture::current(), &inner);
+        CommandOutputCapture::current()->append("nested");
+        ASSERT_EQ(inner.getOutput(), "nested");
+    }
+    ASSERT_EQ(CommandOutputCapture::current(), &outer);
+    CommandOutputCapture::current()->append("second");
+    ASSERT_EQ(outer.getOutput(), "first\nsecond");
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,87 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/command/command_rate_limiter.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+using endstone::detail::CommandRateLimiter;
+
+namespace {
+CommandRateLimiter::Origin makeOrigin(int x)
+{
+    return {1, 0, x, 64, 0};
+}
+
+std::string describe()
+{
+    return "CommandBlock";
+}
+}  // namespace
+
+TEST(CommandRateLimiterTest, PerOriginBudget)
+{
+    CommandRateLimiter limiter;
+    limiter.setBudget({2, 100, 10, CommandRateLimiter::Overflow::Drop});
+
+    EXPECT_TRUE(limiter.tryAcquire(makeOrigin(0)));
+    EXPECT_TRUE(limiter.tryAcquire(makeOrigin(0)));
+    EXPECT_FALSE(limiter.tryAcquire(makeOrigin(0)));
+    EXPECT_TRUE(limiter.tryAcquire(makeOrigin(1)));
+
+    limiter.startTick();
+    EXPECT_TRUE(limiter.tryAcquire(makeOrigin(0)));
+}
+
+TEST(CommandRateLimiterTest, PerTickBudget)
+{
+    CommandRateLimiter limiter;
+    limiter.setBudget({10, 3, 10, CommandRateLimiter::Overflow::Drop});
+
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_TRUE(limiter.tryAcquire(makeOrigin(i)));
+    }
+    EXPECT_FALSE(limiter.tryAcquire(makeOrigin(3)));
+}
+
+TEST(CommandRateLimiterTest, DeferToNextTick)
+{
+    CommandRateLimiter limiter;
+    limiter.setBudget({1, 100, 1, CommandRateLimiter::Overflow::Defer});
+
+    int runs = 0;
+    ASSERT_TRUE(limiter.tryAcquire(makeOrigin(0)));
+    ASSERT_FALSE(limiter.tryAcquire(makeOrigin(0)));
+    EXPECT_TRUE(limiter.reject(makeOrigin(0), describe, [&]() {
+        if (limiter.tryAcquire(makeOrigin(0))) {
+            ++runs;
+        }
+    }));
+    EXPECT_FALSE(limiter.reject(makeOrigin(0), describe, [&]() { ++runs; }));
+    EXPECT_EQ(runs, 0);
+
+    limiter.startTick();
+    EXPECT_EQ(runs, 1);
+    EXPECT_EQ(limiter.getDeferredCount(), 1);
+    EXPECT_EQ(limiter.getDroppedCount(), 1);
+
+    auto violations = limiter.takeViolations();
+    ASSERT_EQ(violations.size(), 1);
+    EXPECT_EQ(violations[0].origin, "CommandBlock");
+    EXPECT_EQ(violations[0].deferred, 1);
+    EXPECT_EQ(violations[0].dropped, 1);
+    EXPECT_TRUE(limiter.takeViolations().empty());
+}
@@ -0,0 +1,67 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/command/command_timings.h"
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/command/endstone_command.h"
+
+using endstone::Command;
+using endstone::detail::CommandTimings;
+using endstone::detail::EndstoneCommand;
+using namespace std::chrono_literals;
+
+TEST(CommandTimingsTest, GroupsByCommandName)
+{
+    CommandTimings timings;
+    Command teleport("tp");
+    EndstoneCommand status("status");
+
+    timings.record(teleport, 2ms);
+    timings.record(teleport, 4ms);
+    timings.record(status, 1ms);
+
+    auto result = timings.getTimings();
+    ASSERT_EQ(result.size(), 2);
+    EXPECT_EQ(result[0].name, "status");
+    EXPECT_EQ(result[0].owner, "endstone");
+    EXPECT_FALSE(result[0].vanilla);
+    EXPECT_EQ(result[0].count, 1);
+    EXPECT_EQ(result[1].name, "tp");
+    EXPECT_EQ(result[1].owner, "minecraft");
+    EXPECT_TRUE(result[1].vanilla);
+    EXPECT_EQ(result[1].count, 2);
+    EXPECT_EQ(result[1].total, 6ms);
+    EXPECT_EQ(result[1].max, 4ms);
+    EXPECT_LE(result[1].p99, 4ms);
+    EXPECT_GT(result[1].p99, 2ms);
+}
+
+TEST(CommandTimingsTest, Reset)
+{
+    CommandTimings timings;
+    EXPECT_FALSE(timings.isEnabled());
+    timings.setEnabled(true);
+    EXPECT_TRUE(timings.isEnabled());
+
+    Command say("say");
+    timings.record(say, 1ms);
+    ASSERT_EQ(timings.getTimings().size(), 1);
+
+    timings.reset();
+    EXPECT_TRUE(timings.getTimings().empty());
+}
@@ -255,3 +255,25 @@ TEST_F(ParserTest, ParseCommandWithUnexpectedToken)
     ASSERT_EQ(result, false);
     ASSERT_EQ(error_message, "Syntax Error: expect 'parameter name', got '<' at position 11.");
 }
+
+TEST_F(ParserTest, ParseCachedReturnsSameResult)
+{
+    const auto &first = CommandUsageParser::parseCached("/command <text: string> [count: int]");
+    const auto &second = CommandUsageParser::parseCached(std::string("/command <text: string> [count: int]"));
+
+    ASSERT_EQ(&first, &second);
+    ASSERT_EQ(first.success, true);
+    ASSERT_EQ(first.command_name, "command");
+    ASSERT_EQ(first.parameters.size(), 2);
+    ASSERT_EQ(first.parameters[1].name, "count");
+    ASSERT_EQ(first.parameters[1].optional, true);
+}
+
+TEST_F(ParserTest, ParseCachedKeepsError)
+{
+    const auto &result = CommandUsageParser::parseCached("/command <text>");
+
+    ASSERT_EQ(result.success, false);
+    ASSERT_EQ(result.error_message, "Syntax Error: expect ':', got '>' at position 15.");
+    ASSERT_EQ(&result, &CommandUsageParser::parseCached("/command <text>"));
+}
@@ -0,0 +1,106 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _WIN32
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include "endstone/detail/console/console_reader.h"
+
+namespace endstone::detail {
+
+class ConsoleReaderTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        ASSERT_EQ(pipe(fds_), 0);
+    }
+
+    void TearDown() override
+    {
+        if (fds_[1] >= 0) {
+            close(fds_[1]);
+        }
+    }
+
+    void send(std::string_view data) const
+    {
+        ASSERT_EQ(write(fds_[1], data.data(), data.size()), static_cast<ssize_t>(data.size()));
+    }
+
+    void closeInput()
+    {
+        close(fds_[1]);
+        fds_[1] = -1;
+    }
+
+    bool waitFor(std::size_t count)
+    {
+        std::unique_lock lock(mutex_);
+        return received_.wait_for(lock, std::chrono::seconds(5), [&] { return lines_.size() >= count; });
+    }
+
+    ConsoleReader::LineCallback callback()
+    {
+        return [this](std::string line) {
+            {
+                std::lock_guard lock(mutex_);
+                lines_.push_back(std::move(line));
+            }
+            received_.notify_all();
+        };
+    }
+
+    int fds_[2] = {-1, -1};
+    std::mutex mutex_;
+    std::condition_variable received_;
+    std::vector<std::string> lines_;
+};
+
+TEST_F(ConsoleReaderTest, ForwardsPipedLines)
+{
+    ConsoleReader reader(fds_[0], callback());
+    ASSERT_FALSE(reader.isInteractive());
+    send("list\r\nsay split ");
+    send("across writes\n");
+    ASSERT_TRUE(waitFor(2));
+    send("stop");
+    closeInput();
+    ASSERT_TRUE(waitFor(3));
+
+    std::lock_guard lock(mutex_);
+    ASSERT_EQ(lines_, (std::vector<std::string>{"list", "say split across writes", "stop"}));
+}
+
+TEST_F(ConsoleReaderTest, StopsWithoutInput)
+{
+    auto start = std::chrono::steady_clock::now();
+    {
+        ConsoleReader reader(fds_[0], callback());
+    }
+    ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+    ASSERT_TRUE(lines_.empty());
+}
+
+}  // namespace endstone::detail
+
+#endif
@@ -0,0 +1,101 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/console/line_editor.h"
+
+namespace endstone::detail {
+
+namespace {
+std::optional<std::string> type(LineEditor &editor, std::string_view input)
+{
+    std::optional<std::string> result;
+    for (auto c : input) {
+        if (auto line = editor.feed(c)) {
+            result = std::move(line);
+        }
+    }
+    return result;
+}
+}  // namespace
+
+TEST(LineEditorTest, CompletesLinesOnEnter)
+{
+    LineEditor editor;
+    ASSERT_FALSE(type(editor, "say hello").has_value());
+    ASSERT_EQ(editor.render(), "> say hello");
+    ASSERT_EQ(type(editor, "\n"), "say hello");
+    ASSERT_EQ(editor.getLine(), "");
+    ASSERT_FALSE(type(editor, "\r").has_value());
+}
+
+TEST(LineEditorTest, EditsAtTheCursor)
+{
+    LineEditor editor;
+    type(editor, "sy hi");
+    type(editor, "\x1B[D\x1B[D\x1B[D\x1B[D");
+    ASSERT_EQ(editor.getCursor(), 1);
+    type(editor, "a");
+    ASSERT_EQ(editor.render(), "> say hi\x1B[4D");
+    type(editor, "\x05\x7F\x7F");
+    ASSERT_EQ(editor.getLine(), "say ");
+    type(editor, "\x01\x1B[3~");
+    ASSERT_EQ(editor.getLine(), "ay ");
+    type(editor, "\x1B[F\x17");
+    ASSERT_EQ(editor.getLine(), "");
+    type(editor, "list all");
+    type(editor, "\x1B[D\x1B[D\x1B[D\x0B");
+    ASSERT_EQ(editor.getLine(), "list ");
+    type(editor, "\x15");
+    ASSERT_EQ(editor.getLine(), "");
+}
+
+TEST(LineEditorTest, KeepsUtf8SequencesWhole)
+{
+    LineEditor editor;
+    type(editor, "say \xC3\xA9t\xC3\xA9");
+    type(editor, "\x1B[D");
+    ASSERT_EQ(editor.render(), "> say \xC3\xA9t\xC3\xA9\x1B[1D");
+    type(editor, "\x7F");
+    ASSERT_EQ(editor.getLine(), "say \xC3\xA9\xC3\xA9");
+    type(editor, "\x7F");
+    ASSERT_EQ(editor.getLine(), "say \xC3\xA9");
+}
+
+TEST(LineEditorTest, RecallsHistoryAndKeepsTheDraft)
+{
+    LineEditor editor;
+    type(editor, "first\n");
+    type(editor, "second\n");
+    type(editor, "second\n");
+    type(editor, "draft");
+    type(editor, "\x1B[A");
+    ASSERT_EQ(editor.getLine(), "second");
+    type(editor, "\x1B[A");
+    ASSERT_EQ(editor.getLine(), "first");
+    type(editor, "\x1B[A");
+    ASSERT_EQ(editor.getLine(), "first");
+    type(editor, "\x1B[B\x1B[B");
+    ASSERT_EQ(editor.getLine(), "draft");
+    ASSERT_EQ(editor.getCursor(), 5);
+    type(editor, "\x1B[A");
+    ASSERT_EQ(type(editor, "\n"), "second");
+}
+
+}  // namespace endstone::detail
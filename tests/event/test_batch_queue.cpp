@@ -0,0 +1,66 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/event/async_monitor.h"
+
+TEST(BatchQueueTest, DrainInPushOrder)
+{
+    endstone::BatchQueue<int> queue;
+    EXPECT_TRUE(queue.drain().empty());
+
+    for (int i = 0; i < 5; ++i) {
+        queue.push(i);
+    }
+    EXPECT_EQ(queue.drain(), (std::vector<int>{0, 1, 2, 3, 4}));
+    EXPECT_TRUE(queue.drain().empty());
+}
+
+TEST(BatchQueueTest, ConcurrentProducers)
+{
+    constexpr int num_threads = 4;
+    constexpr int num_values = 10000;
+
+    endstone::BatchQueue<int> queue;
+    std::vector<std::thread> producers;
+    for (int t = 0; t < num_threads; ++t) {
+        producers.emplace_back([&queue, t]() {
+            for (int i = 0; i < num_values; ++i) {
+                queue.push(t * num_values + i);
+            }
+        });
+    }
+
+    std::vector<int> received;
+    while (received.size() < num_threads * num_values) {
+        auto batch = queue.drain();
+        received.insert(received.end(), batch.begin(), batch.end());
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+
+    // values from the same producer must keep their relative order
+    std::vector<int> last(num_threads, -1);
+    for (auto value : received) {
+        auto t = value / num_values;
+        EXPECT_GT(value, last[t]);
+        last[t] = value;
+    }
+    EXPECT_TRUE(queue.drain().empty());
+}
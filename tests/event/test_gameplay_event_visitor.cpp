@@ -0,0 +1,64 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/gameplay_event_visitor.h"
+
+#include <string>
+#include <variant>
+
+#include <gtest/gtest.h>
+
+using endstone::detail::GameplayEventVisitor;
+
+namespace {
+struct FormClose {
+    int form_id;
+};
+struct FormResponse {
+    int form_id;
+    std::string response;
+};
+struct Jump {};
+struct Swim {};
+
+using Event = std::variant<Jump, FormClose, Swim, FormResponse>;
+}  // namespace
+
+TEST(GameplayEventVisitorTest, CallsHandlerOfHeldAlternative)
+{
+    int closed = 0;
+    std::string response;
+    GameplayEventVisitor visitor{
+        [&](const FormClose &event) { closed = event.form_id; },
+        [&](const FormResponse &event) { response = event.response; },
+    };
+
+    EXPECT_TRUE(visitor(Event{FormClose{7}}));
+    EXPECT_EQ(closed, 7);
+    EXPECT_TRUE(visitor(Event{FormResponse{8, "[true]"}}));
+    EXPECT_EQ(response, "[true]");
+}
+
+TEST(GameplayEventVisitorTest, SkipsAlternativesWithoutHandler)
+{
+    int calls = 0;
+    GameplayEventVisitor visitor{[&](const FormClose &) { ++calls; }};
+
+    static_assert(decltype(visitor)::Takes<FormClose>);
+    static_assert(!decltype(visitor)::Takes<Jump>);
+    EXPECT_FALSE(visitor(Event{Jump{}}));
+    EXPECT_FALSE(visitor(Event{Swim{}}));
+    EXPECT_FALSE(visitor(Event{FormResponse{1, ""}}));
+    EXPECT_EQ(calls, 0);
+}
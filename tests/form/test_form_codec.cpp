@@ -0,0 +1,83 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/form/form_codec.h"
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include "endstone/form/action_form.h"
+#include "endstone/form/controls/slider.h"
+#include "endstone/form/controls/toggle.h"
+#include "endstone/form/modal_form.h"
+
+using endstone::ActionForm;
+using endstone::ModalForm;
+using endstone::Slider;
+using endstone::Toggle;
+using endstone::Translatable;
+namespace FormCodec = endstone::detail::FormCodec;
+
+TEST(FormCodecTest, ActionForm)
+{
+    ActionForm form;
+    form.setTitle("Shop \"Main\"").setContent(Translatable("shop.welcome", {"Steve"}));
+    form.addButton("Swords\n", "textures/items/diamond_sword");
+    form.addButton("Website", "https://example.com/icon.png");
+
+    auto json = nlohmann::json::parse(FormCodec::toJson(form));
+    EXPECT_EQ(json, nlohmann::json::parse(R"({
+        "type": "form",
+        "title": {"rawtext": [{"text": "Shop \"Main\""}]},
+        "content": {"rawtext": [{"translate": "shop.welcome", "with": ["Steve"]}]},
+        "buttons": [
+            {"text": {"rawtext": [{"text": "Swords\n"}]},
+             "image": {"type": "path", "data": "textures/items/diamond_sword"}},
+            {"text": {"rawtext": [{"text": "Website"}]},
+             "image": {"type": "url", "data": "https://example.com/icon.png"}}
+        ]
+    })"));
+}
+
+TEST(FormCodecTest, ModalForm)
+{
+    ModalForm form;
+    form.setTitle("Settings");
+    form.addControl(Toggle("Enabled", true));
+    form.addControl(Slider("Volume", 0, 1, 0.25F, 0.5F));
+
+    auto json = nlohmann::json::parse(FormCodec::toJson(form));
+    EXPECT_EQ(json, nlohmann::json::parse(R"({
+        "type": "custom_form",
+        "title": {"rawtext": [{"text": "Settings"}]},
+        "content": [
+            {"type": "toggle", "text": {"rawtext": [{"text": "Enabled"}]}, "default": true},
+            {"type": "slider", "text": {"rawtext": [{"text": "Volume"}]},
+             "min": 0, "max": 1, "step": 0.25, "default": 0.5}
+        ]
+    })"));
+}
+
+TEST(FormCodecTest, StaticFormSharesSerialized)
+{
+    ActionForm form;
+    EXPECT_FALSE(form.isStatic());
+    EXPECT_EQ(form.getSerialized(), nullptr);
+
+    form.setStatic(true);
+    ActionForm copy = form;
+    ASSERT_NE(form.getSerialized(), nullptr);
+    EXPECT_EQ(form.getSerialized(), copy.getSerialized());
+    EXPECT_TRUE(form.getSerialized()->empty());
+}
@@ -0,0 +1,67 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/form/json_writer.h"
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+using endstone::detail::JsonWriter;
+
+TEST(JsonWriterTest, Separators)
+{
+    std::string json;
+    JsonWriter writer(json);
+    writer.beginObject();
+    writer.key("a");
+    writer.beginArray();
+    writer.value(1);
+    writer.value(true);
+    writer.null();
+    writer.beginObject();
+    writer.endObject();
+    writer.endArray();
+    writer.key("b");
+    writer.value("c");
+    writer.endObject();
+    EXPECT_EQ(json, R"({"a":[1,true,null,{}],"b":"c"})");
+}
+
+TEST(JsonWriterTest, EscapesStrings)
+{
+    std::string json;
+    JsonWriter writer(json);
+    writer.value(std::string_view("say \"hi\"\\\n\t\x01 \xc2\xa7" "a"));
+    EXPECT_EQ(json, "\"say \\\"hi\\\"\\\\\\n\\t\\u0001 \xc2\xa7" "a\"");
+}
+
+TEST(JsonWriterTest, Numbers)
+{
+    std::string json;
+    JsonWriter writer(json);
+    writer.beginArray();
+    writer.value(0.1F);
+    writer.value(2.0F);
+    writer.value(5.0);
+    writer.value(1e300);
+    writer.value(std::numeric_limits<double>::quiet_NaN());
+    writer.value(std::int64_t{-9000000000});
+    writer.value(std::numeric_limits<std::uint64_t>::max());
+    writer.endArray();
+    EXPECT_EQ(json, "[0.1,2.0,5.0,1e+300,null,-9000000000,18446744073709551615]");
+}
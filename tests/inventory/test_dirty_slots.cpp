@@ -0,0 +1,63 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/inventory/dirty_slots.h"
+
+using endstone::detail::DirtySlots;
+
+TEST(DirtySlotsTest, ChangesArePublishedOnTheNextTick)
+{
+    DirtySlots slots;
+    slots.mark(3);
+    slots.mark(0);
+    slots.mark(3);
+    EXPECT_TRUE(slots.getChanged().empty());
+    EXPECT_FALSE(slots.isChanged(3));
+
+    slots.advance();
+    EXPECT_EQ(slots.getChanged(), (std::vector<int>{0, 3}));
+    EXPECT_TRUE(slots.isChanged(3));
+    EXPECT_FALSE(slots.isChanged(1));
+
+    slots.mark(1);
+    EXPECT_EQ(slots.getChanged(), (std::vector<int>{0, 3}));
+    slots.advance();
+    EXPECT_EQ(slots.getChanged(), (std::vector<int>{1}));
+
+    slots.advance();
+    EXPECT_TRUE(slots.getChanged().empty());
+}
+
+TEST(DirtySlotsTest, SlotsBeyondOneWord)
+{
+    DirtySlots slots;
+    slots.mark(63);
+    slots.mark(64);
+    slots.mark(130);
+    slots.mark(-1);
+    slots.advance();
+    EXPECT_EQ(slots.getChanged(), (std::vector<int>{63, 64, 130}));
+    EXPECT_TRUE(slots.isChanged(130));
+    EXPECT_FALSE(slots.isChanged(-1));
+    EXPECT_FALSE(slots.isChanged(1000));
+
+    slots.mark(2);
+    slots.advance();
+    EXPECT_EQ(slots.getChanged(), (std::vector<int>{2}));
+    EXPECT_FALSE(slots.isChanged(64));
+}
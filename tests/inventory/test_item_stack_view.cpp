@@ -0,0 +1,53 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <type_traits>
+
+#include <gtest/gtest.h>
+
+#include "endstone/inventory/item_stack.h"
+#include "endstone/inventory/item_stack_view.h"
+
+using endstone::ItemStack;
+using endstone::ItemStackView;
+
+static_assert(std::is_trivially_copyable_v<ItemStackView>);
+
+TEST(ItemStackViewTest, DefaultIsEmptyAir)
+{
+    ItemStackView view;
+    EXPECT_EQ(view.getType(), "minecraft:air");
+    EXPECT_EQ(view.getAmount(), 0);
+    EXPECT_TRUE(view.isEmpty());
+    EXPECT_TRUE(ItemStackView("minecraft:diamond", 0).isEmpty());
+    EXPECT_TRUE(ItemStackView("minecraft:air", 1).isEmpty());
+    EXPECT_FALSE(ItemStackView("minecraft:diamond", 1).isEmpty());
+}
+
+TEST(ItemStackViewTest, ViewOfItemStack)
+{
+    ItemStack item{"minecraft:diamond_sword", 1};
+    auto view = item.view();
+    EXPECT_EQ(view.getType(), "minecraft:diamond_sword");
+    EXPECT_EQ(view.getType().data(), item.view().getType().data());
+    EXPECT_EQ(view.getAmount(), 1);
+
+    item.setAmount(3);
+    EXPECT_EQ(view.getAmount(), 1);
+    EXPECT_EQ(item.view().getAmount(), 3);
+
+    ItemStack copy{view};
+    EXPECT_EQ(copy.getType(), "minecraft:diamond_sword");
+    EXPECT_EQ(copy.getAmount(), 1);
+}
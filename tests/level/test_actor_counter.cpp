@@ -0,0 +1,117 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/level/actor_counter.h"
+
+using endstone::detail::ActorCounter;
+
+namespace {
+constexpr std::uint32_t Mob = 1 << 1;
+constexpr std::uint32_t Monster = 1 << 2;
+constexpr std::uint32_t Animal = 1 << 4;
+}  // namespace
+
+TEST(ActorCounterTest, CountsByTypeAndChunk)
+{
+    ActorCounter counter;
+    EXPECT_TRUE(counter.add(1, 0, "minecraft:zombie", Mob | Monster));
+    EXPECT_TRUE(counter.add(2, 0, "minecraft:zombie", Mob | Monster));
+    EXPECT_TRUE(counter.add(3, 1, "minecraft:cow", Mob | Animal));
+    EXPECT_FALSE(counter.add(3, 1, "minecraft:cow", Mob | Animal));
+
+    EXPECT_EQ(counter.size(), 3);
+    EXPECT_EQ(counter.getCount("minecraft:zombie"), 2);
+    EXPECT_EQ(counter.getCount(0, "minecraft:zombie"), 2);
+    EXPECT_EQ(counter.getCount(1, "minecraft:zombie"), 0);
+    EXPECT_EQ(counter.getCount("minecraft:pig"), 0);
+    EXPECT_EQ(counter.getCounts(),
+              (std::vector<std::pair<std::string, int>>{{"minecraft:cow", 1}, {"minecraft:zombie", 2}}));
+    EXPECT_EQ(counter.getBusiestChunks(1), (std::vector<std::pair<std::int64_t, int>>{{0, 2}}));
+
+    EXPECT_TRUE(counter.remove(1));
+    EXPECT_FALSE(counter.remove(1));
+    EXPECT_TRUE(counter.remove(2));
+    EXPECT_EQ(counter.getCount("minecraft:zombie"), 0);
+    EXPECT_EQ(counter.getBusiestChunks(10), (std::vector<std::pair<std::int64_t, int>>{{1, 1}}));
+}
+
+TEST(ActorCounterTest, EnforcesTypeLimits)
+{
+    ActorCounter counter;
+    counter.setLimit("minecraft:zombie", {2, 3});
+    EXPECT_TRUE(counter.canAdd(0, "minecraft:zombie", Mob | Monster));
+    counter.add(1, 0, "minecraft:zombie", Mob | Monster);
+    counter.add(2, 0, "minecraft:zombie", Mob | Monster);
+    EXPECT_FALSE(counter.canAdd(0, "minecraft:zombie", Mob | Monster));
+    EXPECT_TRUE(counter.canAdd(0, "minecraft:cow", Mob | Animal));
+
+    EXPECT_TRUE(counter.canAdd(1, "minecraft:zombie", Mob | Monster));
+    counter.add(3, 1, "minecraft:zombie", Mob | Monster);
+    EXPECT_FALSE(counter.canAdd(2, "minecraft:zombie", Mob | Monster));
+
+    counter.remove(2);
+    EXPECT_TRUE(counter.canAdd(0, "minecraft:zombie", Mob | Monster));
+
+    counter.setLimit("minecraft:zombie", {});
+    counter.add(4, 0, "minecraft:zombie", Mob | Monster);
+    EXPECT_TRUE(counter.canAdd(0, "minecraft:zombie", Mob | Monster));
+}
+
+TEST(ActorCounterTest, EnforcesCategoryLimitsOnExistingActors)
+{
+    ActorCounter counter;
+    counter.add(1, 0, "minecraft:zombie", Mob | Monster);
+    counter.add(2, 0, "minecraft:cow", Mob | Animal);
+    counter.add(3, 1, "minecraft:skeleton", Mob | Monster);
+
+    counter.setLimit(Monster, {1, ActorCounter::Unlimited});
+    EXPECT_FALSE(counter.canAdd(0, "minecraft:creeper", Mob | Monster));
+    EXPECT_FALSE(counter.canAdd(1, "minecraft:creeper", Mob | Monster));
+    EXPECT_TRUE(counter.canAdd(2, "minecraft:creeper", Mob | Monster));
+    EXPECT_TRUE(counter.canAdd(0, "minecraft:pig", Mob | Animal));
+
+    counter.setLimit(Mob, {ActorCounter::Unlimited, 3});
+    EXPECT_FALSE(counter.canAdd(2, "minecraft:pig", Mob | Animal));
+    counter.remove(2);
+    EXPECT_TRUE(counter.canAdd(2, "minecraft:pig", Mob | Animal));
+}
+
+TEST(ActorCounterTest, AddAgainReplacesRecord)
+{
+    ActorCounter counter;
+    counter.setLimit(Monster, {ActorCounter::Unlimited, 2});
+    EXPECT_TRUE(counter.add(1, 0, "minecraft:zombie", Mob | Monster));
+    EXPECT_TRUE(counter.add(2, 0, "minecraft:zombie", Mob | Monster));
+    EXPECT_FALSE(counter.canAdd(1, "minecraft:zombie", Mob | Monster));
+
+    // The chunk is unloaded and its actors are loaded again, the second one in another chunk
+    EXPECT_FALSE(counter.add(1, 0, "minecraft:zombie", Mob | Monster));
+    EXPECT_FALSE(counter.add(2, 1, "minecraft:zombie", Mob | Monster));
+    EXPECT_EQ(counter.size(), 2);
+    EXPECT_EQ(counter.getCount("minecraft:zombie"), 2);
+    EXPECT_EQ(counter.getCount(0, "minecraft:zombie"), 1);
+    EXPECT_EQ(counter.getCount(1, "minecraft:zombie"), 1);
+
+    EXPECT_TRUE(counter.remove(1));
+    EXPECT_TRUE(counter.canAdd(1, "minecraft:zombie", Mob | Monster));
+    EXPECT_TRUE(counter.remove(2));
+    EXPECT_TRUE(counter.getBusiestChunks(10).empty());
+}
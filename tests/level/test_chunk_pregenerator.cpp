@@ -0,0 +1,110 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <set>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/level/chunk_pregenerator.h"
+
+using endstone::detail::ChunkPregenerator;
+
+TEST(ChunkPregeneratorTest, RingsCoverTheSquareOnce)
+{
+    constexpr int radius = 7;
+    std::set<std::pair<int, int>> seen;
+    int last_ring = 0;
+    for (std::uint64_t i = 0; i < (2 * radius + 1) * (2 * radius + 1); i++) {
+        auto [x, z] = ChunkPregenerator::offsetAt(i);
+        auto ring = std::max(std::abs(x), std::abs(z));
+        EXPECT_LE(ring, radius);
+        EXPECT_GE(ring, last_ring);
+        last_ring = ring;
+        EXPECT_TRUE(seen.emplace(x, z).second);
+    }
+    EXPECT_EQ(seen.size(), (2 * radius + 1) * (2 * radius + 1));
+}
+
+TEST(ChunkPregeneratorTest, WindowFollowsTickUsage)
+{
+    ChunkPregenerator pregenerator{10, -4, 3, 0.5F, 8};
+    auto now = ChunkPregenerator::Clock::now();
+
+    auto requests = pregenerator.poll(0.1F, now);
+    ASSERT_EQ(requests.size(), 2);
+    EXPECT_EQ(requests[0].x, 10);
+    EXPECT_EQ(requests[0].z, -4);
+    EXPECT_EQ(pregenerator.poll(0.1F, now).size(), 1);
+    EXPECT_EQ(pregenerator.getInFlight(), 3);
+
+    EXPECT_TRUE(pregenerator.poll(0.9F, now).empty());
+    EXPECT_EQ(pregenerator.getWindow(), 1);
+
+    for (int i = 0; i < 20; i++) {
+        pregenerator.poll(0.1F, now);
+    }
+    EXPECT_EQ(pregenerator.getWindow(), 8);
+    EXPECT_EQ(pregenerator.getInFlight(), 8);
+}
+
+TEST(ChunkPregeneratorTest, CheckpointIsTheFirstUnfinishedChunk)
+{
+    ChunkPregenerator pregenerator{0, 0, 2, 1.0F, 4};
+    auto now = ChunkPregenerator::Clock::now();
+    pregenerator.poll(0.0F, now);
+    pregenerator.poll(0.0F, now);
+    pregenerator.poll(0.0F, now);
+    ASSERT_EQ(pregenerator.getInFlight(), 4);
+
+    pregenerator.complete(1);
+    pregenerator.complete(2);
+    EXPECT_EQ(pregenerator.getCheckpoint(), 0);
+    pregenerator.complete(0);
+    EXPECT_EQ(pregenerator.getCheckpoint(), 3);
+    EXPECT_EQ(pregenerator.getCompleted(), 3);
+
+    auto resumed = ChunkPregenerator::deserialize(pregenerator.serialize(), 4);
+    ASSERT_TRUE(resumed.has_value());
+    EXPECT_EQ(resumed->getRadius(), 2);
+    EXPECT_EQ(resumed->getCompleted(), 3);
+    EXPECT_EQ(resumed->poll(0.0F, now).front().index, 3);
+
+    EXPECT_FALSE(ChunkPregenerator::deserialize("0 0 2 1 26", 4).has_value());
+    EXPECT_FALSE(ChunkPregenerator::deserialize("0 0", 4).has_value());
+}
+
+TEST(ChunkPregeneratorTest, RunsToCompletionWithEta)
+{
+    using namespace std::chrono_literals;
+    ChunkPregenerator pregenerator{0, 0, 1, 1.0F, 2};
+    auto now = ChunkPregenerator::Clock::now();
+    EXPECT_FALSE(pregenerator.getEta(now).has_value());
+
+    while (!pregenerator.isDone()) {
+        for (const auto &request : pregenerator.poll(0.0F, now)) {
+            pregenerator.complete(request.index);
+        }
+        now += 1s;
+        if (!pregenerator.isDone()) {
+            ASSERT_TRUE(pregenerator.getEta(now).has_value());
+        }
+    }
+    EXPECT_EQ(pregenerator.getCompleted(), 9);
+    EXPECT_EQ(pregenerator.getEta(now), std::chrono::seconds(0));
+}
@@ -0,0 +1,103 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/level/level_backup.h"
+
+using endstone::detail::LevelBackup;
+namespace fs = std::filesystem;
+
+class LevelBackupTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        const auto *test = ::testing::UnitTest::GetInstance()->current_test_info();
+        root_ = fs::temp_directory_path() / (std::string("endstone_") + test->name());
+        fs::remove_all(root_);
+        fs::create_directories(root_ / "level" / "db");
+        write("level.dat", "level data");
+        write("db/000005.ldb", "table contents");
+        write("db/000006.log", "log entry, appended after the snapshot");
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(root_);
+    }
+
+    void write(const std::string &name, const std::string &contents) const
+    {
+        std::ofstream(root_ / "level" / name, std::ios::binary) << contents;
+    }
+
+    [[nodiscard]] std::string read(const std::string &name) const
+    {
+        std::ifstream in(root_ / "copy" / name, std::ios::binary);
+        return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+    }
+
+    fs::path root_;
+};
+
+TEST_F(LevelBackupTest, CopiesFilesUpToSnapshotLength)
+{
+    LevelBackup backup{root_ / "level", {{"level.dat", 10}, {"db/000005.ldb", 14}, {"db/000006.log", 9}}};
+    EXPECT_EQ(backup.getTotalSize(), 33);
+    auto result = backup.copyTo(root_ / "copy");
+    EXPECT_EQ(result.copied, 3);
+    EXPECT_EQ(result.linked, 0);
+    EXPECT_EQ(result.bytes_copied, 33);
+
+    EXPECT_EQ(read("level.dat"), "level data");
+    EXPECT_EQ(read("db/000005.ldb"), "table contents");
+    EXPECT_EQ(read("db/000006.log"), "log entry");
+}
+
+TEST_F(LevelBackupTest, LinksUnchangedTablesFromPreviousBackup)
+{
+    LevelBackup first{root_ / "level", {{"level.dat", 10}, {"db/000005.ldb", 14}}};
+    first.copyTo(root_ / "copy");
+
+    write("db/000007.ldb", "new table");
+    LevelBackup second{root_ / "level", {{"level.dat", 10}, {"db/000005.ldb", 14}, {"db/000007.ldb", 9}}};
+    auto result = second.copyTo(root_ / "next", root_ / "copy");
+    EXPECT_EQ(result.linked, 1);
+    EXPECT_EQ(result.copied, 2);
+    EXPECT_EQ(result.bytes_copied, 19);
+    EXPECT_TRUE(fs::equivalent(root_ / "copy" / "db/000005.ldb", root_ / "next" / "db/000005.ldb"));
+    EXPECT_FALSE(fs::equivalent(root_ / "copy" / "level.dat", root_ / "next" / "level.dat"));
+}
+
+TEST_F(LevelBackupTest, RejectsExistingDestination)
+{
+    fs::create_directories(root_ / "copy");
+    LevelBackup backup{root_ / "level", {{"level.dat", 10}}};
+    EXPECT_THROW(backup.copyTo(root_ / "copy"), std::runtime_error);
+}
+
+TEST_F(LevelBackupTest, RejectsTruncatedAndEscapingFiles)
+{
+    LevelBackup truncated{root_ / "level", {{"level.dat", 100}}};
+    EXPECT_THROW(truncated.copyTo(root_ / "copy"), std::runtime_error);
+
+    LevelBackup escaping{root_ / "level", {{"../outside", 1}}};
+    EXPECT_THROW(escaping.copyTo(root_ / "copy2"), std::runtime_error);
+}
@@ -0,0 +1,88 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/level/level_sync.h"
+
+using endstone::detail::LevelSync;
+
+TEST(LevelSyncTest, AppliesEveryTimeByDefault)
+{
+    LevelSync sync;
+    EXPECT_TRUE(sync.requestTime(100, 0, 1));
+    EXPECT_TRUE(sync.requestTime(101, 100, 1));
+    EXPECT_FALSE(sync.getPendingTime().has_value());
+    EXPECT_FALSE(sync.pollTime(2).has_value());
+}
+
+TEST(LevelSyncTest, HoldsTimeUntilInterval)
+{
+    LevelSync sync{{20, 0, 0}};
+    EXPECT_TRUE(sync.requestTime(100, 0, 0));
+    EXPECT_FALSE(sync.requestTime(101, 100, 1));
+    EXPECT_FALSE(sync.requestTime(102, 100, 2));
+    EXPECT_EQ(sync.getPendingTime(), 102);
+
+    EXPECT_FALSE(sync.pollTime(19).has_value());
+    EXPECT_EQ(sync.pollTime(20), 102);
+    EXPECT_FALSE(sync.getPendingTime().has_value());
+    EXPECT_FALSE(sync.pollTime(40).has_value());
+
+    EXPECT_FALSE(sync.requestTime(103, 102, 21));
+    EXPECT_TRUE(sync.requestTime(104, 102, 40));
+    EXPECT_FALSE(sync.getPendingTime().has_value());
+}
+
+TEST(LevelSyncTest, AppliesLargeJumpsAtOnce)
+{
+    LevelSync sync{{20, 1000, 0}};
+    EXPECT_TRUE(sync.requestTime(0, 0, 0));
+    EXPECT_FALSE(sync.requestTime(999, 0, 1));
+    EXPECT_TRUE(sync.requestTime(1000, 0, 2));
+    EXPECT_TRUE(sync.requestTime(0, 1000, 3));
+    EXPECT_FALSE(sync.getPendingTime().has_value());
+}
+
+TEST(LevelSyncTest, SuppressesCancelledWeatherChanges)
+{
+    LevelSync sync{{0, 0, 100}};
+    EXPECT_FALSE(sync.isSuppressed(LevelSync::Weather::Rain, true, 0));
+    sync.recordCancelled(LevelSync::Weather::Rain, true, 10);
+    EXPECT_TRUE(sync.isSuppressed(LevelSync::Weather::Rain, true, 11));
+    EXPECT_TRUE(sync.isSuppressed(LevelSync::Weather::Rain, true, 109));
+    EXPECT_FALSE(sync.isSuppressed(LevelSync::Weather::Rain, true, 110));
+    EXPECT_FALSE(sync.isSuppressed(LevelSync::Weather::Rain, false, 11));
+    EXPECT_FALSE(sync.isSuppressed(LevelSync::Weather::Lightning, true, 11));
+
+    LevelSync disabled;
+    disabled.recordCancelled(LevelSync::Weather::Rain, true, 10);
+    EXPECT_FALSE(disabled.isSuppressed(LevelSync::Weather::Rain, true, 11));
+}
+
+#ifdef __linux__
+TEST(LevelSyncTest, ReadsOptionsFromEnvironment)
+{
+    setenv("ENDSTONE_TIME_SYNC_INTERVAL", "40", 1);
+    setenv("ENDSTONE_TIME_SYNC_THRESHOLD", "-5", 1);
+    setenv("ENDSTONE_WEATHER_EVENT_INTERVAL", "abc", 1);
+    auto options = LevelSync::Options::fromEnvironment();
+    unsetenv("ENDSTONE_TIME_SYNC_INTERVAL");
+    unsetenv("ENDSTONE_TIME_SYNC_THRESHOLD");
+    unsetenv("ENDSTONE_WEATHER_EVENT_INTERVAL");
+    EXPECT_EQ(options.time_interval, 40);
+    EXPECT_EQ(options.time_threshold, 0);
+    EXPECT_EQ(options.weather_interval, 0);
+}
+#endif
@@ -0,0 +1,90 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/level/region_index.h"
+
+using endstone::detail::RegionIndex;
+
+TEST(RegionIndexTest, InsertAndErase)
+{
+    RegionIndex index;
+    EXPECT_TRUE(index.insert("spawn", RegionIndex::fromBlocks(10, 0, 10, -10, 64, -10)));
+    EXPECT_FALSE(index.insert("spawn", RegionIndex::fromBlocks(0, 0, 0, 1, 1, 1)));
+    EXPECT_EQ(index.size(), 1);
+
+    const auto *box = index.find("spawn");
+    ASSERT_NE(box, nullptr);
+    EXPECT_FLOAT_EQ(box->min_x, -10.0F);
+    EXPECT_FLOAT_EQ(box->max_x, 11.0F);
+    EXPECT_EQ(index.query(10.5F, 64.5F, -10.0F), std::vector<std::string>{"spawn"});
+    EXPECT_TRUE(index.query(11.0F, 0.0F, 0.0F).empty());
+
+    EXPECT_TRUE(index.erase("spawn"));
+    EXPECT_FALSE(index.erase("spawn"));
+    EXPECT_EQ(index.find("spawn"), nullptr);
+    EXPECT_TRUE(index.query(0.0F, 0.0F, 0.0F).empty());
+}
+
+TEST(RegionIndexTest, OverlappingRegionsAreSortedByName)
+{
+    RegionIndex index;
+    index.insert("b", RegionIndex::fromBlocks(0, 0, 0, 10, 10, 10));
+    index.insert("a", RegionIndex::fromBlocks(5, 5, 5, 15, 15, 15));
+    index.insert("c", RegionIndex::fromBlocks(20, 0, 0, 30, 10, 10));
+
+    EXPECT_EQ(index.query(7.0F, 7.0F, 7.0F), (std::vector<std::string>{"a", "b"}));
+    EXPECT_EQ(index.query(RegionIndex::fromBlocks(12, 0, 0, 25, 5, 5)), (std::vector<std::string>{"a", "c"}));
+}
+
+TEST(RegionIndexTest, MatchesBruteForce)
+{
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> coord(-500, 500);
+    std::uniform_int_distribution<int> extent(0, 40);
+
+    RegionIndex index;
+    std::vector<std::pair<std::string, RegionIndex::Box>> regions;
+    for (int i = 0; i < 1000; i++) {
+        auto x = coord(rng), y = coord(rng) / 5, z = coord(rng);
+        auto box = RegionIndex::fromBlocks(x, y, z, x + extent(rng), y + extent(rng), z + extent(rng));
+        auto name = "region" + std::to_string(i);
+        index.insert(name, box);
+        regions.emplace_back(name, box);
+    }
+    for (int i = 0; i < 1000; i += 3) {
+        index.erase("region" + std::to_string(i));
+    }
+
+    for (int i = 0; i < 2000; i++) {
+        auto x = static_cast<float>(coord(rng)) + 0.5F;
+        auto y = static_cast<float>(coord(rng) / 5);
+        auto z = static_cast<float>(coord(rng)) - 0.25F;
+        std::vector<std::string> expected;
+        for (int j = 0; j < static_cast<int>(regions.size()); j++) {
+            if (j % 3 != 0 && regions[j].second.contains(x, y, z)) {
+                expected.push_back(regions[j].first);
+            }
+        }
+        std::sort(expected.begin(), expected.end());
+        ASSERT_EQ(index.query(x, y, z), expected);
+    }
+}
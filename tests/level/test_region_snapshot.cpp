@@ -0,0 +1,65 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/level/region_snapshot.h"
+
+using endstone::RegionSnapshot;
+
+TEST(RegionSnapshotTest, RoundTrip)
+{
+    std::vector<std::uint16_t> indices(4 * 3 * 5, 0);
+    indices[7] = 1;
+    indices[8] = RegionSnapshot::Missing;
+    RegionSnapshot snapshot(-10, -64, 300, 4, 3, 5, {R"({"name":"minecraft:air"})", R"({"name":"minecraft:stone"})"},
+                            indices);
+
+    auto decoded = RegionSnapshot::deserialize(snapshot.serialize());
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->getMinX(), -10);
+    EXPECT_EQ(decoded->getMinY(), -64);
+    EXPECT_EQ(decoded->getMinZ(), 300);
+    EXPECT_EQ(decoded->getSizeX(), 4);
+    EXPECT_EQ(decoded->getSizeY(), 3);
+    EXPECT_EQ(decoded->getSizeZ(), 5);
+    EXPECT_EQ(decoded->getPalette(), snapshot.getPalette());
+    EXPECT_EQ(decoded->getIndices(), indices);
+}
+
+TEST(RegionSnapshotTest, CompressesRuns)
+{
+    RegionSnapshot snapshot(0, 0, 0, 64, 64, 64, {"air"}, std::vector<std::uint16_t>(64 * 64 * 64, 0));
+    EXPECT_LT(snapshot.serialize().size(), 32);
+}
+
+TEST(RegionSnapshotTest, RejectsMalformedData)
+{
+    RegionSnapshot snapshot(0, 0, 0, 2, 2, 2, {"air", "stone"}, {0, 0, 1, 1, 0, 1, 0, 1});
+    auto data = snapshot.serialize();
+    EXPECT_FALSE(RegionSnapshot::deserialize(""));
+    EXPECT_FALSE(RegionSnapshot::deserialize("ESRX" + data.substr(4)));
+    for (std::size_t i = 0; i < data.size(); i++) {
+        EXPECT_FALSE(RegionSnapshot::deserialize(data.substr(0, i))) << "truncated at " << i;
+    }
+    EXPECT_FALSE(RegionSnapshot::deserialize(data + '\x01'));
+
+    // A palette index past the end of the palette
+    data.back() = '\x02';
+    EXPECT_FALSE(RegionSnapshot::deserialize(data));
+}
@@ -0,0 +1,75 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/level/view_distance_controller.h"
+
+namespace endstone::detail {
+
+TEST(ViewDistanceControllerTest, LowersTheCapWhileOverTheTarget)
+{
+    ViewDistanceController controller(0.8F);
+    EXPECT_FALSE(controller.update(0, 0.5F, 12));
+    EXPECT_FALSE(controller.getCap().has_value());
+
+    EXPECT_TRUE(controller.update(1, 0.9F, 12));
+    EXPECT_EQ(controller.getCap(), 11);
+    // Changes are spaced out so that each one shows in the usage first
+    EXPECT_FALSE(controller.update(2, 0.9F, 12));
+    EXPECT_EQ(controller.getCap(), 11);
+
+    std::uint64_t tick = 1;
+    for (int i = 0; i < 20; i++) {
+        tick += ViewDistanceController::AdjustInterval;
+        controller.update(tick, 0.9F, 12);
+    }
+    EXPECT_EQ(controller.getCap(), ViewDistanceController::MinDistance);
+}
+
+TEST(ViewDistanceControllerTest, RaisesTheCapOnceWellUnderTheTarget)
+{
+    ViewDistanceController controller(0.8F);
+    std::uint64_t tick = 0;
+    for (int i = 0; i < 3; i++) {
+        controller.update(tick, 0.9F, 10);
+        tick += ViewDistanceController::AdjustInterval;
+    }
+    ASSERT_EQ(controller.getCap(), 7);
+
+    // Within the hysteresis, the cap stays
+    EXPECT_FALSE(controller.update(tick, 0.75F, 10));
+    EXPECT_TRUE(controller.update(tick, 0.5F, 10));
+    EXPECT_EQ(controller.getCap(), 8);
+    tick += ViewDistanceController::AdjustInterval;
+    EXPECT_TRUE(controller.update(tick, 0.5F, 10));
+    EXPECT_EQ(controller.getCap(), 9);
+    tick += ViewDistanceController::AdjustInterval;
+    EXPECT_TRUE(controller.update(tick, 0.5F, 10));
+    EXPECT_FALSE(controller.getCap().has_value());
+}
+
+TEST(ViewDistanceControllerTest, LowersFromTheHighestRequest)
+{
+    ViewDistanceController controller(0.8F);
+    ASSERT_TRUE(controller.update(0, 0.9F, 16));
+    ASSERT_EQ(controller.getCap(), 15);
+
+    // The clients asking for the most left, a cap of 15 would not limit the others
+    EXPECT_TRUE(controller.update(ViewDistanceController::AdjustInterval, 0.9F, 8));
+    EXPECT_EQ(controller.getCap(), 7);
+    EXPECT_FALSE(ViewDistanceController(0.8F).update(0, 0.9F, ViewDistanceController::MinDistance));
+}
+
+}  // namespace endstone::detail
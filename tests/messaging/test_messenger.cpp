@@ -0,0 +1,308 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/logger_factory.h"
+#include "endstone/detail/messaging/messenger.h"
+#include "endstone/detail/messaging/udp_multicast_transport.h"
+#include "endstone/plugin/plugin.h"
+
+namespace endstone::detail {
+
+class TestPlugin : public Plugin {
+public:
+    explicit TestPlugin(std::string name) : description_(std::move(name), "1.0.0")
+    {
+        setEnabled(true);
+    }
+
+    [[nodiscard]] const PluginDescription &getDescription() const override
+    {
+        return description_;
+    }
+
+    using Plugin::setEnabled;
+
+private:
+    PluginDescription description_;
+};
+
+// Delivers every message published on it to all the transports subscribed to the channel, the sender included
+class Bus {
+public:
+    class Transport : public MessageTransport {
+    public:
+        explicit Transport(Bus &bus) : bus_(bus) {}
+
+        void start(Receiver receiver) override
+        {
+            std::lock_guard lock(bus_.mutex_);
+            receiver_ = std::move(receiver);
+            bus_.transports_.insert(this);
+            ++bus_.started_;
+        }
+
+        void stop() override
+        {
+            std::lock_guard lock(bus_.mutex_);
+            bus_.transports_.erase(this);
+            ++bus_.stopped_;
+        }
+
+        void subscribe(const std::string &channel) override
+        {
+            std::lock_guard lock(bus_.mutex_);
+            channels_.insert(channel);
+        }
+
+        void unsubscribe(const std::string &channel) override
+        {
+            std::lock_guard lock(bus_.mutex_);
+            channels_.erase(channel);
+        }
+
+        void publish(const std::string &channel, const std::string &payload) override
+        {
+            std::lock_guard lock(bus_.mutex_);
+            for (auto *transport : bus_.transports_) {
+                if (transport->channels_.count(channel) > 0) {
+                    transport->receiver_(channel, payload);
+                }
+            }
+        }
+
+    private:
+        friend class Bus;
+
+        Bus &bus_;
+        Receiver receiver_;
+        std::set<std::string> channels_;
+    };
+
+    [[nodiscard]] EndstoneMessenger::TransportFactory factory()
+    {
+        return [this]() { return std::make_unique<Transport>(*this); };
+    }
+
+    [[nodiscard]] std::size_t subscribers(const std::string &channel)
+    {
+        std::lock_guard lock(mutex_);
+        std::size_t count = 0;
+        for (auto *transport : transports_) {
+            count += transport->channels_.count(channel);
+        }
+        return count;
+    }
+
+    [[nodiscard]] int started()
+    {
+        std::lock_guard lock(mutex_);
+        return started_;
+    }
+
+    [[nodiscard]] int stopped()
+    {
+        std::lock_guard lock(mutex_);
+        return stopped_;
+    }
+
+private:
+    std::mutex mutex_;
+    std::set<Transport *> transports_;
+    int started_ = 0;
+    int stopped_ = 0;
+};
+
+bool waitUntil(const std::function<bool()> &condition)
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+class MessengerTest : public ::testing::Test {
+protected:
+    std::unique_ptr<EndstoneMessenger> open(std::string server_id)
+    {
+        auto messenger =
+            std::make_unique<EndstoneMessenger>(executor_, LoggerFactory::getLogger("Test"), std::move(server_id));
+        messenger->setDefaultTransport(bus_.factory());
+        return messenger;
+    }
+
+    // Ticks the messenger until the handlers have been given the number of messages
+    static bool tickUntil(EndstoneMessenger &messenger, const std::vector<std::string> &received, std::size_t count)
+    {
+        return waitUntil([&]() {
+            messenger.tick();
+            return received.size() >= count;
+        });
+    }
+
+    ThreadPoolExecutor executor_{2};
+    Bus bus_;
+    TestPlugin first_{"first"};
+    TestPlugin second_{"second"};
+};
+
+TEST_F(MessengerTest, DeliversToOtherServersOnTick)
+{
+    auto lobby = open("lobby");
+    auto survival = open("survival");
+    std::vector<std::string> lobby_received;
+    std::vector<std::string> survival_received;
+    lobby->subscribe(first_, "chat", [&](const auto &channel, const auto &message) {
+        lobby_received.push_back(channel + ":" + message);
+    });
+    survival->subscribe(first_, "chat", [&](const auto &channel, const auto &message) {
+        survival_received.push_back(channel + ":" + message);
+    });
+    ASSERT_TRUE(waitUntil([&]() { return bus_.subscribers("chat") == 2; }));
+
+    lobby->publish("chat", std::string("hello\0world", 11));
+
+    ASSERT_TRUE(tickUntil(*survival, survival_received, 1));
+    EXPECT_EQ(survival_received, (std::vector<std::string>{std::string("chat:hello\0world", 16)}));
+    lobby->tick();
+    EXPECT_TRUE(lobby_received.empty());
+    EXPECT_NE(lobby->getServerId(), survival->getServerId());
+}
+
+TEST_F(MessengerTest, UnsubscribesFromTheTransportWithTheLastSubscriber)
+{
+    auto lobby = open("lobby");
+    auto survival = open("survival");
+    std::vector<std::string> received;
+    survival->subscribe(first_, "chat", [&](const auto &, const auto &message) { received.push_back(message); });
+    survival->subscribe(second_, "chat", [&](const auto &, const auto &message) { received.push_back(message); });
+    ASSERT_TRUE(waitUntil([&]() { return bus_.subscribers("chat") == 1; }));
+
+    survival->unsubscribe(first_, "chat");
+    lobby->publish("chat", "one");
+    ASSERT_TRUE(tickUntil(*survival, received, 1));
+    EXPECT_EQ(received, (std::vector<std::string>{"one"}));
+
+    survival->unregister(second_);
+    EXPECT_TRUE(waitUntil([&]() { return bus_.subscribers("chat") == 0; }));
+}
+
+TEST_F(MessengerTest, SkipsDisabledPluginsAndFailingHandlers)
+{
+    TestPlugin third{"third"};
+    auto lobby = open("lobby");
+    auto survival = open("survival");
+    std::vector<std::string> second_received;
+    std::vector<std::string> third_received;
+    survival->subscribe(first_, "chat", [](const auto &, const auto &) { throw std::runtime_error("failed"); });
+    survival->subscribe(second_, "chat", [&](const auto &, const auto &message) { second_received.push_back(message); });
+    survival->subscribe(third, "chat", [&](const auto &, const auto &message) { third_received.push_back(message); });
+    ASSERT_TRUE(waitUntil([&]() { return bus_.subscribers("chat") == 1; }));
+
+    lobby->publish("chat", "one");
+    ASSERT_TRUE(tickUntil(*survival, third_received, 1));
+    second_.setEnabled(false);
+    lobby->publish("chat", "two");
+    ASSERT_TRUE(tickUntil(*survival, third_received, 2));
+    second_.setEnabled(true);
+    lobby->publish("chat", "three");
+    ASSERT_TRUE(tickUntil(*survival, third_received, 3));
+
+    EXPECT_EQ(second_received, (std::vector<std::string>{"one", "three"}));
+    EXPECT_EQ(third_received, (std::vector<std::string>{"one", "two", "three"}));
+}
+
+TEST_F(MessengerTest, PluginTransportIsStoppedBeforeUnregisterReturns)
+{
+    Bus plugin_bus;
+    auto lobby = open("lobby");
+    ASSERT_TRUE(waitUntil([&]() { return bus_.started() == 1; }));
+
+    lobby->setTransport(first_, plugin_bus.factory()());
+    EXPECT_EQ(bus_.stopped(), 1);
+    EXPECT_EQ(plugin_bus.started(), 1);
+
+    lobby->unregister(first_);
+    EXPECT_EQ(plugin_bus.stopped(), 1);
+    EXPECT_EQ(bus_.started(), 2);
+
+    lobby->close();
+    EXPECT_EQ(bus_.stopped(), 2);
+}
+
+TEST_F(MessengerTest, ServerSubscriptionsOutliveThePlugins)
+{
+    auto lobby = open("lobby");
+    auto survival = open("survival");
+    std::vector<std::string> received;
+    survival->subscribeServer("handoff", [&](const auto &, const auto &message) { received.push_back(message); });
+    survival->subscribe(first_, "handoff", [](const auto &, const auto &) {});
+    survival->unregister(first_);
+    ASSERT_TRUE(waitUntil([&]() { return bus_.subscribers("handoff") == 1; }));
+
+    lobby->publish("handoff", "steve");
+    ASSERT_TRUE(tickUntil(*survival, received, 1));
+    EXPECT_EQ(received, (std::vector<std::string>{"steve"}));
+}
+
+TEST(UdpMulticastTransportTest, ReceivesOwnMessagesOnLoopback)
+{
+    UdpMulticastTransport transport("239.255.43.21", 47321);
+    std::mutex mutex;
+    std::vector<std::pair<std::string, std::string>> received;
+    try {
+        transport.start([&](const std::string &channel, const std::string &payload) {
+            std::lock_guard lock(mutex);
+            received.emplace_back(channel, payload);
+        });
+    }
+    catch (const std::exception &e) {
+        GTEST_SKIP() << "Multicast is not available: " << e.what();
+    }
+    transport.subscribe("chat");
+    transport.publish("other", "ignored");
+    transport.publish("chat", "hello");
+
+    const auto delivered = waitUntil([&]() {
+        std::lock_guard lock(mutex);
+        return !received.empty();
+    });
+    transport.stop();
+    if (!delivered) {
+        GTEST_SKIP() << "Multicast loopback is not available";
+    }
+    EXPECT_EQ(received.front(), (std::pair<std::string, std::string>{"chat", "hello"}));
+    EXPECT_THROW(transport.publish("chat", std::string(UdpMulticastTransport::MaxDatagramSize, 'x')),
+                 std::length_error);
+}
+
+}  // namespace endstone::detail
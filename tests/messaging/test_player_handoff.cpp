@@ -0,0 +1,66 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/messaging/player_handoff.h"
+
+namespace endstone::detail {
+
+namespace {
+PlayerHandoff makeHandoff()
+{
+    PlayerHandoff handoff;
+    handoff.player_id = UUID{{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}};
+    handoff.player_name = "Steve";
+    handoff.source_server_id = "lobby";
+    handoff.entries = {{"economy", "coins", "10"}, {"ranks", "rank", std::string("gold\0\xFF", 6)}};
+    return handoff;
+}
+}  // namespace
+
+TEST(PlayerHandoffTest, RoundTrips)
+{
+    auto decoded = PlayerHandoff::decode(makeHandoff().encode());
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->player_id, makeHandoff().player_id);
+    EXPECT_EQ(decoded->player_name, "Steve");
+    EXPECT_EQ(decoded->source_server_id, "lobby");
+    ASSERT_EQ(decoded->entries.size(), 2);
+    EXPECT_EQ(decoded->entries[0].plugin, "economy");
+    EXPECT_EQ(decoded->entries[0].key, "coins");
+    EXPECT_EQ(decoded->entries[0].value, "10");
+    EXPECT_EQ(decoded->entries[1].value, std::string("gold\0\xFF", 6));
+}
+
+TEST(PlayerHandoffTest, RejectsMalformedMessages)
+{
+    const auto message = makeHandoff().encode();
+    for (std::size_t size = 0; size < message.size(); size++) {
+        EXPECT_FALSE(PlayerHandoff::decode(message.substr(0, size)).has_value()) << size;
+    }
+    EXPECT_FALSE(PlayerHandoff::decode(message + "x").has_value());
+
+    auto version = message;
+    version[0] = 2;
+    EXPECT_FALSE(PlayerHandoff::decode(version).has_value());
+
+    auto handoff = makeHandoff();
+    handoff.entries[0].plugin = std::string("economy\0other", 13);
+    EXPECT_FALSE(PlayerHandoff::decode(handoff.encode()).has_value());
+}
+
+}  // namespace endstone::detail
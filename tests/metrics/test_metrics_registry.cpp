@@ -0,0 +1,94 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/metrics/metrics_registry.h"
+
+using endstone::detail::Histogram;
+using endstone::detail::MetricsRegistry;
+
+TEST(MetricsRegistryTest, SumsCounterShards)
+{
+    MetricsRegistry registry;
+    auto &counter = registry.counter("test_events_total", "Events.");
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([&counter]() {
+            for (int j = 0; j < 1000; ++j) {
+                counter.inc();
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(counter.value(), 8000);
+}
+
+TEST(MetricsRegistryTest, ReturnsSameMetricForSameLabels)
+{
+    MetricsRegistry registry;
+    auto &cpu = registry.gauge("test_queue_depth", "Queue depth.", {{"executor", "cpu"}});
+    auto &io = registry.gauge("test_queue_depth", "Queue depth.", {{"executor", "io"}});
+    EXPECT_EQ(&cpu, &registry.gauge("test_queue_depth", "Queue depth.", {{"executor", "cpu"}}));
+    EXPECT_NE(&cpu, &io);
+    EXPECT_THROW(registry.counter("test_queue_depth", "Queue depth."), std::invalid_argument);
+}
+
+TEST(MetricsRegistryTest, AccumulatesHistogramBuckets)
+{
+    Histogram histogram{{0.01, 0.05}};
+    histogram.observe(0.005);
+    histogram.observe(0.01);
+    histogram.observe(0.02);
+    histogram.observe(1.0);
+
+    auto snapshot = histogram.snapshot();
+    ASSERT_EQ(snapshot.counts.size(), 3);
+    EXPECT_EQ(snapshot.counts[0], 2);
+    EXPECT_EQ(snapshot.counts[1], 3);
+    EXPECT_EQ(snapshot.counts[2], 4);
+    EXPECT_DOUBLE_EQ(snapshot.sum, 1.035);
+}
+
+TEST(MetricsRegistryTest, RejectsUnorderedBounds)
+{
+    EXPECT_THROW(Histogram({0.05, 0.01}), std::invalid_argument);
+}
+
+TEST(MetricsRegistryTest, SerializesTextFormat)
+{
+    MetricsRegistry registry;
+    registry.counter("test_ticks_total", "Ticks run.").inc(3);
+    registry.gauge("test_players", "Players online.", {{"world", "a \"b\"\n"}}).set(2.5);
+    registry.histogram("test_tick_seconds", "Tick duration.", {0.05}).observe(0.02);
+
+    EXPECT_EQ(registry.serialize(), "# HELP test_players Players online.\n"
+                                    "# TYPE test_players gauge\n"
+                                    "test_players{world=\"a \\\"b\\\"\\n\"} 2.5\n"
+                                    "# HELP test_tick_seconds Tick duration.\n"
+                                    "# TYPE test_tick_seconds histogram\n"
+                                    "test_tick_seconds_bucket{le=\"0.05\"} 1\n"
+                                    "test_tick_seconds_bucket{le=\"+Inf\"} 1\n"
+                                    "test_tick_seconds_sum 0.02\n"
+                                    "test_tick_seconds_count 1\n"
+                                    "# HELP test_ticks_total Ticks run.\n"
+                                    "# TYPE test_ticks_total counter\n"
+                                    "test_ticks_total 3\n");
+}
@@ -0,0 +1,67 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdexcept>
+#include <string>
+
+#include <boost/asio.hpp>
+#include <gtest/gtest.h>
+
+#include "endstone/detail/metrics/metrics_server.h"
+
+using endstone::detail::MetricsRegistry;
+using endstone::detail::MetricsServer;
+
+namespace {
+std::string get(std::uint16_t port, const std::string &target)
+{
+    namespace asio = boost::asio;
+    asio::io_context io_context;
+    asio::ip::tcp::socket socket{io_context};
+    socket.connect({asio::ip::make_address("127.0.0.1"), port});
+    const auto request = "GET " + target + " HTTP/1.1\r\nHost: localhost\r\n\r\n";
+    asio::write(socket, asio::buffer(request));
+
+    std::string response;
+    boost::system::error_code ec;
+    asio::read(socket, asio::dynamic_buffer(response), ec);
+    return response;
+}
+}  // namespace
+
+TEST(MetricsServerTest, ServesMetrics)
+{
+    MetricsRegistry registry;
+    registry.counter("test_ticks_total", "Ticks run.").inc(7);
+    MetricsServer server{registry, "127.0.0.1", 0};
+
+    auto response = get(server.getPort(), "/metrics");
+    EXPECT_EQ(response.rfind("HTTP/1.1 200 OK\r\n", 0), 0);
+    EXPECT_NE(response.find("Content-Type: text/plain; version=0.0.4"), std::string::npos);
+    EXPECT_NE(response.find("\r\n\r\n# HELP test_ticks_total Ticks run.\n"), std::string::npos);
+    EXPECT_NE(response.find("test_ticks_total 7\n"), std::string::npos);
+}
+
+TEST(MetricsServerTest, RejectsOtherPaths)
+{
+    MetricsRegistry registry;
+    MetricsServer server{registry, "127.0.0.1", 0};
+    EXPECT_EQ(get(server.getPort(), "/").rfind("HTTP/1.1 404 Not Found\r\n", 0), 0);
+}
+
+TEST(MetricsServerTest, ThrowsOnInvalidAddress)
+{
+    MetricsRegistry registry;
+    EXPECT_THROW(MetricsServer(registry, "not an address", 0), std::runtime_error);
+}
@@ -0,0 +1,255 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <string>
+#include <system_error>
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/nbt/nbt_reader.h"
+#include "endstone/detail/nbt/nbt_tree.h"
+
+using endstone::detail::NbtArena;
+using endstone::detail::NbtReader;
+using endstone::detail::NbtVisitor;
+
+namespace {
+
+// Little endian input with 16-bit string lengths, the layout Bedrock uses for NBT on disk
+class StringInput : public IDataInput {
+public:
+    explicit StringInput(std::string data) : data_(std::move(data)) {}
+
+    Bedrock::Result<std::string> readStringResult() override
+    {
+        auto size = readShortResult();
+        if (!size) {
+            return nonstd::make_unexpected(size.error());
+        }
+        std::string value(static_cast<std::uint16_t>(size.value()), '\0');
+        if (auto result = readBytesResult(value.data(), value.size()); !result) {
+            return nonstd::make_unexpected(result.error());
+        }
+        return value;
+    }
+    Bedrock::Result<std::string> readLongStringResult() override
+    {
+        return readStringResult();
+    }
+    Bedrock::Result<float> readFloatResult() override
+    {
+        return read<float>();
+    }
+    Bedrock::Result<double> readDoubleResult() override
+    {
+        return read<double>();
+    }
+    Bedrock::Result<std::uint8_t> readByteResult() override
+    {
+        return read<std::uint8_t>();
+    }
+    Bedrock::Result<std::int16_t> readShortResult() override
+    {
+        return read<std::int16_t>();
+    }
+    Bedrock::Result<std::int32_t> readIntResult() override
+    {
+        return read<std::int32_t>();
+    }
+    Bedrock::Result<std::int64_t> readLongLongResult() override
+    {
+        return read<std::int64_t>();
+    }
+    Bedrock::Result<void> readBytesResult(void *data, std::uint64_t size) override
+    {
+        if (size > numBytesLeft()) {
+            return nonstd::make_unexpected(
+                Bedrock::ErrorInfo<std::error_code>{std::make_error_code(std::errc::result_out_of_range)});
+        }
+        std::memcpy(data, data_.data() + offset_, size);
+        offset_ += size;
+        return {};
+    }
+    [[nodiscard]] std::uint64_t numBytesLeft() const override
+    {
+        return data_.size() - offset_;
+    }
+
+private:
+    template <typename T>
+    Bedrock::Result<T> read()
+    {
+        T value;
+        if (auto result = readBytesResult(&value, sizeof(T)); !result) {
+            return nonstd::make_unexpected(result.error());
+        }
+        return value;
+    }
+
+    std::string data_;
+    std::size_t offset_ = 0;
+};
+
+// {"": {"name": "stone", "count": 3b, "tags": [1, 2], "extra": {"damage": 7s}}}
+const std::string ItemNbt{"\x0A\x00\x00"
+                          "\x08\x04\x00name\x05\x00stone"
+                          "\x01\x05\x00" "count\x03"
+                          "\x09\x04\x00tags\x03\x02\x00\x00\x00\x01\x00\x00\x00\x02\x00\x00\x00"
+                          "\x0A\x05\x00" "extra"
+                          "\x02\x06\x00" "damage\x07\x00"
+                          "\x00"
+                          "\x00",
+                          67};
+
+class RecordingVisitor : public NbtVisitor {
+public:
+    void visitKey(std::string_view name) override
+    {
+        events += "key:" + std::string(name) + ";";
+    }
+    void visitByte(std::uint8_t value) override
+    {
+        events += "byte:" + std::to_string(value) + ";";
+    }
+    void visitShort(std::int16_t value) override
+    {
+        events += "short:" + std::to_string(value) + ";";
+    }
+    void visitInt(std::int32_t value) override
+    {
+        events += "int:" + std::to_string(value) + ";";
+    }
+    void visitString(std::string_view value) override
+    {
+        events += "string:" + std::string(value) + ";";
+    }
+    bool beginCompound() override
+    {
+        events += "{;";
+        return compounds_to_read-- > 0;
+    }
+    void endCompound() override
+    {
+        events += "};";
+    }
+    bool beginList(Tag::Type type, std::int32_t size) override
+    {
+        events += "[" + std::to_string(size) + ";";
+        return true;
+    }
+    void endList() override
+    {
+        events += "];";
+    }
+
+    std::string events;
+    int compounds_to_read = 2;
+};
+
+}  // namespace
+
+TEST(NbtReaderTest, VisitsEveryValueInOrder)
+{
+    StringInput input{ItemNbt};
+    RecordingVisitor visitor;
+    ASSERT_TRUE(NbtReader(input).read(visitor));
+    EXPECT_EQ(visitor.events, "key:;{;key:name;string:stone;key:count;byte:3;key:tags;[2;int:1;int:2;];"
+                              "key:extra;{;key:damage;short:7;};};");
+    EXPECT_EQ(input.numBytesLeft(), 0);
+}
+
+TEST(NbtReaderTest, SkipsCompoundsTheVisitorDeclines)
+{
+    StringInput input{ItemNbt};
+    RecordingVisitor visitor;
+    visitor.compounds_to_read = 1;
+    ASSERT_TRUE(NbtReader(input).read(visitor));
+    EXPECT_EQ(visitor.events, "key:;{;key:name;string:stone;key:count;byte:3;key:tags;[2;int:1;int:2;];"
+                              "key:extra;{;};");
+    EXPECT_EQ(input.numBytesLeft(), 0);
+}
+
+TEST(NbtReaderTest, RejectsMalformedInput)
+{
+    RecordingVisitor visitor;
+
+    StringInput truncated{ItemNbt.substr(0, 40)};
+    EXPECT_FALSE(NbtReader(truncated).read(visitor));
+
+    // a list claiming two billion elements must fail before anything is allocated
+    StringInput oversized{std::string{"\x09\x00\x00\x03\xFF\xFF\xFF\x7F", 8}};
+    EXPECT_FALSE(NbtReader(oversized).read(visitor));
+
+    StringInput bad_type{std::string{"\x0A\x00\x00\x0D\x00\x00\x00", 7}};
+    EXPECT_FALSE(NbtReader(bad_type).read(visitor));
+
+}
+
+TEST(NbtReaderTest, LimitsNestingDepth)
+{
+    auto nested_lists = [](int depth) {
+        std::string data{"\x09\x00\x00", 3};
+        for (auto i = 1; i < depth; ++i) {
+            data += std::string{"\x09\x01\x00\x00\x00", 5};
+        }
+        return data + std::string{"\x00\x00\x00\x00\x00", 5};
+    };
+
+    NbtVisitor visitor;
+    StringInput shallow{nested_lists(NbtReader::MaxDepth)};
+    EXPECT_TRUE(NbtReader(shallow).read(visitor));
+    StringInput deep{nested_lists(NbtReader::MaxDepth + 1)};
+    EXPECT_FALSE(NbtReader(deep).read(visitor));
+}
+
+TEST(NbtTreeTest, BuildsTreeInArena)
+{
+    StringInput input{ItemNbt};
+    NbtArena arena;
+    auto result = endstone::detail::readNbtTree(input, arena);
+    ASSERT_TRUE(result);
+
+    const auto *root = result.value();
+    ASSERT_NE(root, nullptr);
+    EXPECT_EQ(root->type, Tag::Type::Compound);
+    EXPECT_EQ(root->size, 4);
+    EXPECT_EQ(root->get("name")->bytes, "stone");
+    EXPECT_EQ(root->get("count")->integer, 3);
+    EXPECT_EQ(root->get("missing"), nullptr);
+
+    const auto *tags = root->get("tags");
+    EXPECT_EQ(tags->element_type, Tag::Type::Int);
+    EXPECT_EQ(tags->at(1)->integer, 2);
+    EXPECT_EQ(tags->at(2), nullptr);
+    EXPECT_EQ(root->get("extra")->get("damage")->integer, 7);
+
+    // every tag, name and payload came out of a single block
+    EXPECT_EQ(arena.getBlockCount(), 1);
+}
+
+TEST(NbtTreeTest, ArenaGivesLargePayloadsTheirOwnBlock)
+{
+    NbtArena arena{64};
+    auto *small = arena.allocate(16, 8);
+    auto *large = arena.allocate(256, 8);
+    auto *next = arena.allocate(16, 8);
+    EXPECT_EQ(static_cast<std::byte *>(next) - static_cast<std::byte *>(small), 16);
+    EXPECT_NE(large, nullptr);
+    EXPECT_EQ(arena.getBlockCount(), 2);
+
+    arena.reset();
+    EXPECT_EQ(arena.getBlockCount(), 1);
+    EXPECT_EQ(arena.allocate(16, 8), small);
+}
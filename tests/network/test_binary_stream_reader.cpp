@@ -0,0 +1,71 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "endstone/network/binary_stream_reader.h"
+
+using endstone::BinaryStreamReader;
+
+TEST(BinaryStreamReaderTest, ReadsVarInts)
+{
+    // 300, -2 as zigzag, uint64 max
+    std::string data{"\xAC\x02\x03\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\x01", 13};
+    BinaryStreamReader reader{data};
+    EXPECT_EQ(reader.readUnsignedVarInt(), 300);
+    EXPECT_EQ(reader.readVarInt(), -2);
+    EXPECT_EQ(reader.readUnsignedVarInt64(), UINT64_MAX);
+    EXPECT_FALSE(reader.hasOverflowed());
+    EXPECT_EQ(reader.getRemaining(), 0);
+}
+
+TEST(BinaryStreamReaderTest, ReadsFixedWidthValues)
+{
+    std::string data{"\x01\x34\x12\xFE\xFF\xFF\xFF\x00\x00\x80\x3F", 11};
+    BinaryStreamReader reader{data};
+    EXPECT_TRUE(reader.readBool());
+    EXPECT_EQ(reader.readUnsignedShort(), 0x1234);
+    EXPECT_EQ(reader.readInt(), -2);
+    EXPECT_FLOAT_EQ(reader.readFloat(), 1.0F);
+    EXPECT_FALSE(reader.hasOverflowed());
+}
+
+TEST(BinaryStreamReaderTest, ReadsStringsWithoutCopying)
+{
+    std::string data{"\x05hello"};
+    BinaryStreamReader reader{data};
+    auto value = reader.readString();
+    EXPECT_EQ(value, "hello");
+    EXPECT_EQ(value.data(), data.data() + 1);
+}
+
+TEST(BinaryStreamReaderTest, OverflowIsSticky)
+{
+    std::string data{"\x0A" "abc\x01"};
+    BinaryStreamReader reader{data};
+    EXPECT_TRUE(reader.readString().empty());
+    EXPECT_TRUE(reader.hasOverflowed());
+    EXPECT_EQ(reader.readByte(), 0);
+    EXPECT_EQ(reader.getPosition(), 1);
+}
+
+TEST(BinaryStreamReaderTest, RejectsOverlongVarInt)
+{
+    std::string data{"\x80\x80\x80\x80\x80\x01", 6};
+    BinaryStreamReader reader{data};
+    EXPECT_EQ(reader.readUnsignedVarInt(), 0);
+    EXPECT_TRUE(reader.hasOverflowed());
+}
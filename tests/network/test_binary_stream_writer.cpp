@@ -0,0 +1,74 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "endstone/network/binary_stream_reader.h"
+#include "endstone/network/binary_stream_writer.h"
+
+using endstone::BinaryStreamReader;
+using endstone::BinaryStreamWriter;
+
+TEST(BinaryStreamWriterTest, OverwritesFixedWidthValues)
+{
+    std::string data(11, '\0');
+    BinaryStreamWriter writer{data.data(), data.size()};
+    writer.writeBool(true);
+    writer.writeUnsignedShort(0x1234);
+    writer.writeInt(-2);
+    writer.writeFloat(1.0F);
+    EXPECT_FALSE(writer.hasOverflowed());
+    EXPECT_EQ(writer.getRemaining(), 0);
+    EXPECT_EQ(data, std::string("\x01\x34\x12\xFE\xFF\xFF\xFF\x00\x00\x80\x3F", 11));
+}
+
+TEST(BinaryStreamWriterTest, RewritesFieldFoundByReader)
+{
+    // A varint followed by a position
+    std::string data{"\xAC\x02", 2};
+    data.append(12, '\0');
+    BinaryStreamReader reader{data};
+    reader.readUnsignedVarInt();
+
+    BinaryStreamWriter writer{data.data(), data.size()};
+    writer.seek(reader.getPosition());
+    writer.writeVec3({1.0F, 2.0F, 3.0F});
+    EXPECT_FALSE(writer.hasOverflowed());
+
+    auto position = reader.readVec3();
+    EXPECT_FLOAT_EQ(position.getX(), 1.0F);
+    EXPECT_FLOAT_EQ(position.getY(), 2.0F);
+    EXPECT_FLOAT_EQ(position.getZ(), 3.0F);
+}
+
+TEST(BinaryStreamWriterTest, OverflowLeavesDataUntouched)
+{
+    std::string data{"abc"};
+    BinaryStreamWriter writer{data.data(), data.size()};
+    writer.writeInt(0);
+    EXPECT_TRUE(writer.hasOverflowed());
+    writer.writeByte(0);
+    EXPECT_EQ(data, "abc");
+
+    BinaryStreamWriter vector_writer{data.data(), data.size()};
+    vector_writer.writeVec3({});
+    EXPECT_TRUE(vector_writer.hasOverflowed());
+    EXPECT_EQ(data, "abc");
+
+    BinaryStreamWriter seek_writer{data.data(), data.size()};
+    seek_writer.seek(4);
+    EXPECT_TRUE(seek_writer.hasOverflowed());
+}
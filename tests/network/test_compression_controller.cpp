@@ -0,0 +1,71 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/network/compression_controller.h"
+
+namespace endstone::detail {
+
+TEST(CompressionControllerTest, KeepsTheThresholdWithoutTarget)
+{
+    CompressionController controller(64);
+    EXPECT_FALSE(controller.update(0, 1.0F));
+    EXPECT_EQ(controller.getThreshold(), 64);
+    EXPECT_FALSE(controller.isCompressible(63));
+    EXPECT_TRUE(controller.isCompressible(64));
+    EXPECT_EQ(CompressionController(1'000'000).getThreshold(), CompressionController::MaxThreshold);
+}
+
+TEST(CompressionControllerTest, RaisesTheThresholdWhileOverTheTarget)
+{
+    CompressionController controller(0, 0.8F);
+    EXPECT_TRUE(controller.isCompressible(1));
+    EXPECT_FALSE(controller.update(0, 0.5F));
+
+    EXPECT_TRUE(controller.update(1, 0.9F));
+    EXPECT_EQ(controller.getThreshold(), CompressionController::MinAdaptiveThreshold);
+    // Changes are spaced out so that each one shows in the usage first
+    EXPECT_FALSE(controller.update(2, 0.9F));
+
+    std::uint64_t tick = 1;
+    for (int i = 0; i < 10; i++) {
+        tick += CompressionController::AdjustInterval;
+        controller.update(tick, 0.9F);
+    }
+    EXPECT_EQ(controller.getThreshold(), CompressionController::MaxThreshold);
+}
+
+TEST(CompressionControllerTest, LowersTheThresholdOnceWellUnderTheTarget)
+{
+    CompressionController controller(16, 0.8F);
+    std::uint64_t tick = 0;
+    for (int i = 0; i < 2; i++) {
+        controller.update(tick, 0.9F);
+        tick += CompressionController::AdjustInterval;
+    }
+    ASSERT_EQ(controller.getThreshold(), 512);
+
+    // Within the hysteresis, the threshold stays
+    EXPECT_FALSE(controller.update(tick, 0.75F));
+    EXPECT_TRUE(controller.update(tick, 0.5F));
+    EXPECT_EQ(controller.getThreshold(), 256);
+    tick += CompressionController::AdjustInterval;
+    EXPECT_TRUE(controller.update(tick, 0.5F));
+    EXPECT_EQ(controller.getThreshold(), 16);
+    tick += CompressionController::AdjustInterval;
+    EXPECT_FALSE(controller.update(tick, 0.5F));
+}
+
+}  // namespace endstone::detail
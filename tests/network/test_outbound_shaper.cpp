@@ -0,0 +1,97 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/network/outbound_shaper.h"
+
+using endstone::PacketPriority;
+using endstone::detail::OutboundShaper;
+using namespace std::chrono_literals;
+
+class OutboundShaperTest : public ::testing::Test {
+protected:
+    OutboundShaper::Sender packet(std::string name, std::size_t size = 100)
+    {
+        return [this, name = std::move(name), size]() {
+            sent_.push_back(name);
+            return size;
+        };
+    }
+
+    OutboundShaper shaper_;
+    OutboundShaper::Clock::time_point start_ = OutboundShaper::Clock::now();
+    std::vector<std::string> sent_;
+};
+
+TEST_F(OutboundShaperTest, SendsRightAwayWithoutLimit)
+{
+    shaper_.submit(PacketPriority::Normal, packet("normal"));
+    shaper_.submit(PacketPriority::Bulk, packet("bulk"));
+    EXPECT_EQ(sent_, (std::vector<std::string>{"normal", "bulk"}));
+    EXPECT_FALSE(shaper_.hasQueued());
+}
+
+TEST_F(OutboundShaperTest, HoldsBackOverLimit)
+{
+    shaper_.setRate(1000, start_);
+    shaper_.submit(PacketPriority::Normal, packet("a", 1500));
+    shaper_.submit(PacketPriority::Normal, packet("b"));
+    shaper_.submit(PacketPriority::Bulk, packet("c"));
+    shaper_.submit(PacketPriority::Critical, packet("critical"));
+    EXPECT_EQ(sent_, (std::vector<std::string>{"a", "critical"}));
+    EXPECT_EQ(shaper_.getQueuedCount(), 2);
+    EXPECT_TRUE(shaper_.canSend(PacketPriority::Critical));
+    EXPECT_FALSE(shaper_.canSend(PacketPriority::Normal));
+
+    // Still 100 bytes in debt after half a second
+    shaper_.tick(start_ + 500ms);
+    EXPECT_EQ(sent_.size(), 2);
+
+    shaper_.tick(start_ + 1s);
+    EXPECT_EQ(sent_, (std::vector<std::string>{"a", "critical", "b", "c"}));
+    EXPECT_FALSE(shaper_.hasQueued());
+}
+
+TEST_F(OutboundShaperTest, HoldsBackBulkWhileCongested)
+{
+    shaper_.setSendQueueSize(OutboundShaper::DeepSendQueue);
+    shaper_.submit(PacketPriority::Bulk, packet("bulk"));
+    shaper_.submit(PacketPriority::Normal, packet("normal"));
+    EXPECT_EQ(sent_, (std::vector<std::string>{"normal"}));
+
+    shaper_.tick(start_);
+    EXPECT_EQ(sent_.size(), 1);
+    shaper_.setSendQueueSize(0);
+    shaper_.tick(start_);
+    EXPECT_EQ(sent_, (std::vector<std::string>{"normal", "bulk"}));
+}
+
+TEST_F(OutboundShaperTest, QueueIsBounded)
+{
+    shaper_.setSendQueueSize(OutboundShaper::DeepSendQueue);
+    for (std::size_t i = 0; i <= OutboundShaper::MaxQueuedPackets; ++i) {
+        shaper_.submit(PacketPriority::Bulk, packet(std::to_string(i)));
+    }
+    EXPECT_EQ(sent_, (std::vector<std::string>{"0"}));
+    EXPECT_EQ(shaper_.getQueuedCount(), OutboundShaper::MaxQueuedPackets);
+
+    shaper_.flush();
+    EXPECT_EQ(sent_.size(), OutboundShaper::MaxQueuedPackets + 1);
+    EXPECT_FALSE(shaper_.hasQueued());
+}
@@ -0,0 +1,99 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "endstone/detail/network/packet_interceptor.h"
+#include "endstone/plugin/plugin.h"
+
+using endstone::BinaryStreamReader;
+using endstone::BinaryStreamWriter;
+using endstone::detail::EndstonePacketInterceptor;
+
+namespace {
+class MockPlugin : public endstone::Plugin {
+public:
+    MOCK_METHOD(const endstone::PluginDescription &, getDescription, (), (const, override));
+};
+}  // namespace
+
+TEST(PacketInterceptorTest, IgnoresIdsWithoutHandlers)
+{
+    EndstonePacketInterceptor interceptor;
+    std::string data{"abc"};
+    EXPECT_FALSE(interceptor.hasHandlers(1));
+    EXPECT_TRUE(interceptor.intercept(1, 0, data.data(), data.size()));
+    EXPECT_TRUE(interceptor.intercept(-1, 0, data.data(), data.size()));
+    EXPECT_TRUE(interceptor.intercept(4096, 0, data.data(), data.size()));
+}
+
+TEST(PacketInterceptorTest, RewritesInPlaceAndDrops)
+{
+    EndstonePacketInterceptor interceptor;
+    MockPlugin plugin;
+    int calls = 0;
+    interceptor.addHandler(plugin, 9, [&](int sub_client_id, BinaryStreamReader &reader, BinaryStreamWriter &writer) {
+        ++calls;
+        EXPECT_EQ(sub_client_id, 2);
+        EXPECT_EQ(reader.readByte(), 'a');
+        writer.writeByte('x');
+        return true;
+    });
+    interceptor.addHandler(plugin, 9, [](int, BinaryStreamReader &reader, BinaryStreamWriter &) {
+        // Sees the changes of the handler before it
+        return reader.readByte() != 'x';
+    });
+
+    std::string data{"abc"};
+    EXPECT_FALSE(interceptor.intercept(9, 2, data.data(), data.size()));
+    EXPECT_EQ(data, "xbc");
+    EXPECT_EQ(calls, 1);
+    EXPECT_TRUE(interceptor.intercept(10, 2, data.data(), data.size()));
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(PacketInterceptorTest, RemovesHandlersOfPlugin)
+{
+    EndstonePacketInterceptor interceptor;
+    MockPlugin first;
+    MockPlugin second;
+    auto drop = [](int, BinaryStreamReader &, BinaryStreamWriter &) { return false; };
+    interceptor.addHandler(first, 1, drop);
+    interceptor.addHandler(first, 2, drop);
+    interceptor.addHandler(second, 2, drop);
+
+    interceptor.removeHandlers(first, 1);
+    EXPECT_FALSE(interceptor.hasHandlers(1));
+    EXPECT_TRUE(interceptor.hasHandlers(2));
+
+    interceptor.unregister(second);
+    EXPECT_TRUE(interceptor.hasHandlers(2));
+    interceptor.unregister(first);
+    EXPECT_FALSE(interceptor.hasHandlers(2));
+
+    std::string data{"abc"};
+    EXPECT_TRUE(interceptor.intercept(2, 0, data.data(), data.size()));
+}
+
+TEST(PacketInterceptorTest, RejectsInvalidHandlers)
+{
+    EndstonePacketInterceptor interceptor;
+    MockPlugin plugin;
+    auto keep = [](int, BinaryStreamReader &, BinaryStreamWriter &) { return true; };
+    EXPECT_THROW(interceptor.addHandler(plugin, 1024, keep), std::invalid_argument);
+    EXPECT_THROW(interceptor.addHandler(plugin, 1, nullptr), std::invalid_argument);
+}
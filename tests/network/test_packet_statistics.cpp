@@ -0,0 +1,58 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/network/packet_statistics.h"
+
+using endstone::detail::PacketStatistics;
+
+TEST(PacketStatisticsTest, OrdersByBytesReceived)
+{
+    PacketStatistics statistics;
+    statistics.recordReceived(144, 40);
+    statistics.recordReceived(144, 40);
+    statistics.recordReceived(30, 500);
+    statistics.recordReceived(1, 10);
+
+    auto entries = statistics.getReceived();
+    ASSERT_EQ(entries.size(), 3);
+    EXPECT_EQ(entries[0].packet_id, 30);
+    EXPECT_EQ(entries[1].packet_id, 144);
+    EXPECT_EQ(entries[1].count, 2);
+    EXPECT_EQ(entries[1].bytes, 80);
+    EXPECT_EQ(entries[2].packet_id, 1);
+}
+
+TEST(PacketStatisticsTest, AveragesSentSizes)
+{
+    PacketStatistics statistics;
+    EXPECT_FALSE(statistics.getAverageSentSize(9).has_value());
+    statistics.recordSent(9, 30, true);
+    statistics.recordSent(9, 50, false);
+    EXPECT_EQ(statistics.getAverageSentSize(9), 40);
+    EXPECT_EQ(statistics.getUncompressedCount(), 1);
+    EXPECT_TRUE(statistics.getReceived().empty());
+}
+
+TEST(PacketStatisticsTest, Reset)
+{
+    PacketStatistics statistics;
+    statistics.recordReceived(144, 40);
+    statistics.recordSent(9, 30, false);
+    statistics.reset();
+    EXPECT_TRUE(statistics.getReceived().empty());
+    EXPECT_FALSE(statistics.getAverageSentSize(9).has_value());
+    EXPECT_EQ(statistics.getUncompressedCount(), 0);
+}
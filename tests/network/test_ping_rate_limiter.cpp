@@ -0,0 +1,72 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/network/ping_rate_limiter.h"
+
+namespace endstone::detail {
+
+class PingRateLimiterTest : public ::testing::Test {
+protected:
+    PingRateLimiter limiter_;
+    PingRateLimiter::Clock::time_point now_ = PingRateLimiter::Clock::now();
+    PingRateLimiter::Source source_{0, 0xFFFF0A000001};
+};
+
+TEST_F(PingRateLimiterTest, DropsAfterBurst)
+{
+    limiter_.setLimit(2, 5);
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_TRUE(limiter_.tryAcquire(source_, now_));
+    }
+    ASSERT_FALSE(limiter_.tryAcquire(source_, now_));
+    ASSERT_EQ(limiter_.getServedCount(), 5);
+    ASSERT_EQ(limiter_.getDroppedCount(), 1);
+
+    // Other sources have their own counters
+    ASSERT_TRUE(limiter_.tryAcquire({0, 0xFFFF0A000002}, now_));
+}
+
+TEST_F(PingRateLimiterTest, CounterDecaysOverTime)
+{
+    limiter_.setLimit(2, 5);
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_TRUE(limiter_.tryAcquire(source_, now_));
+    }
+    ASSERT_FALSE(limiter_.tryAcquire(source_, now_ + std::chrono::milliseconds(400)));
+    ASSERT_TRUE(limiter_.tryAcquire(source_, now_ + std::chrono::milliseconds(500)));
+    ASSERT_FALSE(limiter_.tryAcquire(source_, now_ + std::chrono::milliseconds(500)));
+
+    // Dropped pings do not count, so a source sending at the rate is served again right away
+    ASSERT_TRUE(limiter_.tryAcquire(source_, now_ + std::chrono::milliseconds(1000)));
+}
+
+TEST_F(PingRateLimiterTest, QuietSourcesGiveUpSlots)
+{
+    limiter_.setLimit(1, 1);
+    for (std::uint64_t i = 0; i < 100000; ++i) {
+        ASSERT_TRUE(limiter_.tryAcquire({i, i}, now_ + std::chrono::milliseconds(i)));
+    }
+    // A flooding source stays limited while other sources come and go
+    ASSERT_TRUE(limiter_.tryAcquire(source_, now_ + std::chrono::seconds(200)));
+    for (std::uint64_t i = 0; i < 1000; ++i) {
+        limiter_.tryAcquire({i, i}, now_ + std::chrono::seconds(200));
+    }
+    ASSERT_FALSE(limiter_.tryAcquire(source_, now_ + std::chrono::seconds(200)));
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,112 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/persistence/player_data_log.h"
+
+namespace endstone::detail {
+
+class PlayerDataLogTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        const auto *test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+        dir_ = std::filesystem::temp_directory_path() / ("endstone_player_data_log_" + std::string(test_info->name()));
+        std::filesystem::remove_all(dir_);
+        path_ = dir_ / "player_data.log";
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(dir_);
+    }
+
+    std::filesystem::path dir_;
+    std::filesystem::path path_;
+};
+
+TEST_F(PlayerDataLogTest, ReplaysWritesAndTombstones)
+{
+    {
+        PlayerDataLog log(path_);
+        EXPECT_TRUE(log.open().empty());
+        log.append({{"a", "1"}, {"b", std::string("\0binary", 7)}});
+        log.append({{"a", "2"}, {"b", std::nullopt}, {"c", ""}});
+    }
+
+    PlayerDataLog log(path_);
+    auto entries = log.open();
+    EXPECT_EQ(entries, (PlayerDataLog::Entries{{"a", "2"}, {"c", ""}}));
+    EXPECT_EQ(log.getSize(), std::filesystem::file_size(path_));
+}
+
+TEST_F(PlayerDataLogTest, DropsTornRecords)
+{
+    {
+        PlayerDataLog log(path_);
+        log.open();
+        log.append({{"kept", "value"}});
+        log.append({{"torn", "value"}});
+    }
+    auto intact = std::filesystem::file_size(path_);
+    std::filesystem::resize_file(path_, intact - 3);
+
+    {
+        PlayerDataLog log(path_);
+        EXPECT_EQ(log.open(), (PlayerDataLog::Entries{{"kept", "value"}}));
+        log.append({{"after", "crash"}});
+    }
+
+    PlayerDataLog log(path_);
+    EXPECT_EQ(log.open(), (PlayerDataLog::Entries{{"after", "crash"}, {"kept", "value"}}));
+}
+
+TEST_F(PlayerDataLogTest, RejectsOtherFiles)
+{
+    std::filesystem::create_directories(dir_);
+    std::ofstream(path_) << "not a log";
+    PlayerDataLog log(path_);
+    EXPECT_THROW(log.open(), std::runtime_error);
+}
+
+TEST_F(PlayerDataLogTest, CompactionKeepsLiveEntries)
+{
+    PlayerDataLog log(path_);
+    log.open();
+    std::string value(1024, 'x');
+    while (!log.shouldCompact()) {
+        log.append({{"hot", value}, {"gone", value}, {"gone", std::nullopt}});
+    }
+    log.append({{"cold", "1"}});
+
+    auto before = log.getSize();
+    log.compact();
+    EXPECT_LT(log.getSize(), before / 100);
+    EXPECT_EQ(log.getSize(), std::filesystem::file_size(path_));
+    EXPECT_FALSE(log.shouldCompact());
+    log.append({{"new", "2"}});
+
+    PlayerDataLog reopened(path_);
+    EXPECT_EQ(reopened.open(), (PlayerDataLog::Entries{{"cold", "1"}, {"hot", value}, {"new", "2"}}));
+    EXPECT_EQ(reopened.getLiveSize(), log.getLiveSize());
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,131 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/logger_factory.h"
+#include "endstone/detail/persistence/player_data_store.h"
+#include "endstone/plugin/plugin.h"
+
+namespace endstone::detail {
+
+class TestPlugin : public Plugin {
+public:
+    explicit TestPlugin(std::string name) : description_(std::move(name), "1.0.0") {}
+
+    [[nodiscard]] const PluginDescription &getDescription() const override
+    {
+        return description_;
+    }
+
+private:
+    PluginDescription description_;
+};
+
+class PlayerDataStoreTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        const auto *test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+        dir_ = std::filesystem::temp_directory_path() / ("endstone_player_data_store_" + std::string(test_info->name()));
+        std::filesystem::remove_all(dir_);
+        path_ = dir_ / "player_data.log";
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(dir_);
+    }
+
+    std::unique_ptr<EndstonePlayerDataStore> open()
+    {
+        return std::make_unique<EndstonePlayerDataStore>(executor_, LoggerFactory::getLogger("Test"), path_);
+    }
+
+    ThreadPoolExecutor executor_{1};
+    std::filesystem::path dir_;
+    std::filesystem::path path_;
+    TestPlugin first_{"first"};
+    TestPlugin second_{"second"};
+    UUID player_{{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}};
+};
+
+TEST_F(PlayerDataStoreTest, KeepsPluginsApart)
+{
+    auto store = open();
+    store->set(first_, player_, "coins", "10");
+    store->set(first_, player_, "level", "2");
+    store->set(second_, player_, "coins", "99");
+
+    EXPECT_EQ(store->get(first_, player_, "coins"), "10");
+    EXPECT_EQ(store->get(second_, player_, "coins"), "99");
+    EXPECT_EQ(store->getKeys(first_, player_), (std::vector<std::string>{"coins", "level"}));
+    EXPECT_EQ(store->getKeys(second_, player_), (std::vector<std::string>{"coins"}));
+
+    EXPECT_TRUE(store->remove(second_, player_, "coins"));
+    EXPECT_FALSE(store->remove(second_, player_, "coins"));
+    EXPECT_FALSE(store->get(second_, player_, "coins").has_value());
+    EXPECT_TRUE(store->getKeys(second_, player_).empty());
+}
+
+TEST_F(PlayerDataStoreTest, BatchesWritesUntilClosed)
+{
+    auto store = open();
+    store->set(first_, player_, "coins", "10");
+    store->tick(1);
+    EXPECT_EQ(store->getPendingCount(), 1);
+
+    store->tick(EndstonePlayerDataStore::FlushIntervalTicks);
+    EXPECT_EQ(store->getPendingCount(), 0);
+
+    store->set(first_, player_, "coins", "20");
+    store->set(first_, player_, "level", "2");
+    store->remove(first_, player_, "level");
+    store->close();
+    store.reset();
+
+    store = open();
+    EXPECT_EQ(store->get(first_, player_, "coins"), "20");
+    EXPECT_EQ(store->getKeys(first_, player_), (std::vector<std::string>{"coins"}));
+}
+
+TEST_F(PlayerDataStoreTest, ReplacesTheEntriesOfOnePlayer)
+{
+    UUID other{{16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1}};
+    auto store = open();
+    store->set(first_, player_, "coins", "10");
+    store->set(second_, player_, "level", "2");
+    store->set(first_, other, "coins", "5");
+
+    auto entries = store->getPlayerEntries(player_);
+    ASSERT_EQ(entries.size(), 2);
+    EXPECT_EQ(entries[0].plugin, "first");
+    EXPECT_EQ(entries[0].key, "coins");
+    EXPECT_EQ(entries[0].value, "10");
+    EXPECT_EQ(entries[1].plugin, "second");
+
+    store->replacePlayerEntries(player_, {{"first", "coins", "30"}, {"third", "rank", "gold"}});
+    EXPECT_EQ(store->get(first_, player_, "coins"), "30");
+    EXPECT_FALSE(store->get(second_, player_, "level").has_value());
+    EXPECT_EQ(store->get(first_, other, "coins"), "5");
+    EXPECT_EQ(store->getPlayerEntries(player_).size(), 2);
+}
+
+}  // namespace endstone::detail
@@ -38,7 +38,8 @@ public:
     MOCK_METHOD(bool, dispatchCommand, (endstone::CommandSender &, std::string), (const, override));
     MOCK_METHOD(endstone::Scheduler &, getScheduler, (), (const, override));
     MOCK_METHOD(endstone::Level *, getLevel, (), (const, override));
-    MOCK_METHOD(std::vector<endstone::Player *>, getOnlinePlayers, (), (const, override));
+    MOCK_METHOD(int, getBlockTypeId, (std::string_view type), (const, override));
+    MOCK_METHOD(const std::vector<endstone::Player *> &, getOnlinePlayers, (), (const, override));
     MOCK_METHOD(int, getMaxPlayers, (), (const, override));
     MOCK_METHOD(void, setMaxPlayers, (int), (override));
     MOCK_METHOD(endstone::Player *, getPlayer, (endstone::UUID), (const, override));
@@ -48,6 +49,10 @@ public:
     MOCK_METHOD(void, reloadData, (), (override));
     MOCK_METHOD(void, broadcast, (const std::string &, const std::string &), (const, override));
     MOCK_METHOD(void, broadcastMessage, (const std::string &), (const, override));
+    MOCK_METHOD(void, broadcastPacket, (endstone::Packet &, const std::vector<endstone::Player *> &),
+                (const, override));
+    MOCK_METHOD(void, broadcastPacket, (endstone::Packet &, const std::function<bool(const endstone::Player &)> &),
+                (const, override));
     MOCK_METHOD(bool, isPrimaryThread, (), (const, override));
     MOCK_METHOD(endstone::Scoreboard *, getScoreboard, (), (const, override));
     MOCK_METHOD(std::shared_ptr<endstone::Scoreboard>, getNewScoreboard, (), (override));
@@ -57,7 +62,25 @@ public:
     MOCK_METHOD(float, getAverageTicksPerSecond, (), (override));
     MOCK_METHOD(float, getCurrentTickUsage, (), (override));
     MOCK_METHOD(float, getAverageTickUsage, (), (override));
+    MOCK_METHOD(endstone::TickStatistics, getTickStatistics, (endstone::TickWindow), (const, override));
+    MOCK_METHOD(std::uint64_t, getWallClockTick, (), (const, override));
     MOCK_METHOD(std::chrono::system_clock::time_point, getStartTime, (), (override));
+    MOCK_METHOD(void, setTickConsistentActorReads, (bool), (override));
+    MOCK_METHOD(bool, isTickConsistentActorReads, (), (const, override));
+    MOCK_METHOD(void, setPlayerMoveThresholds, (float, float), (override));
+    MOCK_METHOD(float, getPlayerMoveDistanceThreshold, (), (const, override));
+    MOCK_METHOD(float, getPlayerMoveRotationThreshold, (), (const, override));
+    MOCK_METHOD(endstone::PlayerDataStore &, getPlayerDataStore, (), (const, override));
+    MOCK_METHOD(endstone::Messenger &, getMessenger, (), (const, override));
+    MOCK_METHOD(endstone::PacketInterceptor &, getPacketInterceptor, (), (const, override));
+    MOCK_METHOD(endstone::PacketPriority, getPacketPriority, (int), (const, override));
+    MOCK_METHOD(void, setPacketPriority, (int, endstone::PacketPriority), (override));
+    MOCK_METHOD(endstone::Player *, getPlayerByXuid, (const std::string &), (const, override));
+    MOCK_METHOD(endstone::Player *, getPlayerByRuntimeId, (std::uint64_t), (const, override));
+    MOCK_METHOD(std::vector<endstone::Player *>, getMovementAnomalies, (float, float), (const, override));
+    MOCK_METHOD(std::string, translate, (const endstone::Translatable &, const std::string &), (const, override));
+    MOCK_METHOD(void, sendTranslated, (const endstone::Translatable &, const std::vector<endstone::Player *> &),
+                (const, override));
     MOCK_METHOD(std::unique_ptr<endstone::BossBar>, createBossBar,
                 (std::string, endstone::BarColor, endstone::BarStyle), (const, override));
     MOCK_METHOD(std::unique_ptr<endstone::BossBar>, createBossBar,
@@ -0,0 +1,113 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "endstone/detail/plugin/plugin_dependency_graph.h"
+
+using endstone::PluginDescription;
+using endstone::detail::PluginDependencyGraph;
+using testing::ElementsAre;
+using testing::IsEmpty;
+
+namespace {
+
+PluginDescription describe(std::string name, std::vector<std::string> depend = {},
+                           std::vector<std::string> soft_depend = {}, std::vector<std::string> load_before = {},
+                           std::vector<std::string> provides = {})
+{
+    return {std::move(name),
+            "1.0.0",
+            "",
+            endstone::PluginLoadOrder::PostWorld,
+            {},
+            {},
+            "",
+            "",
+            std::move(provides),
+            std::move(depend),
+            std::move(soft_depend),
+            std::move(load_before)};
+}
+
+std::vector<const PluginDescription *> pointers(const std::vector<PluginDescription> &descriptions)
+{
+    std::vector<const PluginDescription *> result;
+    for (const auto &description : descriptions) {
+        result.push_back(&description);
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(PluginDependencyGraphTest, KeepsOrderWithoutDependencies)
+{
+    std::vector<PluginDescription> plugins{describe("a"), describe("b"), describe("c")};
+    PluginDependencyGraph graph{pointers(plugins), {}};
+    EXPECT_THAT(graph.getOrder(), ElementsAre(0, 1, 2));
+    EXPECT_THAT(graph.getRejections(), IsEmpty());
+}
+
+TEST(PluginDependencyGraphTest, OrdersDependenciesFirst)
+{
+    std::vector<PluginDescription> plugins{describe("a", {"b"}), describe("b", {}, {"c"}), describe("c"),
+                                           describe("d", {}, {}, {"c"})};
+    PluginDependencyGraph graph{pointers(plugins), {}};
+    EXPECT_THAT(graph.getOrder(), ElementsAre(3, 2, 1, 0));
+    EXPECT_THAT(graph.getRejections(), IsEmpty());
+}
+
+TEST(PluginDependencyGraphTest, ResolvesProvidedAndLoadedNames)
+{
+    std::vector<PluginDescription> plugins{describe("a", {"api", "economy"}), describe("b", {}, {}, {}, {"api"})};
+    PluginDependencyGraph graph{pointers(plugins), {"economy"}};
+    EXPECT_THAT(graph.getOrder(), ElementsAre(1, 0));
+    EXPECT_THAT(graph.getRejections(), IsEmpty());
+}
+
+TEST(PluginDependencyGraphTest, RejectsMissingDependencyAndDependents)
+{
+    std::vector<PluginDescription> plugins{describe("a", {"missing"}), describe("b", {"a"}), describe("c")};
+    PluginDependencyGraph graph{pointers(plugins), {}};
+    EXPECT_THAT(graph.getOrder(), ElementsAre(2));
+    ASSERT_EQ(graph.getRejections().size(), 2);
+    EXPECT_EQ(graph.getRejections()[0].index, 0);
+    EXPECT_EQ(graph.getRejections()[0].reason, "Unknown dependency 'missing'.");
+    EXPECT_EQ(graph.getRejections()[1].index, 1);
+    EXPECT_EQ(graph.getRejections()[1].reason, "Dependency 'a' could not be loaded.");
+}
+
+TEST(PluginDependencyGraphTest, RejectsHardCycle)
+{
+    std::vector<PluginDescription> plugins{describe("a", {"b"}), describe("b", {"a"}), describe("c", {"a"}),
+                                           describe("d")};
+    PluginDependencyGraph graph{pointers(plugins), {}};
+    EXPECT_THAT(graph.getOrder(), ElementsAre(3));
+    ASSERT_EQ(graph.getRejections().size(), 3);
+    EXPECT_EQ(graph.getRejections()[0].reason, "Circular dependency detected.");
+}
+
+TEST(PluginDependencyGraphTest, BreaksSoftCycle)
+{
+    std::vector<PluginDescription> plugins{describe("a", {}, {"b"}), describe("b", {"a"})};
+    PluginDependencyGraph graph{pointers(plugins), {}};
+    EXPECT_THAT(graph.getOrder(), ElementsAre(0, 1));
+    EXPECT_THAT(graph.getRejections(), IsEmpty());
+}
@@ -0,0 +1,540 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "endstone/boss/boss_bar.h"
+#include "endstone/detail/logger_factory.h"
+#include "endstone/detail/plugin/plugin_manager.h"
+#include "endstone/event/server/broadcast_message_event.h"
+#include "endstone/event/server/server_load_event.h"
+
+class MockServer : public endstone::Server {
+public:
+    MOCK_METHOD(std::string, getName, (), (const, override));
+    MOCK_METHOD(std::string, getVersion, (), (const, override));
+    MOCK_METHOD(std::string, getMinecraftVersion, (), (const, override));
+    MOCK_METHOD(endstone::Logger &, getLogger, (), (const, override));
+    MOCK_METHOD(endstone::PluginManager &, getPluginManager, (), (const, override));
+    MOCK_METHOD(endstone::PluginCommand *, getPluginCommand, (std::string), (const, override));
+    MOCK_METHOD(endstone::ConsoleCommandSender &, getCommandSender, (), (const, override));
+    MOCK_METHOD(bool, dispatchCommand, (endstone::CommandSender &, std::string), (const, override));
+    MOCK_METHOD(endstone::Scheduler &, getScheduler, (), (const, override));
+    MOCK_METHOD(endstone::Level *, getLevel, (), (const, override));
+    MOCK_METHOD(int, getBlockTypeId, (std::string_view type), (const, override));
+    MOCK_METHOD(const std::vector<endstone::Player *> &, getOnlinePlayers, (), (const, override));
+    MOCK_METHOD(int, getMaxPlayers, (), (const, override));
+    MOCK_METHOD(void, setMaxPlayers, (int), (override));
+    MOCK_METHOD(endstone::Player *, getPlayer, (endstone::UUID), (const, override));
+    MOCK_METHOD(endstone::Player *, getPlayer, (std::string), (const, override));
+    MOCK_METHOD(void, shutdown, (), (override));
+    MOCK_METHOD(void, reload, (), (override));
+    MOCK_METHOD(void, reloadData, (), (override));
+    MOCK_METHOD(void, broadcast, (const std::string &, const std::string &), (const, override));
+    MOCK_METHOD(void, broadcastMessage, (const std::string &), (const, override));
+    MOCK_METHOD(void, broadcastPacket, (endstone::Packet &, const std::vector<endstone::Player *> &),
+                (const, override));
+    MOCK_METHOD(void, broadcastPacket, (endstone::Packet &, const std::function<bool(const endstone::Player &)> &),
+                (const, override));
+    MOCK_METHOD(bool, isPrimaryThread, (), (const, override));
+    MOCK_METHOD(endstone::Scoreboard *, getScoreboard, (), (const, override));
+    MOCK_METHOD(std::shared_ptr<endstone::Scoreboard>, getNewScoreboard, (), (override));
+    MOCK_METHOD(float, getCurrentMillisecondsPerTick, (), (override));
+    MOCK_METHOD(float, getAverageMillisecondsPerTick, (), (override));
+    MOCK_METHOD(float, getCurrentTicksPerSecond, (), (override));
+    MOCK_METHOD(float, getAverageTicksPerSecond, (), (override));
+    MOCK_METHOD(float, getCurrentTickUsage, (), (override));
+    MOCK_METHOD(float, getAverageTickUsage, (), (override));
+    MOCK_METHOD(endstone::TickStatistics, getTickStatistics, (endstone::TickWindow), (const, override));
+    MOCK_METHOD(std::uint64_t, getWallClockTick, (), (const, override));
+    MOCK_METHOD(std::chrono::system_clock::time_point, getStartTime, (), (override));
+    MOCK_METHOD(void, setTickConsistentActorReads, (bool), (override));
+    MOCK_METHOD(bool, isTickConsistentActorReads, (), (const, override));
+    MOCK_METHOD(void, setPlayerMoveThresholds, (float, float), (override));
+    MOCK_METHOD(float, getPlayerMoveDistanceThreshold, (), (const, override));
+    MOCK_METHOD(float, getPlayerMoveRotationThreshold, (), (const, override));
+    MOCK_METHOD(endstone::PlayerDataStore &, getPlayerDataStore, (), (const, override));
+    MOCK_METHOD(endstone::Messenger &, getMessenger, (), (const, override));
+    MOCK_METHOD(endstone::PacketInterceptor &, getPacketInterceptor, (), (const, override));
+    MOCK_METHOD(endstone::PacketPriority, getPacketPriority, (int), (const, override));
+    MOCK_METHOD(void, setPacketPriority, (int, endstone::PacketPriority), (override));
+    MOCK_METHOD(endstone::Player *, getPlayerByXuid, (const std::string &), (const, override));
+    MOCK_METHOD(endstone::Player *, getPlayerByRuntimeId, (std::uint64_t), (const, override));
+    MOCK_METHOD(std::vector<endstone::Player *>, getMovementAnomalies, (float, float), (const, override));
+    MOCK_METHOD(std::string, translate, (const endstone::Translatable &, const std::string &), (const, override));
+    MOCK_METHOD(void, sendTranslated, (const endstone::Translatable &, const std::vector<endstone::Player *> &),
+                (const, override));
+    MOCK_METHOD(std::unique_ptr<endstone::BossBar>, createBossBar,
+                (std::string, endstone::BarColor, endstone::BarStyle), (const, override));
+    MOCK_METHOD(std::unique_ptr<endstone::BossBar>, createBossBar,
+                (std::string, endstone::BarColor, endstone::BarStyle, std::vector<endstone::BarFlag>),
+                (const, override));
+    MockServer()
+    {
+        ON_CALL(*this, getLogger())
+            .WillByDefault(testing::ReturnRef(endstone::detail::LoggerFactory::getLogger("Test")));
+        ON_CALL(*this, isPrimaryThread()).WillByDefault(testing::Return(true));
+    }
+};
+
+class MockPlugin : public endstone::Plugin {
+public:
+    MOCK_METHOD(const endstone::PluginDescription &, getDescription, (), (const, override));
+    MockPlugin()
+    {
+        setEnabled(true);
+    }
+};
+
+class MockPermissible : public endstone::Permissible {
+public:
+    MOCK_METHOD(bool, isOp, (), (const, override));
+    MOCK_METHOD(void, setOp, (bool), (override));
+    MOCK_METHOD(bool, isPermissionSet, (std::string), (const, override));
+    MOCK_METHOD(bool, isPermissionSet, (const endstone::Permission &), (const, override));
+    MOCK_METHOD(bool, hasPermission, (std::string), (const, override));
+    MOCK_METHOD(bool, hasPermission, (const endstone::Permission &), (const, override));
+    MOCK_METHOD(endstone::PermissionAttachment *, addAttachment, (endstone::Plugin &, const std::string &, bool),
+                (override));
+    MOCK_METHOD(endstone::PermissionAttachment *, addAttachment, (endstone::Plugin &), (override));
+    MOCK_METHOD(bool, removeAttachment, (endstone::PermissionAttachment &), (override));
+    MOCK_METHOD(void, recalculatePermissions, (), (override));
+    MOCK_METHOD(std::unordered_set<endstone::PermissionAttachmentInfo *>, getEffectivePermissions, (),
+                (const, override));
+    MOCK_METHOD(endstone::CommandSender *, asCommandSender, (), (const, override));
+};
+
+class CustomEvent : public endstone::Event {
+public:
+    inline static const std::string NAME = "CustomEvent";
+    [[nodiscard]] std::string getEventName() const override
+    {
+        return NAME;
+    }
+
+    [[nodiscard]] bool isCancellable() const override
+    {
+        return true;
+    }
+};
+
+// Derives from an ENDSTONE_EVENT class without declaring itself with the macro
+class CustomLoadEvent : public endstone::ServerLoadEvent {
+public:
+    inline static const std::string NAME = "CustomLoadEvent";
+    CustomLoadEvent() : ServerLoadEvent(LoadType::Startup) {}
+    [[nodiscard]] std::string getEventName() const override
+    {
+        return NAME;
+    }
+};
+
+class PluginManagerTest : public ::testing::Test {
+protected:
+    // Set Up
+    void SetUp() override
+    {
+        server_ = std::make_unique<testing::NiceMock<MockServer>>();
+        plugin_ = std::make_unique<MockPlugin>();
+        plugin_manager_ = std::make_unique<endstone::detail::EndstonePluginManager>(*server_);
+    }
+
+    // Tear Down
+    void TearDown() override
+    {
+        plugin_manager_.reset();
+        plugin_.reset();
+        server_.reset();
+    }
+
+    std::unique_ptr<testing::NiceMock<MockServer>> server_;
+    std::unique_ptr<MockPlugin> plugin_;
+    std::unique_ptr<endstone::detail::EndstonePluginManager> plugin_manager_;
+    endstone::PluginDescription description_{"test_plugin", "1.0.0"};
+};
+
+// Test calling an event that nobody listens to
+TEST_F(PluginManagerTest, CallEventWithoutHandlers)
+{
+    endstone::ServerLoadEvent event{endstone::ServerLoadEvent::LoadType::Startup};
+    plugin_manager_->callEvent(event);
+    plugin_manager_->callEvent(event);
+}
+
+// Test that handlers are only called for the event type they are registered to
+TEST_F(PluginManagerTest, CallEventDispatchesByType)
+{
+    int load_count = 0;
+    int custom_count = 0;
+    plugin_manager_->registerEvent(
+        endstone::ServerLoadEvent::NAME, [&](endstone::Event &) { ++load_count; }, endstone::EventPriority::Normal,
+        *plugin_, false);
+    plugin_manager_->registerEvent(
+        CustomEvent::NAME, [&](endstone::Event &) { ++custom_count; }, endstone::EventPriority::Normal, *plugin_,
+        false);
+
+    endstone::ServerLoadEvent load_event{endstone::ServerLoadEvent::LoadType::Startup};
+    plugin_manager_->callEvent(load_event);
+    plugin_manager_->callEvent(load_event);
+    EXPECT_EQ(load_count, 2);
+    EXPECT_EQ(custom_count, 0);
+
+    CustomEvent custom_event;
+    plugin_manager_->callEvent(custom_event);
+    EXPECT_EQ(load_count, 2);
+    EXPECT_EQ(custom_count, 1);
+}
+
+// Test that a subclass of an ENDSTONE_EVENT class does not reach the handlers of its parent
+TEST_F(PluginManagerTest, CallEventDispatchesSubclassByName)
+{
+    int load_count = 0;
+    int custom_count = 0;
+    plugin_manager_->registerEvent(
+        endstone::ServerLoadEvent::NAME, [&](endstone::Event &) { ++load_count; }, endstone::EventPriority::Normal,
+        *plugin_, false);
+    plugin_manager_->registerEvent(
+        CustomLoadEvent::NAME, [&](endstone::Event &) { ++custom_count; }, endstone::EventPriority::Normal, *plugin_,
+        false);
+
+    endstone::ServerLoadEvent load_event{endstone::ServerLoadEvent::LoadType::Startup};
+    plugin_manager_->callEvent(load_event);
+    CustomLoadEvent custom_event;
+    plugin_manager_->callEvent(custom_event);
+    plugin_manager_->callEvent(load_event);
+    EXPECT_EQ(load_count, 2);
+    EXPECT_EQ(custom_count, 1);
+}
+
+// Test that handlers are called in the order of their priorities
+TEST_F(PluginManagerTest, CallEventInPriorityOrder)
+{
+    std::vector<endstone::EventPriority> order;
+    for (auto priority : {endstone::EventPriority::Monitor, endstone::EventPriority::Lowest,
+                          endstone::EventPriority::High, endstone::EventPriority::Normal}) {
+        plugin_manager_->registerEvent(
+            CustomEvent::NAME, [&order, priority](endstone::Event &) { order.push_back(priority); }, priority,
+            *plugin_, false);
+    }
+
+    CustomEvent event;
+    plugin_manager_->callEvent(event);
+    EXPECT_THAT(order, testing::ElementsAre(endstone::EventPriority::Lowest, endstone::EventPriority::Normal,
+                                            endstone::EventPriority::High, endstone::EventPriority::Monitor));
+}
+
+// Test that handlers ignoring cancelled events are skipped once the event is cancelled
+TEST_F(PluginManagerTest, CallEventIgnoreCancelled)
+{
+    bool called = false;
+    plugin_manager_->registerEvent(
+        CustomEvent::NAME, [](endstone::Event &e) { e.setCancelled(true); }, endstone::EventPriority::Low, *plugin_,
+        false);
+    plugin_manager_->registerEvent(
+        CustomEvent::NAME, [&](endstone::Event &) { called = true; }, endstone::EventPriority::High, *plugin_, true);
+
+    CustomEvent event;
+    plugin_manager_->callEvent(event);
+    EXPECT_TRUE(event.isCancelled());
+    EXPECT_FALSE(called);
+}
+
+// Test that dispatch resumes with handlers ignoring cancelled events once the event is uncancelled
+TEST_F(PluginManagerTest, CallEventUncancelled)
+{
+    std::vector<int> order;
+    auto add = [&](int id, endstone::EventPriority priority, bool ignore_cancelled, std::optional<bool> cancel) {
+        plugin_manager_->registerEvent(
+            CustomEvent::NAME,
+            [&order, id, cancel](endstone::Event &e) {
+                order.push_back(id);
+                if (cancel.has_value()) {
+                    e.setCancelled(cancel.value());
+                }
+            },
+            priority, *plugin_, ignore_cancelled);
+    };
+    add(1, endstone::EventPriority::Lowest, false, true);
+    add(2, endstone::EventPriority::Low, true, std::nullopt);
+    add(3, endstone::EventPriority::Normal, false, std::nullopt);
+    add(4, endstone::EventPriority::Normal, true, std::nullopt);
+    add(5, endstone::EventPriority::High, false, false);
+    add(6, endstone::EventPriority::Highest, true, std::nullopt);
+    add(7, endstone::EventPriority::Monitor, false, true);
+    add(8, endstone::EventPriority::Monitor, true, std::nullopt);
+
+    CustomEvent event;
+    plugin_manager_->callEvent(event);
+    EXPECT_THAT(order, testing::ElementsAre(1, 3, 5, 6, 7));
+    EXPECT_TRUE(event.isCancelled());
+}
+
+// Test that registering a handler while an event is being dispatched does not affect the ongoing dispatch
+TEST_F(PluginManagerTest, RegisterDuringCallEvent)
+{
+    int outer_count = 0;
+    int inner_count = 0;
+    plugin_manager_->registerEvent(
+        CustomEvent::NAME,
+        [&](endstone::Event &) {
+            if (outer_count++ == 0) {
+                plugin_manager_->registerEvent(
+                    CustomEvent::NAME, [&](endstone::Event &) { ++inner_count; }, endstone::EventPriority::Monitor,
+                    *plugin_, false);
+            }
+        },
+        endstone::EventPriority::Normal, *plugin_, false);
+
+    CustomEvent event;
+    plugin_manager_->callEvent(event);
+    EXPECT_EQ(outer_count, 1);
+    EXPECT_EQ(inner_count, 0);
+
+    plugin_manager_->callEvent(event);
+    EXPECT_EQ(outer_count, 2);
+    EXPECT_EQ(inner_count, 1);
+}
+
+// Test that listeners are reported only for event types with registered handlers
+TEST_F(PluginManagerTest, HasListeners)
+{
+    EXPECT_FALSE(plugin_manager_->hasListeners<endstone::ServerLoadEvent>());
+    plugin_manager_->registerEvent(
+        endstone::ServerLoadEvent::NAME, [](endstone::Event &) {}, endstone::EventPriority::Normal, *plugin_, false);
+    EXPECT_TRUE(plugin_manager_->hasListeners<endstone::ServerLoadEvent>());
+    EXPECT_FALSE(plugin_manager_->hasListeners<endstone::BroadcastMessageEvent>());
+}
+
+// Test that handler timings are only recorded while enabled
+TEST_F(PluginManagerTest, EventTimings)
+{
+    ON_CALL(*plugin_, getDescription()).WillByDefault(testing::ReturnRef(description_));
+    plugin_manager_->registerEvent(
+        CustomEvent::NAME, [](endstone::Event &) {}, endstone::EventPriority::High, *plugin_, false);
+
+    CustomEvent event;
+    plugin_manager_->callEvent(event);
+    EXPECT_TRUE(plugin_manager_->getEventTimings().empty());
+
+    plugin_manager_->setTimingsEnabled(true);
+    plugin_manager_->callEvent(event);
+    plugin_manager_->callEvent(event);
+    auto timings = plugin_manager_->getEventTimings();
+    ASSERT_EQ(timings.size(), 1);
+    EXPECT_EQ(timings[0].plugin, "test_plugin");
+    EXPECT_EQ(timings[0].event, CustomEvent::NAME);
+    EXPECT_EQ(timings[0].priority, endstone::EventPriority::High);
+    EXPECT_EQ(timings[0].count, 2);
+    EXPECT_LE(timings[0].max, timings[0].total);
+    EXPECT_LE(timings[0].p99, timings[0].max);
+
+    plugin_manager_->resetTimings();
+    EXPECT_TRUE(plugin_manager_->getEventTimings().empty());
+}
+
+// Test that typed executors receive the concrete event, whether stored inline or on the heap
+TEST_F(PluginManagerTest, TypedEventExecutor)
+{
+    struct Listener {
+        void onCustomEvent(CustomEvent &event)
+        {
+            event.setCancelled(true);
+            ++count;
+        }
+        int count = 0;
+    } listener;
+    std::vector<CustomEvent *> received;
+    plugin_manager_->registerEvent(CustomEvent::NAME,
+                                   endstone::EventExecutor::create(&Listener::onCustomEvent, listener),
+                                   endstone::EventPriority::Normal, *plugin_, false);
+    plugin_manager_->registerEvent(
+        CustomEvent::NAME,
+        endstone::EventExecutor::create<CustomEvent>([&received](CustomEvent &e) { received.push_back(&e); }),
+        endstone::EventPriority::Monitor, *plugin_, false);
+    plugin_manager_->registerEvent(
+        CustomEvent::NAME,
+        endstone::EventExecutor::create<CustomEvent>(std::function<void(CustomEvent &)>([&received](CustomEvent &e) {
+            EXPECT_TRUE(e.isCancelled());
+            received.push_back(&e);
+        })),
+        endstone::EventPriority::Monitor, *plugin_, false);
+
+    CustomEvent event;
+    plugin_manager_->callEvent(event);
+    EXPECT_EQ(listener.count, 1);
+    EXPECT_THAT(received, testing::ElementsAre(&event, &event));
+}
+
+// Test that a dispatch scope is entered once around consecutive handlers sharing it
+TEST_F(PluginManagerTest, DispatchScope)
+{
+    struct Scope : endstone::EventDispatchScope {
+        void enter(endstone::Event &) override
+        {
+            log.emplace_back("enter");
+        }
+        void exit(endstone::Event &) noexcept override
+        {
+            log.emplace_back("exit");
+        }
+        std::vector<std::string> log;
+    };
+    auto scope = std::make_shared<Scope>();
+    auto add = [&](const std::string &name, endstone::EventPriority priority, bool scoped) {
+        endstone::EventExecutor executor{[scope, name](endstone::Event &) { scope->log.push_back(name); }};
+        if (scoped) {
+            executor.setScope(scope);
+        }
+        plugin_manager_->registerEvent(CustomEvent::NAME, std::move(executor), priority, *plugin_, false);
+    };
+    add("a", endstone::EventPriority::Low, true);
+    add("b", endstone::EventPriority::Normal, true);
+    add("c", endstone::EventPriority::High, false);
+    add("d", endstone::EventPriority::Monitor, true);
+
+    CustomEvent event;
+    plugin_manager_->callEvent(event);
+    EXPECT_THAT(scope->log, testing::ElementsAre("enter", "a", "b", "exit", "c", "enter", "d", "exit"));
+}
+
+// Test that changing the default permissions only marks the subscribed permissibles, which are recalculated once
+TEST_F(PluginManagerTest, DirtyPermissiblesRecalculatedInBatch)
+{
+    testing::NiceMock<MockPermissible> op;
+    testing::NiceMock<MockPermissible> user;
+    plugin_manager_->subscribeToDefaultPerms(true, op);
+    plugin_manager_->subscribeToDefaultPerms(false, user);
+    EXPECT_CALL(op, recalculatePermissions()).Times(0);
+    EXPECT_CALL(user, recalculatePermissions()).Times(0);
+
+    for (int i = 0; i < 10; ++i) {
+        plugin_manager_->addPermission(std::make_unique<endstone::Permission>(
+            "test.permission." + std::to_string(i), "", endstone::PermissionDefault::Operator));
+    }
+    EXPECT_TRUE(plugin_manager_->hasDirtyPermissibles());
+    testing::Mock::VerifyAndClearExpectations(&op);
+    testing::Mock::VerifyAndClearExpectations(&user);
+
+    EXPECT_CALL(op, recalculatePermissions()).Times(1);
+    EXPECT_CALL(user, recalculatePermissions()).Times(0);
+    plugin_manager_->recalculateDirtyPermissibles();
+    EXPECT_FALSE(plugin_manager_->hasDirtyPermissibles());
+
+    // Unsubscribed permissibles are no longer recalculated
+    plugin_manager_->addPermission(
+        std::make_unique<endstone::Permission>("test.permission.user", "", endstone::PermissionDefault::True));
+    plugin_manager_->unsubscribeFromDefaultPerms(false, user);
+    EXPECT_CALL(op, recalculatePermissions()).Times(1);
+    plugin_manager_->recalculateDirtyPermissibles();
+    plugin_manager_->unsubscribeFromDefaultPerms(true, op);
+}
+
+// Test that permission names are interned into stable IDs that resolve to the registered permissions
+TEST_F(PluginManagerTest, InternPermissionIds)
+{
+    using endstone::detail::EndstonePluginManager;
+    EXPECT_EQ(plugin_manager_->findPermissionId("test.interned"), EndstonePluginManager::InvalidPermissionId);
+    EXPECT_EQ(plugin_manager_->getPermissionById(EndstonePluginManager::InvalidPermissionId), nullptr);
+
+    auto *perm = plugin_manager_->addPermission(std::make_unique<endstone::Permission>("Test.Interned"));
+    auto id = plugin_manager_->findPermissionId("test.interned");
+    ASSERT_NE(id, EndstonePluginManager::InvalidPermissionId);
+    EXPECT_EQ(plugin_manager_->internPermission("test.interned"), id);
+    EXPECT_EQ(plugin_manager_->getPermissionById(id), perm);
+
+    auto other = plugin_manager_->internPermission("test.unregistered");
+    EXPECT_NE(other, id);
+    EXPECT_EQ(plugin_manager_->getPermissionById(other), nullptr);
+
+    // IDs survive removal and re-registration
+    plugin_manager_->removePermission("test.interned");
+    EXPECT_EQ(plugin_manager_->getPermissionById(id), nullptr);
+    perm = plugin_manager_->addPermission(std::make_unique<endstone::Permission>("test.interned"));
+    EXPECT_EQ(plugin_manager_->findPermissionId("test.interned"), id);
+    EXPECT_EQ(plugin_manager_->getPermissionById(id), perm);
+}
+
+// Test that the children of a permission are expanded recursively, with inverted values below a false child
+TEST_F(PluginManagerTest, ChildPermissionExpansion)
+{
+    using Children = std::unordered_map<std::string, bool>;
+    plugin_manager_->addPermission(std::make_unique<endstone::Permission>(
+        "test.parent", "", endstone::PermissionDefault::False, Children{{"Test.Child", false}}));
+    auto *child = plugin_manager_->addPermission(std::make_unique<endstone::Permission>(
+        "test.child", "", endstone::PermissionDefault::False, Children{{"test.leaf", true}}));
+
+    auto parent_id = plugin_manager_->findPermissionId("test.parent");
+    auto child_id = plugin_manager_->findPermissionId("test.child");
+    const auto &expansion = plugin_manager_->getChildPermissions(parent_id);
+    auto leaf_id = plugin_manager_->findPermissionId("test.leaf");
+    using Expansion = std::vector<std::pair<std::size_t, bool>>;
+    EXPECT_EQ(expansion, (Expansion{{child_id, false}, {leaf_id, false}}));
+    EXPECT_EQ(plugin_manager_->getPermissionName(leaf_id), "test.leaf");
+
+    // Unregistered permissions have no children
+    EXPECT_TRUE(plugin_manager_->getChildPermissions(leaf_id).empty());
+
+    // Cycles end the expansion, and changing the children invalidates it
+    child->getChildren()["test.parent"] = true;
+    child->recalculatePermissibles();
+    EXPECT_THAT(plugin_manager_->getChildPermissions(child_id),
+                testing::IsSupersetOf({std::make_pair(parent_id, true), std::make_pair(leaf_id, true)}));
+    EXPECT_THAT(plugin_manager_->getChildPermissions(parent_id), testing::Contains(std::make_pair(child_id, false)));
+}
+
+// Test that subscribers are kept in a sorted list per permission that can be visited without copying
+TEST_F(PluginManagerTest, PermissionSubscribers)
+{
+    testing::NiceMock<MockPermissible> first;
+    testing::NiceMock<MockPermissible> second;
+    plugin_manager_->subscribeToPermission("Test.Subscribed", second);
+    plugin_manager_->subscribeToPermission("test.subscribed", first);
+    plugin_manager_->subscribeToPermission("test.subscribed", first);
+
+    auto id = plugin_manager_->findPermissionId("TEST.SUBSCRIBED");
+    ASSERT_NE(id, endstone::detail::EndstonePluginManager::InvalidPermissionId);
+    const auto &subscribers = plugin_manager_->getPermissionSubscribers(id);
+    EXPECT_THAT(subscribers, testing::UnorderedElementsAre(&first, &second));
+    EXPECT_TRUE(std::is_sorted(subscribers.begin(), subscribers.end()));
+    EXPECT_THAT(plugin_manager_->getPermissionSubscriptions("test.subscribed"),
+                testing::UnorderedElementsAre(&first, &second));
+
+    plugin_manager_->unsubscribeFromPermission("test.subscribed", second);
+    EXPECT_THAT(plugin_manager_->getPermissionSubscribers(id), testing::ElementsAre(&first));
+    plugin_manager_->unsubscribeFromPermission(id, first);
+    EXPECT_TRUE(plugin_manager_->getPermissionSubscribers(id).empty());
+    EXPECT_TRUE(plugin_manager_->getPermissionSubscriptions("test.unknown").empty());
+}
+
+// Test that a removed permission is no longer one of the default permissions
+TEST_F(PluginManagerTest, RemovePermissionFromDefaults)
+{
+    auto *perm = plugin_manager_->addPermission(
+        std::make_unique<endstone::Permission>("test.permission.removed", "", endstone::PermissionDefault::True));
+    ASSERT_NE(perm, nullptr);
+    EXPECT_EQ(plugin_manager_->getDefaultPermissions(true).count(perm), 1);
+    EXPECT_EQ(plugin_manager_->getDefaultPermissions(false).count(perm), 1);
+
+    plugin_manager_->removePermission("test.permission.removed");
+    EXPECT_EQ(plugin_manager_->getPermission("test.permission.removed"), nullptr);
+    EXPECT_TRUE(plugin_manager_->getDefaultPermissions(true).empty());
+    EXPECT_TRUE(plugin_manager_->getDefaultPermissions(false).empty());
+}
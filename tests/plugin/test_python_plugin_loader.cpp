@@ -0,0 +1,92 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/plugin/python_plugin_loader.h"
+
+#ifdef __linux__
+
+namespace fs = std::filesystem;
+using endstone::detail::PythonPluginLoader;
+
+class PythonPluginLoaderTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        root_ = fs::temp_directory_path() / "endstone_python_plugin_loader_test";
+        fs::remove_all(root_);
+        fs::create_directories(root_ / "plugins");
+        fs::create_directories(root_ / "site-packages" / "numpy-2.0.0.dist-info");
+        std::ofstream(root_ / "site-packages" / "numpy-2.0.0.dist-info" / "entry_points.txt")
+            << "[console_scripts]\nf2py = numpy.f2py.f2py2e:main\n";
+        const auto python_path = (root_ / "missing").string() + ":" + (root_ / "site-packages").string();
+        setenv("PYTHONPATH", python_path.c_str(), 1);
+        unsetenv("ENDSTONE_PYTHON");
+    }
+
+    void TearDown() override
+    {
+        unsetenv("PYTHONPATH");
+        unsetenv("ENDSTONE_PYTHON");
+        fs::remove_all(root_);
+    }
+
+    [[nodiscard]] std::string getPluginDirectory() const
+    {
+        return (root_ / "plugins").string();
+    }
+
+    fs::path root_;
+};
+
+TEST_F(PythonPluginLoaderTest, NoPlugins)
+{
+    EXPECT_FALSE(PythonPluginLoader::hasPlugins(getPluginDirectory()));
+}
+
+TEST_F(PythonPluginLoaderTest, WheelInPluginDirectory)
+{
+    std::ofstream(root_ / "plugins" / "endstone_example-0.1.0-py3-none-any.whl");
+    EXPECT_TRUE(PythonPluginLoader::hasPlugins(getPluginDirectory()));
+}
+
+TEST_F(PythonPluginLoaderTest, InstalledEntryPoint)
+{
+    fs::create_directories(root_ / "site-packages" / "endstone_example-0.1.0.dist-info");
+    std::ofstream(root_ / "site-packages" / "endstone_example-0.1.0.dist-info" / "entry_points.txt")
+        << "[endstone]\nexample = endstone_example:ExamplePlugin\n";
+    EXPECT_TRUE(PythonPluginLoader::hasPlugins(getPluginDirectory()));
+}
+
+TEST_F(PythonPluginLoaderTest, WithoutPythonPath)
+{
+    unsetenv("PYTHONPATH");
+    EXPECT_TRUE(PythonPluginLoader::hasPlugins(getPluginDirectory()));
+}
+
+TEST_F(PythonPluginLoaderTest, ForcedByEnvironment)
+{
+    setenv("ENDSTONE_PYTHON", "on", 1);
+    EXPECT_TRUE(PythonPluginLoader::hasPlugins(getPluginDirectory()));
+    std::ofstream(root_ / "plugins" / "endstone_example-0.1.0-py3-none-any.whl");
+    setenv("ENDSTONE_PYTHON", "off", 1);
+    EXPECT_FALSE(PythonPluginLoader::hasPlugins(getPluginDirectory()));
+}
+
+#endif
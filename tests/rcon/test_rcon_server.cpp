@@ -0,0 +1,190 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/asio.hpp>
+#include <gtest/gtest.h>
+
+#include "endstone/detail/rcon/rcon_server.h"
+
+using endstone::detail::RconCommand;
+using endstone::detail::RconServer;
+
+namespace {
+namespace asio = boost::asio;
+
+struct Packet {
+    std::int32_t id;
+    std::int32_t type;
+    std::string body;
+};
+
+class Client {
+public:
+    explicit Client(std::uint16_t port) : socket_(io_context_)
+    {
+        socket_.connect({asio::ip::make_address("127.0.0.1"), port});
+    }
+
+    void send(std::int32_t id, std::int32_t type, const std::string &body)
+    {
+        std::string packet;
+        for (auto value : {static_cast<std::int32_t>(body.size() + 10), id, type}) {
+            for (int i = 0; i < 4; ++i) {
+                packet.push_back(static_cast<char>((static_cast<std::uint32_t>(value) >> (8 * i)) & 0xFF));
+            }
+        }
+        packet += body;
+        packet.append(2, '\0');
+        asio::write(socket_, asio::buffer(packet));
+    }
+
+    Packet receive()
+    {
+        std::string size(4, '\0');
+        asio::read(socket_, asio::buffer(size));
+        std::string data(static_cast<std::size_t>(read(size.data())), '\0');
+        asio::read(socket_, asio::buffer(data));
+        return {read(data.data()), read(data.data() + 4), data.substr(8, data.size() - 10)};
+    }
+
+    bool isClosed()
+    {
+        char byte;
+        boost::system::error_code ec;
+        socket_.read_some(asio::buffer(&byte, 1), ec);
+        return ec == asio::error::eof || ec == asio::error::connection_reset;
+    }
+
+private:
+    static std::int32_t read(const char *data)
+    {
+        std::uint32_t value = 0;
+        for (int i = 3; i >= 0; --i) {
+            value = (value << 8) | static_cast<unsigned char>(data[i]);
+        }
+        return static_cast<std::int32_t>(value);
+    }
+
+    asio::io_context io_context_;
+    asio::ip::tcp::socket socket_;
+};
+
+std::vector<RconCommand> waitForCommands(RconServer &server, std::size_t count)
+{
+    std::vector<RconCommand> result;
+    for (int i = 0; i < 500 && result.size() < count; ++i) {
+        for (auto &command : server.takeCommands(count - result.size())) {
+            result.push_back(std::move(command));
+        }
+        if (result.size() < count) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+    return result;
+}
+}  // namespace
+
+TEST(RconServerTest, AnswersPipelinedCommandsWithTheirIds)
+{
+    RconServer server{"secret", "127.0.0.1", 0};
+    Client client{server.getPort()};
+    client.send(1, 3, "secret");
+    auto auth = client.receive();
+    EXPECT_EQ(auth.id, 1);
+    EXPECT_EQ(auth.type, 2);
+
+    client.send(10, 2, "list");
+    client.send(11, 2, "say hello");
+    auto commands = waitForCommands(server, 2);
+    ASSERT_EQ(commands.size(), 2);
+    EXPECT_EQ(commands[0].command, "list");
+    EXPECT_EQ(commands[1].command, "say hello");
+    EXPECT_EQ(commands[0].remote_address.rfind("127.0.0.1:", 0), 0);
+
+    commands[0].respond("There are 0 players online.");
+    commands[1].respond(std::string(5000, 'x'));
+    auto first = client.receive();
+    EXPECT_EQ(first.id, 10);
+    EXPECT_EQ(first.type, 0);
+    EXPECT_EQ(first.body, "There are 0 players online.");
+    // Outputs longer than a packet are split
+    auto second = client.receive();
+    auto third = client.receive();
+    EXPECT_EQ(second.id, 11);
+    EXPECT_EQ(third.id, 11);
+    EXPECT_EQ(second.body.size() + third.body.size(), 5000);
+}
+
+TEST(RconServerTest, ClosesOnWrongPassword)
+{
+    RconServer server{"secret", "127.0.0.1", 0};
+    Client client{server.getPort()};
+    client.send(1, 3, "guess");
+    auto auth = client.receive();
+    EXPECT_EQ(auth.id, -1);
+    EXPECT_TRUE(client.isClosed());
+}
+
+TEST(RconServerTest, LocksOutAddressAfterWrongPassword)
+{
+    RconServer server{"secret", "127.0.0.1", 0};
+    {
+        Client client{server.getPort()};
+        client.send(1, 3, "guess");
+        EXPECT_EQ(client.receive().id, -1);
+    }
+    // Reconnecting right away does not give another attempt, not even with the right password
+    Client client{server.getPort()};
+    client.send(2, 3, "secret");
+    EXPECT_EQ(client.receive().id, -1);
+    EXPECT_TRUE(client.isClosed());
+}
+
+TEST(RconServerTest, RequiresAuthentication)
+{
+    RconServer server{"secret", "127.0.0.1", 0};
+    Client client{server.getPort()};
+    client.send(1, 2, "stop");
+    EXPECT_TRUE(client.isClosed());
+    EXPECT_TRUE(server.takeCommands(10).empty());
+}
+
+TEST(RconServerTest, LimitsTheRateOfCommands)
+{
+    RconServer server{"secret", "127.0.0.1", 0};
+    Client client{server.getPort()};
+    client.send(1, 3, "secret");
+    client.receive();
+
+    const auto count = static_cast<int>(RconServer::CommandBurst) + 10;
+    for (int i = 0; i < count; ++i) {
+        client.send(i, 2, "list");
+    }
+    // Commands over the limit are answered right away, the others wait for the server thread
+    auto rejected = client.receive();
+    EXPECT_EQ(rejected.body, "Too many commands, try again later.");
+    EXPECT_LT(server.takeCommands(1000).size(), static_cast<std::size_t>(count));
+}
+
+TEST(RconServerTest, ThrowsWithoutPassword)
+{
+    EXPECT_THROW(RconServer("", "127.0.0.1", 0), std::runtime_error);
+}
@@ -0,0 +1,191 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "endstone/boss/boss_bar.h"
+#include "endstone/detail/scheduler/scheduler.h"
+#include "endstone/scheduler/coroutine.h"
+#include "endstone/scheduler/scheduler.h"
+
+// Built as its own C++20 target, so missing coroutine support fails the build instead of skipping the tests
+#if !defined(__cpp_impl_coroutine) || !__has_include(<coroutine>)
+#error "The coroutine tests require C++20 coroutine support"
+#endif
+
+class MockServer : public endstone::Server {
+public:
+    MOCK_METHOD(std::string, getName, (), (const, override));
+    MOCK_METHOD(std::string, getVersion, (), (const, override));
+    MOCK_METHOD(std::string, getMinecraftVersion, (), (const, override));
+    MOCK_METHOD(endstone::Logger &, getLogger, (), (const, override));
+    MOCK_METHOD(endstone::PluginManager &, getPluginManager, (), (const, override));
+    MOCK_METHOD(endstone::PluginCommand *, getPluginCommand, (std::string), (const, override));
+    MOCK_METHOD(endstone::ConsoleCommandSender &, getCommandSender, (), (const, override));
+    MOCK_METHOD(bool, dispatchCommand, (endstone::CommandSender &, std::string), (const, override));
+    MOCK_METHOD(endstone::Scheduler &, getScheduler, (), (const, override));
+    MOCK_METHOD(endstone::Level *, getLevel, (), (const, override));
+    MOCK_METHOD(int, getBlockTypeId, (std::string_view type), (const, override));
+    MOCK_METHOD(const std::vector<endstone::Player *> &, getOnlinePlayers, (), (const, override));
+    MOCK_METHOD(int, getMaxPlayers, (), (const, override));
+    MOCK_METHOD(void, setMaxPlayers, (int), (override));
+    MOCK_METHOD(endstone::Player *, getPlayer, (endstone::UUID), (const, override));
+    MOCK_METHOD(endstone::Player *, getPlayer, (std::string), (const, override));
+    MOCK_METHOD(void, shutdown, (), (override));
+    MOCK_METHOD(void, reload, (), (override));
+    MOCK_METHOD(void, reloadData, (), (override));
+    MOCK_METHOD(void, broadcast, (const std::string &, const std::string &), (const, override));
+    MOCK_METHOD(void, broadcastMessage, (const std::string &), (const, override));
+    MOCK_METHOD(void, broadcastPacket, (endstone::Packet &, const std::vector<endstone::Player *> &),
+                (const, override));
+    MOCK_METHOD(void, broadcastPacket, (endstone::Packet &, const std::function<bool(const endstone::Player &)> &),
+                (const, override));
+    MOCK_METHOD(bool, isPrimaryThread, (), (const, override));
+    MOCK_METHOD(endstone::Scoreboard *, getScoreboard, (), (const, override));
+    MOCK_METHOD(std::shared_ptr<endstone::Scoreboard>, getNewScoreboard, (), (override));
+    MOCK_METHOD(float, getCurrentMillisecondsPerTick, (), (override));
+    MOCK_METHOD(float, getAverageMillisecondsPerTick, (), (override));
+    MOCK_METHOD(float, getCurrentTicksPerSecond, (), (override));
+    MOCK_METHOD(float, getAverageTicksPerSecond, (), (override));
+    MOCK_METHOD(float, getCurrentTickUsage, (), (override));
+    MOCK_METHOD(float, getAverageTickUsage, (), (override));
+    MOCK_METHOD(endstone::TickStatistics, getTickStatistics, (endstone::TickWindow), (const, override));
+    MOCK_METHOD(std::uint64_t, getWallClockTick, (), (const, override));
+    MOCK_METHOD(std::chrono::system_clock::time_point, getStartTime, (), (override));
+    MOCK_METHOD(void, setTickConsistentActorReads, (bool), (override));
+    MOCK_METHOD(bool, isTickConsistentActorReads, (), (const, override));
+    MOCK_METHOD(void, setPlayerMoveThresholds, (float, float), (override));
+    MOCK_METHOD(float, getPlayerMoveDistanceThreshold, (), (const, override));
+    MOCK_METHOD(float, getPlayerMoveRotationThreshold, (), (const, override));
+    MOCK_METHOD(endstone::PlayerDataStore &, getPlayerDataStore, (), (const, override));
+    MOCK_METHOD(endstone::Messenger &, getMessenger, (), (const, override));
+    MOCK_METHOD(endstone::PacketInterceptor &, getPacketInterceptor, (), (const, override));
+    MOCK_METHOD(endstone::PacketPriority, getPacketPriority, (int), (const, override));
+    MOCK_METHOD(void, setPacketPriority, (int, endstone::PacketPriority), (override));
+    MOCK_METHOD(endstone::Player *, getPlayerByXuid, (const std::string &), (const, override));
+    MOCK_METHOD(endstone::Player *, getPlayerByRuntimeId, (std::uint64_t), (const, override));
+    MOCK_METHOD(std::vector<endstone::Player *>, getMovementAnomalies, (float, float), (const, override));
+    MOCK_METHOD(std::string, translate, (const endstone::Translatable &, const std::string &), (const, override));
+    MOCK_METHOD(void, sendTranslated, (const endstone::Translatable &, const std::vector<endstone::Player *> &),
+                (const, override));
+    MOCK_METHOD(std::unique_ptr<endstone::BossBar>, createBossBar,
+                (std::string, endstone::BarColor, endstone::BarStyle), (const, override));
+    MOCK_METHOD(std::unique_ptr<endstone::BossBar>, createBossBar,
+                (std::string, endstone::BarColor, endstone::BarStyle, std::vector<endstone::BarFlag>),
+                (const, override));
+};
+
+class MockPlugin : public endstone::Plugin {
+public:
+    MOCK_METHOD(const endstone::PluginDescription &, getDescription, (), (const, override));
+    MockPlugin()
+    {
+        setEnabled(true);
+    }
+
+    using Plugin::setEnabled;
+};
+
+class CoroutineTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        server_ = std::make_unique<MockServer>();
+        plugin_ = std::make_unique<MockPlugin>();
+        scheduler_ = std::make_unique<endstone::detail::EndstoneScheduler>(*server_);
+        main_thread_ = std::this_thread::get_id();
+    }
+
+    void TearDown() override
+    {
+        scheduler_.reset();
+        plugin_.reset();
+        server_.reset();
+    }
+
+    void tick()
+    {
+        scheduler_->mainThreadHeartbeat(++tick_count_);
+    }
+
+    std::unique_ptr<MockServer> server_;
+    std::unique_ptr<MockPlugin> plugin_;
+    std::unique_ptr<endstone::detail::EndstoneScheduler> scheduler_;
+    std::thread::id main_thread_;
+    std::uint64_t tick_count_{0};
+};
+
+// Test that a coroutine is resumed on the expected ticks and threads
+TEST_F(CoroutineTest, AwaitTicksAndThreads)
+{
+    int step = 0;
+    std::thread::id async_thread;
+    std::thread::id sync_thread;
+    auto job = [&]() -> endstone::Coroutine {
+        step = 1;
+        co_await endstone::nextTick();
+        step = 2;
+        co_await endstone::ticks(3);
+        step = 3;
+        co_await endstone::async();
+        async_thread = std::this_thread::get_id();
+        co_await endstone::sync();
+        sync_thread = std::this_thread::get_id();
+        step = 4;
+    };
+
+    endstone::runCoroutine(*scheduler_, *plugin_, job());
+    EXPECT_EQ(step, 1);
+    tick();
+    EXPECT_EQ(step, 2);
+    tick();
+    tick();
+    EXPECT_EQ(step, 2);
+    tick();
+    EXPECT_EQ(step, 3);
+    for (int i = 0; i < 1000 && step != 4; ++i) {
+        tick();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(step, 4);
+    EXPECT_NE(async_thread, main_thread_);
+    EXPECT_EQ(sync_thread, main_thread_);
+}
+
+// Test that a coroutine suspended when its plugin is disabled is destroyed instead of resumed
+TEST_F(CoroutineTest, DestroyedWhenPluginDisabled)
+{
+    auto guard = std::make_shared<int>(0);
+    std::weak_ptr<int> observer = guard;
+    bool resumed = false;
+    auto job = [&resumed](std::shared_ptr<int> owned) -> endstone::Coroutine {
+        co_await endstone::nextTick();
+        resumed = true;
+    };
+
+    endstone::runCoroutine(*scheduler_, *plugin_, job(std::move(guard)));
+    EXPECT_FALSE(observer.expired());
+    plugin_->setEnabled(false);
+    tick();
+    EXPECT_FALSE(resumed);
+    EXPECT_TRUE(observer.expired());
+}
@@ -12,15 +12,27 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
+#include <chrono>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <set>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include "endstone/boss/boss_bar.h"
+#include "endstone/detail/logger_factory.h"
+#include "endstone/detail/scheduler/async_task.h"
 #include "endstone/detail/scheduler/scheduler.h"
+#include "endstone/level/level.h"
 #include "endstone/scheduler/scheduler.h"
 
 class MockServer : public endstone::Server {
@@ -35,7 +47,8 @@ public:
     MOCK_METHOD(bool, dispatchCommand, (endstone::CommandSender &, std::string), (const, override));
     MOCK_METHOD(endstone::Scheduler &, getScheduler, (), (const, override));
     MOCK_METHOD(endstone::Level *, getLevel, (), (const, override));
-    MOCK_METHOD(std::vector<endstone::Player *>, getOnlinePlayers, (), (const, override));
+    MOCK_METHOD(int, getBlockTypeId, (std::string_view type), (const, override));
+    MOCK_METHOD(const std::vector<endstone::Player *> &, getOnlinePlayers, (), (const, override));
     MOCK_METHOD(int, getMaxPlayers, (), (const, override));
     MOCK_METHOD(void, setMaxPlayers, (int), (override));
     MOCK_METHOD(endstone::Player *, getPlayer, (endstone::UUID), (const, override));
@@ -45,6 +58,10 @@ public:
     MOCK_METHOD(void, reloadData, (), (override));
     MOCK_METHOD(void, broadcast, (const std::string &, const std::string &), (const, override));
     MOCK_METHOD(void, broadcastMessage, (const std::string &), (const, override));
+    MOCK_METHOD(void, broadcastPacket, (endstone::Packet &, const std::vector<endstone::Player *> &),
+                (const, override));
+    MOCK_METHOD(void, broadcastPacket, (endstone::Packet &, const std::function<bool(const endstone::Player &)> &),
+                (const, override));
     MOCK_METHOD(bool, isPrimaryThread, (), (const, override));
     MOCK_METHOD(endstone::Scoreboard *, getScoreboard, (), (const, override));
     MOCK_METHOD(std::shared_ptr<endstone::Scoreboard>, getNewScoreboard, (), (override));
@@ -54,7 +71,25 @@ public:
     MOCK_METHOD(float, getAverageTicksPerSecond, (), (override));
     MOCK_METHOD(float, getCurrentTickUsage, (), (override));
     MOCK_METHOD(float, getAverageTickUsage, (), (override));
+    MOCK_METHOD(endstone::TickStatistics, getTickStatistics, (endstone::TickWindow), (const, override));
+    MOCK_METHOD(std::uint64_t, getWallClockTick, (), (const, override));
     MOCK_METHOD(std::chrono::system_clock::time_point, getStartTime, (), (override));
+    MOCK_METHOD(void, setTickConsistentActorReads, (bool), (override));
+    MOCK_METHOD(bool, isTickConsistentActorReads, (), (const, override));
+    MOCK_METHOD(void, setPlayerMoveThresholds, (float, float), (override));
+    MOCK_METHOD(float, getPlayerMoveDistanceThreshold, (), (const, override));
+    MOCK_METHOD(float, getPlayerMoveRotationThreshold, (), (const, override));
+    MOCK_METHOD(endstone::PlayerDataStore &, getPlayerDataStore, (), (const, override));
+    MOCK_METHOD(endstone::Messenger &, getMessenger, (), (const, override));
+    MOCK_METHOD(endstone::PacketInterceptor &, getPacketInterceptor, (), (const, override));
+    MOCK_METHOD(endstone::PacketPriority, getPacketPriority, (int), (const, override));
+    MOCK_METHOD(void, setPacketPriority, (int, endstone::PacketPriority), (override));
+    MOCK_METHOD(endstone::Player *, getPlayerByXuid, (const std::string &), (const, override));
+    MOCK_METHOD(endstone::Player *, getPlayerByRuntimeId, (std::uint64_t), (const, override));
+    MOCK_METHOD(std::vector<endstone::Player *>, getMovementAnomalies, (float, float), (const, override));
+    MOCK_METHOD(std::string, translate, (const endstone::Translatable &, const std::string &), (const, override));
+    MOCK_METHOD(void, sendTranslated, (const endstone::Translatable &, const std::vector<endstone::Player *> &),
+                (const, override));
     MOCK_METHOD(std::unique_ptr<endstone::BossBar>, createBossBar,
                 (std::string, endstone::BarColor, endstone::BarStyle), (const, override));
     MOCK_METHOD(std::unique_ptr<endstone::BossBar>, createBossBar,
@@ -62,6 +97,20 @@ public:
                 (const, override));
 };
 
+class MockLevel : public endstone::Level {
+public:
+    MOCK_METHOD(std::string, getName, (), (const, override));
+    MOCK_METHOD(std::vector<endstone::Actor *>, getActors, (), (const, override));
+    MOCK_METHOD(void, forEachActor, (const std::function<bool(endstone::Actor &)> &), (const, override));
+    MOCK_METHOD(void, forEachActor, (endstone::ActorCategory, const std::function<bool(endstone::Actor &)> &),
+                (const, override));
+    MOCK_METHOD(int, getTime, (), (const, override));
+    MOCK_METHOD(void, setTime, (int), (override));
+    MOCK_METHOD(std::vector<endstone::Dimension *>, getDimensions, (), (const, override));
+    MOCK_METHOD(endstone::Dimension *, getDimension, (std::string), (const, override));
+    MOCK_METHOD(bool, backup, (endstone::Plugin &, std::string, std::function<void(std::string)>), (override));
+};
+
 class MockPlugin : public endstone::Plugin {
 public:
     MOCK_METHOD(const endstone::PluginDescription &, getDescription, (), (const, override));
@@ -158,6 +207,21 @@ TEST_F(SchedulerTest, CancelTasks)
     EXPECT_FALSE(scheduler_->isQueued(task3->getTaskId()));
 }
 
+// Cancelling the tasks of a plugin leaves those of the other plugins queued
+TEST_F(SchedulerTest, CancelTasksOfOnePlugin)
+{
+    MockPlugin other;
+    auto own = scheduler_->runTaskTimer(*plugin_, []() {}, 10, 5);
+    auto kept = scheduler_->runTaskTimer(other, []() {}, 10, 5);
+    scheduler_->cancelTask(scheduler_->runTaskLater(*plugin_, []() {}, 5)->getTaskId());
+    scheduler_->cancelTasks(*plugin_);
+    EXPECT_FALSE(scheduler_->isQueued(own->getTaskId()));
+    EXPECT_TRUE(scheduler_->isQueued(kept->getTaskId()));
+
+    scheduler_->cancelTasks(other);
+    EXPECT_FALSE(scheduler_->isQueued(kept->getTaskId()));
+}
+
 // Test to check if a task is running
 TEST_F(SchedulerTest, TaskIsRunning)
 {
@@ -205,3 +269,454 @@ TEST_F(SchedulerTest, GetPendingTasks)
     EXPECT_NE(std::find(task_ids.begin(), task_ids.end(), task2->getTaskId()), task_ids.end());
     EXPECT_NE(std::find(task_ids.begin(), task_ids.end(), task3->getTaskId()), task_ids.end());
 }
+
+// Test that sync tasks due after the tick budget is spent are deferred in order, unless critical
+TEST_F(SchedulerTest, TickBudget)
+{
+    scheduler_->setTickBudget(std::chrono::milliseconds(1));
+    std::vector<int> order;
+    for (int i = 0; i < 3; ++i) {
+        scheduler_->runTask(*plugin_, [&order, i]() {
+            order.push_back(i);
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        });
+    }
+    auto critical = scheduler_->runTask(*plugin_, [&order]() { order.push_back(3); });
+    critical->setPriority(endstone::TaskPriority::Critical);
+
+    scheduler_->mainThreadHeartbeat(++tick_count_);
+    EXPECT_EQ(order, (std::vector<int>{0, 3}));
+    EXPECT_EQ(scheduler_->getDeferredTaskCount(), 2);
+
+    scheduler_->mainThreadHeartbeat(++tick_count_);
+    EXPECT_EQ(order, (std::vector<int>{0, 3, 1}));
+    scheduler_->mainThreadHeartbeat(++tick_count_);
+    EXPECT_EQ(order, (std::vector<int>{0, 3, 1, 2}));
+    EXPECT_EQ(scheduler_->getDeferredTaskCount(), 2);
+    EXPECT_TRUE(scheduler_->getPendingTasks().empty());
+}
+
+// Test that the tasks due in the ticks skipped by a heartbeat run once, and timers do not make up for missed runs
+TEST_F(SchedulerTest, HeartbeatSkipsTicks)
+{
+    std::vector<int> order;
+    scheduler_->runTaskLater(*plugin_, [&order]() { order.push_back(2); }, 3);
+    scheduler_->runTaskLater(*plugin_, [&order]() { order.push_back(1); }, 2);
+    int execution_count = 0;
+    scheduler_->runTaskTimer(*plugin_, [&]() { ++execution_count; }, 2, 1);
+    scheduler_->mainThreadHeartbeat(++tick_count_);
+
+    tick_count_ += 10;
+    scheduler_->mainThreadHeartbeat(tick_count_);
+    EXPECT_EQ(order, (std::vector<int>{1, 2}));
+    EXPECT_EQ(execution_count, 1);
+    scheduler_->mainThreadHeartbeat(++tick_count_);
+    EXPECT_EQ(execution_count, 2);
+}
+
+// Test that the periods of normal priority timers are stretched with the tick usage above the threshold
+TEST_F(SchedulerTest, LoadShedding)
+{
+    EXPECT_CALL(*server_, getAverageTickUsage()).WillRepeatedly(testing::Return(1.0F));
+    scheduler_->setLoadSheddingThreshold(0.5F);
+    int normal_count = 0;
+    int critical_count = 0;
+    scheduler_->runTaskTimer(*plugin_, [&]() { ++normal_count; }, 1, 2);
+    auto critical = scheduler_->runTaskTimer(*plugin_, [&]() { ++critical_count; }, 1, 2);
+    critical->setPriority(endstone::TaskPriority::Critical);
+
+    // The period of 2 ticks is stretched to 8 at full usage
+    for (int i = 0; i < 17; ++i) {
+        scheduler_->mainThreadHeartbeat(++tick_count_);
+    }
+    EXPECT_EQ(normal_count, 3);
+    EXPECT_EQ(critical_count, 9);
+
+    EXPECT_CALL(*server_, getAverageTickUsage()).WillRepeatedly(testing::Return(0.5F));
+    for (int i = 0; i < 12; ++i) {
+        scheduler_->mainThreadHeartbeat(++tick_count_);
+    }
+    EXPECT_EQ(normal_count, 6);
+}
+
+// Test that the result of an async supplier is delivered to its continuation on the main thread
+TEST_F(SchedulerTest, SupplyAsync)
+{
+    auto main_thread = std::this_thread::get_id();
+    std::optional<int> received;
+    std::thread::id received_on;
+    auto result = scheduler_->supplyAsync(*plugin_, []() { return 42; });
+    ASSERT_TRUE(result != nullptr);
+    ASSERT_TRUE(result->getTask() != nullptr);
+    EXPECT_FALSE(result->getTask()->isSync());
+    result->thenSync([&](int value) {
+        received = value;
+        received_on = std::this_thread::get_id();
+    });
+
+    for (int i = 0; i < 1000 && !received; ++i) {
+        scheduler_->mainThreadHeartbeat(++tick_count_);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_TRUE(result->isDone());
+    ASSERT_TRUE(received.has_value());
+    EXPECT_EQ(received.value(), 42);
+    EXPECT_EQ(received_on, main_thread);
+}
+
+// Test that a continuation set after the supplier has returned still runs on the next tick
+TEST_F(SchedulerTest, SupplyAsyncThenSyncAfterDone)
+{
+    bool executed = false;
+    auto result = scheduler_->supplyAsync(*plugin_, []() {});
+    ASSERT_TRUE(result != nullptr);
+    for (int i = 0; i < 1000 && !result->isDone(); ++i) {
+        scheduler_->mainThreadHeartbeat(++tick_count_);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_TRUE(result->isDone());
+
+    result->thenSync([&]() { executed = true; });
+    EXPECT_FALSE(executed);
+    scheduler_->mainThreadHeartbeat(++tick_count_);
+    EXPECT_TRUE(executed);
+}
+
+// A callback that throws something other than a std::exception is logged, and the callbacks after it still run
+TEST_F(SchedulerTest, RunOnMainThreadAfterThrowingCallback)
+{
+    endstone::PluginDescription description("TestPlugin", "1.0.0");
+    EXPECT_CALL(*plugin_, getDescription()).WillRepeatedly(testing::ReturnRef(description));
+    EXPECT_CALL(*server_, getLogger())
+        .WillRepeatedly(testing::ReturnRef(endstone::detail::LoggerFactory::getLogger("Test")));
+    bool executed = false;
+    scheduler_->runOnMainThread(*plugin_, []() { throw 1; });
+    scheduler_->runOnMainThread(*plugin_, [&]() { executed = true; });
+    scheduler_->mainThreadHeartbeat(++tick_count_);
+    EXPECT_TRUE(executed);
+}
+
+// Test that sync and async task runs are recorded per plugin while timings are enabled
+TEST_F(SchedulerTest, TaskTimings)
+{
+    endstone::PluginDescription description("TestPlugin", "1.0.0");
+    EXPECT_CALL(*plugin_, getDescription()).WillRepeatedly(testing::ReturnRef(description));
+    scheduler_->runTask(*plugin_, []() {});
+    scheduler_->mainThreadHeartbeat(++tick_count_);
+    EXPECT_TRUE(scheduler_->getTaskTimings().empty());
+
+    scheduler_->setTimingsEnabled(true);
+    std::atomic<bool> executed = false;
+    scheduler_->runTask(*plugin_, []() {});
+    scheduler_->runTask(*plugin_, []() {});
+    scheduler_->runTaskAsync(*plugin_, [&]() { executed = true; });
+    scheduler_->mainThreadHeartbeat(++tick_count_);
+    scheduler_->runTask(*plugin_, []() {});
+    scheduler_->mainThreadHeartbeat(++tick_count_);
+    scheduler_->mainThreadHeartbeat(++tick_count_);
+    for (int i = 0; i < 1000 && scheduler_->getTaskTimings()[0].async_pending > 0; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    auto timings = scheduler_->getTaskTimings();
+    ASSERT_EQ(timings.size(), 1);
+    EXPECT_EQ(timings[0].sync_count, 3);
+    EXPECT_EQ(timings[0].sync_ticks, 2);
+    EXPECT_EQ(timings[0].sync_max_per_tick, 2);
+    EXPECT_EQ(timings[0].async_count, 1);
+    EXPECT_EQ(timings[0].async_pending, 0);
+    EXPECT_TRUE(executed);
+
+    scheduler_->resetTimings();
+    EXPECT_TRUE(scheduler_->getTaskTimings().empty());
+}
+
+// An async task that throws something other than a std::exception is still counted as done
+TEST_F(SchedulerTest, TaskTimingsOfThrowingAsyncTask)
+{
+    endstone::PluginDescription description("TestPlugin", "1.0.0");
+    EXPECT_CALL(*plugin_, getDescription()).WillRepeatedly(testing::ReturnRef(description));
+    scheduler_->setTimingsEnabled(true);
+    scheduler_->runTaskAsync(*plugin_, []() { throw 1; });
+    scheduler_->mainThreadHeartbeat(++tick_count_);
+    for (int i = 0; i < 1000 && scheduler_->getTaskTimings()[0].async_count == 0; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    auto timings = scheduler_->getTaskTimings();
+    ASSERT_EQ(timings.size(), 1);
+    EXPECT_EQ(timings[0].async_count, 1);
+    EXPECT_EQ(timings[0].async_pending, 0);
+}
+
+// Test that an idle async task can be cancelled before it runs
+TEST_F(SchedulerTest, CancelAsyncTask)
+{
+    std::atomic<bool> executed = false;
+    auto task = scheduler_->runTaskLaterAsync(*plugin_, [&]() { executed = true; }, 10);
+    ASSERT_TRUE(task != nullptr);
+    EXPECT_TRUE(scheduler_->isQueued(task->getTaskId()));
+    task->cancel();
+    EXPECT_TRUE(task->isCancelled());
+    EXPECT_FALSE(scheduler_->isQueued(task->getTaskId()));
+    for (int i = 0; i < 20; ++i) {
+        scheduler_->mainThreadHeartbeat(++tick_count_);
+    }
+    EXPECT_FALSE(executed);
+}
+
+// Releasing the tasks of a plugin waits for its running async task, then destroys the callables it queued
+TEST_F(SchedulerTest, ReleaseTasks)
+{
+    std::atomic<bool> started = false;
+    std::atomic<bool> finished = false;
+    auto token = std::make_shared<int>();
+    scheduler_->runTaskAsync(*plugin_, [&, token]() {
+        started = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        finished = true;
+    });
+    scheduler_->runTaskTimer(*plugin_, [token]() {}, 10, 5);
+    scheduler_->mainThreadHeartbeat(++tick_count_);
+    while (!started) {
+        std::this_thread::yield();
+    }
+
+    EXPECT_FALSE(scheduler_->releaseTasks(*plugin_, std::chrono::steady_clock::now()));
+    EXPECT_TRUE(scheduler_->releaseTasks(*plugin_, std::chrono::steady_clock::now() + std::chrono::seconds(5)));
+    EXPECT_TRUE(finished);
+    EXPECT_EQ(token.use_count(), 1);
+}
+
+// Test scheduling and cancelling tasks from many threads while the server thread ticks
+TEST_F(SchedulerTest, ScheduleAndCancelFromThreads)
+{
+    constexpr int NumThreads = 8;
+    constexpr int TasksPerThread = 1000;
+    std::atomic<int> executed = 0;
+    std::atomic<int> running = NumThreads;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < NumThreads; ++t) {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < TasksPerThread; ++i) {
+                auto task = scheduler_->runTaskLater(*plugin_, [&]() { ++executed; }, 1);
+                if (i % 2 == 1) {
+                    task->cancel();
+                }
+            }
+            --running;
+        });
+    }
+    while (running > 0) {
+        scheduler_->mainThreadHeartbeat(++tick_count_);
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (int i = 0; i < 3; ++i) {
+        scheduler_->mainThreadHeartbeat(++tick_count_);
+    }
+    EXPECT_EQ(executed, NumThreads * TasksPerThread / 2);
+    EXPECT_TRUE(scheduler_->getPendingTasks().empty());
+}
+
+// Test that async tasks run on the executor they were scheduled on
+TEST_F(SchedulerTest, RunTaskOnIoExecutor)
+{
+    std::atomic<bool> executed = false;
+    auto task = scheduler_->runTaskAsync(
+        *plugin_, [&]() { executed = true; }, endstone::AsyncExecutor::Io);
+    ASSERT_TRUE(task != nullptr);
+    EXPECT_FALSE(task->isSync());
+    EXPECT_EQ(std::static_pointer_cast<endstone::detail::EndstoneAsyncTask>(task)->getExecutor(),
+              endstone::AsyncExecutor::Io);
+    scheduler_->mainThreadHeartbeat(++tick_count_);
+    for (int i = 0; i < 1000 && !executed; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_TRUE(executed);
+    EXPECT_GE(scheduler_->getExecutor(endstone::AsyncExecutor::Io).getThreadCount(), 4);
+}
+
+// Test that Python tasks share a single worker of their own
+TEST_F(SchedulerTest, RunTaskOnPythonExecutor)
+{
+    std::atomic<int> executed = 0;
+    std::atomic<int> running = 0;
+    std::atomic<int> overlapped = 0;
+    for (int i = 0; i < 4; ++i) {
+        scheduler_->runTaskAsync(
+            *plugin_,
+            [&]() {
+                if (running.fetch_add(1) > 0) {
+                    ++overlapped;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                --running;
+                ++executed;
+            },
+            endstone::AsyncExecutor::Python);
+    }
+    scheduler_->mainThreadHeartbeat(++tick_count_);
+    for (int i = 0; i < 1000 && executed < 4; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(executed, 4);
+    EXPECT_EQ(overlapped, 0);
+    EXPECT_EQ(scheduler_->getExecutor(endstone::AsyncExecutor::Python).getThreadCount(), 1);
+}
+
+// Test that tasks of the post-tick phase run after the heartbeat, on the tick they are due
+TEST_F(SchedulerTest, PostTickPhase)
+{
+    std::vector<std::string> order;
+    auto post = scheduler_->runTask(*plugin_, [&]() { order.emplace_back("post"); });
+    post->setPhase(endstone::TaskPhase::PostTick);
+    scheduler_->runTask(*plugin_, [&]() { order.emplace_back("pre"); });
+
+    scheduler_->mainThreadHeartbeat(++tick_count_);
+    EXPECT_EQ(order, (std::vector<std::string>{"pre"}));
+    scheduler_->mainThreadPostTick(tick_count_);
+    EXPECT_EQ(order, (std::vector<std::string>{"pre", "post"}));
+    EXPECT_FALSE(scheduler_->isQueued(post->getTaskId()));
+}
+
+// Test that a large random mix of delayed, repeating and cancelled tasks runs exactly on the expected ticks, and in the
+// same order every time
+TEST_F(SchedulerTest, DeterministicRunOrder)
+{
+    static constexpr int NumTasks = 5000;
+    static constexpr std::uint64_t NumTicks = 400;
+
+    auto simulate = [this]() {
+        scheduler_ = std::make_unique<endstone::detail::EndstoneScheduler>(*server_);
+        scheduler_->setTickBudget(std::chrono::nanoseconds::zero());
+        tick_count_ = 0;
+
+        std::mt19937 random(42);
+        std::vector<std::pair<std::uint64_t, int>> runs;
+        std::vector<std::shared_ptr<endstone::Task>> tasks;
+        std::multimap<std::uint64_t, int> cancellations;
+        std::map<int, std::vector<std::uint64_t>> expected;
+        for (int i = 0; i < NumTasks; ++i) {
+            std::uint64_t delay = random() % 300;
+            std::uint64_t period = (random() % 3 == 0) ? 1 + random() % 50 : 0;
+            std::uint64_t cancel_at = (random() % 3 == 0) ? 1 + random() % NumTicks : NumTicks + 1;
+            tasks.push_back(scheduler_->runTaskTimer(
+                *plugin_, [&runs, this, i]() { runs.emplace_back(tick_count_, i); }, delay, period));
+            cancellations.emplace(cancel_at, i);
+            for (auto tick = std::max<std::uint64_t>(delay, 1); tick <= std::min(cancel_at, NumTicks);
+                 tick += period) {
+                expected[i].push_back(tick);
+                if (period == 0) {
+                    break;
+                }
+            }
+        }
+
+        while (tick_count_ < NumTicks) {
+            scheduler_->mainThreadHeartbeat(++tick_count_);
+            auto [begin, end] = cancellations.equal_range(tick_count_);
+            for (auto it = begin; it != end; ++it) {
+                tasks[it->second]->cancel();
+            }
+        }
+
+        std::map<int, std::vector<std::uint64_t>> actual;
+        for (const auto &[tick, id] : runs) {
+            actual[id].push_back(tick);
+        }
+        EXPECT_EQ(actual, expected);
+        return runs;
+    };
+
+    auto first = simulate();
+    auto second = simulate();
+    EXPECT_EQ(first, second);
+}
+
+// Test that a dimension task runs once for every dimension before the heartbeat returns
+TEST_F(SchedulerTest, DimensionTaskTimer)
+{
+    // The scheduler only passes the dimensions through, they are never dereferenced
+    MockLevel level;
+    std::vector<endstone::Dimension *> dimensions;
+    for (std::uintptr_t i = 1; i <= 3; ++i) {
+        dimensions.push_back(reinterpret_cast<endstone::Dimension *>(i * alignof(std::max_align_t)));
+    }
+    EXPECT_CALL(*server_, getLevel()).WillRepeatedly(testing::Return(&level));
+    EXPECT_CALL(level, getDimensions()).WillRepeatedly(testing::Return(dimensions));
+
+    std::mutex mutex;
+    std::vector<endstone::Dimension *> seen;
+    auto task = scheduler_->runDimensionTaskTimer(
+        *plugin_,
+        [&](endstone::Dimension &dimension) {
+            std::lock_guard lock(mutex);
+            seen.push_back(&dimension);
+        },
+        0, 2);
+    ASSERT_NE(task, nullptr);
+
+    scheduler_->mainThreadHeartbeat(++tick_count_);
+    EXPECT_EQ(std::set<endstone::Dimension *>(seen.begin(), seen.end()),
+              std::set<endstone::Dimension *>(dimensions.begin(), dimensions.end()));
+    EXPECT_EQ(seen.size(), dimensions.size());
+
+    scheduler_->mainThreadHeartbeat(++tick_count_);
+    EXPECT_EQ(seen.size(), dimensions.size());
+    scheduler_->mainThreadHeartbeat(++tick_count_);
+    EXPECT_EQ(seen.size(), 2 * dimensions.size());
+
+    task->cancel();
+    scheduler_->mainThreadHeartbeat(++tick_count_);
+    scheduler_->mainThreadHeartbeat(++tick_count_);
+    EXPECT_EQ(seen.size(), 2 * dimensions.size());
+    EXPECT_FALSE(scheduler_->isQueued(task->getTaskId()));
+}
+
+// Test that a precise task runs once its deadline has passed, without waiting for it
+TEST_F(SchedulerTest, RunTaskTimerPrecise)
+{
+    using namespace std::chrono;
+    int execution_count = 0;
+    auto task = scheduler_->runTaskTimerPrecise(*plugin_, [&]() { ++execution_count; }, milliseconds(5),
+                                                milliseconds(10));
+    ASSERT_TRUE(task != nullptr);
+
+    // Nothing is due yet, the call returns straight away
+    scheduler_->mainThreadHeartbeat(++tick_count_);
+    scheduler_->mainThreadRunPrecise();
+    EXPECT_EQ(execution_count, 0);
+
+    std::this_thread::sleep_for(milliseconds(6));
+    scheduler_->mainThreadRunPrecise();
+    EXPECT_EQ(execution_count, 1);
+    EXPECT_TRUE(scheduler_->isQueued(task->getTaskId()));
+
+    // The next run is 10ms after the first deadline, not after the run
+    scheduler_->mainThreadRunPrecise();
+    EXPECT_EQ(execution_count, 1);
+
+    scheduler_->cancelTask(task->getTaskId());
+    std::this_thread::sleep_for(milliseconds(10));
+    scheduler_->mainThreadRunPrecise();
+    EXPECT_EQ(execution_count, 1);
+    EXPECT_FALSE(scheduler_->isQueued(task->getTaskId()));
+}
+
+// Test that a precise task which came due between ticks runs at the start of the next tick, once
+TEST_F(SchedulerTest, RunTaskLaterPreciseOnNextTick)
+{
+    using namespace std::chrono;
+    int execution_count = 0;
+    auto task = scheduler_->runTaskTimerPrecise(*plugin_, [&]() { ++execution_count; }, milliseconds(1),
+                                                microseconds::zero());
+    std::this_thread::sleep_for(milliseconds(2));
+    scheduler_->mainThreadHeartbeat(++tick_count_);
+    EXPECT_EQ(execution_count, 1);
+    EXPECT_FALSE(scheduler_->isQueued(task->getTaskId()));
+
+    scheduler_->mainThreadRunPrecise();
+    EXPECT_EQ(execution_count, 1);
+}
@@ -109,3 +109,53 @@ TEST(ThreadPoolExecutorTest, ManyTasks)
 
     EXPECT_EQ(counter.load(), task_count);
 }
+
+// Test that fire-and-forget tasks, including tasks submitted from workers, are all executed
+TEST(ThreadPoolExecutorTest, ExecuteNestedTasks)
+{
+    std::atomic<int> counter{0};
+    {
+        ThreadPoolExecutor executor(4);
+        for (int i = 0; i < 10; ++i) {
+            executor.execute([&executor, &counter]() {
+                for (int j = 0; j < 100; ++j) {
+                    executor.execute([&counter]() { counter++; });
+                }
+                counter++;
+            });
+        }
+    }
+    EXPECT_EQ(counter.load(), 1010);
+}
+
+// Test that an exception thrown by a fire-and-forget task does not take down the worker
+TEST(ThreadPoolExecutorTest, ExecuteThrowingTask)
+{
+    ThreadPoolExecutor executor(1);
+    executor.execute([]() { throw std::runtime_error("error"); });
+    auto future = executor.submit([]() { return 42; });
+    EXPECT_EQ(future.get(), 42);
+}
+
+// Test that the queue depth counts the tasks no worker has started yet
+TEST(ThreadPoolExecutorTest, QueueDepth)
+{
+    ThreadPoolExecutor executor(1, {{0}});
+    EXPECT_EQ(executor.getThreadCount(), 1);
+    std::promise<void> release;
+    auto blocker = release.get_future().share();
+    auto started = executor.submit([blocker]() { blocker.wait(); });
+    while (executor.getQueueDepth() > 0) {
+        std::this_thread::yield();
+    }
+    for (int i = 0; i < 3; ++i) {
+        executor.execute([]() {});
+    }
+    EXPECT_EQ(executor.getQueueDepth(), 3);
+    release.set_value();
+    started.get();
+    while (executor.getQueueDepth() > 0) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(executor.getQueueDepth(), 0);
+}
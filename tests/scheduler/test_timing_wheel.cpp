@@ -0,0 +1,117 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/scheduler/timing_wheel.h"
+
+using endstone::detail::TimingWheel;
+
+// Test that values become due at their tick in scheduling order
+TEST(TimingWheelTest, DueInOrder)
+{
+    TimingWheel<int> wheel;
+    wheel.schedule(1, 3);
+    wheel.schedule(2, 1);
+    wheel.schedule(3, 3);
+    wheel.schedule(4, 0);
+    EXPECT_EQ(wheel.size(), 4);
+
+    std::vector<std::pair<std::uint64_t, int>> due;
+    for (std::uint64_t tick = 0; tick < 5; ++tick) {
+        wheel.advance(tick, [&](int value) { due.emplace_back(tick, value); });
+    }
+    EXPECT_EQ(due, (std::vector<std::pair<std::uint64_t, int>>{{0, 4}, {1, 2}, {3, 1}, {3, 3}}));
+    EXPECT_TRUE(wheel.empty());
+}
+
+// Test that values scheduled in the past are due at the next advanced tick
+TEST(TimingWheelTest, ScheduleInPast)
+{
+    TimingWheel<int> wheel{100};
+    wheel.schedule(1, 10);
+    std::vector<int> due;
+    wheel.advance(99, [&](int value) { due.push_back(value); });
+    EXPECT_TRUE(due.empty());
+    wheel.advance(100, [&](int value) { due.push_back(value); });
+    EXPECT_EQ(due, std::vector<int>{1});
+}
+
+// Test that values can be rescheduled while the wheel is advancing, as repeating tasks do
+TEST(TimingWheelTest, RescheduleWhileAdvancing)
+{
+    TimingWheel<int> wheel;
+    wheel.schedule(0, 0);
+    std::vector<std::uint64_t> runs;
+    for (std::uint64_t tick = 0; tick <= 1000; ++tick) {
+        wheel.advance(tick, [&](int value) {
+            runs.push_back(tick);
+            wheel.schedule(value, tick + 300);
+        });
+    }
+    EXPECT_EQ(runs, (std::vector<std::uint64_t>{0, 300, 600, 900}));
+    EXPECT_EQ(wheel.size(), 1);
+}
+
+// Test that values waiting in an upper level are not skipped by a value scheduled when the wheel stops on a boundary
+TEST(TimingWheelTest, ScheduleOnBoundary)
+{
+    TimingWheel<int> wheel;
+    wheel.schedule(1, 300);
+    std::vector<std::pair<std::uint64_t, int>> due;
+    for (std::uint64_t tick = 0; tick <= 600; ++tick) {
+        if (tick == 256) {
+            wheel.schedule(2, 266);
+        }
+        wheel.advance(tick, [&](int value) { due.emplace_back(tick, value); });
+    }
+    EXPECT_EQ(due, (std::vector<std::pair<std::uint64_t, int>>{{266, 2}, {300, 1}}));
+    EXPECT_TRUE(wheel.empty());
+}
+
+// Test that values far ahead, across every level and the overflow list, are due exactly at their tick
+TEST(TimingWheelTest, DueAcrossLevels)
+{
+    std::mt19937_64 rng{42};
+    const std::uint64_t start = (1ULL << 32) - 70000;
+    TimingWheel<std::uint64_t> wheel{start};
+    std::vector<std::uint64_t> expected;
+    for (auto delay : {1ULL, 255ULL, 256ULL, 65535ULL, 65536ULL, 70000ULL, 16777216ULL, 1ULL << 32, (1ULL << 32) + 5}) {
+        wheel.schedule(start + delay, start + delay);
+        expected.push_back(start + delay);
+    }
+    for (int i = 0; i < 1000; ++i) {
+        auto tick = start + rng() % 200000;
+        wheel.schedule(tick, tick);
+        expected.push_back(tick);
+    }
+    std::stable_sort(expected.begin(), expected.end());
+
+    // Jump between ticks with values due, as a server catching up on ticks would
+    std::vector<std::uint64_t> due;
+    for (auto tick : expected) {
+        wheel.advance(tick, [&](std::uint64_t value) {
+            EXPECT_EQ(value, tick);
+            due.push_back(value);
+        });
+    }
+    EXPECT_EQ(due, expected);
+    EXPECT_TRUE(wheel.empty());
+}
@@ -0,0 +1,84 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/scheduler/work_stealing_deque.h"
+
+using endstone::detail::WorkStealingDeque;
+
+// Test that the owner pops in LIFO order while thieves steal in FIFO order
+TEST(WorkStealingDequeTest, PushPopSteal)
+{
+    WorkStealingDeque<int> deque{2};
+    std::vector<int> values{0, 1, 2, 3, 4};
+    for (auto &value : values) {
+        deque.push(&value);
+    }
+    EXPECT_EQ(deque.steal(), &values[0]);
+    EXPECT_EQ(deque.pop(), &values[4]);
+    EXPECT_EQ(deque.steal(), &values[1]);
+    EXPECT_EQ(deque.pop(), &values[3]);
+    EXPECT_EQ(deque.pop(), &values[2]);
+    EXPECT_EQ(deque.pop(), nullptr);
+    EXPECT_EQ(deque.steal(), nullptr);
+    EXPECT_TRUE(deque.empty());
+}
+
+// Test that every item is taken exactly once while thieves race against the owner
+TEST(WorkStealingDequeTest, ConcurrentSteal)
+{
+    constexpr int num_items = 100000;
+    constexpr int num_thieves = 3;
+
+    WorkStealingDeque<int> deque;
+    std::vector<int> items(num_items);
+    std::vector<std::atomic<int>> taken(num_items);
+    std::atomic<bool> done{false};
+
+    std::vector<std::thread> thieves;
+    for (int i = 0; i < num_thieves; ++i) {
+        thieves.emplace_back([&]() {
+            while (!done) {
+                if (auto *item = deque.steal()) {
+                    taken[item - items.data()]++;
+                }
+            }
+        });
+    }
+
+    for (int i = 0; i < num_items; ++i) {
+        deque.push(&items[i]);
+        if (i % 3 == 0) {
+            if (auto *item = deque.pop()) {
+                taken[item - items.data()]++;
+            }
+        }
+    }
+    while (auto *item = deque.pop()) {
+        taken[item - items.data()]++;
+    }
+    done = true;
+    for (auto &thief : thieves) {
+        thief.join();
+    }
+
+    for (int i = 0; i < num_items; ++i) {
+        EXPECT_EQ(taken[i].load(), 1) << "item " << i;
+    }
+}
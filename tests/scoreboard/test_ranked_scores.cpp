@@ -0,0 +1,115 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/scoreboard/ranked_scores.h"
+
+namespace endstone::detail {
+
+namespace {
+std::vector<std::pair<std::int64_t, int>> top(const RankedScores &scores, std::size_t count)
+{
+    std::vector<std::pair<std::int64_t, int>> result;
+    scores.forEachDescending([&](auto id, auto score) {
+        result.emplace_back(id, score);
+        return result.size() < count;
+    });
+    return result;
+}
+}  // namespace
+
+TEST(RankedScoresTest, KeepsScoresInOrderAsTheyChange)
+{
+    RankedScores scores;
+    scores.set(1, 10);
+    scores.set(2, 30);
+    scores.set(3, 20);
+    EXPECT_EQ(top(scores, 2), (std::vector<std::pair<std::int64_t, int>>{{2, 30}, {3, 20}}));
+
+    scores.set(1, 40);
+    scores.set(2, 30);
+    scores.remove(3);
+    scores.remove(4);
+    EXPECT_EQ(top(scores, 5), (std::vector<std::pair<std::int64_t, int>>{{1, 40}, {2, 30}}));
+    EXPECT_EQ(scores.size(), 2);
+}
+
+TEST(RankedScoresTest, OrdersEqualScoresById)
+{
+    RankedScores scores;
+    scores.set(1, 5);
+    scores.set(3, 5);
+    scores.set(2, 5);
+    EXPECT_EQ(top(scores, 3), (std::vector<std::pair<std::int64_t, int>>{{3, 5}, {2, 5}, {1, 5}}));
+}
+
+TEST(RankedScoresTest, SyncDropsScoresNotSetAgain)
+{
+    RankedScores scores;
+    scores.set(1, 10);
+    scores.set(2, 20);
+    scores.set(3, 30);
+
+    scores.beginSync();
+    scores.set(1, 15);
+    scores.set(3, 30);
+    scores.set(4, 5);
+    scores.endSync();
+
+    EXPECT_EQ(top(scores, 10), (std::vector<std::pair<std::int64_t, int>>{{3, 30}, {1, 15}, {4, 5}}));
+    EXPECT_EQ(scores.size(), 3);
+}
+
+TEST(RankedScoresTest, RanksLikeASortedCopy)
+{
+    RankedScores scores;
+    std::vector<std::pair<int, std::int64_t>> expected;
+    std::minstd_rand random;
+    std::uniform_int_distribution<int> distribution(-50, 50);
+    for (std::int64_t id = 0; id < 500; id++) {
+        scores.set(id, distribution(random));
+    }
+    for (std::int64_t id = 0; id < 500; id += 3) {
+        scores.set(id, distribution(random));
+    }
+    for (std::int64_t id = 0; id < 500; id += 7) {
+        scores.remove(id);
+    }
+    scores.forEachDescending([&](auto id, auto score) {
+        expected.emplace_back(score, id);
+        return true;
+    });
+    ASSERT_EQ(expected.size(), scores.size());
+    ASSERT_TRUE(std::is_sorted(expected.rbegin(), expected.rend()));
+
+    for (std::size_t i = 0; i < expected.size(); i++) {
+        EXPECT_EQ(scores.getRank(expected[i].second), i + 1);
+    }
+    EXPECT_FALSE(scores.getRank(0).has_value());
+
+    const auto highest = top(scores, 10);
+    ASSERT_EQ(highest.size(), 10);
+    for (std::size_t i = 0; i < highest.size(); i++) {
+        EXPECT_EQ(highest[i].first, expected[i].second);
+    }
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,204 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <spdlog/sinks/base_sink.h>
+#include <spdlog/spdlog.h>
+
+#include "endstone/detail/spdlog/async_log_sink.h"
+
+namespace endstone::detail {
+
+// Records the messages it receives, optionally holding the writer thread until released
+class RecordingSink : public spdlog::sinks::base_sink<std::mutex> {
+public:
+    std::vector<std::string> messages;
+    std::thread::id thread_id;
+    int flushes = 0;
+
+    void hold()
+    {
+        std::lock_guard lock(gate_mutex_);
+        held_ = true;
+    }
+
+    void release()
+    {
+        {
+            std::lock_guard lock(gate_mutex_);
+            held_ = false;
+        }
+        gate_.notify_all();
+    }
+
+protected:
+    void sink_it_(const spdlog::details::log_msg &msg) override
+    {
+        {
+            std::unique_lock lock(gate_mutex_);
+            gate_.wait(lock, [this] { return !held_; });
+        }
+        messages.emplace_back(msg.payload.data(), msg.payload.size());
+        thread_id = std::this_thread::get_id();
+    }
+
+    void flush_() override
+    {
+        ++flushes;
+    }
+
+private:
+    std::mutex gate_mutex_;
+    std::condition_variable gate_;
+    bool held_ = false;
+};
+
+class AsyncLogSinkTest : public ::testing::Test {
+protected:
+    std::shared_ptr<RecordingSink> recorder_ = std::make_shared<RecordingSink>();
+};
+
+TEST_F(AsyncLogSinkTest, WritesInOrderOnWriterThread)
+{
+    auto sink = std::make_shared<AsyncLogSink>(std::vector<spdlog::sink_ptr>{recorder_}, 16);
+    spdlog::logger logger("Test", sink);
+    for (int i = 0; i < 1000; ++i) {
+        logger.info("message {}", i);
+    }
+    sink->flush();
+
+    ASSERT_EQ(recorder_->messages.size(), 1000);
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_EQ(recorder_->messages[i], "message " + std::to_string(i));
+    }
+    ASSERT_NE(recorder_->thread_id, std::this_thread::get_id());
+    ASSERT_GT(recorder_->flushes, 0);
+    ASSERT_EQ(sink->getDroppedCount(), 0);
+}
+
+TEST_F(AsyncLogSinkTest, FlushForWritesQueuedMessages)
+{
+    auto sink = std::make_shared<AsyncLogSink>(std::vector<spdlog::sink_ptr>{recorder_}, 16);
+    spdlog::logger logger("Test", sink);
+    for (int i = 0; i < 100; ++i) {
+        logger.info("message {}", i);
+    }
+    ASSERT_TRUE(sink->flushFor(std::chrono::seconds(5)));
+
+    ASSERT_EQ(recorder_->messages.size(), 100);
+    ASSERT_GT(recorder_->flushes, 0);
+}
+
+TEST_F(AsyncLogSinkTest, BlockPolicyLosesNothingFromManyThreads)
+{
+    auto sink = std::make_shared<AsyncLogSink>(std::vector<spdlog::sink_ptr>{recorder_}, 8, LogOverflowPolicy::Block);
+    spdlog::logger logger("Test", sink);
+    constexpr int NumThreads = 4;
+    constexpr int NumMessages = 2000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < NumThreads; ++t) {
+        threads.emplace_back([&logger, t] {
+            for (int i = 0; i < NumMessages; ++i) {
+                logger.info("{} {}", t, i);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    sink->flush();
+
+    // Every message arrives, in order per producer
+    ASSERT_EQ(recorder_->messages.size(), NumThreads * NumMessages);
+    std::vector<int> next(NumThreads, 0);
+    for (const auto &message : recorder_->messages) {
+        auto t = std::stoi(message.substr(0, message.find(' ')));
+        auto i = std::stoi(message.substr(message.find(' ') + 1));
+        ASSERT_EQ(i, next[t]++);
+    }
+}
+
+TEST_F(AsyncLogSinkTest, DropPolicyDropsWhileFull)
+{
+    auto sink = std::make_shared<AsyncLogSink>(std::vector<spdlog::sink_ptr>{recorder_}, 4, LogOverflowPolicy::Drop);
+    spdlog::logger logger("Test", sink);
+    recorder_->hold();
+    for (int i = 0; i < 100; ++i) {
+        logger.info("message {}", i);
+    }
+    ASSERT_GT(sink->getDroppedCount(), 0);
+    recorder_->release();
+    sink->flush();
+
+    // The writer reports the dropped messages once it catches up
+    auto dropped = sink->getDroppedCount();
+    ASSERT_EQ(recorder_->messages.size(), 100 - dropped + 1);
+    ASSERT_EQ(recorder_->messages.back(),
+              std::to_string(dropped) + " log messages were dropped because the log queue was full.");
+}
+
+TEST_F(AsyncLogSinkTest, SamplePolicyKeepsOneInEveryRate)
+{
+    auto sink = std::make_shared<AsyncLogSink>(std::vector<spdlog::sink_ptr>{recorder_}, 4, LogOverflowPolicy::Sample);
+    sink->setSampleRate(10);
+    spdlog::logger logger("Test", sink);
+    recorder_->hold();
+    std::thread releaser([this] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        recorder_->release();
+    });
+    for (int i = 0; i < 100; ++i) {
+        logger.info("message {}", i);
+    }
+    releaser.join();
+    sink->flush();
+
+    // Drops may be reported across several batches while the writer catches up
+    auto dropped = sink->getDroppedCount();
+    auto reports = std::count_if(recorder_->messages.begin(), recorder_->messages.end(),
+                                 [](const auto &message) { return message.find("dropped") != std::string::npos; });
+    // The first full queue drops one less than the sample rate before the sampled message waits for room
+    ASSERT_GE(dropped, 9);
+    ASSERT_LT(dropped, 100);
+    ASSERT_GT(reports, 0);
+    ASSERT_EQ(recorder_->messages.size(), 100 - dropped + reports);
+}
+
+TEST_F(AsyncLogSinkTest, CoalescesFlushesWithinInterval)
+{
+    auto sink = std::make_shared<AsyncLogSink>(std::vector<spdlog::sink_ptr>{recorder_}, 16);
+    sink->setFlushInterval(std::chrono::milliseconds(200));
+    spdlog::logger logger("Test", sink);
+    // Each message is its own batch, without an interval every one of them would be flushed
+    for (int i = 0; i < 20; ++i) {
+        logger.info("message {}", i);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    sink->flush();
+
+    ASSERT_EQ(recorder_->messages.size(), 20);
+    ASSERT_GT(recorder_->flushes, 0);
+    ASSERT_LE(recorder_->flushes, 3);
+}
+
+}  // namespace endstone::detail
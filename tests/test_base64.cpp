@@ -443,3 +443,37 @@ TEST(Base64RoundTripTests, TypeMixTests)
         ASSERT_EQ(tmp2, svecinput);
     }
 }
+
+// NOLINTNEXTLINE
+TEST(Base64BufferTests, ComputesExactSizes)
+{
+    ASSERT_EQ(endstone::detail::base64_encoded_size(0), 0);
+    ASSERT_EQ(endstone::detail::base64_encoded_size(1), 4);
+    ASSERT_EQ(endstone::detail::base64_encoded_size(3), 4);
+    ASSERT_EQ(endstone::detail::base64_encoded_size(4), 8);
+    ASSERT_EQ(endstone::detail::base64_decoded_size("SGVsbG8sIFdvcmxkIQ=="), 13);
+    ASSERT_EQ(endstone::detail::base64_decoded_size("Zm9vYmFy"), 6);
+    ASSERT_FALSE(endstone::detail::base64_decoded_size("Zm9vYmF").has_value());
+}
+
+// NOLINTNEXTLINE
+TEST(Base64BufferTests, EncodesAndDecodesInPlace)
+{
+    const std::string input{"Hello, World!"};
+    std::array<char, endstone::detail::base64_encoded_size(13)> encoded{};
+    auto encoded_size = endstone::detail::base64_encode(input, encoded.data());
+    ASSERT_EQ(std::string_view(encoded.data(), encoded_size), "SGVsbG8sIFdvcmxkIQ==");
+
+    std::array<char, 13> decoded{};
+    auto decoded_size = endstone::detail::base64_decode({encoded.data(), encoded_size}, decoded.data(), decoded.size());
+    ASSERT_EQ(decoded_size, 13);
+    ASSERT_EQ(std::string_view(decoded.data(), 13), input);
+}
+
+// NOLINTNEXTLINE
+TEST(Base64BufferTests, RejectsSmallBuffers)
+{
+    std::array<char, 12> decoded{};
+    ASSERT_FALSE(endstone::detail::base64_decode("SGVsbG8sIFdvcmxkIQ==", decoded.data(), decoded.size()).has_value());
+    ASSERT_FALSE(endstone::detail::base64_decode("a aa", decoded.data(), decoded.size()).has_value());
+}
@@ -0,0 +1,77 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/block/block_type_ids.h"
+
+using endstone::detail::BlockTypeIds;
+
+namespace {
+const BlockLegacy *legacy(int &storage)
+{
+    return reinterpret_cast<const BlockLegacy *>(&storage);
+}
+}  // namespace
+
+TEST(BlockTypeIdsTest, NumbersTypesInOrder)
+{
+    int stone = 0, dirt = 0;
+    BlockTypeIds ids;
+    EXPECT_EQ(ids.add(legacy(stone), "minecraft:stone"), 0);
+    EXPECT_EQ(ids.add(legacy(dirt), "minecraft:dirt"), 1);
+    EXPECT_EQ(ids.add(legacy(stone), "minecraft:stone"), 0);
+    EXPECT_EQ(ids.size(), 2);
+
+    EXPECT_EQ(ids.find(legacy(dirt)), 1);
+    EXPECT_EQ(ids.find("minecraft:stone"), 0);
+    EXPECT_EQ(ids.getName(1), "minecraft:dirt");
+}
+
+TEST(BlockTypeIdsTest, SharesIdsBetweenLegaciesWithTheSameName)
+{
+    int first = 0, second = 0;
+    BlockTypeIds ids;
+    EXPECT_EQ(ids.add(legacy(first), "minecraft:stone"), 0);
+    EXPECT_EQ(ids.add(legacy(second), "minecraft:stone"), 0);
+    EXPECT_EQ(ids.size(), 1);
+    EXPECT_EQ(ids.find(legacy(second)), 0);
+}
+
+TEST(BlockTypeIdsTest, ReportsUnknownTypes)
+{
+    int stone = 0, other = 0;
+    BlockTypeIds ids;
+    ids.add(legacy(stone), "minecraft:stone");
+    EXPECT_EQ(ids.find(legacy(other)), BlockTypeIds::Unknown);
+    EXPECT_EQ(ids.find("minecraft:dirt"), BlockTypeIds::Unknown);
+    EXPECT_TRUE(ids.getName(BlockTypeIds::Unknown).empty());
+    EXPECT_TRUE(ids.getName(1).empty());
+}
+
+TEST(BlockTypeIdsTest, KeepsNamesValidWhileGrowing)
+{
+    std::vector<int> storage(1000);
+    BlockTypeIds ids;
+    ids.add(legacy(storage[0]), "minecraft:stone");
+    auto name = ids.getName(0);
+    for (std::size_t i = 1; i < storage.size(); i++) {
+        ids.add(legacy(storage[i]), "test:block_" + std::to_string(i));
+    }
+    EXPECT_EQ(name, "minecraft:stone");
+    EXPECT_EQ(ids.find("test:block_999"), 999);
+}
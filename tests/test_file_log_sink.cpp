@@ -0,0 +1,140 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+#include <zlib.h>
+
+#include "endstone/detail/spdlog/file_log_sink.h"
+
+namespace endstone::detail {
+
+class FileLogSinkTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        const auto *test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+        dir_ = std::filesystem::temp_directory_path() / ("endstone_file_log_sink_" + std::string(test_info->name()));
+        std::filesystem::remove_all(dir_);
+        std::filesystem::create_directories(dir_);
+        base_ = (dir_ / "latest.log").string();
+        pattern_ = (dir_ / "{:%Y-%m-%d}-{}.log").string();
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(dir_);
+    }
+
+    void logLines(const std::shared_ptr<FileLogSink> &sink, int count)
+    {
+        spdlog::logger logger("Test", sink);
+        for (int i = 0; i < count; ++i) {
+            logger.info("line {}", i);
+        }
+        logger.flush();
+    }
+
+    static int countLines(const std::string &filename)
+    {
+        std::ifstream file(filename);
+        int count = 0;
+        for (std::string line; std::getline(file, line);) {
+            ++count;
+        }
+        return count;
+    }
+
+    static int countCompressedLines(const std::string &filename)
+    {
+        auto *file = gzopen(filename.c_str(), "rb");
+        if (file == nullptr) {
+            return -1;
+        }
+        int count = 0;
+        char buffer[256];
+        while (gzgets(file, buffer, sizeof(buffer)) != nullptr) {
+            ++count;
+        }
+        gzclose(file);
+        return count;
+    }
+
+    std::filesystem::path dir_;
+    std::string base_;
+    std::string pattern_;
+};
+
+TEST_F(FileLogSinkTest, RotatesWhenSizeExceeded)
+{
+    auto sink = std::make_shared<FileLogSink>(base_, pattern_, 100, 1024);
+    logLines(sink, 200);
+
+    int total = countLines(base_);
+    int rotated = 0;
+    for (std::size_t i = 1; std::filesystem::exists(FileLogSink::calcFilename(base_, pattern_, i)); ++i) {
+        auto filename = FileLogSink::calcFilename(base_, pattern_, i);
+        ASSERT_LE(std::filesystem::file_size(filename), 1024);
+        total += countLines(filename);
+        ++rotated;
+    }
+    ASSERT_GT(rotated, 1);
+    ASSERT_LE(std::filesystem::file_size(base_), 1024);
+    ASSERT_EQ(total, 200);
+}
+
+TEST_F(FileLogSinkTest, RotatesExistingFileToNextFreeIndex)
+{
+    std::ofstream(base_) << "first\n";
+    std::make_shared<FileLogSink>(base_, pattern_, 100);
+    std::ofstream(base_) << "second\n";
+    std::make_shared<FileLogSink>(base_, pattern_, 100);
+
+    std::ifstream first(FileLogSink::calcFilename(base_, pattern_, 1));
+    std::ifstream second(FileLogSink::calcFilename(base_, pattern_, 2));
+    std::string line;
+    ASSERT_TRUE(std::getline(first, line));
+    ASSERT_EQ(line, "first");
+    ASSERT_TRUE(std::getline(second, line));
+    ASSERT_EQ(line, "second");
+    ASSERT_EQ(std::filesystem::file_size(base_), 0);
+}
+
+TEST_F(FileLogSinkTest, CompressesRotatedFiles)
+{
+    auto sink = std::make_shared<FileLogSink>(base_, pattern_, 100, 1024, true);
+    logLines(sink, 200);
+    sink.reset();
+
+    int total = countLines(base_);
+    int rotated = 0;
+    for (std::size_t i = 1;; ++i) {
+        auto filename = FileLogSink::calcFilename(base_, pattern_, i);
+        if (!std::filesystem::exists(filename + ".gz")) {
+            break;
+        }
+        ASSERT_FALSE(std::filesystem::exists(filename));
+        total += countCompressedLines(filename + ".gz");
+        ++rotated;
+    }
+    ASSERT_GT(rotated, 1);
+    ASSERT_EQ(total, 200);
+}
+
+}  // namespace endstone::detail
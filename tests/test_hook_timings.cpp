@@ -0,0 +1,91 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/hook_timings.h"
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+using endstone::detail::HookTimer;
+using endstone::detail::HookTimings;
+using namespace std::chrono_literals;
+
+class HookTimingsTest : public ::testing::Test {
+protected:
+    void TearDown() override
+    {
+        HookTimings::setEnabled(false);
+        HookTimings::getInstance().reset();
+    }
+};
+
+TEST_F(HookTimingsTest, DetourAndOriginal)
+{
+    auto &timings = HookTimings::getInstance();
+    auto &entry = timings.getEntry("Level::tick()");
+    EXPECT_EQ(&entry, &timings.getEntry("Level::tick()"));
+
+    entry.detour.record(5ms);
+    entry.detour.record(7ms);
+    entry.original.record(4ms);
+    entry.original.record(6ms);
+
+    auto result = timings.getTimings();
+    ASSERT_EQ(result.size(), 1);
+    EXPECT_EQ(result[0].name, "Level::tick()");
+    EXPECT_EQ(result[0].detour_count, 2);
+    EXPECT_EQ(result[0].detour_total, 12ms);
+    EXPECT_EQ(result[0].detour_max, 7ms);
+    EXPECT_LE(result[0].detour_p99, 7ms);
+    EXPECT_GT(result[0].detour_p99, 5ms);
+    EXPECT_EQ(result[0].original_count, 2);
+    EXPECT_EQ(result[0].original_total, 10ms);
+    EXPECT_EQ(result[0].original_max, 6ms);
+}
+
+TEST_F(HookTimingsTest, ResetKeepsEntries)
+{
+    auto &timings = HookTimings::getInstance();
+    auto &entry = timings.getEntry("Actor::teleportTo()");
+    entry.original.record(1ms);
+    ASSERT_EQ(timings.getTimings().size(), 1);
+
+    timings.reset();
+    EXPECT_TRUE(timings.getTimings().empty());
+
+    entry.original.record(2ms);
+    auto result = timings.getTimings();
+    ASSERT_EQ(result.size(), 1);
+    EXPECT_EQ(result[0].detour_count, 0);
+    EXPECT_EQ(result[0].original_count, 1);
+    EXPECT_EQ(result[0].original_total, 2ms);
+}
+
+TEST_F(HookTimingsTest, Timer)
+{
+    auto &entry = HookTimings::getInstance().getEntry("RNS2_Windows_Linux_360::Send_Windows_Linux_360NoVDP()");
+    {
+        HookTimer timer(nullptr);
+    }
+    EXPECT_TRUE(HookTimings::getInstance().getTimings().empty());
+
+    {
+        HookTimer timer(&entry.detour);
+    }
+    auto result = HookTimings::getInstance().getTimings();
+    ASSERT_EQ(result.size(), 1);
+    EXPECT_EQ(result[0].detour_count, 1);
+    EXPECT_EQ(result[0].original_count, 0);
+}
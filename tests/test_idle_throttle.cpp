@@ -0,0 +1,64 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/idle_throttle.h"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using endstone::detail::IdleThrottle;
+
+TEST(IdleThrottleTest, ThrottlesOnceEmptyForLongEnough)
+{
+    IdleThrottle throttle(4, 3);
+    for (auto i = 0; i < 3; i++) {
+        EXPECT_TRUE(throttle.tick(0));
+        EXPECT_FALSE(throttle.isIdle());
+    }
+
+    std::vector<bool> ticked;
+    for (auto i = 0; i < 9; i++) {
+        ticked.push_back(throttle.tick(0));
+    }
+    EXPECT_TRUE(throttle.isIdle());
+    EXPECT_EQ(ticked, (std::vector<bool>{true, false, false, false, true, false, false, false, true}));
+    EXPECT_EQ(throttle.getSkippedTicks(), 6);
+}
+
+TEST(IdleThrottleTest, TicksAgainWhenAPlayerIsOnline)
+{
+    IdleThrottle throttle(4, 0);
+    EXPECT_TRUE(throttle.tick(0));
+    EXPECT_FALSE(throttle.tick(0));
+    EXPECT_TRUE(throttle.isIdle());
+
+    EXPECT_TRUE(throttle.tick(1));
+    EXPECT_FALSE(throttle.isIdle());
+    EXPECT_TRUE(throttle.tick(1));
+
+    // Throttling starts over from the first empty tick
+    EXPECT_TRUE(throttle.tick(0));
+    EXPECT_FALSE(throttle.tick(0));
+}
+
+TEST(IdleThrottleTest, NeverThrottlesWithAnIntervalOfOne)
+{
+    IdleThrottle throttle(1, 0);
+    for (auto i = 0; i < 10; i++) {
+        EXPECT_TRUE(throttle.tick(0));
+    }
+    EXPECT_FALSE(throttle.isIdle());
+    EXPECT_EQ(throttle.getSkippedTicks(), 0);
+}
@@ -0,0 +1,54 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/join_storm.h"
+
+#include <gtest/gtest.h>
+
+using endstone::detail::JoinStorm;
+
+TEST(JoinStormTest, StartsAtThresholdWithinWindow)
+{
+    JoinStorm storm(4, 100);
+    EXPECT_FALSE(storm.onJoin(0));
+    EXPECT_FALSE(storm.onJoin(50));
+    EXPECT_FALSE(storm.onJoin(120));  // the join at tick 0 is out of the window
+    EXPECT_FALSE(storm.onJoin(130));
+    EXPECT_FALSE(storm.isActive());
+
+    EXPECT_TRUE(storm.onJoin(140));
+    EXPECT_TRUE(storm.isActive());
+    EXPECT_EQ(storm.getJoinCount(), 4);
+    EXPECT_EQ(storm.getStartTick(), 50);
+
+    EXPECT_FALSE(storm.onJoin(141));
+    EXPECT_EQ(storm.getJoinCount(), 5);
+}
+
+TEST(JoinStormTest, EndsBelowHalfTheThreshold)
+{
+    JoinStorm storm(4, 100);
+    for (auto i = 0; i < 4; i++) {
+        storm.onJoin(10);
+    }
+    storm.onJoin(60);
+    EXPECT_TRUE(storm.isActive());
+
+    // The joins at tick 10 leave the window at tick 110, leaving one within it
+    EXPECT_FALSE(storm.tick(109));
+    EXPECT_TRUE(storm.tick(110));
+    EXPECT_FALSE(storm.isActive());
+    EXPECT_FALSE(storm.tick(111));
+    EXPECT_EQ(storm.getJoinCount(), 5);
+}
@@ -0,0 +1,44 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/join_timings.h"
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+using endstone::detail::JoinPhase;
+using endstone::detail::JoinTimings;
+using namespace std::chrono_literals;
+
+TEST(JoinTimingsTest, PhasesInPipelineOrder)
+{
+    JoinTimings timings;
+    timings.record(JoinPhase::Commands, 3ms);
+    timings.record(JoinPhase::LoadPlayer, 20ms);
+    timings.record(JoinPhase::LoadPlayer, 40ms);
+
+    auto result = timings.getTimings();
+    ASSERT_EQ(result.size(), 2);
+    EXPECT_EQ(result[0].phase, JoinPhase::LoadPlayer);
+    EXPECT_EQ(result[0].count, 2);
+    EXPECT_EQ(result[0].total, 60ms);
+    EXPECT_EQ(result[0].max, 40ms);
+    EXPECT_LE(result[0].p99, 40ms);
+    EXPECT_GT(result[0].p99, 20ms);
+    EXPECT_EQ(result[1].phase, JoinPhase::Commands);
+
+    timings.reset();
+    EXPECT_TRUE(timings.getTimings().empty());
+}
@@ -0,0 +1,70 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <spdlog/details/os.h>
+
+#include "endstone/detail/spdlog/json_log_formatter.h"
+
+namespace endstone::detail {
+
+class JsonLogFormatterTest : public ::testing::Test {
+protected:
+    static std::string format(JsonLogFormatter &formatter, spdlog::string_view_t payload,
+                              spdlog::source_loc source = {})
+    {
+        spdlog::details::log_msg msg{source, "Test", spdlog::level::info, payload};
+        msg.time = spdlog::log_clock::time_point(std::chrono::milliseconds(1714563296789));
+        msg.thread_id = 42;
+        spdlog::memory_buf_t dest;
+        formatter.format(msg, dest);
+        return {dest.data(), dest.size()};
+    }
+
+    static std::string line(const std::string &fields)
+    {
+        return R"({"time":"2024-05-01T11:34:56.789Z","level":"info","logger":"Test","thread":42)" + fields + "}" +
+               spdlog::details::os::default_eol;
+    }
+};
+
+TEST_F(JsonLogFormatterTest, WritesFields)
+{
+    JsonLogFormatter formatter;
+    ASSERT_EQ(format(formatter, "Hello"), line(R"(,"message":"Hello")"));
+    ASSERT_EQ(format(formatter, "Hello", {"main.cpp", 12, "main"}),
+              line(R"(,"file":"main.cpp","line":12,"message":"Hello")"));
+}
+
+TEST_F(JsonLogFormatterTest, EscapesMessage)
+{
+    JsonLogFormatter formatter;
+    ASSERT_EQ(format(formatter, "a \"quoted\" \\path\\\nnext\tline\x01"),
+              line(R"(,"message":"a \"quoted\" \\path\\\nnext\tline\u0001")"));
+}
+
+TEST_F(JsonLogFormatterTest, StripsColorCodes)
+{
+    JsonLogFormatter strip;
+    ASSERT_EQ(format(strip, "\xC2\xA7" "aGreen\xC2\xA7r caf\xC3\xA9 \xC2\xB1"),
+              line(",\"message\":\"Green caf\xC3\xA9 \xC2\xB1\""));
+
+    JsonLogFormatter keep(false);
+    ASSERT_EQ(format(keep, "\xC2\xA7" "aGreen"), line(",\"message\":\"\xC2\xA7" "aGreen\""));
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,119 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <spdlog/sinks/ostream_sink.h>
+
+#include "endstone/detail/spdlog/log_rate_limiter.h"
+#include "endstone/detail/spdlog/spdlog_adapter.h"
+
+namespace endstone::detail {
+
+class LogRateLimiterTest : public ::testing::Test {
+protected:
+    LogRateLimiter limiter_;
+    LogRateLimiter::Clock::time_point now_ = LogRateLimiter::Clock::now();
+};
+
+TEST_F(LogRateLimiterTest, DisabledByDefault)
+{
+    ASSERT_FALSE(limiter_.isEnabled());
+    limiter_.setLimit({});
+    ASSERT_FALSE(limiter_.isEnabled());
+}
+
+TEST_F(LogRateLimiterTest, TokenBucket)
+{
+    LogRateLimit limit;
+    limit.messages_per_second = 2;
+    limit.burst = 3;
+    limiter_.setLimit(limit);
+    ASSERT_TRUE(limiter_.isEnabled());
+
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(limiter_.check("message", now_).allowed);
+    }
+    ASSERT_FALSE(limiter_.check("message", now_).allowed);
+    ASSERT_FALSE(limiter_.check("other", now_).allowed);
+
+    // Half a second refills one token, and the message written reports what was suppressed
+    auto decision = limiter_.check("message", now_ + std::chrono::milliseconds(500));
+    ASSERT_TRUE(decision.allowed);
+    ASSERT_EQ(decision.suppressed, 2);
+    ASSERT_FALSE(limiter_.check("message", now_ + std::chrono::milliseconds(500)).allowed);
+}
+
+TEST_F(LogRateLimiterTest, FirstThenEvery)
+{
+    LogRateLimit limit;
+    limit.repeat_first = 2;
+    limit.repeat_every = 3;
+    limiter_.setLimit(limit);
+
+    std::vector<bool> allowed;
+    std::vector<std::size_t> repeats;
+    for (int i = 0; i < 8; ++i) {
+        auto decision = limiter_.check("spam", now_);
+        allowed.push_back(decision.allowed);
+        repeats.push_back(decision.repeats);
+    }
+    ASSERT_EQ(allowed, (std::vector<bool>{true, true, false, false, true, false, false, true}));
+    ASSERT_EQ(repeats[4], 2);
+    ASSERT_EQ(repeats[7], 2);
+
+    // Other messages are counted separately
+    ASSERT_TRUE(limiter_.check("other", now_).allowed);
+}
+
+TEST_F(LogRateLimiterTest, RepeatIntervalStartsOver)
+{
+    LogRateLimit limit;
+    limit.repeat_first = 1;
+    limit.repeat_interval = std::chrono::seconds(10);
+    limiter_.setLimit(limit);
+
+    ASSERT_TRUE(limiter_.check("spam", now_).allowed);
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_FALSE(limiter_.check("spam", now_ + std::chrono::seconds(1)).allowed);
+    }
+    auto decision = limiter_.check("spam", now_ + std::chrono::seconds(10));
+    ASSERT_TRUE(decision.allowed);
+    ASSERT_EQ(decision.repeats, 5);
+}
+
+TEST_F(LogRateLimiterTest, SummarizesRepeatsInLogger)
+{
+    std::ostringstream output;
+    auto sink = std::make_shared<spdlog::sinks::ostream_sink_st>(output);
+    sink->set_pattern("%v");
+    SpdLogAdapter logger(std::make_shared<spdlog::logger>("Test", sink));
+
+    LogRateLimit limit;
+    limit.repeat_first = 1;
+    limit.repeat_every = 4;
+    logger.setRateLimit(limit);
+    for (int i = 0; i < 5; ++i) {
+        logger.error("Something failed");
+    }
+    ASSERT_EQ(output.str(), std::string("Something failed") + spdlog::details::os::default_eol +
+                                "Something failed (message repeated 3 times)" + spdlog::details::os::default_eol);
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,59 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/memory_usage.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <spdlog/sinks/null_sink.h>
+
+#include "endstone/detail/spdlog/async_log_sink.h"
+
+using endstone::detail::AsyncLogSink;
+using endstone::detail::MemorySubsystem;
+using endstone::detail::MemoryUsage;
+
+TEST(MemoryUsageTest, AddAndRemove)
+{
+    auto &usage = MemoryUsage::getInstance();
+    const auto before = usage.get(MemorySubsystem::Forms);
+    usage.add(MemorySubsystem::Forms, 100);
+    usage.add(MemorySubsystem::Forms, 50);
+    EXPECT_EQ(usage.get(MemorySubsystem::Forms), before + 150);
+    usage.remove(MemorySubsystem::Forms, 150);
+    EXPECT_EQ(usage.get(MemorySubsystem::Forms), before);
+    EXPECT_EQ(MemoryUsage::getName(MemorySubsystem::EventHandlers), "Event handlers");
+}
+
+TEST(MemoryUsageTest, CountsLogBuffers)
+{
+    auto &usage = MemoryUsage::getInstance();
+    const auto before = usage.get(MemorySubsystem::LogBuffers);
+    {
+        auto sink = std::make_shared<AsyncLogSink>(
+            std::vector<spdlog::sink_ptr>{std::make_shared<spdlog::sinks::null_sink_mt>()}, 16);
+        const auto empty = usage.get(MemorySubsystem::LogBuffers);
+        EXPECT_GT(empty, before);
+
+        // A message longer than the inline storage of a slot grows its buffer on the heap
+        spdlog::logger logger("test", sink);
+        logger.info(std::string(4096, 'x'));
+        sink->flush();
+        EXPECT_GE(usage.get(MemorySubsystem::LogBuffers), empty + 4096);
+    }
+    EXPECT_EQ(usage.get(MemorySubsystem::LogBuffers), before);
+}
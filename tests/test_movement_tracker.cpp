@@ -0,0 +1,113 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/movement_tracker.h"
+
+namespace endstone::detail {
+
+TEST(MovementTrackerTest, ComputesSpeeds)
+{
+    MovementTracker tracker;
+    auto walker = tracker.addSlot();
+    auto idle = tracker.addSlot();
+    for (int tick = 0; tick < 5; tick++) {
+        // 0.2 blocks per tick along x and 0.15 along z is 5 blocks per second, while falling 0.5 blocks per tick
+        tracker.record(walker, 0.2F * static_cast<float>(tick), 64.0F - (0.5F * static_cast<float>(tick)),
+                       0.15F * static_cast<float>(tick), 0);
+        tracker.record(idle, 10.0F, 64.0F, 10.0F, 0);
+        tracker.advance();
+    }
+
+    auto stats = tracker.getStats(walker);
+    EXPECT_NEAR(stats.horizontal_speed, 5.0F, 1e-3F);
+    EXPECT_NEAR(stats.vertical_speed, -10.0F, 1e-3F);
+    EXPECT_NEAR(stats.peak_horizontal_speed, 5.0F, 1e-3F);
+    EXPECT_NEAR(stats.peak_horizontal_acceleration, 0.0F, 1e-2F);
+    EXPECT_EQ(tracker.getStats(idle).peak_horizontal_speed, 0.0F);
+    EXPECT_TRUE(tracker.findAnomalies(6.0F, 100.0F).empty());
+    EXPECT_EQ(tracker.findAnomalies(4.0F, 100.0F), std::vector<std::size_t>{walker});
+}
+
+TEST(MovementTrackerTest, FlagsBurstsForOneSecond)
+{
+    MovementTracker tracker;
+    auto slot = tracker.addSlot();
+    float x = 0;
+    for (int tick = 0; tick < 5; tick++) {
+        tracker.record(slot, x, 64.0F, 0.0F, 0);
+        tracker.advance();
+    }
+    // A single tick covering 3 blocks: 60 blocks per second, reached from standing still
+    x += 3.0F;
+    tracker.record(slot, x, 64.0F, 0.0F, 0);
+    tracker.advance();
+    EXPECT_NEAR(tracker.getStats(slot).peak_horizontal_speed, 60.0F, 1e-3F);
+    EXPECT_NEAR(tracker.getStats(slot).peak_horizontal_acceleration, 1200.0F, 1e-1F);
+    EXPECT_EQ(tracker.findAnomalies(10.0F, 1000.0F).size(), 1);
+
+    // Stopping right after is as sudden, both leave the window a second later
+    for (std::size_t tick = 0; tick <= MovementTracker::HistoryTicks; tick++) {
+        tracker.record(slot, x, 64.0F, 0.0F, 0);
+        tracker.advance();
+    }
+    EXPECT_EQ(tracker.getStats(slot).peak_horizontal_speed, 0.0F);
+    EXPECT_TRUE(tracker.findAnomalies(10.0F, 1000.0F).empty());
+}
+
+TEST(MovementTrackerTest, StartsOverAfterTeleportsAndDimensionChanges)
+{
+    MovementTracker tracker;
+    auto slot = tracker.addSlot();
+    for (int tick = 0; tick < 3; tick++) {
+        tracker.record(slot, 0.0F, 64.0F, 0.0F, 0);
+        tracker.advance();
+    }
+
+    tracker.reset(slot);
+    tracker.record(slot, 1000.0F, 64.0F, 0.0F, 0);
+    tracker.advance();
+    tracker.record(slot, 1000.0F, 64.0F, 0.0F, 0);
+    tracker.advance();
+    EXPECT_EQ(tracker.getStats(slot).peak_horizontal_speed, 0.0F);
+
+    tracker.record(slot, 125.0F, 64.0F, 0.0F, 1);
+    tracker.advance();
+    tracker.record(slot, 125.0F, 64.0F, 0.0F, 1);
+    tracker.advance();
+    EXPECT_EQ(tracker.getStats(slot).peak_horizontal_speed, 0.0F);
+    EXPECT_EQ(tracker.getStats(slot).peak_horizontal_acceleration, 0.0F);
+}
+
+TEST(MovementTrackerTest, ReusesSlots)
+{
+    MovementTracker tracker;
+    auto first = tracker.addSlot();
+    auto second = tracker.addSlot();
+    tracker.record(first, 0.0F, 64.0F, 0.0F, 0);
+    tracker.advance();
+    tracker.record(first, 5.0F, 64.0F, 0.0F, 0);
+    tracker.advance();
+    ASSERT_GT(tracker.getStats(first).peak_horizontal_speed, 0.0F);
+
+    tracker.removeSlot(first);
+    EXPECT_TRUE(tracker.findAnomalies(1.0F, 1.0F).empty());
+    EXPECT_EQ(tracker.addSlot(), first);
+    EXPECT_EQ(tracker.getStats(first).peak_horizontal_speed, 0.0F);
+    EXPECT_EQ(tracker.getCapacity(), 2);
+    EXPECT_NE(first, second);
+}
+
+}  // namespace endstone::detail
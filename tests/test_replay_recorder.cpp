@@ -0,0 +1,130 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/replay_recorder.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using endstone::detail::ReplayReader;
+using endstone::detail::ReplayRecord;
+using endstone::detail::ReplayRecorder;
+using namespace std::chrono_literals;
+
+namespace {
+std::string readFile(const std::filesystem::path &path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+}  // namespace
+
+class ReplayRecorderTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        path_ = std::filesystem::temp_directory_path() / "endstone_test_replay.bin";
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(path_);
+    }
+
+    std::filesystem::path path_;
+};
+
+TEST_F(ReplayRecorderTest, RoundTrip)
+{
+    {
+        ReplayRecorder recorder(path_.string());
+        ASSERT_TRUE(recorder.isOpen());
+        recorder.recordPacket(9, 1, std::string("he\0llo", 6));
+        recorder.recordCommand("Server", "say hi");
+        recorder.recordTick(42, {1ms, 30ms, 200us});
+        recorder.flush();
+        EXPECT_EQ(recorder.getDroppedCount(), 0);
+        EXPECT_GT(recorder.getWrittenBytes(), 0);
+    }
+
+    auto records = ReplayReader::read(readFile(path_));
+    ASSERT_TRUE(records.has_value());
+    ASSERT_EQ(records->size(), 3);
+
+    const auto &packet = (*records)[0];
+    EXPECT_EQ(packet.type, ReplayRecord::Type::Packet);
+    EXPECT_EQ(packet.packet_id, 9);
+    EXPECT_EQ(packet.sub_client_id, 1);
+    EXPECT_EQ(packet.data, std::string("he\0llo", 6));
+
+    const auto &command = (*records)[1];
+    EXPECT_EQ(command.type, ReplayRecord::Type::Command);
+    EXPECT_EQ(command.sender, "Server");
+    EXPECT_EQ(command.data, "say hi");
+    EXPECT_GE(command.time_us, packet.time_us);
+
+    const auto &tick = (*records)[2];
+    EXPECT_EQ(tick.type, ReplayRecord::Type::Tick);
+    EXPECT_EQ(tick.tick, 42);
+    EXPECT_EQ(tick.timings.scheduler, 1ms);
+    EXPECT_EQ(tick.timings.level, 30ms);
+    EXPECT_EQ(tick.timings.post_tick, 200us);
+}
+
+TEST_F(ReplayRecorderTest, WritesOnDestruction)
+{
+    {
+        ReplayRecorder recorder(path_.string());
+        for (int i = 0; i < 1000; ++i) {
+            recorder.recordTick(i, {});
+        }
+    }
+
+    auto records = ReplayReader::read(readFile(path_));
+    ASSERT_TRUE(records.has_value());
+    ASSERT_EQ(records->size(), 1000);
+    EXPECT_EQ(records->back().tick, 999);
+}
+
+TEST_F(ReplayRecorderTest, TruncatedRecordEndsList)
+{
+    {
+        ReplayRecorder recorder(path_.string());
+        recorder.recordCommand("Server", "list");
+        recorder.recordPacket(1, 0, std::string(100, 'x'));
+    }
+
+    auto data = readFile(path_);
+    data.resize(data.size() - 10);
+    auto records = ReplayReader::read(data);
+    ASSERT_TRUE(records.has_value());
+    ASSERT_EQ(records->size(), 1);
+    EXPECT_EQ(records->front().data, "list");
+}
+
+TEST(ReplayReaderTest, RejectsUnknownLogs)
+{
+    EXPECT_FALSE(ReplayReader::read("").has_value());
+    EXPECT_FALSE(ReplayReader::read("ESRQ\x01").has_value());
+    EXPECT_FALSE(ReplayReader::read("ESRP\x02").has_value());
+
+    auto records = ReplayReader::read("ESRP\x01");
+    ASSERT_TRUE(records.has_value());
+    EXPECT_TRUE(records->empty());
+}
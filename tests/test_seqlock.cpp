@@ -0,0 +1,97 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/seqlock.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/player.h"
+
+using endstone::GameMode;
+using endstone::Player;
+using endstone::detail::Seqlock;
+
+namespace {
+struct Wide {
+    std::uint64_t values[7];  // Larger than a word, so a torn read would show as mismatched values
+};
+}  // namespace
+
+TEST(SeqlockTest, LoadsLastStore)
+{
+    Seqlock<Player::Snapshot> seqlock;
+    EXPECT_EQ(seqlock.load().tick, 0);
+
+    Player::Snapshot snapshot;
+    snapshot.tick = 42;
+    snapshot.x = 1.5F;
+    snapshot.yaw = 90.0F;
+    snapshot.game_mode = GameMode::Creative;
+    snapshot.ping = std::chrono::milliseconds(35);
+    seqlock.store(snapshot);
+
+    auto loaded = seqlock.load();
+    EXPECT_EQ(loaded.tick, 42);
+    EXPECT_EQ(loaded.x, 1.5F);
+    EXPECT_EQ(loaded.yaw, 90.0F);
+    EXPECT_EQ(loaded.game_mode, GameMode::Creative);
+    EXPECT_EQ(loaded.ping, std::chrono::milliseconds(35));
+}
+
+TEST(SeqlockTest, ReadersNeverSeeTornValues)
+{
+    Seqlock<Wide> seqlock;
+    std::atomic<bool> done{false};
+    std::atomic<std::uint64_t> torn{0};
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; ++i) {
+        readers.emplace_back([&]() {
+            std::uint64_t last = 0;
+            while (!done.load(std::memory_order_relaxed)) {
+                auto value = seqlock.load();
+                for (auto v : value.values) {
+                    if (v != value.values[0]) {
+                        torn.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+                // A single writer stores increasing values, readers never go back in time
+                if (value.values[0] < last) {
+                    torn.fetch_add(1, std::memory_order_relaxed);
+                }
+                last = value.values[0];
+            }
+        });
+    }
+
+    for (std::uint64_t i = 1; i <= 200000; ++i) {
+        Wide value;
+        for (auto &v : value.values) {
+            v = i;
+        }
+        seqlock.store(value);
+    }
+    done = true;
+    for (auto &reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(torn.load(), 0);
+    EXPECT_EQ(seqlock.load().values[0], 200000);
+}
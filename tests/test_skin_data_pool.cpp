@@ -0,0 +1,62 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/skin_data_pool.h"
+#include "endstone/skin.h"
+
+using endstone::Skin;
+using endstone::detail::SkinDataPool;
+
+TEST(SkinDataPoolTest, SharesIdenticalData)
+{
+    SkinDataPool pool;
+    auto steve = pool.intern(std::string(64 * 64 * 4, '\x7f'));
+    auto other = pool.intern(std::string(64 * 64 * 4, '\x7f'));
+    auto alex = pool.intern(std::string(64 * 64 * 4, '\x10'));
+    EXPECT_EQ(steve, other);
+    EXPECT_NE(steve, alex);
+    EXPECT_EQ(pool.size(), 2);
+}
+
+TEST(SkinDataPoolTest, ReleasesUnusedData)
+{
+    SkinDataPool pool;
+    auto steve = pool.intern(std::string(16, 'a'));
+    {
+        auto alex = pool.intern(std::string(16, 'b'));
+        EXPECT_EQ(pool.size(), 2);
+    }
+    EXPECT_EQ(pool.size(), 1);
+
+    // Entries of released buffers are swept once enough new data has been interned
+    for (auto i = 0; i < 200; ++i) {
+        auto data = pool.intern(std::to_string(i));
+    }
+    EXPECT_EQ(pool.size(), 1);
+    EXPECT_EQ(pool.intern(std::string(16, 'a')), steve);
+}
+
+TEST(SkinDataPoolTest, CopiesOfSkinsShareImageData)
+{
+    Skin skin{"steve", {64, 64, std::string(64 * 64 * 4, '\x7f')}};
+    auto copy = skin;
+    EXPECT_EQ(copy.getSkinData().getBuffer(), skin.getSkinData().getBuffer());
+    EXPECT_EQ(copy.getSkinData().getData().data(), skin.getSkinData().getData().data());
+    EXPECT_EQ(copy.getSkinData().getData().size(), 64 * 64 * 4);
+    EXPECT_TRUE(Skin{}.getSkinData().getData().empty());
+}
@@ -0,0 +1,67 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/startup_timings.h"
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/logger_factory.h"
+
+using endstone::detail::StartupTimings;
+using namespace std::chrono_literals;
+
+TEST(StartupTimingsTest, RecordsPhasesInOrder)
+{
+    StartupTimings timings;
+    timings.record("Python interpreter", 20ms);
+    timings.record("Hook installation", 5ms);
+
+    auto phases = timings.getPhases();
+    ASSERT_EQ(phases.size(), 2);
+    EXPECT_EQ(phases[0].name, "Python interpreter");
+    EXPECT_EQ(phases[0].elapsed, 20ms);
+    EXPECT_EQ(phases[1].name, "Hook installation");
+}
+
+TEST(StartupTimingsTest, AccumulatesPlugins)
+{
+    StartupTimings timings;
+    timings.recordLoad("first", 3ms);
+    timings.recordLoad("second", 1ms);
+    timings.recordEnable("first", 7ms);
+    timings.recordEnable("first", 1ms);
+
+    auto plugins = timings.getPlugins();
+    ASSERT_EQ(plugins.size(), 2);
+    EXPECT_EQ(plugins[0].name, "first");
+    EXPECT_EQ(plugins[0].load, 3ms);
+    EXPECT_EQ(plugins[0].enable, 8ms);
+    EXPECT_EQ(plugins[1].name, "second");
+    EXPECT_EQ(plugins[1].enable, 0ms);
+}
+
+TEST(StartupTimingsTest, StopsRecordingOnceReported)
+{
+    StartupTimings timings;
+    timings.record("Plugin loading", 1ms);
+    timings.recordLoad("first", 1ms);
+    timings.report(endstone::detail::LoggerFactory::getLogger("StartupTimingsTest"));
+
+    timings.record("World initialisation", 1ms);
+    timings.recordEnable("first", 1ms);
+    EXPECT_TRUE(timings.getPhases().empty());
+    EXPECT_TRUE(timings.getPlugins().empty());
+}
@@ -0,0 +1,60 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/spdlog/text_formatter.h"
+
+namespace endstone::detail {
+
+class TextFormatterTest : public ::testing::Test {
+protected:
+    static std::string format(TextFormatter &formatter, spdlog::string_view_t payload)
+    {
+        spdlog::details::log_msg msg{"Test", spdlog::level::info, payload};
+        spdlog::memory_buf_t dest;
+        formatter.format(msg, {}, dest);
+        return {dest.data(), dest.size()};
+    }
+};
+
+TEST_F(TextFormatterTest, StripsColorCodes)
+{
+    TextFormatter formatter(false);
+    ASSERT_EQ(format(formatter, "Hello"), "Hello");
+    ASSERT_EQ(format(formatter, ColorFormat::Green + "Green" + ColorFormat::Reset + " caf\xC3\xA9 \xC2\xB1"),
+              "Green caf\xC3\xA9 \xC2\xB1");
+    ASSERT_EQ(format(formatter, ColorFormat::Bold + ColorFormat::Red), "");
+}
+
+TEST_F(TextFormatterTest, TranslatesColorCodes)
+{
+    TextFormatter formatter(true);
+    ASSERT_EQ(format(formatter, ColorFormat::Green + "Green" + ColorFormat::Reset), "\x1b[92mGreen\x1b[0m");
+    ASSERT_EQ(format(formatter, ColorFormat::MaterialGold + "Gold"), "\x1b[38;2;222;177;45mGold");
+    // Codes without an escape sequence keep the code character
+    ASSERT_EQ(format(formatter, "\xC2\xA7zText"), "zText");
+}
+
+TEST_F(TextFormatterTest, KeepsIncompleteCodes)
+{
+    TextFormatter formatter(false);
+    ASSERT_EQ(format(formatter, "Trailing \xC2\xA7"), "Trailing \xC2\xA7");
+    ASSERT_EQ(format(formatter, "\xC2"), "\xC2");
+    ASSERT_EQ(format(formatter, "\xC2\xC2\xA7" "aA"), "\xC2" "A");
+}
+
+}  // namespace endstone::detail
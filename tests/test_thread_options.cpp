@@ -0,0 +1,70 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/thread_options.h"
+
+#include <cstdlib>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using endstone::detail::ThreadOptions;
+using endstone::detail::os::ThreadPriority;
+
+TEST(ThreadOptionsTest, ParseAffinity)
+{
+    EXPECT_EQ(ThreadOptions::parseAffinity("3"), (std::vector<std::size_t>{3}));
+    EXPECT_EQ(ThreadOptions::parseAffinity("0-3,6"), (std::vector<std::size_t>{0, 1, 2, 3, 6}));
+    EXPECT_EQ(ThreadOptions::parseAffinity("2,4-5"), (std::vector<std::size_t>{2, 4, 5}));
+}
+
+TEST(ThreadOptionsTest, RejectInvalidAffinity)
+{
+    EXPECT_FALSE(ThreadOptions::parseAffinity(""));
+    EXPECT_FALSE(ThreadOptions::parseAffinity("a"));
+    EXPECT_FALSE(ThreadOptions::parseAffinity("3-1"));
+    EXPECT_FALSE(ThreadOptions::parseAffinity("1,,2"));
+    EXPECT_FALSE(ThreadOptions::parseAffinity("-1"));
+    EXPECT_FALSE(ThreadOptions::parseAffinity("0-100000"));
+}
+
+TEST(ThreadOptionsTest, ParsePriority)
+{
+    EXPECT_EQ(ThreadOptions::parsePriority("low"), ThreadPriority::Low);
+    EXPECT_EQ(ThreadOptions::parsePriority("normal"), ThreadPriority::Normal);
+    EXPECT_EQ(ThreadOptions::parsePriority("high"), ThreadPriority::High);
+    EXPECT_FALSE(ThreadOptions::parsePriority("realtime"));
+}
+
+TEST(ThreadOptionsTest, ApplyWithoutOptions)
+{
+    EXPECT_TRUE(ThreadOptions{}.apply());
+}
+
+#ifdef __linux__
+TEST(ThreadOptionsTest, FromEnvironment)
+{
+    setenv("ENDSTONE_TEST_THREAD_AFFINITY", "1-2", 1);
+    setenv("ENDSTONE_TEST_THREAD_PRIORITY", "low", 1);
+    auto options = ThreadOptions::fromEnvironment("TEST");
+    EXPECT_EQ(options.affinity, (std::vector<std::size_t>{1, 2}));
+    EXPECT_EQ(options.priority, ThreadPriority::Low);
+    unsetenv("ENDSTONE_TEST_THREAD_AFFINITY");
+    unsetenv("ENDSTONE_TEST_THREAD_PRIORITY");
+
+    options = ThreadOptions::fromEnvironment("TEST");
+    EXPECT_TRUE(options.affinity.empty());
+    EXPECT_FALSE(options.priority);
+}
+#endif
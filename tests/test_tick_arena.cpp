@@ -0,0 +1,68 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/tick_arena.h"
+
+namespace endstone::detail {
+
+TEST(TickArenaTest, AlignsAllocations)
+{
+    TickArena arena(256);
+    auto *byte = arena.allocate(1, 1);
+    auto *word = arena.allocate(8, 8);
+    EXPECT_NE(byte, word);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(word) % 8, 0);
+    EXPECT_EQ(arena.getAllocatedBytes(), 9);
+    EXPECT_EQ(arena.getBlockCount(), 1);
+}
+
+TEST(TickArenaTest, ReusesBlocksAfterReset)
+{
+    TickArena arena(256);
+    const auto *first = arena.allocate(200, 1);
+    arena.allocate(200, 1);
+    arena.allocate(1024, 8);
+    ASSERT_EQ(arena.getBlockCount(), 3);
+
+    // The regular blocks are kept, the oversized one is released
+    arena.reset();
+    EXPECT_EQ(arena.getAllocatedBytes(), 0);
+    EXPECT_EQ(arena.getBlockCount(), 2);
+    EXPECT_EQ(arena.allocate(200, 1), first);
+    arena.allocate(200, 1);
+    EXPECT_EQ(arena.getBlockCount(), 2);
+}
+
+TEST(TickArenaTest, BacksVectors)
+{
+    TickArena arena(1024);
+    ArenaVector<int> values{ArenaAllocator<int>(arena)};
+    for (int i = 0; i < 100; i++) {
+        values.push_back(i);
+    }
+    EXPECT_EQ(values[99], 99);
+    EXPECT_GE(arena.getAllocatedBytes(), 100 * sizeof(int));
+
+    // Default constructed, the allocator falls back to the heap
+    ArenaVector<int> heap;
+    heap.assign(values.begin(), values.end());
+    EXPECT_EQ(heap.size(), 100);
+    EXPECT_EQ(heap.get_allocator().getArena(), nullptr);
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,52 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/tick_clock.h"
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+using endstone::detail::TickClock;
+using namespace std::chrono_literals;
+
+namespace {
+const TickClock::Clock::time_point Start{1000s};
+}
+
+TEST(TickClockTest, AnchoredToFirstTick)
+{
+    TickClock clock;
+    EXPECT_EQ(clock.update(100, Start), 100);
+    EXPECT_EQ(clock.update(101, Start + 50ms), 101);
+    EXPECT_EQ(clock.update(102, Start + 120ms), 102);
+    EXPECT_EQ(clock.getTick(), 102);
+}
+
+TEST(TickClockTest, SkipsAheadWhileLagging)
+{
+    TickClock clock;
+    clock.update(0, Start);
+    EXPECT_EQ(clock.update(1, Start + 500ms), 10);
+    EXPECT_EQ(clock.update(2, Start + 1s), 20);
+}
+
+TEST(TickClockTest, NeverGoesBackwards)
+{
+    TickClock clock;
+    clock.update(0, Start);
+    EXPECT_EQ(clock.update(1, Start + 100ms), 2);
+    EXPECT_EQ(clock.update(2, Start - 1s), 2);
+    EXPECT_EQ(clock.update(3, Start + 60ms), 2);
+}
@@ -0,0 +1,63 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/tick_history.h"
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+using endstone::detail::TickHistory;
+using namespace std::chrono_literals;
+
+TEST(TickHistoryTest, Empty)
+{
+    TickHistory history;
+    EXPECT_EQ(history.size(), 0);
+    EXPECT_EQ(history.getAverage(20).getTotal(), 0ns);
+    EXPECT_EQ(history.getMax(20).getTotal(), 0ns);
+    EXPECT_TRUE(history.getSamples(20).empty());
+}
+
+TEST(TickHistoryTest, AverageAndMax)
+{
+    TickHistory history;
+    history.push({1ms, 10ms, 100us});
+    history.push({3ms, 20ms, 300us});
+    history.push({2ms, 30ms, 200us});
+
+    auto average = history.getAverage(2);
+    EXPECT_EQ(average.scheduler, 2500us);
+    EXPECT_EQ(average.level, 25ms);
+    EXPECT_EQ(average.post_tick, 250us);
+
+    auto max = history.getMax(3);
+    EXPECT_EQ(max.level, 30ms);
+    EXPECT_EQ(history.getAverage(100).level, 20ms);
+}
+
+TEST(TickHistoryTest, Wraparound)
+{
+    TickHistory history;
+    for (std::size_t i = 0; i < TickHistory::Capacity + 10; ++i) {
+        history.push({std::chrono::nanoseconds(i), 0ns, 0ns});
+    }
+    EXPECT_EQ(history.size(), TickHistory::Capacity);
+
+    auto samples = history.getSamples(3);
+    ASSERT_EQ(samples.size(), 3);
+    EXPECT_EQ(samples[0].scheduler.count(), TickHistory::Capacity + 7);
+    EXPECT_EQ(samples[2].scheduler.count(), TickHistory::Capacity + 9);
+    EXPECT_EQ(history.getSamples(TickHistory::Capacity * 2).front().scheduler.count(), 10);
+}
@@ -0,0 +1,87 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/tick_percentiles.h"
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+using endstone::TickWindow;
+using endstone::detail::TickPercentiles;
+using namespace std::chrono_literals;
+
+namespace {
+const TickPercentiles::Clock::time_point Start{1000s};
+}
+
+TEST(TickPercentilesTest, Empty)
+{
+    TickPercentiles percentiles;
+    auto statistics = percentiles.getStatistics(Start, TickWindow::OneMinute);
+    EXPECT_EQ(statistics.count, 0);
+    EXPECT_EQ(statistics.p99, 0us);
+    EXPECT_EQ(statistics.max, 0us);
+}
+
+TEST(TickPercentilesTest, PercentilesWithinBucketWidth)
+{
+    TickPercentiles percentiles;
+    for (int i = 1; i <= 100; ++i) {
+        percentiles.record(Start, std::chrono::microseconds(i * 1000));
+    }
+
+    auto statistics = percentiles.getStatistics(Start, TickWindow::OneSecond);
+    EXPECT_EQ(statistics.count, 100);
+    EXPECT_EQ(statistics.max, 100ms);
+    EXPECT_GE(statistics.p50, 50ms);
+    EXPECT_LE(statistics.p50, 52ms);
+    EXPECT_GE(statistics.p95, 95ms);
+    EXPECT_LE(statistics.p95, 99ms);
+    EXPECT_GE(statistics.p99, 99ms);
+    EXPECT_LE(statistics.p99, 100ms);
+}
+
+TEST(TickPercentilesTest, KeepsSubMillisecondTicks)
+{
+    TickPercentiles percentiles;
+    percentiles.record(Start, 7us);
+    percentiles.record(Start, 400us);
+
+    auto statistics = percentiles.getStatistics(Start, TickWindow::OneSecond);
+    EXPECT_EQ(statistics.p50, 7us);
+    EXPECT_EQ(statistics.max, 400us);
+}
+
+TEST(TickPercentilesTest, WindowsExpire)
+{
+    TickPercentiles percentiles;
+    percentiles.record(Start, 500ms);
+    percentiles.record(Start + 10s, 50ms);
+
+    EXPECT_EQ(percentiles.getStatistics(Start + 10s, TickWindow::OneSecond).max, 50ms);
+    EXPECT_EQ(percentiles.getStatistics(Start + 10s, TickWindow::OneMinute).max, 500ms);
+    EXPECT_EQ(percentiles.getStatistics(Start + 2min, TickWindow::OneMinute).count, 0);
+    EXPECT_EQ(percentiles.getStatistics(Start + 2min, TickWindow::FiveMinutes).count, 2);
+    EXPECT_EQ(percentiles.getStatistics(Start + 10min, TickWindow::FiveMinutes).count, 0);
+    EXPECT_EQ(percentiles.getStatistics(Start + 10min, TickWindow::FifteenMinutes).max, 500ms);
+}
+
+TEST(TickPercentilesTest, ReusesSlotsAfterWrapping)
+{
+    TickPercentiles percentiles;
+    percentiles.record(Start, 500ms);
+    percentiles.record(Start + 61s, 50ms);
+    EXPECT_EQ(percentiles.getStatistics(Start + 61s, TickWindow::OneMinute).max, 50ms);
+}
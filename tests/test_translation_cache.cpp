@@ -0,0 +1,83 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/translation_cache.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using endstone::Translatable;
+using endstone::detail::TranslationCache;
+
+namespace {
+// Formats like the game does, sequential %s and positional %1$s placeholders
+std::string format(const std::string &text, const std::vector<std::string> &params)
+{
+    std::string result;
+    std::size_t next = 0;
+    for (std::size_t i = 0; i < text.size(); i++) {
+        if (text[i] == '%' && i + 1 < text.size() && text[i + 1] == 's') {
+            result += next < params.size() ? params[next++] : "";
+            i++;
+        }
+        else if (text[i] == '%' && i + 3 < text.size() && text.compare(i + 2, 2, "$s") == 0) {
+            auto index = static_cast<std::size_t>(text[i + 1] - '1');
+            result += index < params.size() ? params[index] : "";
+            i += 3;
+        }
+        else {
+            result.push_back(text[i]);
+        }
+    }
+    return result;
+}
+}  // namespace
+
+class TranslationCacheTest : public ::testing::Test {
+protected:
+    std::map<std::string, std::map<std::string, std::string>> translations_{
+        {"en_US", {{"greeting", "Hello %s, welcome to %s"}, {"gave", "Gave %2$s to %1$s"}, {"diamond", "Diamond"}}},
+        {"fr_FR", {{"greeting", "Bonjour %s, bienvenue sur %s"}}},
+    };
+    int lookups_ = 0;
+    TranslationCache cache_{[this](const std::string &key, const std::vector<std::string> &params,
+                                   const std::string &locale) {
+        lookups_++;
+        auto &entries = translations_[locale];
+        auto it = entries.find(key);
+        return it == entries.end() ? key : format(it->second, params);
+    }};
+};
+
+TEST_F(TranslationCacheTest, CompilesOncePerLocaleAndKey)
+{
+    EXPECT_EQ(cache_.translate({"greeting", {"Steve", "Endstone"}}, "en_US"), "Hello Steve, welcome to Endstone");
+    EXPECT_EQ(cache_.translate({"greeting", {"Alex", "Endstone"}}, "en_US"), "Hello Alex, welcome to Endstone");
+    EXPECT_EQ(cache_.translate({"greeting", {"Alex", "Endstone"}}, "fr_FR"), "Bonjour Alex, bienvenue sur Endstone");
+    EXPECT_EQ(lookups_, 2);
+    EXPECT_EQ(cache_.size(), 2);
+
+    cache_.clear();
+    EXPECT_EQ(cache_.translate({"greeting", {"Steve"}}, "en_US"), "Hello Steve, welcome to ");
+    EXPECT_EQ(lookups_, 3);
+}
+
+TEST_F(TranslationCacheTest, PositionalAndNestedParameters)
+{
+    EXPECT_EQ(cache_.translate({"gave", {"Steve", "%diamond"}}, "en_US"), "Gave Diamond to Steve");
+    EXPECT_EQ(cache_.translate({"missing.key"}, "en_US"), "missing.key");
+}
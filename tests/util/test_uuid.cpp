@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <cstdint>
+#include <unordered_set>
 
 #include <gtest/gtest.h>
 
@@ -36,3 +37,40 @@ TEST(UUIDTest, ConvertToAndFromEndstone)
         EXPECT_EQ(expect.data[i], actual.data[i]);
     }
 }
+
+TEST(UUIDTest, ConvertsHalvesInBigEndianOrder)
+{
+    constexpr mce::UUID mce_uuid{0x123e4567e89b12d3, static_cast<std::int64_t>(0xa456426614174000)};
+    constexpr auto uuid = mce_uuid.toEndstone();
+    static_assert(uuid.data[0] == 0x12 && uuid.data[15] == 0x00);
+    EXPECT_EQ(uuid.str(), "123e4567-e89b-12d3-a456-426614174000");
+
+    const auto back = mce::UUID::fromEndstone(uuid);
+    EXPECT_EQ(back.data_0, mce_uuid.data_0);
+    EXPECT_EQ(back.data_1, mce_uuid.data_1);
+}
+
+TEST(UUIDTest, ParsesAndFormatsTheCanonicalForm)
+{
+    constexpr auto parsed = endstone::UUID::fromString("123E4567-e89b-12d3-a456-426614174000");
+    static_assert(parsed.has_value() && parsed->version() == 1);
+    EXPECT_EQ(parsed->str(), "123e4567-e89b-12d3-a456-426614174000");
+    EXPECT_EQ(endstone::UUID::fromString(parsed->str()), parsed);
+
+    EXPECT_FALSE(endstone::UUID::fromString("").has_value());
+    EXPECT_FALSE(endstone::UUID::fromString("123e4567e89b12d3a456426614174000").has_value());
+    EXPECT_FALSE(endstone::UUID::fromString("123e4567-e89b-12d3-a456-42661417400g").has_value());
+    EXPECT_FALSE(endstone::UUID::fromString("{123e4567-e89b-12d3-a456-4266141740}").has_value());
+}
+
+TEST(UUIDTest, TellsApartUUIDsDifferingInOneBit)
+{
+    endstone::UUID base{};
+    std::unordered_set<std::size_t> hashes{std::hash<endstone::UUID>{}(base)};
+    for (std::size_t i = 0; i < 128; ++i) {
+        auto uuid = base;
+        uuid.data[i / 8] ^= static_cast<std::uint8_t>(1U << (i % 8));
+        hashes.insert(std::hash<endstone::UUID>{}(uuid));
+    }
+    EXPECT_EQ(hashes.size(), 129);
+}
@@ -0,0 +1,88 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/util/vector_array.h"
+
+using endstone::Vector;
+using endstone::VectorArray;
+
+TEST(VectorArrayTest, StoresComponentsAligned)
+{
+    VectorArray<float> array;
+    array.push_back({1.0F, 2.0F, 3.0F});
+    array.push_back({4.0F, 5.0F, 6.0F});
+    array.set(0, {7.0F, 8.0F, 9.0F});
+
+    ASSERT_EQ(array.size(), 2);
+    EXPECT_EQ(array.get(0), Vector<float>(7.0F, 8.0F, 9.0F));
+    EXPECT_EQ(array.get(1), Vector<float>(4.0F, 5.0F, 6.0F));
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(array.getX().data()) % VectorArray<float>::Alignment, 0);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(array.getY().data()) % VectorArray<float>::Alignment, 0);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(array.getZ().data()) % VectorArray<float>::Alignment, 0);
+}
+
+TEST(VectorArrayTest, MatchesScalarMath)
+{
+    std::mt19937 rng{42};
+    std::uniform_real_distribution<double> dist{-100.0, 100.0};
+    std::vector<Vector<double>> vectors;
+    VectorArray<double> array;
+    // Not a multiple of the vector width, so the remainder of the loops is covered too
+    for (int i = 0; i < 1003; i++) {
+        vectors.emplace_back(dist(rng), dist(rng), dist(rng));
+        array.push_back(vectors.back());
+    }
+
+    const Vector<double> point{10.0, -20.0, 30.0};
+    const Vector<double> min{-50.0, -50.0, -50.0};
+    const Vector<double> max{50.0, 25.0, 50.0};
+    std::vector<double> distances;
+    std::vector<std::uint8_t> in_radius;
+    std::vector<std::uint8_t> in_box;
+    array.distanceSquared(point, distances);
+    const auto radius_count = array.withinRadius(point, 60.0, in_radius);
+    const auto box_count = array.withinBox(min, max, in_box);
+
+    std::size_t expected_radius_count = 0;
+    std::size_t expected_box_count = 0;
+    for (std::size_t i = 0; i < vectors.size(); i++) {
+        const auto &v = vectors[i];
+        EXPECT_DOUBLE_EQ(distances[i], v.distanceSquared(point));
+        const bool expected_in_radius = v.distanceSquared(point) <= 60.0 * 60.0;
+        const bool expected_in_box = v.getX() >= min.getX() && v.getX() <= max.getX() && v.getY() >= min.getY() &&
+                                     v.getY() <= max.getY() && v.getZ() >= min.getZ() && v.getZ() <= max.getZ();
+        EXPECT_EQ(in_radius[i], expected_in_radius);
+        EXPECT_EQ(in_box[i], expected_in_box);
+        expected_radius_count += expected_in_radius;
+        expected_box_count += expected_in_box;
+    }
+    EXPECT_EQ(radius_count, expected_radius_count);
+    EXPECT_EQ(box_count, expected_box_count);
+    EXPECT_GT(radius_count, 0);
+    EXPECT_GT(box_count, 0);
+}
+
+TEST(VectorArrayTest, HandlesAnEmptyArray)
+{
+    VectorArray<float> array;
+    std::vector<std::uint8_t> mask{1, 1};
+    EXPECT_EQ(array.withinRadius({}, 1.0F, mask), 0);
+    EXPECT_TRUE(mask.empty());
+}